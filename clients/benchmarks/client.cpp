@@ -23,6 +23,7 @@
 * ************************************************************************ */
 
 #include "rocsparse.hpp"
+#include "rocsparse_init.hpp"
 #include "utility.hpp"
 
 // Level1
@@ -33,19 +34,26 @@
 #include "testing_gthrz.hpp"
 #include "testing_roti.hpp"
 #include "testing_sctr.hpp"
+#include "testing_spaxpy.hpp"
+#include "testing_spdot.hpp"
 
 // Level2
 #include "testing_bsrmv.hpp"
 #include "testing_bsrsv.hpp"
 #include "testing_coomv.hpp"
+#include "testing_csrdeltamv.hpp"
+#include "testing_csrmspv.hpp"
 #include "testing_csrmv.hpp"
 #include "testing_csrsv.hpp"
 #include "testing_ellmv.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_sellcmv.hpp"
 
 // Level3
 #include "testing_bsrmm.hpp"
+#include "testing_bsrsm.hpp"
 #include "testing_csrmm.hpp"
+#include "testing_csrsddmm.hpp"
 #include "testing_csrsm.hpp"
 #include "testing_gemmi.hpp"
 
@@ -61,7 +69,9 @@
 
 // Conversion
 #include "testing_bsr2csr.hpp"
+#include "testing_bsr_check.hpp"
 #include "testing_coo2csr.hpp"
+#include "testing_coo_check.hpp"
 #include "testing_coosort.hpp"
 #include "testing_csc2dense.hpp"
 #include "testing_cscsort.hpp"
@@ -69,10 +79,15 @@
 #include "testing_csr2coo.hpp"
 #include "testing_csr2csc.hpp"
 #include "testing_csr2csr_compress.hpp"
+#include "testing_csr2csrdelta.hpp"
 #include "testing_csr2dense.hpp"
 #include "testing_csr2ell.hpp"
 #include "testing_csr2gebsr.hpp"
 #include "testing_csr2hyb.hpp"
+#include "testing_csr2sellc.hpp"
+#include "testing_csr_analyze_structure.hpp"
+#include "testing_csr_check.hpp"
+#include "testing_csrdelta2csr.hpp"
 #include "testing_csrsort.hpp"
 #include "testing_dense2csc.hpp"
 #include "testing_dense2csr.hpp"
@@ -87,6 +102,7 @@
 #include "testing_prune_csr2csr_by_percentage.hpp"
 #include "testing_prune_dense2csr.hpp"
 #include "testing_prune_dense2csr_by_percentage.hpp"
+#include "testing_sellc2csr.hpp"
 
 #include <boost/program_options.hpp>
 #include <iostream>
@@ -107,6 +123,8 @@ int main(int argc, char* argv[])
     std::string   function;
     std::string   filename;
     std::string   rocalution;
+    std::string   write_rocalution;
+    std::string   timing_mode;
     char          precision = 's';
     char          transA;
     char          transB;
@@ -116,12 +134,16 @@ int main(int argc, char* argv[])
     int           baseD;
     int           action;
     int           part;
+    int           csrmv_alg;
+    char          mattype;
     char          diag;
     char          uplo;
     char          apol;
     rocsparse_int dir;
 
     std::vector<rocsparse_int> laplace(3, 0);
+    std::vector<double>        rmat;
+    rocsparse_int              fem_block_dim;
 
     rocsparse_int device_id;
 
@@ -144,12 +166,12 @@ int main(int argc, char* argv[])
 
         ("sizennz,z",
         po::value<rocsparse_int>(&arg.nnz)->default_value(32),
-        "Specific vector size testing, LEVEL-1: the number of non-zero elements "
-        "of the sparse vector.")
+        "Specific vector size testing, LEVEL-1 and csrmspv: the number of non-zero "
+        "elements of the sparse vector.")
 
         ("blockdim",
         po::value<rocsparse_int>(&arg.block_dim)->default_value(2),
-        "BSR block dimension (default: 2)")
+        "BSR block dimension, rows per block of the delta compressed CSR format (default: 2)")
 
         ("row-blockdimA",
         po::value<rocsparse_int>(&arg.row_block_dimA)->default_value(2),
@@ -167,6 +189,14 @@ int main(int argc, char* argv[])
         po::value<rocsparse_int>(&arg.col_block_dimB)->default_value(2),
         "General BSR col block dimension (default: 2)")
 
+        ("slice-size",
+        po::value<rocsparse_int>(&arg.slice_size)->default_value(32),
+        "SELL-C-sigma number of rows per slice C (default: 32)")
+
+        ("sigma",
+        po::value<rocsparse_int>(&arg.sigma)->default_value(1),
+        "SELL-C-sigma number of consecutive rows sorted by length (default: 1)")
+
         ("mtx",
         po::value<std::string>(&filename)->default_value(""), "read from matrix "
         "market (.mtx) format. This will override parameters -m, -n, and -z.")
@@ -180,6 +210,38 @@ int main(int argc, char* argv[])
         "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
         "will override parameters -m, -n, -z and --mtx.")
 
+        ("stencil",
+        po::value<rocsparse_int>(&arg.stencil)->default_value(0), "number of stencil points "
+        "of the laplacian matrix, 5, 9, 13 or 25 in 2D and 7, 13, 19, 27 or 125 in 3D "
+        "(default: 9 in 2D and 27 in 3D)")
+
+        ("write-rocalution",
+        po::value<std::string>(&write_rocalution)->default_value(""), "write the laplacian "
+        "matrix given by --laplacian-dim and --stencil to a rocalution matrix binary file "
+        "and exit.")
+
+        ("rmat",
+        po::value<std::vector<double> >(&rmat)->multitoken(), "generate m x n R-MAT "
+        "matrix with quadrant probabilities <a b c d>.")
+
+        ("powerlaw",
+        po::value<double>(&arg.powerlaw_exponent)->default_value(2.5), "generate m x n "
+        "matrix with power-law distributed row lengths of given exponent.")
+
+        ("bandwidth",
+        po::value<rocsparse_int>(&arg.bandwidth)->default_value(8), "generate m x n banded "
+        "matrix with row-wise lower and upper bandwidth sampled from [0, bandwidth].")
+
+        ("fem-blockdim",
+        po::value<rocsparse_int>(&fem_block_dim)->default_value(0), "generate m x n FEM-like "
+        "matrix of dense blocks with given block dimension. This will override parameter "
+        "--blockdim.")
+
+        ("row-nnz",
+        po::value<rocsparse_int>(&arg.row_nnz)->default_value(16), "average number of "
+        "non-zero entries per row of generated R-MAT, power-law and FEM-like matrices "
+        "(default: 16)")
+
         ("alpha",
         po::value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -225,6 +287,15 @@ int main(int argc, char* argv[])
         "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
         "2 = rocsparse_hyb_partition_max, (default: 0)")
 
+        ("csrmv-alg",
+        po::value<int>(&csrmv_alg)->default_value(1),
+        "0 = rocsparse_csrmv_alg_stream, 1 = rocsparse_csrmv_alg_adaptive,\n"
+        "2 = rocsparse_csrmv_alg_merge_path, csrmv only (default: 1)")
+
+        ("mattype",
+        po::value<char>(&mattype)->default_value('G'),
+        "G = general, S = symmetric, H = Hermitian, T = triangular, (default = G)")
+
         ("diag",
         po::value<char>(&diag)->default_value('N'),
         "N = non-unit diagonal, U = unit diagonal, (default = N)")
@@ -244,16 +315,17 @@ int main(int argc, char* argv[])
         ("function,f",
         po::value<std::string>(&function)->default_value("axpyi"),
         "SPARSE function to test. Options:\n"
-        "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-        "  Level2: bsrmv, bsrsv, coomv, csrmv, csrsv, ellmv, hybmv\n"
-        "  Level3: bsrmm, csrmm, csrsm, gemmi\n"
+        "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr, spdot, spaxpy\n"
+        "  Level2: bsrmv, bsrsv, coomv, csrmv, csrmspv, csrsv, ellmv, hybmv, sellcmv, csrdeltamv\n"
+        "  Level3: bsrmm, bsrsm, csrmm, csrsm, gemmi, csrsddmm\n"
         "  Extra: csrgeam, csrgemm\n"
         "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0\n"
-        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
-        "              coo2csr, ell2csr, hyb2csr, dense2csr, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
+        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2sellc, csr2csrdelta, csr2bsr, csr2gebsr\n"
+        "              coo2csr, ell2csr, hyb2csr, sellc2csr, csrdelta2csr, dense2csr, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
         "              csr2dense, csc2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
         "  Sorting: cscsort, csrsort, coosort\n"
-        "  Misc: identity, nnz")
+        "  Checks: csr_check, coo_check, bsr_check\n"
+        "  Misc: identity, nnz, csr_analyze_structure")
 
         ("precision,r",
         po::value<char>(&precision)->default_value('s'), "Options: s,d,c,z")
@@ -266,6 +338,17 @@ int main(int argc, char* argv[])
         po::value<int>(&arg.iters)->default_value(10),
         "Iterations to run inside timing loop")
 
+        ("timing-mode",
+        po::value<std::string>(&timing_mode)->default_value("hot"),
+        "hot = back-to-back calls with warm cache, cold = device cache flushed before each "
+        "call, transfer = host to device transfer, call and device to host transfer "
+        "(cold and transfer: csrmv, coomv, bsrsv, csrsv, csrsm, csric0, csrilu0, csrgemm, "
+        "csrgeam and the conversions), e2e = transfer plus analysis, buffer size or nnz step "
+        "and clear, with per-phase breakdown (routines that have such a step), "
+        "amortize = buffer size, analysis, solve and clear with sweep over the number of "
+        "solves per analysis (bsrilu0, bsrsv, csric0, csrilu0, csrsm and csrsv only) "
+        "(default: hot)")
+
         ("device,d",
         po::value<rocsparse_int>(&device_id)->default_value(0),
         "Set default device to be used for subsequent program runs")
@@ -334,17 +417,108 @@ int main(int argc, char* argv[])
     arg.baseC = (baseC == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
     arg.baseD = (baseD == 0) ? rocsparse_index_base_zero : rocsparse_index_base_one;
 
-    arg.action = (action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
-    arg.part   = (part == 0)   ? rocsparse_hyb_partition_auto
-                 : (part == 1) ? rocsparse_hyb_partition_user
-                               : rocsparse_hyb_partition_max;
-    arg.diag   = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
-    arg.uplo   = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
-    arg.apol   = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
-    arg.spol   = rocsparse_solve_policy_auto;
+    arg.action  = (action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
+    arg.part    = (part == 0)   ? rocsparse_hyb_partition_auto
+                  : (part == 1) ? rocsparse_hyb_partition_user
+                                : rocsparse_hyb_partition_max;
+    arg.mattype = (mattype == 'S')   ? rocsparse_matrix_type_symmetric
+                  : (mattype == 'H') ? rocsparse_matrix_type_hermitian
+                  : (mattype == 'T') ? rocsparse_matrix_type_triangular
+                                     : rocsparse_matrix_type_general;
+    arg.diag    = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
+    arg.uplo    = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
+    arg.apol    = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
+    arg.spol    = rocsparse_solve_policy_auto;
     arg.direction
         = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
 
+    if(timing_mode == "hot")
+    {
+        arg.timing_mode = rocsparse_timing_hot;
+    }
+    else if(timing_mode == "cold")
+    {
+        arg.timing_mode = rocsparse_timing_cold;
+    }
+    else if(timing_mode == "transfer")
+    {
+        arg.timing_mode = rocsparse_timing_transfer;
+    }
+    else if(timing_mode == "e2e")
+    {
+        arg.timing_mode = rocsparse_timing_end_to_end;
+    }
+    else if(timing_mode == "amortize")
+    {
+        arg.timing_mode = rocsparse_timing_amortization;
+    }
+    else
+    {
+        std::cerr << "Invalid value for --timing-mode" << std::endl;
+        return -1;
+    }
+
+    bool amortization_function = function == "bsrilu0" || function == "bsrsv"
+                                 || function == "csric0" || function == "csrilu0"
+                                 || function == "csrsm" || function == "csrsv";
+
+    // Routines whose benchmark runs through rocsparse_phase_timer
+    bool phase_function = function == "csrmv" || function == "coomv" || function == "csrsv"
+                          || function == "csrsm" || function == "csrilu0" || function == "csric0"
+                          || function == "bsrsv" || function == "csrgemm" || function == "csrgeam"
+                          || function == "csr2coo" || function == "coo2csr" || function == "csr2csc"
+                          || function == "gebsr2gebsc" || function == "csr2ell"
+                          || function == "ell2csr" || function == "csr2hyb" || function == "hyb2csr"
+                          || function == "csr2sellc" || function == "sellc2csr"
+                          || function == "csr2csrdelta" || function == "csrdelta2csr"
+                          || function == "csr2bsr" || function == "bsr2csr"
+                          || function == "csr2gebsr" || function == "gebsr2csr"
+                          || function == "gebsr2gebsr" || function == "csr2csr_compress"
+                          || function == "prune_csr2csr"
+                          || function == "prune_csr2csr_by_percentage"
+                          || function == "prune_dense2csr"
+                          || function == "prune_dense2csr_by_percentage" || function == "csr2dense"
+                          || function == "csc2dense" || function == "dense2csr"
+                          || function == "dense2csc";
+
+    // Routines that additionally time a setup phase (analysis, buffer size or nnz) under e2e
+    bool setup_function = function == "csrmv" || function == "csrsv" || function == "csrsm"
+                          || function == "csrilu0" || function == "csric0" || function == "bsrsv"
+                          || function == "csrgemm" || function == "csrgeam" || function == "csr2csc"
+                          || function == "gebsr2gebsc" || function == "csr2ell"
+                          || function == "ell2csr" || function == "hyb2csr"
+                          || function == "csr2sellc" || function == "sellc2csr"
+                          || function == "csr2csrdelta" || function == "csr2bsr"
+                          || function == "csr2gebsr" || function == "gebsr2gebsr"
+                          || function == "csr2csr_compress" || function == "prune_csr2csr"
+                          || function == "prune_csr2csr_by_percentage"
+                          || function == "prune_dense2csr"
+                          || function == "prune_dense2csr_by_percentage" || function == "dense2csr"
+                          || function == "dense2csc";
+
+    if((arg.timing_mode == rocsparse_timing_amortization && !amortization_function)
+       || ((arg.timing_mode == rocsparse_timing_cold
+            || arg.timing_mode == rocsparse_timing_transfer)
+           && !phase_function)
+       || (arg.timing_mode == rocsparse_timing_end_to_end && !setup_function))
+    {
+        std::cerr << "--timing-mode " << timing_mode << " is not supported by " << function
+                  << std::endl;
+        return -1;
+    }
+
+    // Set R-MAT probabilities
+    if(rmat.size() != 0 && rmat.size() != 4)
+    {
+        std::cerr << "Invalid value for --rmat" << std::endl;
+        return -1;
+    }
+
+    arg.rmat_a = (rmat.size() == 4) ? rmat[0] : 0.57;
+    arg.rmat_b = (rmat.size() == 4) ? rmat[1] : 0.19;
+    arg.rmat_c = (rmat.size() == 4) ? rmat[2] : 0.19;
+    arg.rmat_d = (rmat.size() == 4) ? rmat[3] : 0.05;
+
     // Set laplace dimensions
     arg.dimx = laplace[0];
     arg.dimy = laplace[1];
@@ -369,11 +543,50 @@ int main(int argc, char* argv[])
         strcpy(arg.filename, filename.c_str());
         arg.matrix = rocsparse_matrix_file_mtx;
     }
+    else if(rmat.size() == 4)
+    {
+        arg.matrix = rocsparse_matrix_rmat;
+    }
+    else if(!vm["powerlaw"].defaulted())
+    {
+        arg.matrix = rocsparse_matrix_powerlaw;
+    }
+    else if(!vm["bandwidth"].defaulted())
+    {
+        arg.matrix = rocsparse_matrix_banded;
+    }
+    else if(fem_block_dim > 0)
+    {
+        arg.block_dim = fem_block_dim;
+        arg.matrix    = rocsparse_matrix_block;
+    }
     else
     {
         arg.matrix = rocsparse_matrix_random;
     }
 
+    // Stream laplacian matrix to rocALUTION file, without touching the device
+    if(write_rocalution != "")
+    {
+        if(arg.matrix != rocsparse_matrix_laplace_2d && arg.matrix != rocsparse_matrix_laplace_3d)
+        {
+            std::cerr << "--write-rocalution requires --laplacian-dim" << std::endl;
+            return -1;
+        }
+
+        rocsparse_status status = rocsparse_write_rocalution_laplace(
+            write_rocalution.c_str(), arg.dimx, arg.dimy, arg.dimz, arg.stencil);
+
+        if(status != rocsparse_status_success)
+        {
+            std::cerr << "Error: cannot write " << write_rocalution << " ("
+                      << rocsparse_status_to_string(status) << ")" << std::endl;
+            return -1;
+        }
+
+        return 0;
+    }
+
     // Device query
     int devs;
     if(hipGetDeviceCount(&devs) != hipSuccess)
@@ -550,6 +763,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_sctr<rocsparse_double_complex>(arg);
     }
+    else if(function == "spdot")
+    {
+        if(precision == 's')
+            testing_spdot<float>(arg);
+        else if(precision == 'd')
+            testing_spdot<double>(arg);
+        else if(precision == 'c')
+            testing_spdot<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_spdot<rocsparse_double_complex>(arg);
+    }
+    else if(function == "spaxpy")
+    {
+        if(precision == 's')
+            testing_spaxpy<float>(arg);
+        else if(precision == 'd')
+            testing_spaxpy<double>(arg);
+        else if(precision == 'c')
+            testing_spaxpy<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_spaxpy<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsrmv")
     {
         if(precision == 's')
@@ -585,7 +820,7 @@ int main(int argc, char* argv[])
     }
     else if(function == "csrmv")
     {
-        arg.algo = 1;
+        arg.algo = csrmv_alg;
         if(precision == 's')
             testing_csrmv<float>(arg);
         else if(precision == 'd')
@@ -595,6 +830,18 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrmspv")
+    {
+        arg.algo = 1;
+        if(precision == 's')
+            testing_csrmspv<float>(arg);
+        else if(precision == 'd')
+            testing_csrmspv<double>(arg);
+        else if(precision == 'c')
+            testing_csrmspv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmspv<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrsv")
     {
         if(precision == 's')
@@ -628,6 +875,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_hybmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "sellcmv")
+    {
+        if(precision == 's')
+            testing_sellcmv<float>(arg);
+        else if(precision == 'd')
+            testing_sellcmv<double>(arg);
+        else if(precision == 'c')
+            testing_sellcmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_sellcmv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrdeltamv")
+    {
+        if(precision == 's')
+            testing_csrdeltamv<float>(arg);
+        else if(precision == 'd')
+            testing_csrdeltamv<double>(arg);
+        else if(precision == 'c')
+            testing_csrdeltamv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrdeltamv<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsrmm")
     {
         if(precision == 's')
@@ -650,6 +919,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrmm<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrsm")
+    {
+        if(precision == 's')
+            testing_bsrsm<float>(arg);
+        else if(precision == 'd')
+            testing_bsrsm<double>(arg);
+        else if(precision == 'c')
+            testing_bsrsm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrsm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrsm")
     {
         if(precision == 's')
@@ -672,6 +952,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gemmi<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrsddmm")
+    {
+        if(precision == 's')
+            testing_csrsddmm<float>(arg);
+        else if(precision == 'd')
+            testing_csrsddmm<double>(arg);
+        else if(precision == 'c')
+            testing_csrsddmm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsddmm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrgeam")
     {
         if(precision == 's')
@@ -860,6 +1151,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csr2hyb<rocsparse_double_complex>(arg);
     }
+    else if(function == "csr2sellc")
+    {
+        if(precision == 's')
+            testing_csr2sellc<float>(arg);
+        else if(precision == 'd')
+            testing_csr2sellc<double>(arg);
+        else if(precision == 'c')
+            testing_csr2sellc<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2sellc<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csr2csrdelta")
+    {
+        if(precision == 's')
+            testing_csr2csrdelta<float>(arg);
+        else if(precision == 'd')
+            testing_csr2csrdelta<double>(arg);
+        else if(precision == 'c')
+            testing_csr2csrdelta<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2csrdelta<rocsparse_double_complex>(arg);
+    }
     else if(function == "csr2bsr")
     {
         if(precision == 's')
@@ -908,6 +1221,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_hyb2csr<rocsparse_double_complex>(arg);
     }
+    else if(function == "sellc2csr")
+    {
+        if(precision == 's')
+            testing_sellc2csr<float>(arg);
+        else if(precision == 'd')
+            testing_sellc2csr<double>(arg);
+        else if(precision == 'c')
+            testing_sellc2csr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_sellc2csr<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrdelta2csr")
+    {
+        if(precision == 's')
+            testing_csrdelta2csr<float>(arg);
+        else if(precision == 'd')
+            testing_csrdelta2csr<double>(arg);
+        else if(precision == 'c')
+            testing_csrdelta2csr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrdelta2csr<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsr2csr")
     {
         if(precision == 's')
@@ -978,10 +1313,33 @@ int main(int argc, char* argv[])
     {
         testing_coosort<float>(arg);
     }
+    else if(function == "csr_check")
+    {
+        testing_csr_check<float>(arg);
+    }
+    else if(function == "coo_check")
+    {
+        testing_coo_check<float>(arg);
+    }
+    else if(function == "bsr_check")
+    {
+        testing_bsr_check<float>(arg);
+    }
     else if(function == "identity")
     {
         testing_identity<float>(arg);
     }
+    else if(function == "csr_analyze_structure")
+    {
+        if(precision == 's')
+            testing_csr_analyze_structure<float>(arg);
+        else if(precision == 'd')
+            testing_csr_analyze_structure<double>(arg);
+        else if(precision == 'c')
+            testing_csr_analyze_structure<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr_analyze_structure<rocsparse_double_complex>(arg);
+    }
     else
     {
         std::cerr << "Invalid value for --function" << std::endl;
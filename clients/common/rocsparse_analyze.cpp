@@ -0,0 +1,456 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_analyze.hpp"
+#include "gbyte.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Candidate block dimensions, square blocks are stored in bsr format
+static const rocsparse_int row_block_dims[] = {1, 2, 3, 4, 8, 16};
+static const rocsparse_int col_block_dims[] = {1, 2, 3, 4, 8, 16};
+
+static rocsparse_int csr_count_blocks(rocsparse_int                     M,
+                                      rocsparse_int                     N,
+                                      const std::vector<rocsparse_int>& csr_row_ptr,
+                                      const std::vector<rocsparse_int>& csr_col_ind,
+                                      rocsparse_index_base              base,
+                                      rocsparse_int                     row_block_dim,
+                                      rocsparse_int                     col_block_dim)
+{
+    rocsparse_int mb   = (M + row_block_dim - 1) / row_block_dim;
+    rocsparse_int nb   = (N + col_block_dim - 1) / col_block_dim;
+    rocsparse_int nnzb = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : nnzb)
+#endif
+    {
+        // Marker for the block columns that have already been visited in this block row
+        std::vector<rocsparse_int> marker(nb, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for(rocsparse_int i = 0; i < mb; ++i)
+        {
+            rocsparse_int row_begin = i * row_block_dim;
+            rocsparse_int row_end   = std::min(row_begin + row_block_dim, M);
+
+            for(rocsparse_int r = row_begin; r < row_end; ++r)
+            {
+                for(rocsparse_int j = csr_row_ptr[r] - base; j < csr_row_ptr[r + 1] - base; ++j)
+                {
+                    rocsparse_int bcol = (csr_col_ind[j] - base) / col_block_dim;
+
+                    if(marker[bcol] != i)
+                    {
+                        marker[bcol] = i;
+                        ++nnzb;
+                    }
+                }
+            }
+        }
+    }
+
+    return nnzb;
+}
+
+template <typename T>
+void rocsparse_csr_analyze_structure(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     rocsparse_index_base              base,
+                                     rocsparse_csr_structure&          structure)
+{
+    structure     = rocsparse_csr_structure();
+    structure.m   = M;
+    structure.n   = N;
+    structure.nnz = nnz;
+
+    structure.row_nnz_histogram.resize(ROCSPARSE_ANALYZE_HISTOGRAM_BINS, 0);
+
+    if(M <= 0 || N <= 0)
+    {
+        return;
+    }
+
+    // Row length statistics
+    rocsparse_int min_row_nnz = std::numeric_limits<rocsparse_int>::max();
+    rocsparse_int max_row_nnz = 0;
+    double        sum_sq      = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(min : min_row_nnz) \
+    reduction(max : max_row_nnz) reduction(+ : sum_sq)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_nnz = csr_row_ptr[i + 1] - csr_row_ptr[i];
+
+        min_row_nnz = std::min(min_row_nnz, row_nnz);
+        max_row_nnz = std::max(max_row_nnz, row_nnz);
+        sum_sq += static_cast<double>(row_nnz) * row_nnz;
+    }
+
+    structure.min_row_nnz    = min_row_nnz;
+    structure.max_row_nnz    = max_row_nnz;
+    structure.mean_row_nnz   = static_cast<double>(nnz) / M;
+    structure.stddev_row_nnz = std::sqrt(
+        std::max(0.0, sum_sq / M - structure.mean_row_nnz * structure.mean_row_nnz));
+
+    // Number of rows for each exact row length, required by the hyb cost model
+    std::vector<rocsparse_int> row_nnz_count(max_row_nnz + 1, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_nnz = csr_row_ptr[i + 1] - csr_row_ptr[i];
+
+        ++row_nnz_count[row_nnz];
+
+        // Histogram bin is given by the number of significant bits of the row length
+        rocsparse_int bin = 0;
+        while(bin < ROCSPARSE_ANALYZE_HISTOGRAM_BINS - 1 && (row_nnz >> bin) != 0)
+        {
+            ++bin;
+        }
+
+        ++structure.row_nnz_histogram[bin];
+    }
+
+    // Bandwidth and diagonal profile
+    rocsparse_int lower_bandwidth = 0;
+    rocsparse_int upper_bandwidth = 0;
+    rocsparse_int missing_diag    = 0;
+
+    structure.diag_nnz.resize(static_cast<size_t>(M) + N - 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024) reduction(max : lower_bandwidth) \
+    reduction(max : upper_bandwidth) reduction(+ : missing_diag)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        bool diag = false;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            lower_bandwidth = std::max(lower_bandwidth, i - col);
+            upper_bandwidth = std::max(upper_bandwidth, col - i);
+
+            if(col == i)
+            {
+                diag = true;
+            }
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++structure.diag_nnz[col - i + M - 1];
+        }
+
+        if(i < N && !diag)
+        {
+            ++missing_diag;
+        }
+    }
+
+    structure.lower_bandwidth = lower_bandwidth;
+    structure.upper_bandwidth = upper_bandwidth;
+    structure.missing_diag    = missing_diag;
+
+    int64_t diag_length = 0;
+
+    for(rocsparse_int d = -(M - 1); d < N; ++d)
+    {
+        if(structure.diag_nnz[d + M - 1] != 0)
+        {
+            ++structure.ndiag;
+            diag_length += (d >= 0) ? std::min(M, N - d) : std::min(M + d, N);
+        }
+    }
+
+    structure.diag_fill = (diag_length > 0) ? static_cast<double>(nnz) / diag_length : 0.0;
+
+    // CSR
+    structure.csr_gbyte = csrmv_gbyte_count<T>(M, N, nnz);
+    structure.format    = rocsparse_storage_format_csr;
+    structure.gbyte     = structure.csr_gbyte;
+
+    // ELL, the width is given by the longest row
+    structure.ell_width = max_row_nnz;
+    structure.ell_gbyte = std::numeric_limits<double>::infinity();
+
+    if(static_cast<int64_t>(M) * max_row_nnz <= std::numeric_limits<rocsparse_int>::max())
+    {
+        structure.ell_gbyte = ellmv_gbyte_count<T>(M, N, M * max_row_nnz);
+    }
+
+    if(structure.ell_gbyte < structure.gbyte)
+    {
+        structure.format = rocsparse_storage_format_ell;
+        structure.gbyte  = structure.ell_gbyte;
+    }
+
+    // HYB, scan all ELL widths. Starting with a pure COO part, each increment of the
+    // width moves one entry of all rows that are longer than the width into ELL.
+    rocsparse_int coo_nnz    = nnz;
+    rocsparse_int rows_above = M - row_nnz_count[0];
+
+    structure.hyb_gbyte = std::numeric_limits<double>::infinity();
+
+    for(rocsparse_int width = 0; width <= max_row_nnz; ++width)
+    {
+        if(static_cast<int64_t>(M) * width > std::numeric_limits<rocsparse_int>::max())
+        {
+            break;
+        }
+
+        double gbyte = (width > 0 ? ellmv_gbyte_count<T>(M, N, M * width) : 0.0)
+                       + (coo_nnz > 0 ? coomv_gbyte_count<T>(M, N, coo_nnz, width > 0) : 0.0);
+
+        if(gbyte < structure.hyb_gbyte)
+        {
+            structure.hyb_gbyte     = gbyte;
+            structure.hyb_ell_width = width;
+        }
+
+        if(width < max_row_nnz)
+        {
+            coo_nnz -= rows_above;
+            rows_above -= row_nnz_count[width + 1];
+        }
+    }
+
+    if(structure.hyb_gbyte < structure.gbyte)
+    {
+        structure.format = rocsparse_storage_format_hyb;
+        structure.gbyte  = structure.hyb_gbyte;
+    }
+
+    // BSR and GEBSR
+    for(rocsparse_int row_block_dim : row_block_dims)
+    {
+        for(rocsparse_int col_block_dim : col_block_dims)
+        {
+            if(row_block_dim == 1 && col_block_dim == 1)
+            {
+                continue;
+            }
+
+            rocsparse_int mb = (M + row_block_dim - 1) / row_block_dim;
+            rocsparse_int nb = (N + col_block_dim - 1) / col_block_dim;
+
+            rocsparse_block_fill block;
+
+            block.row_block_dim = row_block_dim;
+            block.col_block_dim = col_block_dim;
+            block.nnzb          = csr_count_blocks(
+                M, N, csr_row_ptr, csr_col_ind, base, row_block_dim, col_block_dim);
+            block.fill = (block.nnzb > 0) ? static_cast<double>(nnz) / block.nnzb
+                                                / (row_block_dim * col_block_dim)
+                                          : 0.0;
+            block.gbyte
+                = (row_block_dim == col_block_dim)
+                      ? bsrmv_gbyte_count<T>(mb, nb, block.nnzb, row_block_dim)
+                      : gebsrmv_gbyte_count<T>(mb, nb, block.nnzb, row_block_dim, col_block_dim);
+
+            if(block.gbyte < structure.gbyte)
+            {
+                structure.format        = (row_block_dim == col_block_dim)
+                                              ? rocsparse_storage_format_bsr
+                                              : rocsparse_storage_format_gebsr;
+                structure.row_block_dim = row_block_dim;
+                structure.col_block_dim = col_block_dim;
+                structure.gbyte         = block.gbyte;
+            }
+
+            structure.block_fill.push_back(block);
+        }
+    }
+}
+
+void rocsparse_csr_analyze_levels(rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  rocsparse_index_base              base,
+                                  rocsparse_fill_mode               uplo,
+                                  rocsparse_operation               trans,
+                                  rocsparse_level_schedule&         levels)
+{
+    levels = rocsparse_level_schedule();
+
+    if(M == 0)
+    {
+        return;
+    }
+
+    // Level of each row, such that all rows a row depends on have a lower level
+    std::vector<rocsparse_int> level(M, 0);
+
+    // Work of each row and accumulated work of the dependency chains that end in it
+    std::vector<int64_t> work(M, 1);
+    std::vector<int64_t> chain(M, 0);
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    if(trans == rocsparse_operation_none)
+    {
+        // Row i depends on all rows j of its triangular part, which are visited before i
+        for(rocsparse_int k = 0; k < M; ++k)
+        {
+            rocsparse_int i = lower ? k : M - 1 - k;
+
+            for(rocsparse_int idx = csr_row_ptr[i] - base; idx < csr_row_ptr[i + 1] - base; ++idx)
+            {
+                rocsparse_int j = csr_col_ind[idx] - base;
+
+                if(lower ? (j < i) : (j > i && j < M))
+                {
+                    level[i] = std::max(level[i], level[j] + 1);
+                    chain[i] = std::max(chain[i], chain[j]);
+                    ++work[i];
+                }
+            }
+
+            chain[i] += work[i];
+        }
+    }
+    else
+    {
+        // The transposed solve runs backwards, such that all rows j of the triangular
+        // part of row i depend on i. The work of row j is the number of its dependencies.
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int idx = csr_row_ptr[i] - base; idx < csr_row_ptr[i + 1] - base; ++idx)
+            {
+                rocsparse_int j = csr_col_ind[idx] - base;
+
+                if(lower ? (j < i) : (j > i && j < M))
+                {
+                    ++work[j];
+                }
+            }
+        }
+
+        // Row i is complete once it is visited
+        for(rocsparse_int k = 0; k < M; ++k)
+        {
+            rocsparse_int i = lower ? M - 1 - k : k;
+
+            chain[i] += work[i];
+
+            for(rocsparse_int idx = csr_row_ptr[i] - base; idx < csr_row_ptr[i + 1] - base; ++idx)
+            {
+                rocsparse_int j = csr_col_ind[idx] - base;
+
+                if(lower ? (j < i) : (j > i && j < M))
+                {
+                    level[j] = std::max(level[j], level[i] + 1);
+                    chain[j] = std::max(chain[j], chain[i]);
+                }
+            }
+        }
+    }
+
+    levels.depth         = *std::max_element(level.begin(), level.end()) + 1;
+    levels.critical_path = *std::max_element(chain.begin(), chain.end());
+    levels.parallelism
+        = static_cast<double>(std::accumulate(work.begin(), work.end(), static_cast<int64_t>(0)))
+          / levels.critical_path;
+
+    // Level widths
+    std::vector<rocsparse_int> width(levels.depth, 0);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ++width[level[i]];
+    }
+
+    levels.min_width  = *std::min_element(width.begin(), width.end());
+    levels.max_width  = *std::max_element(width.begin(), width.end());
+    levels.mean_width = static_cast<double>(M) / levels.depth;
+
+    rocsparse_int bins = 1;
+    while((static_cast<int64_t>(1) << bins) <= levels.max_width)
+    {
+        ++bins;
+    }
+
+    levels.width_histogram.assign(bins, 0);
+    for(rocsparse_int w : width)
+    {
+        rocsparse_int bin = 0;
+        while((static_cast<int64_t>(1) << (bin + 1)) <= w)
+        {
+            ++bin;
+        }
+
+        ++levels.width_histogram[bin];
+    }
+}
+
+template void rocsparse_csr_analyze_structure<float>(rocsparse_int                     M,
+                                                     rocsparse_int                     N,
+                                                     rocsparse_int                     nnz,
+                                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                                     rocsparse_index_base              base,
+                                                     rocsparse_csr_structure&          structure);
+
+template void rocsparse_csr_analyze_structure<double>(rocsparse_int                     M,
+                                                      rocsparse_int                     N,
+                                                      rocsparse_int                     nnz,
+                                                      const std::vector<rocsparse_int>& csr_row_ptr,
+                                                      const std::vector<rocsparse_int>& csr_col_ind,
+                                                      rocsparse_index_base              base,
+                                                      rocsparse_csr_structure&          structure);
+
+template void rocsparse_csr_analyze_structure<rocsparse_float_complex>(
+    rocsparse_int                     M,
+    rocsparse_int                     N,
+    rocsparse_int                     nnz,
+    const std::vector<rocsparse_int>& csr_row_ptr,
+    const std::vector<rocsparse_int>& csr_col_ind,
+    rocsparse_index_base              base,
+    rocsparse_csr_structure&          structure);
+
+template void rocsparse_csr_analyze_structure<rocsparse_double_complex>(
+    rocsparse_int                     M,
+    rocsparse_int                     N,
+    rocsparse_int                     nnz,
+    const std::vector<rocsparse_int>& csr_row_ptr,
+    const std::vector<rocsparse_int>& csr_col_ind,
+    rocsparse_index_base              base,
+    rocsparse_csr_structure&          structure);
@@ -31,6 +31,7 @@ import os
 import argparse
 import ctypes
 import glob
+import struct
 from fnmatch import fnmatchcase
 try:  # Import either the C or pure-Python YAML parser
     from yaml import CLoader as Loader
@@ -50,8 +51,15 @@ INCLUDE_RE = re.compile(r'include\s*:\s*(.*)')
 # Regex for complex types
 COMPLEX_RE = re.compile(r'f\d+_c$')
 
+# Magic string terminating the index of the binary file
+INDEX_MAGIC = b'rocSPARSE_index\0'
+
+# Index entry: function, category, first record and number of records
+INDEX_ENTRY = struct.Struct('<64s32sQQ')
+
 args = {}
 testcases = set()
+testgroups = {}
 datatypes = {}
 param = {}
 
@@ -60,6 +68,7 @@ def main():
     args.update(parse_args().__dict__)
     for doc in get_yaml_docs():
         process_doc(doc)
+    write_tests(args['outfile'])
 
 
 def process_doc(doc):
@@ -236,9 +245,9 @@ def setdefaults(test):
 
 
 
-def write_signature(out):
-    """Write the signature used to verify binary file compatibility"""
-    if 'signature_written' not in args:
+def make_signature():
+    """Create the signature used to verify binary file compatibility"""
+    if 'signature' not in args:
         sig = 0
         byt = bytearray("rocSPARSE", 'utf_8')
         byt.append(0)
@@ -255,8 +264,30 @@ def write_signature(out):
             byt.append(0)
         byt.extend(bytes("ROCsparse", 'utf_8'))
         byt.append(0)
-        out.write(byt)
-        args['signature_written'] = True
+        args['signature'] = byt
+
+
+def write_tests(out):
+    """Write the signature, the test cases grouped by function and category,
+       and the index of the groups to the binary file"""
+    if not testgroups:
+        return
+
+    out.write(args['signature'])
+
+    index = bytearray()
+    first = 0
+    for (function, category), tests in testgroups.items():
+        for byt in tests:
+            out.write(byt)
+        index.extend(INDEX_ENTRY.pack(bytes(function, 'utf_8'),
+                                      bytes(category, 'utf_8'),
+                                      first, len(tests)))
+        first += len(tests)
+
+    out.write(index)
+    out.write(struct.pack('<Q', len(testgroups)))
+    out.write(INDEX_MAGIC)
 
 
 def write_test(test):
@@ -286,8 +317,8 @@ def write_test(test):
     byt = bytes(param['Arguments'](*arg))
     if byt not in testcases:
         testcases.add(byt)
-        write_signature(args['outfile'])
-        args['outfile'].write(byt)
+        make_signature()
+        testgroups.setdefault((test['function'], test['category']), []).append(byt)
 
 
 def instantiate(test):
@@ -23,7 +23,9 @@
  * ************************************************************************ */
 #include "utility.hpp"
 
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -139,6 +141,72 @@ void host_sctr(
     }
 }
 
+template <typename T>
+void host_spdot(rocsparse_int        nnz_x,
+                const T*             x_val,
+                const rocsparse_int* x_ind,
+                rocsparse_int        nnz_y,
+                const T*             y_val,
+                const rocsparse_int* y_ind,
+                T*                   result,
+                rocsparse_index_base base)
+{
+    *result = static_cast<T>(0);
+
+    for(rocsparse_int i = 0; i < nnz_x; ++i)
+    {
+        const rocsparse_int* pos = std::lower_bound(y_ind, y_ind + nnz_y, x_ind[i]);
+
+        if(pos != y_ind + nnz_y && *pos == x_ind[i])
+        {
+            *result = std::fma(y_val[pos - y_ind], x_val[i], *result);
+        }
+    }
+}
+
+template <typename T>
+void host_spaxpy(rocsparse_int               nnz_x,
+                 T                           alpha,
+                 const T*                    x_val,
+                 const rocsparse_int*        x_ind,
+                 rocsparse_int               nnz_y,
+                 const T*                    y_val,
+                 const rocsparse_int*        y_ind,
+                 std::vector<T>&             z_val,
+                 std::vector<rocsparse_int>& z_ind,
+                 rocsparse_index_base        base)
+{
+    z_val.clear();
+    z_ind.clear();
+
+    rocsparse_int i = 0;
+    rocsparse_int j = 0;
+
+    // Merge both sorted index arrays
+    while(i < nnz_x || j < nnz_y)
+    {
+        if(j == nnz_y || (i < nnz_x && x_ind[i] < y_ind[j]))
+        {
+            z_ind.push_back(x_ind[i]);
+            z_val.push_back(alpha * x_val[i]);
+            ++i;
+        }
+        else if(i == nnz_x || y_ind[j] < x_ind[i])
+        {
+            z_ind.push_back(y_ind[j]);
+            z_val.push_back(y_val[j]);
+            ++j;
+        }
+        else
+        {
+            z_ind.push_back(y_ind[j]);
+            z_val.push_back(std::fma(alpha, x_val[i], y_val[j]));
+            ++i;
+            ++j;
+        }
+    }
+}
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -644,6 +712,76 @@ void host_bsrsv(rocsparse_operation               trans,
     *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
+template <typename T>
+void host_bsrsm(rocsparse_int                     mb,
+                rocsparse_int                     nrhs,
+                rocsparse_int                     nnzb,
+                rocsparse_direction               dir,
+                rocsparse_operation               transA,
+                rocsparse_operation               transX,
+                T                                 alpha,
+                const std::vector<rocsparse_int>& bsr_row_ptr,
+                const std::vector<rocsparse_int>& bsr_col_ind,
+                const std::vector<T>&             bsr_val,
+                rocsparse_int                     bsr_dim,
+                const std::vector<T>&             B,
+                rocsparse_int                     ldb,
+                std::vector<T>&                   X,
+                rocsparse_int                     ldx,
+                rocsparse_diag_type               diag_type,
+                rocsparse_fill_mode               fill_mode,
+                rocsparse_index_base              base,
+                rocsparse_int*                    struct_pivot,
+                rocsparse_int*                    numeric_pivot)
+{
+    rocsparse_int m = mb * bsr_dim;
+
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    std::vector<T> x(m);
+    std::vector<T> y(m);
+
+    // Solve each column of B independently, pivots do not depend on the right-hand side
+    for(rocsparse_int j = 0; j < nrhs; ++j)
+    {
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            x[i] = (transX == rocsparse_operation_none) ? B[i + j * ldb] : B[j + i * ldb];
+        }
+
+        host_bsrsv(transA,
+                   dir,
+                   mb,
+                   nnzb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val,
+                   bsr_dim,
+                   x,
+                   y,
+                   diag_type,
+                   fill_mode,
+                   base,
+                   struct_pivot,
+                   numeric_pivot);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            if(transX == rocsparse_operation_none)
+            {
+                X[i + j * ldx] = y[i];
+            }
+            else
+            {
+                X[j + i * ldx] = y[i];
+            }
+        }
+    }
+}
+
 template <typename T>
 void host_coomv(rocsparse_int        M,
                 rocsparse_int        nnz,
@@ -672,7 +810,9 @@ void host_coomv(rocsparse_int        M,
 }
 
 template <typename T>
-void host_csrmv(rocsparse_int        M,
+void host_csrmv(rocsparse_operation  trans,
+                rocsparse_int        M,
+                rocsparse_int        N,
                 rocsparse_int        nnz,
                 T                    alpha,
                 const rocsparse_int* csr_row_ptr,
@@ -684,6 +824,37 @@ void host_csrmv(rocsparse_int        M,
                 rocsparse_index_base base,
                 int                  algo)
 {
+    if(trans != rocsparse_operation_none)
+    {
+        // Scale y
+        for(rocsparse_int i = 0; i < N; ++i)
+        {
+            y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+        }
+
+        // Scatter the rows of A into y
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int row_begin = csr_row_ptr[i] - base;
+            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+                T             val = csr_val[j];
+
+                if(trans == rocsparse_operation_conjugate_transpose)
+                {
+                    val = rocsparse_conj(val);
+                }
+
+                y[col] = std::fma(alpha * val, x[i], y[col]);
+            }
+        }
+
+        return;
+    }
+
     if(algo == 0)
     {
         // Get device properties
@@ -769,6 +940,77 @@ void host_csrmv(rocsparse_int        M,
             }
         }
     }
+    else if(algo == 2)
+    {
+        // Merge path, the row ends and non-zero entries are merged into a single sequence
+        // that is split into chunks of equal length. Rows are completed by the chunk that
+        // contains their end, partial sums of the last row of each chunk are added after.
+        static constexpr rocsparse_int chunk_size = 2048;
+
+        rocsparse_int nitems  = M + nnz;
+        rocsparse_int nchunks = (nitems - 1) / chunk_size + 1;
+
+        std::vector<rocsparse_int> carry_row(nchunks);
+        std::vector<T>             carry_val(nchunks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int c = 0; c < nchunks; ++c)
+        {
+            rocsparse_int diag     = c * chunk_size;
+            rocsparse_int diag_end = std::min(diag + chunk_size, nitems);
+
+            // Number of row ends before the start of the chunk
+            rocsparse_int lo = std::max(diag - nnz, 0);
+            rocsparse_int hi = std::min(diag, M);
+
+            while(lo < hi)
+            {
+                rocsparse_int pivot = (lo + hi) >> 1;
+
+                if(csr_row_ptr[pivot + 1] - base <= diag - pivot - 1)
+                {
+                    lo = pivot + 1;
+                }
+                else
+                {
+                    hi = pivot;
+                }
+            }
+
+            rocsparse_int row = lo;
+            rocsparse_int j   = diag - lo;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int k = diag; k < diag_end; ++k)
+            {
+                if(j < csr_row_ptr[row + 1] - base)
+                {
+                    sum = std::fma(alpha * csr_val[j], x[csr_col_ind[j] - base], sum);
+                    ++j;
+                }
+                else
+                {
+                    y[row] = (beta == static_cast<T>(0)) ? sum : std::fma(beta, y[row], sum);
+                    sum    = static_cast<T>(0);
+                    ++row;
+                }
+            }
+
+            carry_row[c] = row;
+            carry_val[c] = sum;
+        }
+
+        for(rocsparse_int c = 0; c < nchunks; ++c)
+        {
+            if(carry_row[c] < M)
+            {
+                y[carry_row[c]] += carry_val[c];
+            }
+        }
+    }
     else
     {
 #ifdef _OPENMP
@@ -803,6 +1045,67 @@ void host_csrmv(rocsparse_int        M,
     }
 }
 
+template <typename T>
+void host_csrmspv(rocsparse_operation  trans,
+                  rocsparse_int        M,
+                  rocsparse_int        N,
+                  rocsparse_int        nnz,
+                  T                    alpha,
+                  const rocsparse_int* csr_row_ptr,
+                  const rocsparse_int* csr_col_ind,
+                  const T*             csr_val,
+                  rocsparse_int        nnz_x,
+                  const T*             x_val,
+                  const rocsparse_int* x_ind,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base)
+{
+    rocsparse_int len_x = (trans == rocsparse_operation_none) ? N : M;
+    rocsparse_int len_y = (trans == rocsparse_operation_none) ? M : N;
+
+    // Expand sparse vector x
+    std::vector<T> x(len_x, static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < nnz_x; ++i)
+    {
+        x[x_ind[i] - base] += x_val[i];
+    }
+
+    // Scale y
+    for(rocsparse_int i = 0; i < len_y; ++i)
+    {
+        y[i] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y[i];
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            if(trans == rocsparse_operation_none)
+            {
+                y[i] = std::fma(alpha * csr_val[j], x[col], y[i]);
+            }
+            else
+            {
+                T val = csr_val[j];
+
+                if(trans == rocsparse_operation_conjugate_transpose)
+                {
+                    val = rocsparse_conj(val);
+                }
+
+                y[col] = std::fma(alpha * val, x[i], y[col]);
+            }
+        }
+    }
+}
+
 template <typename T>
 static void host_csr_lsolve(rocsparse_int                     M,
                             T                                 alpha,
@@ -1164,6 +1467,60 @@ void host_ellmv(rocsparse_int        M,
     }
 }
 
+template <typename T>
+void host_sellcmv(rocsparse_int        M,
+                  rocsparse_int        N,
+                  T                    alpha,
+                  const rocsparse_int* sell_slice_ptr,
+                  const rocsparse_int* sell_col_ind,
+                  const T*             sell_val,
+                  const rocsparse_int* sell_perm,
+                  rocsparse_int        sell_slice_size,
+                  const T*             x,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int s    = i / sell_slice_size;
+        rocsparse_int lane = i % sell_slice_size;
+
+        rocsparse_int slice_begin = sell_slice_ptr[s] - base + lane;
+        rocsparse_int width = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / sell_slice_size;
+
+        T sum = static_cast<T>(0);
+        for(rocsparse_int p = 0; p < width; ++p)
+        {
+            rocsparse_int idx = slice_begin + p * sell_slice_size;
+            rocsparse_int col = sell_col_ind[idx] - base;
+
+            if(col >= 0 && col < N)
+            {
+                sum = std::fma(sell_val[idx], x[col], sum);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        rocsparse_int row = sell_perm[i];
+
+        if(beta != static_cast<T>(0))
+        {
+            y[row] = std::fma(beta, y[row], alpha * sum);
+        }
+        else
+        {
+            y[row] = alpha * sum;
+        }
+    }
+}
+
 template <typename T>
 void host_hybmv(rocsparse_int        M,
                 rocsparse_int        N,
@@ -1664,6 +2021,68 @@ void host_gemmi(rocsparse_int        M,
     }
 }
 
+template <typename T>
+void host_csrsddmm(rocsparse_int                     M,
+                   rocsparse_int                     N,
+                   rocsparse_int                     K,
+                   rocsparse_operation               transA,
+                   rocsparse_operation               transB,
+                   T                                 alpha,
+                   const std::vector<T>&             A,
+                   rocsparse_int                     lda,
+                   const std::vector<T>&             B,
+                   rocsparse_int                     ldb,
+                   T                                 beta,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   std::vector<T>&                   csr_val,
+                   rocsparse_index_base              base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int l = 0; l < K; ++l)
+            {
+                T val_A = (transA == rocsparse_operation_none) ? A[i + l * lda] : A[l + i * lda];
+                T val_B
+                    = (transB == rocsparse_operation_none) ? B[l + col * ldb] : B[col + l * ldb];
+
+                if(transA == rocsparse_operation_conjugate_transpose)
+                {
+                    val_A = rocsparse_conj(val_A);
+                }
+
+                if(transB == rocsparse_operation_conjugate_transpose)
+                {
+                    val_B = rocsparse_conj(val_B);
+                }
+
+                sum = std::fma(val_A, val_B, sum);
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                csr_val[j] = alpha * sum;
+            }
+            else
+            {
+                csr_val[j] = std::fma(beta, csr_val[j], alpha * sum);
+            }
+        }
+    }
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -2142,24 +2561,223 @@ void host_csrgemm(rocsparse_int                     M,
     }
 }
 
-/*
- * ===========================================================================
- *    precond SPARSE
- * ===========================================================================
- */
 template <typename T>
-void host_bsric0(rocsparse_direction               direction,
-                 rocsparse_int                     Mb,
-                 rocsparse_int                     block_dim,
-                 const std::vector<rocsparse_int>& bsr_row_ptr,
-                 const std::vector<rocsparse_int>& bsr_col_ind,
-                 std::vector<T>&                   bsr_val,
-                 rocsparse_index_base              base,
-                 rocsparse_int*                    struct_pivot,
-                 rocsparse_int*                    numeric_pivot)
-
+void host_csrgemm_symbolic(rocsparse_int                     M,
+                           rocsparse_int                     N,
+                           rocsparse_int                     K,
+                           const T*                          alpha,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_B,
+                           const std::vector<rocsparse_int>& csr_col_ind_B,
+                           const T*                          beta,
+                           const std::vector<rocsparse_int>& csr_row_ptr_D,
+                           const std::vector<rocsparse_int>& csr_col_ind_D,
+                           const std::vector<rocsparse_int>& csr_row_ptr_C,
+                           std::vector<rocsparse_int>&       csr_col_ind_C,
+                           rocsparse_index_base              base_A,
+                           rocsparse_index_base              base_B,
+                           rocsparse_index_base              base_C,
+                           rocsparse_index_base              base_D)
 {
-    rocsparse_int M = Mb * block_dim;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> nnz(N, -1);
+
+#ifdef _OPENMP
+        rocsparse_int nthreads = omp_get_num_threads();
+        rocsparse_int tid      = omp_get_thread_num();
+#else
+        rocsparse_int nthreads = 1;
+        rocsparse_int tid      = 0;
+#endif
+
+        rocsparse_int rows_per_thread = (M + nthreads - 1) / nthreads;
+        rocsparse_int chunk_begin     = rows_per_thread * tid;
+        rocsparse_int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+
+        // Loop over rows of A
+        for(rocsparse_int i = chunk_begin; i < chunk_end; ++i)
+        {
+            rocsparse_int row_begin_C = csr_row_ptr_C[i] - base_C;
+            rocsparse_int row_end_C   = row_begin_C;
+
+            if(alpha)
+            {
+                rocsparse_int row_begin_A = csr_row_ptr_A[i] - base_A;
+                rocsparse_int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+                // Loop over columns of A
+                for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+                {
+                    // Current column of A
+                    rocsparse_int col_A = csr_col_ind_A[j] - base_A;
+
+                    rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - base_B;
+                    rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+
+                    // Loop over columns of B in row col_A
+                    for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+                    {
+                        // Current column of B
+                        rocsparse_int col_B = csr_col_ind_B[k] - base_B;
+
+                        // Check if a new nnz is generated
+                        if(nnz[col_B] != i)
+                        {
+                            nnz[col_B]                 = i;
+                            csr_col_ind_C[row_end_C++] = col_B + base_C;
+                        }
+                    }
+                }
+            }
+
+            // Add nnz of D if beta != 0
+            if(beta)
+            {
+                rocsparse_int row_begin_D = csr_row_ptr_D[i] - base_D;
+                rocsparse_int row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+
+                // Loop over columns of D
+                for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+                {
+                    // Current column of D
+                    rocsparse_int col_D = csr_col_ind_D[j] - base_D;
+
+                    // Check if a new nnz is generated
+                    if(nnz[col_D] != i)
+                    {
+                        nnz[col_D]                 = i;
+                        csr_col_ind_C[row_end_C++] = col_D + base_C;
+                    }
+                }
+            }
+
+            // Sort columns of C
+            std::sort(csr_col_ind_C.begin() + row_begin_C, csr_col_ind_C.begin() + row_end_C);
+        }
+    }
+}
+
+template <typename T>
+void host_csrgemm_numeric(rocsparse_int                     M,
+                          rocsparse_int                     N,
+                          rocsparse_int                     K,
+                          const T*                          alpha,
+                          const std::vector<rocsparse_int>& csr_row_ptr_A,
+                          const std::vector<rocsparse_int>& csr_col_ind_A,
+                          const std::vector<T>&             csr_val_A,
+                          const std::vector<rocsparse_int>& csr_row_ptr_B,
+                          const std::vector<rocsparse_int>& csr_col_ind_B,
+                          const std::vector<T>&             csr_val_B,
+                          const T*                          beta,
+                          const std::vector<rocsparse_int>& csr_row_ptr_D,
+                          const std::vector<rocsparse_int>& csr_col_ind_D,
+                          const std::vector<T>&             csr_val_D,
+                          const std::vector<rocsparse_int>& csr_row_ptr_C,
+                          const std::vector<rocsparse_int>& csr_col_ind_C,
+                          std::vector<T>&                   csr_val_C,
+                          rocsparse_index_base              base_A,
+                          rocsparse_index_base              base_B,
+                          rocsparse_index_base              base_C,
+                          rocsparse_index_base              base_D)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Position of each column of the current row of C
+        std::vector<rocsparse_int> pos(N, -1);
+
+#ifdef _OPENMP
+        rocsparse_int nthreads = omp_get_num_threads();
+        rocsparse_int tid      = omp_get_thread_num();
+#else
+        rocsparse_int nthreads = 1;
+        rocsparse_int tid      = 0;
+#endif
+
+        rocsparse_int rows_per_thread = (M + nthreads - 1) / nthreads;
+        rocsparse_int chunk_begin     = rows_per_thread * tid;
+        rocsparse_int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+
+        // Loop over rows of A
+        for(rocsparse_int i = chunk_begin; i < chunk_end; ++i)
+        {
+            rocsparse_int row_begin_C = csr_row_ptr_C[i] - base_C;
+            rocsparse_int row_end_C   = csr_row_ptr_C[i + 1] - base_C;
+
+            // Scatter the sparsity pattern of C, that is given by the symbolic phase
+            for(rocsparse_int j = row_begin_C; j < row_end_C; ++j)
+            {
+                pos[csr_col_ind_C[j] - base_C] = j;
+                csr_val_C[j]                   = static_cast<T>(0);
+            }
+
+            if(alpha)
+            {
+                rocsparse_int row_begin_A = csr_row_ptr_A[i] - base_A;
+                rocsparse_int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+                // Loop over columns of A
+                for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+                {
+                    // Current column of A
+                    rocsparse_int col_A = csr_col_ind_A[j] - base_A;
+                    // Current value of A
+                    T val_A = *alpha * csr_val_A[j];
+
+                    rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - base_B;
+                    rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+
+                    // Loop over columns of B in row col_A
+                    for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+                    {
+                        rocsparse_int col_B = csr_col_ind_B[k] - base_B;
+
+                        csr_val_C[pos[col_B]] += val_A * csr_val_B[k];
+                    }
+                }
+            }
+
+            // Add D if beta != 0
+            if(beta)
+            {
+                rocsparse_int row_begin_D = csr_row_ptr_D[i] - base_D;
+                rocsparse_int row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+
+                // Loop over columns of D
+                for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+                {
+                    rocsparse_int col_D = csr_col_ind_D[j] - base_D;
+
+                    csr_val_C[pos[col_D]] += *beta * csr_val_D[j];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * ===========================================================================
+ *    precond SPARSE
+ * ===========================================================================
+ */
+template <typename T>
+void host_bsric0(rocsparse_direction               direction,
+                 rocsparse_int                     Mb,
+                 rocsparse_int                     block_dim,
+                 const std::vector<rocsparse_int>& bsr_row_ptr,
+                 const std::vector<rocsparse_int>& bsr_col_ind,
+                 std::vector<T>&                   bsr_val,
+                 rocsparse_index_base              base,
+                 rocsparse_int*                    struct_pivot,
+                 rocsparse_int*                    numeric_pivot)
+
+{
+    rocsparse_int M = Mb * block_dim;
 
     // Initialize pivot
     *struct_pivot  = -1;
@@ -2919,6 +3537,80 @@ void host_prune_dense2csr(rocsparse_int               m,
     }
 }
 
+// Select the element of rank k among the absolute values of the m x n matrix A. The bit
+// patterns of non-negative floating point values are ordered like the values, such that a
+// most significant digit radix select finds the element in a few passes over A, without
+// copying or sorting it.
+template <typename T>
+static T host_radix_select_abs(rocsparse_int m, rocsparse_int n, const T* A, int64_t lda, int64_t k)
+{
+    using K = typename std::conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type;
+
+    constexpr int key_bits   = sizeof(K) * 8;
+    constexpr int radix_bits = 16;
+    constexpr K   radix      = static_cast<K>(1) << radix_bits;
+
+    int64_t size   = static_cast<int64_t>(m) * n;
+    K       prefix = 0;
+
+    if(size == 0)
+    {
+        return static_cast<T>(0);
+    }
+
+    for(int shift = key_bits - radix_bits; shift >= 0; shift -= radix_bits)
+    {
+        // Digits above the current one have already been selected
+        K mask = (shift + radix_bits == key_bits) ? 0 : ~static_cast<K>(0) << (shift + radix_bits);
+
+        std::vector<int64_t> histogram(radix, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int64_t> local_histogram(radix, 0);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for(int64_t idx = 0; idx < size; ++idx)
+            {
+                T val = std::abs(A[lda * (idx / m) + idx % m]);
+                K key;
+                memcpy(&key, &val, sizeof(K));
+
+                if((key & mask) == prefix)
+                {
+                    ++local_histogram[(key >> shift) & (radix - 1)];
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for(K digit = 0; digit < radix; ++digit)
+            {
+                histogram[digit] += local_histogram[digit];
+            }
+        }
+
+        // Select the digit whose range of ranks contains k
+        K digit = 0;
+        while(k >= histogram[digit])
+        {
+            k -= histogram[digit++];
+        }
+
+        prefix |= digit << shift;
+    }
+
+    T value;
+    memcpy(&value, &prefix, sizeof(T));
+
+    return value;
+}
+
 template <typename T>
 void host_prune_dense2csr_by_percentage(rocsparse_int               m,
                                         rocsparse_int               n,
@@ -2931,23 +3623,12 @@ void host_prune_dense2csr_by_percentage(rocsparse_int               m,
                                         std::vector<rocsparse_int>& csr_row_ptr,
                                         std::vector<rocsparse_int>& csr_col_ind)
 {
-    rocsparse_int nnz_A = m * n;
-    rocsparse_int pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
-    pos                 = std::min(pos, nnz_A - 1);
-    pos                 = std::max(pos, 0);
-
-    std::vector<T> sorted_A(m * n);
-    for(rocsparse_int i = 0; i < n; i++)
-    {
-        for(rocsparse_int j = 0; j < m; j++)
-        {
-            sorted_A[m * i + j] = std::abs(A[lda * i + j]);
-        }
-    }
+    int64_t nnz_A = static_cast<int64_t>(m) * n;
+    int64_t pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
+    pos           = std::min(pos, nnz_A - 1);
+    pos           = std::max(pos, static_cast<int64_t>(0));
 
-    std::sort(sorted_A.begin(), sorted_A.end());
-
-    T threshold = sorted_A[pos];
+    T threshold = host_radix_select_abs(m, n, A.data(), lda, pos);
     host_prune_dense2csr<T>(m, n, A, lda, base, threshold, nnz, csr_val, csr_row_ptr, csr_col_ind);
 }
 
@@ -3066,73 +3747,359 @@ rocsparse_status host_csx2dense(rocsparse_int        m,
     return rocsparse_status_invalid_value;
 }
 
-template <typename T>
-void host_csr_to_csc(rocsparse_int                     M,
-                     rocsparse_int                     N,
-                     rocsparse_int                     nnz,
-                     const std::vector<rocsparse_int>& csr_row_ptr,
-                     const std::vector<rocsparse_int>& csr_col_ind,
-                     const std::vector<T>&             csr_val,
-                     std::vector<rocsparse_int>&       csc_row_ind,
-                     std::vector<rocsparse_int>&       csc_col_ptr,
-                     std::vector<T>&                   csc_val,
-                     rocsparse_action                  action,
-                     rocsparse_index_base              base)
+// Stable transposition of a compressed sparse structure. For every entry j of row i,
+// scatter(i, j, idx) is called with the position idx of the entry in the transposed
+// structure, such that entries of the same column remain ordered by row. The column
+// pointer array of the transposed structure is written to col_ptr.
+//
+// Rows are split into chunks of balanced number of non-zeros, one per thread, that are
+// counted and scattered with per-thread histograms. Histograms of very wide matrices
+// do not fit into cache, in which case columns are first bucketed into cache sized
+// column blocks, which are then transposed independently of each other.
+template <typename F>
+static void host_csx_transpose(rocsparse_int               M,
+                               rocsparse_int               N,
+                               const rocsparse_int*        row_ptr,
+                               const rocsparse_int*        col_ind,
+                               rocsparse_index_base        base,
+                               std::vector<rocsparse_int>& col_ptr,
+                               rocsparse_index_base        col_ptr_base,
+                               F                           scatter)
 {
-    csc_row_ind.resize(nnz);
-    csc_col_ptr.resize(N + 1, 0);
-    csc_val.resize(nnz);
+    // Maximum number of histogram bins per thread
+    static constexpr rocsparse_int max_bins = 1 << 16;
 
-    // Determine nnz per column
-    for(rocsparse_int i = 0; i < nnz; ++i)
+    rocsparse_int nnz = (M > 0) ? row_ptr[M] - row_ptr[0] : 0;
+
+    col_ptr.resize(N + 1);
+
+#ifdef _OPENMP
+    rocsparse_int nparts = std::max(1, std::min(omp_get_max_threads(), M));
+#else
+    rocsparse_int nparts = 1;
+#endif
+
+    // Split rows into chunks of balanced number of non-zeros
+    std::vector<rocsparse_int> row_split(nparts + 1, M);
+
+    row_split[0] = 0;
+    for(rocsparse_int t = 1; t < nparts; ++t)
     {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+        int64_t target = row_ptr[0] + static_cast<int64_t>(nnz) * t / nparts;
+        row_split[t]
+            = std::lower_bound(row_ptr, row_ptr + M, static_cast<rocsparse_int>(target)) - row_ptr;
     }
 
-    // Scan
-    for(rocsparse_int i = 0; i < N; ++i)
+    // Columns are bucketed by col >> shift
+    rocsparse_int shift = 0;
+    while(N > 0 && ((N - 1) >> shift) >= max_bins)
     {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
+        ++shift;
     }
 
-    // Fill row indices and values
-    for(rocsparse_int i = 0; i < M; ++i)
+    rocsparse_int nbins = (N > 0) ? ((N - 1) >> shift) + 1 : 0;
+
+    // Per-thread histograms, turned into per-thread scatter offsets
+    std::vector<rocsparse_int> offset(static_cast<size_t>(nparts) * nbins, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(rocsparse_int t = 0; t < nparts; ++t)
     {
-        rocsparse_int row_begin = csr_row_ptr[i] - base;
-        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+        rocsparse_int* count = offset.data() + static_cast<size_t>(t) * nbins;
+        rocsparse_int  begin = row_ptr[row_split[t]] - base;
+        rocsparse_int  end   = row_ptr[row_split[t + 1]] - base;
 
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        for(rocsparse_int j = begin; j < end; ++j)
         {
-            rocsparse_int col = csr_col_ind[j] - base;
-            rocsparse_int idx = csc_col_ptr[col];
+            ++count[(col_ind[j] - base) >> shift];
+        }
+    }
 
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
+    // Bin offsets, ordered by thread within each bin
+    std::vector<rocsparse_int> bin_ptr(nbins + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int b = 0; b < nbins; ++b)
+    {
+        rocsparse_int sum = 0;
+        for(rocsparse_int t = 0; t < nparts; ++t)
+        {
+            size_t        idx = static_cast<size_t>(t) * nbins + b;
+            rocsparse_int c   = offset[idx];
 
-            ++csc_col_ptr[col];
+            offset[idx] = sum;
+            sum += c;
         }
+
+        bin_ptr[b + 1] = sum;
     }
 
-    // Shift column pointer array
-    for(rocsparse_int i = N; i > 0; --i)
+    for(rocsparse_int b = 0; b < nbins; ++b)
     {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+        bin_ptr[b + 1] += bin_ptr[b];
     }
 
-    csc_col_ptr[0] = base;
-}
+    // Without bucketing, each bin is a column and entries are scattered to their final
+    // position. Otherwise, the row and position of each entry are scattered into its
+    // column block.
+    std::vector<rocsparse_int> bucket_row(shift ? nnz : 0);
+    std::vector<rocsparse_int> bucket_pos(shift ? nnz : 0);
 
-template <typename T>
-void host_csr_to_gebsr(rocsparse_direction               direction,
-                       rocsparse_int                     m,
-                       rocsparse_int                     n,
-                       rocsparse_int                     nnz,
-                       const std::vector<T>&             csr_val,
-                       const std::vector<rocsparse_int>& csr_row_ptr,
-                       const std::vector<rocsparse_int>& csr_col_ind,
-                       rocsparse_int                     row_block_dim,
-                       rocsparse_int                     col_block_dim,
-                       rocsparse_index_base              csr_base,
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(rocsparse_int t = 0; t < nparts; ++t)
+    {
+        rocsparse_int* next = offset.data() + static_cast<size_t>(t) * nbins;
+
+        for(rocsparse_int i = row_split[t]; i < row_split[t + 1]; ++i)
+        {
+            for(rocsparse_int j = row_ptr[i] - base; j < row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int b   = (col_ind[j] - base) >> shift;
+                rocsparse_int idx = bin_ptr[b] + next[b]++;
+
+                if(shift == 0)
+                {
+                    scatter(i, j, idx);
+                }
+                else
+                {
+                    bucket_row[idx] = i;
+                    bucket_pos[idx] = j;
+                }
+            }
+        }
+    }
+
+    if(shift == 0)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(rocsparse_int c = 0; c <= N; ++c)
+        {
+            col_ptr[c] = bin_ptr[c] + col_ptr_base;
+        }
+
+        return;
+    }
+
+    // Transpose column blocks independently
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> next(1 << shift);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(rocsparse_int b = 0; b < nbins; ++b)
+        {
+            rocsparse_int col_begin = b << shift;
+            rocsparse_int width     = std::min(N - col_begin, 1 << shift);
+
+            std::fill(next.begin(), next.begin() + width, 0);
+
+            for(rocsparse_int k = bin_ptr[b]; k < bin_ptr[b + 1]; ++k)
+            {
+                ++next[col_ind[bucket_pos[k]] - base - col_begin];
+            }
+
+            rocsparse_int sum = bin_ptr[b];
+            for(rocsparse_int c = 0; c < width; ++c)
+            {
+                rocsparse_int n = next[c];
+
+                col_ptr[col_begin + c] = sum + col_ptr_base;
+                next[c]                = sum;
+                sum += n;
+            }
+
+            for(rocsparse_int k = bin_ptr[b]; k < bin_ptr[b + 1]; ++k)
+            {
+                rocsparse_int j = bucket_pos[k];
+                scatter(bucket_row[k], j, next[col_ind[j] - base - col_begin]++);
+            }
+        }
+    }
+
+    col_ptr[N] = nnz + col_ptr_base;
+}
+
+template <typename T>
+void host_csr_to_csc(rocsparse_int                     M,
+                     rocsparse_int                     N,
+                     rocsparse_int                     nnz,
+                     const std::vector<rocsparse_int>& csr_row_ptr,
+                     const std::vector<rocsparse_int>& csr_col_ind,
+                     const std::vector<T>&             csr_val,
+                     std::vector<rocsparse_int>&       csc_row_ind,
+                     std::vector<rocsparse_int>&       csc_col_ptr,
+                     std::vector<T>&                   csc_val,
+                     rocsparse_action                  action,
+                     rocsparse_index_base              base)
+{
+    csc_row_ind.resize(nnz);
+    csc_val.resize(nnz);
+
+    host_csx_transpose(M,
+                       N,
+                       csr_row_ptr.data(),
+                       csr_col_ind.data(),
+                       base,
+                       csc_col_ptr,
+                       base,
+                       [&](rocsparse_int i, rocsparse_int j, rocsparse_int idx) {
+                           csc_row_ind[idx] = i + base;
+                           csc_val[idx]     = csr_val[j];
+                       });
+}
+
+void host_csr_to_csc_map(rocsparse_int                     M,
+                         rocsparse_int                     N,
+                         rocsparse_int                     nnz,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         std::vector<rocsparse_int>&       csc_map,
+                         rocsparse_index_base              base)
+{
+    std::vector<rocsparse_int> csc_col_ptr;
+
+    csc_map.resize(nnz);
+
+    host_csx_transpose(M,
+                       N,
+                       csr_row_ptr.data(),
+                       csr_col_ind.data(),
+                       base,
+                       csc_col_ptr,
+                       base,
+                       [&](rocsparse_int i, rocsparse_int j, rocsparse_int idx) {
+                           csc_map[j] = idx;
+                       });
+}
+
+template <typename T>
+void host_csr_to_general(rocsparse_operation               trans,
+                         rocsparse_matrix_type             type,
+                         rocsparse_fill_mode               uplo,
+                         rocsparse_diag_type               diag,
+                         rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>&             csr_val,
+                         std::vector<rocsparse_int>&       gen_row_ptr,
+                         std::vector<rocsparse_int>&       gen_col_ind,
+                         std::vector<T>&                   gen_val,
+                         rocsparse_index_base              base)
+{
+    // Entries of op(A) in coordinate format
+    std::vector<rocsparse_int> coo_row;
+    std::vector<rocsparse_int> coo_col;
+    std::vector<T>             coo_val;
+
+    auto push = [&](rocsparse_int i, rocsparse_int j, T val) {
+        if(trans != rocsparse_operation_none)
+        {
+            std::swap(i, j);
+        }
+
+        if(trans == rocsparse_operation_conjugate_transpose)
+        {
+            val = rocsparse_conj(val);
+        }
+
+        coo_row.push_back(i);
+        coo_col.push_back(j);
+        coo_val.push_back(val);
+    };
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        if(type != rocsparse_matrix_type_general && diag == rocsparse_diag_type_unit)
+        {
+            push(i, i, static_cast<T>(1));
+        }
+
+        for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            rocsparse_int j   = csr_col_ind[k] - base;
+            T             val = csr_val[k];
+
+            if(type == rocsparse_matrix_type_general)
+            {
+                push(i, j, val);
+            }
+            else if(i == j)
+            {
+                if(diag == rocsparse_diag_type_non_unit)
+                {
+                    push(i, j, val);
+                }
+            }
+            else if(uplo == rocsparse_fill_mode_lower ? j < i : j > i)
+            {
+                push(i, j, val);
+
+                if(type == rocsparse_matrix_type_symmetric)
+                {
+                    push(j, i, val);
+                }
+                else if(type == rocsparse_matrix_type_hermitian)
+                {
+                    push(j, i, rocsparse_conj(val));
+                }
+            }
+        }
+    }
+
+    // Sort by row and column
+    std::vector<rocsparse_int> perm(coo_row.size());
+    for(size_t k = 0; k < perm.size(); ++k)
+    {
+        perm[k] = k;
+    }
+
+    std::sort(perm.begin(), perm.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return coo_row[a] < coo_row[b] || (coo_row[a] == coo_row[b] && coo_col[a] < coo_col[b]);
+    });
+
+    gen_row_ptr.assign(M + 1, 0);
+    gen_col_ind.resize(perm.size());
+    gen_val.resize(perm.size());
+
+    for(size_t k = 0; k < perm.size(); ++k)
+    {
+        ++gen_row_ptr[coo_row[perm[k]] + 1];
+
+        gen_col_ind[k] = coo_col[perm[k]] + base;
+        gen_val[k]     = coo_val[perm[k]];
+    }
+
+    gen_row_ptr[0] = base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        gen_row_ptr[i + 1] += gen_row_ptr[i];
+    }
+}
+
+template <typename T>
+void host_csr_to_gebsr(rocsparse_direction               direction,
+                       rocsparse_int                     m,
+                       rocsparse_int                     n,
+                       rocsparse_int                     nnz,
+                       const std::vector<T>&             csr_val,
+                       const std::vector<rocsparse_int>& csr_row_ptr,
+                       const std::vector<rocsparse_int>& csr_col_ind,
+                       rocsparse_int                     row_block_dim,
+                       rocsparse_int                     col_block_dim,
+                       rocsparse_index_base              csr_base,
                        std::vector<T>&                   bsr_val,
                        std::vector<rocsparse_int>&       bsr_row_ptr,
                        std::vector<rocsparse_int>&       bsr_col_ind,
@@ -3276,6 +4243,59 @@ void host_csr_to_gebsr(rocsparse_direction               direction,
     }
 }
 
+void host_csr_to_gebsr_map(rocsparse_direction               direction,
+                           rocsparse_int                     m,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           rocsparse_int                     row_block_dim,
+                           rocsparse_int                     col_block_dim,
+                           rocsparse_index_base              csr_base,
+                           const std::vector<rocsparse_int>& bsr_row_ptr,
+                           const std::vector<rocsparse_int>& bsr_col_ind,
+                           rocsparse_index_base              bsr_base,
+                           std::vector<rocsparse_int>&       bsr_map)
+{
+    bsr_map.resize(csr_row_ptr[m] - csr_base);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < m; i++)
+    {
+        rocsparse_int start = csr_row_ptr[i] - csr_base;
+        rocsparse_int end   = csr_row_ptr[i + 1] - csr_base;
+
+        rocsparse_int bstart = bsr_row_ptr[i / row_block_dim] - bsr_base;
+        rocsparse_int bend   = bsr_row_ptr[i / row_block_dim + 1] - bsr_base;
+
+        rocsparse_int local_row = i % row_block_dim;
+
+        for(rocsparse_int j = start; j < end; j++)
+        {
+            rocsparse_int col       = csr_col_ind[j] - csr_base;
+            rocsparse_int local_col = col % col_block_dim;
+
+            // Block columns are sorted, search the block of this entry
+            rocsparse_int k = bstart;
+            while(k < bend && bsr_col_ind[k] - bsr_base != col / col_block_dim)
+            {
+                ++k;
+            }
+
+            if(direction == rocsparse_direction_row)
+            {
+                bsr_map[j] = row_block_dim * col_block_dim * k + col_block_dim * local_row
+                             + local_col;
+            }
+            else
+            {
+                bsr_map[j] = row_block_dim * col_block_dim * k + row_block_dim * local_col
+                             + local_row;
+            }
+        }
+    }
+}
+
 template <typename T>
 void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_int                     Nb,
@@ -3291,54 +4311,25 @@ void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_action                  action,
                          rocsparse_index_base              base)
 {
-    bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(Nb + 1, 0);
-    bsc_val.resize(nnzb);
-
     const rocsparse_int block_shift = row_block_dim * col_block_dim;
 
-    //
-    // Determine nnz per column
-    //
-    for(rocsparse_int i = 0; i < nnzb; ++i)
-    {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - base];
-    }
-
-    // Scan
-    for(rocsparse_int i = 0; i < Nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
-
-    // Fill row indices and values
-    for(rocsparse_int i = 0; i < Mb; ++i)
-    {
-        const rocsparse_int row_begin = bsr_row_ptr[i] - base;
-        const rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
-
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
-        {
-            const rocsparse_int col = bsr_col_ind[j] - base;
-            const rocsparse_int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + base;
-            for(rocsparse_int k = 0; k < block_shift; ++k)
-            {
-                bsc_val[idx * block_shift + k] = bsr_val[j * block_shift + k];
-            }
-
-            ++bsc_col_ptr[col];
-        }
-    }
-
-    // Shift column pointer array
-    for(rocsparse_int i = Nb; i > 0; --i)
-    {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + base;
-    }
-
-    bsc_col_ptr[0] = base;
+    bsc_row_ind.resize(nnzb);
+    bsc_val.resize(static_cast<size_t>(nnzb) * block_shift);
+
+    host_csx_transpose(Mb,
+                       Nb,
+                       bsr_row_ptr.data(),
+                       bsr_col_ind.data(),
+                       base,
+                       bsc_col_ptr,
+                       base,
+                       [&](rocsparse_int i, rocsparse_int j, rocsparse_int idx) {
+                           bsc_row_ind[idx] = i + base;
+                           for(rocsparse_int k = 0; k < block_shift; ++k)
+                           {
+                               bsc_val[idx * block_shift + k] = bsr_val[j * block_shift + k];
+                           }
+                       });
 }
 
 template <typename T>
@@ -3470,54 +4461,27 @@ void host_bsr_to_bsc(rocsparse_int                     mb,
                      rocsparse_index_base              bsc_base)
 {
     bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(nb + 1, 0);
     bsc_val.resize(nnzb * bsr_dim * bsr_dim);
 
-    // Determine nnz per column
-    for(rocsparse_int i = 0; i < nnzb; ++i)
-    {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
-    }
-
-    // Scan
-    for(rocsparse_int i = 0; i < nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
-
-    // Fill row indices and values
-    for(rocsparse_int i = 0; i < mb; ++i)
-    {
-        rocsparse_int row_begin = bsr_row_ptr[i] - bsr_base;
-        rocsparse_int row_end   = bsr_row_ptr[i + 1] - bsr_base;
-
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
-        {
-            rocsparse_int col = bsr_col_ind[j] - bsr_base;
-            rocsparse_int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + bsc_base;
-
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
-            {
-                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
-                {
-                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
-                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
-                }
-            }
-
-            ++bsc_col_ptr[col];
-        }
-    }
-
-    // Shift column pointer array
-    for(rocsparse_int i = nb; i > 0; --i)
-    {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
-    }
-
-    bsc_col_ptr[0] = bsc_base;
+    host_csx_transpose(mb,
+                       nb,
+                       bsr_row_ptr.data(),
+                       bsr_col_ind.data(),
+                       bsr_base,
+                       bsc_col_ptr,
+                       bsc_base,
+                       [&](rocsparse_int i, rocsparse_int j, rocsparse_int idx) {
+                           bsc_row_ind[idx] = i + bsc_base;
+
+                           for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                           {
+                               for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                               {
+                                   bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
+                                       = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
+                               }
+                           }
+                       });
 }
 
 template <typename T>
@@ -3581,6 +4545,228 @@ void host_csr_to_ell(rocsparse_int                     M,
     }
 }
 
+void host_csr_to_ell_map(rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         rocsparse_int                     ell_width,
+                         std::vector<rocsparse_int>&       ell_map,
+                         rocsparse_index_base              csr_base)
+{
+    ell_map.resize(csr_row_ptr[M] - csr_base);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - csr_base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - csr_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int p = j - row_begin;
+
+            ell_map[j] = (p < ell_width) ? p * M + i : -1;
+        }
+    }
+}
+
+template <typename T>
+void host_csr_to_sellc(rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr,
+                       const std::vector<rocsparse_int>& csr_col_ind,
+                       const std::vector<T>&             csr_val,
+                       rocsparse_int                     sell_slice_size,
+                       rocsparse_int                     sell_sigma,
+                       std::vector<rocsparse_int>&       sell_slice_ptr,
+                       std::vector<rocsparse_int>&       sell_perm,
+                       std::vector<rocsparse_int>&       sell_col_ind,
+                       std::vector<T>&                   sell_val,
+                       rocsparse_int&                    sell_nnz,
+                       rocsparse_index_base              csr_base,
+                       rocsparse_index_base              sell_base)
+{
+    rocsparse_int nslices = (M - 1) / sell_slice_size + 1;
+
+    // Sort the rows of each window of sell_sigma rows by their number of non-zero
+    // entries in descending order, rows of equal length keep their order
+    sell_perm.resize(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        sell_perm[i] = i;
+    }
+
+    auto row_nnz = [&](rocsparse_int i) { return csr_row_ptr[i + 1] - csr_row_ptr[i]; };
+
+    for(rocsparse_int w = 0; w < M; w += sell_sigma)
+    {
+        std::stable_sort(sell_perm.begin() + w,
+                         sell_perm.begin() + std::min(w + sell_sigma, M),
+                         [&](rocsparse_int a, rocsparse_int b) { return row_nnz(a) > row_nnz(b); });
+    }
+
+    // Each slice is padded to its longest row
+    sell_slice_ptr.resize(nslices + 1);
+    sell_slice_ptr[0] = sell_base;
+
+    for(rocsparse_int s = 0; s < nslices; ++s)
+    {
+        rocsparse_int width = 0;
+
+        for(rocsparse_int i = s * sell_slice_size; i < std::min((s + 1) * sell_slice_size, M); ++i)
+        {
+            width = std::max(row_nnz(sell_perm[i]), width);
+        }
+
+        sell_slice_ptr[s + 1] = sell_slice_ptr[s] + width * sell_slice_size;
+    }
+
+    sell_nnz = sell_slice_ptr[nslices] - sell_base;
+
+    sell_col_ind.resize(sell_nnz);
+    sell_val.resize(sell_nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int s = 0; s < nslices; ++s)
+    {
+        rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base;
+        rocsparse_int width = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / sell_slice_size;
+
+        for(rocsparse_int lane = 0; lane < sell_slice_size; ++lane)
+        {
+            rocsparse_int i = s * sell_slice_size + lane;
+
+            rocsparse_int row_begin = 0;
+            rocsparse_int row_end   = 0;
+
+            if(i < M)
+            {
+                row_begin = csr_row_ptr[sell_perm[i]] - csr_base;
+                row_end   = csr_row_ptr[sell_perm[i] + 1] - csr_base;
+            }
+
+            // Fill SELL-C-sigma slice with data and add padding
+            for(rocsparse_int p = 0; p < width; ++p)
+            {
+                rocsparse_int idx = slice_begin + lane + p * sell_slice_size;
+                rocsparse_int j   = row_begin + p;
+
+                if(j < row_end)
+                {
+                    sell_col_ind[idx] = csr_col_ind[j] - csr_base + sell_base;
+                    sell_val[idx]     = csr_val[j];
+                }
+                else
+                {
+                    sell_col_ind[idx] = -1;
+                    sell_val[idx]     = static_cast<T>(0);
+                }
+            }
+        }
+    }
+}
+
+void host_csr_to_csrdelta(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          const std::vector<rocsparse_int>& csr_col_ind,
+                          rocsparse_int                     block_dim,
+                          std::vector<rocsparse_int>&       csrdelta_block_ptr,
+                          std::vector<rocsparse_int>&       csrdelta_width,
+                          std::vector<rocsparse_int>&       csrdelta_row_col,
+                          std::vector<rocsparse_int>&       csrdelta_col_ind,
+                          rocsparse_int&                    csrdelta_nnz,
+                          rocsparse_index_base              base)
+{
+    rocsparse_int nblocks = (M - 1) / block_dim + 1;
+
+    csrdelta_block_ptr.resize(nblocks + 1);
+    csrdelta_width.resize(nblocks);
+    csrdelta_row_col.resize(M);
+
+    // The width of a block is given by the largest span of column indices of its rows
+    csrdelta_block_ptr[0] = base;
+
+    for(rocsparse_int b = 0; b < nblocks; ++b)
+    {
+        rocsparse_int row_begin = b * block_dim;
+        rocsparse_int row_end   = std::min(row_begin + block_dim, M);
+
+        rocsparse_int width = 1;
+
+        for(rocsparse_int i = row_begin; i < row_end; ++i)
+        {
+            if(csr_row_ptr[i] == csr_row_ptr[i + 1])
+            {
+                continue;
+            }
+
+            rocsparse_int span = csr_col_ind[csr_row_ptr[i + 1] - base - 1]
+                                 - csr_col_ind[csr_row_ptr[i] - base];
+
+            if(span > 0xFFFF)
+            {
+                width = sizeof(rocsparse_int);
+            }
+            else if(span > 0xFF)
+            {
+                width = std::max(width, 2);
+            }
+        }
+
+        size_t nnzb = csr_row_ptr[row_end] - csr_row_ptr[row_begin];
+
+        csrdelta_width[b] = width;
+        csrdelta_block_ptr[b + 1]
+            = csrdelta_block_ptr[b]
+              + (nnzb == 0 ? 0 : (nnzb * width - 1) / sizeof(rocsparse_int) + 1);
+    }
+
+    csrdelta_nnz = csrdelta_block_ptr[nblocks] - base;
+
+    // Padding bytes of the packed offsets are zero
+    csrdelta_col_ind.assign(csrdelta_nnz, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int b         = i / block_dim;
+        rocsparse_int width     = csrdelta_width[b];
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        rocsparse_int block_begin = csr_row_ptr[b * block_dim] - base;
+
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(
+            csrdelta_col_ind.data() + csrdelta_block_ptr[b] - base);
+
+        // Empty rows store the index base as their first column
+        rocsparse_int first = (row_begin < row_end) ? csr_col_ind[row_begin] : base;
+
+        csrdelta_row_col[i] = first;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int  offset = csr_col_ind[j] - first;
+            unsigned char* dst    = bytes + static_cast<size_t>(j - block_begin) * width;
+
+            if(width == 1)
+            {
+                *dst = static_cast<unsigned char>(offset);
+            }
+            else if(width == 2)
+            {
+                unsigned short tmp = static_cast<unsigned short>(offset);
+                memcpy(dst, &tmp, sizeof(tmp));
+            }
+            else
+            {
+                memcpy(dst, &offset, sizeof(offset));
+            }
+        }
+    }
+}
+
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
@@ -3683,6 +4869,31 @@ void host_csr_to_hyb(rocsparse_int                     M,
     }
 }
 
+void host_csr_to_hyb_map(rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         rocsparse_int                     ell_width,
+                         std::vector<rocsparse_int>&       hyb_map,
+                         rocsparse_index_base              base)
+{
+    rocsparse_int ell_nnz = ell_width * M;
+    rocsparse_int coo_idx = ell_nnz;
+
+    hyb_map.resize(csr_row_ptr[M] - base);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int p = j - row_begin;
+
+            hyb_map[j] = (p < ell_width) ? p * M + i : coo_idx++;
+        }
+    }
+}
+
 template <typename T>
 void host_csr_to_csr_compress(rocsparse_int                     M,
                               rocsparse_int                     N,
@@ -3849,19 +5060,7 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
     pos               = std::min(pos, nnz_A - 1);
     pos               = std::max(pos, 0);
 
-    std::vector<T> sorted_A(nnz_A);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int i = 0; i < nnz_A; i++)
-    {
-        sorted_A[i] = std::abs(csr_val_A[i]);
-    }
-
-    std::sort(sorted_A.begin(), sorted_A.end());
-
-    T threshold = sorted_A[pos];
+    T threshold = host_radix_select_abs(nnz_A, 1, csr_val_A.data(), nnz_A, pos);
 
     host_prune_csr_to_csr<T>(M,
                              N,
@@ -3944,8 +5143,197 @@ void host_ell_to_csr(rocsparse_int                     M,
                 csr_col_ind[csr_idx] = col + csr_base;
                 csr_val[csr_idx]     = ell_val[idx];
 
-                ++csr_idx;
-            }
+                ++csr_idx;
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_sellc_to_csr(rocsparse_int                     M,
+                       rocsparse_int                     N,
+                       rocsparse_int                     sell_slice_size,
+                       const std::vector<rocsparse_int>& sell_slice_ptr,
+                       const std::vector<rocsparse_int>& sell_col_ind,
+                       const std::vector<T>&             sell_val,
+                       const std::vector<rocsparse_int>& sell_perm,
+                       std::vector<rocsparse_int>&       csr_row_ptr,
+                       std::vector<rocsparse_int>&       csr_col_ind,
+                       std::vector<T>&                   csr_val,
+                       rocsparse_int&                    csr_nnz,
+                       rocsparse_index_base              sell_base,
+                       rocsparse_index_base              csr_base)
+{
+    csr_row_ptr.resize(M + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int s    = i / sell_slice_size;
+        rocsparse_int lane = i % sell_slice_size;
+
+        rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base + lane;
+        rocsparse_int width = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / sell_slice_size;
+
+        rocsparse_int row_nnz = 0;
+        for(rocsparse_int p = 0; p < width; ++p)
+        {
+            rocsparse_int col = sell_col_ind[slice_begin + p * sell_slice_size] - sell_base;
+
+            if(col >= 0 && col < N)
+            {
+                ++row_nnz;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        csr_row_ptr[sell_perm[i]] = row_nnz;
+    }
+
+    // Determine row pointers
+    csr_nnz = csr_base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int tmp = csr_row_ptr[i];
+        csr_row_ptr[i]    = csr_nnz;
+        csr_nnz += tmp;
+    }
+
+    csr_row_ptr[M] = csr_nnz;
+    csr_nnz -= csr_base;
+
+    // Allocate memory for columns and values
+    csr_col_ind.resize(csr_nnz);
+    csr_val.resize(csr_nnz);
+
+    // Fill CSR structure
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int s    = i / sell_slice_size;
+        rocsparse_int lane = i % sell_slice_size;
+
+        rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base + lane;
+        rocsparse_int row_begin   = csr_row_ptr[sell_perm[i]] - csr_base;
+        rocsparse_int row_nnz     = csr_row_ptr[sell_perm[i] + 1] - csr_row_ptr[sell_perm[i]];
+
+        for(rocsparse_int p = 0; p < row_nnz; ++p)
+        {
+            rocsparse_int idx = slice_begin + p * sell_slice_size;
+
+            csr_col_ind[row_begin + p] = sell_col_ind[idx] - sell_base + csr_base;
+            csr_val[row_begin + p]     = sell_val[idx];
+        }
+    }
+}
+
+void host_csrdelta_to_csr(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          rocsparse_int                     block_dim,
+                          const std::vector<rocsparse_int>& csrdelta_block_ptr,
+                          const std::vector<rocsparse_int>& csrdelta_width,
+                          const std::vector<rocsparse_int>& csrdelta_row_col,
+                          const std::vector<rocsparse_int>& csrdelta_col_ind,
+                          std::vector<rocsparse_int>&       csr_col_ind,
+                          rocsparse_index_base              base)
+{
+    csr_col_ind.resize(csr_row_ptr[M] - csr_row_ptr[0]);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int b         = i / block_dim;
+        rocsparse_int width     = csrdelta_width[b];
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        rocsparse_int block_begin = csr_row_ptr[b * block_dim] - base;
+
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(
+            csrdelta_col_ind.data() + csrdelta_block_ptr[b] - base);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            const unsigned char* src    = bytes + static_cast<size_t>(j - block_begin) * width;
+            rocsparse_int        offset = 0;
+
+            if(width == 1)
+            {
+                offset = *src;
+            }
+            else if(width == 2)
+            {
+                unsigned short tmp;
+                memcpy(&tmp, src, sizeof(tmp));
+                offset = tmp;
+            }
+            else
+            {
+                memcpy(&offset, src, sizeof(offset));
+            }
+
+            csr_col_ind[j] = csrdelta_row_col[i] + offset;
+        }
+    }
+}
+
+// Stable counting sort of the permutation perm_in by key[perm_in[i]] in [0, nkeys). The
+// permutation is split into chunks of equal length. Each chunk counts its keys, a scan
+// over all (key, chunk) pairs yields the output position of every chunk and key, such
+// that the chunks are scattered in parallel while preserving the order of equal keys.
+static void host_counting_sort(rocsparse_int                     nnz,
+                               rocsparse_int                     nkeys,
+                               const std::vector<rocsparse_int>& key,
+                               const std::vector<rocsparse_int>& perm_in,
+                               std::vector<rocsparse_int>&       perm_out)
+{
+#ifdef _OPENMP
+    rocsparse_int nchunks = omp_get_max_threads();
+#else
+    rocsparse_int nchunks = 1;
+#endif
+
+    // Bound the size of the counters by the number of entries
+    nchunks = std::max(1, std::min(nchunks, nnz / std::max(nkeys, 1)));
+
+    rocsparse_int chunk_size = (nnz + nchunks - 1) / nchunks;
+
+    std::vector<rocsparse_int> offset(static_cast<size_t>(nkeys) * nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(rocsparse_int c = 0; c < nchunks; ++c)
+    {
+        rocsparse_int chunk_end = std::min(chunk_size * (c + 1), nnz);
+
+        for(rocsparse_int i = chunk_size * c; i < chunk_end; ++i)
+        {
+            ++offset[static_cast<size_t>(key[perm_in[i]]) * nchunks + c + 1];
+        }
+    }
+
+    for(size_t i = 0; i < offset.size() - 1; ++i)
+    {
+        offset[i + 1] += offset[i];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(rocsparse_int c = 0; c < nchunks; ++c)
+    {
+        rocsparse_int chunk_end = std::min(chunk_size * (c + 1), nnz);
+
+        for(rocsparse_int i = chunk_size * c; i < chunk_end; ++i)
+        {
+            perm_out[offset[static_cast<size_t>(key[perm_in[i]]) * nchunks + c]++] = perm_in[i];
         }
     }
 }
@@ -3959,12 +5347,25 @@ void host_coosort_by_column(rocsparse_int               M,
 {
     // Permutation vector
     std::vector<rocsparse_int> perm(nnz);
+    std::vector<rocsparse_int> tmp_perm(nnz);
 
+    rocsparse_int max_row = 0;
+    rocsparse_int max_col = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : max_row, max_col)
+#endif
     for(rocsparse_int i = 0; i < nnz; ++i)
     {
         perm[i] = i;
+        max_row = std::max(max_row, coo_row_ind[i]);
+        max_col = std::max(max_col, coo_col_ind[i]);
     }
 
+    // Sort by row, then stable by column
+    host_counting_sort(nnz, max_row + 1, coo_row_ind, perm, tmp_perm);
+    host_counting_sort(nnz, max_col + 1, coo_col_ind, tmp_perm, perm);
+
     std::vector<rocsparse_int> tmp_row(nnz);
     std::vector<rocsparse_int> tmp_col(nnz);
     std::vector<T>             tmp_val(nnz);
@@ -3973,28 +5374,147 @@ void host_coosort_by_column(rocsparse_int               M,
     tmp_col = coo_col_ind;
     tmp_val = coo_val;
 
-    // Sort
-    std::sort(perm.begin(), perm.end(), [&](const rocsparse_int& a, const rocsparse_int& b) {
-        if(tmp_col[a] < tmp_col[b])
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        coo_row_ind[i] = tmp_row[perm[i]];
+        coo_col_ind[i] = tmp_col[perm[i]];
+        coo_val[i]     = tmp_val[perm[i]];
+    }
+}
+
+// Violations are combined by their maximum rank, such that the status that is listed
+// first in rocsparse_data_status has the highest rank
+static int host_check_matrix_rank(rocsparse_data_status status)
+{
+    return (status == rocsparse_data_status_success)
+               ? 0
+               : rocsparse_data_status_missing_diagonal + 1 - status;
+}
+
+static rocsparse_data_status host_check_matrix_status(
+    int rank, rocsparse_int diag, rocsparse_int M, rocsparse_int N, bool check_diag)
+{
+    if(rank > 0)
+    {
+        return static_cast<rocsparse_data_status>(rocsparse_data_status_missing_diagonal + 1
+                                                  - rank);
+    }
+
+    return (check_diag && diag < std::min(M, N)) ? rocsparse_data_status_missing_diagonal
+                                                  : rocsparse_data_status_success;
+}
+
+rocsparse_data_status host_csr_check(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     rocsparse_index_base              base,
+                                     bool                              check_diag)
+{
+    int           rank = 0;
+    rocsparse_int diag = 0;
+
+    if(csr_row_ptr[0] != base || csr_row_ptr[M] != nnz + base)
+    {
+        rank = host_check_matrix_rank(rocsparse_data_status_invalid_offset_ptr);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : rank) reduction(+ : diag)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        if(row_begin > row_end)
         {
-            return true;
+            rank = std::max(rank, host_check_matrix_rank(rocsparse_data_status_invalid_offset_ptr));
+            continue;
         }
-        else if(tmp_col[a] == tmp_col[b])
+
+        // Rows out of bounds imply invalid offsets of another row
+        if(row_begin < 0 || row_end > nnz)
         {
-            return (tmp_row[a] < tmp_row[b]);
+            continue;
         }
-        else
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
         {
-            return false;
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            rocsparse_data_status status = rocsparse_data_status_success;
+
+            if(col < 0 || col >= N)
+            {
+                status = rocsparse_data_status_invalid_index;
+            }
+            else if(j > row_begin && col < csr_col_ind[j - 1] - base)
+            {
+                status = rocsparse_data_status_invalid_sorting;
+            }
+            else if(j > row_begin && col == csr_col_ind[j - 1] - base)
+            {
+                status = rocsparse_data_status_duplicate_entry;
+            }
+
+            rank = std::max(rank, host_check_matrix_rank(status));
+            diag += (col == i);
         }
-    });
+    }
+
+    return host_check_matrix_status(rank, diag, M, N, check_diag);
+}
+
+rocsparse_data_status host_coo_check(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& coo_row_ind,
+                                     const std::vector<rocsparse_int>& coo_col_ind,
+                                     rocsparse_index_base              base,
+                                     bool                              check_diag)
+{
+    int           rank = 0;
+    rocsparse_int diag = 0;
 
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : rank) reduction(+ : diag)
+#endif
     for(rocsparse_int i = 0; i < nnz; ++i)
     {
-        coo_row_ind[i] = tmp_row[perm[i]];
-        coo_col_ind[i] = tmp_col[perm[i]];
-        coo_val[i]     = tmp_val[perm[i]];
+        rocsparse_int row = coo_row_ind[i] - base;
+        rocsparse_int col = coo_col_ind[i] - base;
+
+        rocsparse_data_status status = rocsparse_data_status_success;
+
+        if(row < 0 || row >= M || col < 0 || col >= N)
+        {
+            status = rocsparse_data_status_invalid_index;
+        }
+        else if(i > 0)
+        {
+            rocsparse_int prev_row = coo_row_ind[i - 1] - base;
+            rocsparse_int prev_col = coo_col_ind[i - 1] - base;
+
+            if(row < prev_row || (row == prev_row && col < prev_col))
+            {
+                status = rocsparse_data_status_invalid_sorting;
+            }
+            else if(row == prev_row && col == prev_col)
+            {
+                status = rocsparse_data_status_duplicate_entry;
+            }
+        }
+
+        rank = std::max(rank, host_check_matrix_rank(status));
+        diag += (row == col);
     }
+
+    return host_check_matrix_status(rank, diag, M, N, check_diag);
 }
 
 // INSTANTIATE
@@ -4041,6 +5561,26 @@ template void host_sctr(rocsparse_int        nnz,
                         float*               y,
                         rocsparse_index_base base);
 
+template void host_spdot(rocsparse_int        nnz_x,
+                         const float*         x_val,
+                         const rocsparse_int* x_ind,
+                         rocsparse_int        nnz_y,
+                         const float*         y_val,
+                         const rocsparse_int* y_ind,
+                         float*               result,
+                         rocsparse_index_base base);
+
+template void host_spaxpy(rocsparse_int               nnz_x,
+                          float                       alpha,
+                          const float*                x_val,
+                          const rocsparse_int*        x_ind,
+                          rocsparse_int               nnz_y,
+                          const float*                y_val,
+                          const rocsparse_int*        y_ind,
+                          std::vector<float>&         z_val,
+                          std::vector<rocsparse_int>& z_ind,
+                          rocsparse_index_base        base);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -4078,6 +5618,27 @@ template void host_bsrsv(rocsparse_operation               trans,
                          rocsparse_int*                    struct_pivot,
                          rocsparse_int*                    numeric_pivot);
 
+template void host_bsrsm(rocsparse_int                     mb,
+                         rocsparse_int                     nrhs,
+                         rocsparse_int                     nnzb,
+                         rocsparse_direction               dir,
+                         rocsparse_operation               transA,
+                         rocsparse_operation               transX,
+                         float                             alpha,
+                         const std::vector<rocsparse_int>& bsr_row_ptr,
+                         const std::vector<rocsparse_int>& bsr_col_ind,
+                         const std::vector<float>&         bsr_val,
+                         rocsparse_int                     bsr_dim,
+                         const std::vector<float>&         B,
+                         rocsparse_int                     ldb,
+                         std::vector<float>&               X,
+                         rocsparse_int                     ldx,
+                         rocsparse_diag_type               diag_type,
+                         rocsparse_fill_mode               fill_mode,
+                         rocsparse_index_base              base,
+                         rocsparse_int*                    struct_pivot,
+                         rocsparse_int*                    numeric_pivot);
+
 template void host_coomv(rocsparse_int        M,
                          rocsparse_int        nnz,
                          float                alpha,
@@ -4089,7 +5650,9 @@ template void host_coomv(rocsparse_int        M,
                          float*               y,
                          rocsparse_index_base base);
 
-template void host_csrmv(rocsparse_int        M,
+template void host_csrmv(rocsparse_operation  trans,
+                         rocsparse_int        M,
+                         rocsparse_int        N,
                          rocsparse_int        nnz,
                          float                alpha,
                          const rocsparse_int* csr_row_ptr,
@@ -4101,6 +5664,21 @@ template void host_csrmv(rocsparse_int        M,
                          rocsparse_index_base base,
                          int                  algo);
 
+template void host_csrmspv(rocsparse_operation  trans,
+                           rocsparse_int        M,
+                           rocsparse_int        N,
+                           rocsparse_int        nnz,
+                           float                alpha,
+                           const rocsparse_int* csr_row_ptr,
+                           const rocsparse_int* csr_col_ind,
+                           const float*         csr_val,
+                           rocsparse_int        nnz_x,
+                           const float*         x_val,
+                           const rocsparse_int* x_ind,
+                           float                beta,
+                           float*               y,
+                           rocsparse_index_base base);
+
 template void host_csrsv(rocsparse_operation               trans,
                          rocsparse_int                     M,
                          rocsparse_int                     nnz,
@@ -4128,6 +5706,19 @@ template void host_ellmv(rocsparse_int        M,
                          float*               y,
                          rocsparse_index_base base);
 
+template void host_sellcmv(rocsparse_int        M,
+                           rocsparse_int        N,
+                           float                alpha,
+                           const rocsparse_int* sell_slice_ptr,
+                           const rocsparse_int* sell_col_ind,
+                           const float*         sell_val,
+                           const rocsparse_int* sell_perm,
+                           rocsparse_int        sell_slice_size,
+                           const float*         x,
+                           float                beta,
+                           float*               y,
+                           rocsparse_index_base base);
+
 template void host_hybmv(rocsparse_int        M,
                          rocsparse_int        N,
                          float                alpha,
@@ -4211,6 +5802,21 @@ template void host_gemmi(rocsparse_int        M,
                          float*               C,
                          rocsparse_int        ldc,
                          rocsparse_index_base base);
+template void host_csrsddmm(rocsparse_int                     M,
+                            rocsparse_int                     N,
+                            rocsparse_int                     K,
+                            rocsparse_operation               transA,
+                            rocsparse_operation               transB,
+                            float                             alpha,
+                            const std::vector<float>&         A,
+                            rocsparse_int                     lda,
+                            const std::vector<float>&         B,
+                            rocsparse_int                     ldb,
+                            float                             beta,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<float>&               csr_val,
+                            rocsparse_index_base              base);
 
 /*
  * ===========================================================================
@@ -4288,6 +5894,46 @@ template void host_csrgemm(rocsparse_int                     M,
                            rocsparse_index_base              base_C,
                            rocsparse_index_base              base_D);
 
+template void host_csrgemm_symbolic(rocsparse_int                     M,
+                                    rocsparse_int                     N,
+                                    rocsparse_int                     K,
+                                    const float*                      alpha,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                    const std::vector<rocsparse_int>& csr_col_ind_A,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                    const std::vector<rocsparse_int>& csr_col_ind_B,
+                                    const float*                      beta,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                    const std::vector<rocsparse_int>& csr_col_ind_D,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                    std::vector<rocsparse_int>&       csr_col_ind_C,
+                                    rocsparse_index_base              base_A,
+                                    rocsparse_index_base              base_B,
+                                    rocsparse_index_base              base_C,
+                                    rocsparse_index_base              base_D);
+
+template void host_csrgemm_numeric(rocsparse_int                     M,
+                                   rocsparse_int                     N,
+                                   rocsparse_int                     K,
+                                   const float*                      alpha,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                   const std::vector<rocsparse_int>& csr_col_ind_A,
+                                   const std::vector<float>&         csr_val_A,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                   const std::vector<rocsparse_int>& csr_col_ind_B,
+                                   const std::vector<float>&         csr_val_B,
+                                   const float*                      beta,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                   const std::vector<rocsparse_int>& csr_col_ind_D,
+                                   const std::vector<float>&         csr_val_D,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                   const std::vector<rocsparse_int>& csr_col_ind_C,
+                                   std::vector<float>&               csr_val_C,
+                                   rocsparse_index_base              base_A,
+                                   rocsparse_index_base              base_B,
+                                   rocsparse_index_base              base_C,
+                                   rocsparse_index_base              base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -4424,6 +6070,19 @@ template void host_csr_to_csc(rocsparse_int                     M,
                               rocsparse_action                  action,
                               rocsparse_index_base              base);
 
+template void host_csr_to_general(rocsparse_operation               trans,
+                                  rocsparse_matrix_type             type,
+                                  rocsparse_fill_mode               uplo,
+                                  rocsparse_diag_type               diag,
+                                  rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  const std::vector<float>&         csr_val,
+                                  std::vector<rocsparse_int>&       gen_row_ptr,
+                                  std::vector<rocsparse_int>&       gen_col_ind,
+                                  std::vector<float>&               gen_val,
+                                  rocsparse_index_base              base);
+
 template void host_csr_to_gebsr(rocsparse_direction               direction,
                                 rocsparse_int                     m,
                                 rocsparse_int                     n,
@@ -4508,6 +6167,20 @@ template void host_csr_to_ell(rocsparse_int                     M,
                               rocsparse_index_base              csr_base,
                               rocsparse_index_base              ell_base);
 
+template void host_csr_to_sellc(rocsparse_int                     M,
+                                const std::vector<rocsparse_int>& csr_row_ptr,
+                                const std::vector<rocsparse_int>& csr_col_ind,
+                                const std::vector<float>&         csr_val,
+                                rocsparse_int                     sell_slice_size,
+                                rocsparse_int                     sell_sigma,
+                                std::vector<rocsparse_int>&       sell_slice_ptr,
+                                std::vector<rocsparse_int>&       sell_perm,
+                                std::vector<rocsparse_int>&       sell_col_ind,
+                                std::vector<float>&               sell_val,
+                                rocsparse_int&                    sell_nnz,
+                                rocsparse_index_base              csr_base,
+                                rocsparse_index_base              sell_base);
+
 template void host_csr_to_hyb(rocsparse_int                     M,
                               rocsparse_int                     nnz,
                               const std::vector<rocsparse_int>& csr_row_ptr,
@@ -4575,6 +6248,20 @@ template void host_ell_to_csr(rocsparse_int                     M,
                               rocsparse_index_base              ell_base,
                               rocsparse_index_base              csr_base);
 
+template void host_sellc_to_csr(rocsparse_int                     M,
+                                rocsparse_int                     N,
+                                rocsparse_int                     sell_slice_size,
+                                const std::vector<rocsparse_int>& sell_slice_ptr,
+                                const std::vector<rocsparse_int>& sell_col_ind,
+                                const std::vector<float>&         sell_val,
+                                const std::vector<rocsparse_int>& sell_perm,
+                                std::vector<rocsparse_int>&       csr_row_ptr,
+                                std::vector<rocsparse_int>&       csr_col_ind,
+                                std::vector<float>&               csr_val,
+                                rocsparse_int&                    csr_nnz,
+                                rocsparse_index_base              sell_base,
+                                rocsparse_index_base              csr_base);
+
 template void host_coosort_by_column(rocsparse_int               M,
                                      rocsparse_int               nnz,
                                      std::vector<rocsparse_int>& coo_row_ind,
@@ -4625,6 +6312,26 @@ template void host_sctr(rocsparse_int        nnz,
                         double*              y,
                         rocsparse_index_base base);
 
+template void host_spdot(rocsparse_int        nnz_x,
+                         const double*        x_val,
+                         const rocsparse_int* x_ind,
+                         rocsparse_int        nnz_y,
+                         const double*        y_val,
+                         const rocsparse_int* y_ind,
+                         double*              result,
+                         rocsparse_index_base base);
+
+template void host_spaxpy(rocsparse_int               nnz_x,
+                          double                      alpha,
+                          const double*               x_val,
+                          const rocsparse_int*        x_ind,
+                          rocsparse_int               nnz_y,
+                          const double*               y_val,
+                          const rocsparse_int*        y_ind,
+                          std::vector<double>&        z_val,
+                          std::vector<rocsparse_int>& z_ind,
+                          rocsparse_index_base        base);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -4662,6 +6369,27 @@ template void host_bsrsv(rocsparse_operation               trans,
                          rocsparse_int*                    struct_pivot,
                          rocsparse_int*                    numeric_pivot);
 
+template void host_bsrsm(rocsparse_int                     mb,
+                         rocsparse_int                     nrhs,
+                         rocsparse_int                     nnzb,
+                         rocsparse_direction               dir,
+                         rocsparse_operation               transA,
+                         rocsparse_operation               transX,
+                         double                            alpha,
+                         const std::vector<rocsparse_int>& bsr_row_ptr,
+                         const std::vector<rocsparse_int>& bsr_col_ind,
+                         const std::vector<double>&        bsr_val,
+                         rocsparse_int                     bsr_dim,
+                         const std::vector<double>&        B,
+                         rocsparse_int                     ldb,
+                         std::vector<double>&              X,
+                         rocsparse_int                     ldx,
+                         rocsparse_diag_type               diag_type,
+                         rocsparse_fill_mode               fill_mode,
+                         rocsparse_index_base              base,
+                         rocsparse_int*                    struct_pivot,
+                         rocsparse_int*                    numeric_pivot);
+
 template void host_coomv(rocsparse_int        M,
                          rocsparse_int        nnz,
                          double               alpha,
@@ -4673,7 +6401,9 @@ template void host_coomv(rocsparse_int        M,
                          double*              y,
                          rocsparse_index_base base);
 
-template void host_csrmv(rocsparse_int        M,
+template void host_csrmv(rocsparse_operation  trans,
+                         rocsparse_int        M,
+                         rocsparse_int        N,
                          rocsparse_int        nnz,
                          double               alpha,
                          const rocsparse_int* csr_row_ptr,
@@ -4685,6 +6415,21 @@ template void host_csrmv(rocsparse_int        M,
                          rocsparse_index_base base,
                          int                  algo);
 
+template void host_csrmspv(rocsparse_operation  trans,
+                           rocsparse_int        M,
+                           rocsparse_int        N,
+                           rocsparse_int        nnz,
+                           double               alpha,
+                           const rocsparse_int* csr_row_ptr,
+                           const rocsparse_int* csr_col_ind,
+                           const double*        csr_val,
+                           rocsparse_int        nnz_x,
+                           const double*        x_val,
+                           const rocsparse_int* x_ind,
+                           double               beta,
+                           double*              y,
+                           rocsparse_index_base base);
+
 template void host_csrsv(rocsparse_operation               trans,
                          rocsparse_int                     M,
                          rocsparse_int                     nnz,
@@ -4712,6 +6457,19 @@ template void host_ellmv(rocsparse_int        M,
                          double*              y,
                          rocsparse_index_base base);
 
+template void host_sellcmv(rocsparse_int        M,
+                           rocsparse_int        N,
+                           double               alpha,
+                           const rocsparse_int* sell_slice_ptr,
+                           const rocsparse_int* sell_col_ind,
+                           const double*        sell_val,
+                           const rocsparse_int* sell_perm,
+                           rocsparse_int        sell_slice_size,
+                           const double*        x,
+                           double               beta,
+                           double*              y,
+                           rocsparse_index_base base);
+
 template void host_hybmv(rocsparse_int        M,
                          rocsparse_int        N,
                          double               alpha,
@@ -4795,6 +6553,21 @@ template void host_gemmi(rocsparse_int        M,
                          double*              C,
                          rocsparse_int        ldc,
                          rocsparse_index_base base);
+template void host_csrsddmm(rocsparse_int                     M,
+                            rocsparse_int                     N,
+                            rocsparse_int                     K,
+                            rocsparse_operation               transA,
+                            rocsparse_operation               transB,
+                            double                            alpha,
+                            const std::vector<double>&        A,
+                            rocsparse_int                     lda,
+                            const std::vector<double>&        B,
+                            rocsparse_int                     ldb,
+                            double                            beta,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<double>&              csr_val,
+                            rocsparse_index_base              base);
 
 /*
  * ===========================================================================
@@ -4872,6 +6645,46 @@ template void host_csrgemm(rocsparse_int                     M,
                            rocsparse_index_base              base_C,
                            rocsparse_index_base              base_D);
 
+template void host_csrgemm_symbolic(rocsparse_int                     M,
+                                    rocsparse_int                     N,
+                                    rocsparse_int                     K,
+                                    const double*                     alpha,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                    const std::vector<rocsparse_int>& csr_col_ind_A,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                    const std::vector<rocsparse_int>& csr_col_ind_B,
+                                    const double*                     beta,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                    const std::vector<rocsparse_int>& csr_col_ind_D,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                    std::vector<rocsparse_int>&       csr_col_ind_C,
+                                    rocsparse_index_base              base_A,
+                                    rocsparse_index_base              base_B,
+                                    rocsparse_index_base              base_C,
+                                    rocsparse_index_base              base_D);
+
+template void host_csrgemm_numeric(rocsparse_int                     M,
+                                   rocsparse_int                     N,
+                                   rocsparse_int                     K,
+                                   const double*                     alpha,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                   const std::vector<rocsparse_int>& csr_col_ind_A,
+                                   const std::vector<double>&        csr_val_A,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                   const std::vector<rocsparse_int>& csr_col_ind_B,
+                                   const std::vector<double>&        csr_val_B,
+                                   const double*                     beta,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                   const std::vector<rocsparse_int>& csr_col_ind_D,
+                                   const std::vector<double>&        csr_val_D,
+                                   const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                   const std::vector<rocsparse_int>& csr_col_ind_C,
+                                   std::vector<double>&              csr_val_C,
+                                   rocsparse_index_base              base_A,
+                                   rocsparse_index_base              base_B,
+                                   rocsparse_index_base              base_C,
+                                   rocsparse_index_base              base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -5008,6 +6821,19 @@ template void host_csr_to_csc(rocsparse_int                     M,
                               rocsparse_action                  action,
                               rocsparse_index_base              base);
 
+template void host_csr_to_general(rocsparse_operation               trans,
+                                  rocsparse_matrix_type             type,
+                                  rocsparse_fill_mode               uplo,
+                                  rocsparse_diag_type               diag,
+                                  rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  const std::vector<double>&        csr_val,
+                                  std::vector<rocsparse_int>&       gen_row_ptr,
+                                  std::vector<rocsparse_int>&       gen_col_ind,
+                                  std::vector<double>&              gen_val,
+                                  rocsparse_index_base              base);
+
 template void host_csr_to_gebsr(rocsparse_direction               direction,
                                 rocsparse_int                     m,
                                 rocsparse_int                     n,
@@ -5092,6 +6918,20 @@ template void host_csr_to_ell(rocsparse_int                     M,
                               rocsparse_index_base              csr_base,
                               rocsparse_index_base              ell_base);
 
+template void host_csr_to_sellc(rocsparse_int                     M,
+                                const std::vector<rocsparse_int>& csr_row_ptr,
+                                const std::vector<rocsparse_int>& csr_col_ind,
+                                const std::vector<double>&        csr_val,
+                                rocsparse_int                     sell_slice_size,
+                                rocsparse_int                     sell_sigma,
+                                std::vector<rocsparse_int>&       sell_slice_ptr,
+                                std::vector<rocsparse_int>&       sell_perm,
+                                std::vector<rocsparse_int>&       sell_col_ind,
+                                std::vector<double>&              sell_val,
+                                rocsparse_int&                    sell_nnz,
+                                rocsparse_index_base              csr_base,
+                                rocsparse_index_base              sell_base);
+
 template void host_csr_to_hyb(rocsparse_int                     M,
                               rocsparse_int                     nnz,
                               const std::vector<rocsparse_int>& csr_row_ptr,
@@ -5159,6 +6999,20 @@ template void host_ell_to_csr(rocsparse_int                     M,
                               rocsparse_index_base              ell_base,
                               rocsparse_index_base              csr_base);
 
+template void host_sellc_to_csr(rocsparse_int                     M,
+                                rocsparse_int                     N,
+                                rocsparse_int                     sell_slice_size,
+                                const std::vector<rocsparse_int>& sell_slice_ptr,
+                                const std::vector<rocsparse_int>& sell_col_ind,
+                                const std::vector<double>&        sell_val,
+                                const std::vector<rocsparse_int>& sell_perm,
+                                std::vector<rocsparse_int>&       csr_row_ptr,
+                                std::vector<rocsparse_int>&       csr_col_ind,
+                                std::vector<double>&              csr_val,
+                                rocsparse_int&                    csr_nnz,
+                                rocsparse_index_base              sell_base,
+                                rocsparse_index_base              csr_base);
+
 template void host_coosort_by_column(rocsparse_int               M,
                                      rocsparse_int               nnz,
                                      std::vector<rocsparse_int>& coo_row_ind,
@@ -5215,6 +7069,26 @@ template void host_sctr(rocsparse_int                   nnz,
                         rocsparse_double_complex*       y,
                         rocsparse_index_base            base);
 
+template void host_spdot(rocsparse_int                   nnz_x,
+                         const rocsparse_double_complex* x_val,
+                         const rocsparse_int*            x_ind,
+                         rocsparse_int                   nnz_y,
+                         const rocsparse_double_complex* y_val,
+                         const rocsparse_int*            y_ind,
+                         rocsparse_double_complex*       result,
+                         rocsparse_index_base            base);
+
+template void host_spaxpy(rocsparse_int                          nnz_x,
+                          rocsparse_double_complex               alpha,
+                          const rocsparse_double_complex*        x_val,
+                          const rocsparse_int*                   x_ind,
+                          rocsparse_int                          nnz_y,
+                          const rocsparse_double_complex*        y_val,
+                          const rocsparse_int*                   y_ind,
+                          std::vector<rocsparse_double_complex>& z_val,
+                          std::vector<rocsparse_int>&            z_ind,
+                          rocsparse_index_base                   base);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -5252,6 +7126,27 @@ template void host_bsrsv(rocsparse_operation                          trans,
                          rocsparse_int*                               struct_pivot,
                          rocsparse_int*                               numeric_pivot);
 
+template void host_bsrsm(rocsparse_int                               mb,
+                         rocsparse_int                               nrhs,
+                         rocsparse_int                               nnzb,
+                         rocsparse_direction                         dir,
+                         rocsparse_operation                         transA,
+                         rocsparse_operation                         transX,
+                         rocsparse_float_complex                     alpha,
+                         const std::vector<rocsparse_int>&           bsr_row_ptr,
+                         const std::vector<rocsparse_int>&           bsr_col_ind,
+                         const std::vector<rocsparse_float_complex>& bsr_val,
+                         rocsparse_int                               bsr_dim,
+                         const std::vector<rocsparse_float_complex>& B,
+                         rocsparse_int                               ldb,
+                         std::vector<rocsparse_float_complex>&       X,
+                         rocsparse_int                               ldx,
+                         rocsparse_diag_type                         diag_type,
+                         rocsparse_fill_mode                         fill_mode,
+                         rocsparse_index_base                        base,
+                         rocsparse_int*                              struct_pivot,
+                         rocsparse_int*                              numeric_pivot);
+
 template void host_coomv(rocsparse_int                   M,
                          rocsparse_int                   nnz,
                          rocsparse_double_complex        alpha,
@@ -5263,7 +7158,9 @@ template void host_coomv(rocsparse_int                   M,
                          rocsparse_double_complex*       y,
                          rocsparse_index_base            base);
 
-template void host_csrmv(rocsparse_int                   M,
+template void host_csrmv(rocsparse_operation             trans,
+                         rocsparse_int                   M,
+                         rocsparse_int                   N,
                          rocsparse_int                   nnz,
                          rocsparse_double_complex        alpha,
                          const rocsparse_int*            csr_row_ptr,
@@ -5275,6 +7172,21 @@ template void host_csrmv(rocsparse_int                   M,
                          rocsparse_index_base            base,
                          int                             algo);
 
+template void host_csrmspv(rocsparse_operation             trans,
+                           rocsparse_int                   M,
+                           rocsparse_int                   N,
+                           rocsparse_int                   nnz,
+                           rocsparse_double_complex        alpha,
+                           const rocsparse_int*            csr_row_ptr,
+                           const rocsparse_int*            csr_col_ind,
+                           const rocsparse_double_complex* csr_val,
+                           rocsparse_int                   nnz_x,
+                           const rocsparse_double_complex* x_val,
+                           const rocsparse_int*            x_ind,
+                           rocsparse_double_complex        beta,
+                           rocsparse_double_complex*       y,
+                           rocsparse_index_base            base);
+
 template void host_csrsv(rocsparse_operation                          trans,
                          rocsparse_int                                M,
                          rocsparse_int                                nnz,
@@ -5302,6 +7214,19 @@ template void host_ellmv(rocsparse_int                   M,
                          rocsparse_double_complex*       y,
                          rocsparse_index_base            base);
 
+template void host_sellcmv(rocsparse_int                   M,
+                           rocsparse_int                   N,
+                           rocsparse_double_complex        alpha,
+                           const rocsparse_int*            sell_slice_ptr,
+                           const rocsparse_int*            sell_col_ind,
+                           const rocsparse_double_complex* sell_val,
+                           const rocsparse_int*            sell_perm,
+                           rocsparse_int                   sell_slice_size,
+                           const rocsparse_double_complex* x,
+                           rocsparse_double_complex        beta,
+                           rocsparse_double_complex*       y,
+                           rocsparse_index_base            base);
+
 template void host_hybmv(rocsparse_int                   M,
                          rocsparse_int                   N,
                          rocsparse_double_complex        alpha,
@@ -5385,6 +7310,21 @@ template void host_gemmi(rocsparse_int                   M,
                          rocsparse_double_complex*       C,
                          rocsparse_int                   ldc,
                          rocsparse_index_base            base);
+template void host_csrsddmm(rocsparse_int                               M,
+                            rocsparse_int                               N,
+                            rocsparse_int                               K,
+                            rocsparse_operation                         transA,
+                            rocsparse_operation                         transB,
+                            rocsparse_float_complex                     alpha,
+                            const std::vector<rocsparse_float_complex>& A,
+                            rocsparse_int                               lda,
+                            const std::vector<rocsparse_float_complex>& B,
+                            rocsparse_int                               ldb,
+                            rocsparse_float_complex                     beta,
+                            const std::vector<rocsparse_int>&           csr_row_ptr,
+                            const std::vector<rocsparse_int>&           csr_col_ind,
+                            std::vector<rocsparse_float_complex>&       csr_val,
+                            rocsparse_index_base                        base);
 
 /*
  * ===========================================================================
@@ -5462,6 +7402,46 @@ template void host_csrgemm(rocsparse_int                                M,
                            rocsparse_index_base                         base_C,
                            rocsparse_index_base                         base_D);
 
+template void host_csrgemm_symbolic(rocsparse_int                     M,
+                                    rocsparse_int                     N,
+                                    rocsparse_int                     K,
+                                    const rocsparse_double_complex*   alpha,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                    const std::vector<rocsparse_int>& csr_col_ind_A,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                    const std::vector<rocsparse_int>& csr_col_ind_B,
+                                    const rocsparse_double_complex*   beta,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                    const std::vector<rocsparse_int>& csr_col_ind_D,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                    std::vector<rocsparse_int>&       csr_col_ind_C,
+                                    rocsparse_index_base              base_A,
+                                    rocsparse_index_base              base_B,
+                                    rocsparse_index_base              base_C,
+                                    rocsparse_index_base              base_D);
+
+template void host_csrgemm_numeric(rocsparse_int                                M,
+                                   rocsparse_int                                N,
+                                   rocsparse_int                                K,
+                                   const rocsparse_double_complex*              alpha,
+                                   const std::vector<rocsparse_int>&            csr_row_ptr_A,
+                                   const std::vector<rocsparse_int>&            csr_col_ind_A,
+                                   const std::vector<rocsparse_double_complex>& csr_val_A,
+                                   const std::vector<rocsparse_int>&            csr_row_ptr_B,
+                                   const std::vector<rocsparse_int>&            csr_col_ind_B,
+                                   const std::vector<rocsparse_double_complex>& csr_val_B,
+                                   const rocsparse_double_complex*              beta,
+                                   const std::vector<rocsparse_int>&            csr_row_ptr_D,
+                                   const std::vector<rocsparse_int>&            csr_col_ind_D,
+                                   const std::vector<rocsparse_double_complex>& csr_val_D,
+                                   const std::vector<rocsparse_int>&            csr_row_ptr_C,
+                                   const std::vector<rocsparse_int>&            csr_col_ind_C,
+                                   std::vector<rocsparse_double_complex>&       csr_val_C,
+                                   rocsparse_index_base                         base_A,
+                                   rocsparse_index_base                         base_B,
+                                   rocsparse_index_base                         base_C,
+                                   rocsparse_index_base                         base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -5576,6 +7556,19 @@ template void host_csr_to_csc(rocsparse_int                                M,
                               rocsparse_action                             action,
                               rocsparse_index_base                         base);
 
+template void host_csr_to_general(rocsparse_operation                          trans,
+                                  rocsparse_matrix_type                        type,
+                                  rocsparse_fill_mode                          uplo,
+                                  rocsparse_diag_type                          diag,
+                                  rocsparse_int                                M,
+                                  const std::vector<rocsparse_int>&            csr_row_ptr,
+                                  const std::vector<rocsparse_int>&            csr_col_ind,
+                                  const std::vector<rocsparse_double_complex>& csr_val,
+                                  std::vector<rocsparse_int>&                  gen_row_ptr,
+                                  std::vector<rocsparse_int>&                  gen_col_ind,
+                                  std::vector<rocsparse_double_complex>&       gen_val,
+                                  rocsparse_index_base                         base);
+
 template void host_csr_to_gebsr(rocsparse_direction                          direction,
                                 rocsparse_int                                m,
                                 rocsparse_int                                n,
@@ -5660,6 +7653,20 @@ template void host_csr_to_ell(rocsparse_int                                M,
                               rocsparse_index_base                         csr_base,
                               rocsparse_index_base                         ell_base);
 
+template void host_csr_to_sellc(rocsparse_int                                M,
+                                const std::vector<rocsparse_int>&            csr_row_ptr,
+                                const std::vector<rocsparse_int>&            csr_col_ind,
+                                const std::vector<rocsparse_double_complex>& csr_val,
+                                rocsparse_int                                sell_slice_size,
+                                rocsparse_int                                sell_sigma,
+                                std::vector<rocsparse_int>&                  sell_slice_ptr,
+                                std::vector<rocsparse_int>&                  sell_perm,
+                                std::vector<rocsparse_int>&                  sell_col_ind,
+                                std::vector<rocsparse_double_complex>&       sell_val,
+                                rocsparse_int&                               sell_nnz,
+                                rocsparse_index_base                         csr_base,
+                                rocsparse_index_base                         sell_base);
+
 template void host_csr_to_hyb(rocsparse_int                                M,
                               rocsparse_int                                nnz,
                               const std::vector<rocsparse_int>&            csr_row_ptr,
@@ -5700,6 +7707,20 @@ template void host_ell_to_csr(rocsparse_int                                M,
                               rocsparse_index_base                         ell_base,
                               rocsparse_index_base                         csr_base);
 
+template void host_sellc_to_csr(rocsparse_int                                M,
+                                rocsparse_int                                N,
+                                rocsparse_int                                sell_slice_size,
+                                const std::vector<rocsparse_int>&            sell_slice_ptr,
+                                const std::vector<rocsparse_int>&            sell_col_ind,
+                                const std::vector<rocsparse_double_complex>& sell_val,
+                                const std::vector<rocsparse_int>&            sell_perm,
+                                std::vector<rocsparse_int>&                  csr_row_ptr,
+                                std::vector<rocsparse_int>&                  csr_col_ind,
+                                std::vector<rocsparse_double_complex>&       csr_val,
+                                rocsparse_int&                               csr_nnz,
+                                rocsparse_index_base                         sell_base,
+                                rocsparse_index_base                         csr_base);
+
 template void host_coosort_by_column(rocsparse_int                          M,
                                      rocsparse_int                          nnz,
                                      std::vector<rocsparse_int>&            coo_row_ind,
@@ -5756,6 +7777,26 @@ template void host_sctr(rocsparse_int                  nnz,
                         rocsparse_float_complex*       y,
                         rocsparse_index_base           base);
 
+template void host_spdot(rocsparse_int                  nnz_x,
+                         const rocsparse_float_complex* x_val,
+                         const rocsparse_int*           x_ind,
+                         rocsparse_int                  nnz_y,
+                         const rocsparse_float_complex* y_val,
+                         const rocsparse_int*           y_ind,
+                         rocsparse_float_complex*       result,
+                         rocsparse_index_base           base);
+
+template void host_spaxpy(rocsparse_int                         nnz_x,
+                          rocsparse_float_complex               alpha,
+                          const rocsparse_float_complex*        x_val,
+                          const rocsparse_int*                  x_ind,
+                          rocsparse_int                         nnz_y,
+                          const rocsparse_float_complex*        y_val,
+                          const rocsparse_int*                  y_ind,
+                          std::vector<rocsparse_float_complex>& z_val,
+                          std::vector<rocsparse_int>&           z_ind,
+                          rocsparse_index_base                  base);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -5793,6 +7834,27 @@ template void host_bsrsv(rocsparse_operation                         trans,
                          rocsparse_int*                              struct_pivot,
                          rocsparse_int*                              numeric_pivot);
 
+template void host_bsrsm(rocsparse_int                                mb,
+                         rocsparse_int                                nrhs,
+                         rocsparse_int                                nnzb,
+                         rocsparse_direction                          dir,
+                         rocsparse_operation                          transA,
+                         rocsparse_operation                          transX,
+                         rocsparse_double_complex                     alpha,
+                         const std::vector<rocsparse_int>&            bsr_row_ptr,
+                         const std::vector<rocsparse_int>&            bsr_col_ind,
+                         const std::vector<rocsparse_double_complex>& bsr_val,
+                         rocsparse_int                                bsr_dim,
+                         const std::vector<rocsparse_double_complex>& B,
+                         rocsparse_int                                ldb,
+                         std::vector<rocsparse_double_complex>&       X,
+                         rocsparse_int                                ldx,
+                         rocsparse_diag_type                          diag_type,
+                         rocsparse_fill_mode                          fill_mode,
+                         rocsparse_index_base                         base,
+                         rocsparse_int*                               struct_pivot,
+                         rocsparse_int*                               numeric_pivot);
+
 template void host_coomv(rocsparse_int                  M,
                          rocsparse_int                  nnz,
                          rocsparse_float_complex        alpha,
@@ -5804,7 +7866,9 @@ template void host_coomv(rocsparse_int                  M,
                          rocsparse_float_complex*       y,
                          rocsparse_index_base           base);
 
-template void host_csrmv(rocsparse_int                  M,
+template void host_csrmv(rocsparse_operation            trans,
+                         rocsparse_int                  M,
+                         rocsparse_int                  N,
                          rocsparse_int                  nnz,
                          rocsparse_float_complex        alpha,
                          const rocsparse_int*           csr_row_ptr,
@@ -5816,6 +7880,21 @@ template void host_csrmv(rocsparse_int                  M,
                          rocsparse_index_base           base,
                          int                            algo);
 
+template void host_csrmspv(rocsparse_operation            trans,
+                           rocsparse_int                  M,
+                           rocsparse_int                  N,
+                           rocsparse_int                  nnz,
+                           rocsparse_float_complex        alpha,
+                           const rocsparse_int*           csr_row_ptr,
+                           const rocsparse_int*           csr_col_ind,
+                           const rocsparse_float_complex* csr_val,
+                           rocsparse_int                  nnz_x,
+                           const rocsparse_float_complex* x_val,
+                           const rocsparse_int*           x_ind,
+                           rocsparse_float_complex        beta,
+                           rocsparse_float_complex*       y,
+                           rocsparse_index_base           base);
+
 template void host_csrsv(rocsparse_operation                         trans,
                          rocsparse_int                               M,
                          rocsparse_int                               nnz,
@@ -5843,6 +7922,19 @@ template void host_ellmv(rocsparse_int                  M,
                          rocsparse_float_complex*       y,
                          rocsparse_index_base           base);
 
+template void host_sellcmv(rocsparse_int                  M,
+                           rocsparse_int                  N,
+                           rocsparse_float_complex        alpha,
+                           const rocsparse_int*           sell_slice_ptr,
+                           const rocsparse_int*           sell_col_ind,
+                           const rocsparse_float_complex* sell_val,
+                           const rocsparse_int*           sell_perm,
+                           rocsparse_int                  sell_slice_size,
+                           const rocsparse_float_complex* x,
+                           rocsparse_float_complex        beta,
+                           rocsparse_float_complex*       y,
+                           rocsparse_index_base           base);
+
 template void host_hybmv(rocsparse_int                  M,
                          rocsparse_int                  N,
                          rocsparse_float_complex        alpha,
@@ -5926,6 +8018,21 @@ template void host_gemmi(rocsparse_int                  M,
                          rocsparse_float_complex*       C,
                          rocsparse_int                  ldc,
                          rocsparse_index_base           base);
+template void host_csrsddmm(rocsparse_int                                M,
+                            rocsparse_int                                N,
+                            rocsparse_int                                K,
+                            rocsparse_operation                          transA,
+                            rocsparse_operation                          transB,
+                            rocsparse_double_complex                     alpha,
+                            const std::vector<rocsparse_double_complex>& A,
+                            rocsparse_int                                lda,
+                            const std::vector<rocsparse_double_complex>& B,
+                            rocsparse_int                                ldb,
+                            rocsparse_double_complex                     beta,
+                            const std::vector<rocsparse_int>&            csr_row_ptr,
+                            const std::vector<rocsparse_int>&            csr_col_ind,
+                            std::vector<rocsparse_double_complex>&       csr_val,
+                            rocsparse_index_base                         base);
 
 /*
  * ===========================================================================
@@ -6003,6 +8110,46 @@ template void host_csrgemm(rocsparse_int                               M,
                            rocsparse_index_base                        base_C,
                            rocsparse_index_base                        base_D);
 
+template void host_csrgemm_symbolic(rocsparse_int                     M,
+                                    rocsparse_int                     N,
+                                    rocsparse_int                     K,
+                                    const rocsparse_float_complex*    alpha,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                    const std::vector<rocsparse_int>& csr_col_ind_A,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                    const std::vector<rocsparse_int>& csr_col_ind_B,
+                                    const rocsparse_float_complex*    beta,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_D,
+                                    const std::vector<rocsparse_int>& csr_col_ind_D,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_C,
+                                    std::vector<rocsparse_int>&       csr_col_ind_C,
+                                    rocsparse_index_base              base_A,
+                                    rocsparse_index_base              base_B,
+                                    rocsparse_index_base              base_C,
+                                    rocsparse_index_base              base_D);
+
+template void host_csrgemm_numeric(rocsparse_int                               M,
+                                   rocsparse_int                               N,
+                                   rocsparse_int                               K,
+                                   const rocsparse_float_complex*              alpha,
+                                   const std::vector<rocsparse_int>&           csr_row_ptr_A,
+                                   const std::vector<rocsparse_int>&           csr_col_ind_A,
+                                   const std::vector<rocsparse_float_complex>& csr_val_A,
+                                   const std::vector<rocsparse_int>&           csr_row_ptr_B,
+                                   const std::vector<rocsparse_int>&           csr_col_ind_B,
+                                   const std::vector<rocsparse_float_complex>& csr_val_B,
+                                   const rocsparse_float_complex*              beta,
+                                   const std::vector<rocsparse_int>&           csr_row_ptr_D,
+                                   const std::vector<rocsparse_int>&           csr_col_ind_D,
+                                   const std::vector<rocsparse_float_complex>& csr_val_D,
+                                   const std::vector<rocsparse_int>&           csr_row_ptr_C,
+                                   const std::vector<rocsparse_int>&           csr_col_ind_C,
+                                   std::vector<rocsparse_float_complex>&       csr_val_C,
+                                   rocsparse_index_base                        base_A,
+                                   rocsparse_index_base                        base_B,
+                                   rocsparse_index_base                        base_C,
+                                   rocsparse_index_base                        base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -6118,6 +8265,19 @@ template void host_csr_to_csc(rocsparse_int                               M,
                               rocsparse_action                            action,
                               rocsparse_index_base                        base);
 
+template void host_csr_to_general(rocsparse_operation                         trans,
+                                  rocsparse_matrix_type                       type,
+                                  rocsparse_fill_mode                         uplo,
+                                  rocsparse_diag_type                         diag,
+                                  rocsparse_int                               M,
+                                  const std::vector<rocsparse_int>&           csr_row_ptr,
+                                  const std::vector<rocsparse_int>&           csr_col_ind,
+                                  const std::vector<rocsparse_float_complex>& csr_val,
+                                  std::vector<rocsparse_int>&                 gen_row_ptr,
+                                  std::vector<rocsparse_int>&                 gen_col_ind,
+                                  std::vector<rocsparse_float_complex>&       gen_val,
+                                  rocsparse_index_base                        base);
+
 template void host_csr_to_gebsr(rocsparse_direction                         direction,
                                 rocsparse_int                               m,
                                 rocsparse_int                               n,
@@ -6202,6 +8362,20 @@ template void host_csr_to_ell(rocsparse_int                               M,
                               rocsparse_index_base                        csr_base,
                               rocsparse_index_base                        ell_base);
 
+template void host_csr_to_sellc(rocsparse_int                               M,
+                                const std::vector<rocsparse_int>&           csr_row_ptr,
+                                const std::vector<rocsparse_int>&           csr_col_ind,
+                                const std::vector<rocsparse_float_complex>& csr_val,
+                                rocsparse_int                               sell_slice_size,
+                                rocsparse_int                               sell_sigma,
+                                std::vector<rocsparse_int>&                 sell_slice_ptr,
+                                std::vector<rocsparse_int>&                 sell_perm,
+                                std::vector<rocsparse_int>&                 sell_col_ind,
+                                std::vector<rocsparse_float_complex>&       sell_val,
+                                rocsparse_int&                              sell_nnz,
+                                rocsparse_index_base                        csr_base,
+                                rocsparse_index_base                        sell_base);
+
 template void host_csr_to_hyb(rocsparse_int                               M,
                               rocsparse_int                               nnz,
                               const std::vector<rocsparse_int>&           csr_row_ptr,
@@ -6242,6 +8416,20 @@ template void host_ell_to_csr(rocsparse_int                               M,
                               rocsparse_index_base                        ell_base,
                               rocsparse_index_base                        csr_base);
 
+template void host_sellc_to_csr(rocsparse_int                               M,
+                                rocsparse_int                               N,
+                                rocsparse_int                               sell_slice_size,
+                                const std::vector<rocsparse_int>&           sell_slice_ptr,
+                                const std::vector<rocsparse_int>&           sell_col_ind,
+                                const std::vector<rocsparse_float_complex>& sell_val,
+                                const std::vector<rocsparse_int>&           sell_perm,
+                                std::vector<rocsparse_int>&                 csr_row_ptr,
+                                std::vector<rocsparse_int>&                 csr_col_ind,
+                                std::vector<rocsparse_float_complex>&       csr_val,
+                                rocsparse_int&                              csr_nnz,
+                                rocsparse_index_base                        sell_base,
+                                rocsparse_index_base                        csr_base);
+
 template void host_coosort_by_column(rocsparse_int                         M,
                                      rocsparse_int                         nnz,
                                      std::vector<rocsparse_int>&           coo_row_ind,
@@ -23,6 +23,20 @@
  * ************************************************************************ */
 #include "rocsparse_init.hpp"
 
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 void host_coo_to_csr(rocsparse_int                     M,
                      rocsparse_int                     nnz,
                      const std::vector<rocsparse_int>& coo_row_ind,
@@ -125,362 +139,1340 @@ void rocsparse_init_alternating_sign(
 }
 
 /* ==================================================================================== */
-/*! \brief  Initialize an array with random data, with NaN where appropriate */
-
+/*! \brief  Initialize an array with random data, with NaN where appropriate */
+
+template <typename T>
+void rocsparse_init_nan(T* A, size_t N)
+{
+    for(size_t i = 0; i < N; ++i)
+        A[i] = T(rocsparse_nan_rng());
+}
+
+template void rocsparse_init_nan<int>(int* A, size_t N);
+template void rocsparse_init_nan<char>(char* A, size_t N);
+template void rocsparse_init_nan<size_t>(size_t* A, size_t N);
+
+template <typename T>
+void rocsparse_init_nan(
+    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
+{
+    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
+        for(size_t i = 0; i < M; ++i)
+            for(size_t j = 0; j < N; ++j)
+                A[i + j * lda + i_batch * stride] = T(rocsparse_nan_rng());
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a random sparse matrix in COO format */
+template <typename T>
+void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
+                               std::vector<rocsparse_int>& col_ind,
+                               std::vector<T>&             val,
+                               size_t                      M,
+                               size_t                      N,
+                               size_t                      nnz,
+                               rocsparse_index_base        base,
+                               bool                        full_rank)
+{
+    // If M > N, full rank is not possible
+    if(full_rank && M > N)
+    {
+        std::cerr << "ERROR: M > N, cannot generate matrix with full rank" << std::endl;
+        full_rank = false;
+    }
+
+    // If nnz < M, full rank is not possible
+    if(full_rank && nnz < M)
+    {
+        std::cerr << "ERROR: nnz < M, cannot generate matrix with full rank" << std::endl;
+        full_rank = false;
+    }
+
+    if(row_ind.size() != nnz)
+    {
+        row_ind.resize(nnz);
+    }
+    if(col_ind.size() != nnz)
+    {
+        col_ind.resize(nnz);
+    }
+    if(val.size() != nnz)
+    {
+        val.resize(nnz);
+    }
+
+    // Key of the counter-based generator. Row indices are sampled in chunks of fixed
+    // size and each row samples its column indices and values from its own stream, such
+    // that the matrix is identical for any number of threads.
+    uint64_t key = (static_cast<uint64_t>(rocsparse_rng()) << 32) | rocsparse_rng();
+
+    // Number of entries per row
+    std::vector<size_t> row_ptr(M + 1, 0);
+
+    // Add diagonal entry, if full rank is flagged
+    int64_t offset = 0;
+
+    if(full_rank)
+    {
+        for(size_t i = 0; i < M; ++i)
+        {
+            row_ptr[i + 1] = 1;
+        }
+
+        offset = M;
+    }
+
+    // Uniform distributed row indices
+    static constexpr int64_t chunk_size = 4096;
+
+    int64_t nchunks = (static_cast<int64_t>(nnz) - offset + chunk_size - 1) / chunk_size;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t c = 0; c < nchunks; ++c)
+    {
+        rocsparse_philox_rng rng(~key, c);
+
+        int64_t begin = offset + c * chunk_size;
+        int64_t end   = std::min(begin + chunk_size, static_cast<int64_t>(nnz));
+
+        for(int64_t i = begin; i < end; ++i)
+        {
+            int64_t row = rng.uniform_int(0, M - 1);
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++row_ptr[row + 1];
+        }
+    }
+
+    for(size_t i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    // Sample column indices and values
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Disjunct check array
+        std::vector<bool> check(N, false);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(int64_t row = 0; row < static_cast<int64_t>(M); ++row)
+        {
+            rocsparse_philox_rng rng(key, row);
+
+            size_t begin = row_ptr[row];
+            size_t end   = row_ptr[row + 1];
+
+            // Sample disjunct column indices
+            size_t idx = begin;
+
+            if(full_rank)
+            {
+                check[row]     = true;
+                col_ind[idx++] = row;
+            }
+
+            while(idx < end)
+            {
+                // Normal distribution around the diagonal
+                rocsparse_int col = (end - begin) * rng.normal();
+
+                if(M <= N)
+                {
+                    col += row;
+                }
+
+                // Repeat if running out of bounds
+                if(col < 0 || col > static_cast<rocsparse_int>(N) - 1)
+                {
+                    continue;
+                }
+
+                // Check for disjunct column index in current row
+                if(!check[col])
+                {
+                    check[col]     = true;
+                    col_ind[idx++] = col;
+                }
+            }
+
+            // Reset disjunct check array
+            for(size_t j = begin; j < end; ++j)
+            {
+                check[col_ind[j]] = false;
+            }
+
+            // Partially sort column indices
+            std::sort(col_ind.begin() + begin, col_ind.begin() + end);
+
+            for(size_t j = begin; j < end; ++j)
+            {
+                // Correct index base accordingly
+                row_ind[j] = row + base;
+                col_ind[j] += base;
+
+                // Sample values
+                val[j] = random_generator<T>(rng);
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Offsets of a 2D or 3D finite difference stencil */
+// Stencils are selected by their number of points and consist of all offsets (sx, sy, sz)
+// with |s|_inf <= radius and |s|_1 <= norm1 that have at most maxdim non-zero components.
+// E.g. the 2D 13 point stencil is the diamond |sx| + |sy| <= 2, while the 3D 13 point
+// stencil extends two points along each axis. Offsets are sorted by (sz, sy, sx), such
+// that the column indices of each row are sorted.
+static std::vector<std::array<int, 3>> rocsparse_init_stencil(int dim, rocsparse_int points)
+{
+    // Number of points, radius, maximum number of non-zero components and maximum L1 norm
+    static const int stencils_2d[][4]
+        = {{5, 1, 1, 1}, {9, 1, 2, 2}, {13, 2, 2, 2}, {25, 2, 2, 4}};
+    static const int stencils_3d[][4]
+        = {{7, 1, 1, 1}, {13, 2, 1, 2}, {19, 1, 2, 2}, {27, 1, 3, 3}, {125, 2, 3, 6}};
+
+    const int(*stencils)[4] = (dim == 2) ? stencils_2d : stencils_3d;
+    int nstencils = (dim == 2) ? sizeof(stencils_2d) / sizeof(stencils_2d[0])
+                               : sizeof(stencils_3d) / sizeof(stencils_3d[0]);
+
+    // Default stencils
+    if(points == 0)
+    {
+        points = (dim == 2) ? 9 : 27;
+    }
+
+    int k = 0;
+    while(k < nstencils && stencils[k][0] != points)
+    {
+        ++k;
+    }
+
+    if(k == nstencils)
+    {
+        std::cerr << "ERROR: unsupported " << dim << "D stencil with " << points
+                  << " points, falling back to " << ((dim == 2) ? 9 : 27) << " points"
+                  << std::endl;
+
+        k = (dim == 2) ? 1 : 3;
+    }
+
+    int radius = stencils[k][1];
+    int maxdim = stencils[k][2];
+    int norm1  = stencils[k][3];
+    int rz     = (dim == 2) ? 0 : radius;
+
+    std::vector<std::array<int, 3>> offsets;
+
+    for(int sz = -rz; sz <= rz; ++sz)
+    {
+        for(int sy = -radius; sy <= radius; ++sy)
+        {
+            for(int sx = -radius; sx <= radius; ++sx)
+            {
+                if((sx != 0) + (sy != 0) + (sz != 0) <= maxdim
+                   && std::abs(sx) + std::abs(sy) + std::abs(sz) <= norm1)
+                {
+                    offsets.push_back({sx, sy, sz});
+                }
+            }
+        }
+    }
+
+    return offsets;
+}
+
+/* ==================================================================================== */
+/*! \brief  Calls f(col) for all columns of a row of a stencil matrix, in ascending order */
+template <typename F>
+static void rocsparse_init_stencil_row(const std::vector<std::array<int, 3>>& offsets,
+                                       int64_t                                dim_x,
+                                       int64_t                                dim_y,
+                                       int64_t                                dim_z,
+                                       int64_t                                row,
+                                       F                                      f)
+{
+    int64_t ix = row % dim_x;
+    int64_t iy = (row / dim_x) % dim_y;
+    int64_t iz = row / (dim_x * dim_y);
+
+    for(const auto& s : offsets)
+    {
+        if(ix + s[0] >= 0 && ix + s[0] < dim_x && iy + s[1] >= 0 && iy + s[1] < dim_y
+           && iz + s[2] >= 0 && iz + s[2] < dim_z)
+        {
+            f(row + (s[2] * dim_y + s[1]) * dim_x + s[0]);
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Convert row lengths into row offsets in parallel */
+static rocsparse_int rocsparse_init_scan_row_ptr(std::vector<rocsparse_int>& row_ptr,
+                                                 rocsparse_int               M,
+                                                 rocsparse_index_base        base)
+{
+#ifdef _OPENMP
+    int nparts = omp_get_max_threads();
+#else
+    int nparts = 1;
+#endif
+
+    int64_t              chunk = (static_cast<int64_t>(M) + nparts - 1) / nparts;
+    std::vector<int64_t> sum(nparts + 1, 0);
+
+    // Number of non-zeros per chunk of rows
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int t = 0; t < nparts; ++t)
+    {
+        int64_t end = std::min(chunk * (t + 1), static_cast<int64_t>(M));
+        for(int64_t i = chunk * t; i < end; ++i)
+        {
+            sum[t + 1] += row_ptr[i + 1];
+        }
+    }
+
+    for(int t = 0; t < nparts; ++t)
+    {
+        sum[t + 1] += sum[t];
+    }
+
+    if(sum[nparts] + base > std::numeric_limits<rocsparse_int>::max())
+    {
+        std::cerr << "ERROR: generated matrix exceeds the range of rocsparse_int" << std::endl;
+        abort();
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int t = 0; t < nparts; ++t)
+    {
+        int64_t       end    = std::min(chunk * (t + 1), static_cast<int64_t>(M));
+        rocsparse_int offset = static_cast<rocsparse_int>(sum[t] + base);
+
+        for(int64_t i = chunk * t; i < end; ++i)
+        {
+            offset += row_ptr[i + 1];
+            row_ptr[i + 1] = offset;
+        }
+    }
+
+    row_ptr[0] = base;
+
+    return static_cast<rocsparse_int>(sum[nparts]);
+}
+
+/* ==================================================================================== */
+/*! \brief  Resize to n entries without first touching the pages on the calling thread */
+// std::vector value initializes its entries on resize, such that all pages would be first
+// touched by the calling thread. The whole pages of the fresh storage are therefore handed
+// back to the system, which maps zero pages again on the next access. The parallel loop that
+// fills the array thus places each page on the NUMA node of the thread that owns it.
+template <typename T>
+static void rocsparse_init_resize_untouched(std::vector<T>& v, size_t n)
+{
+    std::vector<T>().swap(v);
+    v.resize(n);
+
+#ifdef __linux__
+    uintptr_t page  = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(v.data()) + page - 1) / page * page;
+    uintptr_t end   = reinterpret_cast<uintptr_t>(v.data() + n) / page * page;
+
+    if(end > begin)
+    {
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+    }
+#endif
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate the graph laplacian of a 2D or 3D stencil in CSR format */
+// The number of entries of each row is computed first, such that the matrix is allocated
+// exactly and all rows can be filled independently of each other.
+template <typename T>
+static void rocsparse_init_csr_stencil(std::vector<rocsparse_int>& row_ptr,
+                                       std::vector<rocsparse_int>& col_ind,
+                                       std::vector<T>&             val,
+                                       int                         dim,
+                                       rocsparse_int               dim_x,
+                                       rocsparse_int               dim_y,
+                                       rocsparse_int               dim_z,
+                                       rocsparse_int               stencil,
+                                       rocsparse_int&              M,
+                                       rocsparse_int&              N,
+                                       rocsparse_int&              nnz,
+                                       rocsparse_index_base        base)
+{
+    int64_t size = static_cast<int64_t>(dim_x) * dim_y * dim_z;
+
+    if(size > std::numeric_limits<rocsparse_int>::max())
+    {
+        std::cerr << "ERROR: generated matrix exceeds the range of rocsparse_int" << std::endl;
+        abort();
+    }
+
+    M = static_cast<rocsparse_int>(size);
+    N = static_cast<rocsparse_int>(size);
+
+    auto offsets = rocsparse_init_stencil(dim, stencil);
+
+    // Diagonal entry of the graph laplacian of an interior row
+    T diag = static_cast<T>(offsets.size() - 1);
+
+    rocsparse_init_resize_untouched(row_ptr, M + 1);
+
+    // Exact number of entries per row
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int count = 0;
+        rocsparse_init_stencil_row(offsets, dim_x, dim_y, dim_z, i, [&](int64_t) { ++count; });
+
+        row_ptr[i + 1] = count;
+    }
+
+    nnz = rocsparse_init_scan_row_ptr(row_ptr, M, base);
+
+    // Pages are first touched by the threads that fill the rows below
+    rocsparse_init_resize_untouched(col_ind, nnz);
+    rocsparse_init_resize_untouched(val, nnz);
+
+    // Fill rows, with the same static schedule as above
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int idx = row_ptr[i] - base;
+
+        rocsparse_init_stencil_row(offsets, dim_x, dim_y, dim_z, i, [&](int64_t col) {
+            col_ind[idx] = static_cast<rocsparse_int>(col) + base;
+            val[idx]     = (col == i) ? diag : static_cast<T>(-1);
+            ++idx;
+        });
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 2D 5/9/13/25pt laplacian on unit square in CSR format */
+template <typename T>
+void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
+                                  std::vector<rocsparse_int>& col_ind,
+                                  std::vector<T>&             val,
+                                  rocsparse_int               dim_x,
+                                  rocsparse_int               dim_y,
+                                  rocsparse_int&              M,
+                                  rocsparse_int&              N,
+                                  rocsparse_int&              nnz,
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil)
+{
+    // Do nothing
+    if(dim_x == 0 || dim_y == 0)
+    {
+        return;
+    }
+
+    rocsparse_init_csr_stencil(
+        row_ptr, col_ind, val, 2, dim_x, dim_y, 1, stencil, M, N, nnz, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 2D 5/9/13/25pt laplacian on unit square in COO format */
+template <typename T>
+void rocsparse_init_coo_laplace2d(std::vector<rocsparse_int>& row_ind,
+                                  std::vector<rocsparse_int>& col_ind,
+                                  std::vector<T>&             val,
+                                  rocsparse_int               dim_x,
+                                  rocsparse_int               dim_y,
+                                  rocsparse_int&              M,
+                                  rocsparse_int&              N,
+                                  rocsparse_int&              nnz,
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil)
+{
+    std::vector<rocsparse_int> row_ptr(M + 1);
+
+    // Sample CSR matrix
+    rocsparse_init_csr_laplace2d(row_ptr, col_ind, val, dim_x, dim_y, M, N, nnz, base, stencil);
+
+    // Convert to COO
+    host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 3D 7/13/19/27/125pt laplacian on unit cube in CSR format */
+template <typename T>
+void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
+                                  std::vector<rocsparse_int>& col_ind,
+                                  std::vector<T>&             val,
+                                  rocsparse_int               dim_x,
+                                  rocsparse_int               dim_y,
+                                  rocsparse_int               dim_z,
+                                  rocsparse_int&              M,
+                                  rocsparse_int&              N,
+                                  rocsparse_int&              nnz,
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil)
+{
+    // Do nothing
+    if(dim_x == 0 || dim_y == 0 || dim_z == 0)
+    {
+        return;
+    }
+
+    rocsparse_init_csr_stencil(
+        row_ptr, col_ind, val, 3, dim_x, dim_y, dim_z, stencil, M, N, nnz, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate 3D 7/13/19/27/125pt laplacian on unit cube in COO format */
+template <typename T>
+void rocsparse_init_coo_laplace3d(std::vector<rocsparse_int>& row_ind,
+                                  std::vector<rocsparse_int>& col_ind,
+                                  std::vector<T>&             val,
+                                  rocsparse_int               dim_x,
+                                  rocsparse_int               dim_y,
+                                  rocsparse_int               dim_z,
+                                  rocsparse_int&              M,
+                                  rocsparse_int&              N,
+                                  rocsparse_int&              nnz,
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil)
+{
+    std::vector<rocsparse_int> row_ptr(M + 1);
+
+    // Sample CSR matrix
+    rocsparse_init_csr_laplace3d(
+        row_ptr, col_ind, val, dim_x, dim_y, dim_z, M, N, nnz, base, stencil);
+
+    // Convert to COO
+    host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
+}
+
+/* ==================================================================================== */
+/*! \brief  Write the laplacian of a stencil to a binary file in rocALUTION format */
+// The matrix is generated in chunks of rows and streamed to the file, such that matrices
+// that do not fit into host memory can be written. The rocALUTION format stores 32 bit
+// indices, which limits the number of rows and non-zero entries.
+rocsparse_status rocsparse_write_rocalution_laplace(const char*   filename,
+                                                    rocsparse_int dim_x,
+                                                    rocsparse_int dim_y,
+                                                    rocsparse_int dim_z,
+                                                    rocsparse_int stencil)
+{
+    int     dim  = (dim_z == 0) ? 2 : 3;
+    int64_t dz   = (dim_z == 0) ? 1 : dim_z;
+    int64_t size = static_cast<int64_t>(dim_x) * dim_y * dz;
+
+    if(dim_x <= 0 || dim_y <= 0 || dz <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    auto offsets = rocsparse_init_stencil(dim, stencil);
+
+    double diag = static_cast<double>(offsets.size() - 1);
+
+    // Count non-zero entries
+    int64_t nnz = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : nnz)
+#endif
+    for(int64_t i = 0; i < size; ++i)
+    {
+        rocsparse_init_stencil_row(offsets, dim_x, dim_y, dz, i, [&](int64_t) { ++nnz; });
+    }
+
+    if(size > std::numeric_limits<int>::max() || nnz > std::numeric_limits<int>::max())
+    {
+        std::cerr << "ERROR: generated matrix exceeds the range of the rocALUTION format"
+                  << std::endl;
+        return rocsparse_status_invalid_size;
+    }
+
+    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    if(!out.is_open())
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    int version = 10000 * ROCSPARSE_VERSION_MAJOR + 100 * ROCSPARSE_VERSION_MINOR
+                  + ROCSPARSE_VERSION_PATCH;
+    int iM   = static_cast<int>(size);
+    int iN   = static_cast<int>(size);
+    int innz = static_cast<int>(nnz);
+
+    out << "#rocALUTION binary csr file" << std::endl;
+    out.write((const char*)&version, sizeof(int));
+    out.write((const char*)&iM, sizeof(int));
+    out.write((const char*)&iN, sizeof(int));
+    out.write((const char*)&innz, sizeof(int));
+
+    // Offsets of the row pointer, column index and value arrays in the file
+    std::streamoff ptr_pos = out.tellp();
+    std::streamoff col_pos = ptr_pos + sizeof(int) * (size + 1);
+    std::streamoff val_pos = col_pos + sizeof(int) * nnz;
+
+    int zero = 0;
+    out.write((const char*)&zero, sizeof(int));
+    ptr_pos += sizeof(int);
+
+    static constexpr int64_t chunk_size = 1 << 20;
+
+    std::vector<int>    ptr(chunk_size + 1);
+    std::vector<int>    col;
+    std::vector<double> val;
+
+    int offset = 0;
+
+    for(int64_t begin = 0; begin < size; begin += chunk_size)
+    {
+        int64_t rows = std::min(chunk_size, size - begin);
+
+        // Row offsets within the chunk
+        ptr[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < rows; ++i)
+        {
+            int count = 0;
+            rocsparse_init_stencil_row(
+                offsets, dim_x, dim_y, dz, begin + i, [&](int64_t) { ++count; });
+
+            ptr[i + 1] = count;
+        }
+
+        for(int64_t i = 0; i < rows; ++i)
+        {
+            ptr[i + 1] += ptr[i];
+        }
+
+        col.resize(ptr[rows]);
+        val.resize(ptr[rows]);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < rows; ++i)
+        {
+            int idx = ptr[i];
+
+            rocsparse_init_stencil_row(offsets, dim_x, dim_y, dz, begin + i, [&](int64_t c) {
+                col[idx] = static_cast<int>(c);
+                val[idx] = (c == begin + i) ? diag : -1.0;
+                ++idx;
+            });
+        }
+
+        for(int64_t i = 1; i <= rows; ++i)
+        {
+            ptr[i] += offset;
+        }
+
+        out.seekp(ptr_pos);
+        out.write((const char*)(ptr.data() + 1), sizeof(int) * rows);
+        out.seekp(col_pos);
+        out.write((const char*)col.data(), sizeof(int) * col.size());
+        out.seekp(val_pos);
+        out.write((const char*)val.data(), sizeof(double) * val.size());
+
+        ptr_pos += sizeof(int) * rows;
+        col_pos += sizeof(int) * col.size();
+        val_pos += sizeof(double) * val.size();
+
+        offset = ptr[rows];
+    }
+
+    out.close();
+
+    return out.fail() ? rocsparse_status_internal_error : rocsparse_status_success;
+}
+
+/* ==================================================================================== */
+/*! \brief  Handle empty matrices of the structured generators */
+template <typename T>
+static bool rocsparse_init_csr_empty(std::vector<rocsparse_int>& row_ptr,
+                                     std::vector<rocsparse_int>& col_ind,
+                                     std::vector<T>&             val,
+                                     rocsparse_int               M,
+                                     rocsparse_int               N,
+                                     rocsparse_int&              nnz,
+                                     rocsparse_index_base        base)
+{
+    if(M > 0 && N > 0)
+    {
+        return false;
+    }
+
+    nnz = 0;
+
+    row_ptr.assign(std::max(M, 0) + 1, base);
+    col_ind.clear();
+    val.clear();
+
+    return true;
+}
+
+/* ==================================================================================== */
+/*! \brief  Sample k distinct indices out of [0, n) using Floyd's algorithm */
+static void rocsparse_sample_distinct(rocsparse_philox_rng& rng,
+                                      int64_t               n,
+                                      int64_t               k,
+                                      rocsparse_int*        ind,
+                                      std::vector<bool>&    check)
+{
+    int64_t idx = 0;
+
+    for(int64_t j = n - k; j < n; ++j)
+    {
+        int64_t t = rng.uniform_int(0, j);
+
+        // j cannot have been picked before
+        if(check[t])
+        {
+            t = j;
+        }
+
+        check[t]   = true;
+        ind[idx++] = t;
+    }
+
+    // Reset disjunct check array
+    for(int64_t i = 0; i < k; ++i)
+    {
+        check[ind[i]] = false;
+    }
+
+    std::sort(ind, ind + k);
+}
+
+/* ==================================================================================== */
+/*! \brief  Convert row lengths into row offsets */
+static int64_t rocsparse_init_row_offsets(std::vector<int64_t>& ptr, rocsparse_int M)
+{
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ptr[i + 1] += ptr[i];
+    }
+
+    if(ptr[M] > std::numeric_limits<rocsparse_int>::max())
+    {
+        std::cerr << "ERROR: generated matrix exceeds the range of rocsparse_int" << std::endl;
+        abort();
+    }
+
+    return ptr[M];
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT matrix in CSR format */
+template <typename T>
+void rocsparse_init_csr_rmat(std::vector<rocsparse_int>& row_ptr,
+                             std::vector<rocsparse_int>& col_ind,
+                             std::vector<T>&             val,
+                             rocsparse_int               M,
+                             rocsparse_int               N,
+                             rocsparse_int&              nnz,
+                             rocsparse_int               row_nnz,
+                             double                      a,
+                             double                      b,
+                             double                      c,
+                             double                      d,
+                             rocsparse_index_base        base)
+{
+    if(rocsparse_init_csr_empty(row_ptr, col_ind, val, M, N, nnz, base))
+    {
+        return;
+    }
+
+    // Normalize the quadrant probabilities
+    double sum = a + b + c + d;
+
+    if(a < 0.0 || b < 0.0 || c < 0.0 || d < 0.0 || sum <= 0.0)
+    {
+        std::cerr << "ERROR: invalid R-MAT probabilities, falling back to a = b = c = d = 0.25"
+                  << std::endl;
+
+        a   = 1.0;
+        b   = 1.0;
+        c   = 1.0;
+        d   = 1.0;
+        sum = 4.0;
+    }
+
+    a /= sum;
+    b /= sum;
+    c /= sum;
+    d /= sum;
+
+    // Number of recursion levels in each dimension
+    int row_levels = 0;
+    int col_levels = 0;
+
+    while((int64_t(1) << row_levels) < M)
+    {
+        ++row_levels;
+    }
+
+    while((int64_t(1) << col_levels) < N)
+    {
+        ++col_levels;
+    }
+
+    int levels = std::max(row_levels, col_levels);
+
+    // Sample a single edge by recursively descending into one of the four quadrants.
+    // Once one of the dimensions is exhausted, the remaining one is split according to
+    // the marginal probabilities. Edges that fall outside of the matrix are rejected.
+    auto sample_edge = [&](rocsparse_philox_rng& rng, int64_t& row, int64_t& col) {
+        do
+        {
+            row = 0;
+            col = 0;
+
+            for(int l = 0; l < levels; ++l)
+            {
+                double u = rng.uniform();
+
+                if(l < row_levels && l < col_levels)
+                {
+                    row = (row << 1) | (u >= a + b);
+                    col = (col << 1) | ((u >= a && u < a + b) || u >= a + b + c);
+                }
+                else if(l < row_levels)
+                {
+                    row = (row << 1) | (u >= a + b);
+                }
+                else
+                {
+                    col = (col << 1) | (u >= a + c);
+                }
+            }
+        } while(row >= M || col >= N);
+    };
+
+    // Key of the counter-based generator. Edges are sampled in chunks of fixed size,
+    // such that the matrix is identical for any number of threads.
+    uint64_t key = (static_cast<uint64_t>(rocsparse_rng()) << 32) | rocsparse_rng();
+
+    static constexpr int64_t chunk_size = 4096;
+
+    int64_t nedges  = static_cast<int64_t>(M) * std::max(row_nnz, 1);
+    int64_t nchunks = (nedges + chunk_size - 1) / chunk_size;
+
+    // Count edges per row
+    std::vector<int64_t> ptr(M + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t k = 0; k < nchunks; ++k)
+    {
+        rocsparse_philox_rng rng(~key, k);
+
+        int64_t end = std::min((k + 1) * chunk_size, nedges);
+
+        for(int64_t i = k * chunk_size; i < end; ++i)
+        {
+            int64_t row;
+            int64_t col;
+
+            sample_edge(rng, row, col);
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++ptr[row + 1];
+        }
+    }
+
+    rocsparse_init_row_offsets(ptr, M);
+
+    // Re-sample the edges and scatter their column indices into the rows
+    std::vector<rocsparse_int> edges(nedges);
+    std::vector<int64_t>       pos(ptr.begin(), ptr.end() - 1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t k = 0; k < nchunks; ++k)
+    {
+        rocsparse_philox_rng rng(~key, k);
+
+        int64_t end = std::min((k + 1) * chunk_size, nedges);
+
+        for(int64_t i = k * chunk_size; i < end; ++i)
+        {
+            int64_t row;
+            int64_t col;
+            int64_t idx;
+
+            sample_edge(rng, row, col);
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            idx = pos[row]++;
+
+            edges[idx] = col;
+        }
+    }
+
+    // Remove duplicated edges
+    std::vector<int64_t> unique_ptr(M + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        auto begin = edges.begin() + ptr[row];
+        auto end   = edges.begin() + ptr[row + 1];
+
+        std::sort(begin, end);
+        unique_ptr[row + 1] = std::unique(begin, end) - begin;
+    }
+
+    nnz = rocsparse_init_row_offsets(unique_ptr, M);
+
+    row_ptr.resize(M + 1);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    row_ptr[0] = base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        rocsparse_philox_rng rng(key, row);
+
+        int64_t offset = ptr[row] - unique_ptr[row];
+
+        for(int64_t j = unique_ptr[row]; j < unique_ptr[row + 1]; ++j)
+        {
+            col_ind[j] = edges[offset + j] + base;
+            val[j]     = random_generator<T>(rng);
+        }
+
+        row_ptr[row + 1] = unique_ptr[row + 1] + base;
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT matrix in COO format */
 template <typename T>
-void rocsparse_init_nan(T* A, size_t N)
+void rocsparse_init_coo_rmat(std::vector<rocsparse_int>& row_ind,
+                             std::vector<rocsparse_int>& col_ind,
+                             std::vector<T>&             val,
+                             rocsparse_int               M,
+                             rocsparse_int               N,
+                             rocsparse_int&              nnz,
+                             rocsparse_int               row_nnz,
+                             double                      a,
+                             double                      b,
+                             double                      c,
+                             double                      d,
+                             rocsparse_index_base        base)
 {
-    for(size_t i = 0; i < N; ++i)
-        A[i] = T(rocsparse_nan_rng());
-}
+    std::vector<rocsparse_int> row_ptr;
 
-template void rocsparse_init_nan<int>(int* A, size_t N);
-template void rocsparse_init_nan<char>(char* A, size_t N);
-template void rocsparse_init_nan<size_t>(size_t* A, size_t N);
+    // Sample CSR matrix
+    rocsparse_init_csr_rmat(row_ptr, col_ind, val, M, N, nnz, row_nnz, a, b, c, d, base);
 
-template <typename T>
-void rocsparse_init_nan(
-    std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride, size_t batch_count)
-{
-    for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = T(rocsparse_nan_rng());
+    // Convert to COO
+    host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a random sparse matrix in COO format */
+/*! \brief  Generate a matrix with power-law distributed row lengths in CSR format */
 template <typename T>
-void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
-                               std::vector<rocsparse_int>& col_ind,
-                               std::vector<T>&             val,
-                               size_t                      M,
-                               size_t                      N,
-                               size_t                      nnz,
-                               rocsparse_index_base        base,
-                               bool                        full_rank)
+void rocsparse_init_csr_powerlaw(std::vector<rocsparse_int>& row_ptr,
+                                 std::vector<rocsparse_int>& col_ind,
+                                 std::vector<T>&             val,
+                                 rocsparse_int               M,
+                                 rocsparse_int               N,
+                                 rocsparse_int&              nnz,
+                                 rocsparse_int               row_nnz,
+                                 double                      exponent,
+                                 rocsparse_index_base        base)
 {
-    // If M > N, full rank is not possible
-    if(full_rank && M > N)
+    if(rocsparse_init_csr_empty(row_ptr, col_ind, val, M, N, nnz, base))
     {
-        std::cerr << "ERROR: M > N, cannot generate matrix with full rank" << std::endl;
-        full_rank = false;
+        return;
     }
 
-    // If nnz < M, full rank is not possible
-    if(full_rank && nnz < M)
+    if(exponent <= 1.0)
     {
-        std::cerr << "ERROR: nnz < M, cannot generate matrix with full rank" << std::endl;
-        full_rank = false;
+        std::cerr << "ERROR: power-law exponent must be larger than 1, falling back to 2.5"
+                  << std::endl;
+        exponent = 2.5;
     }
 
-    if(row_ind.size() != nnz)
-    {
-        row_ind.resize(nnz);
-    }
-    if(col_ind.size() != nnz)
-    {
-        col_ind.resize(nnz);
-    }
-    if(val.size() != nnz)
-    {
-        val.resize(nnz);
-    }
+    // Row lengths follow a Pareto distribution with shape exponent - 1. Its scale is
+    // chosen such that the mean row length matches row_nnz, if the mean exists.
+    double shape = exponent - 1.0;
+    double scale = (shape > 1.0) ? std::max(row_nnz, 1) * (shape - 1.0) / shape : 1.0;
 
-    // Add diagonal entry, if full rank is flagged
-    size_t i = 0;
+    scale = std::max(scale, 1.0);
 
-    if(full_rank)
-    {
-        for(; i < M; ++i)
-        {
-            row_ind[i] = i;
-        }
-    }
+    auto sample_row_length = [&](rocsparse_philox_rng& rng) {
+        double x = scale * std::pow(1.0 - rng.uniform(), -1.0 / shape);
+        return static_cast<int64_t>(std::min(x, static_cast<double>(N)));
+    };
 
-    // Uniform distributed row indices
-    for(; i < nnz; ++i)
+    // Key of the counter-based generator. Each row samples its length, its column
+    // indices and its values from its own stream.
+    uint64_t key = (static_cast<uint64_t>(rocsparse_rng()) << 32) | rocsparse_rng();
+
+    std::vector<int64_t> ptr(M + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
     {
-        row_ind[i] = random_generator<rocsparse_int>(0, M - 1);
+        rocsparse_philox_rng rng(key, row);
+
+        ptr[row + 1] = sample_row_length(rng);
     }
 
-    // Sort row indices
-    std::sort(row_ind.begin(), row_ind.end());
+    nnz = rocsparse_init_row_offsets(ptr, M);
 
-    // Sample column indices
-    std::vector<bool> check(nnz, false);
+    row_ptr.resize(M + 1);
+    col_ind.resize(nnz);
+    val.resize(nnz);
 
-    i = 0;
-    while(i < nnz)
-    {
-        size_t begin = i;
-        while(row_ind[i] == row_ind[begin])
-        {
-            ++i;
-            if(i >= nnz)
-            {
-                break;
-            }
-        }
+    row_ptr[0] = base;
 
-        // Sample i disjunct column indices
-        size_t idx = begin;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Disjunct check array
+        std::vector<bool> check(N, false);
 
-        if(full_rank)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(rocsparse_int row = 0; row < M; ++row)
         {
-            check[row_ind[idx]] = true;
-            col_ind[idx++]      = row_ind[begin];
-        }
+            rocsparse_philox_rng rng(key, row);
 
-        while(idx < i)
-        {
-            // Normal distribution around the diagonal
-            rocsparse_int rng = (i - begin) * random_generator_normal<double>();
+            // Skip the row length
+            sample_row_length(rng);
 
-            if(M <= N)
-            {
-                rng += row_ind[begin];
-            }
+            int64_t begin = ptr[row];
+            int64_t end   = ptr[row + 1];
 
-            // Repeat if running out of bounds
-            if(rng < 0 || rng > N - 1)
-            {
-                continue;
-            }
+            // Uniformly distributed disjunct column indices
+            rocsparse_sample_distinct(rng, N, end - begin, col_ind.data() + begin, check);
 
-            // Check for disjunct column index in current row
-            if(!check[rng])
+            for(int64_t j = begin; j < end; ++j)
             {
-                check[rng]     = true;
-                col_ind[idx++] = rng;
+                col_ind[j] += base;
+                val[j] = random_generator<T>(rng);
             }
-        }
 
-        // Reset disjunct check array
-        for(size_t j = begin; j < i; ++j)
-        {
-            check[col_ind[j]] = false;
+            row_ptr[row + 1] = end + base;
         }
-
-        // Partially sort column indices
-        std::sort(&col_ind[begin], &col_ind[i]);
     }
+}
 
-    // Correct index base accordingly
-    if(base == rocsparse_index_base_one)
-    {
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++row_ind[i];
-            ++col_ind[i];
-        }
-    }
+/* ==================================================================================== */
+/*! \brief  Generate a matrix with power-law distributed row lengths in COO format */
+template <typename T>
+void rocsparse_init_coo_powerlaw(std::vector<rocsparse_int>& row_ind,
+                                 std::vector<rocsparse_int>& col_ind,
+                                 std::vector<T>&             val,
+                                 rocsparse_int               M,
+                                 rocsparse_int               N,
+                                 rocsparse_int&              nnz,
+                                 rocsparse_int               row_nnz,
+                                 double                      exponent,
+                                 rocsparse_index_base        base)
+{
+    std::vector<rocsparse_int> row_ptr;
 
-    // Sample random off-diagonal values
-    for(rocsparse_int i = 0; i < nnz; ++i)
-    {
-        if(row_ind[i] == col_ind[i])
-        {
-            // Sample diagonal values
-            val[i] = random_generator<T>();
-        }
-        else
-        {
-            // Samples off-diagonal values
-            val[i] = random_generator<T>();
-        }
-    }
+    // Sample CSR matrix
+    rocsparse_init_csr_powerlaw(row_ptr, col_ind, val, M, N, nnz, row_nnz, exponent, base);
+
+    // Convert to COO
+    host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate 2D 9pt laplacian on unit square in CSR format */
+/*! \brief  Generate a banded matrix with variable bandwidth in CSR format */
 template <typename T>
-void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
-                                  std::vector<rocsparse_int>& col_ind,
-                                  std::vector<T>&             val,
-                                  rocsparse_int               dim_x,
-                                  rocsparse_int               dim_y,
-                                  rocsparse_int&              M,
-                                  rocsparse_int&              N,
-                                  rocsparse_int&              nnz,
-                                  rocsparse_index_base        base)
+void rocsparse_init_csr_banded(std::vector<rocsparse_int>& row_ptr,
+                               std::vector<rocsparse_int>& col_ind,
+                               std::vector<T>&             val,
+                               rocsparse_int               M,
+                               rocsparse_int               N,
+                               rocsparse_int&              nnz,
+                               rocsparse_int               bandwidth,
+                               rocsparse_index_base        base)
 {
-    // Do nothing
-    if(dim_x == 0 || dim_y == 0)
+    if(rocsparse_init_csr_empty(row_ptr, col_ind, val, M, N, nnz, base))
     {
         return;
     }
 
-    M = dim_x * dim_y;
-    N = dim_x * dim_y;
+    bandwidth = std::max(bandwidth, 0);
+
+    // Each row samples its lower and upper bandwidth from [0, bandwidth]
+    auto sample_band = [&](rocsparse_philox_rng& rng, int64_t row, int64_t& begin, int64_t& end) {
+        int64_t lower = rng.uniform_int(0, bandwidth);
+        int64_t upper = rng.uniform_int(0, bandwidth);
+
+        begin = std::max(row - lower, int64_t(0));
+        end   = std::max(std::min(row + upper + 1, static_cast<int64_t>(N)), begin);
+    };
+
+    uint64_t key = (static_cast<uint64_t>(rocsparse_rng()) << 32) | rocsparse_rng();
+
+    std::vector<int64_t> ptr(M + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        rocsparse_philox_rng rng(key, row);
+
+        int64_t begin;
+        int64_t end;
+
+        sample_band(rng, row, begin, end);
 
-    // Approximate 9pt stencil
-    rocsparse_int nnz_mat = 9 * M;
+        ptr[row + 1] = end - begin;
+    }
+
+    nnz = rocsparse_init_row_offsets(ptr, M);
 
     row_ptr.resize(M + 1);
-    col_ind.resize(nnz_mat);
-    val.resize(nnz_mat);
+    col_ind.resize(nnz);
+    val.resize(nnz);
 
-    nnz        = base;
     row_ptr[0] = base;
 
-    // Fill local arrays
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int iy = 0; iy < dim_y; ++iy)
+    for(rocsparse_int row = 0; row < M; ++row)
     {
-        for(rocsparse_int ix = 0; ix < dim_x; ++ix)
-        {
-            rocsparse_int row = iy * dim_x + ix;
+        rocsparse_philox_rng rng(key, row);
 
-            for(int sy = -1; sy <= 1; ++sy)
-            {
-                if(iy + sy > -1 && iy + sy < dim_y)
-                {
-                    for(int sx = -1; sx <= 1; ++sx)
-                    {
-                        if(ix + sx > -1 && ix + sx < dim_x)
-                        {
-                            rocsparse_int col = row + sy * dim_x + sx;
-
-                            col_ind[nnz - base] = col + base;
-                            val[nnz - base]     = (col == row) ? 8.0 : -1.0;
-
-                            ++nnz;
-                        }
-                    }
-                }
-            }
+        int64_t begin;
+        int64_t end;
+
+        sample_band(rng, row, begin, end);
+
+        int64_t idx = ptr[row];
+
+        for(int64_t col = begin; col < end; ++col)
+        {
+            col_ind[idx] = col + base;
+            val[idx]     = random_generator<T>(rng);
 
-            row_ptr[row + 1] = nnz;
+            ++idx;
         }
-    }
 
-    // Adjust nnz by index base
-    nnz -= base;
+        row_ptr[row + 1] = ptr[row + 1] + base;
+    }
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate 2D 9pt laplacian on unit square in COO format */
+/*! \brief  Generate a banded matrix with variable bandwidth in COO format */
 template <typename T>
-void rocsparse_init_coo_laplace2d(std::vector<rocsparse_int>& row_ind,
-                                  std::vector<rocsparse_int>& col_ind,
-                                  std::vector<T>&             val,
-                                  rocsparse_int               dim_x,
-                                  rocsparse_int               dim_y,
-                                  rocsparse_int&              M,
-                                  rocsparse_int&              N,
-                                  rocsparse_int&              nnz,
-                                  rocsparse_index_base        base)
+void rocsparse_init_coo_banded(std::vector<rocsparse_int>& row_ind,
+                               std::vector<rocsparse_int>& col_ind,
+                               std::vector<T>&             val,
+                               rocsparse_int               M,
+                               rocsparse_int               N,
+                               rocsparse_int&              nnz,
+                               rocsparse_int               bandwidth,
+                               rocsparse_index_base        base)
 {
-    std::vector<rocsparse_int> row_ptr(M + 1);
+    std::vector<rocsparse_int> row_ptr;
 
     // Sample CSR matrix
-    rocsparse_init_csr_laplace2d(row_ptr, col_ind, val, dim_x, dim_y, M, N, nnz, base);
+    rocsparse_init_csr_banded(row_ptr, col_ind, val, M, N, nnz, bandwidth, base);
 
     // Convert to COO
     host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate 3D 27pt laplacian on unit square in CSR format */
+/*! \brief  Generate a FEM-like matrix of dense blocks in CSR format */
 template <typename T>
-void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
-                                  std::vector<rocsparse_int>& col_ind,
-                                  std::vector<T>&             val,
-                                  rocsparse_int               dim_x,
-                                  rocsparse_int               dim_y,
-                                  rocsparse_int               dim_z,
-                                  rocsparse_int&              M,
-                                  rocsparse_int&              N,
-                                  rocsparse_int&              nnz,
-                                  rocsparse_index_base        base)
+void rocsparse_init_csr_block(std::vector<rocsparse_int>& row_ptr,
+                              std::vector<rocsparse_int>& col_ind,
+                              std::vector<T>&             val,
+                              rocsparse_int               M,
+                              rocsparse_int               N,
+                              rocsparse_int&              nnz,
+                              rocsparse_int               block_dim,
+                              rocsparse_int               row_nnz,
+                              rocsparse_index_base        base)
 {
-    // Do nothing
-    if(dim_x == 0 || dim_y == 0 || dim_z == 0)
+    if(rocsparse_init_csr_empty(row_ptr, col_ind, val, M, N, nnz, base))
     {
         return;
     }
 
-    M = dim_x * dim_y * dim_z;
-    N = dim_x * dim_y * dim_z;
+    block_dim = std::max(block_dim, 1);
 
-    // Approximate 27pt stencil
-    rocsparse_int nnz_mat = 27 * M;
+    rocsparse_int Mb = (M + block_dim - 1) / block_dim;
+    rocsparse_int Nb = (N + block_dim - 1) / block_dim;
 
-    row_ptr.resize(M + 1);
-    col_ind.resize(nnz_mat);
-    val.resize(nnz_mat);
+    // Number of coupled blocks per block row, including the diagonal block
+    rocsparse_int nblocks = std::min(std::max(row_nnz / block_dim, 1), Nb);
 
-    nnz        = base;
-    row_ptr[0] = base;
+    uint64_t key = (static_cast<uint64_t>(rocsparse_rng()) << 32) | rocsparse_rng();
+
+    std::vector<int64_t> ptr(M + 1, 0);
+
+    // Column indices of the blocks of each block row
+    std::vector<rocsparse_int> blocks(static_cast<size_t>(Mb) * nblocks);
 
-    // Fill local arrays
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-    for(rocsparse_int iz = 0; iz < dim_z; ++iz)
     {
-        for(rocsparse_int iy = 0; iy < dim_y; ++iy)
+        // Disjunct check array
+        std::vector<bool> check(Nb, false);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for(rocsparse_int ib = 0; ib < Mb; ++ib)
         {
-            for(rocsparse_int ix = 0; ix < dim_x; ++ix)
+            rocsparse_philox_rng rng(key, ib);
+
+            rocsparse_int* bcol = blocks.data() + static_cast<size_t>(ib) * nblocks;
+
+            // Each block row couples to its diagonal block and to blocks that are normally
+            // distributed around the diagonal, similar to the element connectivity of a mesh
+            rocsparse_int idx = 0;
+
+            if(ib < Nb)
             {
-                rocsparse_int row = iz * dim_x * dim_y + iy * dim_x + ix;
+                check[ib]   = true;
+                bcol[idx++] = ib;
+            }
+
+            while(idx < nblocks)
+            {
+                int64_t jb = std::min(ib, Nb - 1) + static_cast<int64_t>(nblocks * rng.normal());
 
-                for(int sz = -1; sz <= 1; ++sz)
+                // Repeat if running out of bounds or if the block is already coupled
+                if(jb < 0 || jb >= Nb || check[jb])
                 {
-                    if(iz + sz > -1 && iz + sz < dim_z)
-                    {
-                        for(int sy = -1; sy <= 1; ++sy)
-                        {
-                            if(iy + sy > -1 && iy + sy < dim_y)
-                            {
-                                for(int sx = -1; sx <= 1; ++sx)
-                                {
-                                    if(ix + sx > -1 && ix + sx < dim_x)
-                                    {
-                                        rocsparse_int col
-                                            = row + sz * dim_x * dim_y + sy * dim_x + sx;
-
-                                        col_ind[nnz - base] = col + base;
-                                        val[nnz - base]     = (col == row) ? 26.0 : -1.0;
-
-                                        ++nnz;
-                                    }
-                                }
-                            }
-                        }
-                    }
+                    continue;
                 }
 
-                row_ptr[row + 1] = nnz;
+                check[jb]   = true;
+                bcol[idx++] = jb;
+            }
+
+            // Reset disjunct check array
+            for(rocsparse_int k = 0; k < nblocks; ++k)
+            {
+                check[bcol[k]] = false;
+            }
+
+            std::sort(bcol, bcol + nblocks);
+
+            // All rows of a block row share the same pattern
+            int64_t length = 0;
+
+            for(rocsparse_int k = 0; k < nblocks; ++k)
+            {
+                length += std::min(block_dim, N - bcol[k] * block_dim);
+            }
+
+            for(rocsparse_int i = ib * block_dim; i < std::min((ib + 1) * block_dim, M); ++i)
+            {
+                ptr[i + 1] = length;
             }
         }
     }
 
-    // Adjust nnz by index base
-    nnz -= base;
+    nnz = rocsparse_init_row_offsets(ptr, M);
+
+    row_ptr.resize(M + 1);
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+    row_ptr[0] = base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        rocsparse_philox_rng rng(~key, row);
+
+        const rocsparse_int* bcol = blocks.data() + static_cast<size_t>(row / block_dim) * nblocks;
+
+        int64_t idx = ptr[row];
+
+        for(rocsparse_int k = 0; k < nblocks; ++k)
+        {
+            rocsparse_int begin = bcol[k] * block_dim;
+            rocsparse_int end   = std::min(begin + block_dim, N);
+
+            for(rocsparse_int col = begin; col < end; ++col)
+            {
+                col_ind[idx] = col + base;
+                val[idx]     = random_generator<T>(rng);
+
+                ++idx;
+            }
+        }
+
+        row_ptr[row + 1] = ptr[row + 1] + base;
+    }
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate 3D 27pt laplacian on unit square in COO format */
+/*! \brief  Generate a FEM-like matrix of dense blocks in COO format */
 template <typename T>
-void rocsparse_init_coo_laplace3d(std::vector<rocsparse_int>& row_ind,
-                                  std::vector<rocsparse_int>& col_ind,
-                                  std::vector<T>&             val,
-                                  rocsparse_int               dim_x,
-                                  rocsparse_int               dim_y,
-                                  rocsparse_int               dim_z,
-                                  rocsparse_int&              M,
-                                  rocsparse_int&              N,
-                                  rocsparse_int&              nnz,
-                                  rocsparse_index_base        base)
+void rocsparse_init_coo_block(std::vector<rocsparse_int>& row_ind,
+                              std::vector<rocsparse_int>& col_ind,
+                              std::vector<T>&             val,
+                              rocsparse_int               M,
+                              rocsparse_int               N,
+                              rocsparse_int&              nnz,
+                              rocsparse_int               block_dim,
+                              rocsparse_int               row_nnz,
+                              rocsparse_index_base        base)
 {
-    std::vector<rocsparse_int> row_ptr(M + 1);
+    std::vector<rocsparse_int> row_ptr;
 
     // Sample CSR matrix
-    rocsparse_init_csr_laplace3d(row_ptr, col_ind, val, dim_x, dim_y, dim_z, M, N, nnz, base);
+    rocsparse_init_csr_block(row_ptr, col_ind, val, M, N, nnz, block_dim, row_nnz, base);
 
     // Convert to COO
     host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
@@ -1172,7 +2164,8 @@ void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& coo_row_ind,
                                                      rocsparse_int & M,                            \
                                                      rocsparse_int & N,                            \
                                                      rocsparse_int & nnz,                          \
-                                                     rocsparse_index_base base);                   \
+                                                     rocsparse_index_base base,                    \
+                                                     rocsparse_int stencil);                       \
     template void rocsparse_init_coo_laplace2d<TYPE>(std::vector<rocsparse_int> & row_ind,         \
                                                      std::vector<rocsparse_int> & col_ind,         \
                                                      std::vector<TYPE> & val,                      \
@@ -1181,7 +2174,8 @@ void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& coo_row_ind,
                                                      rocsparse_int & M,                            \
                                                      rocsparse_int & N,                            \
                                                      rocsparse_int & nnz,                          \
-                                                     rocsparse_index_base base);                   \
+                                                     rocsparse_index_base base,                    \
+                                                     rocsparse_int stencil);                       \
     template void rocsparse_init_csr_laplace3d<TYPE>(std::vector<rocsparse_int> & row_ptr,         \
                                                      std::vector<rocsparse_int> & col_ind,         \
                                                      std::vector<TYPE> & val,                      \
@@ -1191,7 +2185,8 @@ void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& coo_row_ind,
                                                      rocsparse_int & M,                            \
                                                      rocsparse_int & N,                            \
                                                      rocsparse_int & nnz,                          \
-                                                     rocsparse_index_base base);                   \
+                                                     rocsparse_index_base base,                    \
+                                                     rocsparse_int stencil);                       \
     template void rocsparse_init_coo_laplace3d<TYPE>(std::vector<rocsparse_int> & row_ind,         \
                                                      std::vector<rocsparse_int> & col_ind,         \
                                                      std::vector<TYPE> & val,                      \
@@ -1201,7 +2196,84 @@ void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& coo_row_ind,
                                                      rocsparse_int & M,                            \
                                                      rocsparse_int & N,                            \
                                                      rocsparse_int & nnz,                          \
-                                                     rocsparse_index_base base);                   \
+                                                     rocsparse_index_base base,                    \
+                                                     rocsparse_int stencil);                       \
+    template void rocsparse_init_csr_rmat<TYPE>(std::vector<rocsparse_int> & row_ptr,              \
+                                                std::vector<rocsparse_int> & col_ind,              \
+                                                std::vector<TYPE> & val,                           \
+                                                rocsparse_int M,                                   \
+                                                rocsparse_int N,                                   \
+                                                rocsparse_int & nnz,                               \
+                                                rocsparse_int row_nnz,                             \
+                                                double a,                                          \
+                                                double b,                                          \
+                                                double c,                                          \
+                                                double d,                                          \
+                                                rocsparse_index_base base);                        \
+    template void rocsparse_init_coo_rmat<TYPE>(std::vector<rocsparse_int> & row_ind,              \
+                                                std::vector<rocsparse_int> & col_ind,              \
+                                                std::vector<TYPE> & val,                           \
+                                                rocsparse_int M,                                   \
+                                                rocsparse_int N,                                   \
+                                                rocsparse_int & nnz,                               \
+                                                rocsparse_int row_nnz,                             \
+                                                double a,                                          \
+                                                double b,                                          \
+                                                double c,                                          \
+                                                double d,                                          \
+                                                rocsparse_index_base base);                        \
+    template void rocsparse_init_csr_powerlaw<TYPE>(std::vector<rocsparse_int> & row_ptr,          \
+                                                    std::vector<rocsparse_int> & col_ind,          \
+                                                    std::vector<TYPE> & val,                       \
+                                                    rocsparse_int M,                               \
+                                                    rocsparse_int N,                               \
+                                                    rocsparse_int & nnz,                           \
+                                                    rocsparse_int row_nnz,                         \
+                                                    double exponent,                               \
+                                                    rocsparse_index_base base);                    \
+    template void rocsparse_init_coo_powerlaw<TYPE>(std::vector<rocsparse_int> & row_ind,          \
+                                                    std::vector<rocsparse_int> & col_ind,          \
+                                                    std::vector<TYPE> & val,                       \
+                                                    rocsparse_int M,                               \
+                                                    rocsparse_int N,                               \
+                                                    rocsparse_int & nnz,                           \
+                                                    rocsparse_int row_nnz,                         \
+                                                    double exponent,                               \
+                                                    rocsparse_index_base base);                    \
+    template void rocsparse_init_csr_banded<TYPE>(std::vector<rocsparse_int> & row_ptr,            \
+                                                  std::vector<rocsparse_int> & col_ind,            \
+                                                  std::vector<TYPE> & val,                         \
+                                                  rocsparse_int M,                                 \
+                                                  rocsparse_int N,                                 \
+                                                  rocsparse_int & nnz,                             \
+                                                  rocsparse_int bandwidth,                         \
+                                                  rocsparse_index_base base);                      \
+    template void rocsparse_init_coo_banded<TYPE>(std::vector<rocsparse_int> & row_ind,            \
+                                                  std::vector<rocsparse_int> & col_ind,            \
+                                                  std::vector<TYPE> & val,                         \
+                                                  rocsparse_int M,                                 \
+                                                  rocsparse_int N,                                 \
+                                                  rocsparse_int & nnz,                             \
+                                                  rocsparse_int bandwidth,                         \
+                                                  rocsparse_index_base base);                      \
+    template void rocsparse_init_csr_block<TYPE>(std::vector<rocsparse_int> & row_ptr,             \
+                                                 std::vector<rocsparse_int> & col_ind,             \
+                                                 std::vector<TYPE> & val,                          \
+                                                 rocsparse_int M,                                  \
+                                                 rocsparse_int N,                                  \
+                                                 rocsparse_int & nnz,                              \
+                                                 rocsparse_int block_dim,                          \
+                                                 rocsparse_int row_nnz,                            \
+                                                 rocsparse_index_base base);                       \
+    template void rocsparse_init_coo_block<TYPE>(std::vector<rocsparse_int> & row_ind,             \
+                                                 std::vector<rocsparse_int> & col_ind,             \
+                                                 std::vector<TYPE> & val,                          \
+                                                 rocsparse_int M,                                  \
+                                                 rocsparse_int N,                                  \
+                                                 rocsparse_int & nnz,                              \
+                                                 rocsparse_int block_dim,                          \
+                                                 rocsparse_int row_nnz,                            \
+                                                 rocsparse_index_base base);                       \
     template void rocsparse_init_coo_mtx<TYPE>(const char*                 filename,               \
                                                std::vector<rocsparse_int>& coo_row_ind,            \
                                                std::vector<rocsparse_int>& coo_col_ind,            \
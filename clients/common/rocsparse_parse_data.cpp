@@ -51,17 +51,51 @@ static std::string rocsparse_parse_yaml(const std::string& yaml)
     return tmp;
 }
 
-// Parse --data and --yaml command-line arguments
+// Parse --shard <index>/<count> argument
+static void rocsparse_parse_shard(const char* shard)
+{
+    char*              end;
+    unsigned long long index = strtoull(shard, &end, 10);
+    unsigned long long count = 0;
+
+    if(end != shard && *end == '/')
+    {
+        const char* p = end + 1;
+        count         = strtoull(p, &end, 10);
+        if(end == p || *end)
+            count = 0;
+    }
+
+    if(count == 0 || index >= count)
+    {
+        std::cerr << "Invalid shard " << shard << ", expected <index>/<count> with index < count"
+                  << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    RocSPARSE_TestData::set_shard(index, count);
+}
+
+// Parse --data, --yaml and --shard command-line arguments
 bool rocsparse_parse_data(int& argc, char** argv, const std::string& default_file)
 {
     std::string filename;
     char**      argv_p = argv + 1;
     bool        help = false, yaml = false;
 
-    // Scan, process and remove any --yaml or --data options
+    // Scan, process and remove any --yaml, --data or --shard options
     for(int i = 1; argv[i]; ++i)
     {
-        if(!strcmp(argv[i], "--data") || (yaml |= !strcmp(argv[i], "--yaml")))
+        if(!strcmp(argv[i], "--shard"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                std::cerr << "The " << argv[i] << " option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            rocsparse_parse_shard(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--data") || (yaml |= !strcmp(argv[i], "--yaml")))
         {
             if(filename != "")
             {
@@ -84,7 +118,9 @@ bool rocsparse_parse_data(int& argc, char** argv, const std::string& default_fil
             {
                 help = true;
                 std::cout << "\n"
-                          << argv[0] << " [ --data <path> | --yaml <path> ] <options> ...\n"
+                          << argv[0]
+                          << " [ --data <path> | --yaml <path> ] [ --shard <index>/<count> ]"
+                             " <options> ...\n"
                           << std::endl;
             }
         }
@@ -0,0 +1,105 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_sync_probe.hpp"
+
+#include <chrono>
+#include <thread>
+
+rocsparse_sync_probe::rocsparse_sync_probe(rocsparse_handle handle, double timeout_ms)
+    : m_stream(nullptr)
+    , m_timeout_ms(timeout_ms)
+    , m_blocked(false)
+    , m_released(false)
+    , m_timed_out(false)
+{
+    rocsparse_get_stream(handle, &this->m_stream);
+}
+
+rocsparse_sync_probe::~rocsparse_sync_probe()
+{
+    if(this->m_blocked)
+    {
+        this->release();
+    }
+}
+
+void rocsparse_sync_probe::callback(hipStream_t stream, hipError_t status, void* data)
+{
+    rocsparse_sync_probe* probe = static_cast<rocsparse_sync_probe*>(data);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Wait for the release of the probe
+    while(!probe->m_released.load())
+    {
+        std::chrono::duration<double, std::milli> elapsed
+            = std::chrono::steady_clock::now() - start;
+
+        // The host is waiting for the stream, thus the probe will never be released
+        if(elapsed.count() > probe->m_timeout_ms)
+        {
+            probe->m_timed_out.store(true);
+            return;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+hipError_t rocsparse_sync_probe::block()
+{
+    // Wait for previous work, such that only the probed routine can block the host
+    hipError_t status = hipStreamSynchronize(this->m_stream);
+    if(status != hipSuccess)
+    {
+        return status;
+    }
+
+    this->m_released.store(false);
+    this->m_timed_out.store(false);
+
+    status = hipStreamAddCallback(this->m_stream, callback, this, 0);
+    if(status != hipSuccess)
+    {
+        return status;
+    }
+
+    this->m_blocked = true;
+
+    return hipSuccess;
+}
+
+bool rocsparse_sync_probe::release()
+{
+    // If the callback has timed out, the host has been waiting for the stream
+    bool synchronized = this->m_timed_out.load();
+
+    this->m_released.store(true);
+    this->m_blocked = false;
+
+    hipStreamSynchronize(this->m_stream);
+
+    return synchronized;
+}
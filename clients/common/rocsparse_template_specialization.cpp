@@ -287,6 +287,176 @@ rocsparse_status rocsparse_sctr(rocsparse_handle                handle,
     return rocsparse_zsctr(handle, nnz, x_val, x_ind, y, idx_base);
 }
 
+// spdot
+template <>
+rocsparse_status rocsparse_spdot(rocsparse_handle     handle,
+                                 rocsparse_int        nnz_x,
+                                 const float*         x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_int        nnz_y,
+                                 const float*         y_val,
+                                 const rocsparse_int* y_ind,
+                                 float*               result,
+                                 rocsparse_index_base idx_base)
+{
+    return rocsparse_sspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+template <>
+rocsparse_status rocsparse_spdot(rocsparse_handle     handle,
+                                 rocsparse_int        nnz_x,
+                                 const double*        x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_int        nnz_y,
+                                 const double*        y_val,
+                                 const rocsparse_int* y_ind,
+                                 double*              result,
+                                 rocsparse_index_base idx_base)
+{
+    return rocsparse_dspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+template <>
+rocsparse_status rocsparse_spdot(rocsparse_handle               handle,
+                                 rocsparse_int                  nnz_x,
+                                 const rocsparse_float_complex* x_val,
+                                 const rocsparse_int*           x_ind,
+                                 rocsparse_int                  nnz_y,
+                                 const rocsparse_float_complex* y_val,
+                                 const rocsparse_int*           y_ind,
+                                 rocsparse_float_complex*       result,
+                                 rocsparse_index_base           idx_base)
+{
+    return rocsparse_cspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+template <>
+rocsparse_status rocsparse_spdot(rocsparse_handle                handle,
+                                 rocsparse_int                   nnz_x,
+                                 const rocsparse_double_complex* x_val,
+                                 const rocsparse_int*            x_ind,
+                                 rocsparse_int                   nnz_y,
+                                 const rocsparse_double_complex* y_val,
+                                 const rocsparse_int*            y_ind,
+                                 rocsparse_double_complex*       result,
+                                 rocsparse_index_base            idx_base)
+{
+    return rocsparse_zspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, result, idx_base);
+}
+
+// spaxpy
+template <>
+rocsparse_status rocsparse_spaxpy(rocsparse_handle     handle,
+                                  rocsparse_int        nnz_x,
+                                  const float*         alpha,
+                                  const float*         x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        nnz_y,
+                                  const float*         y_val,
+                                  const rocsparse_int* y_ind,
+                                  float*               z_val,
+                                  rocsparse_int*       z_ind,
+                                  rocsparse_index_base idx_base,
+                                  void*                temp_buffer)
+{
+    return rocsparse_sspaxpy(handle,
+                             nnz_x,
+                             alpha,
+                             x_val,
+                             x_ind,
+                             nnz_y,
+                             y_val,
+                             y_ind,
+                             z_val,
+                             z_ind,
+                             idx_base,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_spaxpy(rocsparse_handle     handle,
+                                  rocsparse_int        nnz_x,
+                                  const double*        alpha,
+                                  const double*        x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        nnz_y,
+                                  const double*        y_val,
+                                  const rocsparse_int* y_ind,
+                                  double*              z_val,
+                                  rocsparse_int*       z_ind,
+                                  rocsparse_index_base idx_base,
+                                  void*                temp_buffer)
+{
+    return rocsparse_dspaxpy(handle,
+                             nnz_x,
+                             alpha,
+                             x_val,
+                             x_ind,
+                             nnz_y,
+                             y_val,
+                             y_ind,
+                             z_val,
+                             z_ind,
+                             idx_base,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_spaxpy(rocsparse_handle               handle,
+                                  rocsparse_int                  nnz_x,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_float_complex* x_val,
+                                  const rocsparse_int*           x_ind,
+                                  rocsparse_int                  nnz_y,
+                                  const rocsparse_float_complex* y_val,
+                                  const rocsparse_int*           y_ind,
+                                  rocsparse_float_complex*       z_val,
+                                  rocsparse_int*                 z_ind,
+                                  rocsparse_index_base           idx_base,
+                                  void*                          temp_buffer)
+{
+    return rocsparse_cspaxpy(handle,
+                             nnz_x,
+                             alpha,
+                             x_val,
+                             x_ind,
+                             nnz_y,
+                             y_val,
+                             y_ind,
+                             z_val,
+                             z_ind,
+                             idx_base,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_spaxpy(rocsparse_handle                handle,
+                                  rocsparse_int                   nnz_x,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_double_complex* x_val,
+                                  const rocsparse_int*            x_ind,
+                                  rocsparse_int                   nnz_y,
+                                  const rocsparse_double_complex* y_val,
+                                  const rocsparse_int*            y_ind,
+                                  rocsparse_double_complex*       z_val,
+                                  rocsparse_int*                  z_ind,
+                                  rocsparse_index_base            idx_base,
+                                  void*                           temp_buffer)
+{
+    return rocsparse_zspaxpy(handle,
+                             nnz_x,
+                             alpha,
+                             x_val,
+                             x_ind,
+                             nnz_y,
+                             y_val,
+                             y_ind,
+                             z_val,
+                             z_ind,
+                             idx_base,
+                             temp_buffer);
+}
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -1084,6 +1254,419 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle                handle,
                             y);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_csrmv_alg       alg,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const float*              x,
+                                    const float*              beta,
+                                    float*                    y)
+{
+    return rocsparse_scsrmv_ex(handle,
+                               trans,
+                               alg,
+                               m,
+                               n,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_csrmv_alg       alg,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const double*             x,
+                                    const double*             beta,
+                                    double*                   y)
+{
+    return rocsparse_dcsrmv_ex(handle,
+                               trans,
+                               alg,
+                               m,
+                               n,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_ex(rocsparse_handle               handle,
+                                    rocsparse_operation            trans,
+                                    rocsparse_csrmv_alg            alg,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_float_complex* x,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       y)
+{
+    return rocsparse_ccsrmv_ex(handle,
+                               trans,
+                               alg,
+                               m,
+                               n,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_ex(rocsparse_handle                handle,
+                                    rocsparse_operation             trans,
+                                    rocsparse_csrmv_alg             alg,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_double_complex* x,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       y)
+{
+    return rocsparse_zcsrmv_ex(handle,
+                               trans,
+                               alg,
+                               m,
+                               n,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+// csrmspv
+template <>
+rocsparse_status rocsparse_csrmspv_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_scsrmspv_buffer_size(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_dcsrmspv_buffer_size(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               size_t*                        buffer_size)
+{
+    return rocsparse_ccsrmspv_buffer_size(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               size_t*                         buffer_size)
+{
+    return rocsparse_zcsrmspv_buffer_size(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_scsrmspv_analysis(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_dcsrmspv_analysis(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_analysis(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  n,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_mat_info             info,
+                                            void*                          temp_buffer)
+{
+    return rocsparse_ccsrmspv_analysis(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv_analysis(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   n,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_mat_info              info,
+                                            void*                           temp_buffer)
+{
+    return rocsparse_zcsrmspv_analysis(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_int             nnz_x,
+                                   const float*              x_val,
+                                   const rocsparse_int*      x_ind,
+                                   const float*              beta,
+                                   float*                    y,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_scsrmspv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              nnz_x,
+                              x_val,
+                              x_ind,
+                              beta,
+                              y,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_int             nnz_x,
+                                   const double*             x_val,
+                                   const rocsparse_int*      x_ind,
+                                   const double*             beta,
+                                   double*                   y,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dcsrmspv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              nnz_x,
+                              x_val,
+                              x_ind,
+                              beta,
+                              y,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv(rocsparse_handle               handle,
+                                   rocsparse_operation            trans,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_mat_info             info,
+                                   rocsparse_int                  nnz_x,
+                                   const rocsparse_float_complex* x_val,
+                                   const rocsparse_int*           x_ind,
+                                   const rocsparse_float_complex* beta,
+                                   rocsparse_float_complex*       y,
+                                   void*                          temp_buffer)
+{
+    return rocsparse_ccsrmspv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              nnz_x,
+                              x_val,
+                              x_ind,
+                              beta,
+                              y,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrmspv(rocsparse_handle                handle,
+                                   rocsparse_operation             trans,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_mat_info              info,
+                                   rocsparse_int                   nnz_x,
+                                   const rocsparse_double_complex* x_val,
+                                   const rocsparse_int*            x_ind,
+                                   const rocsparse_double_complex* beta,
+                                   rocsparse_double_complex*       y,
+                                   void*                           temp_buffer)
+{
+    return rocsparse_zcsrmspv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              nnz_x,
+                              x_val,
+                              x_ind,
+                              beta,
+                              y,
+                              temp_buffer);
+}
+
 // csrsv
 template <>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
@@ -1462,18 +2045,300 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle                handle,
         handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
 
-// hybmv
+// sellcmv
 template <>
-rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
-                                 rocsparse_operation       trans,
-                                 const float*              alpha,
-                                 const rocsparse_mat_descr descr,
-                                 const rocsparse_hyb_mat   hyb,
-                                 const float*              x,
-                                 const float*              beta,
-                                 float*                    y)
-{
-    return rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+rocsparse_status rocsparse_sellcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              sell_val,
+                                   const rocsparse_int*      sell_slice_ptr,
+                                   const rocsparse_int*      sell_col_ind,
+                                   const rocsparse_int*      sell_perm,
+                                   rocsparse_int             sell_slice_size,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y)
+{
+    return rocsparse_ssellcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              alpha,
+                              descr,
+                              sell_val,
+                              sell_slice_ptr,
+                              sell_col_ind,
+                              sell_perm,
+                              sell_slice_size,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             sell_val,
+                                   const rocsparse_int*      sell_slice_ptr,
+                                   const rocsparse_int*      sell_col_ind,
+                                   const rocsparse_int*      sell_perm,
+                                   rocsparse_int             sell_slice_size,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y)
+{
+    return rocsparse_dsellcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              alpha,
+                              descr,
+                              sell_val,
+                              sell_slice_ptr,
+                              sell_col_ind,
+                              sell_perm,
+                              sell_slice_size,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle               handle,
+                                   rocsparse_operation            trans,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* sell_val,
+                                   const rocsparse_int*           sell_slice_ptr,
+                                   const rocsparse_int*           sell_col_ind,
+                                   const rocsparse_int*           sell_perm,
+                                   rocsparse_int                  sell_slice_size,
+                                   const rocsparse_float_complex* x,
+                                   const rocsparse_float_complex* beta,
+                                   rocsparse_float_complex*       y)
+{
+    return rocsparse_csellcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              alpha,
+                              descr,
+                              sell_val,
+                              sell_slice_ptr,
+                              sell_col_ind,
+                              sell_perm,
+                              sell_slice_size,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle                handle,
+                                   rocsparse_operation             trans,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* sell_val,
+                                   const rocsparse_int*            sell_slice_ptr,
+                                   const rocsparse_int*            sell_col_ind,
+                                   const rocsparse_int*            sell_perm,
+                                   rocsparse_int                   sell_slice_size,
+                                   const rocsparse_double_complex* x,
+                                   const rocsparse_double_complex* beta,
+                                   rocsparse_double_complex*       y)
+{
+    return rocsparse_zsellcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              alpha,
+                              descr,
+                              sell_val,
+                              sell_slice_ptr,
+                              sell_col_ind,
+                              sell_perm,
+                              sell_slice_size,
+                              x,
+                              beta,
+                              y);
+}
+
+// csrdeltamv
+template <>
+rocsparse_status rocsparse_csrdeltamv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const float*              alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int             block_dim,
+                                      const rocsparse_int*      csrdelta_block_ptr,
+                                      const rocsparse_int*      csrdelta_width,
+                                      const rocsparse_int*      csrdelta_row_col,
+                                      const rocsparse_int*      csrdelta_col_ind,
+                                      const float*              x,
+                                      const float*              beta,
+                                      float*                    y)
+{
+    return rocsparse_scsrdeltamv(handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 nnz,
+                                 alpha,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 block_dim,
+                                 csrdelta_block_ptr,
+                                 csrdelta_width,
+                                 csrdelta_row_col,
+                                 csrdelta_col_ind,
+                                 x,
+                                 beta,
+                                 y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdeltamv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const double*             alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int             block_dim,
+                                      const rocsparse_int*      csrdelta_block_ptr,
+                                      const rocsparse_int*      csrdelta_width,
+                                      const rocsparse_int*      csrdelta_row_col,
+                                      const rocsparse_int*      csrdelta_col_ind,
+                                      const double*             x,
+                                      const double*             beta,
+                                      double*                   y)
+{
+    return rocsparse_dcsrdeltamv(handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 nnz,
+                                 alpha,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 block_dim,
+                                 csrdelta_block_ptr,
+                                 csrdelta_width,
+                                 csrdelta_row_col,
+                                 csrdelta_col_ind,
+                                 x,
+                                 beta,
+                                 y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdeltamv(rocsparse_handle               handle,
+                                      rocsparse_operation            trans,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      rocsparse_int                  nnz,
+                                      const rocsparse_float_complex* alpha,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      rocsparse_int                  block_dim,
+                                      const rocsparse_int*           csrdelta_block_ptr,
+                                      const rocsparse_int*           csrdelta_width,
+                                      const rocsparse_int*           csrdelta_row_col,
+                                      const rocsparse_int*           csrdelta_col_ind,
+                                      const rocsparse_float_complex* x,
+                                      const rocsparse_float_complex* beta,
+                                      rocsparse_float_complex*       y)
+{
+    return rocsparse_ccsrdeltamv(handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 nnz,
+                                 alpha,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 block_dim,
+                                 csrdelta_block_ptr,
+                                 csrdelta_width,
+                                 csrdelta_row_col,
+                                 csrdelta_col_ind,
+                                 x,
+                                 beta,
+                                 y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdeltamv(rocsparse_handle                handle,
+                                      rocsparse_operation             trans,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      rocsparse_int                   nnz,
+                                      const rocsparse_double_complex* alpha,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int                   block_dim,
+                                      const rocsparse_int*            csrdelta_block_ptr,
+                                      const rocsparse_int*            csrdelta_width,
+                                      const rocsparse_int*            csrdelta_row_col,
+                                      const rocsparse_int*            csrdelta_col_ind,
+                                      const rocsparse_double_complex* x,
+                                      const rocsparse_double_complex* beta,
+                                      rocsparse_double_complex*       y)
+{
+    return rocsparse_zcsrdeltamv(handle,
+                                 trans,
+                                 m,
+                                 n,
+                                 nnz,
+                                 alpha,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 block_dim,
+                                 csrdelta_block_ptr,
+                                 csrdelta_width,
+                                 csrdelta_row_col,
+                                 csrdelta_col_ind,
+                                 x,
+                                 beta,
+                                 y);
+}
+
+// hybmv
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 const float*              alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_hyb_mat   hyb,
+                                 const float*              x,
+                                 const float*              beta,
+                                 float*                    y)
+{
+    return rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y);
 }
 
 template <>
@@ -2193,92 +3058,541 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer)
 {
-    return rocsparse_dcsrsm_solve(handle,
+    return rocsparse_dcsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle               handle,
+                                       rocsparse_operation            trans_A,
+                                       rocsparse_operation            trans_B,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  nrhs,
+                                       rocsparse_int                  nnz,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr      descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int*           csr_row_ptr,
+                                       const rocsparse_int*           csr_col_ind,
+                                       rocsparse_float_complex*       B,
+                                       rocsparse_int                  ldb,
+                                       rocsparse_mat_info             info,
+                                       rocsparse_solve_policy         policy,
+                                       void*                          temp_buffer)
+{
+    return rocsparse_ccsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle                handle,
+                                       rocsparse_operation             trans_A,
+                                       rocsparse_operation             trans_B,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   nrhs,
+                                       rocsparse_int                   nnz,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr       descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int*            csr_row_ptr,
+                                       const rocsparse_int*            csr_col_ind,
+                                       rocsparse_double_complex*       B,
+                                       rocsparse_int                   ldb,
+                                       rocsparse_mat_info              info,
+                                       rocsparse_solve_policy          policy,
+                                       void*                           temp_buffer)
+{
+    return rocsparse_zcsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+// bsrsm
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_X,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             size_t*                   buffer_size)
+{
+    return rocsparse_sbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_X,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_X,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             size_t*                   buffer_size)
+{
+    return rocsparse_dbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_X,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_operation            trans_X,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nrhs,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             rocsparse_mat_info             info,
+                                             size_t*                        buffer_size)
+{
+    return rocsparse_cbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_X,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_operation             trans_X,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nrhs,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             rocsparse_mat_info              info,
+                                             size_t*                         buffer_size)
+{
+    return rocsparse_zbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_X,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_X,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnzb,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_sbsrsm_analysis(handle,
+                                     dir,
+                                     trans_A,
+                                     trans_X,
+                                     mb,
+                                     nrhs,
+                                     nnzb,
+                                     descr,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_X,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnzb,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_dbsrsm_analysis(handle,
+                                     dir,
+                                     trans_A,
+                                     trans_X,
+                                     mb,
+                                     nrhs,
+                                     nnzb,
+                                     descr,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle               handle,
+                                          rocsparse_direction            dir,
+                                          rocsparse_operation            trans_A,
+                                          rocsparse_operation            trans_X,
+                                          rocsparse_int                  mb,
+                                          rocsparse_int                  nrhs,
+                                          rocsparse_int                  nnzb,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* bsr_val,
+                                          const rocsparse_int*           bsr_row_ptr,
+                                          const rocsparse_int*           bsr_col_ind,
+                                          rocsparse_int                  block_dim,
+                                          rocsparse_mat_info             info,
+                                          rocsparse_analysis_policy      analysis,
+                                          rocsparse_solve_policy         solve,
+                                          void*                          temp_buffer)
+{
+    return rocsparse_cbsrsm_analysis(handle,
+                                     dir,
+                                     trans_A,
+                                     trans_X,
+                                     mb,
+                                     nrhs,
+                                     nnzb,
+                                     descr,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle                handle,
+                                          rocsparse_direction             dir,
+                                          rocsparse_operation             trans_A,
+                                          rocsparse_operation             trans_X,
+                                          rocsparse_int                   mb,
+                                          rocsparse_int                   nrhs,
+                                          rocsparse_int                   nnzb,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* bsr_val,
+                                          const rocsparse_int*            bsr_row_ptr,
+                                          const rocsparse_int*            bsr_col_ind,
+                                          rocsparse_int                   block_dim,
+                                          rocsparse_mat_info              info,
+                                          rocsparse_analysis_policy       analysis,
+                                          rocsparse_solve_policy          solve,
+                                          void*                           temp_buffer)
+{
+    return rocsparse_zbsrsm_analysis(handle,
+                                     dir,
+                                     trans_A,
+                                     trans_X,
+                                     mb,
+                                     nrhs,
+                                     nnzb,
+                                     descr,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_X,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnzb,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_mat_info        info,
+                                       const float*              B,
+                                       rocsparse_int             ldb,
+                                       float*                    X,
+                                       rocsparse_int             ldx,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_sbsrsm_solve(handle,
+                                  dir,
+                                  trans_A,
+                                  trans_X,
+                                  mb,
+                                  nrhs,
+                                  nnzb,
+                                  alpha,
+                                  descr,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
+                                  info,
+                                  B,
+                                  ldb,
+                                  X,
+                                  ldx,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_X,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnzb,
+                                       const double*             alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_mat_info        info,
+                                       const double*             B,
+                                       rocsparse_int             ldb,
+                                       double*                   X,
+                                       rocsparse_int             ldx,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_dbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
-                                  trans_B,
-                                  m,
+                                  trans_X,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
+                                  info,
                                   B,
                                   ldb,
-                                  info,
+                                  X,
+                                  ldx,
                                   policy,
                                   temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle               handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle               handle,
+                                       rocsparse_direction            dir,
                                        rocsparse_operation            trans_A,
-                                       rocsparse_operation            trans_B,
-                                       rocsparse_int                  m,
+                                       rocsparse_operation            trans_X,
+                                       rocsparse_int                  mb,
                                        rocsparse_int                  nrhs,
-                                       rocsparse_int                  nnz,
+                                       rocsparse_int                  nnzb,
                                        const rocsparse_float_complex* alpha,
                                        const rocsparse_mat_descr      descr,
-                                       const rocsparse_float_complex* csr_val,
-                                       const rocsparse_int*           csr_row_ptr,
-                                       const rocsparse_int*           csr_col_ind,
-                                       rocsparse_float_complex*       B,
-                                       rocsparse_int                  ldb,
+                                       const rocsparse_float_complex* bsr_val,
+                                       const rocsparse_int*           bsr_row_ptr,
+                                       const rocsparse_int*           bsr_col_ind,
+                                       rocsparse_int                  block_dim,
                                        rocsparse_mat_info             info,
+                                       const rocsparse_float_complex* B,
+                                       rocsparse_int                  ldb,
+                                       rocsparse_float_complex*       X,
+                                       rocsparse_int                  ldx,
                                        rocsparse_solve_policy         policy,
                                        void*                          temp_buffer)
 {
-    return rocsparse_ccsrsm_solve(handle,
+    return rocsparse_cbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
-                                  trans_B,
-                                  m,
+                                  trans_X,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
+                                  info,
                                   B,
                                   ldb,
-                                  info,
+                                  X,
+                                  ldx,
                                   policy,
                                   temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle                handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle                handle,
+                                       rocsparse_direction             dir,
                                        rocsparse_operation             trans_A,
-                                       rocsparse_operation             trans_B,
-                                       rocsparse_int                   m,
+                                       rocsparse_operation             trans_X,
+                                       rocsparse_int                   mb,
                                        rocsparse_int                   nrhs,
-                                       rocsparse_int                   nnz,
+                                       rocsparse_int                   nnzb,
                                        const rocsparse_double_complex* alpha,
                                        const rocsparse_mat_descr       descr,
-                                       const rocsparse_double_complex* csr_val,
-                                       const rocsparse_int*            csr_row_ptr,
-                                       const rocsparse_int*            csr_col_ind,
-                                       rocsparse_double_complex*       B,
-                                       rocsparse_int                   ldb,
+                                       const rocsparse_double_complex* bsr_val,
+                                       const rocsparse_int*            bsr_row_ptr,
+                                       const rocsparse_int*            bsr_col_ind,
+                                       rocsparse_int                   block_dim,
                                        rocsparse_mat_info              info,
+                                       const rocsparse_double_complex* B,
+                                       rocsparse_int                   ldb,
+                                       rocsparse_double_complex*       X,
+                                       rocsparse_int                   ldx,
                                        rocsparse_solve_policy          policy,
                                        void*                           temp_buffer)
 {
-    return rocsparse_zcsrsm_solve(handle,
+    return rocsparse_zbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
-                                  trans_B,
-                                  m,
+                                  trans_X,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
+                                  info,
                                   B,
                                   ldb,
-                                  info,
+                                  X,
+                                  ldx,
                                   policy,
                                   temp_buffer);
 }
@@ -2436,6 +3750,159 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle                handle,
                             ldc);
 }
 
+// csrsddmm
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const float*              alpha,
+                                    const float*              A,
+                                    rocsparse_int             lda,
+                                    const float*              B,
+                                    rocsparse_int             ldb,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind)
+{
+    return rocsparse_scsrsddmm(handle,
+                               trans_A,
+                               trans_B,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const double*             alpha,
+                                    const double*             A,
+                                    rocsparse_int             lda,
+                                    const double*             B,
+                                    rocsparse_int             ldb,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind)
+{
+    return rocsparse_dcsrsddmm(handle,
+                               trans_A,
+                               trans_B,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle               handle,
+                                    rocsparse_operation            trans_A,
+                                    rocsparse_operation            trans_B,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_float_complex* A,
+                                    rocsparse_int                  lda,
+                                    const rocsparse_float_complex* B,
+                                    rocsparse_int                  ldb,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr,
+                                    rocsparse_float_complex*       csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind)
+{
+    return rocsparse_ccsrsddmm(handle,
+                               trans_A,
+                               trans_B,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle                handle,
+                                    rocsparse_operation             trans_A,
+                                    rocsparse_operation             trans_B,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_double_complex* A,
+                                    rocsparse_int                   lda,
+                                    const rocsparse_double_complex* B,
+                                    rocsparse_int                   ldb,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr,
+                                    rocsparse_double_complex*       csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_zcsrsddmm(handle,
+                               trans_A,
+                               trans_B,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -3051,6 +4518,262 @@ rocsparse_status rocsparse_csrgemm(rocsparse_handle                handle,
                               temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrgemm_numeric(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const float*              csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const float*              csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const float*              beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const float*              csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           rocsparse_int             nnz_C,
+                                           float*                    csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           const rocsparse_int*      csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_scsrgemm_numeric(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      nnz_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_numeric(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const double*             csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const double*             csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const double*             beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const double*             csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           rocsparse_int             nnz_C,
+                                           double*                   csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           const rocsparse_int*      csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dcsrgemm_numeric(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      nnz_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_numeric(rocsparse_handle               handle,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_B,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  n,
+                                           rocsparse_int                  k,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr_A,
+                                           rocsparse_int                  nnz_A,
+                                           const rocsparse_float_complex* csr_val_A,
+                                           const rocsparse_int*           csr_row_ptr_A,
+                                           const rocsparse_int*           csr_col_ind_A,
+                                           const rocsparse_mat_descr      descr_B,
+                                           rocsparse_int                  nnz_B,
+                                           const rocsparse_float_complex* csr_val_B,
+                                           const rocsparse_int*           csr_row_ptr_B,
+                                           const rocsparse_int*           csr_col_ind_B,
+                                           const rocsparse_float_complex* beta,
+                                           const rocsparse_mat_descr      descr_D,
+                                           rocsparse_int                  nnz_D,
+                                           const rocsparse_float_complex* csr_val_D,
+                                           const rocsparse_int*           csr_row_ptr_D,
+                                           const rocsparse_int*           csr_col_ind_D,
+                                           const rocsparse_mat_descr      descr_C,
+                                           rocsparse_int                  nnz_C,
+                                           rocsparse_float_complex*       csr_val_C,
+                                           const rocsparse_int*           csr_row_ptr_C,
+                                           const rocsparse_int*           csr_col_ind_C,
+                                           const rocsparse_mat_info       info_C,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_ccsrgemm_numeric(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      nnz_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_numeric(rocsparse_handle                handle,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_B,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   n,
+                                           rocsparse_int                   k,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr_A,
+                                           rocsparse_int                   nnz_A,
+                                           const rocsparse_double_complex* csr_val_A,
+                                           const rocsparse_int*            csr_row_ptr_A,
+                                           const rocsparse_int*            csr_col_ind_A,
+                                           const rocsparse_mat_descr       descr_B,
+                                           rocsparse_int                   nnz_B,
+                                           const rocsparse_double_complex* csr_val_B,
+                                           const rocsparse_int*            csr_row_ptr_B,
+                                           const rocsparse_int*            csr_col_ind_B,
+                                           const rocsparse_double_complex* beta,
+                                           const rocsparse_mat_descr       descr_D,
+                                           rocsparse_int                   nnz_D,
+                                           const rocsparse_double_complex* csr_val_D,
+                                           const rocsparse_int*            csr_row_ptr_D,
+                                           const rocsparse_int*            csr_col_ind_D,
+                                           const rocsparse_mat_descr       descr_C,
+                                           rocsparse_int                   nnz_C,
+                                           rocsparse_double_complex*       csr_val_C,
+                                           const rocsparse_int*            csr_row_ptr_C,
+                                           const rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info        info_C,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zcsrgemm_numeric(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      nnz_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -5491,6 +7214,321 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle                handle,
                               partition_type);
 }
 
+// csr2hyb_ex
+template <>
+rocsparse_status rocsparse_csr2hyb_ex(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_hyb_mat         hyb,
+                                      rocsparse_hyb_partition   partition_type,
+                                      rocsparse_int             ell_width,
+                                      rocsparse_int             coo_nnz,
+                                      rocsparse_int*            ell_col_ind,
+                                      float*                    ell_val,
+                                      rocsparse_int*            coo_row_ind,
+                                      rocsparse_int*            coo_col_ind,
+                                      float*                    coo_val,
+                                      void*                     temp_buffer)
+{
+    return rocsparse_scsr2hyb_ex(handle,
+                                 m,
+                                 n,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 csr_col_ind,
+                                 hyb,
+                                 partition_type,
+                                 ell_width,
+                                 coo_nnz,
+                                 ell_col_ind,
+                                 ell_val,
+                                 coo_row_ind,
+                                 coo_col_ind,
+                                 coo_val,
+                                 temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_ex(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_hyb_mat         hyb,
+                                      rocsparse_hyb_partition   partition_type,
+                                      rocsparse_int             ell_width,
+                                      rocsparse_int             coo_nnz,
+                                      rocsparse_int*            ell_col_ind,
+                                      double*                   ell_val,
+                                      rocsparse_int*            coo_row_ind,
+                                      rocsparse_int*            coo_col_ind,
+                                      double*                   coo_val,
+                                      void*                     temp_buffer)
+{
+    return rocsparse_dcsr2hyb_ex(handle,
+                                 m,
+                                 n,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 csr_col_ind,
+                                 hyb,
+                                 partition_type,
+                                 ell_width,
+                                 coo_nnz,
+                                 ell_col_ind,
+                                 ell_val,
+                                 coo_row_ind,
+                                 coo_col_ind,
+                                 coo_val,
+                                 temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_ex(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      const rocsparse_int*           csr_col_ind,
+                                      rocsparse_hyb_mat              hyb,
+                                      rocsparse_hyb_partition        partition_type,
+                                      rocsparse_int                  ell_width,
+                                      rocsparse_int                  coo_nnz,
+                                      rocsparse_int*                 ell_col_ind,
+                                      rocsparse_float_complex*       ell_val,
+                                      rocsparse_int*                 coo_row_ind,
+                                      rocsparse_int*                 coo_col_ind,
+                                      rocsparse_float_complex*       coo_val,
+                                      void*                          temp_buffer)
+{
+    return rocsparse_ccsr2hyb_ex(handle,
+                                 m,
+                                 n,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 csr_col_ind,
+                                 hyb,
+                                 partition_type,
+                                 ell_width,
+                                 coo_nnz,
+                                 ell_col_ind,
+                                 ell_val,
+                                 coo_row_ind,
+                                 coo_col_ind,
+                                 coo_val,
+                                 temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_ex(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      const rocsparse_int*            csr_col_ind,
+                                      rocsparse_hyb_mat               hyb,
+                                      rocsparse_hyb_partition         partition_type,
+                                      rocsparse_int                   ell_width,
+                                      rocsparse_int                   coo_nnz,
+                                      rocsparse_int*                  ell_col_ind,
+                                      rocsparse_double_complex*       ell_val,
+                                      rocsparse_int*                  coo_row_ind,
+                                      rocsparse_int*                  coo_col_ind,
+                                      rocsparse_double_complex*       coo_val,
+                                      void*                           temp_buffer)
+{
+    return rocsparse_zcsr2hyb_ex(handle,
+                                 m,
+                                 n,
+                                 descr,
+                                 csr_val,
+                                 csr_row_ptr,
+                                 csr_col_ind,
+                                 hyb,
+                                 partition_type,
+                                 ell_width,
+                                 coo_nnz,
+                                 ell_col_ind,
+                                 ell_val,
+                                 coo_row_ind,
+                                 coo_col_ind,
+                                 coo_val,
+                                 temp_buffer);
+}
+
+// csr2hyb_values
+template <>
+rocsparse_status rocsparse_csr2hyb_values(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          const float*         csr_val,
+                                          const rocsparse_int* hyb_map,
+                                          rocsparse_hyb_mat    hyb)
+{
+    return rocsparse_scsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_values(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          const double*        csr_val,
+                                          const rocsparse_int* hyb_map,
+                                          rocsparse_hyb_mat    hyb)
+{
+    return rocsparse_dcsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_values(rocsparse_handle               handle,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           hyb_map,
+                                          rocsparse_hyb_mat              hyb)
+{
+    return rocsparse_ccsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_values(rocsparse_handle                handle,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            hyb_map,
+                                          rocsparse_hyb_mat               hyb)
+{
+    return rocsparse_zcsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+// csr2sellc
+template <>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_perm,
+                                     float*                    sell_val,
+                                     rocsparse_int*            sell_col_ind)
+{
+    return rocsparse_scsr2sellc(handle,
+                                m,
+                                n,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_slice_ptr,
+                                sell_perm,
+                                sell_val,
+                                sell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_perm,
+                                     double*                   sell_val,
+                                     rocsparse_int*            sell_col_ind)
+{
+    return rocsparse_dcsr2sellc(handle,
+                                m,
+                                n,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_slice_ptr,
+                                sell_perm,
+                                sell_val,
+                                sell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     const rocsparse_mat_descr      csr_descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     const rocsparse_mat_descr      sell_descr,
+                                     rocsparse_int                  sell_slice_size,
+                                     const rocsparse_int*           sell_slice_ptr,
+                                     const rocsparse_int*           sell_perm,
+                                     rocsparse_float_complex*       sell_val,
+                                     rocsparse_int*                 sell_col_ind)
+{
+    return rocsparse_ccsr2sellc(handle,
+                                m,
+                                n,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_slice_ptr,
+                                sell_perm,
+                                sell_val,
+                                sell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     const rocsparse_mat_descr       csr_descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const rocsparse_mat_descr       sell_descr,
+                                     rocsparse_int                   sell_slice_size,
+                                     const rocsparse_int*            sell_slice_ptr,
+                                     const rocsparse_int*            sell_perm,
+                                     rocsparse_double_complex*       sell_val,
+                                     rocsparse_int*                  sell_col_ind)
+{
+    return rocsparse_zcsr2sellc(handle,
+                                m,
+                                n,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_slice_ptr,
+                                sell_perm,
+                                sell_val,
+                                sell_col_ind);
+}
+
 // csr2bsr
 template <>
 rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
@@ -5959,6 +7997,127 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle                handle,
                               csr_col_ind);
 }
 
+// sellc2csr
+template <>
+rocsparse_status rocsparse_sellc2csr(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const float*              sell_val,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_col_ind,
+                                     const rocsparse_int*      sell_perm,
+                                     const rocsparse_mat_descr csr_descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_ssellc2csr(handle,
+                                m,
+                                n,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_val,
+                                sell_slice_ptr,
+                                sell_col_ind,
+                                sell_perm,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_sellc2csr(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const double*             sell_val,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_col_ind,
+                                     const rocsparse_int*      sell_perm,
+                                     const rocsparse_mat_descr csr_descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_dsellc2csr(handle,
+                                m,
+                                n,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_val,
+                                sell_slice_ptr,
+                                sell_col_ind,
+                                sell_perm,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_sellc2csr(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     const rocsparse_mat_descr      sell_descr,
+                                     rocsparse_int                  sell_slice_size,
+                                     const rocsparse_float_complex* sell_val,
+                                     const rocsparse_int*           sell_slice_ptr,
+                                     const rocsparse_int*           sell_col_ind,
+                                     const rocsparse_int*           sell_perm,
+                                     const rocsparse_mat_descr      csr_descr,
+                                     rocsparse_float_complex*       csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     rocsparse_int*                 csr_col_ind)
+{
+    return rocsparse_csellc2csr(handle,
+                                m,
+                                n,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_val,
+                                sell_slice_ptr,
+                                sell_col_ind,
+                                sell_perm,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_sellc2csr(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     const rocsparse_mat_descr       sell_descr,
+                                     rocsparse_int                   sell_slice_size,
+                                     const rocsparse_double_complex* sell_val,
+                                     const rocsparse_int*            sell_slice_ptr,
+                                     const rocsparse_int*            sell_col_ind,
+                                     const rocsparse_int*            sell_perm,
+                                     const rocsparse_mat_descr       csr_descr,
+                                     rocsparse_double_complex*       csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     rocsparse_int*                  csr_col_ind)
+{
+    return rocsparse_zsellc2csr(handle,
+                                m,
+                                n,
+                                sell_descr,
+                                sell_slice_size,
+                                sell_val,
+                                sell_slice_ptr,
+                                sell_col_ind,
+                                sell_perm,
+                                csr_descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+}
+
 // hyb2csr
 template <>
 rocsparse_status rocsparse_hyb2csr(rocsparse_handle          handle,
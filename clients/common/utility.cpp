@@ -26,6 +26,7 @@
 #include "rocsparse_random.hpp"
 
 #include <cstdlib>
+#include <iomanip>
 #include <sys/time.h>
 
 // Random number generator
@@ -74,3 +75,128 @@ double get_time_us_sync(hipStream_t stream)
     gettimeofday(&tv, NULL);
     return (tv.tv_sec * 1000 * 1000) + tv.tv_usec;
 };
+
+/* ============================================================================================ */
+/*  phase timer:*/
+
+rocsparse_phase_timer::rocsparse_phase_timer(rocsparse_timing_mode timing_mode)
+    : mode(timing_mode)
+    , flush_buffer(nullptr)
+    , flush_size(0)
+    , flush_count(0)
+    , mark(0.0)
+    , paused(0.0)
+{
+    if(this->mode == rocsparse_timing_cold)
+    {
+        int dev;
+        hipGetDevice(&dev);
+
+        hipDeviceProp_t prop;
+        hipGetDeviceProperties(&prop, dev);
+
+        // Twice the reported L2 cache, but at least 256 MiB to also cover memory side
+        // caches that are not reported in the device properties
+        this->flush_size = std::max(static_cast<size_t>(prop.l2CacheSize) * 2, size_t(256) << 20);
+
+        if(hipMalloc(&this->flush_buffer, this->flush_size) != hipSuccess)
+        {
+            std::cerr << "Warning: cannot allocate cache flush buffer, timing with warm cache"
+                      << std::endl;
+            this->flush_buffer = nullptr;
+        }
+    }
+}
+
+rocsparse_phase_timer::~rocsparse_phase_timer()
+{
+    if(this->flush_buffer != nullptr)
+    {
+        hipFree(this->flush_buffer);
+    }
+}
+
+void rocsparse_phase_timer::start()
+{
+    if(this->flush_buffer != nullptr)
+    {
+        // Alternate the pattern, such that each flush writes every cache line
+        hipMemset(this->flush_buffer, ++this->flush_count & 0xff, this->flush_size);
+    }
+
+    this->mark = get_time_us();
+}
+
+void rocsparse_phase_timer::lap(const char* phase)
+{
+    double now = get_time_us();
+
+    size_t i = 0;
+    while(i < this->names.size() && this->names[i] != phase)
+    {
+        ++i;
+    }
+
+    if(i == this->names.size())
+    {
+        this->names.push_back(phase);
+        this->times.push_back(0.0);
+    }
+
+    this->times[i] += now - this->mark;
+    this->mark = now;
+}
+
+void rocsparse_phase_timer::pause()
+{
+    this->paused = get_time_us();
+}
+
+void rocsparse_phase_timer::resume()
+{
+    this->mark += get_time_us() - this->paused;
+}
+
+double rocsparse_phase_timer::total() const
+{
+    double t = 0.0;
+    for(double time : this->times)
+    {
+        t += time;
+    }
+
+    return t;
+}
+
+std::string rocsparse_phase_timer::header() const
+{
+    std::ostringstream out;
+
+    if(this->mode != rocsparse_timing_hot)
+    {
+        out << std::left << std::setw(12) << "mode";
+        for(const std::string& name : this->names)
+        {
+            out << std::setw(16) << name + "_msec";
+        }
+    }
+
+    return out.str();
+}
+
+std::string rocsparse_phase_timer::phases(int calls) const
+{
+    std::ostringstream out;
+
+    if(this->mode != rocsparse_timing_hot)
+    {
+        out.precision(3);
+        out << std::fixed << std::left << std::setw(12) << rocsparse_timingmode2string(this->mode);
+        for(double time : this->times)
+        {
+            out << std::setw(16) << time / calls / 1e3;
+        }
+    }
+
+    return out.str();
+}
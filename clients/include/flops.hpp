@@ -57,6 +57,18 @@ constexpr double roti_gflop_count(rocsparse_int nnz)
     return (6.0 * nnz) / 1e9;
 }
 
+template <typename T>
+constexpr double spdot_gflop_count(rocsparse_int nnz_x)
+{
+    return (2.0 * nnz_x) / 1e9;
+}
+
+template <typename T>
+constexpr double spaxpy_gflop_count(rocsparse_int nnz_x)
+{
+    return (2.0 * nnz_x) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -96,6 +108,12 @@ constexpr double
     return (3.0 * nnz_A * N + (beta ? nnz_C : 0)) / 1e9;
 }
 
+template <typename T>
+constexpr double csrsddmm_gflop_count(rocsparse_int K, rocsparse_int nnz, bool beta = false)
+{
+    return (2.0 * K * nnz + nnz + (beta ? 2.0 * nnz : 0)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -74,6 +74,19 @@ constexpr double sctr_gbyte_count(rocsparse_int nnz)
     return (nnz * sizeof(rocsparse_int) + (2.0 * nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double spdot_gbyte_count(rocsparse_int nnz_x, rocsparse_int nnz_y)
+{
+    return ((nnz_x + nnz_y) * sizeof(rocsparse_int) + (nnz_x + nnz_y) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double spaxpy_gbyte_count(rocsparse_int nnz_x, rocsparse_int nnz_y, rocsparse_int nnz_z)
+{
+    return ((nnz_x + nnz_y + nnz_z) * sizeof(rocsparse_int) + (nnz_x + nnz_y + nnz_z) * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -92,6 +105,21 @@ constexpr double bsrmv_gbyte_count(rocsparse_int mb,
            / 1e9;
 }
 
+template <typename T>
+constexpr double gebsrmv_gbyte_count(rocsparse_int mb,
+                                     rocsparse_int nb,
+                                     rocsparse_int nnzb,
+                                     rocsparse_int row_block_dim,
+                                     rocsparse_int col_block_dim,
+                                     bool          beta = false)
+{
+    return ((mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + (mb * row_block_dim + nb * col_block_dim
+               + nnzb * row_block_dim * col_block_dim + (beta ? mb * row_block_dim : 0))
+                  * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double
     coomv_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
@@ -107,6 +135,17 @@ constexpr double
            / 1e9;
 }
 
+template <typename T>
+constexpr double csrmspv_gbyte_count(rocsparse_int len_y,
+                                     rocsparse_int nnz_x,
+                                     rocsparse_int nnz_touched,
+                                     bool          beta = false)
+{
+    return ((3.0 * nnz_x + nnz_touched) * sizeof(rocsparse_int)
+            + (nnz_x + nnz_touched + len_y + (beta ? len_y : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double bsrsv_gbyte_count(rocsparse_int mb, rocsparse_int nnzb, rocsparse_int bsr_dim)
 {
@@ -128,6 +167,29 @@ constexpr double
     return (nnz * sizeof(rocsparse_int) + (M + N + nnz + (beta ? M : 0)) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double sellcmv_gbyte_count(
+    rocsparse_int M, rocsparse_int N, rocsparse_int nnz, rocsparse_int nslices, bool beta = false)
+{
+    // Padded entries are skipped after the first one of each row
+    return ((nslices + 1.0 + M + nnz) * sizeof(rocsparse_int)
+            + (M + N + nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrdeltamv_gbyte_count(rocsparse_int M,
+                                        rocsparse_int N,
+                                        rocsparse_int nnz,
+                                        rocsparse_int nblocks,
+                                        rocsparse_int csrdelta_nnz,
+                                        bool          beta = false)
+{
+    return ((2.0 * M + 1.0 + 2.0 * nblocks + 1.0 + csrdelta_nnz) * sizeof(rocsparse_int)
+            + (M + N + nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -151,6 +213,18 @@ constexpr double bsrmm_gbyte_count(rocsparse_int Mb,
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double bsrsm_gbyte_count(rocsparse_int mb,
+                                   rocsparse_int nrhs,
+                                   rocsparse_int nnzb,
+                                   rocsparse_int bsr_dim)
+{
+    // The factor is read once for all right-hand sides
+    return ((mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + (bsr_dim * bsr_dim * nnzb + 2.0 * mb * bsr_dim * nrhs) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csrmm_gbyte_count(rocsparse_int M,
                                    rocsparse_int nnz_A,
@@ -163,6 +237,15 @@ constexpr double csrmm_gbyte_count(rocsparse_int M,
            / 1e9;
 }
 
+template <typename T>
+constexpr double csrsddmm_gbyte_count(
+    rocsparse_int M, rocsparse_int N, rocsparse_int K, rocsparse_int nnz, bool beta = false)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int)
+            + ((double)M * K + (double)K * N + nnz + (beta ? nnz : 0)) * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -344,6 +427,47 @@ constexpr double ell2csr_gbyte_count(rocsparse_int M, rocsparse_int csr_nnz, roc
     return ((M + 1.0 + ell_nnz) * sizeof(rocsparse_int) + (csr_nnz + ell_nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2sellc_gbyte_count(rocsparse_int M,
+                                       rocsparse_int nnz,
+                                       rocsparse_int sell_nnz,
+                                       rocsparse_int nslices)
+{
+    return ((2.0 * M + 1.0 + nslices + 1.0 + nnz + sell_nnz) * sizeof(rocsparse_int)
+            + (nnz + sell_nnz) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double sellc2csr_gbyte_count(rocsparse_int M,
+                                       rocsparse_int csr_nnz,
+                                       rocsparse_int nslices)
+{
+    return ((2.0 * M + 1.0 + nslices + 1.0 + 2.0 * csr_nnz) * sizeof(rocsparse_int)
+            + (2.0 * csr_nnz) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csr2csrdelta_gbyte_count(rocsparse_int M,
+                                          rocsparse_int nnz,
+                                          rocsparse_int nblocks,
+                                          rocsparse_int csrdelta_nnz)
+{
+    return (2.0 * M + 1.0 + nnz + 2.0 * nblocks + 1.0 + csrdelta_nnz) * sizeof(rocsparse_int)
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrdelta2csr_gbyte_count(rocsparse_int M,
+                                          rocsparse_int nnz,
+                                          rocsparse_int nblocks,
+                                          rocsparse_int csrdelta_nnz)
+{
+    return (2.0 * M + 1.0 + 2.0 * nblocks + 1.0 + csrdelta_nnz + nnz) * sizeof(rocsparse_int)
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csr2hyb_gbyte_count(rocsparse_int M,
                                      rocsparse_int nnz,
@@ -518,4 +642,16 @@ constexpr double coosort_gbyte_count(rocsparse_int nnz, bool permute)
     return ((4.0 * nnz + (permute ? 2.0 * nnz : 0.0)) * sizeof(rocsparse_int)) / 1e9;
 }
 
+template <typename T>
+constexpr double csr_check_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    return ((M + 1.0 + nnz) * sizeof(rocsparse_int)) / 1e9;
+}
+
+template <typename T>
+constexpr double coo_check_gbyte_count(rocsparse_int nnz)
+{
+    return (2.0 * nnz * sizeof(rocsparse_int)) / 1e9;
+}
+
 #endif // GBYTE_HPP
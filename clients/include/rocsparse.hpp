@@ -112,6 +112,33 @@ rocsparse_status rocsparse_sctr(rocsparse_handle     handle,
                                 T*                   y,
                                 rocsparse_index_base idx_base);
 
+// spdot
+template <typename T>
+rocsparse_status rocsparse_spdot(rocsparse_handle     handle,
+                                 rocsparse_int        nnz_x,
+                                 const T*             x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_int        nnz_y,
+                                 const T*             y_val,
+                                 const rocsparse_int* y_ind,
+                                 T*                   result,
+                                 rocsparse_index_base idx_base);
+
+// spaxpy
+template <typename T>
+rocsparse_status rocsparse_spaxpy(rocsparse_handle     handle,
+                                  rocsparse_int        nnz_x,
+                                  const T*             alpha,
+                                  const T*             x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        nnz_y,
+                                  const T*             y_val,
+                                  const rocsparse_int* y_ind,
+                                  T*                   z_val,
+                                  rocsparse_int*       z_ind,
+                                  rocsparse_index_base idx_base,
+                                  void*                temp_buffer);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -229,6 +256,66 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_csrmv_alg       alg,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const T*                  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const T*                  x,
+                                    const T*                  beta,
+                                    T*                        y);
+
+// csrmspv
+template <typename T>
+rocsparse_status rocsparse_csrmspv_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrmspv_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csrmspv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_int             nnz_x,
+                                   const T*                  x_val,
+                                   const rocsparse_int*      x_ind,
+                                   const T*                  beta,
+                                   T*                        y,
+                                   void*                     temp_buffer);
+
 // csrsv
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
@@ -287,6 +374,43 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+// sellcmv
+template <typename T>
+rocsparse_status rocsparse_sellcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  sell_val,
+                                   const rocsparse_int*      sell_slice_ptr,
+                                   const rocsparse_int*      sell_col_ind,
+                                   const rocsparse_int*      sell_perm,
+                                   rocsparse_int             sell_slice_size,
+                                   const T*                  x,
+                                   const T*                  beta,
+                                   T*                        y);
+
+// csrdeltamv
+template <typename T>
+rocsparse_status rocsparse_csrdeltamv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const T*                  alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const T*                  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int             block_dim,
+                                      const rocsparse_int*      csrdelta_block_ptr,
+                                      const rocsparse_int*      csrdelta_width,
+                                      const rocsparse_int*      csrdelta_row_col,
+                                      const rocsparse_int*      csrdelta_col_ind,
+                                      const T*                  x,
+                                      const T*                  beta,
+                                      T*                        y);
+
 // hybmv
 template <typename T>
 rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
@@ -401,6 +525,63 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer);
 
+// bsrsm
+template <typename T>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_X,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_X,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnzb,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_X,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnzb,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_mat_info        info,
+                                       const T*                  B,
+                                       rocsparse_int             ldb,
+                                       T*                        X,
+                                       rocsparse_int             ldx,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer);
+
 // gemmi
 template <typename T>
 rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
@@ -421,6 +602,26 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
                                  T*                        C,
                                  rocsparse_int             ldc);
 
+// csrsddmm
+template <typename T>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const T*                  alpha,
+                                    const T*                  A,
+                                    rocsparse_int             lda,
+                                    const T*                  B,
+                                    rocsparse_int             ldb,
+                                    const T*                  beta,
+                                    const rocsparse_mat_descr descr,
+                                    T*                        csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind);
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -504,6 +705,38 @@ rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
                                    const rocsparse_mat_info  info_C,
                                    void*                     temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csrgemm_numeric(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const T*                  csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const T*                  csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const T*                  beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const T*                  csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           rocsparse_int             nnz_C,
+                                           T*                        csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           const rocsparse_int*      csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -919,6 +1152,50 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
                                    rocsparse_int             user_ell_width,
                                    rocsparse_hyb_partition   partition_type);
 
+// csr2hyb_ex
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_ex(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const T*                  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_hyb_mat         hyb,
+                                      rocsparse_hyb_partition   partition_type,
+                                      rocsparse_int             ell_width,
+                                      rocsparse_int             coo_nnz,
+                                      rocsparse_int*            ell_col_ind,
+                                      T*                        ell_val,
+                                      rocsparse_int*            coo_row_ind,
+                                      rocsparse_int*            coo_col_ind,
+                                      T*                        coo_val,
+                                      void*                     temp_buffer);
+
+// csr2hyb_values
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_values(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          const T*             csr_val,
+                                          const rocsparse_int* hyb_map,
+                                          rocsparse_hyb_mat    hyb);
+
+// csr2sellc
+template <typename T>
+rocsparse_status rocsparse_csr2sellc(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const T*                  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_perm,
+                                     T*                        sell_val,
+                                     rocsparse_int*            sell_col_ind);
+
 // csr2bsr
 template <typename T>
 rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
@@ -981,6 +1258,22 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
                                    const rocsparse_int*      csr_row_ptr,
                                    rocsparse_int*            csr_col_ind);
 
+// sellc2csr
+template <typename T>
+rocsparse_status rocsparse_sellc2csr(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const T*                  sell_val,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_col_ind,
+                                     const rocsparse_int*      sell_perm,
+                                     const rocsparse_mat_descr csr_descr,
+                                     T*                        csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     rocsparse_int*            csr_col_ind);
+
 // hyb2csr
 template <typename T>
 rocsparse_status rocsparse_hyb2csr(rocsparse_handle          handle,
@@ -0,0 +1,168 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_amortization.hpp provides the analysis amortization benchmark of
+ *  routines with separate buffer size, analysis, solve and clear phases.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_AMORTIZATION_HPP
+#define ROCSPARSE_AMORTIZATION_HPP
+
+#include "rocsparse_analyze.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+/*! \brief Benchmark how many solves amortize the analysis of a routine.
+ *
+ *  Times buffer_size(), analysis(policy) with rocsparse_analysis_policy_force and with
+ *  rocsparse_analysis_policy_reuse on already analyzed meta data, solve() and clear()
+ *  separately, averaged over \p iters cycles. The break-even point is the number of
+ *  solves per analysis after which the time spent in solves exceeds the time spent in
+ *  buffer size query, forced analysis and clear. The number of solves per analysis is
+ *  then swept in powers of two, measuring complete cycles, and the report includes the
+ *  level schedule depth and the level width histogram.
+ */
+template <typename BUFFER_SIZE, typename ANALYSIS, typename SOLVE, typename CLEAR>
+void rocsparse_bench_amortization(int                             iters,
+                                  const rocsparse_level_schedule& levels,
+                                  BUFFER_SIZE                     buffer_size,
+                                  ANALYSIS                        analysis,
+                                  SOLVE                           solve,
+                                  CLEAR                           clear)
+{
+    double buffer_size_time    = 0.0;
+    double analysis_force_time = 0.0;
+    double analysis_reuse_time = 0.0;
+    double solve_time          = 0.0;
+    double clear_time          = 0.0;
+
+    iters = std::max(iters, 1);
+
+    // Start without analysis meta data
+    clear();
+
+    for(int iter = 0; iter < iters; ++iter)
+    {
+        double t0 = get_time_us();
+        buffer_size();
+        double t1 = get_time_us();
+        analysis(rocsparse_analysis_policy_force);
+        double t2 = get_time_us();
+        analysis(rocsparse_analysis_policy_reuse);
+        double t3 = get_time_us();
+        solve();
+        double t4 = get_time_us();
+        clear();
+        double t5 = get_time_us();
+
+        buffer_size_time += t1 - t0;
+        analysis_force_time += t2 - t1;
+        analysis_reuse_time += t3 - t2;
+        solve_time += t4 - t3;
+        clear_time += t5 - t4;
+    }
+
+    buffer_size_time /= iters;
+    analysis_force_time /= iters;
+    analysis_reuse_time /= iters;
+    solve_time /= iters;
+    clear_time /= iters;
+
+    double setup_time = buffer_size_time + analysis_force_time + clear_time;
+    int    break_even = (solve_time > 0.0) ? static_cast<int>(std::ceil(setup_time / solve_time))
+                                           : 0;
+
+    std::cout.precision(3);
+    std::cout.setf(std::ios::fixed);
+    std::cout.setf(std::ios::left);
+
+    std::cout << std::setw(20) << "buffer_size_msec" << std::setw(20) << "analysis_force_msec"
+              << std::setw(20) << "analysis_reuse_msec" << std::setw(12) << "solve_msec"
+              << std::setw(12) << "clear_msec" << std::setw(12) << "break_even" << std::setw(12)
+              << "iter" << std::endl;
+
+    std::cout << std::setw(20) << buffer_size_time / 1e3 << std::setw(20)
+              << analysis_force_time / 1e3 << std::setw(20) << analysis_reuse_time / 1e3
+              << std::setw(12) << solve_time / 1e3 << std::setw(12) << clear_time / 1e3
+              << std::setw(12) << break_even << std::setw(12) << iters << std::endl;
+
+    // Sweep the number of solves per analysis up to at least twice the break-even point
+    int max_solves = std::min(std::max(iters, 2 * break_even), 4096);
+
+    std::cout << std::endl
+              << std::setw(12) << "solves" << std::setw(12) << "cycle_msec" << std::setw(16)
+              << "msec/solve" << std::setw(16) << "setup_fraction" << std::endl;
+
+    for(int solves = 1; solves <= max_solves; solves *= 2)
+    {
+        double cycle_time = get_time_us();
+
+        buffer_size();
+        analysis(rocsparse_analysis_policy_force);
+        for(int s = 0; s < solves; ++s)
+        {
+            solve();
+        }
+        clear();
+
+        cycle_time = get_time_us() - cycle_time;
+
+        std::cout << std::setw(12) << solves << std::setw(12) << cycle_time / 1e3
+                  << std::setw(16) << cycle_time / solves / 1e3 << std::setw(16)
+                  << std::max(0.0, 1.0 - solves * solve_time / cycle_time) << std::endl;
+    }
+
+    // Level schedule
+    std::cout << std::endl
+              << std::setw(12) << "depth" << std::setw(12) << "min_width" << std::setw(12)
+              << "max_width" << std::setw(12) << "mean_width" << std::setw(16) << "critical_path"
+              << std::setw(16) << "parallelism" << std::endl;
+
+    std::cout << std::setw(12) << levels.depth << std::setw(12) << levels.min_width
+              << std::setw(12) << levels.max_width << std::setw(12) << levels.mean_width
+              << std::setw(16) << levels.critical_path << std::setw(16) << levels.parallelism
+              << std::endl;
+
+    std::cout << std::endl
+              << std::setw(24) << "level_width" << std::setw(12) << "levels" << std::endl;
+
+    for(size_t bin = 0; bin < levels.width_histogram.size(); ++bin)
+    {
+        std::cout << std::setw(24)
+                  << ("[" + std::to_string(1ll << bin) + ", " + std::to_string(1ll << (bin + 1))
+                      + ")")
+                  << std::setw(12) << levels.width_histogram[bin] << std::endl;
+    }
+
+    // Leave analysis meta data in place for the caller
+    analysis(rocsparse_analysis_policy_force);
+}
+
+#endif // ROCSPARSE_AMORTIZATION_HPP
@@ -0,0 +1,173 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_analyze.hpp provides host side structure analysis of CSR matrices,
+ *  including a storage format recommendation based on the data transfer counts of the
+ *  corresponding matrix vector products.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_ANALYZE_HPP
+#define ROCSPARSE_ANALYZE_HPP
+
+#include <rocsparse.h>
+#include <vector>
+
+// Number of bins of the row length histogram
+#define ROCSPARSE_ANALYZE_HISTOGRAM_BINS 32
+
+typedef enum rocsparse_storage_format_
+{
+    rocsparse_storage_format_csr   = 0,
+    rocsparse_storage_format_ell   = 1,
+    rocsparse_storage_format_hyb   = 2,
+    rocsparse_storage_format_bsr   = 3,
+    rocsparse_storage_format_gebsr = 4
+} rocsparse_storage_format;
+
+constexpr auto rocsparse_storage_format2string(rocsparse_storage_format format)
+{
+    switch(format)
+    {
+    case rocsparse_storage_format_csr:
+        return "csr";
+    case rocsparse_storage_format_ell:
+        return "ell";
+    case rocsparse_storage_format_hyb:
+        return "hyb";
+    case rocsparse_storage_format_bsr:
+        return "bsr";
+    case rocsparse_storage_format_gebsr:
+        return "gebsr";
+    }
+    return "invalid";
+}
+
+// Block fill ratio of a candidate (ge)bsr block dimension
+struct rocsparse_block_fill
+{
+    rocsparse_int row_block_dim;
+    rocsparse_int col_block_dim;
+    rocsparse_int nnzb;
+    double        fill;
+    double        gbyte;
+};
+
+struct rocsparse_csr_structure
+{
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
+
+    // Row length statistics. Bin 0 of the histogram counts empty rows, bin i > 0 counts
+    // rows with [2^(i-1), 2^i) non-zero entries.
+    rocsparse_int              min_row_nnz    = 0;
+    rocsparse_int              max_row_nnz    = 0;
+    double                     mean_row_nnz   = 0.0;
+    double                     stddev_row_nnz = 0.0;
+    std::vector<rocsparse_int> row_nnz_histogram;
+
+    // Bandwidth, lower is max(i - j) and upper is max(j - i) over all entries
+    rocsparse_int lower_bandwidth = 0;
+    rocsparse_int upper_bandwidth = 0;
+
+    // Diagonal profile, diag_nnz[j - i + m - 1] holds the number of entries on the
+    // diagonal with offset j - i. diag_fill is the ratio of non-zero entries to the
+    // total length of all occupied diagonals.
+    std::vector<rocsparse_int> diag_nnz;
+    rocsparse_int              ndiag        = 0;
+    rocsparse_int              missing_diag = 0;
+    double                     diag_fill    = 0.0;
+
+    // Block fill ratios for all candidate block dimensions
+    std::vector<rocsparse_block_fill> block_fill;
+
+    // Data transfer counts of a single matrix vector product in GByte
+    rocsparse_int ell_width     = 0;
+    rocsparse_int hyb_ell_width = 0;
+    double        csr_gbyte     = 0.0;
+    double        ell_gbyte     = 0.0;
+    double        hyb_gbyte     = 0.0;
+
+    // Recommended storage format and its parameters
+    rocsparse_storage_format format        = rocsparse_storage_format_csr;
+    rocsparse_int            row_block_dim = 1;
+    rocsparse_int            col_block_dim = 1;
+    double                   gbyte         = 0.0;
+};
+
+/*! \brief Analyze the sparsity pattern of a CSR matrix on the host.
+ *
+ *  Computes row length statistics, bandwidth, diagonal profile and block fill ratios,
+ *  and recommends the storage format with the lowest data transfer of a matrix vector
+ *  product with value type \p T. ELL formats that exceed the rocsparse_int range are
+ *  not considered.
+ */
+template <typename T>
+void rocsparse_csr_analyze_structure(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     rocsparse_index_base              base,
+                                     rocsparse_csr_structure&          structure);
+
+// Level schedule of a sparse triangular solve
+struct rocsparse_level_schedule
+{
+    // Number of levels, i.e. the length of the longest dependency chain
+    rocsparse_int depth = 0;
+
+    // Level width statistics. Bin i of the histogram counts levels with
+    // [2^i, 2^(i+1)) rows.
+    rocsparse_int              min_width  = 0;
+    rocsparse_int              max_width  = 0;
+    double                     mean_width = 0.0;
+    std::vector<rocsparse_int> width_histogram;
+
+    // Accumulated work of the most expensive dependency chain, where the work of a row is
+    // one plus its number of off-diagonal entries in the triangular part, and the total
+    // work divided by the critical path
+    int64_t critical_path = 0;
+    double  parallelism   = 0.0;
+};
+
+/*! \brief Compute the level schedule of a sparse triangular solve on the host.
+ *
+ *  The triangular part of the CSR matrix selected by \p uplo is solved with operation
+ *  \p trans. Entries outside of the leading M x M triangular part and on the diagonal
+ *  are ignored, such that the level schedule of the incomplete factorizations is
+ *  obtained with rocsparse_fill_mode_lower and rocsparse_operation_none. Block sparse
+ *  matrices are analyzed by passing their block row pointer and block column indices.
+ */
+void rocsparse_csr_analyze_levels(rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  rocsparse_index_base              base,
+                                  rocsparse_fill_mode               uplo,
+                                  rocsparse_operation               trans,
+                                  rocsparse_level_schedule&         levels);
+
+#endif // ROCSPARSE_ANALYZE_HPP
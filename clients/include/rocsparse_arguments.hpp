@@ -55,6 +55,13 @@ struct Arguments
     rocsparse_int dimy;
     rocsparse_int dimz;
 
+    rocsparse_int row_nnz;
+    rocsparse_int bandwidth;
+    rocsparse_int stencil;
+
+    rocsparse_int slice_size;
+    rocsparse_int sigma;
+
     rocsparse_datatype compute_type;
 
     double alpha;
@@ -64,6 +71,12 @@ struct Arguments
     double threshold;
     double percentage;
 
+    double rmat_a;
+    double rmat_b;
+    double rmat_c;
+    double rmat_d;
+    double powerlaw_exponent;
+
     rocsparse_operation       transA;
     rocsparse_operation       transB;
     rocsparse_index_base      baseA;
@@ -72,6 +85,7 @@ struct Arguments
     rocsparse_index_base      baseD;
     rocsparse_action          action;
     rocsparse_hyb_partition   part;
+    rocsparse_matrix_type     mattype;
     rocsparse_diag_type       diag;
     rocsparse_fill_mode       uplo;
     rocsparse_analysis_policy apol;
@@ -80,9 +94,10 @@ struct Arguments
 
     rocsparse_matrix_init matrix;
 
-    rocsparse_int unit_check;
-    rocsparse_int timing;
-    rocsparse_int iters;
+    rocsparse_int         unit_check;
+    rocsparse_int         timing;
+    rocsparse_timing_mode timing_mode;
+    rocsparse_int         iters;
 
     rocsparse_int denseld;
 
@@ -147,6 +162,11 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(dimx);
         ROCSPARSE_FORMAT_CHECK(dimy);
         ROCSPARSE_FORMAT_CHECK(dimz);
+        ROCSPARSE_FORMAT_CHECK(row_nnz);
+        ROCSPARSE_FORMAT_CHECK(bandwidth);
+        ROCSPARSE_FORMAT_CHECK(stencil);
+        ROCSPARSE_FORMAT_CHECK(slice_size);
+        ROCSPARSE_FORMAT_CHECK(sigma);
         ROCSPARSE_FORMAT_CHECK(compute_type);
         ROCSPARSE_FORMAT_CHECK(alpha);
         ROCSPARSE_FORMAT_CHECK(alphai);
@@ -154,6 +174,11 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(betai);
         ROCSPARSE_FORMAT_CHECK(threshold);
         ROCSPARSE_FORMAT_CHECK(percentage);
+        ROCSPARSE_FORMAT_CHECK(rmat_a);
+        ROCSPARSE_FORMAT_CHECK(rmat_b);
+        ROCSPARSE_FORMAT_CHECK(rmat_c);
+        ROCSPARSE_FORMAT_CHECK(rmat_d);
+        ROCSPARSE_FORMAT_CHECK(powerlaw_exponent);
         ROCSPARSE_FORMAT_CHECK(transA);
         ROCSPARSE_FORMAT_CHECK(transB);
         ROCSPARSE_FORMAT_CHECK(baseA);
@@ -162,6 +187,7 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(baseD);
         ROCSPARSE_FORMAT_CHECK(action);
         ROCSPARSE_FORMAT_CHECK(part);
+        ROCSPARSE_FORMAT_CHECK(mattype);
         ROCSPARSE_FORMAT_CHECK(diag);
         ROCSPARSE_FORMAT_CHECK(uplo);
         ROCSPARSE_FORMAT_CHECK(apol);
@@ -170,6 +196,7 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(matrix);
         ROCSPARSE_FORMAT_CHECK(unit_check);
         ROCSPARSE_FORMAT_CHECK(timing);
+        ROCSPARSE_FORMAT_CHECK(timing_mode);
         ROCSPARSE_FORMAT_CHECK(iters);
         ROCSPARSE_FORMAT_CHECK(denseld);
         ROCSPARSE_FORMAT_CHECK(algo);
@@ -324,14 +351,25 @@ private:
         print("dim_x", arg.dimx);
         print("dim_y", arg.dimy);
         print("dim_z", arg.dimz);
+        print("row_nnz", arg.row_nnz);
+        print("bandwidth", arg.bandwidth);
+        print("stencil", arg.stencil);
+        print("slice_size", arg.slice_size);
+        print("sigma", arg.sigma);
         print("alpha", arg.alpha);
         print("alphai", arg.alphai);
         print("beta", arg.beta);
         print("betai", arg.betai);
         print("threshold", arg.threshold);
         print("percentage", arg.percentage);
+        print("rmat_a", arg.rmat_a);
+        print("rmat_b", arg.rmat_b);
+        print("rmat_c", arg.rmat_c);
+        print("rmat_d", arg.rmat_d);
+        print("powerlaw_exponent", arg.powerlaw_exponent);
         print("action", rocsparse_action2string(arg.action));
         print("part", rocsparse_partition2string(arg.part));
+        print("matrix_type", rocsparse_matrixtype2string(arg.mattype));
         print("diag", rocsparse_diagtype2string(arg.diag));
         print("uplo", rocsparse_fillmode2string(arg.uplo));
         print("analysis_policy", rocsparse_analysis2string(arg.apol));
@@ -348,6 +386,7 @@ private:
         print("category", arg.category);
         print("unit_check", arg.unit_check);
         print("timing", arg.timing);
+        print("timing_mode", rocsparse_timingmode2string(arg.timing_mode));
         print("iters", arg.iters);
         print("denseld", arg.denseld);
         return str << " }\n";
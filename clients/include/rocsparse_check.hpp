@@ -28,6 +28,8 @@
 
 #include <cassert>
 
+#include "rocsparse_analyze.hpp"
+#include "rocsparse_compare.hpp"
 #include "rocsparse_math.hpp"
 
 #ifdef GOOGLE_TEST
@@ -99,14 +101,26 @@ template <>
 inline void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, float* hCPU, float* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_FLOAT_EQ);
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<float>{});
+    if(p >= 0)
+    {
+        float* cpu = hCPU + p;
+        float* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_FLOAT_EQ);
+    }
 }
 
 template <>
 inline void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, double* hCPU, double* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_DOUBLE_EQ);
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<double>{});
+    if(p >= 0)
+    {
+        double* cpu = hCPU + p;
+        double* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_DOUBLE_EQ);
+    }
 }
 
 template <>
@@ -116,7 +130,14 @@ inline void unit_check_general(rocsparse_int            M,
                                rocsparse_float_complex* hCPU,
                                rocsparse_float_complex* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_FLOAT_COMPLEX_EQ);
+    int64_t p = rocsparse_compare(
+        M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<rocsparse_float_complex>{});
+    if(p >= 0)
+    {
+        rocsparse_float_complex* cpu = hCPU + p;
+        rocsparse_float_complex* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_FLOAT_COMPLEX_EQ);
+    }
 }
 
 template <>
@@ -126,21 +147,40 @@ inline void unit_check_general(rocsparse_int             M,
                                rocsparse_double_complex* hCPU,
                                rocsparse_double_complex* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_DOUBLE_COMPLEX_EQ);
+    int64_t p = rocsparse_compare(
+        M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<rocsparse_double_complex>{});
+    if(p >= 0)
+    {
+        rocsparse_double_complex* cpu = hCPU + p;
+        rocsparse_double_complex* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_DOUBLE_COMPLEX_EQ);
+    }
 }
 
 template <>
 inline void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, rocsparse_int* hCPU, rocsparse_int* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<rocsparse_int>{});
+    if(p >= 0)
+    {
+        rocsparse_int* cpu = hCPU + p;
+        rocsparse_int* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_EQ);
+    }
 }
 
 template <>
 inline void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, size_t* hCPU, size_t* hGPU)
 {
-    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_unit_mismatch<size_t>{});
+    if(p >= 0)
+    {
+        size_t* cpu = hCPU + p;
+        size_t* gpu = hGPU + p;
+        UNIT_CHECK(1, 1, lda, cpu, gpu, ASSERT_EQ);
+    }
 }
 
 template <typename U, typename V>
@@ -151,74 +191,68 @@ template <>
 inline void near_check_general_template(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, float* hCPU, float* hGPU, float tol)
 {
-    for(rocsparse_int j = 0; j < N; ++j)
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_near_mismatch<float>{tol});
+    if(p < 0)
     {
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            float compare_val = std::max(std::abs(hCPU[i + j * lda] * tol),
-                                         10 * std::numeric_limits<float>::epsilon());
+        return;
+    }
+
+    float compare_val
+        = std::max(std::abs(hCPU[p] * tol), 10 * std::numeric_limits<float>::epsilon());
 #ifdef GOOGLE_TEST
-            if(rocsparse_isnan(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(hGPU[i + j * lda]));
-            }
-            else if(rocsparse_isinf(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(hGPU[i + j * lda]));
-            }
-            else
-            {
-                ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-            }
+    if(rocsparse_isnan(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isnan(hGPU[p]));
+    }
+    else if(rocsparse_isinf(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isinf(hGPU[p]));
+    }
+    else
+    {
+        ASSERT_NEAR(hCPU[p], hGPU[p], compare_val);
+    }
 #else
-            if(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) >= compare_val)
-            {
-                std::cerr.precision(12);
-                std::cerr << "ASSERT_NEAR(" << hCPU[i + j * lda] << ", " << hGPU[i + j * lda]
-                          << ") failed: " << std::abs(hCPU[i + j * lda] - hGPU[i + j * lda])
-                          << " exceeds compare_val " << compare_val << std::endl;
-                exit(EXIT_FAILURE);
-            }
+    std::cerr.precision(12);
+    std::cerr << "ASSERT_NEAR(" << hCPU[p] << ", " << hGPU[p]
+              << ") failed: " << std::abs(hCPU[p] - hGPU[p]) << " exceeds compare_val "
+              << compare_val << std::endl;
+    exit(EXIT_FAILURE);
 #endif
-        }
-    }
 }
 
 template <>
 inline void near_check_general_template(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, double* hCPU, double* hGPU, double tol)
 {
-    for(rocsparse_int j = 0; j < N; ++j)
+    int64_t p = rocsparse_compare(M, N, lda, hCPU, hGPU, rocsparse_near_mismatch<double>{tol});
+    if(p < 0)
     {
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            double compare_val = std::max(std::abs(hCPU[i + j * lda] * tol),
-                                          10 * std::numeric_limits<double>::epsilon());
+        return;
+    }
+
+    double compare_val
+        = std::max(std::abs(hCPU[p] * tol), 10 * std::numeric_limits<double>::epsilon());
 #ifdef GOOGLE_TEST
-            if(rocsparse_isnan(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(hGPU[i + j * lda]));
-            }
-            else if(rocsparse_isinf(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(hGPU[i + j * lda]));
-            }
-            else
-            {
-                ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-            }
+    if(rocsparse_isnan(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isnan(hGPU[p]));
+    }
+    else if(rocsparse_isinf(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isinf(hGPU[p]));
+    }
+    else
+    {
+        ASSERT_NEAR(hCPU[p], hGPU[p], compare_val);
+    }
 #else
-            if(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) >= compare_val)
-            {
-                std::cerr.precision(16);
-                std::cerr << "ASSERT_NEAR(" << hCPU[i + j * lda] << ", " << hGPU[i + j * lda]
-                          << ") failed: " << std::abs(hCPU[i + j * lda] - hGPU[i + j * lda])
-                          << " exceeds compare_val " << compare_val << std::endl;
-                exit(EXIT_FAILURE);
-            }
+    std::cerr.precision(16);
+    std::cerr << "ASSERT_NEAR(" << hCPU[p] << ", " << hGPU[p]
+              << ") failed: " << std::abs(hCPU[p] - hGPU[p]) << " exceeds compare_val "
+              << compare_val << std::endl;
+    exit(EXIT_FAILURE);
 #endif
-        }
-    }
 }
 
 template <>
@@ -229,48 +263,39 @@ inline void near_check_general_template(rocsparse_int            M,
                                         rocsparse_float_complex* hGPU,
                                         float                    tol)
 {
-    for(rocsparse_int j = 0; j < N; ++j)
+    int64_t p = rocsparse_compare(
+        M, N, lda, hCPU, hGPU, rocsparse_near_mismatch<rocsparse_float_complex>{tol});
+    if(p < 0)
     {
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            rocsparse_float_complex compare_val
-                = rocsparse_float_complex(std::max(std::abs(std::real(hCPU[i + j * lda]) * tol),
-                                                   10 * std::numeric_limits<float>::epsilon()),
-                                          std::max(std::abs(std::imag(hCPU[i + j * lda]) * tol),
-                                                   10 * std::numeric_limits<float>::epsilon()));
+        return;
+    }
+
+    rocsparse_float_complex compare_val
+        = rocsparse_float_complex(std::max(std::abs(std::real(hCPU[p]) * tol),
+                                           10 * std::numeric_limits<float>::epsilon()),
+                                  std::max(std::abs(std::imag(hCPU[p]) * tol),
+                                           10 * std::numeric_limits<float>::epsilon()));
 #ifdef GOOGLE_TEST
-            if(rocsparse_isnan(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(hGPU[i + j * lda]));
-            }
-            else if(rocsparse_isinf(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(hGPU[i + j * lda]));
-            }
-            else
-            {
-                ASSERT_NEAR(std::real(hCPU[i + j * lda]),
-                            std::real(hGPU[i + j * lda]),
-                            std::real(compare_val));
-                ASSERT_NEAR(std::imag(hCPU[i + j * lda]),
-                            std::imag(hGPU[i + j * lda]),
-                            std::imag(compare_val));
-            }
+    if(rocsparse_isnan(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isnan(hGPU[p]));
+    }
+    else if(rocsparse_isinf(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isinf(hGPU[p]));
+    }
+    else
+    {
+        ASSERT_NEAR(std::real(hCPU[p]), std::real(hGPU[p]), std::real(compare_val));
+        ASSERT_NEAR(std::imag(hCPU[p]), std::imag(hGPU[p]), std::imag(compare_val));
+    }
 #else
-            if(std::abs(std::real(hCPU[i + j * lda]) - std::real(hGPU[i + j * lda]))
-                   >= std::real(compare_val)
-               || std::abs(std::imag(hCPU[i + j * lda]) - std::imag(hGPU[i + j * lda]))
-                      >= std::imag(compare_val))
-            {
-                std::cerr.precision(16);
-                std::cerr << "ASSERT_NEAR(" << hCPU[i + j * lda] << ", " << hGPU[i + j * lda]
-                          << ") failed: " << std::abs(hCPU[i + j * lda] - hGPU[i + j * lda])
-                          << " exceeds compare_val " << compare_val << std::endl;
-                exit(EXIT_FAILURE);
-            }
+    std::cerr.precision(16);
+    std::cerr << "ASSERT_NEAR(" << hCPU[p] << ", " << hGPU[p]
+              << ") failed: " << std::abs(hCPU[p] - hGPU[p]) << " exceeds compare_val "
+              << compare_val << std::endl;
+    exit(EXIT_FAILURE);
 #endif
-        }
-    }
 }
 
 template <>
@@ -281,48 +306,39 @@ inline void near_check_general_template(rocsparse_int             M,
                                         rocsparse_double_complex* hGPU,
                                         double                    tol)
 {
-    for(rocsparse_int j = 0; j < N; ++j)
+    int64_t p = rocsparse_compare(
+        M, N, lda, hCPU, hGPU, rocsparse_near_mismatch<rocsparse_double_complex>{tol});
+    if(p < 0)
     {
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            rocsparse_double_complex compare_val
-                = rocsparse_double_complex(std::max(std::abs(std::real(hCPU[i + j * lda]) * tol),
-                                                    10 * std::numeric_limits<double>::epsilon()),
-                                           std::max(std::abs(std::imag(hCPU[i + j * lda]) * tol),
-                                                    10 * std::numeric_limits<double>::epsilon()));
+        return;
+    }
+
+    rocsparse_double_complex compare_val
+        = rocsparse_double_complex(std::max(std::abs(std::real(hCPU[p]) * tol),
+                                            10 * std::numeric_limits<double>::epsilon()),
+                                   std::max(std::abs(std::imag(hCPU[p]) * tol),
+                                            10 * std::numeric_limits<double>::epsilon()));
 #ifdef GOOGLE_TEST
-            if(rocsparse_isnan(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isnan(hGPU[i + j * lda]));
-            }
-            else if(rocsparse_isinf(hCPU[i + j * lda]))
-            {
-                ASSERT_TRUE(rocsparse_isinf(hGPU[i + j * lda]));
-            }
-            else
-            {
-                ASSERT_NEAR(std::real(hCPU[i + j * lda]),
-                            std::real(hGPU[i + j * lda]),
-                            std::real(compare_val));
-                ASSERT_NEAR(std::imag(hCPU[i + j * lda]),
-                            std::imag(hGPU[i + j * lda]),
-                            std::imag(compare_val));
-            }
+    if(rocsparse_isnan(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isnan(hGPU[p]));
+    }
+    else if(rocsparse_isinf(hCPU[p]))
+    {
+        ASSERT_TRUE(rocsparse_isinf(hGPU[p]));
+    }
+    else
+    {
+        ASSERT_NEAR(std::real(hCPU[p]), std::real(hGPU[p]), std::real(compare_val));
+        ASSERT_NEAR(std::imag(hCPU[p]), std::imag(hGPU[p]), std::imag(compare_val));
+    }
 #else
-            if(std::abs(std::real(hCPU[i + j * lda]) - std::real(hGPU[i + j * lda]))
-                   >= std::real(compare_val)
-               || std::abs(std::imag(hCPU[i + j * lda]) - std::imag(hGPU[i + j * lda]))
-                      >= std::imag(compare_val))
-            {
-                std::cerr.precision(16);
-                std::cerr << "ASSERT_NEAR(" << hCPU[i + j * lda] << ", " << hGPU[i + j * lda]
-                          << ") failed: " << std::abs(hCPU[i + j * lda] - hGPU[i + j * lda])
-                          << " exceeds compare_val " << compare_val << std::endl;
-                exit(EXIT_FAILURE);
-            }
+    std::cerr.precision(16);
+    std::cerr << "ASSERT_NEAR(" << hCPU[p] << ", " << hGPU[p]
+              << ") failed: " << std::abs(hCPU[p] - hGPU[p]) << " exceeds compare_val "
+              << compare_val << std::endl;
+    exit(EXIT_FAILURE);
 #endif
-        }
-    }
 }
 
 template <typename T>
@@ -366,4 +382,21 @@ inline void
     near_check_general_template<U>(M, N, lda, hCPU, hGPU, tol);
 }
 
+// Check the level schedule of the analysis meta data against the host reference
+inline void unit_check_level_info(const rocsparse_level_schedule& gold,
+                                  const rocsparse_level_info&     info)
+{
+    ASSERT_EQ(gold.depth, info.levels);
+    ASSERT_EQ(gold.min_width, info.min_width);
+    ASSERT_EQ(gold.max_width, info.max_width);
+    ASSERT_EQ(gold.critical_path, info.critical_path);
+    ASSERT_DOUBLE_EQ(gold.parallelism, info.parallelism);
+
+    for(size_t bin = 0; bin < 32; ++bin)
+    {
+        rocsparse_int width = (bin < gold.width_histogram.size()) ? gold.width_histogram[bin] : 0;
+        ASSERT_EQ(width, info.width_histogram[bin]);
+    }
+}
+
 #endif // ROCSPARSE_CHECK_HPP
@@ -0,0 +1,608 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_COMPARE_HPP
+#define ROCSPARSE_COMPARE_HPP
+
+#include "rocsparse_math.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//
+// Comparison engine of the unit and near checks. Outputs are compared in parallel blocks,
+// such that only the first mismatching element is handed to the (serial) assertion macros.
+// By default, the comparison stops scanning as soon as a mismatch has been found. Setting
+// ROCSPARSE_CHECK_REPORT=1 computes ULP and relative error statistics of every compared
+// output in one pass and prints them, including the location of the worst offenders.
+//
+
+// Maximum ULP distance that ASSERT_FLOAT_EQ and ASSERT_DOUBLE_EQ accept
+#ifdef GOOGLE_TEST
+static constexpr uint64_t rocsparse_compare_max_ulps = 4;
+#else
+static constexpr uint64_t rocsparse_compare_max_ulps = 0;
+#endif
+
+// Order preserving mapping of the sign and magnitude representation onto unsigned integers
+inline uint32_t rocsparse_compare_biased(float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits + 1u : (bits | 0x80000000u);
+}
+
+inline uint64_t rocsparse_compare_biased(double x)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits + 1ull : (bits | 0x8000000000000000ull);
+}
+
+/* =================================================================================== */
+/*! \brief  distance of two values in units in the last place */
+template <typename T>
+inline uint64_t rocsparse_ulp_distance(T a, T b)
+{
+    return a < b ? static_cast<uint64_t>(b - a) : static_cast<uint64_t>(a - b);
+}
+
+template <>
+inline uint64_t rocsparse_ulp_distance(float a, float b)
+{
+    uint32_t x = rocsparse_compare_biased(a);
+    uint32_t y = rocsparse_compare_biased(b);
+    return x < y ? y - x : x - y;
+}
+
+template <>
+inline uint64_t rocsparse_ulp_distance(double a, double b)
+{
+    uint64_t x = rocsparse_compare_biased(a);
+    uint64_t y = rocsparse_compare_biased(b);
+    return x < y ? y - x : x - y;
+}
+
+template <>
+inline uint64_t rocsparse_ulp_distance(rocsparse_float_complex a, rocsparse_float_complex b)
+{
+    return std::max(rocsparse_ulp_distance(std::real(a), std::real(b)),
+                    rocsparse_ulp_distance(std::imag(a), std::imag(b)));
+}
+
+template <>
+inline uint64_t rocsparse_ulp_distance(rocsparse_double_complex a, rocsparse_double_complex b)
+{
+    return std::max(rocsparse_ulp_distance(std::real(a), std::real(b)),
+                    rocsparse_ulp_distance(std::imag(a), std::imag(b)));
+}
+
+/* =================================================================================== */
+/*! \brief  relative error of a value with respect to a reference value */
+template <typename T>
+inline double rocsparse_relative_error(T ref, T val)
+{
+    double diff = ref < val ? static_cast<double>(val - ref) : static_cast<double>(ref - val);
+    double nrm  = std::abs(static_cast<double>(ref));
+    return nrm > 0.0 ? diff / nrm : (diff > 0.0 ? std::numeric_limits<double>::infinity() : 0.0);
+}
+
+template <>
+inline double rocsparse_relative_error(float ref, float val)
+{
+    return rocsparse_relative_error<double>(ref, val);
+}
+
+template <>
+inline double rocsparse_relative_error(rocsparse_double_complex ref, rocsparse_double_complex val)
+{
+    double diff = std::abs(val - ref);
+    double nrm  = std::abs(ref);
+    return nrm > 0.0 ? diff / nrm : (diff > 0.0 ? std::numeric_limits<double>::infinity() : 0.0);
+}
+
+template <>
+inline double rocsparse_relative_error(rocsparse_float_complex ref, rocsparse_float_complex val)
+{
+    return rocsparse_relative_error(
+        rocsparse_double_complex(std::real(ref), std::imag(ref)),
+        rocsparse_double_complex(std::real(val), std::imag(val)));
+}
+
+/* =================================================================================== */
+/*! \brief  mismatch predicate of unit_check_general */
+template <typename T>
+inline bool rocsparse_compare_ulp_mismatch(T cpu, T gpu)
+{
+    return std::isnan(cpu) || std::isnan(gpu)
+           || rocsparse_ulp_distance(cpu, gpu) > rocsparse_compare_max_ulps;
+}
+
+template <typename T>
+struct rocsparse_unit_mismatch
+{
+    bool operator()(T cpu, T gpu) const
+    {
+        return cpu != gpu;
+    }
+};
+
+template <>
+struct rocsparse_unit_mismatch<float>
+{
+    bool operator()(float cpu, float gpu) const
+    {
+        return std::isnan(cpu) ? !std::isnan(gpu) : rocsparse_compare_ulp_mismatch(cpu, gpu);
+    }
+};
+
+template <>
+struct rocsparse_unit_mismatch<double>
+{
+    bool operator()(double cpu, double gpu) const
+    {
+        return std::isnan(cpu) ? !std::isnan(gpu) : rocsparse_compare_ulp_mismatch(cpu, gpu);
+    }
+};
+
+template <>
+struct rocsparse_unit_mismatch<rocsparse_float_complex>
+{
+    bool operator()(rocsparse_float_complex cpu, rocsparse_float_complex gpu) const
+    {
+        return rocsparse_isnan(cpu)
+                   ? !rocsparse_isnan(gpu)
+                   : rocsparse_compare_ulp_mismatch(std::real(cpu), std::real(gpu))
+                         || rocsparse_compare_ulp_mismatch(std::imag(cpu), std::imag(gpu));
+    }
+};
+
+template <>
+struct rocsparse_unit_mismatch<rocsparse_double_complex>
+{
+    bool operator()(rocsparse_double_complex cpu, rocsparse_double_complex gpu) const
+    {
+        return rocsparse_isnan(cpu)
+                   ? !rocsparse_isnan(gpu)
+                   : rocsparse_compare_ulp_mismatch(std::real(cpu), std::real(gpu))
+                         || rocsparse_compare_ulp_mismatch(std::imag(cpu), std::imag(gpu));
+    }
+};
+
+/* =================================================================================== */
+/*! \brief  mismatch predicate of near_check_general */
+template <typename T>
+inline bool rocsparse_compare_near_mismatch(T cpu, T gpu, T tol)
+{
+    T compare_val = std::max(std::abs(cpu * tol), 10 * std::numeric_limits<T>::epsilon());
+    double diff   = std::abs(static_cast<double>(cpu) - static_cast<double>(gpu));
+#ifdef GOOGLE_TEST
+    // ASSERT_NEAR accepts diff <= compare_val
+    return !(diff <= compare_val);
+#else
+    return !(diff < compare_val);
+#endif
+}
+
+template <typename T>
+struct rocsparse_near_mismatch
+{
+    T tol;
+
+    bool operator()(T cpu, T gpu) const
+    {
+        if(rocsparse_isnan(cpu))
+        {
+            return !rocsparse_isnan(gpu);
+        }
+        else if(rocsparse_isinf(cpu))
+        {
+            return !rocsparse_isinf(gpu);
+        }
+
+        return rocsparse_compare_near_mismatch(cpu, gpu, this->tol);
+    }
+};
+
+template <>
+struct rocsparse_near_mismatch<rocsparse_float_complex>
+{
+    float tol;
+
+    bool operator()(rocsparse_float_complex cpu, rocsparse_float_complex gpu) const
+    {
+        if(rocsparse_isnan(cpu))
+        {
+            return !rocsparse_isnan(gpu);
+        }
+        else if(rocsparse_isinf(cpu))
+        {
+            return !rocsparse_isinf(gpu);
+        }
+
+        return rocsparse_compare_near_mismatch(std::real(cpu), std::real(gpu), this->tol)
+               || rocsparse_compare_near_mismatch(std::imag(cpu), std::imag(gpu), this->tol);
+    }
+};
+
+template <>
+struct rocsparse_near_mismatch<rocsparse_double_complex>
+{
+    double tol;
+
+    bool operator()(rocsparse_double_complex cpu, rocsparse_double_complex gpu) const
+    {
+        if(rocsparse_isnan(cpu))
+        {
+            return !rocsparse_isnan(gpu);
+        }
+        else if(rocsparse_isinf(cpu))
+        {
+            return !rocsparse_isinf(gpu);
+        }
+
+        return rocsparse_compare_near_mismatch(std::real(cpu), std::real(gpu), this->tol)
+               || rocsparse_compare_near_mismatch(std::imag(cpu), std::imag(gpu), this->tol);
+    }
+};
+
+/* =================================================================================== */
+/*! \brief  error statistics of a comparison */
+struct rocsparse_compare_report
+{
+    // Relative error histogram: exact, < 1e-15, one bin per decade up to 1, >= 1
+    static constexpr int    nbins  = 18;
+    static constexpr size_t nworst = 8;
+
+    size_t   size      = 0;
+    size_t   nmismatch = 0;
+    size_t   nnan      = 0;
+    uint64_t max_ulp   = 0;
+    double   sum_ulp   = 0.0;
+    double   max_rel   = 0.0;
+    size_t   histogram[nbins]{};
+
+    // Largest ULP distances and their positions, in descending order
+    std::vector<std::pair<uint64_t, int64_t>> worst;
+
+    static int bin(double rel)
+    {
+        if(rel == 0.0)
+        {
+            return 0;
+        }
+        else if(rel >= 1.0)
+        {
+            return nbins - 1;
+        }
+
+        int e = static_cast<int>(std::floor(std::log10(rel))) + nbins - 1;
+        return std::max(1, std::min(e, nbins - 1));
+    }
+
+    void add_worst(uint64_t ulp, int64_t pos)
+    {
+        if(this->worst.size() == nworst && ulp <= this->worst.back().first)
+        {
+            return;
+        }
+
+        auto it = std::upper_bound(
+            this->worst.begin(),
+            this->worst.end(),
+            std::make_pair(ulp, pos),
+            [](const std::pair<uint64_t, int64_t>& a, const std::pair<uint64_t, int64_t>& b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+
+        this->worst.insert(it, std::make_pair(ulp, pos));
+
+        if(this->worst.size() > nworst)
+        {
+            this->worst.pop_back();
+        }
+    }
+
+    void merge(const rocsparse_compare_report& that)
+    {
+        this->size += that.size;
+        this->nmismatch += that.nmismatch;
+        this->nnan += that.nnan;
+        this->max_ulp = std::max(this->max_ulp, that.max_ulp);
+        this->sum_ulp += that.sum_ulp;
+        this->max_rel = std::max(this->max_rel, that.max_rel);
+
+        for(int k = 0; k < nbins; ++k)
+        {
+            this->histogram[k] += that.histogram[k];
+        }
+
+        for(const auto& w : that.worst)
+        {
+            this->add_worst(w.first, w.second);
+        }
+    }
+};
+
+/* =================================================================================== */
+/*! \brief  returns true if ROCSPARSE_CHECK_REPORT requests the full comparison report */
+inline bool rocsparse_compare_report_enabled()
+{
+    static const bool enabled = [] {
+        const char* env = getenv("ROCSPARSE_CHECK_REPORT");
+        return env != nullptr && env[0] != '\0' && strcmp(env, "0");
+    }();
+
+    return enabled;
+}
+
+template <typename T>
+inline void rocsparse_compare_print(std::ostream&                   os,
+                                    const rocsparse_compare_report& report,
+                                    rocsparse_int                   lda,
+                                    const T*                        hCPU,
+                                    const T*                        hGPU)
+{
+    size_t ncompared = report.size - report.nnan;
+
+    std::ios_base::fmtflags flags(os.flags());
+    std::streamsize         precision = os.precision(3);
+
+    os << "rocsparse check report: " << report.size << " elements, " << report.nmismatch
+       << " mismatches, " << report.nnan << " NaN" << std::endl;
+    os << "  max ulp " << report.max_ulp << ", mean ulp "
+       << (ncompared ? report.sum_ulp / ncompared : 0.0) << ", max relative error "
+       << std::scientific << report.max_rel << std::defaultfloat << std::endl;
+
+    os << "  relative error histogram:" << std::endl;
+    for(int k = 0; k < rocsparse_compare_report::nbins; ++k)
+    {
+        if(report.histogram[k] == 0)
+        {
+            continue;
+        }
+
+        int e = k - rocsparse_compare_report::nbins + 1;
+
+        os << "    " << std::setw(18) << std::left;
+        if(k == 0)
+        {
+            os << "0";
+        }
+        else if(k == 1)
+        {
+            os << "< 1e" + std::to_string(e + 1);
+        }
+        else if(k == rocsparse_compare_report::nbins - 1)
+        {
+            os << ">= 1";
+        }
+        else
+        {
+            os << "[1e" + std::to_string(e) + ", 1e" + std::to_string(e + 1) + ")";
+        }
+        os << std::right << report.histogram[k] << std::endl;
+    }
+
+    if(!report.worst.empty() && report.max_ulp > 0)
+    {
+        os.precision(17);
+        os << "  worst offenders (ulp, row, column, expected, actual):" << std::endl;
+        for(const auto& w : report.worst)
+        {
+            if(w.first == 0)
+            {
+                break;
+            }
+
+            os << "    " << w.first << ", " << w.second % lda << ", " << w.second / lda << ", "
+               << hCPU[w.second] << ", " << hGPU[w.second] << std::endl;
+        }
+    }
+
+    os.precision(precision);
+    os.flags(flags);
+}
+
+// Block size of the parallel comparison
+static constexpr rocsparse_int rocsparse_compare_block = 4096;
+
+// Returns the position i + j * lda of the first mismatch in column major order, or -1
+template <typename T, typename F>
+inline int64_t rocsparse_compare_fast(
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, const T* hCPU, const T* hGPU, F mismatch)
+{
+    int64_t nblocks_col = (M - 1) / rocsparse_compare_block + 1;
+    int64_t nblocks     = nblocks_col * N;
+
+    // First block that contains a mismatch
+    std::atomic<int64_t> first(nblocks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        // Blocks behind a known mismatch cannot contain the first one
+        if(b > first.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        int64_t       j     = b / nblocks_col;
+        rocsparse_int begin = (b % nblocks_col) * rocsparse_compare_block;
+        rocsparse_int end   = std::min(begin + rocsparse_compare_block, M);
+
+        const T* cpu = hCPU + j * lda;
+        const T* gpu = hGPU + j * lda;
+
+        int fail = 0;
+
+#ifdef _OPENMP
+#pragma omp simd reduction(| : fail)
+#endif
+        for(rocsparse_int i = begin; i < end; ++i)
+        {
+            fail |= mismatch(cpu[i], gpu[i]);
+        }
+
+        if(fail)
+        {
+            int64_t prev = first.load();
+            while(b < prev && !first.compare_exchange_weak(prev, b))
+            {
+            }
+        }
+    }
+
+    if(first == nblocks)
+    {
+        return -1;
+    }
+
+    int64_t       j     = first / nblocks_col;
+    rocsparse_int begin = (first % nblocks_col) * rocsparse_compare_block;
+    rocsparse_int end   = std::min(begin + rocsparse_compare_block, M);
+
+    for(rocsparse_int i = begin; i < end; ++i)
+    {
+        if(mismatch(hCPU[i + j * lda], hGPU[i + j * lda]))
+        {
+            return i + j * lda;
+        }
+    }
+
+    return -1;
+}
+
+// Same as rocsparse_compare_fast, but visits all elements to collect the error statistics
+template <typename T, typename F>
+inline int64_t rocsparse_compare_full(rocsparse_compare_report& report,
+                                      rocsparse_int             M,
+                                      rocsparse_int             N,
+                                      rocsparse_int             lda,
+                                      const T*                  hCPU,
+                                      const T*                  hGPU,
+                                      F                         mismatch)
+{
+    int64_t nblocks_col = (M - 1) / rocsparse_compare_block + 1;
+    int64_t nblocks     = nblocks_col * N;
+    int64_t first       = std::numeric_limits<int64_t>::max();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        rocsparse_compare_report local;
+        int64_t                  local_first = std::numeric_limits<int64_t>::max();
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            int64_t       j     = b / nblocks_col;
+            rocsparse_int begin = (b % nblocks_col) * rocsparse_compare_block;
+            rocsparse_int end   = std::min(begin + rocsparse_compare_block, M);
+
+            for(rocsparse_int i = begin; i < end; ++i)
+            {
+                int64_t pos = i + j * lda;
+                T       cpu = hCPU[pos];
+                T       gpu = hGPU[pos];
+
+                ++local.size;
+
+                if(mismatch(cpu, gpu))
+                {
+                    ++local.nmismatch;
+                    local_first = std::min(local_first, pos);
+                }
+
+                if(rocsparse_isnan(cpu) || rocsparse_isnan(gpu))
+                {
+                    ++local.nnan;
+                    continue;
+                }
+
+                uint64_t ulp = rocsparse_ulp_distance(cpu, gpu);
+                double   rel = rocsparse_relative_error(cpu, gpu);
+
+                local.max_ulp = std::max(local.max_ulp, ulp);
+                local.sum_ulp += static_cast<double>(ulp);
+                local.max_rel = std::max(local.max_rel, rel);
+                ++local.histogram[rocsparse_compare_report::bin(rel)];
+                local.add_worst(ulp, pos);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical(rocsparse_compare_full)
+#endif
+        {
+            report.merge(local);
+            first = std::min(first, local_first);
+        }
+    }
+
+    return first == std::numeric_limits<int64_t>::max() ? -1 : first;
+}
+
+/* =================================================================================== */
+/*! \brief  compares a M x N column major array against its reference and returns the
+ *          position i + j * lda of the first mismatching element, or -1. The full
+ *          report is printed if ROCSPARSE_CHECK_REPORT is set. */
+template <typename T, typename F>
+inline int64_t rocsparse_compare(
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, const T* hCPU, const T* hGPU, F mismatch)
+{
+    if(M <= 0 || N <= 0)
+    {
+        return -1;
+    }
+
+    if(!rocsparse_compare_report_enabled())
+    {
+        return rocsparse_compare_fast(M, N, lda, hCPU, hGPU, mismatch);
+    }
+
+    rocsparse_compare_report report;
+    int64_t first = rocsparse_compare_full(report, M, N, lda, hCPU, hGPU, mismatch);
+    rocsparse_compare_print(std::cerr, report, lda, hCPU, hGPU);
+
+    return first;
+}
+
+#endif // ROCSPARSE_COMPARE_HPP
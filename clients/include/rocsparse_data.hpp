@@ -29,13 +29,21 @@
 #include "rocsparse_arguments.hpp"
 #include "test_cleanup.hpp"
 
-#include <boost/iterator/filter_iterator.hpp>
 #include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
-#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
 
 // Class used to read Arguments data into the tests
 class RocSPARSE_TestData
@@ -48,10 +56,212 @@ class RocSPARSE_TestData
         return filename;
     }
 
+    // shard index and number of shards
+    static auto& shard()
+    {
+        static std::pair<size_t, size_t> shard{0, 1};
+        return shard;
+    }
+
+    // Index entry of a group of records sharing function and category, as written
+    // by rocsparse_gentest.py
+    struct index_entry
+    {
+        char     function[64];
+        char     category[32];
+        uint64_t first;
+        uint64_t count;
+    };
+
+    static_assert(sizeof(index_entry) == 112, "Unexpected size of index entry");
+
+    // The data file is memory mapped. Files that cannot be mapped, such as pipes,
+    // are read into memory. Files without index are scanned linearly.
+    class data_file
+    {
+        static constexpr size_t signature_size = 10 + sizeof(Arguments) + 10;
+        static constexpr size_t magic_size     = 16;
+
+        void*             m_map;
+        size_t            m_map_size;
+        std::vector<char> m_buffer;
+        const char*       m_records;
+        size_t            m_nrecords;
+        const char*       m_index;
+        size_t            m_nindex;
+
+    public:
+        explicit data_file(const std::string& name)
+            : m_map(nullptr)
+            , m_map_size(0)
+            , m_records(nullptr)
+            , m_nrecords(0)
+            , m_index(nullptr)
+            , m_nindex(0)
+        {
+            int fd = open(name.c_str(), O_RDONLY | O_CLOEXEC);
+            if(fd == -1)
+            {
+                std::cerr << "Cannot open " << name << ": " << strerror(errno) << std::endl;
+                exit(EXIT_FAILURE);
+            }
+
+            struct stat st;
+            if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+            {
+                void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(map != MAP_FAILED)
+                {
+                    this->m_map      = map;
+                    this->m_map_size = st.st_size;
+                }
+            }
+
+            if(this->m_map == nullptr)
+            {
+                char    chunk[65536];
+                ssize_t n;
+                while((n = read(fd, chunk, sizeof(chunk))) > 0)
+                {
+                    this->m_buffer.insert(this->m_buffer.end(), chunk, chunk + n);
+                }
+            }
+
+            close(fd);
+
+            const char* data = this->m_map ? static_cast<const char*>(this->m_map)
+                                           : this->m_buffer.data();
+            size_t      size = this->m_map ? this->m_map_size : this->m_buffer.size();
+
+            // Validate the data file format
+            std::istringstream signature(
+                std::string(data, size < signature_size ? size : signature_size));
+            Arguments::validate(signature);
+
+            const char* end = data + size;
+
+            // Locate the index, if present
+            if(size >= signature_size + magic_size + sizeof(uint64_t)
+               && !memcmp(end - magic_size, "rocSPARSE_index", magic_size))
+            {
+                uint64_t nindex;
+                memcpy(&nindex, end - magic_size - sizeof(uint64_t), sizeof(uint64_t));
+
+                this->m_nindex = nindex;
+                this->m_index = end - magic_size - sizeof(uint64_t) - nindex * sizeof(index_entry);
+
+                end = this->m_index;
+            }
+
+            this->m_records  = data + signature_size;
+            this->m_nrecords = (end - this->m_records) / sizeof(Arguments);
+        }
+
+        ~data_file()
+        {
+            if(this->m_map != nullptr)
+            {
+                munmap(this->m_map, this->m_map_size);
+            }
+        }
+
+        data_file(const data_file&) = delete;
+        data_file& operator=(const data_file&) = delete;
+
+        size_t nrecords() const
+        {
+            return this->m_nrecords;
+        }
+
+        size_t nindex() const
+        {
+            return this->m_nindex;
+        }
+
+        // Records are not necessarily aligned within the file
+        Arguments record(size_t i) const
+        {
+            Arguments arg;
+            memcpy(&arg, this->m_records + i * sizeof(Arguments), sizeof(Arguments));
+            return arg;
+        }
+
+        index_entry index(size_t i) const
+        {
+            index_entry entry;
+            memcpy(&entry, this->m_index + i * sizeof(index_entry), sizeof(index_entry));
+            return entry;
+        }
+    };
+
 public:
-    // filter iterator
-    using iterator = boost::filter_iterator<std::function<bool(const Arguments&)>,
-                                            std::istream_iterator<Arguments>>;
+    // iterator over the records selected for a test suite
+    class iterator
+    {
+        std::shared_ptr<const std::vector<Arguments>> m_args;
+        size_t                                        m_pos;
+
+        bool at_end() const
+        {
+            return !this->m_args || this->m_pos >= this->m_args->size();
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Arguments;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Arguments*;
+        using reference         = const Arguments&;
+
+        iterator()
+            : m_pos(0)
+        {
+        }
+
+        explicit iterator(std::shared_ptr<const std::vector<Arguments>> args)
+            : m_args(std::move(args))
+            , m_pos(0)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*this->m_args)[this->m_pos];
+        }
+
+        pointer operator->() const
+        {
+            return &(*this->m_args)[this->m_pos];
+        }
+
+        iterator& operator++()
+        {
+            ++this->m_pos;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator it(*this);
+            ++this->m_pos;
+            return it;
+        }
+
+        bool operator==(const iterator& that) const
+        {
+            if(this->at_end() || that.at_end())
+            {
+                return this->at_end() == that.at_end();
+            }
+
+            return this->m_args == that.m_args && this->m_pos == that.m_pos;
+        }
+
+        bool operator!=(const iterator& that) const
+        {
+            return !(*this == that);
+        }
+    };
 
     // Initialize filename, optionally removing it at exit
     static void set_filename(std::string name, bool remove_atexit = false)
@@ -65,33 +275,68 @@ public:
         }
     }
 
-    // begin() iterator which accepts an optional filter.
-    static iterator begin(std::function<bool(const Arguments&)> filter = [](auto) { return true; })
+    // Only select every count-th record, starting at record index
+    static void set_shard(size_t index, size_t count)
+    {
+        shard() = {index, count};
+    }
+
+    // begin() iterator which accepts an optional filter. The optional group filter is
+    // evaluated once per group of the index, on Arguments which only hold the function
+    // and category of the group. Groups that do not pass it are skipped entirely.
+    static iterator begin(std::function<bool(const Arguments&)> filter = [](auto) { return true; },
+                          std::function<bool(const Arguments&)> group_filter
+                          = [](auto) { return true; })
     {
-        static std::ifstream* ifs;
+        static data_file* data;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
-        if(!ifs)
+        if(!data)
         {
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(&ifs, filename(), std::ifstream::binary);
-            if(!ifs || ifs->fail())
+            // Allocate the data file and register it to be deleted during cleanup
+            data = test_cleanup::allocate(&data, filename());
+        }
+
+        auto args = std::make_shared<std::vector<Arguments>>();
+
+        // We select only the test cases we want right now.
+        // This is to preserve Gtest structure while not creating no-op tests which "always pass".
+        auto select = [&](size_t first, size_t count) {
+            for(size_t i = first; i < first + count; ++i)
             {
-                std::cerr << "Cannot open " << filename() << ": " << strerror(errno) << std::endl;
-                exit(EXIT_FAILURE);
+                if(i % shard().second != shard().first)
+                {
+                    continue;
+                }
+
+                Arguments arg = data->record(i);
+                if(filter(arg))
+                {
+                    args->push_back(arg);
+                }
             }
+        };
+
+        if(data->nindex() == 0)
+        {
+            select(0, data->nrecords());
         }
 
-        // We re-seek the file back to position 0
-        ifs->clear();
-        ifs->seekg(0);
+        for(size_t i = 0; i < data->nindex(); ++i)
+        {
+            index_entry entry = data->index(i);
 
-        // Validate the data file format
-        Arguments::validate(*ifs);
+            Arguments group{};
+            strncpy(group.function, entry.function, sizeof(group.function) - 1);
+            strncpy(group.category, entry.category, sizeof(group.category) - 1);
 
-        // We create a filter iterator which will choose only the test cases we want right now.
-        // This is to preserve Gtest structure while not creating no-op tests which "always pass".
-        return iterator(filter, std::istream_iterator<Arguments>(*ifs));
+            if(group_filter(group))
+            {
+                select(entry.first, entry.count);
+            }
+        }
+
+        return iterator(args);
     }
 
     // end() iterator
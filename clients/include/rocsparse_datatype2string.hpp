@@ -42,9 +42,22 @@ typedef enum rocsparse_matrix_init_
     rocsparse_matrix_laplace_2d      = 1, /**< Initialize 2D laplacian matrix */
     rocsparse_matrix_laplace_3d      = 2, /**< Initialize 3D laplacian matrix */
     rocsparse_matrix_file_mtx        = 3, /**< Read from .mtx (matrix market) file */
-    rocsparse_matrix_file_rocalution = 4 /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_file_rocalution = 4, /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_rmat            = 5, /**< Generate R-MAT matrix */
+    rocsparse_matrix_powerlaw        = 6, /**< Generate matrix with power-law row lengths */
+    rocsparse_matrix_banded          = 7, /**< Generate banded matrix with variable bandwidth */
+    rocsparse_matrix_block           = 8 /**< Generate FEM-like matrix of dense blocks */
 } rocsparse_matrix_init;
 
+typedef enum rocsparse_timing_mode_
+{
+    rocsparse_timing_hot          = 0, /**< Back-to-back calls with warm caches */
+    rocsparse_timing_cold         = 1, /**< Device cache flushed before each call */
+    rocsparse_timing_transfer     = 2, /**< Host to device transfer, call and device to host */
+    rocsparse_timing_end_to_end   = 3, /**< Buffer size, analysis, call and clear */
+    rocsparse_timing_amortization = 4 /**< Analysis amortization over number of solves */
+} rocsparse_timing_mode;
+
 constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
 {
     switch(matrix)
@@ -59,6 +72,33 @@ constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
         return "mtx";
     case rocsparse_matrix_file_rocalution:
         return "csr";
+    case rocsparse_matrix_rmat:
+        return "rmat";
+    case rocsparse_matrix_powerlaw:
+        return "powerlaw";
+    case rocsparse_matrix_banded:
+        return "banded";
+    case rocsparse_matrix_block:
+        return "block";
+    default:
+        return "invalid";
+    }
+}
+
+constexpr auto rocsparse_timingmode2string(rocsparse_timing_mode mode)
+{
+    switch(mode)
+    {
+    case rocsparse_timing_hot:
+        return "hot";
+    case rocsparse_timing_cold:
+        return "cold";
+    case rocsparse_timing_transfer:
+        return "transfer";
+    case rocsparse_timing_end_to_end:
+        return "e2e";
+    case rocsparse_timing_amortization:
+        return "amortize";
     default:
         return "invalid";
     }
@@ -109,6 +149,23 @@ constexpr auto rocsparse_operation2string(rocsparse_operation trans)
     }
 }
 
+constexpr auto rocsparse_matrixtype2string(rocsparse_matrix_type type)
+{
+    switch(type)
+    {
+    case rocsparse_matrix_type_general:
+        return "GE";
+    case rocsparse_matrix_type_symmetric:
+        return "SY";
+    case rocsparse_matrix_type_hermitian:
+        return "HE";
+    case rocsparse_matrix_type_triangular:
+        return "TR";
+    default:
+        return "invalid";
+    }
+}
+
 constexpr auto rocsparse_diagtype2string(rocsparse_diag_type diag)
 {
     switch(diag)
@@ -163,6 +220,21 @@ constexpr auto rocsparse_partition2string(rocsparse_hyb_partition part)
     }
 }
 
+constexpr auto rocsparse_csrmvalg2string(rocsparse_csrmv_alg alg)
+{
+    switch(alg)
+    {
+    case rocsparse_csrmv_alg_stream:
+        return "stream";
+    case rocsparse_csrmv_alg_adaptive:
+        return "adaptive";
+    case rocsparse_csrmv_alg_merge_path:
+        return "merge_path";
+    default:
+        return "invalid";
+    }
+}
+
 constexpr auto rocsparse_analysis2string(rocsparse_analysis_policy policy)
 {
     switch(policy)
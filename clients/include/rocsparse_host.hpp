@@ -88,6 +88,28 @@ template <typename T>
 void host_sctr(
     rocsparse_int nnz, const T* x_val, const rocsparse_int* x_ind, T* y, rocsparse_index_base base);
 
+template <typename T>
+void host_spdot(rocsparse_int        nnz_x,
+                const T*             x_val,
+                const rocsparse_int* x_ind,
+                rocsparse_int        nnz_y,
+                const T*             y_val,
+                const rocsparse_int* y_ind,
+                T*                   result,
+                rocsparse_index_base base);
+
+template <typename T>
+void host_spaxpy(rocsparse_int               nnz_x,
+                 T                           alpha,
+                 const T*                    x_val,
+                 const rocsparse_int*        x_ind,
+                 rocsparse_int               nnz_y,
+                 const T*                    y_val,
+                 const rocsparse_int*        y_ind,
+                 std::vector<T>&             z_val,
+                 std::vector<rocsparse_int>& z_ind,
+                 rocsparse_index_base        base);
+
 /*
  * ===========================================================================
  *    level 2 SPARSE
@@ -127,6 +149,28 @@ void host_bsrsv(rocsparse_operation               trans,
                 rocsparse_int*                    struct_pivot,
                 rocsparse_int*                    numeric_pivot);
 
+template <typename T>
+void host_bsrsm(rocsparse_int                     mb,
+                rocsparse_int                     nrhs,
+                rocsparse_int                     nnzb,
+                rocsparse_direction               dir,
+                rocsparse_operation               transA,
+                rocsparse_operation               transX,
+                T                                 alpha,
+                const std::vector<rocsparse_int>& bsr_row_ptr,
+                const std::vector<rocsparse_int>& bsr_col_ind,
+                const std::vector<T>&             bsr_val,
+                rocsparse_int                     bsr_dim,
+                const std::vector<T>&             B,
+                rocsparse_int                     ldb,
+                std::vector<T>&                   X,
+                rocsparse_int                     ldx,
+                rocsparse_diag_type               diag_type,
+                rocsparse_fill_mode               fill_mode,
+                rocsparse_index_base              base,
+                rocsparse_int*                    struct_pivot,
+                rocsparse_int*                    numeric_pivot);
+
 template <typename T>
 void host_coomv(rocsparse_int        M,
                 rocsparse_int        nnz,
@@ -140,7 +184,9 @@ void host_coomv(rocsparse_int        M,
                 rocsparse_index_base base);
 
 template <typename T>
-void host_csrmv(rocsparse_int        M,
+void host_csrmv(rocsparse_operation  trans,
+                rocsparse_int        M,
+                rocsparse_int        N,
                 rocsparse_int        nnz,
                 T                    alpha,
                 const rocsparse_int* csr_row_ptr,
@@ -152,6 +198,22 @@ void host_csrmv(rocsparse_int        M,
                 rocsparse_index_base base,
                 int                  algo);
 
+template <typename T>
+void host_csrmspv(rocsparse_operation  trans,
+                  rocsparse_int        M,
+                  rocsparse_int        N,
+                  rocsparse_int        nnz,
+                  T                    alpha,
+                  const rocsparse_int* csr_row_ptr,
+                  const rocsparse_int* csr_col_ind,
+                  const T*             csr_val,
+                  rocsparse_int        nnz_x,
+                  const T*             x_val,
+                  const rocsparse_int* x_ind,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base);
+
 template <typename T>
 void host_csrsv(rocsparse_operation               trans,
                 rocsparse_int                     M,
@@ -181,6 +243,20 @@ void host_ellmv(rocsparse_int        M,
                 T*                   y,
                 rocsparse_index_base base);
 
+template <typename T>
+void host_sellcmv(rocsparse_int        M,
+                  rocsparse_int        N,
+                  T                    alpha,
+                  const rocsparse_int* sell_slice_ptr,
+                  const rocsparse_int* sell_col_ind,
+                  const T*             sell_val,
+                  const rocsparse_int* sell_perm,
+                  rocsparse_int        sell_slice_size,
+                  const T*             x,
+                  T                    beta,
+                  T*                   y,
+                  rocsparse_index_base base);
+
 template <typename T>
 void host_hybmv(rocsparse_int        M,
                 rocsparse_int        N,
@@ -270,6 +346,23 @@ void host_gemmi(rocsparse_int        M,
                 rocsparse_int        ldc,
                 rocsparse_index_base base);
 
+template <typename T>
+void host_csrsddmm(rocsparse_int                     M,
+                   rocsparse_int                     N,
+                   rocsparse_int                     K,
+                   rocsparse_operation               transA,
+                   rocsparse_operation               transB,
+                   T                                 alpha,
+                   const std::vector<T>&             A,
+                   rocsparse_int                     lda,
+                   const std::vector<T>&             B,
+                   rocsparse_int                     ldb,
+                   T                                 beta,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   std::vector<T>&                   csr_val,
+                   rocsparse_index_base              base);
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -350,6 +443,48 @@ void host_csrgemm(rocsparse_int                     M,
                   rocsparse_index_base              base_C,
                   rocsparse_index_base              base_D);
 
+template <typename T>
+void host_csrgemm_symbolic(rocsparse_int                     M,
+                           rocsparse_int                     N,
+                           rocsparse_int                     K,
+                           const T*                          alpha,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_B,
+                           const std::vector<rocsparse_int>& csr_col_ind_B,
+                           const T*                          beta,
+                           const std::vector<rocsparse_int>& csr_row_ptr_D,
+                           const std::vector<rocsparse_int>& csr_col_ind_D,
+                           const std::vector<rocsparse_int>& csr_row_ptr_C,
+                           std::vector<rocsparse_int>&       csr_col_ind_C,
+                           rocsparse_index_base              base_A,
+                           rocsparse_index_base              base_B,
+                           rocsparse_index_base              base_C,
+                           rocsparse_index_base              base_D);
+
+template <typename T>
+void host_csrgemm_numeric(rocsparse_int                     M,
+                          rocsparse_int                     N,
+                          rocsparse_int                     K,
+                          const T*                          alpha,
+                          const std::vector<rocsparse_int>& csr_row_ptr_A,
+                          const std::vector<rocsparse_int>& csr_col_ind_A,
+                          const std::vector<T>&             csr_val_A,
+                          const std::vector<rocsparse_int>& csr_row_ptr_B,
+                          const std::vector<rocsparse_int>& csr_col_ind_B,
+                          const std::vector<T>&             csr_val_B,
+                          const T*                          beta,
+                          const std::vector<rocsparse_int>& csr_row_ptr_D,
+                          const std::vector<rocsparse_int>& csr_col_ind_D,
+                          const std::vector<T>&             csr_val_D,
+                          const std::vector<rocsparse_int>& csr_row_ptr_C,
+                          const std::vector<rocsparse_int>& csr_col_ind_C,
+                          std::vector<T>&                   csr_val_C,
+                          rocsparse_index_base              base_A,
+                          rocsparse_index_base              base_B,
+                          rocsparse_index_base              base_C,
+                          rocsparse_index_base              base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -480,6 +615,30 @@ void host_csr_to_csc(rocsparse_int                     M,
                      rocsparse_action                  action,
                      rocsparse_index_base              base);
 
+void host_csr_to_csc_map(rocsparse_int                     M,
+                         rocsparse_int                     N,
+                         rocsparse_int                     nnz,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         std::vector<rocsparse_int>&       csc_map,
+                         rocsparse_index_base              base);
+
+// Expands a symmetric, Hermitian or triangular matrix, of which only the triangle given by
+// uplo and the diagonal are used, into op(A) in general CSR format
+template <typename T>
+void host_csr_to_general(rocsparse_operation               trans,
+                         rocsparse_matrix_type             type,
+                         rocsparse_fill_mode               uplo,
+                         rocsparse_diag_type               diag,
+                         rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>&             csr_val,
+                         std::vector<rocsparse_int>&       gen_row_ptr,
+                         std::vector<rocsparse_int>&       gen_col_ind,
+                         std::vector<T>&                   gen_val,
+                         rocsparse_index_base              base);
+
 template <typename T>
 void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_int                     Nb,
@@ -527,6 +686,18 @@ void host_csr_to_gebsr(rocsparse_direction               direction,
                        std::vector<rocsparse_int>&       bsr_col_ind,
                        rocsparse_index_base              bsr_base);
 
+void host_csr_to_gebsr_map(rocsparse_direction               direction,
+                           rocsparse_int                     m,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           rocsparse_int                     row_block_dim,
+                           rocsparse_int                     col_block_dim,
+                           rocsparse_index_base              csr_base,
+                           const std::vector<rocsparse_int>& bsr_row_ptr,
+                           const std::vector<rocsparse_int>& bsr_col_ind,
+                           rocsparse_index_base              bsr_base,
+                           std::vector<rocsparse_int>&       bsr_map);
+
 template <typename T>
 void host_gebsr_to_gebsr(rocsparse_direction               direction,
                          rocsparse_int                     mb,
@@ -570,6 +741,38 @@ void host_csr_to_ell(rocsparse_int                     M,
                      rocsparse_index_base              csr_base,
                      rocsparse_index_base              ell_base);
 
+void host_csr_to_ell_map(rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         rocsparse_int                     ell_width,
+                         std::vector<rocsparse_int>&       ell_map,
+                         rocsparse_index_base              csr_base);
+
+template <typename T>
+void host_csr_to_sellc(rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr,
+                       const std::vector<rocsparse_int>& csr_col_ind,
+                       const std::vector<T>&             csr_val,
+                       rocsparse_int                     sell_slice_size,
+                       rocsparse_int                     sell_sigma,
+                       std::vector<rocsparse_int>&       sell_slice_ptr,
+                       std::vector<rocsparse_int>&       sell_perm,
+                       std::vector<rocsparse_int>&       sell_col_ind,
+                       std::vector<T>&                   sell_val,
+                       rocsparse_int&                    sell_nnz,
+                       rocsparse_index_base              csr_base,
+                       rocsparse_index_base              sell_base);
+
+void host_csr_to_csrdelta(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          const std::vector<rocsparse_int>& csr_col_ind,
+                          rocsparse_int                     block_dim,
+                          std::vector<rocsparse_int>&       csrdelta_block_ptr,
+                          std::vector<rocsparse_int>&       csrdelta_width,
+                          std::vector<rocsparse_int>&       csrdelta_row_col,
+                          std::vector<rocsparse_int>&       csrdelta_col_ind,
+                          rocsparse_int&                    csrdelta_nnz,
+                          rocsparse_index_base              base);
+
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
@@ -587,6 +790,12 @@ void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_hyb_partition           part,
                      rocsparse_index_base              base);
 
+void host_csr_to_hyb_map(rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         rocsparse_int                     ell_width,
+                         std::vector<rocsparse_int>&       hyb_map,
+                         rocsparse_index_base              base);
+
 template <typename T>
 void host_csr_to_csr_compress(rocsparse_int                     M,
                               rocsparse_int                     N,
@@ -647,6 +856,31 @@ void host_ell_to_csr(rocsparse_int                     M,
                      rocsparse_index_base              ell_base,
                      rocsparse_index_base              csr_base);
 
+template <typename T>
+void host_sellc_to_csr(rocsparse_int                     M,
+                       rocsparse_int                     N,
+                       rocsparse_int                     sell_slice_size,
+                       const std::vector<rocsparse_int>& sell_slice_ptr,
+                       const std::vector<rocsparse_int>& sell_col_ind,
+                       const std::vector<T>&             sell_val,
+                       const std::vector<rocsparse_int>& sell_perm,
+                       std::vector<rocsparse_int>&       csr_row_ptr,
+                       std::vector<rocsparse_int>&       csr_col_ind,
+                       std::vector<T>&                   csr_val,
+                       rocsparse_int&                    csr_nnz,
+                       rocsparse_index_base              sell_base,
+                       rocsparse_index_base              csr_base);
+
+void host_csrdelta_to_csr(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          rocsparse_int                     block_dim,
+                          const std::vector<rocsparse_int>& csrdelta_block_ptr,
+                          const std::vector<rocsparse_int>& csrdelta_width,
+                          const std::vector<rocsparse_int>& csrdelta_row_col,
+                          const std::vector<rocsparse_int>& csrdelta_col_ind,
+                          std::vector<rocsparse_int>&       csr_col_ind,
+                          rocsparse_index_base              base);
+
 template <typename T>
 void host_coosort_by_column(rocsparse_int               M,
                             rocsparse_int               nnz,
@@ -654,4 +888,20 @@ void host_coosort_by_column(rocsparse_int               M,
                             std::vector<rocsparse_int>& coo_col_ind,
                             std::vector<T>&             coo_val);
 
+rocsparse_data_status host_csr_check(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     rocsparse_index_base              base,
+                                     bool                              check_diag);
+
+rocsparse_data_status host_coo_check(rocsparse_int                     M,
+                                     rocsparse_int                     N,
+                                     rocsparse_int                     nnz,
+                                     const std::vector<rocsparse_int>& coo_row_ind,
+                                     const std::vector<rocsparse_int>& coo_col_ind,
+                                     rocsparse_index_base              base,
+                                     bool                              check_diag);
+
 #endif // ROCSPARSE_HOST_HPP
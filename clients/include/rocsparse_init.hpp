@@ -78,7 +78,7 @@ void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
                                bool                        full_rank = false);
 
 /* ==================================================================================== */
-/*! \brief  Generate 2D 9pt laplacian on unit square in CSR format */
+/*! \brief  Generate 2D 5/9/13/25pt laplacian on unit square in CSR format */
 template <typename T>
 void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
                                   std::vector<rocsparse_int>& col_ind,
@@ -88,10 +88,11 @@ void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
                                   rocsparse_int&              M,
                                   rocsparse_int&              N,
                                   rocsparse_int&              nnz,
-                                  rocsparse_index_base        base);
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil = 0);
 
 /* ==================================================================================== */
-/*! \brief  Generate 2D 9pt laplacian on unit square in COO format */
+/*! \brief  Generate 2D 5/9/13/25pt laplacian on unit square in COO format */
 template <typename T>
 void rocsparse_init_coo_laplace2d(std::vector<rocsparse_int>& row_ind,
                                   std::vector<rocsparse_int>& col_ind,
@@ -101,10 +102,11 @@ void rocsparse_init_coo_laplace2d(std::vector<rocsparse_int>& row_ind,
                                   rocsparse_int&              M,
                                   rocsparse_int&              N,
                                   rocsparse_int&              nnz,
-                                  rocsparse_index_base        base);
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil = 0);
 
 /* ==================================================================================== */
-/*! \brief  Generate 3D 27pt laplacian on unit square in CSR format */
+/*! \brief  Generate 3D 7/13/19/27/125pt laplacian on unit cube in CSR format */
 template <typename T>
 void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
                                   std::vector<rocsparse_int>& col_ind,
@@ -115,10 +117,11 @@ void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
                                   rocsparse_int&              M,
                                   rocsparse_int&              N,
                                   rocsparse_int&              nnz,
-                                  rocsparse_index_base        base);
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil = 0);
 
 /* ==================================================================================== */
-/*! \brief  Generate 3D 27pt laplacian on unit square in COO format */
+/*! \brief  Generate 3D 7/13/19/27/125pt laplacian on unit cube in COO format */
 template <typename T>
 void rocsparse_init_coo_laplace3d(std::vector<rocsparse_int>& row_ind,
                                   std::vector<rocsparse_int>& col_ind,
@@ -129,7 +132,124 @@ void rocsparse_init_coo_laplace3d(std::vector<rocsparse_int>& row_ind,
                                   rocsparse_int&              M,
                                   rocsparse_int&              N,
                                   rocsparse_int&              nnz,
-                                  rocsparse_index_base        base);
+                                  rocsparse_index_base        base,
+                                  rocsparse_int               stencil = 0);
+
+/* ==================================================================================== */
+/*! \brief  Write 2D (dim_z = 0) or 3D laplacian to a binary file in rocALUTION format */
+rocsparse_status rocsparse_write_rocalution_laplace(const char*   filename,
+                                                    rocsparse_int dim_x,
+                                                    rocsparse_int dim_y,
+                                                    rocsparse_int dim_z,
+                                                    rocsparse_int stencil);
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT matrix in CSR format */
+template <typename T>
+void rocsparse_init_csr_rmat(std::vector<rocsparse_int>& row_ptr,
+                             std::vector<rocsparse_int>& col_ind,
+                             std::vector<T>&             val,
+                             rocsparse_int               M,
+                             rocsparse_int               N,
+                             rocsparse_int&              nnz,
+                             rocsparse_int               row_nnz,
+                             double                      a,
+                             double                      b,
+                             double                      c,
+                             double                      d,
+                             rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT matrix in COO format */
+template <typename T>
+void rocsparse_init_coo_rmat(std::vector<rocsparse_int>& row_ind,
+                             std::vector<rocsparse_int>& col_ind,
+                             std::vector<T>&             val,
+                             rocsparse_int               M,
+                             rocsparse_int               N,
+                             rocsparse_int&              nnz,
+                             rocsparse_int               row_nnz,
+                             double                      a,
+                             double                      b,
+                             double                      c,
+                             double                      d,
+                             rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a matrix with power-law distributed row lengths in CSR format */
+template <typename T>
+void rocsparse_init_csr_powerlaw(std::vector<rocsparse_int>& row_ptr,
+                                 std::vector<rocsparse_int>& col_ind,
+                                 std::vector<T>&             val,
+                                 rocsparse_int               M,
+                                 rocsparse_int               N,
+                                 rocsparse_int&              nnz,
+                                 rocsparse_int               row_nnz,
+                                 double                      exponent,
+                                 rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a matrix with power-law distributed row lengths in COO format */
+template <typename T>
+void rocsparse_init_coo_powerlaw(std::vector<rocsparse_int>& row_ind,
+                                 std::vector<rocsparse_int>& col_ind,
+                                 std::vector<T>&             val,
+                                 rocsparse_int               M,
+                                 rocsparse_int               N,
+                                 rocsparse_int&              nnz,
+                                 rocsparse_int               row_nnz,
+                                 double                      exponent,
+                                 rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a banded matrix with variable bandwidth in CSR format */
+template <typename T>
+void rocsparse_init_csr_banded(std::vector<rocsparse_int>& row_ptr,
+                               std::vector<rocsparse_int>& col_ind,
+                               std::vector<T>&             val,
+                               rocsparse_int               M,
+                               rocsparse_int               N,
+                               rocsparse_int&              nnz,
+                               rocsparse_int               bandwidth,
+                               rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a banded matrix with variable bandwidth in COO format */
+template <typename T>
+void rocsparse_init_coo_banded(std::vector<rocsparse_int>& row_ind,
+                               std::vector<rocsparse_int>& col_ind,
+                               std::vector<T>&             val,
+                               rocsparse_int               M,
+                               rocsparse_int               N,
+                               rocsparse_int&              nnz,
+                               rocsparse_int               bandwidth,
+                               rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a FEM-like matrix of dense blocks in CSR format */
+template <typename T>
+void rocsparse_init_csr_block(std::vector<rocsparse_int>& row_ptr,
+                              std::vector<rocsparse_int>& col_ind,
+                              std::vector<T>&             val,
+                              rocsparse_int               M,
+                              rocsparse_int               N,
+                              rocsparse_int&              nnz,
+                              rocsparse_int               block_dim,
+                              rocsparse_int               row_nnz,
+                              rocsparse_index_base        base);
+
+/* ==================================================================================== */
+/*! \brief  Generate a FEM-like matrix of dense blocks in COO format */
+template <typename T>
+void rocsparse_init_coo_block(std::vector<rocsparse_int>& row_ind,
+                              std::vector<rocsparse_int>& col_ind,
+                              std::vector<T>&             val,
+                              rocsparse_int               M,
+                              rocsparse_int               N,
+                              rocsparse_int&              nnz,
+                              rocsparse_int               block_dim,
+                              rocsparse_int               row_nnz,
+                              rocsparse_index_base        base);
 
 /* ============================================================================================ */
 /*! \brief  Read matrix from mtx file in COO format */
@@ -399,12 +519,15 @@ template <typename T>
 struct rocsparse_initializer_laplace2d : public rocsparse_initializer_base<T>
 {
 private:
-    rocsparse_int m_dimx, m_dimy;
+    rocsparse_int m_dimx, m_dimy, m_stencil;
 
 public:
-    rocsparse_initializer_laplace2d(rocsparse_int dimx, rocsparse_int dimy)
+    rocsparse_initializer_laplace2d(rocsparse_int dimx,
+                                    rocsparse_int dimy,
+                                    rocsparse_int stencil = 0)
         : m_dimx(dimx)
-        , m_dimy(dimy){};
+        , m_dimy(dimy)
+        , m_stencil(stencil){};
 
     virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
                           std::vector<rocsparse_int>& csr_col_ind,
@@ -414,8 +537,16 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        rocsparse_init_csr_laplace2d(
-            csr_row_ptr, csr_col_ind, csr_val, this->m_dimx, this->m_dimy, M, N, nnz, base);
+        rocsparse_init_csr_laplace2d(csr_row_ptr,
+                                     csr_col_ind,
+                                     csr_val,
+                                     this->m_dimx,
+                                     this->m_dimy,
+                                     M,
+                                     N,
+                                     nnz,
+                                     base,
+                                     this->m_stencil);
     };
 
     virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
@@ -426,8 +557,16 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        rocsparse_init_coo_laplace2d(
-            coo_row_ind, coo_col_ind, coo_val, this->m_dimx, this->m_dimy, M, N, nnz, base);
+        rocsparse_init_coo_laplace2d(coo_row_ind,
+                                     coo_col_ind,
+                                     coo_val,
+                                     this->m_dimx,
+                                     this->m_dimy,
+                                     M,
+                                     N,
+                                     nnz,
+                                     base,
+                                     this->m_stencil);
     }
 };
 
@@ -435,13 +574,17 @@ template <typename T>
 struct rocsparse_initializer_laplace3d : public rocsparse_initializer_base<T>
 {
 private:
-    rocsparse_int m_dimx, m_dimy, m_dimz;
+    rocsparse_int m_dimx, m_dimy, m_dimz, m_stencil;
 
 public:
-    rocsparse_initializer_laplace3d(rocsparse_int dimx, rocsparse_int dimy, rocsparse_int dimz)
+    rocsparse_initializer_laplace3d(rocsparse_int dimx,
+                                    rocsparse_int dimy,
+                                    rocsparse_int dimz,
+                                    rocsparse_int stencil = 0)
         : m_dimx(dimx)
         , m_dimy(dimy)
-        , m_dimz(dimz){};
+        , m_dimz(dimz)
+        , m_stencil(stencil){};
 
     virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
                           std::vector<rocsparse_int>& csr_col_ind,
@@ -460,7 +603,8 @@ public:
                                      M,
                                      N,
                                      nnz,
-                                     base);
+                                     base,
+                                     this->m_stencil);
     };
 
     virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
@@ -480,7 +624,8 @@ public:
                                      M,
                                      N,
                                      nnz,
-                                     base);
+                                     base,
+                                     this->m_stencil);
     }
 };
 
@@ -514,13 +659,15 @@ public:
 
         case rocsparse_matrix_laplace_2d:
         {
-            this->m_instance = new rocsparse_initializer_laplace2d<T>(arg.dimx, arg.dimy);
+            this->m_instance
+                = new rocsparse_initializer_laplace2d<T>(arg.dimx, arg.dimy, arg.stencil);
             break;
         }
 
         case rocsparse_matrix_laplace_3d:
         {
-            this->m_instance = new rocsparse_initializer_laplace3d<T>(arg.dimx, arg.dimy, arg.dimz);
+            this->m_instance = new rocsparse_initializer_laplace3d<T>(
+                arg.dimx, arg.dimy, arg.dimz, arg.stencil);
             break;
         }
 
@@ -0,0 +1,209 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_CACHE_HPP
+#define ROCSPARSE_MATRIX_CACHE_HPP
+
+#include "rocsparse_random.hpp"
+
+#include <cstdlib>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// Matrices are cached with zero based indexing and with values in double precision of the
+// same field, such that a matrix that has been generated or read once can be served to all
+// index bases and precisions of a test sweep.
+//
+template <typename T>
+struct rocsparse_matrix_cache_traits
+{
+    using value_type = double;
+};
+
+template <>
+struct rocsparse_matrix_cache_traits<rocsparse_float_complex>
+{
+    using value_type = rocsparse_double_complex;
+};
+
+template <>
+struct rocsparse_matrix_cache_traits<rocsparse_double_complex>
+{
+    using value_type = rocsparse_double_complex;
+};
+
+template <typename T, typename U>
+inline T rocsparse_matrix_cache_convert(const U& x)
+{
+    return static_cast<T>(x);
+}
+
+template <>
+inline rocsparse_float_complex rocsparse_matrix_cache_convert(const rocsparse_double_complex& x)
+{
+    return rocsparse_float_complex(std::real(x), std::imag(x));
+}
+
+template <typename U>
+struct rocsparse_matrix_cache_entry
+{
+    rocsparse_int M;
+    rocsparse_int N;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> row_ptr;
+    std::vector<rocsparse_int> col_ind;
+    std::vector<U>             val;
+
+    // State of the random number generator before and after the matrix has been
+    // sampled. A cache hit restores the state after sampling, such that all data
+    // that is sampled subsequently is independent of whether the matrix was cached.
+    rocsparse_rng_t rng_before;
+    rocsparse_rng_t rng_after;
+
+    size_t bytes() const
+    {
+        return sizeof(rocsparse_int) * (this->row_ptr.size() + this->col_ind.size())
+               + sizeof(U) * this->val.size();
+    }
+};
+
+//
+// Process-wide cache of host matrices with least recently used eviction. The size of
+// the cache is bounded by ROCSPARSE_MATRIX_CACHE_SIZE (in MiB, default 1024). A size of
+// zero disables the cache. Entries are immutable and shared, such that evicting an entry
+// does not invalidate a matrix that is currently being copied.
+//
+template <typename U>
+class rocsparse_matrix_cache
+{
+public:
+    using entry_t = rocsparse_matrix_cache_entry<U>;
+
+private:
+    using lru_t = std::list<std::string>;
+
+    struct slot_t
+    {
+        std::shared_ptr<const entry_t> entry;
+        lru_t::iterator                lru;
+    };
+
+    std::mutex                              m_mutex;
+    size_t                                  m_capacity;
+    size_t                                  m_size;
+    lru_t                                   m_lru;
+    std::unordered_map<std::string, slot_t> m_slots;
+
+    rocsparse_matrix_cache()
+        : m_capacity(1024)
+        , m_size(0)
+    {
+        const char* env = getenv("ROCSPARSE_MATRIX_CACHE_SIZE");
+        if(env != nullptr)
+        {
+            this->m_capacity = strtoull(env, nullptr, 10);
+        }
+
+        this->m_capacity <<= 20;
+    }
+
+    void evict(typename std::unordered_map<std::string, slot_t>::iterator it)
+    {
+        this->m_size -= it->second.entry->bytes();
+        this->m_lru.erase(it->second.lru);
+        this->m_slots.erase(it);
+    }
+
+public:
+    rocsparse_matrix_cache(const rocsparse_matrix_cache&) = delete;
+    rocsparse_matrix_cache& operator=(const rocsparse_matrix_cache&) = delete;
+
+    static rocsparse_matrix_cache& instance()
+    {
+        static rocsparse_matrix_cache cache;
+        return cache;
+    }
+
+    bool enabled() const
+    {
+        return this->m_capacity > 0;
+    }
+
+    std::shared_ptr<const entry_t> find(const std::string& key, const rocsparse_rng_t& rng)
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        auto it = this->m_slots.find(key);
+        if(it == this->m_slots.end())
+        {
+            return nullptr;
+        }
+
+        // The matrix has been sampled from a different random state
+        if(!(it->second.entry->rng_before == rng))
+        {
+            return nullptr;
+        }
+
+        this->m_lru.splice(this->m_lru.begin(), this->m_lru, it->second.lru);
+
+        return it->second.entry;
+    }
+
+    void insert(const std::string& key, const std::shared_ptr<const entry_t>& entry)
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        size_t bytes = entry->bytes();
+        if(bytes > this->m_capacity)
+        {
+            return;
+        }
+
+        auto it = this->m_slots.find(key);
+        if(it != this->m_slots.end())
+        {
+            this->evict(it);
+        }
+
+        // Evict least recently used matrices until the new one fits
+        while(this->m_size + bytes > this->m_capacity)
+        {
+            this->evict(this->m_slots.find(this->m_lru.back()));
+        }
+
+        this->m_lru.push_front(key);
+        this->m_slots[key] = {entry, this->m_lru.begin()};
+        this->m_size += bytes;
+    }
+};
+
+#endif // ROCSPARSE_MATRIX_CACHE_HPP
@@ -27,6 +27,9 @@
 #define ROCSPARSE_MATRIX_FACTORY_HPP
 
 #include "rocsparse_matrix.hpp"
+#include "rocsparse_matrix_cache.hpp"
+
+#include <sstream>
 
 std::string rocsparse_exepath();
 
@@ -282,12 +285,15 @@ template <typename T>
 struct rocsparse_matrix_factory_laplace2d : public rocsparse_matrix_factory_base<T>
 {
 private:
-    rocsparse_int m_dimx, m_dimy;
+    rocsparse_int m_dimx, m_dimy, m_stencil;
 
 public:
-    rocsparse_matrix_factory_laplace2d(rocsparse_int dimx, rocsparse_int dimy)
+    rocsparse_matrix_factory_laplace2d(rocsparse_int dimx,
+                                       rocsparse_int dimy,
+                                       rocsparse_int stencil = 0)
         : m_dimx(dimx)
-        , m_dimy(dimy){};
+        , m_dimy(dimy)
+        , m_stencil(stencil){};
 
     virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
                             std::vector<rocsparse_int>& bsr_col_ind,
@@ -323,8 +329,16 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        rocsparse_init_csr_laplace2d(
-            csr_row_ptr, csr_col_ind, csr_val, this->m_dimx, this->m_dimy, M, N, nnz, base);
+        rocsparse_init_csr_laplace2d(csr_row_ptr,
+                                     csr_col_ind,
+                                     csr_val,
+                                     this->m_dimx,
+                                     this->m_dimy,
+                                     M,
+                                     N,
+                                     nnz,
+                                     base,
+                                     this->m_stencil);
     }
 
     virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
@@ -335,8 +349,16 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        rocsparse_init_coo_laplace2d(
-            coo_row_ind, coo_col_ind, coo_val, this->m_dimx, this->m_dimy, M, N, nnz, base);
+        rocsparse_init_coo_laplace2d(coo_row_ind,
+                                     coo_col_ind,
+                                     coo_val,
+                                     this->m_dimx,
+                                     this->m_dimy,
+                                     M,
+                                     N,
+                                     nnz,
+                                     base,
+                                     this->m_stencil);
     }
 };
 
@@ -344,13 +366,17 @@ template <typename T>
 struct rocsparse_matrix_factory_laplace3d : public rocsparse_matrix_factory_base<T>
 {
 private:
-    rocsparse_int m_dimx, m_dimy, m_dimz;
+    rocsparse_int m_dimx, m_dimy, m_dimz, m_stencil;
 
 public:
-    rocsparse_matrix_factory_laplace3d(rocsparse_int dimx, rocsparse_int dimy, rocsparse_int dimz)
+    rocsparse_matrix_factory_laplace3d(rocsparse_int dimx,
+                                       rocsparse_int dimy,
+                                       rocsparse_int dimz,
+                                       rocsparse_int stencil = 0)
         : m_dimx(dimx)
         , m_dimy(dimy)
-        , m_dimz(dimz){};
+        , m_dimz(dimz)
+        , m_stencil(stencil){};
 
     virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
                             std::vector<rocsparse_int>& bsr_col_ind,
@@ -395,7 +421,8 @@ public:
                                      M,
                                      N,
                                      nnz,
-                                     base);
+                                     base,
+                                     this->m_stencil);
     }
 
     virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
@@ -415,7 +442,281 @@ public:
                                      M,
                                      N,
                                      nnz,
-                                     base);
+                                     base,
+                                     this->m_stencil);
+    }
+};
+
+template <typename T>
+struct rocsparse_matrix_factory_rmat : public rocsparse_matrix_factory_base<T>
+{
+private:
+    rocsparse_int m_row_nnz;
+    double        m_a, m_b, m_c, m_d;
+
+public:
+    rocsparse_matrix_factory_rmat(rocsparse_int row_nnz, double a, double b, double c, double d)
+        : m_row_nnz(row_nnz)
+        , m_a(a)
+        , m_b(b)
+        , m_c(c)
+        , m_d(d){};
+
+    virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
+                            std::vector<rocsparse_int>& bsr_col_ind,
+                            std::vector<T>&             bsr_val,
+                            rocsparse_int&              Mb,
+                            rocsparse_int&              Nb,
+                            rocsparse_int&              nnzb,
+                            rocsparse_int&              row_block_dim,
+                            rocsparse_int&              col_block_dim,
+                            rocsparse_index_base        base)
+    {
+        //
+        // Temporarily rmat generates a CSR matrix.
+        //
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        //
+        // Then temporarily skip the values.
+        //
+        rocsparse_int nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(rocsparse_int i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = random_generator<T>();
+        }
+    }
+
+    virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
+                          std::vector<rocsparse_int>& csr_col_ind,
+                          std::vector<T>&             csr_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_csr_rmat(csr_row_ptr,
+                                csr_col_ind,
+                                csr_val,
+                                M,
+                                N,
+                                nnz,
+                                this->m_row_nnz,
+                                this->m_a,
+                                this->m_b,
+                                this->m_c,
+                                this->m_d,
+                                base);
+    }
+
+    virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
+                          std::vector<rocsparse_int>& coo_col_ind,
+                          std::vector<T>&             coo_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_coo_rmat(coo_row_ind,
+                                coo_col_ind,
+                                coo_val,
+                                M,
+                                N,
+                                nnz,
+                                this->m_row_nnz,
+                                this->m_a,
+                                this->m_b,
+                                this->m_c,
+                                this->m_d,
+                                base);
+    }
+};
+
+template <typename T>
+struct rocsparse_matrix_factory_powerlaw : public rocsparse_matrix_factory_base<T>
+{
+private:
+    rocsparse_int m_row_nnz;
+    double        m_exponent;
+
+public:
+    rocsparse_matrix_factory_powerlaw(rocsparse_int row_nnz, double exponent)
+        : m_row_nnz(row_nnz)
+        , m_exponent(exponent){};
+
+    virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
+                            std::vector<rocsparse_int>& bsr_col_ind,
+                            std::vector<T>&             bsr_val,
+                            rocsparse_int&              Mb,
+                            rocsparse_int&              Nb,
+                            rocsparse_int&              nnzb,
+                            rocsparse_int&              row_block_dim,
+                            rocsparse_int&              col_block_dim,
+                            rocsparse_index_base        base)
+    {
+        //
+        // Temporarily powerlaw generates a CSR matrix.
+        //
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        //
+        // Then temporarily skip the values.
+        //
+        rocsparse_int nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(rocsparse_int i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = random_generator<T>();
+        }
+    }
+
+    virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
+                          std::vector<rocsparse_int>& csr_col_ind,
+                          std::vector<T>&             csr_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_csr_powerlaw(
+            csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, this->m_row_nnz, this->m_exponent, base);
+    }
+
+    virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
+                          std::vector<rocsparse_int>& coo_col_ind,
+                          std::vector<T>&             coo_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_coo_powerlaw(
+            coo_row_ind, coo_col_ind, coo_val, M, N, nnz, this->m_row_nnz, this->m_exponent, base);
+    }
+};
+
+template <typename T>
+struct rocsparse_matrix_factory_banded : public rocsparse_matrix_factory_base<T>
+{
+private:
+    rocsparse_int m_bandwidth;
+
+public:
+    rocsparse_matrix_factory_banded(rocsparse_int bandwidth)
+        : m_bandwidth(bandwidth){};
+
+    virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
+                            std::vector<rocsparse_int>& bsr_col_ind,
+                            std::vector<T>&             bsr_val,
+                            rocsparse_int&              Mb,
+                            rocsparse_int&              Nb,
+                            rocsparse_int&              nnzb,
+                            rocsparse_int&              row_block_dim,
+                            rocsparse_int&              col_block_dim,
+                            rocsparse_index_base        base)
+    {
+        //
+        // Temporarily banded generates a CSR matrix.
+        //
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        //
+        // Then temporarily skip the values.
+        //
+        rocsparse_int nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(rocsparse_int i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = random_generator<T>();
+        }
+    }
+
+    virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
+                          std::vector<rocsparse_int>& csr_col_ind,
+                          std::vector<T>&             csr_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_csr_banded(
+            csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, this->m_bandwidth, base);
+    }
+
+    virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
+                          std::vector<rocsparse_int>& coo_col_ind,
+                          std::vector<T>&             coo_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_coo_banded(
+            coo_row_ind, coo_col_ind, coo_val, M, N, nnz, this->m_bandwidth, base);
+    }
+};
+
+template <typename T>
+struct rocsparse_matrix_factory_block : public rocsparse_matrix_factory_base<T>
+{
+private:
+    rocsparse_int m_block_dim;
+    rocsparse_int m_row_nnz;
+
+public:
+    rocsparse_matrix_factory_block(rocsparse_int block_dim, rocsparse_int row_nnz)
+        : m_block_dim(block_dim)
+        , m_row_nnz(row_nnz){};
+
+    virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
+                            std::vector<rocsparse_int>& bsr_col_ind,
+                            std::vector<T>&             bsr_val,
+                            rocsparse_int&              Mb,
+                            rocsparse_int&              Nb,
+                            rocsparse_int&              nnzb,
+                            rocsparse_int&              row_block_dim,
+                            rocsparse_int&              col_block_dim,
+                            rocsparse_index_base        base)
+    {
+        //
+        // Temporarily block generates a CSR matrix.
+        //
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        //
+        // Then temporarily skip the values.
+        //
+        rocsparse_int nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(rocsparse_int i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = random_generator<T>();
+        }
+    }
+
+    virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
+                          std::vector<rocsparse_int>& csr_col_ind,
+                          std::vector<T>&             csr_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_csr_block(
+            csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, this->m_block_dim, this->m_row_nnz, base);
+    }
+
+    virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
+                          std::vector<rocsparse_int>& coo_col_ind,
+                          std::vector<T>&             coo_val,
+                          rocsparse_int&              M,
+                          rocsparse_int&              N,
+                          rocsparse_int&              nnz,
+                          rocsparse_index_base        base)
+    {
+        rocsparse_init_coo_block(
+            coo_row_ind, coo_col_ind, coo_val, M, N, nnz, this->m_block_dim, this->m_row_nnz, base);
     }
 };
 
@@ -431,50 +732,71 @@ private:
     rocsparse_int        arg_block_dim;
     rocsparse_index_base arg_base;
 
+    Arguments m_arg;
+    bool      m_to_int;
+    bool      m_full_rank;
+
+    // Key of the matrix source in the matrix cache
+    std::string m_key;
+
+    // Whether the matrix dimensions are input parameters of the source
+    bool m_sized;
+
     rocsparse_matrix_factory_base<T>* m_instance;
 
-public:
-    virtual ~rocsparse_matrix_factory()
-    {
-        if(this->m_instance)
-        {
-            delete this->m_instance;
-            this->m_instance = nullptr;
-        }
-    }
+    using cache_value_t = typename rocsparse_matrix_cache_traits<T>::value_type;
+    using cache_entry_t = rocsparse_matrix_cache_entry<cache_value_t>;
 
-    rocsparse_matrix_factory(const Arguments& arg, bool to_int = false, bool full_rank = false)
-        : arg_dir(arg.direction)
-        , arg_m(arg.M)
-        , arg_n(arg.N)
-        , arg_row_block_dim(arg.col_block_dimA)
-        , arg_col_block_dim(arg.row_block_dimA)
-        , arg_block_dim(arg.block_dim)
-        , arg_base(arg.baseA)
+    template <typename U>
+    static rocsparse_matrix_factory_base<U>*
+        create(const Arguments& arg, bool to_int, bool full_rank)
     {
-        //
-        // FORCE REINIT.
-        //
-        rocsparse_seedrand();
+        rocsparse_matrix_factory_base<U>* instance;
 
         switch(arg.matrix)
         {
         case rocsparse_matrix_random:
         {
-            this->m_instance = new rocsparse_matrix_factory_random<T>(full_rank);
+            instance = new rocsparse_matrix_factory_random<U>(full_rank);
             break;
         }
 
         case rocsparse_matrix_laplace_2d:
         {
-            this->m_instance = new rocsparse_matrix_factory_laplace2d<T>(arg.dimx, arg.dimy);
+            instance = new rocsparse_matrix_factory_laplace2d<U>(arg.dimx, arg.dimy, arg.stencil);
             break;
         }
 
         case rocsparse_matrix_laplace_3d:
         {
-            this->m_instance
-                = new rocsparse_matrix_factory_laplace3d<T>(arg.dimx, arg.dimy, arg.dimz);
+            instance = new rocsparse_matrix_factory_laplace3d<U>(
+                arg.dimx, arg.dimy, arg.dimz, arg.stencil);
+            break;
+        }
+
+        case rocsparse_matrix_rmat:
+        {
+            instance = new rocsparse_matrix_factory_rmat<U>(
+                arg.row_nnz, arg.rmat_a, arg.rmat_b, arg.rmat_c, arg.rmat_d);
+            break;
+        }
+
+        case rocsparse_matrix_powerlaw:
+        {
+            instance
+                = new rocsparse_matrix_factory_powerlaw<U>(arg.row_nnz, arg.powerlaw_exponent);
+            break;
+        }
+
+        case rocsparse_matrix_banded:
+        {
+            instance = new rocsparse_matrix_factory_banded<U>(arg.bandwidth);
+            break;
+        }
+
+        case rocsparse_matrix_block:
+        {
+            instance = new rocsparse_matrix_factory_block<U>(arg.block_dim, arg.row_nnz);
             break;
         }
 
@@ -483,7 +805,7 @@ public:
             std::string filename
                 = arg.timing ? arg.filename
                              : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
-            this->m_instance = new rocsparse_matrix_factory_rocalution<T>(filename.c_str(), to_int);
+            instance = new rocsparse_matrix_factory_rocalution<U>(filename.c_str(), to_int);
             break;
         }
 
@@ -492,17 +814,201 @@ public:
             std::string filename
                 = arg.timing ? arg.filename
                              : rocsparse_exepath() + "../matrices/" + arg.filename + ".mtx";
-            this->m_instance = new rocsparse_matrix_factory_mtx<T>(filename.c_str());
+            instance = new rocsparse_matrix_factory_mtx<U>(filename.c_str());
             break;
         }
 
         default:
         {
-            this->m_instance = nullptr;
+            instance = nullptr;
+            break;
+        }
+        }
+
+        return instance;
+    }
+
+    static std::string cache_key(const Arguments& arg, bool to_int, bool full_rank, bool& sized)
+    {
+        std::ostringstream key;
+
+        key.precision(17);
+        key << rocsparse_matrix2string(arg.matrix);
+
+        switch(arg.matrix)
+        {
+        case rocsparse_matrix_random:
+        {
+            key << '_' << full_rank;
+            sized = true;
             break;
         }
+
+        case rocsparse_matrix_laplace_2d:
+        {
+            key << '_' << arg.dimx << '_' << arg.dimy << '_' << arg.stencil;
+            sized = false;
+            break;
         }
+
+        case rocsparse_matrix_laplace_3d:
+        {
+            key << '_' << arg.dimx << '_' << arg.dimy << '_' << arg.dimz << '_' << arg.stencil;
+            sized = false;
+            break;
+        }
+
+        case rocsparse_matrix_rmat:
+        {
+            key << '_' << arg.row_nnz << '_' << arg.rmat_a << '_' << arg.rmat_b << '_'
+                << arg.rmat_c << '_' << arg.rmat_d;
+            sized = true;
+            break;
+        }
+
+        case rocsparse_matrix_powerlaw:
+        {
+            key << '_' << arg.row_nnz << '_' << arg.powerlaw_exponent;
+            sized = true;
+            break;
+        }
+
+        case rocsparse_matrix_banded:
+        {
+            key << '_' << arg.bandwidth;
+            sized = true;
+            break;
+        }
+
+        case rocsparse_matrix_block:
+        {
+            key << '_' << arg.block_dim << '_' << arg.row_nnz;
+            sized = true;
+            break;
+        }
+
+        case rocsparse_matrix_file_rocalution:
+        {
+            key << '_' << arg.timing << '_' << arg.filename << '_' << to_int;
+            sized = false;
+            break;
+        }
+
+        case rocsparse_matrix_file_mtx:
+        {
+            key << '_' << arg.timing << '_' << arg.filename;
+            sized = false;
+            break;
+        }
+
+        default:
+        {
+            return "";
+        }
+        }
+
+        return key.str();
+    }
+
+    //
+    // Look up the zero based CSR matrix in the cache, or sample it in the cached
+    // precision if it is not present yet.
+    //
+    std::shared_ptr<const cache_entry_t> cached_csr(rocsparse_int M, rocsparse_int N)
+    {
+        auto& cache = rocsparse_matrix_cache<cache_value_t>::instance();
+
+        std::ostringstream key;
+        key << this->m_key;
+        if(this->m_sized)
+        {
+            key << '_' << M << '_' << N;
+        }
+
+        auto entry = cache.find(key.str(), rocsparse_rng);
+        if(entry != nullptr)
+        {
+            rocsparse_rng = entry->rng_after;
+            return entry;
+        }
+
+        auto sample        = std::make_shared<cache_entry_t>();
+        sample->M          = M;
+        sample->N          = N;
+        sample->rng_before = rocsparse_rng;
+
+        // Constructing a source might reseed the generator
+        rocsparse_matrix_factory_base<cache_value_t>* instance
+            = create<cache_value_t>(this->m_arg, this->m_to_int, this->m_full_rank);
+        rocsparse_rng = sample->rng_before;
+
+        instance->init_csr(sample->row_ptr,
+                           sample->col_ind,
+                           sample->val,
+                           sample->M,
+                           sample->N,
+                           sample->nnz,
+                           rocsparse_index_base_zero);
+        delete instance;
+
+        sample->rng_after = rocsparse_rng;
+
+        cache.insert(key.str(), sample);
+
+        return sample;
+    }
+
+    template <typename U>
+    static void copy_values(std::vector<T>& val, const std::vector<U>& cached)
+    {
+        rocsparse_int nnz = cached.size();
+
+        val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            val[i] = rocsparse_matrix_cache_convert<T>(cached[i]);
+        }
+    }
+
+public:
+    virtual ~rocsparse_matrix_factory()
+    {
+        if(this->m_instance)
+        {
+            delete this->m_instance;
+            this->m_instance = nullptr;
+        }
+    }
+
+    rocsparse_matrix_factory(const Arguments& arg, bool to_int = false, bool full_rank = false)
+        : arg_dir(arg.direction)
+        , arg_m(arg.M)
+        , arg_n(arg.N)
+        , arg_row_block_dim(arg.col_block_dimA)
+        , arg_col_block_dim(arg.row_block_dimA)
+        , arg_block_dim(arg.block_dim)
+        , arg_base(arg.baseA)
+        , m_arg(arg)
+        , m_to_int(to_int)
+        , m_full_rank(full_rank)
+        , m_sized(false)
+    {
+        //
+        // FORCE REINIT.
+        //
+        rocsparse_seedrand();
+
+        this->m_instance = create<T>(arg, to_int, full_rank);
         assert(this->m_instance != nullptr);
+
+        if(rocsparse_matrix_cache<cache_value_t>::instance().enabled())
+        {
+            this->m_key = cache_key(arg, to_int, full_rank, this->m_sized);
+        }
     }
 
     virtual void init_csr(std::vector<rocsparse_int>& csr_row_ptr,
@@ -513,7 +1019,39 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        this->m_instance->init_csr(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+        if(this->m_key.empty())
+        {
+            this->m_instance->init_csr(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+            return;
+        }
+
+        auto entry = this->cached_csr(M, N);
+
+        M   = entry->M;
+        N   = entry->N;
+        nnz = entry->nnz;
+
+        // Shift the index base of the cached matrix
+        csr_row_ptr.resize(entry->row_ptr.size());
+        csr_col_ind.resize(entry->col_ind.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < entry->row_ptr.size(); ++i)
+        {
+            csr_row_ptr[i] = entry->row_ptr[i] + base;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < entry->col_ind.size(); ++i)
+        {
+            csr_col_ind[i] = entry->col_ind[i] + base;
+        }
+
+        copy_values(csr_val, entry->val);
     }
 
     void init_csr(host_csr_matrix<T>& that)
@@ -521,8 +1059,7 @@ public:
         that.base = this->arg_base;
         that.m    = this->arg_m;
         that.n    = this->arg_n;
-        this->m_instance->init_csr(
-            that.ptr, that.ind, that.val, that.m, that.n, that.nnz, that.base);
+        this->init_csr(that.ptr, that.ind, that.val, that.m, that.n, that.nnz, that.base);
     }
 
     virtual void init_gebsr(std::vector<rocsparse_int>& bsr_row_ptr,
@@ -535,8 +1072,31 @@ public:
                             rocsparse_int&              col_block_dim,
                             rocsparse_index_base        base)
     {
-        this->m_instance->init_gebsr(
-            bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, row_block_dim, col_block_dim, base);
+        if(this->m_key.empty())
+        {
+            this->m_instance->init_gebsr(bsr_row_ptr,
+                                         bsr_col_ind,
+                                         bsr_val,
+                                         Mb,
+                                         Nb,
+                                         nnzb,
+                                         row_block_dim,
+                                         col_block_dim,
+                                         base);
+            return;
+        }
+
+        //
+        // All sources use the CSR pattern as block pattern and sample the block values.
+        //
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        rocsparse_int nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(rocsparse_int i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = random_generator<T>();
+        }
     }
 
     void init_gebsr(host_gebsr_matrix<T>& that)
@@ -546,15 +1106,15 @@ public:
         that.nb            = this->arg_n;
         that.row_block_dim = this->arg_row_block_dim;
         that.col_block_dim = this->arg_col_block_dim;
-        this->m_instance->init_gebsr(that.ptr,
-                                     that.ind,
-                                     that.val,
-                                     that.mb,
-                                     that.nb,
-                                     that.nnzb,
-                                     that.row_block_dim,
-                                     that.col_block_dim,
-                                     that.base);
+        this->init_gebsr(that.ptr,
+                         that.ind,
+                         that.val,
+                         that.mb,
+                         that.nb,
+                         that.nnzb,
+                         that.row_block_dim,
+                         that.col_block_dim,
+                         that.base);
     }
 
     virtual void init_coo(std::vector<rocsparse_int>& coo_row_ind,
@@ -565,16 +1125,46 @@ public:
                           rocsparse_int&              nnz,
                           rocsparse_index_base        base)
     {
-        this->m_instance->init_coo(coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base);
+        if(this->m_key.empty())
+        {
+            this->m_instance->init_coo(coo_row_ind, coo_col_ind, coo_val, M, N, nnz, base);
+            return;
+        }
+
+        //
+        // All sources sample COO matrices sorted by row, such that they can be
+        // served from the cached CSR matrix.
+        //
+        auto entry = this->cached_csr(M, N);
+
+        M   = entry->M;
+        N   = entry->N;
+        nnz = entry->nnz;
+
+        coo_row_ind.resize(nnz);
+        coo_col_ind.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = entry->row_ptr[i]; j < entry->row_ptr[i + 1]; ++j)
+            {
+                coo_row_ind[j] = i + base;
+                coo_col_ind[j] = entry->col_ind[j] + base;
+            }
+        }
+
+        copy_values(coo_val, entry->val);
     }
 
     void init_coo(host_coo_matrix<T>& that)
     {
-        that.base = this->arg.base;
-        that.m    = this->arg.m;
-        that.n    = this->arg.n;
-        this->m_instance->init_coo(
-            that.row_ind, that.col_ind, that.val, that.m, that.n, that.nnz, that.base);
+        that.base = this->arg_base;
+        that.m    = this->arg_m;
+        that.n    = this->arg_n;
+        this->init_coo(that.row_ind, that.col_ind, that.val, that.m, that.n, that.nnz, that.base);
     }
 };
 
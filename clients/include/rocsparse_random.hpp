@@ -28,6 +28,8 @@
 
 #include "rocsparse_math.hpp"
 
+#include <cmath>
+#include <cstdint>
 #include <random>
 #include <type_traits>
 
@@ -95,6 +97,126 @@ public:
     }
 };
 
+/* ==================================================================================== */
+/*! \brief  Counter-based Philox4x32-10 random number generator
+ *
+ *  The generated sequence only depends on the key and the stream index, such that
+ *  independent streams (e.g. one per matrix row) can be sampled in parallel while the
+ *  result stays bit-identical, independently of the number of threads. Distributions
+ *  are implemented explicitly to be reproducible across standard library versions.
+ */
+class rocsparse_philox_rng
+{
+    static constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+    static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+    static constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+    static constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+
+    uint32_t m_key[2];
+    uint32_t m_counter[4];
+    uint32_t m_block[4];
+    int      m_idx;
+
+    void generate_block()
+    {
+        uint32_t c0 = m_counter[0];
+        uint32_t c1 = m_counter[1];
+        uint32_t c2 = m_counter[2];
+        uint32_t c3 = m_counter[3];
+        uint32_t k0 = m_key[0];
+        uint32_t k1 = m_key[1];
+
+        for(int round = 0; round < 10; ++round)
+        {
+            uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0;
+            uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2;
+
+            c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+            c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+            c1 = static_cast<uint32_t>(p1);
+            c3 = static_cast<uint32_t>(p0);
+
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        m_block[0] = c0;
+        m_block[1] = c1;
+        m_block[2] = c2;
+        m_block[3] = c3;
+
+        // Increment the 64 bit sequence counter
+        if(++m_counter[0] == 0)
+        {
+            ++m_counter[1];
+        }
+    }
+
+public:
+    using result_type = uint32_t;
+
+    rocsparse_philox_rng(uint64_t key, uint64_t stream)
+        : m_key{static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)}
+        , m_counter{0, 0, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)}
+        , m_block{0, 0, 0, 0}
+        , m_idx(4)
+    {
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return UINT32_MAX;
+    }
+
+    result_type operator()()
+    {
+        if(m_idx == 4)
+        {
+            generate_block();
+            m_idx = 0;
+        }
+
+        return m_block[m_idx++];
+    }
+
+    // Uniformly distributed integer in [a, b]
+    int64_t uniform_int(int64_t a, int64_t b)
+    {
+        uint64_t range = static_cast<uint64_t>(b - a) + 1;
+
+        if(range > UINT32_MAX)
+        {
+            uint64_t x = (static_cast<uint64_t>((*this)()) << 32) | (*this)();
+            return a + static_cast<int64_t>(x % range);
+        }
+
+        return a + static_cast<int64_t>((static_cast<uint64_t>((*this)()) * range) >> 32);
+    }
+
+    // Uniformly distributed double in [0, 1) with 53 bits of precision
+    double uniform()
+    {
+        uint64_t hi = (*this)() >> 5;
+        uint64_t lo = (*this)() >> 6;
+
+        return (hi * 67108864.0 + lo) * (1.0 / 9007199254740992.0);
+    }
+
+    // Normally distributed double around 0 with stddev 1 (Box-Muller)
+    double normal()
+    {
+        double u1 = 1.0 - uniform();
+        double u2 = uniform();
+
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+};
+
 /* ==================================================================================== */
 /* generate random number :*/
 
@@ -117,6 +239,33 @@ inline rocsparse_double_complex random_generator<rocsparse_double_complex>(int a
     return rocsparse_double_complex(random_generator<double>(a, b), random_generator<double>(a, b));
 }
 
+/*! \brief  generate a random number in range [a,b] from a counter-based stream */
+template <typename T>
+inline T random_generator(rocsparse_philox_rng& rng, int a = 1, int b = 10)
+{
+    return static_cast<T>(rng.uniform_int(a, b));
+}
+
+template <>
+inline rocsparse_float_complex
+    random_generator<rocsparse_float_complex>(rocsparse_philox_rng& rng, int a, int b)
+{
+    float re = random_generator<float>(rng, a, b);
+    float im = random_generator<float>(rng, a, b);
+
+    return rocsparse_float_complex(re, im);
+}
+
+template <>
+inline rocsparse_double_complex
+    random_generator<rocsparse_double_complex>(rocsparse_philox_rng& rng, int a, int b)
+{
+    double re = random_generator<double>(rng, a, b);
+    double im = random_generator<double>(rng, a, b);
+
+    return rocsparse_double_complex(re, im);
+}
+
 /*! \brief generate a random normally distributed number around 0 with stddev 1 */
 template <typename T>
 inline T random_generator_normal()
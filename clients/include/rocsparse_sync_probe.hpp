@@ -0,0 +1,75 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief rocsparse_sync_probe.hpp provides a probe that detects whether a routine
+ *  blocks the host until the work on the stream of a handle has been completed.
+ */
+
+#pragma once
+#ifndef ROCSPARSE_SYNC_PROBE_HPP
+#define ROCSPARSE_SYNC_PROBE_HPP
+
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse.h>
+
+//
+// The probe stalls the stream of a handle with a host callback, that waits until the
+// probe is released or a timeout expires. Any routine that is called in between and
+// synchronizes with the stream (e.g. by hipStreamSynchronize(), a blocking hipMemcpy() or
+// hipFree()) cannot return before the timeout has expired, which is recorded by the probe.
+//
+// rocsparse_sync_probe probe(handle);
+// CHECK_HIP_ERROR(probe.block());
+// <rocsparse routine>
+// bool synchronized = probe.release();
+//
+class rocsparse_sync_probe
+{
+private:
+    hipStream_t       m_stream;
+    double            m_timeout_ms;
+    bool              m_blocked;
+    std::atomic<bool> m_released;
+    std::atomic<bool> m_timed_out;
+
+    static void callback(hipStream_t stream, hipError_t status, void* data);
+
+public:
+    explicit rocsparse_sync_probe(rocsparse_handle handle, double timeout_ms = 1000.0);
+    ~rocsparse_sync_probe();
+
+    rocsparse_sync_probe(const rocsparse_sync_probe&) = delete;
+    rocsparse_sync_probe& operator=(const rocsparse_sync_probe&) = delete;
+
+    // Stall the stream until release() is called
+    hipError_t block();
+
+    // Resume the stream and return whether the host has been blocked by the stream since
+    // block() has been called
+    bool release();
+};
+
+#endif // ROCSPARSE_SYNC_PROBE_HPP
@@ -369,13 +369,26 @@ void testing_csx2dense(const Arguments& arg, FUNC1& csx2dense, FUNC2& dense2csx)
                                             LD));
         }
 
-        double gpu_time_used = get_time_us();
-        {
-            //
-            // Performance run
-            //
-            for(int iter = 0; iter < number_hot_calls; ++iter)
-            {
+        //
+        // Performance run
+        //
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(d_csx_val, cpu_csx_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(d_csx_row_col_ptr,
+                                          cpu_csx_row_col_ptr,
+                                          sizeof(rocsparse_int) * (DIMDIR + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(d_csx_col_row_ind,
+                                          cpu_csx_col_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+            },
+            [&]() {
                 CHECK_ROCSPARSE_ERROR(csx2dense(handle,
                                                 M,
                                                 N,
@@ -385,9 +398,13 @@ void testing_csx2dense(const Arguments& arg, FUNC1& csx2dense, FUNC2& dense2csx)
                                                 d_csx_col_row_ind,
                                                 (T*)d_dense_val,
                                                 LD));
-            }
-        }
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+            },
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(h_dense_val, d_dense_val, sizeof(T) * LD * N, hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = csx2dense_gbyte_count<DIRA, T>(M, N, nnz) / gpu_time_used * 1e6;
 
@@ -404,6 +421,7 @@ void testing_csx2dense(const Arguments& arg, FUNC1& csx2dense, FUNC2& dense2csx)
 	  << std::setw(20) << "msec"
 	  << std::setw(20) << "iter"
 	  << std::setw(20) << "verified"
+	  << timer.header()
 	  << std::endl;
 
         std::cout
@@ -415,6 +433,7 @@ void testing_csx2dense(const Arguments& arg, FUNC1& csx2dense, FUNC2& dense2csx)
 	  << std::setw(20) << gpu_time_used / 1e3
 	  << std::setw(20) << number_hot_calls
 	  << std::setw(20) << (arg.unit_check ? "yes" : "no")
+	  << timer.phases(number_hot_calls)
 	  << std::endl;
         // clang-format on
     }
@@ -377,13 +377,30 @@ void testing_dense2csx(const Arguments& arg, FUNC& dense2csx)
                                             d_csx_col_row_ind));
         }
 
-        double gpu_time_used = get_time_us();
-        {
-            //
-            // Performance run
-            //
-            for(int iter = 0; iter < number_hot_calls; ++iter)
-            {
+        //
+        // Performance run
+        //
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(d_dense_val, h_dense_val, sizeof(T) * LD * N, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_nnz(handle,
+                                                    direction,
+                                                    M,
+                                                    N,
+                                                    descr,
+                                                    (const T*)d_dense_val,
+                                                    LD,
+                                                    d_nnz_per_row_columns,
+                                                    &nnz));
+            },
+            [&]() {
                 CHECK_ROCSPARSE_ERROR(dense2csx(handle,
                                                 M,
                                                 N,
@@ -394,9 +411,23 @@ void testing_dense2csx(const Arguments& arg, FUNC& dense2csx)
                                                 (T*)d_csx_val,
                                                 d_csx_row_col_ptr,
                                                 d_csx_col_row_ind));
-            }
-        }
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+            },
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(cpu_csx_val, d_csx_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(cpu_csx_row_col_ptr,
+                                          d_csx_row_col_ptr,
+                                          sizeof(rocsparse_int) * (DIMDIR + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(cpu_csx_col_row_ind,
+                                          d_csx_col_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = dense2csx_gbyte_count<DIRA, T>(M, N, nnz) / gpu_time_used * 1e6;
 
@@ -413,6 +444,7 @@ void testing_dense2csx(const Arguments& arg, FUNC& dense2csx)
 	  << std::setw(20) << "msec"
 	  << std::setw(20) << "iter"
 	  << std::setw(20) << "verified"
+	  << timer.header()
 	  << std::endl;
 
         std::cout
@@ -424,6 +456,7 @@ void testing_dense2csx(const Arguments& arg, FUNC& dense2csx)
 	  << std::setw(20) << gpu_time_used / 1e3
 	  << std::setw(20) << number_hot_calls
 	  << std::setw(20) << (arg.unit_check ? "yes" : "no")
+	  << timer.phases(number_hot_calls)
 	  << std::endl;
         // clang-format on
     }
@@ -33,6 +33,7 @@
 #include "rocsparse_test.hpp"
 
 #include <hip/hip_runtime_api.h>
+#include <string>
 #include <vector>
 
 /* ==================================================================================== */
@@ -131,6 +132,7 @@ struct test_hyb
     rocsparse_int*          coo_row_ind;
     rocsparse_int*          coo_col_ind;
     void*                   coo_val;
+    bool                    user_storage;
 };
 
 /* ==================================================================================== */
@@ -174,6 +176,130 @@ double get_time_us(void);
  */
 double get_time_us_sync(hipStream_t stream);
 
+/* ==================================================================================== */
+/*! \brief  Phase timer that accumulates wall time of the phases of a benchmarked routine,
+ *  according to the timing mode. In cold mode, the device cache is flushed by
+ *  overwriting a buffer that exceeds the last level cache, each time a call is started.
+ */
+class rocsparse_phase_timer
+{
+    rocsparse_timing_mode    mode;
+    void*                    flush_buffer;
+    size_t                   flush_size;
+    int                      flush_count;
+    double                   mark;
+    double                   paused;
+    std::vector<std::string> names;
+    std::vector<double>      times;
+
+public:
+    explicit rocsparse_phase_timer(rocsparse_timing_mode timing_mode);
+    ~rocsparse_phase_timer();
+
+    rocsparse_phase_timer(const rocsparse_phase_timer&) = delete;
+    rocsparse_phase_timer& operator=(const rocsparse_phase_timer&) = delete;
+
+    // Start a call, flushing the device cache first in cold mode
+    void start();
+
+    // Accumulate the time since the last start or lap into the given phase
+    void lap(const char* phase);
+
+    // Exclude the time between pause and resume from the current phase
+    void pause();
+    void resume();
+
+    // Total accumulated time in microseconds
+    double total() const;
+
+    // Column headers and per call times in milliseconds of all phases, or an empty
+    // string in hot mode
+    std::string header() const;
+    std::string phases(int calls) const;
+
+    // Time calls to compute(). In hot mode, the calls are timed back-to-back. Otherwise,
+    // each call is timed separately, including upload() and download() of the operands
+    // in transfer mode, and setup() and clear() in end-to-end mode. A phase whose name
+    // is nullptr does not exist for the routine. Meta data from setup() is left in place.
+    template <typename UPLOAD, typename SETUP, typename COMPUTE, typename DOWNLOAD, typename CLEAR>
+    void run(int         calls,
+             UPLOAD      upload,
+             const char* setup_phase,
+             SETUP       setup,
+             COMPUTE     compute,
+             DOWNLOAD    download,
+             const char* clear_phase,
+             CLEAR       clear)
+    {
+        if(this->mode == rocsparse_timing_hot)
+        {
+            this->start();
+
+            for(int iter = 0; iter < calls; ++iter)
+            {
+                compute();
+            }
+
+            this->lap("compute");
+
+            return;
+        }
+
+        bool transfer   = this->mode == rocsparse_timing_transfer;
+        bool end_to_end = this->mode == rocsparse_timing_end_to_end;
+
+        // Start without meta data
+        if(end_to_end && clear_phase != nullptr)
+        {
+            clear();
+        }
+
+        for(int iter = 0; iter < calls; ++iter)
+        {
+            this->start();
+
+            if(transfer)
+            {
+                upload();
+                this->lap("h2d");
+            }
+
+            if(end_to_end && setup_phase != nullptr)
+            {
+                setup();
+                this->lap(setup_phase);
+            }
+
+            compute();
+            this->lap("compute");
+
+            if(transfer)
+            {
+                download();
+                this->lap("d2h");
+            }
+
+            if(end_to_end && clear_phase != nullptr)
+            {
+                clear();
+                this->lap(clear_phase);
+            }
+        }
+
+        if(end_to_end && clear_phase != nullptr)
+        {
+            setup();
+        }
+    }
+
+    // Time calls to a routine without setup and clear phases
+    template <typename UPLOAD, typename COMPUTE, typename DOWNLOAD>
+    void run(int calls, UPLOAD upload, COMPUTE compute, DOWNLOAD download)
+    {
+        this->run(calls, upload, nullptr, []() {}, compute, download, nullptr, []() {});
+    }
+};
+
 /* ==================================================================================== */
 // Return path of this executable
 std::string rocsparse_exepath();
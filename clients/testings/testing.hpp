@@ -26,5 +26,6 @@
 #include "gbyte.hpp"
 #include "rocsparse_check.hpp"
 #include "rocsparse_matrix_factory.hpp"
+#include "rocsparse_sync_probe.hpp"
 #include "utility.hpp"
 #include <rocsparse.hpp>
@@ -656,27 +656,59 @@ void testing_bsr2csr(const Arguments& arg)
                                                        dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsr2csr<T>(handle,
-                                                       direction,
-                                                       Mb,
-                                                       Nb,
-                                                       bsr_descr,
-                                                       dbsr_val,
-                                                       dbsr_row_ptr,
-                                                       dbsr_col_ind,
-                                                       block_dim,
-                                                       csr_descr,
-                                                       dcsr_val,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind(nnzb * block_dim * block_dim);
+        host_vector<T>             hcsr_val(nnzb * block_dim * block_dim);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr,
+                                          hbsr_row_ptr,
+                                          sizeof(rocsparse_int) * (Mb + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_col_ind,
+                                          hbsr_col_ind,
+                                          sizeof(rocsparse_int) * nnzb,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_val,
+                                          hbsr_val,
+                                          sizeof(T) * nnzb * block_dim * block_dim,
+                                          hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsr2csr<T>(handle,
+                                                           direction,
+                                                           Mb,
+                                                           Nb,
+                                                           bsr_descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           block_dim,
+                                                           csr_descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind,
+                                          dcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnzb * block_dim * block_dim,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_val,
+                                          dcsr_val,
+                                          sizeof(T) * nnzb * block_dim * block_dim,
+                                          hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = bsr2csr_gbyte_count<T>(Mb, block_dim, nnzb) / gpu_time_used * 1e6;
 
@@ -687,13 +719,14 @@ void testing_bsr2csr(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
                   << std::setw(12) << "Nb" << std::setw(12) << "blockdim" << std::setw(12) << "nnzb"
                   << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
                   << std::setw(12) << Nb << std::setw(12) << block_dim << std::setw(12) << nnzb
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
@@ -0,0 +1,435 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+// Corrupt the block structure of a valid BSR matrix, such that it violates the property
+// that corresponds to the given data status. Returns false, if the matrix is too small to
+// be corrupted.
+static bool bsr_check_corrupt(rocsparse_data_status       status,
+                              rocsparse_int               Mb,
+                              rocsparse_int               Nb,
+                              rocsparse_int               nnzb,
+                              std::vector<rocsparse_int>& bsr_row_ptr,
+                              std::vector<rocsparse_int>& bsr_col_ind,
+                              rocsparse_index_base        base)
+{
+    switch(status)
+    {
+    case rocsparse_data_status_success:
+        return true;
+    case rocsparse_data_status_invalid_offset_ptr:
+        bsr_row_ptr[Mb] += 1;
+        return true;
+    case rocsparse_data_status_invalid_index:
+        if(nnzb == 0)
+        {
+            return false;
+        }
+
+        // The last block has the largest block column index of its row
+        bsr_col_ind[nnzb - 1] = Nb + base;
+        return true;
+    case rocsparse_data_status_invalid_sorting:
+    case rocsparse_data_status_duplicate_entry:
+        for(rocsparse_int i = 0; i < Mb; ++i)
+        {
+            rocsparse_int j = bsr_row_ptr[i] - base;
+
+            if(bsr_row_ptr[i + 1] - base - j < 2)
+            {
+                continue;
+            }
+
+            if(status == rocsparse_data_status_invalid_sorting)
+            {
+                std::swap(bsr_col_ind[j], bsr_col_ind[j + 1]);
+            }
+            else
+            {
+                bsr_col_ind[j + 1] = bsr_col_ind[j];
+            }
+
+            return true;
+        }
+
+        return false;
+    default:
+        return false;
+    }
+}
+
+template <typename T>
+void testing_bsr_check_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dbsr_col_ind(safe_size);
+
+    if(!dbsr_row_ptr || !dbsr_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_data_status data_status;
+
+    // Test rocsparse_bsr_check()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(nullptr,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                nullptr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                nullptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                nullptr,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                -1,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                -1,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                -1,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                safe_size,
+                                                &data_status),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                dbsr_col_ind,
+                                                0,
+                                                &data_status),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_bsr_check(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M         = arg.M;
+    rocsparse_int               N         = arg.N;
+    rocsparse_int               block_dim = arg.block_dim;
+    rocsparse_index_base        base      = arg.baseA;
+    rocsparse_diag_type         diag      = arg.diag;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base and diagonal type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, diag));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || block_dim <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dbsr_col_ind(safe_size);
+
+        if(!dbsr_row_ptr || !dbsr_col_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_int Mb = (block_dim > 0) ? (M + block_dim - 1) / block_dim : M;
+        rocsparse_int Nb = (block_dim > 0) ? (N + block_dim - 1) / block_dim : N;
+
+        rocsparse_data_status data_status;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_bsr_check(
+                handle, Mb, Nb, 0, descr, dbsr_row_ptr, dbsr_col_ind, block_dim, &data_status),
+            (Mb < 0 || Nb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for BSR matrix
+    host_vector<rocsparse_int> hbsr_row_ptr;
+    host_vector<rocsparse_int> hbsr_col_ind;
+    host_vector<T>             hbsr_val;
+
+    // Sample matrix
+    rocsparse_int Mb = (M + block_dim - 1) / block_dim;
+    rocsparse_int Nb = (N + block_dim - 1) / block_dim;
+    rocsparse_int nnzb;
+    rocsparse_int row_block_dim = block_dim;
+    rocsparse_int col_block_dim = block_dim;
+    matrix_factory.init_gebsr(hbsr_row_ptr,
+                              hbsr_col_ind,
+                              hbsr_val,
+                              Mb,
+                              Nb,
+                              nnzb,
+                              row_block_dim,
+                              col_block_dim,
+                              base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int>         dbsr_row_ptr(Mb + 1);
+    device_vector<rocsparse_int>         dbsr_col_ind(nnzb);
+    device_vector<rocsparse_data_status> d_data_status_2(1);
+
+    if(!dbsr_row_ptr || !dbsr_col_ind || !d_data_status_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Check the sampled matrix and one corruption per structural property
+        for(int s = rocsparse_data_status_success; s <= rocsparse_data_status_duplicate_entry; ++s)
+        {
+            rocsparse_data_status corruption = static_cast<rocsparse_data_status>(s);
+
+            host_vector<rocsparse_int> hbsr_row_ptr_C = hbsr_row_ptr;
+            host_vector<rocsparse_int> hbsr_col_ind_C = hbsr_col_ind;
+
+            if(!bsr_check_corrupt(corruption, Mb, Nb, nnzb, hbsr_row_ptr_C, hbsr_col_ind_C, base))
+            {
+                continue;
+            }
+
+            // Copy data from CPU to device
+            CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr,
+                                      hbsr_row_ptr_C,
+                                      sizeof(rocsparse_int) * (Mb + 1),
+                                      hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dbsr_col_ind,
+                                      hbsr_col_ind_C,
+                                      sizeof(rocsparse_int) * nnzb,
+                                      hipMemcpyHostToDevice));
+
+            rocsparse_data_status h_data_status_1;
+            rocsparse_data_status h_data_status_2;
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsr_check(handle,
+                                                      Mb,
+                                                      Nb,
+                                                      nnzb,
+                                                      descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      block_dim,
+                                                      &h_data_status_1));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsr_check(handle,
+                                                      Mb,
+                                                      Nb,
+                                                      nnzb,
+                                                      descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      block_dim,
+                                                      d_data_status_2));
+
+            // Copy output to host
+            CHECK_HIP_ERROR(hipMemcpy(&h_data_status_2,
+                                      d_data_status_2,
+                                      sizeof(rocsparse_data_status),
+                                      hipMemcpyDeviceToHost));
+
+            // CPU bsr_check, the block structure is checked as CSR matrix
+            rocsparse_data_status h_data_status_gold
+                = host_csr_check(Mb,
+                                 Nb,
+                                 nnzb,
+                                 hbsr_row_ptr_C,
+                                 hbsr_col_ind_C,
+                                 base,
+                                 diag == rocsparse_diag_type_non_unit);
+
+            // Sampled matrices are valid up to missing diagonal blocks, each corruption
+            // violates exactly one property
+            if(corruption == rocsparse_data_status_success)
+            {
+                ASSERT_TRUE(h_data_status_gold == rocsparse_data_status_success
+                            || h_data_status_gold == rocsparse_data_status_missing_diagonal);
+            }
+            else
+            {
+                ASSERT_EQ(h_data_status_gold, corruption);
+            }
+
+            ASSERT_EQ(h_data_status_1, h_data_status_gold);
+            ASSERT_EQ(h_data_status_2, h_data_status_gold);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(
+            dbsr_row_ptr, hbsr_row_ptr, sizeof(rocsparse_int) * (Mb + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dbsr_col_ind, hbsr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsr_check(handle,
+                                                      Mb,
+                                                      Nb,
+                                                      nnzb,
+                                                      descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      block_dim,
+                                                      d_data_status_2));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsr_check(handle,
+                                                      Mb,
+                                                      Nb,
+                                                      nnzb,
+                                                      descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      block_dim,
+                                                      d_data_status_2));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csr_check_gbyte_count<T>(Mb, nnzb) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
+                  << std::setw(12) << "Nb" << std::setw(12) << "blockdim" << std::setw(12)
+                  << "nnzb" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
+                  << std::setw(12) << Nb << std::setw(12) << block_dim << std::setw(12) << nnzb
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_bsr_check_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_bsr_check<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
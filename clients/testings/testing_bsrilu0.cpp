@@ -22,6 +22,7 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 #include "testing_csrilu0.hpp"
 
@@ -766,7 +767,68 @@ void testing_bsrilu0(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(Mb,
+                                     hbsr_row_ptr,
+                                     hbsr_col_ind,
+                                     base,
+                                     rocsparse_fill_mode_lower,
+                                     rocsparse_operation_none,
+                                     levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrilu0_buffer_size<T>(handle,
+                                                                       direction,
+                                                                       Mb,
+                                                                       nnzb,
+                                                                       descr,
+                                                                       dbsr_val_1,
+                                                                       dbsr_row_ptr,
+                                                                       dbsr_col_ind,
+                                                                       block_dim,
+                                                                       info,
+                                                                       &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrilu0_analysis<T>(handle,
+                                                                    direction,
+                                                                    Mb,
+                                                                    nnzb,
+                                                                    descr,
+                                                                    dbsr_val_1,
+                                                                    dbsr_row_ptr,
+                                                                    dbsr_col_ind,
+                                                                    block_dim,
+                                                                    info,
+                                                                    policy,
+                                                                    spol,
+                                                                    dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrilu0<T>(handle,
+                                                           direction,
+                                                           Mb,
+                                                           nnzb,
+                                                           descr,
+                                                           dbsr_val_1,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           block_dim,
+                                                           info,
+                                                           spol,
+                                                           dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_bsrilu0_clear(handle, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -254,6 +254,11 @@ void testing_bsrmv(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set matrix type, fill mode and diagonal type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, arg.mattype));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, arg.uplo));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, arg.diag));
+
     // BSR dimensions
 
     rocsparse_int mb = (bsr_dim > 0) ? (M + bsr_dim - 1) / bsr_dim : 0;
@@ -456,20 +461,58 @@ void testing_bsrmv(const Arguments& arg)
             hbsr_val, dbsr_val, sizeof(T) * nnzb * bsr_dim * bsr_dim, hipMemcpyDeviceToHost));
 
         // CPU bsrmv
-        host_bsrmv<T>(dir,
-                      trans,
-                      mb,
-                      nb,
-                      nnzb,
-                      h_alpha,
-                      hbsr_row_ptr,
-                      hbsr_col_ind,
-                      hbsr_val,
-                      bsr_dim,
-                      hx,
-                      h_beta,
-                      hy_gold,
-                      base);
+        if(arg.mattype == rocsparse_matrix_type_general)
+        {
+            host_bsrmv<T>(dir,
+                          trans,
+                          mb,
+                          nb,
+                          nnzb,
+                          h_alpha,
+                          hbsr_row_ptr,
+                          hbsr_col_ind,
+                          hbsr_val,
+                          bsr_dim,
+                          hx,
+                          h_beta,
+                          hy_gold,
+                          base);
+        }
+        else
+        {
+            // The padded entries of the BSR blocks are zero, such that the stored
+            // triangle can be expanded from the sampled CSR matrix
+            std::vector<rocsparse_int> hgen_row_ptr;
+            std::vector<rocsparse_int> hgen_col_ind;
+            std::vector<T>             hgen_val;
+
+            host_csr_to_general(trans,
+                                arg.mattype,
+                                arg.uplo,
+                                arg.diag,
+                                M,
+                                hcsr_row_ptr,
+                                hcsr_col_ind,
+                                hcsr_val,
+                                hgen_row_ptr,
+                                hgen_col_ind,
+                                hgen_val,
+                                base);
+
+            host_csrmv<T>(rocsparse_operation_none,
+                          M,
+                          M,
+                          hgen_row_ptr[M] - base,
+                          h_alpha,
+                          hgen_row_ptr.data(),
+                          hgen_col_ind.data(),
+                          hgen_val.data(),
+                          hx,
+                          h_beta,
+                          hy_gold,
+                          base,
+                          false);
+        }
 
         near_check_general<T>(1, M, 1, hy_gold, hy_1);
         near_check_general<T>(1, M, 1, hy_gold, hy_2);
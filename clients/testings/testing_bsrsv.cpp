@@ -21,6 +21,7 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 
 template <typename T>
@@ -436,6 +437,21 @@ void testing_bsrsv_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_bsrsv_zero_pivot(handle, info, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_bsrsv_level_info()
+    rocsparse_level_info level_info;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_bsrsv_level_info(nullptr, rocsparse_operation_none, descr, info, &level_info),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_bsrsv_level_info(handle, rocsparse_operation_none, nullptr, info, &level_info),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_bsrsv_level_info(handle, rocsparse_operation_none, descr, nullptr, &level_info),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_bsrsv_level_info(handle, rocsparse_operation_none, descr, info, nullptr),
+        rocsparse_status_invalid_pointer);
+
     // Test rocsparse_bsrsv_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_bsrsv_clear(nullptr, info), rocsparse_status_invalid_handle);
     EXPECT_ROCSPARSE_STATUS(rocsparse_bsrsv_clear(handle, nullptr),
@@ -831,6 +847,17 @@ void testing_bsrsv(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
 
+        // Check level schedule, no meta data is collected for empty matrices
+        rocsparse_level_info     h_level_info;
+        rocsparse_level_schedule h_level_gold;
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_level_info(handle, trans, descr, info, &h_level_info));
+        if(nnzb > 0)
+        {
+            rocsparse_csr_analyze_levels(
+                mb, hbsr_row_ptr, hbsr_col_ind, base, uplo, trans, h_level_gold);
+        }
+        unit_check_level_info(h_level_gold, h_level_info);
+
         // Check solution vector if no pivot has been found
         if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
         {
@@ -839,7 +866,77 @@ void testing_bsrsv(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Level schedule of the block rows
+        host_vector<rocsparse_int> hbsr_row_ptr(mb + 1);
+        host_vector<rocsparse_int> hbsr_col_ind(nnzb);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_row_ptr, dbsr_row_ptr, sizeof(rocsparse_int) * (mb + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_col_ind, dbsr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToHost));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(mb, hbsr_row_ptr, hbsr_col_ind, base, uplo, trans, levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_buffer_size<T>(handle,
+                                                                     dir,
+                                                                     trans,
+                                                                     mb,
+                                                                     nnzb,
+                                                                     descr,
+                                                                     dbsr_val,
+                                                                     dbsr_row_ptr,
+                                                                     dbsr_col_ind,
+                                                                     bsr_dim,
+                                                                     info,
+                                                                     &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_analysis<T>(handle,
+                                                                  dir,
+                                                                  trans,
+                                                                  mb,
+                                                                  nnzb,
+                                                                  descr,
+                                                                  dbsr_val,
+                                                                  dbsr_row_ptr,
+                                                                  dbsr_col_ind,
+                                                                  bsr_dim,
+                                                                  info,
+                                                                  policy,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_solve<T>(handle,
+                                                               dir,
+                                                               trans,
+                                                               mb,
+                                                               nnzb,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dbsr_val,
+                                                               dbsr_row_ptr,
+                                                               dbsr_col_ind,
+                                                               bsr_dim,
+                                                               info,
+                                                               dx,
+                                                               dy_1,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_clear(handle, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -901,30 +998,94 @@ void testing_bsrsv(const Arguments& arg)
 
         gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
 
-        double gpu_solve_time_used = get_time_us();
+        // Host copy of the BSR matrix for the transfer timing
+        host_vector<rocsparse_int> hbsr_row_ptr(mb + 1);
+        host_vector<rocsparse_int> hbsr_col_ind(nnzb);
+        host_vector<T>             hbsr_val(nnzb * bsr_dim * bsr_dim);
+        host_vector<T>             hy_1(mb * bsr_dim);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_solve<T>(handle,
-                                                           dir,
-                                                           trans,
-                                                           mb,
-                                                           nnzb,
-                                                           &h_alpha,
-                                                           descr,
-                                                           dbsr_val,
-                                                           dbsr_row_ptr,
-                                                           dbsr_col_ind,
-                                                           bsr_dim,
-                                                           info,
-                                                           dx,
-                                                           dy_1,
-                                                           spol,
-                                                           dbuffer));
-        }
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_row_ptr, dbsr_row_ptr, sizeof(rocsparse_int) * (mb + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_col_ind, dbsr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_val, dbsr_val, sizeof(T) * nnzb * bsr_dim * bsr_dim, hipMemcpyDeviceToHost));
 
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr,
+                                          hbsr_row_ptr,
+                                          sizeof(rocsparse_int) * (mb + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_col_ind,
+                                          hbsr_col_ind,
+                                          sizeof(rocsparse_int) * nnzb,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_val,
+                                          hbsr_val,
+                                          sizeof(T) * nnzb * bsr_dim * bsr_dim,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * nb * bsr_dim, hipMemcpyHostToDevice));
+            },
+            "analysis",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_buffer_size<T>(handle,
+                                                                     dir,
+                                                                     trans,
+                                                                     mb,
+                                                                     nnzb,
+                                                                     descr,
+                                                                     dbsr_val,
+                                                                     dbsr_row_ptr,
+                                                                     dbsr_col_ind,
+                                                                     bsr_dim,
+                                                                     info,
+                                                                     &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_analysis<T>(handle,
+                                                                  dir,
+                                                                  trans,
+                                                                  mb,
+                                                                  nnzb,
+                                                                  descr,
+                                                                  dbsr_val,
+                                                                  dbsr_row_ptr,
+                                                                  dbsr_col_ind,
+                                                                  bsr_dim,
+                                                                  info,
+                                                                  apol,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_solve<T>(handle,
+                                                               dir,
+                                                               trans,
+                                                               mb,
+                                                               nnzb,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dbsr_val,
+                                                               dbsr_row_ptr,
+                                                               dbsr_col_ind,
+                                                               bsr_dim,
+                                                               info,
+                                                               dx,
+                                                               dy_1,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hy_1, dy_1, sizeof(T) * mb * bsr_dim, hipMemcpyDeviceToHost));
+            },
+            "clear",
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_bsrsv_clear(handle, info)); });
+
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops = csrsv_gflop_count<T>(mb * bsr_dim, nnzb * bsr_dim * bsr_dim, diag)
                             / gpu_solve_time_used * 1e6;
@@ -940,7 +1101,7 @@ void testing_bsrsv(const Arguments& arg)
                   << "analysis_policy" << std::setw(16) << "solve_policy" << std::setw(12)
                   << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "analysis_msec"
                   << std::setw(16) << "solve_msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << h_alpha
                   << std::setw(12) << std::min(h_analysis_pivot_gold[0], h_solve_pivot_gold[0])
@@ -951,7 +1112,8 @@ void testing_bsrsv(const Arguments& arg)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
                   << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Clear bsrsv meta data
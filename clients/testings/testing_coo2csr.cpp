@@ -144,16 +144,28 @@ void testing_coo2csr(const Arguments& arg)
                 rocsparse_coo2csr(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(
-                rocsparse_coo2csr(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcoo_row_ind,
+                                          hcoo_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_coo2csr(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = coo2csr_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
 
@@ -163,12 +175,13 @@ void testing_coo2csr(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
@@ -365,27 +365,44 @@ void testing_coomv(const Arguments& arg)
                                                      dy_1));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(handle,
-                                                     trans,
-                                                     M,
-                                                     N,
-                                                     nnz,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dcoo_val,
-                                                     dcoo_row_ind,
-                                                     dcoo_col_ind,
-                                                     dx,
-                                                     &h_beta,
-                                                     dy_1));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcoo_row_ind,
+                                          hcoo_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcoo_col_ind,
+                                          hcoo_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcoo_val, hcoo_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M, hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(handle,
+                                                         trans,
+                                                         M,
+                                                         N,
+                                                         nnz,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcoo_val,
+                                                         dcoo_row_ind,
+                                                         dcoo_col_ind,
+                                                         dx,
+                                                         &h_beta,
+                                                         dy_1));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops
             = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
@@ -399,13 +416,15 @@ void testing_coomv(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
                   << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << h_alpha << std::setw(12) << h_beta << std::setw(12)
                   << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(12)
                   << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
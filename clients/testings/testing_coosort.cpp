@@ -260,6 +260,40 @@ void testing_coosort(const Arguments& arg)
 
             unit_check_general<T>(1, nnz, 1, hcoo_val_gold, hcoo_val);
         }
+
+        // Sorting sorted input must neither change the indices nor the permutation
+        host_vector<rocsparse_int> hperm_sorted(nnz);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm_sorted, dperm, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        // Sorting is not allowed to synchronize the host
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
+        if(by_row)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_coosort_by_row(
+                handle, M, N, nnz, dcoo_row_ind, dcoo_col_ind, permute ? dperm : nullptr, dbuffer));
+        }
+        else
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_coosort_by_column(
+                handle, M, N, nnz, dcoo_row_ind, dcoo_col_ind, permute ? dperm : nullptr, dbuffer));
+        }
+
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcoo_row_ind, dcoo_row_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcoo_col_ind, dcoo_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm, dperm, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcoo_row_ind_gold, hcoo_row_ind);
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcoo_col_ind_gold, hcoo_col_ind);
+        unit_check_general<rocsparse_int>(1, nnz, 1, hperm_sorted, hperm);
     }
 
     if(arg.timing)
@@ -390,6 +390,47 @@ void testing_csr2bsr_bad_arg(const Arguments& arg)
                                                  dbsr_row_ptr,
                                                  dbsr_col_ind),
                             rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2bsr_map()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_map(nullptr,
+                                                  rocsparse_direction_row,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  bsr_descr,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_map(handle,
+                                                  rocsparse_direction_row,
+                                                  -1,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  bsr_descr,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_map(handle,
+                                                  rocsparse_direction_row,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  bsr_descr,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -584,6 +625,11 @@ void testing_csr2bsr(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
 
         device_vector<rocsparse_int> dbsr_nnzb(1);
+
+        // With device pointers, no host synchronization is allowed
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
                                                     direction,
                                                     M,
@@ -596,6 +642,9 @@ void testing_csr2bsr(const Arguments& arg)
                                                     dbsr_row_ptr,
                                                     dbsr_nnzb));
 
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         rocsparse_int hbsr_nnzb_copied_from_device = 0;
         CHECK_HIP_ERROR(hipMemcpy(&hbsr_nnzb_copied_from_device,
                                   dbsr_nnzb,
@@ -616,6 +665,8 @@ void testing_csr2bsr(const Arguments& arg)
         }
 
         // Finish conversion
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
                                                    direction,
                                                    M,
@@ -630,6 +681,9 @@ void testing_csr2bsr(const Arguments& arg)
                                                    dbsr_row_ptr,
                                                    dbsr_col_ind));
 
+        synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         // Allocate host memory for BSR col indices and values array
         host_vector<rocsparse_int> hbsr_col_ind(hbsr_nnzb);
         host_vector<T>             hbsr_val(hbsr_nnzb * block_dim * block_dim);
@@ -646,6 +700,61 @@ void testing_csr2bsr(const Arguments& arg)
 
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
+        // Mapping of CSR entries onto the BSR values
+        host_vector<rocsparse_int>   hbsr_map(nnz_C);
+        host_vector<rocsparse_int>   hbsr_map_gold;
+        device_vector<rocsparse_int> dbsr_map(nnz_C);
+
+        if(!dbsr_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_map(handle,
+                                                    direction,
+                                                    M,
+                                                    N,
+                                                    csr_descr,
+                                                    dcsr_row_ptr_C,
+                                                    dcsr_col_ind_C,
+                                                    block_dim,
+                                                    bsr_descr,
+                                                    dbsr_row_ptr,
+                                                    dbsr_col_ind,
+                                                    dbsr_map));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hbsr_map, dbsr_map, sizeof(rocsparse_int) * nnz_C, hipMemcpyDeviceToHost));
+
+        host_csr_to_gebsr_map(direction,
+                              M,
+                              hcsr_row_ptr_C,
+                              hcsr_col_ind_C,
+                              block_dim,
+                              block_dim,
+                              csr_base,
+                              hbsr_row_ptr,
+                              hbsr_col_ind,
+                              bsr_base,
+                              hbsr_map_gold);
+
+        unit_check_general<rocsparse_int>(1, nnz_C, 1, hbsr_map_gold, hbsr_map);
+
+        // Refreshing the values of a zero initialized BSR matrix through the mapping
+        // reproduces the values of the conversion
+        host_vector<T> hbsr_val_refresh(hbsr_nnzb * block_dim * block_dim);
+
+        CHECK_HIP_ERROR(hipMemset(dbsr_val, 0, sizeof(T) * hbsr_nnzb * block_dim * block_dim));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+            handle, nnz_C, dcsr_val_C, dbsr_map, dbsr_val, rocsparse_index_base_zero));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_val_refresh,
+                                  dbsr_val,
+                                  sizeof(T) * hbsr_nnzb * block_dim * block_dim,
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general<T>(1, hbsr_nnzb * block_dim * block_dim, 1, hbsr_val, hbsr_val_refresh);
+
         // Convert BSR matrix back to CSR for comparison with original compressed CSR matrix
         M = Mb * block_dim;
         N = Nb * block_dim;
@@ -816,27 +925,104 @@ void testing_csr2bsr(const Arguments& arg)
             return;
         }
 
-        double gpu_time_used = get_time_us();
+        host_vector<rocsparse_int> hbsr_col_ind(hbsr_nnzb);
+        host_vector<T>             hbsr_val(hbsr_nnzb * block_dim * block_dim);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_C,
+                                          hcsr_row_ptr_C,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_C,
+                                          hcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * nnz_C,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_C, hcsr_val_C, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                            direction,
+                                                            M,
+                                                            N,
+                                                            csr_descr,
+                                                            dcsr_row_ptr_C,
+                                                            dcsr_col_ind_C,
+                                                            block_dim,
+                                                            bsr_descr,
+                                                            dbsr_row_ptr,
+                                                            &hbsr_nnzb));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
+                                                           direction,
+                                                           M,
+                                                           N,
+                                                           csr_descr,
+                                                           dcsr_val_C,
+                                                           dcsr_row_ptr_C,
+                                                           dcsr_col_ind_C,
+                                                           block_dim,
+                                                           bsr_descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr,
+                                          dbsr_row_ptr,
+                                          sizeof(rocsparse_int) * (Mb + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind,
+                                          dbsr_col_ind,
+                                          sizeof(rocsparse_int) * hbsr_nnzb,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_val,
+                                          dbsr_val,
+                                          sizeof(T) * hbsr_nnzb * block_dim * block_dim,
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        // Value refresh through the BSR mapping
+        device_vector<rocsparse_int> dbsr_map(nnz_C);
+
+        if(!dbsr_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_map(handle,
+                                                    direction,
+                                                    M,
+                                                    N,
+                                                    csr_descr,
+                                                    dcsr_row_ptr_C,
+                                                    dcsr_col_ind_C,
+                                                    block_dim,
+                                                    bsr_descr,
+                                                    dbsr_row_ptr,
+                                                    dbsr_col_ind,
+                                                    dbsr_map));
+
+        double gpu_refresh_time_used = get_time_us();
 
-        // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
-                                                       direction,
-                                                       M,
-                                                       N,
-                                                       csr_descr,
-                                                       dcsr_val_C,
-                                                       dcsr_row_ptr_C,
-                                                       dcsr_col_ind_C,
-                                                       block_dim,
-                                                       bsr_descr,
-                                                       dbsr_val,
-                                                       dbsr_row_ptr,
-                                                       dbsr_col_ind));
+            CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+                handle, nnz_C, dcsr_val_C, dbsr_map, dbsr_val, rocsparse_index_base_zero));
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        gpu_refresh_time_used = (get_time_us() - gpu_refresh_time_used) / number_hot_calls;
 
         double gpu_gbyte
             = csr2bsr_gbyte_count<T>(M, Mb, nnz, hbsr_nnzb, block_dim) / gpu_time_used * 1e6;
@@ -847,14 +1033,16 @@ void testing_csr2bsr(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
                   << std::setw(12) << "Nb" << std::setw(12) << "blockdim" << std::setw(12) << "nnzb"
-                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
+                  << "refresh" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
                   << std::setw(12) << Nb << std::setw(12) << block_dim << std::setw(12) << hbsr_nnzb
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(12) << gpu_refresh_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 }
 
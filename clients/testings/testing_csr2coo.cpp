@@ -141,16 +141,28 @@ void testing_csr2coo(const Arguments& arg)
                 rocsparse_csr2coo(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(
-                rocsparse_csr2coo(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csr2coo(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcoo_row_ind,
+                                          dcoo_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = csr2coo_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
 
@@ -160,12 +172,13 @@ void testing_csr2coo(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
@@ -200,6 +200,28 @@ void testing_csr2csc_bad_arg(const Arguments& arg)
                                                  rocsparse_index_base_zero,
                                                  nullptr),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2csc_map()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csc_map(
+            nullptr, safe_size, safe_size, safe_size, dcsr_col_ind, dcsc_row_ind, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csc_map(
+            handle, -1, safe_size, safe_size, dcsr_col_ind, dcsc_row_ind, dbuffer),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csc_map(
+            handle, safe_size, safe_size, safe_size, nullptr, dcsc_row_ind, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csc_map(
+            handle, safe_size, safe_size, safe_size, dcsr_col_ind, nullptr, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csc_map(
+            handle, safe_size, safe_size, safe_size, dcsr_col_ind, dcsc_row_ind, nullptr),
+        rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -348,6 +370,49 @@ void testing_csr2csc(const Arguments& arg)
         if(action == rocsparse_action_numeric)
         {
             unit_check_general<T>(1, nnz, 1, hcsc_val_gold, hcsc_val);
+
+            // Mapping of CSR entries onto the CSC matrix
+            host_vector<rocsparse_int>   hcsc_map(nnz);
+            host_vector<rocsparse_int>   hcsc_map_gold;
+            device_vector<rocsparse_int> dcsc_map(nnz);
+
+            if(!dcsc_map)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2csc_map(handle, M, N, nnz, dcsr_col_ind, dcsc_map, dbuffer));
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsc_map, dcsc_map, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+            host_csr_to_csc_map(M, N, nnz, hcsr_row_ptr, hcsr_col_ind, hcsc_map_gold, base);
+
+            unit_check_general<rocsparse_int>(1, nnz, 1, hcsc_map_gold, hcsc_map);
+
+            // Refresh the CSC values from new CSR values
+            rocsparse_init<T>(hcsr_val, 1, nnz, 1);
+
+            CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+                handle, nnz, dcsr_val, dcsc_map, dcsc_val, rocsparse_index_base_zero));
+            CHECK_HIP_ERROR(hipMemcpy(hcsc_val, dcsc_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+            host_csr_to_csc<T>(M,
+                               N,
+                               nnz,
+                               hcsr_row_ptr,
+                               hcsr_col_ind,
+                               hcsr_val,
+                               hcsc_row_ind_gold,
+                               hcsc_col_ptr_gold,
+                               hcsc_val_gold,
+                               action,
+                               base);
+
+            unit_check_general<T>(1, nnz, 1, hcsc_val_gold, hcsc_val);
         }
     }
 
@@ -374,27 +439,87 @@ void testing_csr2csc(const Arguments& arg)
                                                        dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            "buffer_size",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size(handle,
+                                                                    M,
+                                                                    N,
+                                                                    nnz,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    action,
+                                                                    &size));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc<T>(handle,
+                                                           M,
+                                                           N,
+                                                           nnz,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           dcsc_val,
+                                                           dcsc_row_ind,
+                                                           dcsc_col_ptr,
+                                                           action,
+                                                           base,
+                                                           dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsc_row_ind,
+                                          dcsc_row_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsc_col_ptr,
+                                          dcsc_col_ptr,
+                                          sizeof(rocsparse_int) * (N + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsc_val, dcsc_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        // Value refresh through the CSC mapping
+        device_vector<rocsparse_int> dcsc_map(nnz);
+
+        if(!dcsc_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr2csc_map(handle, M, N, nnz, dcsr_col_ind, dcsc_map, dbuffer));
+
+        double gpu_refresh_time_used = get_time_us();
 
-        // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc<T>(handle,
-                                                       M,
-                                                       N,
-                                                       nnz,
-                                                       dcsr_val,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind,
-                                                       dcsc_val,
-                                                       dcsc_row_ind,
-                                                       dcsc_col_ptr,
-                                                       action,
-                                                       base,
-                                                       dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+                handle, nnz, dcsr_val, dcsc_map, dcsc_val, rocsparse_index_base_zero));
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        gpu_refresh_time_used = (get_time_us() - gpu_refresh_time_used) / number_hot_calls;
 
         double gpu_gbyte = csr2csc_gbyte_count<T>(M, N, nnz, action) / gpu_time_used * 1e6;
 
@@ -404,12 +529,15 @@ void testing_csr2csc(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "action" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "refresh" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << rocsparse_action2string(action) << std::setw(12) << gpu_gbyte
-                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << gpu_refresh_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 
     // Free buffer
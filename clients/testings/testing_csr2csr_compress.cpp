@@ -415,27 +415,61 @@ void testing_csr2csr_compress(const Arguments& arg)
             return;
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr_compress<T>(handle,
-                                                                M,
-                                                                N,
-                                                                descr_A,
-                                                                dcsr_val_A,
-                                                                dcsr_row_ptr_A,
-                                                                dcsr_col_ind_A,
-                                                                nnz_A,
-                                                                dnnz_per_row,
-                                                                dcsr_val_C,
-                                                                dcsr_row_ptr_C,
-                                                                dcsr_col_ind_C,
-                                                                tol));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        host_vector<rocsparse_int> hcsr_col_ind_C(nnz_C);
+        host_vector<T>             hcsr_val_C(nnz_C);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
+                                          hcsr_row_ptr_A,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_A,
+                                          hcsr_col_ind_A,
+                                          sizeof(rocsparse_int) * nnz_A,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_nnz_compress<T>(
+                    handle, M, descr_A, dcsr_val_A, dcsr_row_ptr_A, dnnz_per_row, &nnz_C, tol));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2csr_compress<T>(handle,
+                                                                    M,
+                                                                    N,
+                                                                    descr_A,
+                                                                    dcsr_val_A,
+                                                                    dcsr_row_ptr_A,
+                                                                    dcsr_col_ind_A,
+                                                                    nnz_A,
+                                                                    dnnz_per_row,
+                                                                    dcsr_val_C,
+                                                                    dcsr_row_ptr_C,
+                                                                    dcsr_col_ind_C,
+                                                                    tol));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C,
+                                          dcsr_row_ptr_C,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                          dcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * nnz_C,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = csr2csr_compress_gbyte_count<T>(M, nnz_A, nnz_C) / gpu_time_used * 1e6;
 
@@ -445,12 +479,14 @@ void testing_csr2csr_compress(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz_A"
                   << std::setw(12) << "nnz_C" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz_A
                   << std::setw(12) << nnz_C << std::setw(12) << gpu_gbyte << std::setw(12)
                   << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
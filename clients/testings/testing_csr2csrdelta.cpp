@@ -0,0 +1,661 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csr2csrdelta_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size      = 100;
+    static const rocsparse_int safe_block_dim = 4;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+    device_vector<rocsparse_int> dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2csrdelta_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csrdelta_buffer_size(
+            nullptr, safe_size, safe_size, dcsr_row_ptr, safe_block_dim, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csrdelta_buffer_size(
+            handle, safe_size, safe_size, nullptr, safe_block_dim, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csrdelta_buffer_size(
+            handle, safe_size, safe_size, dcsr_row_ptr, safe_block_dim, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2csrdelta_buffer_size(
+            handle, safe_size, safe_size, dcsr_row_ptr, 0, &buffer_size),
+        rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2csrdelta_nnz()
+    rocsparse_int csrdelta_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(nullptr,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       nullptr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       nullptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       nullptr,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       nullptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       nullptr,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       nullptr,
+                                                       dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       safe_block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       0,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       &csrdelta_nnz,
+                                                       dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2csrdelta()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(nullptr,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   nullptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   nullptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   nullptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   nullptr,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   nullptr,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   0,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr2csrdelta(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M         = arg.M;
+    rocsparse_int               N         = arg.N;
+    rocsparse_int               block_dim = arg.block_dim;
+    rocsparse_index_base        base      = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+           || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csr2csrdelta_buffer_size(handle, M, N, dcsr_row_ptr, block_dim, &buffer_size),
+            (M < 0 || N < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        rocsparse_int csrdelta_nnz;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta_nnz(handle,
+                                                           M,
+                                                           N,
+                                                           descr,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           block_dim,
+                                                           dcsrdelta_block_ptr,
+                                                           dcsrdelta_width,
+                                                           &csrdelta_nnz,
+                                                           dbuffer),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdelta(handle,
+                                                       M,
+                                                       N,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       dcsrdelta_row_col,
+                                                       dcsrdelta_col_ind),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    rocsparse_int nblocks = (M - 1) / block_dim + 1;
+
+    // CPU csr2csrdelta
+    host_vector<rocsparse_int> hcsrdelta_block_ptr_gold;
+    host_vector<rocsparse_int> hcsrdelta_width_gold;
+    host_vector<rocsparse_int> hcsrdelta_row_col_gold;
+    host_vector<rocsparse_int> hcsrdelta_col_ind_gold;
+    rocsparse_int              csrdelta_nnz_gold;
+
+    host_csr_to_csrdelta(M,
+                         hcsr_row_ptr,
+                         hcsr_col_ind,
+                         block_dim,
+                         hcsrdelta_block_ptr_gold,
+                         hcsrdelta_width_gold,
+                         hcsrdelta_row_col_gold,
+                         hcsrdelta_col_ind_gold,
+                         csrdelta_nnz_gold,
+                         base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(nblocks + 1);
+    device_vector<rocsparse_int> dcsrdelta_width(nblocks);
+    device_vector<rocsparse_int> dcsrdelta_row_col(M);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(csrdelta_nnz_gold);
+    device_vector<rocsparse_int> dcsrdelta_nnz(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dcsrdelta_nnz)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr2csrdelta_buffer_size(handle, M, N, dcsr_row_ptr, block_dim, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Obtain block widths, block pointers and number of words
+        rocsparse_int csrdelta_nnz;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta_nnz(handle,
+                                                         M,
+                                                         N,
+                                                         descr,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         dcsrdelta_block_ptr,
+                                                         dcsrdelta_width,
+                                                         &csrdelta_nnz,
+                                                         dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta_nnz(handle,
+                                                         M,
+                                                         N,
+                                                         descr,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         dcsrdelta_block_ptr,
+                                                         dcsrdelta_width,
+                                                         dcsrdelta_nnz,
+                                                         dbuffer));
+
+        rocsparse_int hcsrdelta_nnz;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hcsrdelta_nnz, dcsrdelta_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &csrdelta_nnz_gold, &csrdelta_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &csrdelta_nnz_gold, &hcsrdelta_nnz);
+
+        // Perform delta compression
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta(handle,
+                                                     M,
+                                                     N,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     block_dim,
+                                                     dcsrdelta_block_ptr,
+                                                     dcsrdelta_width,
+                                                     dcsrdelta_row_col,
+                                                     dcsrdelta_col_ind));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsrdelta_block_ptr(nblocks + 1);
+        host_vector<rocsparse_int> hcsrdelta_width(nblocks);
+        host_vector<rocsparse_int> hcsrdelta_row_col(M);
+        host_vector<rocsparse_int> hcsrdelta_col_ind(csrdelta_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_block_ptr,
+                                  dcsrdelta_block_ptr,
+                                  sizeof(rocsparse_int) * (nblocks + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_width,
+                                  dcsrdelta_width,
+                                  sizeof(rocsparse_int) * nblocks,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_row_col,
+                                  dcsrdelta_row_col,
+                                  sizeof(rocsparse_int) * M,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_col_ind,
+                                  dcsrdelta_col_ind,
+                                  sizeof(rocsparse_int) * csrdelta_nnz,
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(
+            1, nblocks + 1, 1, hcsrdelta_block_ptr_gold, hcsrdelta_block_ptr);
+        unit_check_general<rocsparse_int>(1, nblocks, 1, hcsrdelta_width_gold, hcsrdelta_width);
+        unit_check_general<rocsparse_int>(1, M, 1, hcsrdelta_row_col_gold, hcsrdelta_row_col);
+        unit_check_general<rocsparse_int>(
+            1, csrdelta_nnz, 1, hcsrdelta_col_ind_gold, hcsrdelta_col_ind);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int csrdelta_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta_nnz(handle,
+                                                             M,
+                                                             N,
+                                                             descr,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             block_dim,
+                                                             dcsrdelta_block_ptr,
+                                                             dcsrdelta_width,
+                                                             &csrdelta_nnz,
+                                                             dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta(handle,
+                                                         M,
+                                                         N,
+                                                         descr,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         dcsrdelta_block_ptr,
+                                                         dcsrdelta_width,
+                                                         dcsrdelta_row_col,
+                                                         dcsrdelta_col_ind));
+        }
+
+        host_vector<rocsparse_int> hcsrdelta_block_ptr(nblocks + 1);
+        host_vector<rocsparse_int> hcsrdelta_width(nblocks);
+        host_vector<rocsparse_int> hcsrdelta_row_col(M);
+        host_vector<rocsparse_int> hcsrdelta_col_ind(csrdelta_nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta_nnz(handle,
+                                                                 M,
+                                                                 N,
+                                                                 descr,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 block_dim,
+                                                                 dcsrdelta_block_ptr,
+                                                                 dcsrdelta_width,
+                                                                 &csrdelta_nnz,
+                                                                 dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdelta(handle,
+                                                             M,
+                                                             N,
+                                                             descr,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             block_dim,
+                                                             dcsrdelta_block_ptr,
+                                                             dcsrdelta_width,
+                                                             dcsrdelta_row_col,
+                                                             dcsrdelta_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_block_ptr,
+                                          dcsrdelta_block_ptr,
+                                          sizeof(rocsparse_int) * (nblocks + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_width,
+                                          dcsrdelta_width,
+                                          sizeof(rocsparse_int) * nblocks,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_row_col,
+                                          dcsrdelta_row_col,
+                                          sizeof(rocsparse_int) * M,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsrdelta_col_ind,
+                                          dcsrdelta_col_ind,
+                                          sizeof(rocsparse_int) * csrdelta_nnz,
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2csrdelta_gbyte_count<T>(M, nnz, nblocks, csrdelta_nnz) / gpu_time_used * 1e6;
+
+        // Size of the column indices relative to CSR, including first columns and block data
+        double ratio = (csrdelta_nnz + M + 2.0 * nblocks + 1.0) / nnz;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "block_dim" << std::setw(12) << "words" << std::setw(12)
+                  << "ratio" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << block_dim << std::setw(12) << csrdelta_nnz << std::setw(12)
+                  << ratio << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                   \
+    template void testing_csr2csrdelta_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr2csrdelta<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -158,6 +158,23 @@ void testing_csr2ell_bad_arg(const Arguments& arg)
                                                  dell_val,
                                                  nullptr),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2ell_map()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2ell_map(nullptr, safe_size, descrA, dcsr_row_ptr, safe_size, dell_col_ind),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2ell_map(handle, safe_size, nullptr, dcsr_row_ptr, safe_size, dell_col_ind),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2ell_map(handle, -1, descrA, dcsr_row_ptr, safe_size, dell_col_ind),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2ell_map(handle, safe_size, descrA, nullptr, safe_size, dell_col_ind),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2ell_map(handle, safe_size, descrA, dcsr_row_ptr, safe_size, nullptr),
+        rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -309,6 +326,47 @@ void testing_csr2ell(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, 1, 1, &ell_width_gold, &ell_width);
         unit_check_general<rocsparse_int>(1, ell_nnz, 1, hell_col_ind_gold, hell_col_ind);
         unit_check_general<T>(1, ell_nnz, 1, hell_val_gold, hell_val);
+
+        // Mapping of CSR entries onto the ELL matrix
+        host_vector<rocsparse_int>   hell_map(nnz);
+        host_vector<rocsparse_int>   hell_map_gold;
+        device_vector<rocsparse_int> dell_map(nnz);
+
+        if(!dell_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr2ell_map(handle, M, descrA, dcsr_row_ptr, ell_width, dell_map));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hell_map, dell_map, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        host_csr_to_ell_map(M, hcsr_row_ptr, ell_width_gold, hell_map_gold, baseA);
+
+        unit_check_general<rocsparse_int>(1, nnz, 1, hell_map_gold, hell_map);
+
+        // Refresh the ELL values from new CSR values
+        rocsparse_init<T>(hcsr_val, 1, nnz, 1);
+
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+            handle, nnz, dcsr_val, dell_map, dell_val, rocsparse_index_base_zero));
+        CHECK_HIP_ERROR(hipMemcpy(hell_val, dell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+
+        host_csr_to_ell<T>(M,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           hcsr_val,
+                           hell_col_ind_gold,
+                           hell_val_gold,
+                           ell_width_gold,
+                           baseA,
+                           baseB);
+
+        unit_check_general<T>(1, ell_nnz, 1, hell_val_gold, hell_val);
     }
 
     if(arg.timing)
@@ -348,38 +406,85 @@ void testing_csr2ell(const Arguments& arg)
                                                        dell_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
+        device_vector<rocsparse_int> dell_col_ind(ell_nnz);
+        device_vector<T>             dell_val(ell_nnz);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
+        if(!dell_col_ind || !dell_val)
         {
-            CHECK_ROCSPARSE_ERROR(
-                rocsparse_csr2ell_width(handle, M, descrA, dcsr_row_ptr, descrB, &ell_width));
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
 
-            ell_nnz = ell_width * M;
+        hell_col_ind.resize(ell_nnz);
+        hell_val.resize(ell_nnz);
 
-            device_vector<rocsparse_int> dell_col_ind(ell_nnz);
-            device_vector<T>             dell_val(ell_nnz);
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            "width",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csr2ell_width(handle, M, descrA, dcsr_row_ptr, descrB, &ell_width));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell<T>(handle,
+                                                           M,
+                                                           descrA,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           descrB,
+                                                           ell_width,
+                                                           dell_val,
+                                                           dell_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hell_col_ind,
+                                          dell_col_ind,
+                                          sizeof(rocsparse_int) * ell_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hell_val, dell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        // Value refresh through the ELL mapping
+        device_vector<rocsparse_int> dell_map(nnz);
+
+        if(!dell_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
 
-            if(!dell_col_ind || !dell_val)
-            {
-                CHECK_HIP_ERROR(hipErrorOutOfMemory);
-                return;
-            }
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr2ell_map(handle, M, descrA, dcsr_row_ptr, ell_width, dell_map));
 
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell<T>(handle,
-                                                       M,
-                                                       descrA,
-                                                       dcsr_val,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind,
-                                                       descrB,
-                                                       ell_width,
-                                                       dell_val,
-                                                       dell_col_ind));
+        double gpu_refresh_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+                handle, nnz, dcsr_val, dell_map, dell_val, rocsparse_index_base_zero));
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        gpu_refresh_time_used = (get_time_us() - gpu_refresh_time_used) / number_hot_calls;
 
         double gpu_gbyte = csr2ell_gbyte_count<T>(M, nnz, ell_nnz) / gpu_time_used * 1e6;
 
@@ -389,12 +494,15 @@ void testing_csr2ell(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL width"
                   << std::setw(12) << "ELL nnz" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << "msec" << std::setw(12) << "refresh" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << ell_width
                   << std::setw(12) << ell_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
-                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << gpu_time_used / 1e3 << std::setw(12) << gpu_refresh_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
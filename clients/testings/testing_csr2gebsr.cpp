@@ -76,6 +76,7 @@ void testing_csr2gebsr_bad_arg(const Arguments& arg)
     void*                arg_p_buffer;
     rocsparse_int*       arg_bsr_nnz_devhost;
     size_t*              arg_p_buffer_size;
+    rocsparse_int*       arg_bsr_map;
 
     //
     // Macro to set arguments.
@@ -96,7 +97,8 @@ void testing_csr2gebsr_bad_arg(const Arguments& arg)
     arg_col_block_dim   = safe_size;               \
     arg_p_buffer        = (void*)((T*)dbuffer);    \
     arg_bsr_nnz_devhost = &hbsr_nnzb;              \
-    arg_p_buffer_size   = &buffer_size
+    arg_p_buffer_size   = &buffer_size;            \
+    arg_bsr_map         = dbsr_col_ind
 
     //
     // BUFFER_SIZE ############
@@ -365,6 +367,57 @@ void testing_csr2gebsr_bad_arg(const Arguments& arg)
 #undef CALL_FUNC
 #undef CALL_ARG_FUNC
 
+#define CALL_ARG_MAP                                                                             \
+    arg_direction, arg_m, arg_n, arg_csr_descr, arg_csr_row_ptr, arg_csr_col_ind, arg_bsr_descr, \
+        arg_bsr_row_ptr, arg_bsr_col_ind, arg_row_block_dim, arg_col_block_dim, arg_bsr_map
+
+#define CALL_MAP rocsparse_csr2gebsr_map(handle, CALL_ARG_MAP)
+
+    {
+        ARGSET;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2gebsr_map(nullptr, CALL_ARG_MAP),
+                                rocsparse_status_invalid_handle);
+    }
+
+    {
+        ARGSET;
+        arg_direction = (rocsparse_direction)2;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_value);
+    }
+
+    {
+        ARGSET;
+        arg_m = -1;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_size);
+    }
+
+    {
+        ARGSET;
+        arg_csr_row_ptr = nullptr;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_pointer);
+    }
+
+    {
+        ARGSET;
+        arg_bsr_col_ind = nullptr;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_pointer);
+    }
+
+    {
+        ARGSET;
+        arg_row_block_dim = -1;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_size);
+    }
+
+    {
+        ARGSET;
+        arg_bsr_map = nullptr;
+        EXPECT_ROCSPARSE_STATUS(CALL_MAP, rocsparse_status_invalid_pointer);
+    }
+
+#undef CALL_MAP
+#undef CALL_ARG_MAP
+
 #undef ARGSET
 }
 
@@ -593,26 +646,28 @@ void testing_csr2gebsr(const Arguments& arg)
 
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
 
-        // CHECK_HIP_ERROR(hipMemcpy(
-        // hbsr_row_ptr, dbsr_row_ptr, sizeof(rocsparse_int) * (Mb + 1), hipMemcpyDeviceToHost));
-        // std::cout << "disp " << std::endl;
-        // for (int i=0;i<10;++i) std::cout << hbsr_row_ptr[i] << std::endl;
-
-#if 0
         device_vector<rocsparse_int> dbsr_nnzb(1);
+
+        // With device pointers, no host synchronization is allowed
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz(handle,
-                                                    direction,
-                                                    M,
-                                                    N,
-                                                    csr_descr,
-						      dcsr_row_ptr_C,
-						      dcsr_col_ind_C,
-						      bsr_descr,
-						      dbsr_row_ptr,
-						      row_block_dim,
-						      col_block_dim,
-						      dbsr_nnzb,
-						      (void*)dbuffer));
+                                                      direction,
+                                                      M,
+                                                      N,
+                                                      csr_descr,
+                                                      dcsr_row_ptr_C,
+                                                      dcsr_col_ind_C,
+                                                      bsr_descr,
+                                                      dbsr_row_ptr,
+                                                      row_block_dim,
+                                                      col_block_dim,
+                                                      dbsr_nnzb,
+                                                      (void*)dbuffer));
+
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
 
         rocsparse_int hbsr_nnzb_copied_from_device = 0;
         CHECK_HIP_ERROR(hipMemcpy(&hbsr_nnzb_copied_from_device,
@@ -624,7 +679,6 @@ void testing_csr2gebsr(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, 1, 1, &hbsr_nnzb, &hbsr_nnzb_copied_from_device);
 
         // Allocate device memory for BSR col indices and values array
-#endif
         device_vector<rocsparse_int> dbsr_col_ind(hbsr_nnzb);
         device_vector<T>             dbsr_val(hbsr_nnzb * row_block_dim * col_block_dim);
 
@@ -635,6 +689,8 @@ void testing_csr2gebsr(const Arguments& arg)
         }
 
         // Finish conversion
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr<T>(handle,
                                                      direction,
                                                      M,
@@ -651,6 +707,9 @@ void testing_csr2gebsr(const Arguments& arg)
                                                      col_block_dim,
                                                      (void*)dbuffer));
 
+        synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         // Allocate host memory for BSR col indices and values array
         host_vector<rocsparse_int> hbsr_col_ind(hbsr_nnzb);
         host_vector<T>             hbsr_val(hbsr_nnzb * row_block_dim * col_block_dim);
@@ -669,6 +728,64 @@ void testing_csr2gebsr(const Arguments& arg)
 
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
+        // Mapping of CSR entries onto the BSR values
+        host_vector<rocsparse_int>   hbsr_map(nnz_C);
+        host_vector<rocsparse_int>   hbsr_map_gold;
+        device_vector<rocsparse_int> dbsr_map(nnz_C);
+
+        if(!dbsr_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr_map(handle,
+                                                      direction,
+                                                      M,
+                                                      N,
+                                                      csr_descr,
+                                                      dcsr_row_ptr_C,
+                                                      dcsr_col_ind_C,
+                                                      bsr_descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      row_block_dim,
+                                                      col_block_dim,
+                                                      dbsr_map));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hbsr_map, dbsr_map, sizeof(rocsparse_int) * nnz_C, hipMemcpyDeviceToHost));
+
+        host_csr_to_gebsr_map(direction,
+                              M,
+                              hcsr_row_ptr_C,
+                              hcsr_col_ind_C,
+                              row_block_dim,
+                              col_block_dim,
+                              csr_base,
+                              hbsr_row_ptr,
+                              hbsr_col_ind,
+                              bsr_base,
+                              hbsr_map_gold);
+
+        unit_check_general<rocsparse_int>(1, nnz_C, 1, hbsr_map_gold, hbsr_map);
+
+        // Refreshing the values of a zero initialized BSR matrix through the mapping
+        // reproduces the values of the conversion
+        host_vector<T> hbsr_val_refresh(hbsr_nnzb * row_block_dim * col_block_dim);
+
+        CHECK_HIP_ERROR(
+            hipMemset(dbsr_val, 0, sizeof(T) * hbsr_nnzb * row_block_dim * col_block_dim));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+            handle, nnz_C, dcsr_val_C, dbsr_map, dbsr_val, rocsparse_index_base_zero));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_val_refresh,
+                                  dbsr_val,
+                                  sizeof(T) * hbsr_nnzb * row_block_dim * col_block_dim,
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general<T>(
+            1, hbsr_nnzb * row_block_dim * col_block_dim, 1, hbsr_val, hbsr_val_refresh);
+
         // Convert BSR matrix back to CSR for comparison with original compressed CSR matrix
         M = Mb * row_block_dim;
         N = Nb * col_block_dim;
@@ -849,30 +966,110 @@ void testing_csr2gebsr(const Arguments& arg)
             return;
         }
 
-        double gpu_time_used = get_time_us();
+        host_vector<rocsparse_int> hbsr_col_ind(hbsr_nnzb);
+        host_vector<T>             hbsr_val(hbsr_nnzb * row_block_dim * col_block_dim);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_C,
+                                          hcsr_row_ptr_C,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_C,
+                                          hcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * nnz_C,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_C, hcsr_val_C, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz(handle,
+                                                              direction,
+                                                              M,
+                                                              N,
+                                                              csr_descr,
+                                                              dcsr_row_ptr_C,
+                                                              dcsr_col_ind_C,
+                                                              bsr_descr,
+                                                              dbsr_row_ptr,
+                                                              row_block_dim,
+                                                              col_block_dim,
+                                                              &hbsr_nnzb,
+                                                              (void*)dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr<T>(handle,
+                                                             direction,
+                                                             M,
+                                                             N,
+                                                             csr_descr,
+                                                             dcsr_val_C,
+                                                             dcsr_row_ptr_C,
+                                                             dcsr_col_ind_C,
+
+                                                             bsr_descr,
+                                                             dbsr_val,
+                                                             dbsr_row_ptr,
+                                                             dbsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             (void*)dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr,
+                                          dbsr_row_ptr,
+                                          sizeof(rocsparse_int) * (Mb + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind,
+                                          dbsr_col_ind,
+                                          sizeof(rocsparse_int) * hbsr_nnzb,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_val,
+                                          dbsr_val,
+                                          sizeof(T) * hbsr_nnzb * row_block_dim * col_block_dim,
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        // Value refresh through the BSR mapping
+        device_vector<rocsparse_int> dbsr_map(nnz_C);
+
+        if(!dbsr_map)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr<T>(handle,
-                                                         direction,
-                                                         M,
-                                                         N,
-                                                         csr_descr,
-                                                         dcsr_val_C,
-                                                         dcsr_row_ptr_C,
-                                                         dcsr_col_ind_C,
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
 
-                                                         bsr_descr,
-                                                         dbsr_val,
-                                                         dbsr_row_ptr,
-                                                         dbsr_col_ind,
-                                                         row_block_dim,
-                                                         col_block_dim,
-                                                         (void*)dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2gebsr_map(handle,
+                                                      direction,
+                                                      M,
+                                                      N,
+                                                      csr_descr,
+                                                      dcsr_row_ptr_C,
+                                                      dcsr_col_ind_C,
+                                                      bsr_descr,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      row_block_dim,
+                                                      col_block_dim,
+                                                      dbsr_map));
+
+        double gpu_refresh_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sctr<T>(
+                handle, nnz_C, dcsr_val_C, dbsr_map, dbsr_val, rocsparse_index_base_zero));
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        gpu_refresh_time_used = (get_time_us() - gpu_refresh_time_used) / number_hot_calls;
 
         double gpu_gbyte
             = csr2gebsr_gbyte_count<T>(M, Mb, nnz, hbsr_nnzb, row_block_dim, col_block_dim)
@@ -885,14 +1082,16 @@ void testing_csr2gebsr(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "Mb"
                   << std::setw(12) << "Nb" << std::setw(12) << "rowblockdim" << std::setw(12)
                   << "colblockdim" << std::setw(12) << "nnzb" << std::setw(12) << "GB/s"
-                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << std::setw(12) << "msec" << std::setw(12) << "refresh" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
                   << std::setw(12) << Nb << std::setw(12) << row_block_dim << std::setw(12)
                   << col_block_dim << std::setw(12) << hbsr_nnzb << std::setw(12) << gpu_gbyte
-                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << gpu_refresh_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 }
 
@@ -116,6 +116,152 @@ void testing_csr2hyb_bad_arg(const Arguments& arg)
                                                  0,
                                                  rocsparse_hyb_partition_auto),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_buffer_size(nullptr, safe_size, safe_size, dcsr_row_ptr, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_buffer_size(handle, -1, safe_size, dcsr_row_ptr, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_buffer_size(handle, safe_size, safe_size, nullptr, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_buffer_size(handle, safe_size, safe_size, dcsr_row_ptr, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_nnz()
+    rocsparse_int ell_width;
+    rocsparse_int coo_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_nnz(nullptr,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  0,
+                                                  rocsparse_hyb_partition_auto,
+                                                  &ell_width,
+                                                  &coo_nnz,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  -1,
+                                                  rocsparse_hyb_partition_user,
+                                                  &ell_width,
+                                                  &coo_nnz,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  0,
+                                                  rocsparse_hyb_partition_auto,
+                                                  nullptr,
+                                                  &coo_nnz,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  0,
+                                                  rocsparse_hyb_partition_auto,
+                                                  &ell_width,
+                                                  &coo_nnz,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_ex()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ex<T>(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    hyb,
+                                                    rocsparse_hyb_partition_auto,
+                                                    -1,
+                                                    0,
+                                                    dcsr_col_ind,
+                                                    dcsr_val,
+                                                    nullptr,
+                                                    nullptr,
+                                                    nullptr,
+                                                    dcsr_row_ptr),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ex<T>(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    hyb,
+                                                    rocsparse_hyb_partition_auto,
+                                                    1,
+                                                    0,
+                                                    nullptr,
+                                                    dcsr_val,
+                                                    nullptr,
+                                                    nullptr,
+                                                    nullptr,
+                                                    dcsr_row_ptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ex<T>(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    hyb,
+                                                    rocsparse_hyb_partition_auto,
+                                                    0,
+                                                    1,
+                                                    nullptr,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    dcsr_val,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_map()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_map(nullptr, descr, dcsr_row_ptr, hyb, dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_map(handle, nullptr, dcsr_row_ptr, hyb, dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_map(handle, descr, dcsr_row_ptr, nullptr, dcsr_col_ind),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_map(handle, descr, dcsr_row_ptr, hyb, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_values()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_values<T>(nullptr, safe_size, dcsr_val, dcsr_col_ind, hyb),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_values<T>(handle, -1, dcsr_val, dcsr_col_ind, hyb),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_values<T>(handle, safe_size, nullptr, dcsr_col_ind, hyb),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_values<T>(handle, safe_size, dcsr_val, nullptr, hyb),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2hyb_values<T>(handle, safe_size, dcsr_val, dcsr_col_ind, nullptr),
+        rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -329,6 +475,193 @@ void testing_csr2hyb(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_row_ind_gold, hhyb_coo_row_ind);
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_col_ind_gold, hhyb_coo_col_ind);
         unit_check_general<T>(1, coo_nnz, 1, hhyb_coo_val_gold, hhyb_coo_val);
+
+        // Mapping of CSR entries onto the HYB matrix
+        host_vector<rocsparse_int>   hhyb_map(nnz);
+        host_vector<rocsparse_int>   hhyb_map_gold;
+        device_vector<rocsparse_int> dhyb_map(nnz);
+
+        if(!dhyb_map)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_map(handle, descr, dcsr_row_ptr, hyb, dhyb_map));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hhyb_map, dhyb_map, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        host_csr_to_hyb_map(M, hcsr_row_ptr, ell_width_gold, hhyb_map_gold, base);
+
+        unit_check_general<rocsparse_int>(1, nnz, 1, hhyb_map_gold, hhyb_map);
+
+        // Refresh the HYB values from new CSR values
+        rocsparse_init<T>(hcsr_val, 1, nnz, 1);
+
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_values<T>(handle, nnz, dcsr_val, dhyb_map, hyb));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hhyb_ell_val, dhyb->ell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hhyb_coo_val, dhyb->coo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
+
+        host_csr_to_hyb<T>(M,
+                           nnz,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           hcsr_val,
+                           hhyb_ell_col_ind_gold,
+                           hhyb_ell_val_gold,
+                           ell_width_gold,
+                           ell_nnz_gold,
+                           hhyb_coo_row_ind_gold,
+                           hhyb_coo_col_ind_gold,
+                           hhyb_coo_val_gold,
+                           coo_nnz_gold,
+                           part,
+                           base);
+
+        unit_check_general<T>(1, ell_nnz, 1, hhyb_ell_val_gold, hhyb_ell_val);
+        unit_check_general<T>(1, coo_nnz, 1, hhyb_coo_val_gold, hhyb_coo_val);
+
+        // Conversion into user allocated storage
+        size_t buffer_size;
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr2hyb_buffer_size(handle, M, N, dcsr_row_ptr, &buffer_size));
+
+        device_vector<char>          dbuffer(buffer_size);
+        device_vector<rocsparse_int> dell_width(1);
+        device_vector<rocsparse_int> dcoo_nnz(1);
+
+        if(!dbuffer || !dell_width || !dcoo_nnz)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Pointer mode device, no host synchronization is allowed
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        rocsparse_sync_probe probe_nnz(handle);
+        CHECK_HIP_ERROR(probe_nnz.block());
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_nnz(handle,
+                                                    M,
+                                                    N,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    user_ell_width,
+                                                    part,
+                                                    dell_width,
+                                                    dcoo_nnz,
+                                                    dbuffer));
+
+        bool synchronized = probe_nnz.release();
+        ASSERT_EQ(synchronized, false);
+
+        rocsparse_int hell_width_2;
+        rocsparse_int hcoo_nnz_2;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hell_width_2, dell_width, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hcoo_nnz_2, dcoo_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int hell_width;
+        rocsparse_int hcoo_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_nnz(handle,
+                                                    M,
+                                                    N,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    user_ell_width,
+                                                    part,
+                                                    &hell_width,
+                                                    &hcoo_nnz,
+                                                    dbuffer));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &ell_width_gold, &hell_width_2);
+        unit_check_general<rocsparse_int>(1, 1, 1, &coo_nnz_gold, &hcoo_nnz_2);
+        unit_check_general<rocsparse_int>(1, 1, 1, &ell_width_gold, &hell_width);
+        unit_check_general<rocsparse_int>(1, 1, 1, &coo_nnz_gold, &hcoo_nnz);
+
+        device_vector<rocsparse_int> dell_col_ind(ell_nnz_gold);
+        device_vector<T>             dell_val(ell_nnz_gold);
+        device_vector<rocsparse_int> dcoo_row_ind(coo_nnz_gold);
+        device_vector<rocsparse_int> dcoo_col_ind(coo_nnz_gold);
+        device_vector<T>             dcoo_val(coo_nnz_gold);
+
+        if(!dell_col_ind || !dell_val || !dcoo_row_ind || !dcoo_col_ind || !dcoo_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_local_hyb_mat hyb_ex;
+
+        rocsparse_sync_probe probe_ex(handle);
+        CHECK_HIP_ERROR(probe_ex.block());
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_ex<T>(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      hyb_ex,
+                                                      part,
+                                                      hell_width,
+                                                      hcoo_nnz,
+                                                      dell_col_ind,
+                                                      dell_val,
+                                                      dcoo_row_ind,
+                                                      dcoo_col_ind,
+                                                      dcoo_val,
+                                                      dbuffer));
+
+        synchronized = probe_ex.release();
+        ASSERT_EQ(synchronized, false);
+
+        // Copy output to host
+        host_vector<rocsparse_int> hell_col_ind(ell_nnz_gold);
+        host_vector<T>             hell_val(ell_nnz_gold);
+        host_vector<rocsparse_int> hcoo_row_ind(coo_nnz_gold);
+        host_vector<rocsparse_int> hcoo_col_ind(coo_nnz_gold);
+        host_vector<T>             hcoo_val(coo_nnz_gold);
+
+        CHECK_HIP_ERROR(hipMemcpy(hell_col_ind,
+                                  dell_col_ind,
+                                  sizeof(rocsparse_int) * ell_nnz_gold,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hell_val, dell_val, sizeof(T) * ell_nnz_gold, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcoo_row_ind,
+                                  dcoo_row_ind,
+                                  sizeof(rocsparse_int) * coo_nnz_gold,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcoo_col_ind,
+                                  dcoo_col_ind,
+                                  sizeof(rocsparse_int) * coo_nnz_gold,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcoo_val, dcoo_val, sizeof(T) * coo_nnz_gold, hipMemcpyDeviceToHost));
+
+        rocsparse_hyb_mat ptr_ex  = hyb_ex;
+        test_hyb*         dhyb_ex = reinterpret_cast<test_hyb*>(ptr_ex);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &ell_width_gold, &dhyb_ex->ell_width);
+        unit_check_general<rocsparse_int>(1, 1, 1, &ell_nnz_gold, &dhyb_ex->ell_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &coo_nnz_gold, &dhyb_ex->coo_nnz);
+        unit_check_general<rocsparse_int>(1, ell_nnz_gold, 1, hhyb_ell_col_ind_gold, hell_col_ind);
+        unit_check_general<T>(1, ell_nnz_gold, 1, hhyb_ell_val_gold, hell_val);
+        unit_check_general<rocsparse_int>(1, coo_nnz_gold, 1, hhyb_coo_row_ind_gold, hcoo_row_ind);
+        unit_check_general<rocsparse_int>(1, coo_nnz_gold, 1, hhyb_coo_col_ind_gold, hcoo_col_ind);
+        unit_check_general<T>(1, coo_nnz_gold, 1, hhyb_coo_val_gold, hcoo_val);
     }
 
     if(arg.timing)
@@ -351,30 +684,87 @@ void testing_csr2hyb(const Arguments& arg)
                                                        part));
         }
 
-        double gpu_time_used = get_time_us();
+        rocsparse_hyb_mat ptr  = hyb;
+        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
+        rocsparse_int ell_nnz = dhyb->ell_nnz;
+        rocsparse_int coo_nnz = dhyb->coo_nnz;
+
+        host_vector<rocsparse_int> hell_col_ind(ell_nnz);
+        host_vector<T>             hell_val(ell_nnz);
+        host_vector<rocsparse_int> hcoo_row_ind(coo_nnz);
+        host_vector<rocsparse_int> hcoo_col_ind(coo_nnz);
+        host_vector<T>             hcoo_val(coo_nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(handle,
+                                                           M,
+                                                           N,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           hyb,
+                                                           user_ell_width,
+                                                           part));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hell_col_ind,
+                                          dhyb->ell_col_ind,
+                                          sizeof(rocsparse_int) * ell_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hell_val, dhyb->ell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcoo_row_ind,
+                                          dhyb->coo_row_ind,
+                                          sizeof(rocsparse_int) * coo_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcoo_col_ind,
+                                          dhyb->coo_col_ind,
+                                          sizeof(rocsparse_int) * coo_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcoo_val, dhyb->coo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        // Value refresh through the HYB mapping
+        device_vector<rocsparse_int> dhyb_map(nnz);
+
+        if(!dhyb_map)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(handle,
-                                                       M,
-                                                       N,
-                                                       descr,
-                                                       dcsr_val,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind,
-                                                       hyb,
-                                                       user_ell_width,
-                                                       part));
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_map(handle, descr, dcsr_row_ptr, hyb, dhyb_map));
 
-        rocsparse_hyb_mat ptr  = hyb;
-        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
+        double gpu_refresh_time_used = get_time_us();
 
-        rocsparse_int ell_nnz = dhyb->ell_nnz;
-        rocsparse_int coo_nnz = dhyb->coo_nnz;
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2hyb_values<T>(handle, nnz, dcsr_val, dhyb_map, hyb));
+        }
+
+        gpu_refresh_time_used = (get_time_us() - gpu_refresh_time_used) / number_hot_calls;
 
         double gpu_gbyte = csr2hyb_gbyte_count<T>(M, nnz, ell_nnz, coo_nnz) / gpu_time_used * 1e6;
 
@@ -384,12 +774,15 @@ void testing_csr2hyb(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL nnz"
                   << std::setw(12) << "COO nnz" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << "msec" << std::setw(12) << "refresh" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << ell_nnz
                   << std::setw(12) << coo_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
-                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << gpu_time_used / 1e3 << std::setw(12) << gpu_refresh_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
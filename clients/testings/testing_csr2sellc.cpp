@@ -0,0 +1,786 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csr2sellc_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size       = 100;
+    static const rocsparse_int safe_slice_size = 4;
+    static const rocsparse_int safe_sigma      = 8;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for SELL-C-sigma matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+    device_vector<rocsparse_int> dsell_perm(safe_size);
+    device_vector<rocsparse_int> dsell_col_ind(safe_size);
+    device_vector<T>             dsell_val(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+       || !dsell_col_ind || !dsell_val || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2sellc_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sellc_buffer_size(
+            nullptr, safe_size, safe_size, dcsr_row_ptr, safe_slice_size, safe_sigma, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sellc_buffer_size(
+            handle, safe_size, safe_size, nullptr, safe_slice_size, safe_sigma, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sellc_buffer_size(
+            handle, safe_size, safe_size, dcsr_row_ptr, safe_slice_size, safe_sigma, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sellc_buffer_size(
+            handle, safe_size, safe_size, dcsr_row_ptr, 0, safe_sigma, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sellc_buffer_size(
+            handle, safe_size, safe_size, dcsr_row_ptr, safe_slice_size, 0, &buffer_size),
+        rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2sellc_nnz()
+    rocsparse_int sell_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(nullptr,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    nullptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    nullptr,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    nullptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    nullptr,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    nullptr,
+                                                    dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    0,
+                                                    safe_sigma,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    dcsr_row_ptr,
+                                                    descrB,
+                                                    safe_slice_size,
+                                                    0,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    &sell_nnz,
+                                                    dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2sellc()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(nullptr,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   nullptr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   nullptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   nullptr,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   nullptr,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   nullptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   nullptr,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   nullptr,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   safe_slice_size,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   descrB,
+                                                   0,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   dsell_val,
+                                                   dsell_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr2sellc(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M     = arg.M;
+    rocsparse_int               N     = arg.N;
+    rocsparse_int               C     = arg.slice_size;
+    rocsparse_int               sigma = arg.sigma;
+    rocsparse_index_base        baseA = arg.baseA;
+    rocsparse_index_base        baseB = arg.baseB;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for SELL-C-sigma matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+        device_vector<rocsparse_int> dsell_perm(safe_size);
+        device_vector<rocsparse_int> dsell_col_ind(safe_size);
+        device_vector<T>             dsell_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+           || !dsell_col_ind || !dsell_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csr2sellc_buffer_size(handle, M, N, dcsr_row_ptr, C, sigma, &buffer_size),
+            (M < 0 || N < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        rocsparse_int sell_nnz;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc_nnz(handle,
+                                                        M,
+                                                        N,
+                                                        descrA,
+                                                        dcsr_row_ptr,
+                                                        descrB,
+                                                        C,
+                                                        sigma,
+                                                        dsell_slice_ptr,
+                                                        dsell_perm,
+                                                        &sell_nnz,
+                                                        dbuffer),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sellc<T>(handle,
+                                                       M,
+                                                       N,
+                                                       descrA,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       descrB,
+                                                       C,
+                                                       dsell_slice_ptr,
+                                                       dsell_perm,
+                                                       dsell_val,
+                                                       dsell_col_ind),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+    host_vector<rocsparse_int> hsell_slice_ptr;
+    host_vector<rocsparse_int> hsell_perm;
+    host_vector<rocsparse_int> hsell_col_ind;
+    host_vector<T>             hsell_val;
+    host_vector<rocsparse_int> hsell_slice_ptr_gold;
+    host_vector<rocsparse_int> hsell_perm_gold;
+    host_vector<rocsparse_int> hsell_col_ind_gold;
+    host_vector<T>             hsell_val_gold;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, baseA);
+
+    rocsparse_int nslices = (M - 1) / C + 1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dsell_slice_ptr(nslices + 1);
+    device_vector<rocsparse_int> dsell_perm(M);
+    device_vector<rocsparse_int> dsell_nnz(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+       || !dsell_nnz)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr2sellc_buffer_size(handle, M, N, dcsr_row_ptr, C, sigma, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Obtain SELL-C-sigma permutation, slice pointers and nnz
+        rocsparse_int sell_nnz;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      descrA,
+                                                      dcsr_row_ptr,
+                                                      descrB,
+                                                      C,
+                                                      sigma,
+                                                      dsell_slice_ptr,
+                                                      dsell_perm,
+                                                      &sell_nnz,
+                                                      dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      descrA,
+                                                      dcsr_row_ptr,
+                                                      descrB,
+                                                      C,
+                                                      sigma,
+                                                      dsell_slice_ptr,
+                                                      dsell_perm,
+                                                      dsell_nnz,
+                                                      dbuffer));
+
+        rocsparse_int hsell_nnz;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hsell_nnz, dsell_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Allocate device memory
+        device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+        device_vector<T>             dsell_val(sell_nnz);
+
+        if(!dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform SELL-C-sigma conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc<T>(handle,
+                                                     M,
+                                                     N,
+                                                     descrA,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     descrB,
+                                                     C,
+                                                     dsell_slice_ptr,
+                                                     dsell_perm,
+                                                     dsell_val,
+                                                     dsell_col_ind));
+
+        // Copy output to host
+        hsell_slice_ptr.resize(nslices + 1);
+        hsell_perm.resize(M);
+        hsell_col_ind.resize(sell_nnz);
+        hsell_val.resize(sell_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hsell_slice_ptr,
+                                  dsell_slice_ptr,
+                                  sizeof(rocsparse_int) * (nslices + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_perm, dsell_perm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hsell_col_ind, dsell_col_ind, sizeof(rocsparse_int) * sell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_val, dsell_val, sizeof(T) * sell_nnz, hipMemcpyDeviceToHost));
+
+        // CPU csr2sellc
+        rocsparse_int sell_nnz_gold;
+        host_csr_to_sellc<T>(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             hcsr_val,
+                             C,
+                             sigma,
+                             hsell_slice_ptr_gold,
+                             hsell_perm_gold,
+                             hsell_col_ind_gold,
+                             hsell_val_gold,
+                             sell_nnz_gold,
+                             baseA,
+                             baseB);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &sell_nnz_gold, &sell_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &sell_nnz_gold, &hsell_nnz);
+        unit_check_general<rocsparse_int>(1, nslices + 1, 1, hsell_slice_ptr_gold, hsell_slice_ptr);
+        unit_check_general<rocsparse_int>(1, M, 1, hsell_perm_gold, hsell_perm);
+        unit_check_general<rocsparse_int>(1, sell_nnz, 1, hsell_col_ind_gold, hsell_col_ind);
+        unit_check_general<T>(1, sell_nnz, 1, hsell_val_gold, hsell_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int sell_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          descrA,
+                                                          dcsr_row_ptr,
+                                                          descrB,
+                                                          C,
+                                                          sigma,
+                                                          dsell_slice_ptr,
+                                                          dsell_perm,
+                                                          &sell_nnz,
+                                                          dbuffer));
+
+            device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+            device_vector<T>             dsell_val(sell_nnz);
+
+            if(!dsell_col_ind || !dsell_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc<T>(handle,
+                                                         M,
+                                                         N,
+                                                         descrA,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         descrB,
+                                                         C,
+                                                         dsell_slice_ptr,
+                                                         dsell_perm,
+                                                         dsell_val,
+                                                         dsell_col_ind));
+        }
+
+        device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+        device_vector<T>             dsell_val(sell_nnz);
+
+        if(!dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        hsell_slice_ptr.resize(nslices + 1);
+        hsell_perm.resize(M);
+        hsell_col_ind.resize(sell_nnz);
+        hsell_val.resize(sell_nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc_nnz(handle,
+                                                              M,
+                                                              N,
+                                                              descrA,
+                                                              dcsr_row_ptr,
+                                                              descrB,
+                                                              C,
+                                                              sigma,
+                                                              dsell_slice_ptr,
+                                                              dsell_perm,
+                                                              &sell_nnz,
+                                                              dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csr2sellc<T>(handle,
+                                                             M,
+                                                             N,
+                                                             descrA,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             descrB,
+                                                             C,
+                                                             dsell_slice_ptr,
+                                                             dsell_perm,
+                                                             dsell_val,
+                                                             dsell_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hsell_slice_ptr,
+                                          dsell_slice_ptr,
+                                          sizeof(rocsparse_int) * (nslices + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    hsell_perm, dsell_perm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hsell_col_ind,
+                                          dsell_col_ind,
+                                          sizeof(rocsparse_int) * sell_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hsell_val, dsell_val, sizeof(T) * sell_nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2sellc_gbyte_count<T>(M, nnz, sell_nnz, nslices) / gpu_time_used * 1e6;
+
+        // Padded entries relative to the number of non-zero entries
+        double padding = (nnz > 0) ? 100.0 * (sell_nnz - nnz) / nnz : 0.0;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "C"
+                  << std::setw(12) << "sigma" << std::setw(12) << "nnz" << std::setw(12)
+                  << "SELL nnz" << std::setw(12) << "padding %" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << timer.header() << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << C
+                  << std::setw(12) << sigma << std::setw(12) << nnz << std::setw(12) << sell_nnz
+                  << std::setw(12) << padding << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csr2sellc_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr2sellc<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
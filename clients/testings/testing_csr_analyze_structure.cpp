@@ -0,0 +1,336 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_analyze.hpp"
+#include "testing.hpp"
+
+#include <set>
+
+template <typename T>
+void testing_csr_analyze_structure(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    rocsparse_csr_structure structure;
+
+    // Structure analysis runs on the host only and does not require a device
+    if(M <= 0 || N <= 0)
+    {
+        host_vector<rocsparse_int> hcsr_row_ptr;
+        host_vector<rocsparse_int> hcsr_col_ind;
+
+        rocsparse_csr_analyze_structure<T>(
+            M, N, 0, hcsr_row_ptr, hcsr_col_ind, base, structure);
+
+        ASSERT_EQ(structure.format, rocsparse_storage_format_csr);
+        ASSERT_TRUE(structure.block_fill.empty());
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    if(arg.unit_check)
+    {
+        rocsparse_csr_analyze_structure<T>(
+            M, N, nnz, hcsr_row_ptr, hcsr_col_ind, base, structure);
+
+        // Serial reference
+        rocsparse_int min_row_nnz     = std::numeric_limits<rocsparse_int>::max();
+        rocsparse_int max_row_nnz     = 0;
+        rocsparse_int lower_bandwidth = 0;
+        rocsparse_int upper_bandwidth = 0;
+        rocsparse_int missing_diag    = 0;
+        double        sum_sq          = 0.0;
+
+        std::vector<rocsparse_int> row_nnz(M);
+        std::vector<rocsparse_int> histogram(ROCSPARSE_ANALYZE_HISTOGRAM_BINS, 0);
+        std::set<rocsparse_int>    diagonals;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            row_nnz[i] = hcsr_row_ptr[i + 1] - hcsr_row_ptr[i];
+
+            min_row_nnz = std::min(min_row_nnz, row_nnz[i]);
+            max_row_nnz = std::max(max_row_nnz, row_nnz[i]);
+            sum_sq += static_cast<double>(row_nnz[i]) * row_nnz[i];
+
+            rocsparse_int bin = 0;
+            while(bin < ROCSPARSE_ANALYZE_HISTOGRAM_BINS - 1 && (1 << bin) <= row_nnz[i])
+            {
+                ++bin;
+            }
+
+            ++histogram[bin];
+
+            bool diag = false;
+            for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = hcsr_col_ind[j] - base;
+
+                lower_bandwidth = std::max(lower_bandwidth, i - col);
+                upper_bandwidth = std::max(upper_bandwidth, col - i);
+                diag            = diag || (col == i);
+
+                diagonals.insert(col - i);
+            }
+
+            if(i < N && !diag)
+            {
+                ++missing_diag;
+            }
+        }
+
+        rocsparse_int ndiag          = diagonals.size();
+        double        mean_row_nnz   = static_cast<double>(nnz) / M;
+        double        stddev_row_nnz = std::sqrt(
+            std::max(0.0, sum_sq / M - mean_row_nnz * mean_row_nnz));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &min_row_nnz, &structure.min_row_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &max_row_nnz, &structure.max_row_nnz);
+        near_check_general<double>(1, 1, 1, &mean_row_nnz, &structure.mean_row_nnz);
+        near_check_general<double>(1, 1, 1, &stddev_row_nnz, &structure.stddev_row_nnz);
+        unit_check_general<rocsparse_int>(1,
+                                          ROCSPARSE_ANALYZE_HISTOGRAM_BINS,
+                                          1,
+                                          histogram.data(),
+                                          structure.row_nnz_histogram.data());
+        unit_check_general<rocsparse_int>(1, 1, 1, &lower_bandwidth, &structure.lower_bandwidth);
+        unit_check_general<rocsparse_int>(1, 1, 1, &upper_bandwidth, &structure.upper_bandwidth);
+        unit_check_general<rocsparse_int>(1, 1, 1, &missing_diag, &structure.missing_diag);
+        unit_check_general<rocsparse_int>(1, 1, 1, &ndiag, &structure.ndiag);
+
+        // Number of blocks for all candidate block dimensions
+        double min_gbyte = std::min(structure.csr_gbyte, structure.ell_gbyte);
+
+        for(const rocsparse_block_fill& block : structure.block_fill)
+        {
+            rocsparse_int mb   = (M + block.row_block_dim - 1) / block.row_block_dim;
+            rocsparse_int nnzb = 0;
+
+            for(rocsparse_int i = 0; i < mb; ++i)
+            {
+                std::set<rocsparse_int> block_cols;
+
+                for(rocsparse_int r = i * block.row_block_dim;
+                    r < std::min((i + 1) * block.row_block_dim, M);
+                    ++r)
+                {
+                    for(rocsparse_int j = hcsr_row_ptr[r] - base; j < hcsr_row_ptr[r + 1] - base;
+                        ++j)
+                    {
+                        block_cols.insert((hcsr_col_ind[j] - base) / block.col_block_dim);
+                    }
+                }
+
+                nnzb += block_cols.size();
+            }
+
+            rocsparse_int nnzb_analyzed = block.nnzb;
+            unit_check_general<rocsparse_int>(1, 1, 1, &nnzb, &nnzb_analyzed);
+
+            min_gbyte = std::min(min_gbyte, block.gbyte);
+        }
+
+        // Best hyb ell width, using sorted row lengths
+        std::sort(row_nnz.begin(), row_nnz.end());
+
+        double hyb_gbyte = std::numeric_limits<double>::infinity();
+        for(rocsparse_int width = 0; width <= max_row_nnz; ++width)
+        {
+            if(static_cast<int64_t>(M) * width > std::numeric_limits<rocsparse_int>::max())
+            {
+                break;
+            }
+
+            rocsparse_int coo_nnz = 0;
+            for(auto it = std::upper_bound(row_nnz.begin(), row_nnz.end(), width);
+                it != row_nnz.end();
+                ++it)
+            {
+                coo_nnz += *it - width;
+            }
+
+            hyb_gbyte = std::min(
+                hyb_gbyte,
+                (width > 0 ? ellmv_gbyte_count<T>(M, N, M * width) : 0.0)
+                    + (coo_nnz > 0 ? coomv_gbyte_count<T>(M, N, coo_nnz, width > 0) : 0.0));
+        }
+
+        near_check_general<double>(1, 1, 1, &hyb_gbyte, &structure.hyb_gbyte);
+
+        // Recommended format has to be the one with the lowest data transfer
+        min_gbyte = std::min(min_gbyte, hyb_gbyte);
+        near_check_general<double>(1, 1, 1, &min_gbyte, &structure.gbyte);
+
+        // Level schedules of the triangular parts, the reference processes the rows
+        // frontier by frontier in topological order
+        for(rocsparse_fill_mode uplo : {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper})
+        {
+            rocsparse_int Mt = std::min(M, N);
+
+            rocsparse_level_schedule levels;
+            rocsparse_csr_analyze_levels(
+                Mt, hcsr_row_ptr, hcsr_col_ind, base, uplo, rocsparse_operation_none, levels);
+
+            std::vector<rocsparse_int>              indegree(Mt, 0);
+            std::vector<std::vector<rocsparse_int>> dependents(Mt);
+
+            for(rocsparse_int i = 0; i < Mt; ++i)
+            {
+                for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+                {
+                    rocsparse_int col = hcsr_col_ind[j] - base;
+
+                    if(uplo == rocsparse_fill_mode_lower ? (col < i) : (col > i && col < Mt))
+                    {
+                        ++indegree[i];
+                        dependents[col].push_back(i);
+                    }
+                }
+            }
+
+            std::vector<rocsparse_int> frontier;
+            std::vector<rocsparse_int> width;
+
+            for(rocsparse_int i = 0; i < Mt; ++i)
+            {
+                if(indegree[i] == 0)
+                {
+                    frontier.push_back(i);
+                }
+            }
+
+            while(!frontier.empty())
+            {
+                width.push_back(frontier.size());
+
+                std::vector<rocsparse_int> next;
+                for(rocsparse_int i : frontier)
+                {
+                    for(rocsparse_int k : dependents[i])
+                    {
+                        if(--indegree[k] == 0)
+                        {
+                            next.push_back(k);
+                        }
+                    }
+                }
+
+                frontier.swap(next);
+            }
+
+            rocsparse_int depth     = width.size();
+            rocsparse_int max_width = *std::max_element(width.begin(), width.end());
+            rocsparse_int min_width = *std::min_element(width.begin(), width.end());
+
+            unit_check_general<rocsparse_int>(1, 1, 1, &depth, &levels.depth);
+            unit_check_general<rocsparse_int>(1, 1, 1, &max_width, &levels.max_width);
+            unit_check_general<rocsparse_int>(1, 1, 1, &min_width, &levels.min_width);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr_analyze_structure<T>(
+                M, N, nnz, hcsr_row_ptr, hcsr_col_ind, base, structure);
+        }
+
+        double cpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr_analyze_structure<T>(
+                M, N, nnz, hcsr_row_ptr, hcsr_col_ind, base, structure);
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / number_hot_calls;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "min row" << std::setw(12) << "max row" << std::setw(12)
+                  << "mean row" << std::setw(12) << "lower bw" << std::setw(12) << "upper bw"
+                  << std::setw(12) << "ndiag" << std::setw(12) << "format" << std::setw(12)
+                  << "block" << std::setw(12) << "ell width" << std::setw(12) << "GB/spmv"
+                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << structure.min_row_nnz << std::setw(12)
+                  << structure.max_row_nnz << std::setw(12) << structure.mean_row_nnz
+                  << std::setw(12) << structure.lower_bandwidth << std::setw(12)
+                  << structure.upper_bandwidth << std::setw(12) << structure.ndiag
+                  << std::setw(12) << rocsparse_storage_format2string(structure.format)
+                  << std::setw(12)
+                  << (std::to_string(structure.row_block_dim) + "x"
+                      + std::to_string(structure.col_block_dim))
+                  << std::setw(12)
+                  << (structure.format == rocsparse_storage_format_ell ? structure.ell_width
+                                                                       : structure.hyb_ell_width)
+                  << std::setw(12) << structure.gbyte << std::setw(12) << cpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        // Block fill ratios
+        std::cout << std::setw(12) << "block" << std::setw(12) << "nnzb" << std::setw(12)
+                  << "fill" << std::setw(12) << "GB/spmv" << std::endl;
+
+        for(const rocsparse_block_fill& block : structure.block_fill)
+        {
+            std::cout << std::setw(12)
+                      << (std::to_string(block.row_block_dim) + "x"
+                          + std::to_string(block.col_block_dim))
+                      << std::setw(12) << block.nnzb << std::setw(12) << block.fill
+                      << std::setw(12) << block.gbyte << std::endl;
+        }
+    }
+}
+
+#define INSTANTIATE(TYPE) \
+    template void testing_csr_analyze_structure<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
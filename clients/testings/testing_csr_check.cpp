@@ -0,0 +1,353 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+// Corrupt a valid CSR matrix, such that it violates the property that corresponds to
+// the given data status. Returns false, if the matrix is too small to be corrupted.
+static bool csr_check_corrupt(rocsparse_data_status       status,
+                              rocsparse_int               M,
+                              rocsparse_int               N,
+                              rocsparse_int               nnz,
+                              std::vector<rocsparse_int>& csr_row_ptr,
+                              std::vector<rocsparse_int>& csr_col_ind,
+                              rocsparse_index_base        base)
+{
+    switch(status)
+    {
+    case rocsparse_data_status_success:
+        return true;
+    case rocsparse_data_status_invalid_offset_ptr:
+        csr_row_ptr[M] += 1;
+        return true;
+    case rocsparse_data_status_invalid_index:
+        if(nnz == 0)
+        {
+            return false;
+        }
+
+        // The last entry has the largest column index of its row
+        csr_col_ind[nnz - 1] = N + base;
+        return true;
+    case rocsparse_data_status_invalid_sorting:
+    case rocsparse_data_status_duplicate_entry:
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int j = csr_row_ptr[i] - base;
+
+            if(csr_row_ptr[i + 1] - base - j < 2)
+            {
+                continue;
+            }
+
+            if(status == rocsparse_data_status_invalid_sorting)
+            {
+                std::swap(csr_col_ind[j], csr_col_ind[j + 1]);
+            }
+            else
+            {
+                csr_col_ind[j + 1] = csr_col_ind[j];
+            }
+
+            return true;
+        }
+
+        return false;
+    default:
+        return false;
+    }
+}
+
+template <typename T>
+void testing_csr_check_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_data_status data_status;
+
+    // Test rocsparse_csr_check()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_check(nullptr,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                &data_status),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                nullptr,
+                                                dcsr_col_ind,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                nullptr,
+                                                &data_status),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_check(handle,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr_check(
+            handle, -1, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &data_status),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr_check(
+            handle, safe_size, -1, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &data_status),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr_check(
+            handle, safe_size, safe_size, -1, descr, dcsr_row_ptr, dcsr_col_ind, &data_status),
+        rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr_check(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M    = arg.M;
+    rocsparse_int               N    = arg.N;
+    rocsparse_index_base        base = arg.baseA;
+    rocsparse_diag_type         diag = arg.diag;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base and diagonal type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, diag));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_data_status data_status;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csr_check(handle, M, N, 0, descr, dcsr_row_ptr, dcsr_col_ind, &data_status),
+            (M < 0 || N < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int>         dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int>         dcsr_col_ind(nnz);
+    device_vector<rocsparse_data_status> d_data_status_2(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !d_data_status_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Check the sampled matrix and one corruption per structural property
+        for(int s = rocsparse_data_status_success; s <= rocsparse_data_status_duplicate_entry; ++s)
+        {
+            rocsparse_data_status corruption = static_cast<rocsparse_data_status>(s);
+
+            host_vector<rocsparse_int> hcsr_row_ptr_C = hcsr_row_ptr;
+            host_vector<rocsparse_int> hcsr_col_ind_C = hcsr_col_ind;
+
+            if(!csr_check_corrupt(corruption, M, N, nnz, hcsr_row_ptr_C, hcsr_col_ind_C, base))
+            {
+                continue;
+            }
+
+            // Copy data from CPU to device
+            CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                      hcsr_row_ptr_C,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                      hcsr_col_ind_C,
+                                      sizeof(rocsparse_int) * nnz,
+                                      hipMemcpyHostToDevice));
+
+            rocsparse_data_status h_data_status_1;
+            rocsparse_data_status h_data_status_2;
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_check(
+                handle, M, N, nnz, descr, dcsr_row_ptr, dcsr_col_ind, &h_data_status_1));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_check(
+                handle, M, N, nnz, descr, dcsr_row_ptr, dcsr_col_ind, d_data_status_2));
+
+            // Copy output to host
+            CHECK_HIP_ERROR(hipMemcpy(&h_data_status_2,
+                                      d_data_status_2,
+                                      sizeof(rocsparse_data_status),
+                                      hipMemcpyDeviceToHost));
+
+            // CPU csr_check
+            rocsparse_data_status h_data_status_gold
+                = host_csr_check(M,
+                                 N,
+                                 nnz,
+                                 hcsr_row_ptr_C,
+                                 hcsr_col_ind_C,
+                                 base,
+                                 diag == rocsparse_diag_type_non_unit);
+
+            // Sampled matrices are valid up to missing diagonal entries, each corruption
+            // violates exactly one property
+            if(corruption == rocsparse_data_status_success)
+            {
+                ASSERT_TRUE(h_data_status_gold == rocsparse_data_status_success
+                            || h_data_status_gold == rocsparse_data_status_missing_diagonal);
+            }
+            else
+            {
+                ASSERT_EQ(h_data_status_gold, corruption);
+            }
+
+            ASSERT_EQ(h_data_status_1, h_data_status_gold);
+            ASSERT_EQ(h_data_status_2, h_data_status_gold);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_check(
+                handle, M, N, nnz, descr, dcsr_row_ptr, dcsr_col_ind, d_data_status_2));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_check(
+                handle, M, N, nnz, descr, dcsr_row_ptr, dcsr_col_ind, d_data_status_2));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csr_check_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csr_check_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr_check<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,412 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrdelta2csr_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size      = 100;
+    static const rocsparse_int safe_block_dim = 4;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrdelta2csr()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(nullptr,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   nullptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   nullptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   nullptr,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   nullptr,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   nullptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   safe_block_dim,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   0,
+                                                   dcsrdelta_block_ptr,
+                                                   dcsrdelta_width,
+                                                   dcsrdelta_row_col,
+                                                   dcsrdelta_col_ind,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csrdelta2csr(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M         = arg.M;
+    rocsparse_int               N         = arg.N;
+    rocsparse_int               block_dim = arg.block_dim;
+    rocsparse_index_base        base      = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+           || !dcsrdelta_row_col || !dcsrdelta_col_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrdelta2csr(handle,
+                                                       M,
+                                                       N,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       block_dim,
+                                                       dcsrdelta_block_ptr,
+                                                       dcsrdelta_width,
+                                                       dcsrdelta_row_col,
+                                                       dcsrdelta_col_ind,
+                                                       dcsr_col_ind),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind_gold;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind_gold, hcsr_val, M, N, nnz, base);
+
+    // Pack the column indices of the CSR matrix
+    host_vector<rocsparse_int> hcsrdelta_block_ptr;
+    host_vector<rocsparse_int> hcsrdelta_width;
+    host_vector<rocsparse_int> hcsrdelta_row_col;
+    host_vector<rocsparse_int> hcsrdelta_col_ind;
+    rocsparse_int              csrdelta_nnz;
+
+    host_csr_to_csrdelta(M,
+                         hcsr_row_ptr,
+                         hcsr_col_ind_gold,
+                         block_dim,
+                         hcsrdelta_block_ptr,
+                         hcsrdelta_width,
+                         hcsrdelta_row_col,
+                         hcsrdelta_col_ind,
+                         csrdelta_nnz,
+                         base);
+
+    rocsparse_int nblocks = (M - 1) / block_dim + 1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(nblocks + 1);
+    device_vector<rocsparse_int> dcsrdelta_width(nblocks);
+    device_vector<rocsparse_int> dcsrdelta_row_col(M);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(csrdelta_nnz);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_block_ptr,
+                              hcsrdelta_block_ptr,
+                              sizeof(rocsparse_int) * (nblocks + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsrdelta_width, hcsrdelta_width, sizeof(rocsparse_int) * nblocks, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsrdelta_row_col, hcsrdelta_row_col, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_col_ind,
+                              hcsrdelta_col_ind,
+                              sizeof(rocsparse_int) * csrdelta_nnz,
+                              hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Perform delta decompression
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrdelta2csr(handle,
+                                                     M,
+                                                     N,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     block_dim,
+                                                     dcsrdelta_block_ptr,
+                                                     dcsrdelta_width,
+                                                     dcsrdelta_row_col,
+                                                     dcsrdelta_col_ind,
+                                                     dcsr_col_ind));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_col_ind(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind, dcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csrdelta2csr
+        host_csrdelta_to_csr(M,
+                             hcsr_row_ptr,
+                             block_dim,
+                             hcsrdelta_block_ptr,
+                             hcsrdelta_width,
+                             hcsrdelta_row_col,
+                             hcsrdelta_col_ind,
+                             hcsr_col_ind_gold,
+                             base);
+
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcsr_col_ind_gold, hcsr_col_ind);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrdelta2csr(handle,
+                                                         M,
+                                                         N,
+                                                         descr,
+                                                         dcsr_row_ptr,
+                                                         block_dim,
+                                                         dcsrdelta_block_ptr,
+                                                         dcsrdelta_width,
+                                                         dcsrdelta_row_col,
+                                                         dcsrdelta_col_ind,
+                                                         dcsr_col_ind));
+        }
+
+        host_vector<rocsparse_int> hcsr_col_ind(nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_block_ptr,
+                                          hcsrdelta_block_ptr,
+                                          sizeof(rocsparse_int) * (nblocks + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_width,
+                                          hcsrdelta_width,
+                                          sizeof(rocsparse_int) * nblocks,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_row_col,
+                                          hcsrdelta_row_col,
+                                          sizeof(rocsparse_int) * M,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_col_ind,
+                                          hcsrdelta_col_ind,
+                                          sizeof(rocsparse_int) * csrdelta_nnz,
+                                          hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrdelta2csr(handle,
+                                                             M,
+                                                             N,
+                                                             descr,
+                                                             dcsr_row_ptr,
+                                                             block_dim,
+                                                             dcsrdelta_block_ptr,
+                                                             dcsrdelta_width,
+                                                             dcsrdelta_row_col,
+                                                             dcsrdelta_col_ind,
+                                                             dcsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind,
+                                          dcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        double gpu_gbyte
+            = csrdelta2csr_gbyte_count<T>(M, nnz, nblocks, csrdelta_nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "block_dim" << std::setw(12) << "words" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << block_dim << std::setw(12) << csrdelta_nnz << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                   \
+    template void testing_csrdelta2csr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrdelta2csr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,604 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrdeltamv_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size      = 100;
+    static const rocsparse_int safe_block_dim = 4;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+    device_vector<T>             dx(safe_size);
+    device_vector<T>             dy(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_val || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrdeltamv()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(nullptr,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    nullptr,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    nullptr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    nullptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    nullptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    nullptr,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    nullptr,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    nullptr,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    nullptr,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    nullptr,
+                                                    dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    safe_block_dim,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                    rocsparse_operation_none,
+                                                    safe_size,
+                                                    safe_size,
+                                                    safe_size,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    0,
+                                                    dcsrdelta_block_ptr,
+                                                    dcsrdelta_width,
+                                                    dcsrdelta_row_col,
+                                                    dcsrdelta_col_ind,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csrdeltamv(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M         = arg.M;
+    rocsparse_int               N         = arg.N;
+    rocsparse_int               block_dim = arg.block_dim;
+    rocsparse_operation         trans     = arg.transA;
+    rocsparse_index_base        base      = arg.baseA;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_block_ptr(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_width(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_row_col(safe_size);
+        device_vector<rocsparse_int> dcsrdelta_col_ind(safe_size);
+        device_vector<T>             dx(safe_size);
+        device_vector<T>             dy(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_val || !dcsrdelta_block_ptr || !dcsrdelta_width
+           || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dx || !dy)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrdeltamv<T>(handle,
+                                                        trans,
+                                                        M,
+                                                        N,
+                                                        0,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        block_dim,
+                                                        dcsrdelta_block_ptr,
+                                                        dcsrdelta_width,
+                                                        dcsrdelta_row_col,
+                                                        dcsrdelta_col_ind,
+                                                        dx,
+                                                        &h_beta,
+                                                        dy),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(N);
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+    host_vector<T> hy_gold(M);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, 1, N, 1);
+    rocsparse_init<T>(hy_1, 1, M, 1);
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Pack the column indices of the CSR matrix
+    host_vector<rocsparse_int> hcsrdelta_block_ptr;
+    host_vector<rocsparse_int> hcsrdelta_width;
+    host_vector<rocsparse_int> hcsrdelta_row_col;
+    host_vector<rocsparse_int> hcsrdelta_col_ind;
+    rocsparse_int              csrdelta_nnz;
+
+    host_csr_to_csrdelta(M,
+                         hcsr_row_ptr,
+                         hcsr_col_ind,
+                         block_dim,
+                         hcsrdelta_block_ptr,
+                         hcsrdelta_width,
+                         hcsrdelta_row_col,
+                         hcsrdelta_col_ind,
+                         csrdelta_nnz,
+                         base);
+
+    rocsparse_int nblocks = (M - 1) / block_dim + 1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcsrdelta_block_ptr(nblocks + 1);
+    device_vector<rocsparse_int> dcsrdelta_width(nblocks);
+    device_vector<rocsparse_int> dcsrdelta_row_col(M);
+    device_vector<rocsparse_int> dcsrdelta_col_ind(csrdelta_nnz);
+    device_vector<T>             dx(N);
+    device_vector<T>             dy_1(M);
+    device_vector<T>             dy_2(M);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_val || !dcsrdelta_block_ptr || !dcsrdelta_width
+       || !dcsrdelta_row_col || !dcsrdelta_col_ind || !dx || !dy_1 || !dy_2 || !d_alpha
+       || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_block_ptr,
+                              hcsrdelta_block_ptr,
+                              sizeof(rocsparse_int) * (nblocks + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsrdelta_width, hcsrdelta_width, sizeof(rocsparse_int) * nblocks, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsrdelta_row_col, hcsrdelta_row_col, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsrdelta_col_ind,
+                              hcsrdelta_col_ind,
+                              sizeof(rocsparse_int) * csrdelta_nnz,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * M, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrdeltamv<T>(handle,
+                                                      trans,
+                                                      M,
+                                                      N,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      block_dim,
+                                                      dcsrdelta_block_ptr,
+                                                      dcsrdelta_width,
+                                                      dcsrdelta_row_col,
+                                                      dcsrdelta_col_ind,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrdeltamv<T>(handle,
+                                                      trans,
+                                                      M,
+                                                      N,
+                                                      nnz,
+                                                      d_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      block_dim,
+                                                      dcsrdelta_block_ptr,
+                                                      dcsrdelta_width,
+                                                      dcsrdelta_row_col,
+                                                      dcsrdelta_col_ind,
+                                                      dx,
+                                                      d_beta,
+                                                      dy_2));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+        // CPU csrmv on the uncompressed matrix
+        host_csrmv<T>(trans,
+                      M,
+                      N,
+                      nnz,
+                      h_alpha,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      hcsr_val,
+                      hx,
+                      h_beta,
+                      hy_gold,
+                      base,
+                      0);
+
+        near_check_general<T>(1, M, 1, hy_gold, hy_1);
+        near_check_general<T>(1, M, 1, hy_gold, hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrdeltamv<T>(handle,
+                                                          trans,
+                                                          M,
+                                                          N,
+                                                          nnz,
+                                                          &h_alpha,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          block_dim,
+                                                          dcsrdelta_block_ptr,
+                                                          dcsrdelta_width,
+                                                          dcsrdelta_row_col,
+                                                          dcsrdelta_col_ind,
+                                                          dx,
+                                                          &h_beta,
+                                                          dy_1));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrdeltamv<T>(handle,
+                                                          trans,
+                                                          M,
+                                                          N,
+                                                          nnz,
+                                                          &h_alpha,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          block_dim,
+                                                          dcsrdelta_block_ptr,
+                                                          dcsrdelta_width,
+                                                          dcsrdelta_row_col,
+                                                          dcsrdelta_col_ind,
+                                                          dx,
+                                                          &h_beta,
+                                                          dy_1));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops
+            = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+        double gpu_gbyte = csrdeltamv_gbyte_count<T>(
+                               M, N, nnz, nblocks, csrdelta_nnz, h_beta != static_cast<T>(0))
+                           / gpu_time_used * 1e6;
+
+        // Size of the column indices relative to CSR, including first columns and block data
+        double ratio = (csrdelta_nnz + M + 2.0 * nblocks + 1.0) / nnz;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "block_dim" << std::setw(12) << "ratio" << std::setw(12)
+                  << "alpha" << std::setw(12) << "beta" << std::setw(12) << "GFlop/s"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << block_dim << std::setw(12) << ratio << std::setw(12)
+                  << h_alpha << std::setw(12) << h_beta << std::setw(12) << gpu_gflops
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                 \
+    template void testing_csrdeltamv_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrdeltamv<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
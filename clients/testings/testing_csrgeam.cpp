@@ -831,8 +831,12 @@ void testing_csrgeam(const Arguments& arg)
                                                     dcsr_row_ptr_C_1,
                                                     &hnnz_C_1));
 
-        // Pointer mode device
+        // Pointer mode device, no host synchronization is allowed
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_nnz(handle,
                                                     M,
                                                     N,
@@ -848,6 +852,9 @@ void testing_csrgeam(const Arguments& arg)
                                                     dcsr_row_ptr_C_2,
                                                     dnnz_C_2));
 
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         // Copy output to host
         host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
         host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
@@ -924,6 +931,8 @@ void testing_csrgeam(const Arguments& arg)
 
         // Pointer mode device
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam<T>(handle,
                                                    M,
                                                    N,
@@ -944,6 +953,9 @@ void testing_csrgeam(const Arguments& arg)
                                                    dcsr_row_ptr_C_2,
                                                    dcsr_col_ind_C_2));
 
+        synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         // Copy output to host
         host_vector<rocsparse_int> hcsr_col_ind_C_1(hnnz_C_1);
         host_vector<rocsparse_int> hcsr_col_ind_C_2(hnnz_C_2);
@@ -1075,33 +1087,85 @@ void testing_csrgeam(const Arguments& arg)
             return;
         }
 
-        double gpu_solve_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam<T>(handle,
-                                                       M,
-                                                       N,
-                                                       &h_alpha,
-                                                       descrA,
-                                                       nnz_A,
-                                                       dcsr_val_A,
-                                                       dcsr_row_ptr_A,
-                                                       dcsr_col_ind_A,
-                                                       &h_beta,
-                                                       descrB,
-                                                       nnz_B,
-                                                       dcsr_val_B,
-                                                       dcsr_row_ptr_B,
-                                                       dcsr_col_ind_B,
-                                                       descrC,
-                                                       dcsr_val_C,
-                                                       dcsr_row_ptr_C_1,
-                                                       dcsr_col_ind_C));
-        }
-
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        host_vector<rocsparse_int> hcsr_col_ind_C(nnz_C);
+        host_vector<T>             hcsr_val_C(nnz_C);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
+                                          hcsr_row_ptr_A,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_A,
+                                          hcsr_col_ind_A,
+                                          sizeof(rocsparse_int) * nnz_A,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_B,
+                                          hcsr_row_ptr_B,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_B,
+                                          hcsr_col_ind_B,
+                                          sizeof(rocsparse_int) * nnz_B,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_nnz(handle,
+                                                            M,
+                                                            N,
+                                                            descrA,
+                                                            nnz_A,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrB,
+                                                            nnz_B,
+                                                            dcsr_row_ptr_B,
+                                                            dcsr_col_ind_B,
+                                                            descrC,
+                                                            dcsr_row_ptr_C_1,
+                                                            &nnz_C));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam<T>(handle,
+                                                           M,
+                                                           N,
+                                                           &h_alpha,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           &h_beta,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           descrC,
+                                                           dcsr_val_C,
+                                                           dcsr_row_ptr_C_1,
+                                                           dcsr_col_ind_C));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                          dcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * nnz_C,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops = csrgeam_gflop_count<T>(nnz_A, nnz_B, nnz_C, &h_alpha, &h_beta)
                             / gpu_solve_time_used * 1e6;
@@ -1117,14 +1181,15 @@ void testing_csrgeam(const Arguments& arg)
                   << "alpha" << std::setw(12) << "beta" << std::setw(12) << "GFlop/s"
                   << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec" << std::setw(16)
                   << "gemm msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
-                  << std::endl;
+                  << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz_A
                   << std::setw(12) << nnz_B << std::setw(12) << nnz_C << std::setw(12) << h_alpha
                   << std::setw(12) << h_beta << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
                   << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
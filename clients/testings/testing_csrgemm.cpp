@@ -2159,6 +2159,101 @@ void testing_csrgemm_bad_arg(const Arguments& arg)
                                                  nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrgemm_numeric() without prior rocsparse_csrgemm_symbolic()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_numeric<T>(nullptr,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_val_A,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrB,
+                                                         safe_size,
+                                                         dcsr_val_B,
+                                                         dcsr_row_ptr_B,
+                                                         dcsr_col_ind_B,
+                                                         nullptr,
+                                                         nullptr,
+                                                         0,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         descrC,
+                                                         safe_size,
+                                                         dcsr_val_C,
+                                                         dcsr_row_ptr_C,
+                                                         dcsr_col_ind_C,
+                                                         info,
+                                                         dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_numeric<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_val_A,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrB,
+                                                         safe_size,
+                                                         dcsr_val_B,
+                                                         dcsr_row_ptr_B,
+                                                         dcsr_col_ind_B,
+                                                         nullptr,
+                                                         nullptr,
+                                                         0,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         descrC,
+                                                         safe_size,
+                                                         dcsr_val_C,
+                                                         dcsr_row_ptr_C,
+                                                         dcsr_col_ind_C,
+                                                         nullptr,
+                                                         dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_numeric<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_val_A,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrB,
+                                                         safe_size,
+                                                         dcsr_val_B,
+                                                         dcsr_row_ptr_B,
+                                                         dcsr_col_ind_B,
+                                                         nullptr,
+                                                         nullptr,
+                                                         0,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         descrC,
+                                                         safe_size,
+                                                         dcsr_val_C,
+                                                         dcsr_row_ptr_C,
+                                                         dcsr_col_ind_C,
+                                                         info,
+                                                         dbuffer),
+                            rocsparse_status_invalid_pointer);
+
     // ###############################################
     // Scenario 4: alpha != nullptr && beta != nullptr
     // ###############################################
@@ -2585,8 +2680,12 @@ void testing_csrgemm(const Arguments& arg)
                                                     info,
                                                     dbuffer));
 
-        // Pointer mode device
+        // Pointer mode device, no host synchronization is allowed
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
         CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
                                                     transA,
                                                     transB,
@@ -2611,6 +2710,9 @@ void testing_csrgemm(const Arguments& arg)
                                                     info,
                                                     dbuffer));
 
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
         // Copy output to host
         host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
         host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
@@ -2774,6 +2876,243 @@ void testing_csrgemm(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
         near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_1);
         near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
+
+        // Split symbolic and numeric phases, with the symbolic data reused for both
+        // pointer modes
+        device_vector<rocsparse_int> dcsr_col_ind_C_3(hnnz_C_1);
+        device_vector<T>             dcsr_val_C_3(hnnz_C_1);
+        device_vector<T>             dcsr_val_C_4(hnnz_C_1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         descrA,
+                                                         nnz_A,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrB,
+                                                         nnz_B,
+                                                         dcsr_row_ptr_B,
+                                                         dcsr_col_ind_B,
+                                                         descrD,
+                                                         nnz_D,
+                                                         dcsr_row_ptr_D,
+                                                         dcsr_col_ind_D,
+                                                         descrC,
+                                                         hnnz_C_1,
+                                                         dcsr_row_ptr_C_1,
+                                                         dcsr_col_ind_C_3,
+                                                         info,
+                                                         dbuffer));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_numeric<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_val_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           descrC,
+                                                           hnnz_C_1,
+                                                           dcsr_val_C_3,
+                                                           dcsr_row_ptr_C_1,
+                                                           dcsr_col_ind_C_3,
+                                                           info,
+                                                           dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_numeric<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           dalpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           dbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_val_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           descrC,
+                                                           hnnz_C_1,
+                                                           dcsr_val_C_4,
+                                                           dcsr_row_ptr_C_1,
+                                                           dcsr_col_ind_C_3,
+                                                           info,
+                                                           dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_col_ind_C_3(hnnz_C_1);
+        host_vector<T>             hcsr_val_C_3(hnnz_C_1);
+        host_vector<T>             hcsr_val_C_4(hnnz_C_1);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_3,
+                                  dcsr_col_ind_C_3,
+                                  sizeof(rocsparse_int) * hnnz_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_3, dcsr_val_C_3, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_4, dcsr_val_C_4, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+        // CPU csrgemm symbolic and numeric phases
+        host_vector<rocsparse_int> hcsr_col_ind_C_symbolic(hnnz_C_gold);
+        host_vector<T>             hcsr_val_C_numeric(hnnz_C_gold);
+        host_csrgemm_symbolic<T>(M,
+                                 N,
+                                 K,
+                                 halpha_ptr,
+                                 hcsr_row_ptr_A,
+                                 hcsr_col_ind_A,
+                                 hcsr_row_ptr_B,
+                                 hcsr_col_ind_B,
+                                 hbeta_ptr,
+                                 hcsr_row_ptr_D,
+                                 hcsr_col_ind_D,
+                                 hcsr_row_ptr_C_gold,
+                                 hcsr_col_ind_C_symbolic,
+                                 baseA,
+                                 baseB,
+                                 baseC,
+                                 baseD);
+        host_csrgemm_numeric<T>(M,
+                                N,
+                                K,
+                                halpha_ptr,
+                                hcsr_row_ptr_A,
+                                hcsr_col_ind_A,
+                                hcsr_val_A,
+                                hcsr_row_ptr_B,
+                                hcsr_col_ind_B,
+                                hcsr_val_B,
+                                hbeta_ptr,
+                                hcsr_row_ptr_D,
+                                hcsr_col_ind_D,
+                                hcsr_val_D,
+                                hcsr_row_ptr_C_gold,
+                                hcsr_col_ind_C_symbolic,
+                                hcsr_val_C_numeric,
+                                baseA,
+                                baseB,
+                                baseC,
+                                baseD);
+
+        // Check C
+        unit_check_general<rocsparse_int>(
+            1, hnnz_C_gold, 1, hcsr_col_ind_C_symbolic, hcsr_col_ind_C_3);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_numeric, hcsr_val_C_3);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_numeric, hcsr_val_C_4);
+
+        // New values with the same sparsity pattern, the symbolic data is reused
+        if(scenario == 2)
+        {
+            rocsparse_init<T>(hcsr_val_A, 1, nnz_A, 1);
+            rocsparse_init<T>(hcsr_val_B, 1, nnz_B, 1);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+        }
+        else if(scenario == 3)
+        {
+            rocsparse_init<T>(hcsr_val_D, 1, nnz_D, 1);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val_D, hcsr_val_D, sizeof(T) * nnz_D, hipMemcpyHostToDevice));
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_numeric<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_val_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           descrC,
+                                                           hnnz_C_1,
+                                                           dcsr_val_C_3,
+                                                           dcsr_row_ptr_C_1,
+                                                           dcsr_col_ind_C_3,
+                                                           info,
+                                                           dbuffer));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_3, dcsr_val_C_3, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+        host_csrgemm_numeric<T>(M,
+                                N,
+                                K,
+                                halpha_ptr,
+                                hcsr_row_ptr_A,
+                                hcsr_col_ind_A,
+                                hcsr_val_A,
+                                hcsr_row_ptr_B,
+                                hcsr_col_ind_B,
+                                hcsr_val_B,
+                                hbeta_ptr,
+                                hcsr_row_ptr_D,
+                                hcsr_col_ind_D,
+                                hcsr_val_D,
+                                hcsr_row_ptr_C_gold,
+                                hcsr_col_ind_C_symbolic,
+                                hcsr_val_C_numeric,
+                                baseA,
+                                baseB,
+                                baseC,
+                                baseD);
+
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_numeric, hcsr_val_C_3);
     }
 
     if(arg.timing)
@@ -2874,44 +3213,207 @@ void testing_csrgemm(const Arguments& arg)
 
         device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
         device_vector<T>             dcsr_val_C(hnnz_C_1);
+        host_vector<rocsparse_int>   hcsr_col_ind_C(hnnz_C_1);
+        host_vector<T>               hcsr_val_C(hnnz_C_1);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                if(scenario == 2)
+                {
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
+                                              hcsr_row_ptr_A,
+                                              sizeof(rocsparse_int) * (M + 1),
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_A,
+                                              hcsr_col_ind_A,
+                                              sizeof(rocsparse_int) * nnz_A,
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_B,
+                                              hcsr_row_ptr_B,
+                                              sizeof(rocsparse_int) * (K + 1),
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_B,
+                                              hcsr_col_ind_B,
+                                              sizeof(rocsparse_int) * nnz_B,
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+                }
+                else if(scenario == 3)
+                {
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_D,
+                                              hcsr_row_ptr_D,
+                                              sizeof(rocsparse_int) * (M + 1),
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_D,
+                                              hcsr_col_ind_D,
+                                              sizeof(rocsparse_int) * nnz_D,
+                                              hipMemcpyHostToDevice));
+                    CHECK_HIP_ERROR(hipMemcpy(
+                        dcsr_val_D, hcsr_val_D, sizeof(T) * nnz_D, hipMemcpyHostToDevice));
+                }
+            },
+            "nnz",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                                       transA,
+                                                                       transB,
+                                                                       M,
+                                                                       N,
+                                                                       K,
+                                                                       halpha_ptr,
+                                                                       descrA,
+                                                                       nnz_A,
+                                                                       dcsr_row_ptr_A,
+                                                                       dcsr_col_ind_A,
+                                                                       descrB,
+                                                                       nnz_B,
+                                                                       dcsr_row_ptr_B,
+                                                                       dcsr_col_ind_B,
+                                                                       hbeta_ptr,
+                                                                       descrD,
+                                                                       nnz_D,
+                                                                       dcsr_row_ptr_D,
+                                                                       dcsr_col_ind_D,
+                                                                       info,
+                                                                       &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            descrA,
+                                                            nnz_A,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrB,
+                                                            nnz_B,
+                                                            dcsr_row_ptr_B,
+                                                            dcsr_col_ind_B,
+                                                            descrD,
+                                                            nnz_D,
+                                                            dcsr_row_ptr_D,
+                                                            dcsr_col_ind_D,
+                                                            descrC,
+                                                            dcsr_row_ptr_C_1,
+                                                            &hnnz_C_1,
+                                                            info,
+                                                            dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_val_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           descrC,
+                                                           dcsr_val_C,
+                                                           dcsr_row_ptr_C_1,
+                                                           dcsr_col_ind_C,
+                                                           info,
+                                                           dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                          dcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * hnnz_C_1,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
+
+        // Symbolic phase is done once, only the numeric phase is repeated
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         descrA,
+                                                         nnz_A,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrB,
+                                                         nnz_B,
+                                                         dcsr_row_ptr_B,
+                                                         dcsr_col_ind_B,
+                                                         descrD,
+                                                         nnz_D,
+                                                         dcsr_row_ptr_D,
+                                                         dcsr_col_ind_D,
+                                                         descrC,
+                                                         hnnz_C_1,
+                                                         dcsr_row_ptr_C_1,
+                                                         dcsr_col_ind_C,
+                                                         info,
+                                                         dbuffer));
 
-        double gpu_solve_time_used = get_time_us();
+        double gpu_numeric_time_used = get_time_us();
 
-        // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
-                                                       transA,
-                                                       transB,
-                                                       M,
-                                                       N,
-                                                       K,
-                                                       halpha_ptr,
-                                                       descrA,
-                                                       nnz_A,
-                                                       dcsr_val_A,
-                                                       dcsr_row_ptr_A,
-                                                       dcsr_col_ind_A,
-                                                       descrB,
-                                                       nnz_B,
-                                                       dcsr_val_B,
-                                                       dcsr_row_ptr_B,
-                                                       dcsr_col_ind_B,
-                                                       hbeta_ptr,
-                                                       descrD,
-                                                       nnz_D,
-                                                       dcsr_val_D,
-                                                       dcsr_row_ptr_D,
-                                                       dcsr_col_ind_D,
-                                                       descrC,
-                                                       dcsr_val_C,
-                                                       dcsr_row_ptr_C_1,
-                                                       dcsr_col_ind_C,
-                                                       info,
-                                                       dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_numeric<T>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               halpha_ptr,
+                                                               descrA,
+                                                               nnz_A,
+                                                               dcsr_val_A,
+                                                               dcsr_row_ptr_A,
+                                                               dcsr_col_ind_A,
+                                                               descrB,
+                                                               nnz_B,
+                                                               dcsr_val_B,
+                                                               dcsr_row_ptr_B,
+                                                               dcsr_col_ind_B,
+                                                               hbeta_ptr,
+                                                               descrD,
+                                                               nnz_D,
+                                                               dcsr_val_D,
+                                                               dcsr_row_ptr_D,
+                                                               dcsr_col_ind_D,
+                                                               descrC,
+                                                               hnnz_C_1,
+                                                               dcsr_val_C,
+                                                               dcsr_row_ptr_C_1,
+                                                               dcsr_col_ind_C,
+                                                               info,
+                                                               dbuffer));
         }
 
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        gpu_numeric_time_used = (get_time_us() - gpu_numeric_time_used) / number_hot_calls;
 
         double gpu_gflops = csrgemm_gflop_count<T>(M,
                                                    halpha_ptr,
@@ -2935,8 +3437,9 @@ void testing_csrgemm(const Arguments& arg)
                   << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C" << std::setw(12)
                   << "nnz_D" << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
                   << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec"
-                  << std::setw(16) << "gemm msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << std::setw(16) << "gemm msec" << std::setw(16) << "numeric msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
 
         std::cout << std::setw(12) << rocsparse_operation2string(transA) << std::setw(12)
                   << rocsparse_operation2string(transB) << std::setw(12) << M << std::setw(12) << N
@@ -2960,8 +3463,9 @@ void testing_csrgemm(const Arguments& arg)
         }
         std::cout << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(16) << gpu_numeric_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 
     // Free buffer
@@ -22,6 +22,7 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 
 template <typename T>
@@ -537,7 +538,62 @@ void testing_csric0(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(M,
+                                     hcsr_row_ptr,
+                                     hcsr_col_ind,
+                                     base,
+                                     rocsparse_fill_mode_lower,
+                                     rocsparse_operation_none,
+                                     levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(handle,
+                                                                      M,
+                                                                      nnz,
+                                                                      descr,
+                                                                      dcsr_val_1,
+                                                                      dcsr_row_ptr,
+                                                                      dcsr_col_ind,
+                                                                      info,
+                                                                      &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(handle,
+                                                                   M,
+                                                                   nnz,
+                                                                   descr,
+                                                                   dcsr_val_1,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   info,
+                                                                   policy,
+                                                                   spol,
+                                                                   dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0<T>(handle,
+                                                          M,
+                                                          nnz,
+                                                          descr,
+                                                          dcsr_val_1,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          spol,
+                                                          dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csric0_clear(handle, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -595,33 +651,76 @@ void testing_csric0(const Arguments& arg)
                                 (h_analysis_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
                                                               : rocsparse_status_success);
 
-        double gpu_solve_time_used = 0;
-
-        // Solve run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_HIP_ERROR(
-                hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
-
-            double temp = get_time_us();
-            CHECK_ROCSPARSE_ERROR(rocsparse_csric0<T>(handle,
-                                                      M,
-                                                      nnz,
-                                                      descr,
-                                                      dcsr_val_1,
-                                                      dcsr_row_ptr,
-                                                      dcsr_col_ind,
-                                                      info,
-                                                      spol,
-                                                      dbuffer));
-            gpu_solve_time_used += (get_time_us() - temp);
-        }
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            "analysis",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(handle,
+                                                                      M,
+                                                                      nnz,
+                                                                      descr,
+                                                                      dcsr_val_1,
+                                                                      dcsr_row_ptr,
+                                                                      dcsr_col_ind,
+                                                                      info,
+                                                                      &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(handle,
+                                                                   M,
+                                                                   nnz,
+                                                                   descr,
+                                                                   dcsr_val_1,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   info,
+                                                                   apol,
+                                                                   spol,
+                                                                   dbuffer));
+            },
+            [&]() {
+                // Restore the matrix, excluded from the timing
+                timer.pause();
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                timer.resume();
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0<T>(handle,
+                                                          M,
+                                                          nnz,
+                                                          descr,
+                                                          dcsr_val_1,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          spol,
+                                                          dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            },
+            "clear",
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csric0_clear(handle, info)); });
 
         EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(handle, info, h_solve_pivot_1),
                                 (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
                                                            : rocsparse_status_success);
 
-        gpu_solve_time_used = gpu_solve_time_used / number_hot_calls;
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = csric0_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6;
 
@@ -647,14 +746,15 @@ void testing_csric0(const Arguments& arg)
                   << std::setw(16) << "analysis policy" << std::setw(16) << "solve policy"
                   << std::setw(12) << "GB/s" << std::setw(16) << "analysis msec" << std::setw(16)
                   << "solve msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
-                  << std::endl;
+                  << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << pivot
                   << std::setw(16) << rocsparse_analysis2string(apol) << std::setw(16)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Clear csric0 meta data
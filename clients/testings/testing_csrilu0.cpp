@@ -22,6 +22,7 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 
 #include "testing_csrilu0.hpp"
@@ -315,6 +316,15 @@ void testing_csrilu0_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrilu0_level_info()
+    rocsparse_level_info level_info;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_level_info(nullptr, info, &level_info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_level_info(handle, nullptr, &level_info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_level_info(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csrilu0_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_clear(nullptr, info),
                             rocsparse_status_invalid_handle);
@@ -567,6 +577,22 @@ void testing_csrilu0(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
 
+        // Check level schedule, no meta data is collected for empty matrices
+        rocsparse_level_info     h_level_info;
+        rocsparse_level_schedule h_level_gold;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_level_info(handle, info, &h_level_info));
+        if(nnz > 0)
+        {
+            rocsparse_csr_analyze_levels(M,
+                                         hcsr_row_ptr,
+                                         hcsr_col_ind,
+                                         base,
+                                         rocsparse_fill_mode_lower,
+                                         rocsparse_operation_none,
+                                         h_level_gold);
+        }
+        unit_check_level_info(h_level_gold, h_level_info);
+
         // Check solution vector if no pivot has been found
         if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
         {
@@ -575,7 +601,62 @@ void testing_csrilu0(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(M,
+                                     hcsr_row_ptr,
+                                     hcsr_col_ind,
+                                     base,
+                                     rocsparse_fill_mode_lower,
+                                     rocsparse_operation_none,
+                                     levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                                       M,
+                                                                       nnz,
+                                                                       descr,
+                                                                       dcsr_val_1,
+                                                                       dcsr_row_ptr,
+                                                                       dcsr_col_ind,
+                                                                       info,
+                                                                       &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                                    M,
+                                                                    nnz,
+                                                                    descr,
+                                                                    dcsr_val_1,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    info,
+                                                                    policy,
+                                                                    spol,
+                                                                    dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0<T>(handle,
+                                                           M,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val_1,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           spol,
+                                                           dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -625,24 +706,66 @@ void testing_csrilu0(const Arguments& arg)
 
         gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
 
-        double gpu_solve_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0<T>(handle,
-                                                       M,
-                                                       nnz,
-                                                       descr,
-                                                       dcsr_val_1,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind,
-                                                       info,
-                                                       spol,
-                                                       dbuffer));
-        }
-
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_1, hcsr_val_gold, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            "analysis",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                                       M,
+                                                                       nnz,
+                                                                       descr,
+                                                                       dcsr_val_1,
+                                                                       dcsr_row_ptr,
+                                                                       dcsr_col_ind,
+                                                                       info,
+                                                                       &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                                    M,
+                                                                    nnz,
+                                                                    descr,
+                                                                    dcsr_val_1,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    info,
+                                                                    apol,
+                                                                    spol,
+                                                                    dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0<T>(handle,
+                                                           M,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val_1,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           spol,
+                                                           dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            },
+            "clear",
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info)); });
+
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = csrilu0_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6;
 
@@ -654,7 +777,7 @@ void testing_csrilu0(const Arguments& arg)
                   << std::setw(16) << "analysis policy" << std::setw(16) << "solve policy"
                   << std::setw(12) << "GB/s" << std::setw(16) << "analysis msec" << std::setw(16)
                   << "solve msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
-                  << std::endl;
+                  << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12)
                   << std::min(h_analysis_pivot_gold[0], h_solve_pivot_gold[0]) << std::setw(16)
@@ -662,7 +785,8 @@ void testing_csrilu0(const Arguments& arg)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Clear csrilu0 meta data
@@ -238,6 +238,11 @@ void testing_csrmm(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set matrix type, fill mode and diagonal type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, arg.mattype));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, arg.uplo));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, arg.diag));
+
     // Argument sanity check before allocating invalid memory
     if(M <= 0 || N <= 0 || K <= 0)
     {
@@ -389,19 +394,56 @@ void testing_csrmm(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
 
         // CPU csrmm
-        host_csrmm<T>(ldc,
-                      N,
-                      transB,
-                      h_alpha,
-                      hcsr_row_ptr,
-                      hcsr_col_ind,
-                      hcsr_val,
-                      hB,
-                      ldb,
-                      h_beta,
-                      hC_gold,
-                      ldc,
-                      base);
+        if(arg.mattype == rocsparse_matrix_type_general)
+        {
+            host_csrmm<T>(ldc,
+                          N,
+                          transB,
+                          h_alpha,
+                          hcsr_row_ptr,
+                          hcsr_col_ind,
+                          hcsr_val,
+                          hB,
+                          ldb,
+                          h_beta,
+                          hC_gold,
+                          ldc,
+                          base);
+        }
+        else
+        {
+            // Expand the stored triangle into op(A)
+            std::vector<rocsparse_int> hgen_row_ptr;
+            std::vector<rocsparse_int> hgen_col_ind;
+            std::vector<T>             hgen_val;
+
+            host_csr_to_general(transA,
+                                arg.mattype,
+                                arg.uplo,
+                                arg.diag,
+                                M,
+                                hcsr_row_ptr,
+                                hcsr_col_ind,
+                                hcsr_val,
+                                hgen_row_ptr,
+                                hgen_col_ind,
+                                hgen_val,
+                                base);
+
+            host_csrmm<T>(M,
+                          N,
+                          transB,
+                          h_alpha,
+                          hgen_row_ptr,
+                          hgen_col_ind,
+                          hgen_val,
+                          hB,
+                          ldb,
+                          h_beta,
+                          hC_gold,
+                          ldc,
+                          base);
+        }
 
         near_check_general<T>(ldc, N, ldc, hC_gold, hC_1);
         near_check_general<T>(ldc, N, ldc, hC_gold, hC_2);
@@ -0,0 +1,730 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrmspv_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    size_t buffer_size;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dx_ind(safe_size);
+    device_vector<T>             dx_val(safe_size);
+    device_vector<T>             dy(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx_ind || !dx_val || !dy || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrmspv_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_buffer_size<T>(nullptr,
+                                                             safe_size,
+                                                             safe_size,
+                                                             safe_size,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             &buffer_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_buffer_size<T>(handle,
+                                                             safe_size,
+                                                             safe_size,
+                                                             safe_size,
+                                                             nullptr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_buffer_size<T>(handle,
+                                                             -1,
+                                                             safe_size,
+                                                             safe_size,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_buffer_size<T>(handle,
+                                                             safe_size,
+                                                             safe_size,
+                                                             safe_size,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmspv_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(nullptr,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          nullptr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          nullptr,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                          -1,
+                                                          safe_size,
+                                                          safe_size,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          descr,
+                                                          dcsr_val,
+                                                          nullptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmspv()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(nullptr,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 -1,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 -1,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 nullptr,
+                                                 &h_beta,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 nullptr,
+                                                 dy,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 &h_alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 info,
+                                                 safe_size,
+                                                 dx_val,
+                                                 dx_ind,
+                                                 &h_beta,
+                                                 nullptr,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmspv_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrmspv(const Arguments& arg)
+{
+    rocsparse_int        M        = arg.M;
+    rocsparse_int        N        = arg.N;
+    rocsparse_operation  trans    = arg.transA;
+    rocsparse_index_base base     = arg.baseA;
+    uint32_t             analysis = arg.algo;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info_ptr;
+
+    // Differentiate between algorithm 0 (csrmspv without analysis step) and
+    //                       algorithm 1 (csrmspv with analysis step)
+    rocsparse_mat_info info = analysis ? info_ptr : nullptr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dx_ind(safe_size);
+        device_vector<T>             dx_val(safe_size);
+        device_vector<T>             dy(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx_ind || !dx_val || !dy || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_status status = (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                   : rocsparse_status_success;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // If analysis, perform analysis step
+        if(analysis)
+        {
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_analysis<T>(handle,
+                                                                  M,
+                                                                  N,
+                                                                  safe_size,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  info,
+                                                                  dbuffer),
+                                    status);
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv<T>(handle,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     safe_size,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     info,
+                                                     safe_size,
+                                                     dx_val,
+                                                     dx_ind,
+                                                     &h_beta,
+                                                     dy,
+                                                     dbuffer),
+                                status);
+
+        // If analysis, clear data
+        if(analysis)
+        {
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmspv_clear(handle, info),
+                                    rocsparse_status_success);
+        }
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Dimensions of x and y
+    rocsparse_int len_x = (trans == rocsparse_operation_none) ? N : M;
+    rocsparse_int len_y = (trans == rocsparse_operation_none) ? M : N;
+
+    // Number of non-zero entries of x, arg.nnz controls the density of the frontier
+    rocsparse_int nnz_x = std::min(std::max(arg.nnz, 1), len_x);
+
+    // Allocate host memory for vectors
+    host_vector<rocsparse_int> hx_ind(nnz_x);
+    host_vector<T>             hx_val(nnz_x);
+    host_vector<T>             hy_1(len_y);
+    host_vector<T>             hy_2(len_y);
+    host_vector<T>             hy_gold(len_y);
+
+    // Initialize data on CPU
+    rocsparse_init_index(hx_ind, nnz_x, base, len_x + base);
+    rocsparse_init<T>(hx_val, 1, nnz_x, 1);
+    rocsparse_init<T>(hy_1, 1, len_y, 1);
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dx_ind(nnz_x);
+    device_vector<T>             dx_val(nnz_x);
+    device_vector<T>             dy_1(len_y);
+    device_vector<T>             dy_2(len_y);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx_ind || !dx_val || !dy_1 || !dy_2
+       || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_ind, hx_ind, sizeof(rocsparse_int) * nnz_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val, sizeof(T) * nnz_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * len_y, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv_buffer_size<T>(
+        handle, M, N, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // If analysis, run analysis step
+    if(analysis)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv_analysis<T>(
+            handle, M, N, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, dbuffer));
+    }
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * len_y, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv<T>(handle,
+                                                   trans,
+                                                   M,
+                                                   N,
+                                                   nnz,
+                                                   &h_alpha,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   info,
+                                                   nnz_x,
+                                                   dx_val,
+                                                   dx_ind,
+                                                   &h_beta,
+                                                   dy_1,
+                                                   dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv<T>(handle,
+                                                   trans,
+                                                   M,
+                                                   N,
+                                                   nnz,
+                                                   d_alpha,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   info,
+                                                   nnz_x,
+                                                   dx_val,
+                                                   dx_ind,
+                                                   d_beta,
+                                                   dy_2,
+                                                   dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * len_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * len_y, hipMemcpyDeviceToHost));
+
+        // CPU csrmspv
+        host_csrmspv<T>(trans,
+                        M,
+                        N,
+                        nnz,
+                        h_alpha,
+                        hcsr_row_ptr,
+                        hcsr_col_ind,
+                        hcsr_val,
+                        nnz_x,
+                        hx_val,
+                        hx_ind,
+                        h_beta,
+                        hy_gold,
+                        base);
+
+        near_check_general<T>(1, len_y, 1, hy_gold, hy_1);
+        near_check_general<T>(1, len_y, 1, hy_gold, hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv<T>(handle,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       nnz,
+                                                       &h_alpha,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       nnz_x,
+                                                       dx_val,
+                                                       dx_ind,
+                                                       &h_beta,
+                                                       dy_1,
+                                                       dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv<T>(handle,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       nnz,
+                                                       &h_alpha,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       nnz_x,
+                                                       dx_val,
+                                                       dx_ind,
+                                                       &h_beta,
+                                                       dy_1,
+                                                       dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // Number of matrix entries touched by the non-zero entries of x
+        rocsparse_int nnz_touched = 0;
+
+        if(trans == rocsparse_operation_none)
+        {
+            std::vector<bool> active(N, false);
+            for(rocsparse_int i = 0; i < nnz_x; ++i)
+            {
+                active[hx_ind[i] - base] = true;
+            }
+
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                nnz_touched += active[hcsr_col_ind[i] - base];
+            }
+        }
+        else
+        {
+            for(rocsparse_int i = 0; i < nnz_x; ++i)
+            {
+                rocsparse_int row = hx_ind[i] - base;
+                nnz_touched += hcsr_row_ptr[row + 1] - hcsr_row_ptr[row];
+            }
+        }
+
+        double gpu_gflops = spmv_gflop_count<T>(len_y, nnz_touched, h_beta != static_cast<T>(0))
+                            / gpu_time_used * 1e6;
+        double gpu_gbyte
+            = csrmspv_gbyte_count<T>(len_y, nnz_x, nnz_touched, h_beta != static_cast<T>(0))
+              / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "nnz_x" << std::setw(12) << "alpha" << std::setw(12)
+                  << "beta" << std::setw(12) << "Algorithm" << std::setw(12) << "GFlop/s"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << nnz_x << std::setw(12) << h_alpha << std::setw(12) << h_beta
+                  << std::setw(12) << (analysis ? "analysis" : "default") << std::setw(12)
+                  << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // If analysis, clear analysis data
+    if(analysis)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmspv_clear(handle, info));
+    }
+
+    // Clear buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrmspv_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmspv<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -24,6 +24,60 @@
 
 #include "testing.hpp"
 
+// The stream and adaptive algorithms are selected by rocsparse_csrmv() depending on the
+// presence of info, the merge path algorithm is selected explicitly.
+template <typename T>
+static rocsparse_status testing_csrmv_call(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_csrmv_alg       alg,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const T*                  x,
+                                           const T*                  beta,
+                                           T*                        y)
+{
+    if(alg == rocsparse_csrmv_alg_merge_path)
+    {
+        return rocsparse_csrmv_ex<T>(handle,
+                                     trans,
+                                     alg,
+                                     m,
+                                     n,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     x,
+                                     beta,
+                                     y);
+    }
+
+    return rocsparse_csrmv<T>(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              x,
+                              beta,
+                              y);
+}
+
 template <typename T>
 void testing_csrmv_bad_arg(const Arguments& arg)
 {
@@ -259,6 +313,104 @@ void testing_csrmv_bad_arg(const Arguments& arg)
                                                nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrmv_ex()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_ex<T>(nullptr,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_csrmv_alg_merge_path,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  nullptr,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  (rocsparse_csrmv_alg)3,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  nullptr,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_csrmv_alg_merge_path,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  nullptr,
+                                                  dx,
+                                                  &h_beta,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // The adaptive algorithm requires the analysis step
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_csrmv_alg_adaptive,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+
+    // Symmetric matrices have to be square
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(handle,
+                                                        rocsparse_operation_none,
+                                                        safe_size,
+                                                        safe_size - 1,
+                                                        safe_size,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv<T>(handle,
+                                               rocsparse_operation_none,
+                                               safe_size,
+                                               safe_size - 1,
+                                               safe_size,
+                                               &h_alpha,
+                                               descr,
+                                               dcsr_val,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               info,
+                                               dx,
+                                               &h_beta,
+                                               dy),
+                            rocsparse_status_invalid_size);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
     // Test rocsparse_csrmv_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_clear(nullptr, info), rocsparse_status_invalid_handle);
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_clear(handle, nullptr),
@@ -272,7 +424,8 @@ void testing_csrmv(const Arguments& arg)
     rocsparse_int        N        = arg.N;
     rocsparse_operation  trans    = arg.transA;
     rocsparse_index_base base     = arg.baseA;
-    uint32_t             adaptive = arg.algo;
+    rocsparse_csrmv_alg  alg      = (rocsparse_csrmv_alg)arg.algo;
+    bool                 adaptive = (alg == rocsparse_csrmv_alg_adaptive);
 
     T h_alpha = arg.get_alpha<T>();
     T h_beta  = arg.get_beta<T>();
@@ -286,13 +439,19 @@ void testing_csrmv(const Arguments& arg)
     // Create matrix info
     rocsparse_local_mat_info info_ptr;
 
-    // Differentiate between algorithm 0 (csrmv without analysis step) and
-    //                       algorithm 1 (csrmv with analysis step)
+    // Differentiate between algorithm 0 (csrmv without analysis step),
+    //                       algorithm 1 (csrmv with analysis step) and
+    //                       algorithm 2 (merge path csrmv without analysis step)
     rocsparse_mat_info info = adaptive ? info_ptr : nullptr;
 
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set matrix type, fill mode and diagonal type
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, arg.mattype));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, arg.uplo));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, arg.diag));
+
     // Argument sanity check before allocating invalid memory
     if(M <= 0 || N <= 0)
     {
@@ -330,20 +489,21 @@ void testing_csrmv(const Arguments& arg)
                                                      : rocsparse_status_success);
         }
 
-        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv<T>(handle,
-                                                   trans,
-                                                   M,
-                                                   N,
-                                                   safe_size,
-                                                   &h_alpha,
-                                                   descr,
-                                                   dcsr_val,
-                                                   dcsr_row_ptr,
-                                                   dcsr_col_ind,
-                                                   info,
-                                                   dx,
-                                                   &h_beta,
-                                                   dy),
+        EXPECT_ROCSPARSE_STATUS(testing_csrmv_call<T>(handle,
+                                                      trans,
+                                                      alg,
+                                                      M,
+                                                      N,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
                                 (M < 0 || N < 0) ? rocsparse_status_invalid_size
                                                  : rocsparse_status_success);
 
@@ -368,7 +528,7 @@ void testing_csrmv(const Arguments& arg)
     hipDeviceProp_t prop;
     hipGetDeviceProperties(&prop, dev);
 
-    bool type = (prop.warpSize == 32) ? true : adaptive;
+    bool type = (prop.warpSize == 32) ? true : (alg != rocsparse_csrmv_alg_stream);
 
     static constexpr bool       full_rank = false;
     rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : type, full_rank);
@@ -377,15 +537,19 @@ void testing_csrmv(const Arguments& arg)
     rocsparse_int nnz;
     matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
 
+    // Vector lengths depend on the operation type
+    rocsparse_int len_x = (trans == rocsparse_operation_none) ? N : M;
+    rocsparse_int len_y = (trans == rocsparse_operation_none) ? M : N;
+
     // Allocate host memory for vectors
-    host_vector<T> hx(N);
-    host_vector<T> hy_1(M);
-    host_vector<T> hy_2(M);
-    host_vector<T> hy_gold(M);
+    host_vector<T> hx(len_x);
+    host_vector<T> hy_1(len_y);
+    host_vector<T> hy_2(len_y);
+    host_vector<T> hy_gold(len_y);
 
     // Initialize data on CPU
-    rocsparse_init<T>(hx, 1, N, 1);
-    rocsparse_init<T>(hy_1, 1, M, 1);
+    rocsparse_init<T>(hx, 1, len_x, 1);
+    rocsparse_init<T>(hy_1, 1, len_y, 1);
     hy_2    = hy_1;
     hy_gold = hy_1;
 
@@ -393,9 +557,9 @@ void testing_csrmv(const Arguments& arg)
     device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
     device_vector<rocsparse_int> dcsr_col_ind(nnz);
     device_vector<T>             dcsr_val(nnz);
-    device_vector<T>             dx(N);
-    device_vector<T>             dy_1(M);
-    device_vector<T>             dy_2(M);
+    device_vector<T>             dx(len_x);
+    device_vector<T>             dy_1(len_y);
+    device_vector<T>             dy_2(len_y);
     device_vector<T>             d_alpha(1);
     device_vector<T>             d_beta(1);
 
@@ -411,8 +575,8 @@ void testing_csrmv(const Arguments& arg)
     CHECK_HIP_ERROR(
         hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * len_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * len_y, hipMemcpyHostToDevice));
 
     // If adaptive, run analysis step
     if(adaptive)
@@ -424,63 +588,104 @@ void testing_csrmv(const Arguments& arg)
     if(arg.unit_check)
     {
         // Copy data from CPU to device
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * M, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * len_y, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
         // Pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
-        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
-                                                 trans,
-                                                 M,
-                                                 N,
-                                                 nnz,
-                                                 &h_alpha,
-                                                 descr,
-                                                 dcsr_val,
-                                                 dcsr_row_ptr,
-                                                 dcsr_col_ind,
-                                                 info,
-                                                 dx,
-                                                 &h_beta,
-                                                 dy_1));
+        CHECK_ROCSPARSE_ERROR(testing_csrmv_call<T>(handle,
+                                                    trans,
+                                                    alg,
+                                                    M,
+                                                    N,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dx,
+                                                    &h_beta,
+                                                    dy_1));
 
         // Pointer mode device
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
-        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
-                                                 trans,
-                                                 M,
-                                                 N,
-                                                 nnz,
-                                                 d_alpha,
-                                                 descr,
-                                                 dcsr_val,
-                                                 dcsr_row_ptr,
-                                                 dcsr_col_ind,
-                                                 info,
-                                                 dx,
-                                                 d_beta,
-                                                 dy_2));
+        CHECK_ROCSPARSE_ERROR(testing_csrmv_call<T>(handle,
+                                                    trans,
+                                                    alg,
+                                                    M,
+                                                    N,
+                                                    nnz,
+                                                    d_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dx,
+                                                    d_beta,
+                                                    dy_2));
 
         // Copy output to host
-        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * len_y, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * len_y, hipMemcpyDeviceToHost));
 
         // CPU csrmv
-        host_csrmv<T>(M,
-                      nnz,
-                      h_alpha,
-                      hcsr_row_ptr,
-                      hcsr_col_ind,
-                      hcsr_val,
-                      hx,
-                      h_beta,
-                      hy_gold,
-                      base,
-                      adaptive);
-
-        near_check_general<T>(1, M, 1, hy_gold, hy_1);
-        near_check_general<T>(1, M, 1, hy_gold, hy_2);
+        if(arg.mattype == rocsparse_matrix_type_general)
+        {
+            host_csrmv<T>(trans,
+                          M,
+                          N,
+                          nnz,
+                          h_alpha,
+                          hcsr_row_ptr,
+                          hcsr_col_ind,
+                          hcsr_val,
+                          hx,
+                          h_beta,
+                          hy_gold,
+                          base,
+                          arg.algo);
+        }
+        else
+        {
+            // Expand the stored triangle into op(A)
+            std::vector<rocsparse_int> hgen_row_ptr;
+            std::vector<rocsparse_int> hgen_col_ind;
+            std::vector<T>             hgen_val;
+
+            host_csr_to_general(trans,
+                                arg.mattype,
+                                arg.uplo,
+                                arg.diag,
+                                M,
+                                hcsr_row_ptr,
+                                hcsr_col_ind,
+                                hcsr_val,
+                                hgen_row_ptr,
+                                hgen_col_ind,
+                                hgen_val,
+                                base);
+
+            host_csrmv<T>(rocsparse_operation_none,
+                          M,
+                          M,
+                          hgen_row_ptr[M] - base,
+                          h_alpha,
+                          hgen_row_ptr.data(),
+                          hgen_col_ind.data(),
+                          hgen_val.data(),
+                          hx,
+                          h_beta,
+                          hy_gold,
+                          base,
+                          arg.algo);
+        }
+
+        near_check_general<T>(1, len_y, 1, hy_gold, hy_1);
+        near_check_general<T>(1, len_y, 1, hy_gold, hy_2);
     }
 
     if(arg.timing)
@@ -493,49 +698,83 @@ void testing_csrmv(const Arguments& arg)
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
-                                                     trans,
-                                                     M,
-                                                     N,
-                                                     nnz,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dcsr_val,
-                                                     dcsr_row_ptr,
-                                                     dcsr_col_ind,
-                                                     info,
-                                                     dx,
-                                                     &h_beta,
-                                                     dy_1));
-        }
-
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
-                                                     trans,
-                                                     M,
-                                                     N,
-                                                     nnz,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dcsr_val,
-                                                     dcsr_row_ptr,
-                                                     dcsr_col_ind,
-                                                     info,
-                                                     dx,
-                                                     &h_beta,
-                                                     dy_1));
+            CHECK_ROCSPARSE_ERROR(testing_csrmv_call<T>(handle,
+                                                        trans,
+                                                        alg,
+                                                        M,
+                                                        N,
+                                                        nnz,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        dx,
+                                                        &h_beta,
+                                                        dy_1));
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * len_x, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * len_y, hipMemcpyHostToDevice));
+            },
+            adaptive ? "analysis" : nullptr,
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                                  trans,
+                                                                  M,
+                                                                  N,
+                                                                  nnz,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  info));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(testing_csrmv_call<T>(handle,
+                                                            trans,
+                                                            alg,
+                                                            M,
+                                                            N,
+                                                            nnz,
+                                                            &h_alpha,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            dx,
+                                                            &h_beta,
+                                                            dy_1));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * len_y, hipMemcpyDeviceToHost));
+            },
+            adaptive ? "clear" : nullptr,
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info)); });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops
-            = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
-        double gpu_gbyte
-            = csrmv_gbyte_count<T>(M, N, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+            = spmv_gflop_count<T>(len_y, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+        double gpu_gbyte = csrmv_gbyte_count<T>(len_y, len_x, nnz, h_beta != static_cast<T>(0))
+                           / gpu_time_used * 1e6;
 
         std::cout.precision(2);
         std::cout.setf(std::ios::fixed);
@@ -545,14 +784,15 @@ void testing_csrmv(const Arguments& arg)
                   << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
                   << "Algorithm" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
                   << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << h_alpha << std::setw(12) << h_beta << std::setw(12)
-                  << (adaptive ? "adaptive" : "stream") << std::setw(12) << gpu_gflops
+                  << rocsparse_csrmvalg2string(alg) << std::setw(12) << gpu_gflops
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // If adaptive, clear analysis data
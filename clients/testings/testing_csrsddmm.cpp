@@ -0,0 +1,501 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrsddmm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<T>             dA(safe_size);
+    device_vector<T>             dB(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dA || !dB)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrsddmm()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(nullptr,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  nullptr,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  nullptr,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  nullptr,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  nullptr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  nullptr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  nullptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrsddmm(const Arguments& arg)
+{
+    rocsparse_int        M      = arg.M;
+    rocsparse_int        N      = arg.N;
+    rocsparse_int        K      = arg.K;
+    rocsparse_operation  transA = arg.transA;
+    rocsparse_operation  transB = arg.transB;
+    rocsparse_index_base base   = arg.baseA;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K < 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dA(safe_size);
+        device_vector<T>             dB(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dA || !dB)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      dA,
+                                                      safe_size,
+                                                      dB,
+                                                      safe_size,
+                                                      &h_beta,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind),
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val_1;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    // Sample sparsity pattern of C
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val_1, M, N, nnz, base);
+
+    // Some matrix properties
+    rocsparse_int lda = std::max(1, (transA == rocsparse_operation_none) ? M : K);
+    rocsparse_int ldb = std::max(1, (transB == rocsparse_operation_none) ? K : N);
+
+    rocsparse_int ncol_A = (transA == rocsparse_operation_none) ? K : M;
+    rocsparse_int ncol_B = (transB == rocsparse_operation_none) ? N : K;
+    rocsparse_int nnz_A  = lda * ncol_A;
+    rocsparse_int nnz_B  = ldb * ncol_B;
+
+    // Allocate host memory for dense matrices
+    host_vector<T> hA(nnz_A);
+    host_vector<T> hB(nnz_B);
+    host_vector<T> hcsr_val_2(nnz);
+    host_vector<T> hcsr_val_gold(nnz);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hA, lda, ncol_A, lda);
+    rocsparse_init<T>(hB, ldb, ncol_B, ldb);
+    hcsr_val_2    = hcsr_val_1;
+    hcsr_val_gold = hcsr_val_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val_1(nnz);
+    device_vector<T>             dcsr_val_2(nnz);
+    device_vector<T>             dA(nnz_A);
+    device_vector<T>             dB(nnz_B);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val_1 || !dcsr_val_2 || !dA || !dB || !d_alpha
+       || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_1, hcsr_val_1, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_2, hcsr_val_2, sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    descr,
+                                                    dcsr_val_1,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nnz,
+                                                    d_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    d_beta,
+                                                    descr,
+                                                    dcsr_val_2,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2, dcsr_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csrsddmm
+        host_csrsddmm<T>(M,
+                         N,
+                         K,
+                         transA,
+                         transB,
+                         h_alpha,
+                         hA,
+                         lda,
+                         hB,
+                         ldb,
+                         h_beta,
+                         hcsr_row_ptr,
+                         hcsr_col_ind,
+                         hcsr_val_gold,
+                         base);
+
+        near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val_1);
+        near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        nnz,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        descr,
+                                                        dcsr_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        nnz,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        descr,
+                                                        dcsr_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops
+            = csrsddmm_gflop_count<T>(K, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+        double gpu_gbyte
+            = csrsddmm_gbyte_count<T>(M, N, K, nnz, h_beta != static_cast<T>(0)) / gpu_time_used
+              * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
+                  << std::setw(12) << "transA" << std::setw(12) << "transB" << std::setw(12)
+                  << "nnz" << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
+                  << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K << std::setw(12)
+                  << rocsparse_operation2string(transA) << std::setw(12)
+                  << rocsparse_operation2string(transB) << std::setw(12) << nnz << std::setw(12)
+                  << h_alpha << std::setw(12) << h_beta << std::setw(12) << gpu_gflops
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csrsddmm_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrsddmm<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
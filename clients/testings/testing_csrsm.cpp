@@ -21,6 +21,7 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 
 template <typename T>
@@ -893,7 +894,75 @@ void testing_csrsm(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(M, hcsr_row_ptr, hcsr_col_ind, base, uplo, transA, levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_buffer_size<T>(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     nrhs,
+                                                                     nnz,
+                                                                     &h_alpha,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     dB_1,
+                                                                     ldb,
+                                                                     info,
+                                                                     spol,
+                                                                     &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_analysis<T>(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  nrhs,
+                                                                  nnz,
+                                                                  &h_alpha,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  dB_1,
+                                                                  ldb,
+                                                                  info,
+                                                                  policy,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_solve<T>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               nrhs,
+                                                               nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dB_1,
+                                                               ldb,
+                                                               info,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_clear(handle, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -961,30 +1030,85 @@ void testing_csrsm(const Arguments& arg)
 
         gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
 
-        double gpu_solve_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_solve<T>(handle,
-                                                           transA,
-                                                           transB,
-                                                           M,
-                                                           nrhs,
-                                                           nnz,
-                                                           &h_alpha,
-                                                           descr,
-                                                           dcsr_val,
-                                                           dcsr_row_ptr,
-                                                           dcsr_col_ind,
-                                                           dB_1,
-                                                           ldb,
-                                                           info,
-                                                           spol,
-                                                           dbuffer));
-        }
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dB_1, hB_1, sizeof(T) * M * nrhs, hipMemcpyHostToDevice));
+            },
+            "analysis",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_buffer_size<T>(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     nrhs,
+                                                                     nnz,
+                                                                     &h_alpha,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     dB_1,
+                                                                     ldb,
+                                                                     info,
+                                                                     spol,
+                                                                     &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_analysis<T>(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  nrhs,
+                                                                  nnz,
+                                                                  &h_alpha,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  dB_1,
+                                                                  ldb,
+                                                                  info,
+                                                                  apol,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_solve<T>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               nrhs,
+                                                               nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dB_1,
+                                                               ldb,
+                                                               info,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hB_1, dB_1, sizeof(T) * M * nrhs, hipMemcpyDeviceToHost));
+            },
+            "clear",
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrsm_clear(handle, info)); });
 
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops = csrsv_gflop_count<T>(M, nnz, diag) / gpu_solve_time_used * 1e6 * nrhs;
         double gpu_gbyte  = csrsv_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6 * nrhs;
@@ -999,7 +1123,8 @@ void testing_csrsm(const Arguments& arg)
                   << std::setw(12) << "fill_mode" << std::setw(16) << "analysis_policy"
                   << std::setw(16) << "solve_policy" << std::setw(12) << "GFlop/s" << std::setw(12)
                   << "GB/s" << std::setw(16) << "analysis_msec" << std::setw(16) << "solve_msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nrhs
                   << std::setw(12) << h_alpha << std::setw(12)
@@ -1012,7 +1137,8 @@ void testing_csrsm(const Arguments& arg)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
                   << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Clear csrsm meta data
@@ -268,6 +268,36 @@ void testing_csrsort(const Arguments& arg)
 
             unit_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val);
         }
+
+        // Sorting sorted input must neither change the column indices nor the permutation
+        host_vector<rocsparse_int> hperm_sorted(nnz);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm_sorted, dperm, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        // Sorting is not allowed to synchronize the host
+        rocsparse_sync_probe probe(handle);
+        CHECK_HIP_ERROR(probe.block());
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsort(handle,
+                                                M,
+                                                N,
+                                                nnz,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                permute ? dperm : nullptr,
+                                                dbuffer));
+
+        bool synchronized = probe.release();
+        ASSERT_EQ(synchronized, false);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind, dcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm, dperm, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcsr_col_ind_gold, hcsr_col_ind);
+        unit_check_general<rocsparse_int>(1, nnz, 1, hperm_sorted, hperm);
     }
 
     if(arg.timing)
@@ -22,6 +22,7 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_amortization.hpp"
 #include "testing.hpp"
 
 template <typename T>
@@ -388,6 +389,21 @@ void testing_csrsv_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrsv_level_info()
+    rocsparse_level_info level_info;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(nullptr, rocsparse_operation_none, descr, info, &level_info),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, rocsparse_operation_none, nullptr, info, &level_info),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, rocsparse_operation_none, descr, nullptr, &level_info),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, rocsparse_operation_none, descr, info, nullptr),
+        rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csrsv_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_clear(nullptr, descr, info),
                             rocsparse_status_invalid_handle);
@@ -693,6 +709,17 @@ void testing_csrsv(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
         unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
 
+        // Check level schedule, no meta data is collected for empty matrices
+        rocsparse_level_info     h_level_info;
+        rocsparse_level_schedule h_level_gold;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(handle, trans, descr, info, &h_level_info));
+        if(nnz > 0)
+        {
+            rocsparse_csr_analyze_levels(
+                M, hcsr_row_ptr, hcsr_col_ind, base, uplo, trans, h_level_gold);
+        }
+        unit_check_level_info(h_level_gold, h_level_info);
+
         // Check solution vector if no pivot has been found
         if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
         {
@@ -701,7 +728,62 @@ void testing_csrsv(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.timing_mode == rocsparse_timing_amortization)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_level_schedule levels;
+        rocsparse_csr_analyze_levels(M, hcsr_row_ptr, hcsr_col_ind, base, uplo, trans, levels);
+
+        rocsparse_bench_amortization(
+            arg.iters,
+            levels,
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                                     trans,
+                                                                     M,
+                                                                     nnz,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     info,
+                                                                     &size));
+            },
+            [&](rocsparse_analysis_policy policy) {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                                  trans,
+                                                                  M,
+                                                                  nnz,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  info,
+                                                                  policy,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                               trans,
+                                                               M,
+                                                               nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               info,
+                                                               dx,
+                                                               dy_1,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info)); });
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -757,28 +839,72 @@ void testing_csrsv(const Arguments& arg)
 
         gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
 
-        double gpu_solve_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
-                                                           trans,
-                                                           M,
-                                                           nnz,
-                                                           &h_alpha,
-                                                           descr,
-                                                           dcsr_val,
-                                                           dcsr_row_ptr,
-                                                           dcsr_col_ind,
-                                                           info,
-                                                           dx,
-                                                           dy_1,
-                                                           spol,
-                                                           dbuffer));
-        }
-
-        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr,
+                                          hcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind,
+                                          hcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+            },
+            "analysis",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                                     trans,
+                                                                     M,
+                                                                     nnz,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     info,
+                                                                     &size));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                                  trans,
+                                                                  M,
+                                                                  nnz,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  info,
+                                                                  apol,
+                                                                  spol,
+                                                                  dbuffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                               trans,
+                                                               M,
+                                                               nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               info,
+                                                               dx,
+                                                               dy_1,
+                                                               spol,
+                                                               dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+            },
+            "clear",
+            [&]() { CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info)); });
+
+        double gpu_solve_time_used = timer.total() / number_hot_calls;
 
         double gpu_gflops = csrsv_gflop_count<T>(M, nnz, diag) / gpu_solve_time_used * 1e6;
         double gpu_gbyte  = csrsv_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6;
@@ -793,7 +919,7 @@ void testing_csrsv(const Arguments& arg)
                   << "analysis_policy" << std::setw(16) << "solve_policy" << std::setw(12)
                   << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "analysis_msec"
                   << std::setw(16) << "solve_msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << h_alpha
                   << std::setw(12) << std::min(h_analysis_pivot_gold[0], h_solve_pivot_gold[0])
@@ -804,7 +930,8 @@ void testing_csrsv(const Arguments& arg)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
                   << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Clear csrsv meta data
@@ -427,37 +427,65 @@ void testing_ell2csr(const Arguments& arg)
                                                        dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
+        device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+        device_vector<T>             dcsr_val(csr_nnz);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
+        if(!dcsr_col_ind || !dcsr_val)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_ell2csr_nnz(
-                handle, M, N, descrA, ell_width, dell_col_ind, descrB, dcsr_row_ptr, &csr_nnz));
-
-            device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
-            device_vector<T>             dcsr_val(csr_nnz);
-
-            if(!dcsr_col_ind || !dcsr_val)
-            {
-                CHECK_HIP_ERROR(hipErrorOutOfMemory);
-                return;
-            }
-
-            CHECK_ROCSPARSE_ERROR(rocsparse_ell2csr<T>(handle,
-                                                       M,
-                                                       N,
-                                                       descrA,
-                                                       ell_width,
-                                                       dell_val,
-                                                       dell_col_ind,
-                                                       descrB,
-                                                       dcsr_val,
-                                                       dcsr_row_ptr,
-                                                       dcsr_col_ind));
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        hcsr_row_ptr.resize(M + 1);
+        hcsr_col_ind.resize(csr_nnz);
+        hcsr_val.resize(csr_nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dell_col_ind,
+                                          hell_col_ind,
+                                          sizeof(rocsparse_int) * ell_nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dell_val, hell_val, sizeof(T) * ell_nnz, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_ell2csr_nnz(
+                    handle, M, N, descrA, ell_width, dell_col_ind, descrB, dcsr_row_ptr, &csr_nnz));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_ell2csr<T>(handle,
+                                                           M,
+                                                           N,
+                                                           descrA,
+                                                           ell_width,
+                                                           dell_val,
+                                                           dell_col_ind,
+                                                           descrB,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind,
+                                          dcsr_col_ind,
+                                          sizeof(rocsparse_int) * csr_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = ell2csr_gbyte_count<T>(M, csr_nnz, ell_nnz) / gpu_time_used * 1e6;
 
@@ -467,12 +495,13 @@ void testing_ell2csr(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "CSR nnz"
                   << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << csr_nnz
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 }
 
@@ -482,28 +482,54 @@ void testing_gebsr2csr(const Arguments& arg)
                                                          dcsr_col_ind));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2csr<T>(handle,
-                                                         direction,
-                                                         Mb,
-                                                         Nb,
-                                                         bsr_descr,
-                                                         dbsr_val,
-                                                         dbsr_row_ptr,
-                                                         dbsr_col_ind,
-                                                         row_block_dim,
-                                                         col_block_dim,
-                                                         csr_descr,
-                                                         dcsr_val,
-                                                         dcsr_row_ptr,
-                                                         dcsr_col_ind));
-        }
+        host_vector<T>             hcsr_val(nnz);
+        host_vector<rocsparse_int> hcsr_ind(nnz);
+        host_vector<rocsparse_int> hcsr_ptr(M + 1);
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr,
+                                          hbsr_row_ptr,
+                                          sizeof(rocsparse_int) * (Mb + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_col_ind,
+                                          hbsr_col_ind,
+                                          sizeof(rocsparse_int) * nnzb,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dbsr_val, hbsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2csr<T>(handle,
+                                                             direction,
+                                                             Mb,
+                                                             Nb,
+                                                             bsr_descr,
+                                                             dbsr_val,
+                                                             dbsr_row_ptr,
+                                                             dbsr_col_ind,
+                                                             row_block_dim,
+                                                             col_block_dim,
+                                                             csr_descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    hcsr_ind, dcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            });
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = gebsr2csr_gbyte_count<T>(Mb, row_block_dim, col_block_dim, nnzb)
                            / gpu_time_used * 1e6;
@@ -516,13 +542,14 @@ void testing_gebsr2csr(const Arguments& arg)
                   << std::setw(12) << "Nb" << std::setw(12) << "row_blockdim" << std::setw(12)
                   << "col_blockdim" << std::setw(12) << "nnzb" << std::setw(12) << "GB/s"
                   << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
                   << std::setw(12) << Nb << std::setw(12) << row_block_dim << std::setw(12)
                   << col_block_dim << std::setw(12) << nnzb << std::setw(12) << gpu_gbyte
                   << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 }
 
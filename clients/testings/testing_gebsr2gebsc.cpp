@@ -646,29 +646,49 @@ void testing_gebsr2gebsc(const Arguments& arg)
                                                            dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsc<T>(handle,
-                                                           dbsr.mb,
-                                                           dbsr.nb,
-                                                           dbsr.nnzb,
-                                                           dbsr.val,
-                                                           dbsr.ptr,
-                                                           dbsr.ind,
-                                                           dbsr.row_block_dim,
-                                                           dbsr.col_block_dim,
-                                                           dbsc.val,
-                                                           dbsc.ind,
-                                                           dbsc.ptr,
-                                                           action,
-                                                           dbsr.base,
-                                                           dbuffer));
-        }
-
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        host_gebsc_matrix<T> hbsc(dbsc, false);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() { dbsr.transfer_from(hbsr); },
+            "buffer_size",
+            [&]() {
+                size_t size;
+                CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsc_buffer_size<T>(handle,
+                                                                           dbsr.mb,
+                                                                           dbsr.nb,
+                                                                           dbsr.nnzb,
+                                                                           dbsr.val,
+                                                                           dbsr.ptr,
+                                                                           dbsr.ind,
+                                                                           dbsr.row_block_dim,
+                                                                           dbsr.col_block_dim,
+                                                                           &size));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsc<T>(handle,
+                                                               dbsr.mb,
+                                                               dbsr.nb,
+                                                               dbsr.nnzb,
+                                                               dbsr.val,
+                                                               dbsr.ptr,
+                                                               dbsr.ind,
+                                                               dbsr.row_block_dim,
+                                                               dbsr.col_block_dim,
+                                                               dbsc.val,
+                                                               dbsc.ind,
+                                                               dbsc.ptr,
+                                                               action,
+                                                               dbsr.base,
+                                                               dbuffer));
+            },
+            [&]() { hbsc.transfer_from(dbsc); },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte
             = gebsr2gebsc_gbyte_count<T>(
@@ -682,14 +702,15 @@ void testing_gebsr2gebsc(const Arguments& arg)
         std::cout << std::setw(12) << "Mb" << std::setw(12) << "Nb" << std::setw(12) << "nnzb"
                   << std::setw(12) << "rbdim" << std::setw(12) << "cbdim" << std::setw(12)
                   << "action" << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
-                  << "iter" << std::setw(12) << "verified" << std::endl;
+                  << "iter" << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << dbsr.mb << std::setw(12) << dbsr.nb << std::setw(12)
                   << dbsr.nnzb << std::setw(12) << dbsr.row_block_dim << std::setw(12)
                   << dbsr.col_block_dim << std::setw(12) << rocsparse_action2string(action)
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
     // Free buffer
     CHECK_HIP_ERROR(hipFree(dbuffer));
@@ -915,6 +915,8 @@ void testing_gebsr2gebsr(const Arguments& arg)
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
 
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
         {
@@ -938,32 +940,86 @@ void testing_gebsr2gebsr(const Arguments& arg)
                                                            dtemp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr<T>(handle,
-                                                           direction,
-                                                           Mb,
-                                                           Nb,
-                                                           hnnzb_A,
-                                                           descr_A,
-                                                           dbsr_val_A,
-                                                           dbsr_row_ptr_A,
-                                                           dbsr_col_ind_A,
-                                                           row_block_dim_A,
-                                                           col_block_dim_A,
-                                                           descr_C,
-                                                           dbsr_val_C,
-                                                           dbsr_row_ptr_C,
-                                                           dbsr_col_ind_C,
-                                                           row_block_dim_C,
-                                                           col_block_dim_C,
-                                                           dtemp_buffer));
-        }
+        host_vector<rocsparse_int> hbsr_row_ptr_C(Mb_C + 1);
+        host_vector<rocsparse_int> hbsr_col_ind_C(hnnzb_C[0]);
+        host_vector<T>             hbsr_val_C(hnnzb_C[0] * row_block_dim_C * col_block_dim_C);
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_row_ptr_A,
+                                          hbsr_row_ptr_A.data(),
+                                          sizeof(rocsparse_int) * (Mb + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_col_ind_A,
+                                          hbsr_col_ind_A.data(),
+                                          sizeof(rocsparse_int) * hnnzb_A,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dbsr_val_A,
+                                          hbsr_val_A.data(),
+                                          sizeof(T) * hnnzb_A * row_block_dim_A * col_block_dim_A,
+                                          hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr_nnz(handle,
+                                                                direction,
+                                                                Mb,
+                                                                Nb,
+                                                                hnnzb_A,
+                                                                descr_A,
+                                                                dbsr_row_ptr_A,
+                                                                dbsr_col_ind_A,
+                                                                row_block_dim_A,
+                                                                col_block_dim_A,
+                                                                descr_C,
+                                                                dbsr_row_ptr_C,
+                                                                row_block_dim_C,
+                                                                col_block_dim_C,
+                                                                hnnzb_C,
+                                                                dtemp_buffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr<T>(handle,
+                                                               direction,
+                                                               Mb,
+                                                               Nb,
+                                                               hnnzb_A,
+                                                               descr_A,
+                                                               dbsr_val_A,
+                                                               dbsr_row_ptr_A,
+                                                               dbsr_col_ind_A,
+                                                               row_block_dim_A,
+                                                               col_block_dim_A,
+                                                               descr_C,
+                                                               dbsr_val_C,
+                                                               dbsr_row_ptr_C,
+                                                               dbsr_col_ind_C,
+                                                               row_block_dim_C,
+                                                               col_block_dim_C,
+                                                               dtemp_buffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr_C,
+                                          dbsr_row_ptr_C,
+                                          sizeof(rocsparse_int) * (Mb_C + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind_C,
+                                          dbsr_col_ind_C,
+                                          sizeof(rocsparse_int) * hnnzb_C[0],
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hbsr_val_C,
+                              dbsr_val_C,
+                              sizeof(T) * hnnzb_C[0] * row_block_dim_C * col_block_dim_C,
+                              hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = gebsr2gebsr_gbyte_count<T>(Mb,
                                                       Mb_C,
@@ -983,14 +1039,16 @@ void testing_gebsr2gebsr(const Arguments& arg)
                   << std::setw(12) << "Nb" << std::setw(12) << "rblockdimA" << std::setw(12)
                   << "cblockdimA" << std::setw(12) << "rblockdimC" << std::setw(12) << "cblockdimC"
                   << std::setw(12) << "nnzbC" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
-                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << Mb
                   << std::setw(12) << Nb << std::setw(12) << row_block_dim_A << std::setw(12)
                   << col_block_dim_A << std::setw(12) << row_block_dim_C << std::setw(12)
                   << col_block_dim_C << std::setw(12) << hnnzb_C[0] << std::setw(12) << gpu_gbyte
                   << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
-                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << timer.phases(number_hot_calls) << std::endl;
 
         // Free buffer
         CHECK_HIP_ERROR(hipFree(dtemp_buffer));
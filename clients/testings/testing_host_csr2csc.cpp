@@ -0,0 +1,124 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+template <typename T>
+void testing_host_csr2csc(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_int        nnz  = arg.nnz;
+    rocsparse_index_base base = arg.baseA;
+
+    // Sample random CSR matrix
+    std::vector<rocsparse_int> coo_row_ind;
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+
+    rocsparse_seedrand();
+    rocsparse_init_coo_matrix(coo_row_ind, csr_col_ind, csr_val, M, N, nnz, base);
+    host_coo_to_csr(M, nnz, coo_row_ind, csr_row_ptr, base);
+
+    // Serial reference transposition
+    std::vector<rocsparse_int> csc_col_ptr_gold(N + 1, 0);
+    std::vector<rocsparse_int> csc_row_ind_gold(nnz);
+    std::vector<T>             csc_val_gold(nnz);
+    std::vector<rocsparse_int> csc_map_gold(nnz);
+
+    for(rocsparse_int j = 0; j < nnz; ++j)
+    {
+        ++csc_col_ptr_gold[csr_col_ind[j] - base + 1];
+    }
+
+    for(rocsparse_int c = 0; c < N; ++c)
+    {
+        csc_col_ptr_gold[c + 1] += csc_col_ptr_gold[c];
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int idx = csc_col_ptr_gold[csr_col_ind[j] - base]++;
+
+            csc_row_ind_gold[idx] = i + base;
+            csc_val_gold[idx]     = csr_val[j];
+            csc_map_gold[j]       = idx;
+        }
+    }
+
+    for(rocsparse_int c = N; c > 0; --c)
+    {
+        csc_col_ptr_gold[c] = csc_col_ptr_gold[c - 1] + base;
+    }
+
+    csc_col_ptr_gold[0] = base;
+
+    // Use at least four threads, such that rows are split among several threads even on
+    // small machines
+#ifdef _OPENMP
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(std::max(4, max_threads));
+#endif
+
+    // Parallel transposition, with column blocks if N exceeds the histogram size
+    std::vector<rocsparse_int> csc_col_ptr;
+    std::vector<rocsparse_int> csc_row_ind;
+    std::vector<T>             csc_val;
+    std::vector<rocsparse_int> csc_map;
+
+    host_csr_to_csc(M,
+                    N,
+                    nnz,
+                    csr_row_ptr,
+                    csr_col_ind,
+                    csr_val,
+                    csc_row_ind,
+                    csc_col_ptr,
+                    csc_val,
+                    rocsparse_action_numeric,
+                    base);
+    host_csr_to_csc_map(M, N, nnz, csr_row_ptr, csr_col_ind, csc_map, base);
+
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    ASSERT_EQ(csc_col_ptr, csc_col_ptr_gold);
+    ASSERT_EQ(csc_row_ind, csc_row_ind_gold);
+    ASSERT_EQ(csc_val, csc_val_gold);
+    ASSERT_EQ(csc_map, csc_map_gold);
+}
+
+#define INSTANTIATE(TYPE) template void testing_host_csr2csc<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -241,23 +241,90 @@ void testing_hyb2csr(const Arguments& arg)
                 handle, descr, hyb, dcsr_val, dcsr_row_ptr, dcsr_col_ind, dbuffer));
         }
 
-        double gpu_time_used = get_time_us();
+        // Access the HYB storage
+        rocsparse_hyb_mat ptr  = hyb;
+        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
 
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_hyb2csr<T>(
-                handle, descr, hyb, dcsr_val, dcsr_row_ptr, dcsr_col_ind, dbuffer));
-        }
+        rocsparse_int ell_nnz = dhyb->ell_nnz;
+        rocsparse_int coo_nnz = dhyb->coo_nnz;
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        // Host copies of the HYB input and the CSR output for the transfer phases
+        host_vector<rocsparse_int> hell_col_ind(ell_nnz);
+        host_vector<T>             hell_val(ell_nnz);
+        host_vector<rocsparse_int> hcoo_row_ind(coo_nnz);
+        host_vector<rocsparse_int> hcoo_col_ind(coo_nnz);
+        host_vector<T>             hcoo_val(coo_nnz);
+        host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind(nnz);
+        host_vector<T>             hcsr_val(nnz);
 
-        // Initialize pseudo HYB matrix
-        rocsparse_hyb_mat ptr  = hyb;
-        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
+        CHECK_HIP_ERROR(hipMemcpy(hell_col_ind,
+                                  dhyb->ell_col_ind,
+                                  sizeof(rocsparse_int) * ell_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hell_val, dhyb->ell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcoo_row_ind,
+                                  dhyb->coo_row_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcoo_col_ind,
+                                  dhyb->coo_col_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcoo_val, dhyb->coo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dhyb->ell_col_ind,
+                                          hell_col_ind,
+                                          sizeof(rocsparse_int) * ell_nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dhyb->ell_val, hell_val, sizeof(T) * ell_nnz, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dhyb->coo_row_ind,
+                                          hcoo_row_ind,
+                                          sizeof(rocsparse_int) * coo_nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dhyb->coo_col_ind,
+                                          hcoo_col_ind,
+                                          sizeof(rocsparse_int) * coo_nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dhyb->coo_val, hcoo_val, sizeof(T) * coo_nnz, hipMemcpyHostToDevice));
+            },
+            "buffer_size",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_hyb2csr_buffer_size(handle, descr, hyb, dcsr_row_ptr, &buffer_size));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_hyb2csr<T>(
+                    handle, descr, hyb, dcsr_val, dcsr_row_ptr, dcsr_col_ind, dbuffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind,
+                                          dcsr_col_ind,
+                                          sizeof(rocsparse_int) * nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte
-            = hyb2csr_gbyte_count<T>(M, nnz, dhyb->ell_nnz, dhyb->coo_nnz) / gpu_time_used * 1e6;
+            = hyb2csr_gbyte_count<T>(M, nnz, ell_nnz, coo_nnz) / gpu_time_used * 1e6;
 
         std::cout.precision(2);
         std::cout.setf(std::ios::fixed);
@@ -265,12 +332,13 @@ void testing_hyb2csr(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
-                  << std::setw(12) << "verified" << std::endl;
+                  << std::setw(12) << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     // Free buffer
@@ -0,0 +1,129 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_laplace(const Arguments& arg)
+{
+    rocsparse_int        dimx = arg.dimx;
+    rocsparse_int        dimy = arg.dimy;
+    rocsparse_int        dimz = arg.dimz;
+    rocsparse_index_base base = arg.baseA;
+
+    bool is_3d = (arg.matrix == rocsparse_matrix_laplace_3d);
+
+    // Number of stencil points, including the default stencils
+    rocsparse_int points = arg.stencil;
+
+    if(points == 0)
+    {
+        points = is_3d ? 27 : 9;
+    }
+
+    // Generate matrix
+    std::vector<rocsparse_int> csr_row_ptr;
+    std::vector<rocsparse_int> csr_col_ind;
+    std::vector<T>             csr_val;
+
+    rocsparse_int M;
+    rocsparse_int N;
+    rocsparse_int nnz;
+
+    if(is_3d)
+    {
+        rocsparse_init_csr_laplace3d(
+            csr_row_ptr, csr_col_ind, csr_val, dimx, dimy, dimz, M, N, nnz, base, arg.stencil);
+    }
+    else
+    {
+        dimz = 1;
+
+        rocsparse_init_csr_laplace2d(
+            csr_row_ptr, csr_col_ind, csr_val, dimx, dimy, M, N, nnz, base, arg.stencil);
+    }
+
+    ASSERT_EQ(M, dimx * dimy * dimz);
+    ASSERT_EQ(N, M);
+    ASSERT_EQ(csr_row_ptr[0], base);
+    ASSERT_EQ(csr_row_ptr[M] - base, nnz);
+
+    // Every row of the laplacian has a diagonal of points - 1, off-diagonal entries of -1 and
+    // sorted column indices
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        ASSERT_LE(row_end - row_begin, points);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            ASSERT_TRUE(col >= 0 && col < N);
+            ASSERT_TRUE(j == row_begin || csr_col_ind[j - 1] < csr_col_ind[j]);
+            ASSERT_EQ(csr_val[j], (col == i) ? static_cast<T>(points - 1) : static_cast<T>(-1));
+        }
+    }
+
+    // The interior row at the centre of the grid holds all stencil points and sums up to zero,
+    // given that the grid extends at least two points in each direction
+    rocsparse_int cx = dimx / 2;
+    rocsparse_int cy = dimy / 2;
+    rocsparse_int cz = dimz / 2;
+
+    if(dimx < 5 || dimy < 5 || (is_3d && dimz < 5))
+    {
+        return;
+    }
+
+    rocsparse_int row       = (cz * dimy + cy) * dimx + cx;
+    rocsparse_int row_begin = csr_row_ptr[row] - base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+
+    ASSERT_EQ(row_end - row_begin, points);
+
+    T sum  = static_cast<T>(0);
+    T diag = static_cast<T>(0);
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        sum += csr_val[j];
+
+        if(csr_col_ind[j] - base == row)
+        {
+            diag = csr_val[j];
+        }
+    }
+
+    EXPECT_EQ(diag, static_cast<T>(points - 1));
+    EXPECT_EQ(sum, static_cast<T>(0));
+}
+
+#define INSTANTIATE(TYPE) template void testing_laplace<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
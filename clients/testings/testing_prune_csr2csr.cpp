@@ -640,6 +640,11 @@ void testing_prune_csr2csr(const Arguments& arg)
                                                          d_temp_buffer));
 
     CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+    // With device pointers, no host synchronization is allowed
+    rocsparse_sync_probe probe(handle);
+    CHECK_HIP_ERROR(probe.block());
+
     CHECK_ROCSPARSE_ERROR(rocsparse_prune_csr2csr_nnz<T>(handle,
                                                          M,
                                                          N,
@@ -654,6 +659,8 @@ void testing_prune_csr2csr(const Arguments& arg)
                                                          d_nnz_total_dev_host_ptr,
                                                          d_temp_buffer));
 
+    bool synchronized = probe.release();
+
     device_vector<rocsparse_int> d_csr_col_ind_C(h_nnz_total_dev_host_ptr[0]);
     device_vector<T>             d_csr_val_C(h_nnz_total_dev_host_ptr[0]);
 
@@ -665,6 +672,8 @@ void testing_prune_csr2csr(const Arguments& arg)
 
     if(arg.unit_check)
     {
+        ASSERT_EQ(synchronized, false);
+
         host_vector<rocsparse_int> h_nnz_total_copied_from_device(1);
         CHECK_HIP_ERROR(hipMemcpy(h_nnz_total_copied_from_device,
                                   d_nnz_total_dev_host_ptr,
@@ -762,28 +771,76 @@ void testing_prune_csr2csr(const Arguments& arg)
                                                              d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_prune_csr2csr<T>(handle,
-                                                             M,
-                                                             N,
-                                                             nnz_A,
-                                                             csr_descr_A,
-                                                             d_csr_val_A,
-                                                             d_csr_row_ptr_A,
-                                                             d_csr_col_ind_A,
-                                                             &threshold,
-                                                             csr_descr_C,
-                                                             d_csr_val_C,
-                                                             d_csr_row_ptr_C,
-                                                             d_csr_col_ind_C,
-                                                             d_temp_buffer));
-        }
+        host_vector<rocsparse_int> h_csr_row_ptr_C(M + 1);
+        host_vector<rocsparse_int> h_csr_col_ind_C(h_nnz_total_dev_host_ptr[0]);
+        host_vector<T>             h_csr_val_C(h_nnz_total_dev_host_ptr[0]);
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(d_csr_row_ptr_A,
+                                          h_csr_row_ptr_A,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(d_csr_col_ind_A,
+                                          h_csr_col_ind_A,
+                                          sizeof(rocsparse_int) * nnz_A,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(d_csr_val_A, h_csr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_prune_csr2csr_nnz<T>(handle,
+                                                                     M,
+                                                                     N,
+                                                                     nnz_A,
+                                                                     csr_descr_A,
+                                                                     d_csr_val_A,
+                                                                     d_csr_row_ptr_A,
+                                                                     d_csr_col_ind_A,
+                                                                     &threshold,
+                                                                     csr_descr_C,
+                                                                     d_csr_row_ptr_C,
+                                                                     h_nnz_total_dev_host_ptr,
+                                                                     d_temp_buffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_prune_csr2csr<T>(handle,
+                                                                 M,
+                                                                 N,
+                                                                 nnz_A,
+                                                                 csr_descr_A,
+                                                                 d_csr_val_A,
+                                                                 d_csr_row_ptr_A,
+                                                                 d_csr_col_ind_A,
+                                                                 &threshold,
+                                                                 csr_descr_C,
+                                                                 d_csr_val_C,
+                                                                 d_csr_row_ptr_C,
+                                                                 d_csr_col_ind_C,
+                                                                 d_temp_buffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_row_ptr_C,
+                                          d_csr_row_ptr_C,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_col_ind_C,
+                                          d_csr_col_ind_C,
+                                          sizeof(rocsparse_int) * h_nnz_total_dev_host_ptr[0],
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_val_C,
+                                          d_csr_val_C,
+                                          sizeof(T) * h_nnz_total_dev_host_ptr[0],
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte = prune_csr2csr_gbyte_count<T>(M, nnz_A, h_nnz_total_dev_host_ptr[0])
                            / gpu_time_used * 1e6;
@@ -795,13 +852,14 @@ void testing_prune_csr2csr(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz_A"
                   << std::setw(12) << "nnz_C" << std::setw(12) << "threshold" << std::setw(12)
                   << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "verified" << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz_A
                   << std::setw(12) << h_nnz_total_dev_host_ptr[0] << std::setw(12) << threshold
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
     }
 
     CHECK_HIP_ERROR(hipFree(d_temp_buffer));
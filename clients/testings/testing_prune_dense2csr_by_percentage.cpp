@@ -514,6 +514,11 @@ void testing_prune_dense2csr_by_percentage(const Arguments& arg)
                                                                          d_temp_buffer));
 
     CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+    // With device pointers, no host synchronization is allowed
+    rocsparse_sync_probe probe(handle);
+    CHECK_HIP_ERROR(probe.block());
+
     CHECK_ROCSPARSE_ERROR(rocsparse_prune_dense2csr_nnz_by_percentage<T>(handle,
                                                                          M,
                                                                          N,
@@ -526,6 +531,8 @@ void testing_prune_dense2csr_by_percentage(const Arguments& arg)
                                                                          info,
                                                                          d_temp_buffer));
 
+    bool synchronized = probe.release();
+
     device_vector<rocsparse_int> d_csr_col_ind(h_nnz_total_dev_host_ptr[0]);
     device_vector<T>             d_csr_val(h_nnz_total_dev_host_ptr[0]);
 
@@ -537,6 +544,8 @@ void testing_prune_dense2csr_by_percentage(const Arguments& arg)
 
     if(arg.unit_check)
     {
+        ASSERT_EQ(synchronized, false);
+
         host_vector<rocsparse_int> h_nnz_total_copied_from_device(1);
         CHECK_HIP_ERROR(hipMemcpy(h_nnz_total_copied_from_device,
                                   d_nnz_total_dev_host_ptr,
@@ -622,26 +631,64 @@ void testing_prune_dense2csr_by_percentage(const Arguments& arg)
                                                                              d_temp_buffer));
         }
 
-        double gpu_time_used = get_time_us();
-
-        // Performance run
-        for(int iter = 0; iter < number_hot_calls; ++iter)
-        {
-            CHECK_ROCSPARSE_ERROR(rocsparse_prune_dense2csr_by_percentage<T>(handle,
-                                                                             M,
-                                                                             N,
-                                                                             d_A,
-                                                                             LDA,
-                                                                             percentage,
-                                                                             descr,
-                                                                             d_csr_val,
-                                                                             d_csr_row_ptr,
-                                                                             d_csr_col_ind,
-                                                                             info,
-                                                                             d_temp_buffer));
-        }
+        host_vector<rocsparse_int> h_csr_row_ptr(M + 1);
+        host_vector<rocsparse_int> h_csr_col_ind(h_nnz_total_dev_host_ptr[0]);
+        host_vector<T>             h_csr_val(h_nnz_total_dev_host_ptr[0]);
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(d_A, h_A, sizeof(T) * LDA * N, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_prune_dense2csr_nnz_by_percentage<T>(handle,
+                                                                   M,
+                                                                   N,
+                                                                   d_A,
+                                                                   LDA,
+                                                                   percentage,
+                                                                   descr,
+                                                                   d_csr_row_ptr,
+                                                                   h_nnz_total_dev_host_ptr,
+                                                                   info,
+                                                                   d_temp_buffer));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_prune_dense2csr_by_percentage<T>(handle,
+                                                                                 M,
+                                                                                 N,
+                                                                                 d_A,
+                                                                                 LDA,
+                                                                                 percentage,
+                                                                                 descr,
+                                                                                 d_csr_val,
+                                                                                 d_csr_row_ptr,
+                                                                                 d_csr_col_ind,
+                                                                                 info,
+                                                                                 d_temp_buffer));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_row_ptr,
+                                          d_csr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_col_ind,
+                                          d_csr_col_ind,
+                                          sizeof(rocsparse_int) * h_nnz_total_dev_host_ptr[0],
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(h_csr_val,
+                                          d_csr_val,
+                                          sizeof(T) * h_nnz_total_dev_host_ptr[0],
+                                          hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
 
         double gpu_gbyte
             = prune_dense2csr_by_percentage_gbyte_count<T>(M, N, h_nnz_total_dev_host_ptr[0])
@@ -653,13 +700,14 @@ void testing_prune_dense2csr_by_percentage(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "percentage" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << timer.header() << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12)
                   << h_nnz_total_dev_host_ptr[0] << std::setw(12) << percentage << std::setw(12)
                   << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
                   << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
-                  << std::endl;
+                  << timer.phases(number_hot_calls) << std::endl;
     }
 
     CHECK_HIP_ERROR(hipFree(d_temp_buffer));
@@ -0,0 +1,115 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cstring>
+
+// Reseed and run a matrix generator with a given number of OpenMP threads
+template <typename F>
+static void random_init_with_threads(int nthreads, F&& init)
+{
+#ifdef _OPENMP
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(nthreads);
+#endif
+
+    rocsparse_seedrand();
+    init();
+
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+}
+
+template <typename T>
+void testing_random_init(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_int        nnz  = arg.nnz;
+    rocsparse_index_base base = arg.baseA;
+
+    // Use at least four threads, such that the rows are split among several threads even on
+    // small machines
+    int nthreads = 4;
+
+#ifdef _OPENMP
+    nthreads = std::max(nthreads, omp_get_max_threads());
+#endif
+
+    // COO matrix with given number of non-zeros, with and without full rank
+    for(int full_rank = 0; full_rank < 2; ++full_rank)
+    {
+        std::vector<rocsparse_int> row_ind_1, row_ind_n;
+        std::vector<rocsparse_int> col_ind_1, col_ind_n;
+        std::vector<T>             val_1, val_n;
+
+        random_init_with_threads(1, [&] {
+            rocsparse_init_coo_matrix(row_ind_1, col_ind_1, val_1, M, N, nnz, base, full_rank);
+        });
+        random_init_with_threads(nthreads, [&] {
+            rocsparse_init_coo_matrix(row_ind_n, col_ind_n, val_n, M, N, nnz, base, full_rank);
+        });
+
+        ASSERT_EQ(row_ind_1.size(), static_cast<size_t>(nnz));
+        ASSERT_EQ(row_ind_1, row_ind_n);
+        ASSERT_EQ(col_ind_1, col_ind_n);
+        ASSERT_EQ(val_1.size(), val_n.size());
+        ASSERT_EQ(std::memcmp(val_1.data(), val_n.data(), sizeof(T) * val_1.size()), 0);
+    }
+
+    // CSR matrix with the non-zeros computed by the generator
+    {
+        std::vector<rocsparse_int> row_ptr_1, row_ptr_n;
+        std::vector<rocsparse_int> col_ind_1, col_ind_n;
+        std::vector<T>             val_1, val_n;
+
+        rocsparse_int nnz_1;
+        rocsparse_int nnz_n;
+
+        random_init_with_threads(1, [&] {
+            rocsparse_init_csr_random(row_ptr_1, col_ind_1, val_1, M, N, nnz_1, base);
+        });
+        random_init_with_threads(nthreads, [&] {
+            rocsparse_init_csr_random(row_ptr_n, col_ind_n, val_n, M, N, nnz_n, base);
+        });
+
+        ASSERT_EQ(nnz_1, nnz_n);
+        ASSERT_EQ(row_ptr_1, row_ptr_n);
+        ASSERT_EQ(col_ind_1, col_ind_n);
+        ASSERT_EQ(val_1.size(), val_n.size());
+        ASSERT_EQ(std::memcmp(val_1.data(), val_n.data(), sizeof(T) * val_1.size()), 0);
+    }
+}
+
+#define INSTANTIATE(TYPE) template void testing_random_init<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
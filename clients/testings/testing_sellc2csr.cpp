@@ -0,0 +1,692 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_sellc2csr_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size       = 100;
+    static const rocsparse_int safe_slice_size = 4;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for SELL-C-sigma matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+    device_vector<rocsparse_int> dsell_perm(safe_size);
+    device_vector<rocsparse_int> dsell_col_ind(safe_size);
+    device_vector<T>             dsell_val(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+
+    if(!dsell_slice_ptr || !dsell_perm || !dsell_col_ind || !dsell_val || !dcsr_row_ptr
+       || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_sellc2csr_nnz()
+    rocsparse_int csr_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(nullptr,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    nullptr,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    nullptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    nullptr,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    nullptr,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    nullptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    safe_slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descrA,
+                                                    0,
+                                                    dsell_slice_ptr,
+                                                    dsell_col_ind,
+                                                    dsell_perm,
+                                                    descrB,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_sellc2csr()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(nullptr,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   nullptr,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   nullptr,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   nullptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   nullptr,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   nullptr,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   nullptr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   nullptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   safe_slice_size,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   descrA,
+                                                   0,
+                                                   dsell_val,
+                                                   dsell_slice_ptr,
+                                                   dsell_col_ind,
+                                                   dsell_perm,
+                                                   descrB,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_sellc2csr(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M     = arg.M;
+    rocsparse_int               N     = arg.N;
+    rocsparse_int               C     = arg.slice_size;
+    rocsparse_int               sigma = arg.sigma;
+    rocsparse_index_base        baseA = arg.baseA;
+    rocsparse_index_base        baseB = arg.baseB;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for SELL-C-sigma matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+        device_vector<rocsparse_int> dsell_perm(safe_size);
+        device_vector<rocsparse_int> dsell_col_ind(safe_size);
+        device_vector<T>             dsell_val(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+
+        if(!dsell_slice_ptr || !dsell_perm || !dsell_col_ind || !dsell_val || !dcsr_row_ptr
+           || !dcsr_col_ind || !dcsr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_int csr_nnz;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr_nnz(handle,
+                                                        M,
+                                                        N,
+                                                        descrA,
+                                                        C,
+                                                        dsell_slice_ptr,
+                                                        dsell_col_ind,
+                                                        dsell_perm,
+                                                        descrB,
+                                                        dcsr_row_ptr,
+                                                        &csr_nnz),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sellc2csr<T>(handle,
+                                                       M,
+                                                       N,
+                                                       descrA,
+                                                       C,
+                                                       dsell_val,
+                                                       dsell_slice_ptr,
+                                                       dsell_col_ind,
+                                                       dsell_perm,
+                                                       descrB,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+    host_vector<rocsparse_int> hcsr_row_ptr_gold;
+    host_vector<rocsparse_int> hcsr_col_ind_gold;
+    host_vector<T>             hcsr_val_gold;
+
+    // Sample matrix
+    rocsparse_int csr_nnz_gold;
+    matrix_factory.init_csr(
+        hcsr_row_ptr_gold, hcsr_col_ind_gold, hcsr_val_gold, M, N, csr_nnz_gold, baseB);
+
+    // Convert to SELL-C-sigma
+    host_vector<rocsparse_int> hsell_slice_ptr;
+    host_vector<rocsparse_int> hsell_perm;
+    host_vector<rocsparse_int> hsell_col_ind;
+    host_vector<T>             hsell_val;
+    rocsparse_int              sell_nnz;
+
+    host_csr_to_sellc(M,
+                      hcsr_row_ptr_gold,
+                      hcsr_col_ind_gold,
+                      hcsr_val_gold,
+                      C,
+                      sigma,
+                      hsell_slice_ptr,
+                      hsell_perm,
+                      hsell_col_ind,
+                      hsell_val,
+                      sell_nnz,
+                      baseB,
+                      baseA);
+
+    hcsr_row_ptr_gold.clear();
+    hcsr_col_ind_gold.clear();
+    hcsr_val_gold.clear();
+
+    rocsparse_int nslices = (M - 1) / C + 1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dsell_slice_ptr(nslices + 1);
+    device_vector<rocsparse_int> dsell_perm(M);
+    device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+    device_vector<T>             dsell_val(sell_nnz);
+
+    if(!dcsr_row_ptr || !dsell_slice_ptr || !dsell_perm || !dsell_col_ind || !dsell_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dsell_slice_ptr,
+                              hsell_slice_ptr,
+                              sizeof(rocsparse_int) * (nslices + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dsell_perm, hsell_perm, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dsell_col_ind, hsell_col_ind, sizeof(rocsparse_int) * sell_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dsell_val, hsell_val, sizeof(T) * sell_nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Obtain CSR nnz
+        rocsparse_int csr_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      descrA,
+                                                      C,
+                                                      dsell_slice_ptr,
+                                                      dsell_col_ind,
+                                                      dsell_perm,
+                                                      descrB,
+                                                      dcsr_row_ptr,
+                                                      &csr_nnz));
+
+        // Allocate device memory
+        device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+        device_vector<T>             dcsr_val(csr_nnz);
+
+        if(!dcsr_col_ind || !dcsr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform CSR conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr<T>(handle,
+                                                     M,
+                                                     N,
+                                                     descrA,
+                                                     C,
+                                                     dsell_val,
+                                                     dsell_slice_ptr,
+                                                     dsell_col_ind,
+                                                     dsell_perm,
+                                                     descrB,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind));
+
+        // Copy output to host
+        hcsr_row_ptr.resize(M + 1);
+        hcsr_col_ind.resize(csr_nnz);
+        hcsr_val.resize(csr_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr, dcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind, dcsr_col_ind, sizeof(rocsparse_int) * csr_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+
+        // CPU sellc2csr
+        host_sellc_to_csr<T>(M,
+                             N,
+                             C,
+                             hsell_slice_ptr,
+                             hsell_col_ind,
+                             hsell_val,
+                             hsell_perm,
+                             hcsr_row_ptr_gold,
+                             hcsr_col_ind_gold,
+                             hcsr_val_gold,
+                             csr_nnz_gold,
+                             baseA,
+                             baseB);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &csr_nnz_gold, &csr_nnz);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_gold, hcsr_row_ptr);
+        unit_check_general<rocsparse_int>(1, csr_nnz, 1, hcsr_col_ind_gold, hcsr_col_ind);
+        unit_check_general<T>(1, csr_nnz, 1, hcsr_val_gold, hcsr_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int csr_nnz;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          descrA,
+                                                          C,
+                                                          dsell_slice_ptr,
+                                                          dsell_col_ind,
+                                                          dsell_perm,
+                                                          descrB,
+                                                          dcsr_row_ptr,
+                                                          &csr_nnz));
+
+            device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+            device_vector<T>             dcsr_val(csr_nnz);
+
+            if(!dcsr_col_ind || !dcsr_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr<T>(handle,
+                                                         M,
+                                                         N,
+                                                         descrA,
+                                                         C,
+                                                         dsell_val,
+                                                         dsell_slice_ptr,
+                                                         dsell_col_ind,
+                                                         dsell_perm,
+                                                         descrB,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind));
+        }
+
+        device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+        device_vector<T>             dcsr_val(csr_nnz);
+
+        if(!dcsr_col_ind || !dcsr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        hcsr_row_ptr.resize(M + 1);
+        hcsr_col_ind.resize(csr_nnz);
+        hcsr_val.resize(csr_nnz);
+
+        rocsparse_phase_timer timer(arg.timing_mode);
+
+        timer.run(
+            number_hot_calls,
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(dsell_slice_ptr,
+                                          hsell_slice_ptr,
+                                          sizeof(rocsparse_int) * (nslices + 1),
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dsell_perm, hsell_perm, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(hipMemcpy(dsell_col_ind,
+                                          hsell_col_ind,
+                                          sizeof(rocsparse_int) * sell_nnz,
+                                          hipMemcpyHostToDevice));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dsell_val, hsell_val, sizeof(T) * sell_nnz, hipMemcpyHostToDevice));
+            },
+            "nnz",
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr_nnz(handle,
+                                                              M,
+                                                              N,
+                                                              descrA,
+                                                              C,
+                                                              dsell_slice_ptr,
+                                                              dsell_col_ind,
+                                                              dsell_perm,
+                                                              descrB,
+                                                              dcsr_row_ptr,
+                                                              &csr_nnz));
+            },
+            [&]() {
+                CHECK_ROCSPARSE_ERROR(rocsparse_sellc2csr<T>(handle,
+                                                             M,
+                                                             N,
+                                                             descrA,
+                                                             C,
+                                                             dsell_val,
+                                                             dsell_slice_ptr,
+                                                             dsell_col_ind,
+                                                             dsell_perm,
+                                                             descrB,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind));
+            },
+            [&]() {
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr,
+                                          dcsr_row_ptr,
+                                          sizeof(rocsparse_int) * (M + 1),
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind,
+                                          dcsr_col_ind,
+                                          sizeof(rocsparse_int) * csr_nnz,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+            },
+            nullptr,
+            []() {});
+
+        double gpu_time_used = timer.total() / number_hot_calls;
+
+        double gpu_gbyte = sellc2csr_gbyte_count<T>(M, csr_nnz, nslices) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "C"
+                  << std::setw(12) << "sigma" << std::setw(12) << "SELL nnz" << std::setw(12)
+                  << "CSR nnz" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << timer.header()
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << C
+                  << std::setw(12) << sigma << std::setw(12) << sell_nnz << std::setw(12)
+                  << csr_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << timer.phases(number_hot_calls)
+                  << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_sellc2csr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_sellc2csr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
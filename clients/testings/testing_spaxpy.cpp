@@ -0,0 +1,500 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+template <typename T>
+void testing_spaxpy_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+
+    rocsparse_int        nnz_z;
+    size_t               buffer_size;
+    rocsparse_index_base base = rocsparse_index_base_zero;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dx_ind(safe_size);
+    device_vector<T>             dx_val(safe_size);
+    device_vector<rocsparse_int> dy_ind(safe_size);
+    device_vector<T>             dy_val(safe_size);
+    device_vector<rocsparse_int> dz_ind(safe_size);
+    device_vector<T>             dz_val(safe_size);
+    device_vector<rocsparse_int> dbuffer(safe_size);
+
+    if(!dx_ind || !dx_val || !dy_ind || !dy_val || !dz_ind || !dz_val || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_spaxpy_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_buffer_size(nullptr, safe_size, safe_size, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy_buffer_size(handle, -1, safe_size, &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy_buffer_size(handle, safe_size, -1, &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy_buffer_size(handle, safe_size, safe_size, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_spaxpy_nnz()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(nullptr, safe_size, dx_ind, safe_size, dy_ind, &nnz_z, base, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, -1, dx_ind, safe_size, dy_ind, &nnz_z, base, dbuffer),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, safe_size, dx_ind, -1, dy_ind, &nnz_z, base, dbuffer),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, safe_size, nullptr, safe_size, dy_ind, &nnz_z, base, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, safe_size, dx_ind, safe_size, nullptr, &nnz_z, base, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, safe_size, dx_ind, safe_size, dy_ind, nullptr, base, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spaxpy_nnz(handle, safe_size, dx_ind, safe_size, dy_ind, &nnz_z, base, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_spaxpy()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(nullptr,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                -1,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                -1,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                nullptr,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                nullptr,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                nullptr,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                nullptr,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                nullptr,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                nullptr,
+                                                dz_ind,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                nullptr,
+                                                base,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                safe_size,
+                                                &h_alpha,
+                                                dx_val,
+                                                dx_ind,
+                                                safe_size,
+                                                dy_val,
+                                                dy_ind,
+                                                dz_val,
+                                                dz_ind,
+                                                base,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_spaxpy(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        nnz  = arg.nnz;
+    rocsparse_index_base base = arg.baseA;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        rocsparse_int nnz_z;
+        size_t        buffer_size;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dx_ind(safe_size);
+        device_vector<T>             dx_val(safe_size);
+        device_vector<rocsparse_int> dy_ind(safe_size);
+        device_vector<T>             dy_val(safe_size);
+        device_vector<rocsparse_int> dz_ind(safe_size);
+        device_vector<T>             dz_val(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        if(!dx_ind || !dx_val || !dy_ind || !dy_val || !dz_ind || !dz_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_status status
+            = nnz < 0 ? rocsparse_status_invalid_size : rocsparse_status_success;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy_buffer_size(handle, nnz, nnz, &buffer_size),
+                                status);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_spaxpy_nnz(handle, nnz, dx_ind, nnz, dy_ind, &nnz_z, base, dbuffer), status);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spaxpy<T>(handle,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    dx_val,
+                                                    dx_ind,
+                                                    nnz,
+                                                    dy_val,
+                                                    dy_ind,
+                                                    dz_val,
+                                                    dz_ind,
+                                                    base,
+                                                    dbuffer),
+                                status);
+
+        return;
+    }
+
+    // Allocate host memory
+    host_vector<rocsparse_int> hx_ind(nnz);
+    host_vector<T>             hx_val(nnz);
+    host_vector<rocsparse_int> hy_ind(nnz);
+    host_vector<T>             hy_val(nnz);
+    host_vector<rocsparse_int> hz_ind_gold;
+    host_vector<T>             hz_val_gold;
+
+    // Initialize data on CPU, both index sets are sorted but drawn independently
+    rocsparse_seedrand();
+    rocsparse_init_index(hx_ind, nnz, 1, M);
+    rocsparse_init_index(hy_ind, nnz, 1, M);
+    rocsparse_init<T>(hx_val, 1, nnz, 1);
+    rocsparse_init<T>(hy_val, 1, nnz, 1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dx_ind(nnz);
+    device_vector<T>             dx_val(nnz);
+    device_vector<rocsparse_int> dy_ind(nnz);
+    device_vector<T>             dy_val(nnz);
+    device_vector<rocsparse_int> dnnz_z(1);
+    device_vector<T>             d_alpha(1);
+
+    if(!dx_ind || !dx_val || !dy_ind || !dy_val || !dnnz_z || !d_alpha)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_ind, hy_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_val, hy_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spaxpy_buffer_size(handle, nnz, nnz, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Number of non-zero entries of z
+    rocsparse_int hnnz_z;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spaxpy_nnz(handle, nnz, dx_ind, nnz, dy_ind, &hnnz_z, base, dbuffer));
+
+    // Allocate output on device
+    device_vector<rocsparse_int> dz_ind_1(hnnz_z);
+    device_vector<T>             dz_val_1(hnnz_z);
+    device_vector<rocsparse_int> dz_ind_2(hnnz_z);
+    device_vector<T>             dz_val_2(hnnz_z);
+
+    if(!dz_ind_1 || !dz_val_1 || !dz_ind_2 || !dz_val_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_spaxpy<T>(handle,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  dx_val,
+                                                  dx_ind,
+                                                  nnz,
+                                                  dy_val,
+                                                  dy_ind,
+                                                  dz_val_1,
+                                                  dz_ind_1,
+                                                  base,
+                                                  dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_spaxpy_nnz(handle, nnz, dx_ind, nnz, dy_ind, dnnz_z, base, dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spaxpy<T>(handle,
+                                                  nnz,
+                                                  d_alpha,
+                                                  dx_val,
+                                                  dx_ind,
+                                                  nnz,
+                                                  dy_val,
+                                                  dy_ind,
+                                                  dz_val_2,
+                                                  dz_ind_2,
+                                                  base,
+                                                  dbuffer));
+
+        // Copy output to host
+        rocsparse_int hnnz_z_2;
+
+        host_vector<rocsparse_int> hz_ind_1(hnnz_z);
+        host_vector<T>             hz_val_1(hnnz_z);
+        host_vector<rocsparse_int> hz_ind_2(hnnz_z);
+        host_vector<T>             hz_val_2(hnnz_z);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_z_2, dnnz_z, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hz_ind_1, dz_ind_1, sizeof(rocsparse_int) * hnnz_z, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hz_val_1, dz_val_1, sizeof(T) * hnnz_z, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hz_ind_2, dz_ind_2, sizeof(rocsparse_int) * hnnz_z, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hz_val_2, dz_val_2, sizeof(T) * hnnz_z, hipMemcpyDeviceToHost));
+
+        // CPU spaxpy
+        host_spaxpy<T>(
+            nnz, h_alpha, hx_val, hx_ind, nnz, hy_val, hy_ind, hz_val_gold, hz_ind_gold, base);
+
+        rocsparse_int nnz_z_gold = hz_ind_gold.size();
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_z_gold, &hnnz_z);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_z_gold, &hnnz_z_2);
+        unit_check_general<rocsparse_int>(1, nnz_z_gold, 1, hz_ind_gold, hz_ind_1);
+        unit_check_general<rocsparse_int>(1, nnz_z_gold, 1, hz_ind_gold, hz_ind_2);
+        near_check_general<T>(1, nnz_z_gold, 1, hz_val_gold, hz_val_1);
+        near_check_general<T>(1, nnz_z_gold, 1, hz_val_gold, hz_val_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spaxpy<T>(handle,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      dx_val,
+                                                      dx_ind,
+                                                      nnz,
+                                                      dy_val,
+                                                      dy_ind,
+                                                      dz_val_1,
+                                                      dz_ind_1,
+                                                      base,
+                                                      dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spaxpy<T>(handle,
+                                                      nnz,
+                                                      &h_alpha,
+                                                      dx_val,
+                                                      dx_ind,
+                                                      nnz,
+                                                      dy_val,
+                                                      dy_ind,
+                                                      dz_val_1,
+                                                      dz_ind_1,
+                                                      base,
+                                                      dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops = spaxpy_gflop_count<T>(nnz) / gpu_time_used * 1e6;
+        double gpu_gbyte  = spaxpy_gbyte_count<T>(nnz, nnz, hnnz_z) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz_x" << std::setw(12) << "nnz_y"
+                  << std::setw(12) << "nnz_z" << std::setw(16) << "alpha" << std::setw(12)
+                  << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(12) << "usec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz
+                  << std::setw(12) << hnnz_z << std::setw(16) << h_alpha << std::setw(12)
+                  << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_spaxpy_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spaxpy<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
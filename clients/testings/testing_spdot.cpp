@@ -0,0 +1,226 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+template <typename T>
+void testing_spdot_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T result;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dx_ind(safe_size);
+    device_vector<T>             dx_val(safe_size);
+    device_vector<rocsparse_int> dy_ind(safe_size);
+    device_vector<T>             dy_val(safe_size);
+
+    if(!dx_ind || !dx_val || !dy_ind || !dy_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_index_base base = rocsparse_index_base_zero;
+
+    // Test rocsparse_spdot()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            nullptr, safe_size, dx_val, dx_ind, safe_size, dy_val, dy_ind, &result, base),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(handle, -1, dx_val, dx_ind, safe_size, dy_val, dy_ind, &result, base),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(handle, safe_size, dx_val, dx_ind, -1, dy_val, dy_ind, &result, base),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            handle, safe_size, nullptr, dx_ind, safe_size, dy_val, dy_ind, &result, base),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            handle, safe_size, dx_val, nullptr, safe_size, dy_val, dy_ind, &result, base),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            handle, safe_size, dx_val, dx_ind, safe_size, nullptr, dy_ind, &result, base),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            handle, safe_size, dx_val, dx_ind, safe_size, dy_val, nullptr, &result, base),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spdot<T>(
+            handle, safe_size, dx_val, dx_ind, safe_size, dy_val, dy_ind, nullptr, base),
+        rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_spdot(const Arguments& arg)
+{
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        nnz  = arg.nnz;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(nnz <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dx_ind(safe_size);
+        device_vector<T>             dx_val(safe_size);
+        device_vector<rocsparse_int> dy_ind(safe_size);
+        device_vector<T>             dy_val(safe_size);
+
+        if(!dx_ind || !dx_val || !dy_ind || !dy_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        T result;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_spdot<T>(handle, nnz, dx_val, dx_ind, nnz, dy_val, dy_ind, &result, base),
+            nnz < 0 ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory
+    host_vector<rocsparse_int> hx_ind(nnz);
+    host_vector<T>             hx_val(nnz);
+    host_vector<rocsparse_int> hy_ind(nnz);
+    host_vector<T>             hy_val(nnz);
+    host_vector<T>             hdot_1(1);
+    host_vector<T>             hdot_2(1);
+    host_vector<T>             hdot_gold(1);
+
+    // Initialize data on CPU, both index sets are sorted but drawn independently
+    rocsparse_seedrand();
+    rocsparse_init_index(hx_ind, nnz, 1, M);
+    rocsparse_init_index(hy_ind, nnz, 1, M);
+    rocsparse_init_alternating_sign<T>(hx_val, 1, nnz, 1);
+    rocsparse_init<T>(hy_val, 1, nnz, 1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dx_ind(nnz);
+    device_vector<T>             dx_val(nnz);
+    device_vector<rocsparse_int> dy_ind(nnz);
+    device_vector<T>             dy_val(nnz);
+    device_vector<T>             ddot_2(1);
+
+    if(!dx_ind || !dx_val || !dy_ind || !dy_val || !ddot_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_ind, hy_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_val, hy_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spdot<T>(
+            handle, nnz, dx_val, dx_ind, nnz, dy_val, dy_ind, &hdot_1[0], base));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_spdot<T>(handle, nnz, dx_val, dx_ind, nnz, dy_val, dy_ind, ddot_2, base));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hdot_2, ddot_2, sizeof(T), hipMemcpyDeviceToHost));
+
+        // CPU spdot
+        host_spdot<T>(nnz, hx_val, hx_ind, nnz, hy_val, hy_ind, hdot_gold, base);
+
+        unit_check_general<T>(1, 1, 1, hdot_gold, hdot_1);
+        unit_check_general<T>(1, 1, 1, hdot_gold, hdot_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spdot<T>(
+                handle, nnz, dx_val, dx_ind, nnz, dy_val, dy_ind, &hdot_1[0], base));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spdot<T>(
+                handle, nnz, dx_val, dx_ind, nnz, dy_val, dy_ind, &hdot_1[0], base));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops = spdot_gflop_count<T>(nnz) / gpu_time_used * 1e6;
+        double gpu_gbyte  = spdot_gbyte_count<T>(nnz, nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz_x" << std::setw(12) << "nnz_y"
+                  << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(12)
+                  << "usec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz
+                  << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                            \
+    template void testing_spdot_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spdot<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
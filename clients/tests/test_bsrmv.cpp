@@ -87,6 +87,9 @@ namespace
                        << arg.alphai << '_' << arg.beta << '_' << arg.betai << '_'
                        << rocsparse_direction2string(arg.direction) << '_' << arg.block_dim << '_'
                        << rocsparse_operation2string(arg.transA) << '_'
+                       << rocsparse_matrixtype2string(arg.mattype) << '_'
+                       << rocsparse_fillmode2string(arg.uplo) << '_'
+                       << rocsparse_diagtype2string(arg.diag) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix) << '_'
                        << rocsparse_filename2string(arg.filename);
@@ -98,6 +101,9 @@ namespace
                        << arg.N << '_' << arg.alpha << '_' << arg.alphai << '_' << arg.beta << '_'
                        << arg.betai << '_' << rocsparse_direction2string(arg.direction) << '_'
                        << arg.block_dim << '_' << rocsparse_operation2string(arg.transA) << '_'
+                       << rocsparse_matrixtype2string(arg.mattype) << '_'
+                       << rocsparse_fillmode2string(arg.uplo) << '_'
+                       << rocsparse_diagtype2string(arg.diag) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix);
             }
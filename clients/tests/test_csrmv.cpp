@@ -86,6 +86,9 @@ namespace
                        << rocsparse_datatype2string(arg.compute_type) << '_' << arg.alpha << '_'
                        << arg.alphai << '_' << arg.beta << '_' << arg.betai << '_'
                        << rocsparse_operation2string(arg.transA) << '_'
+                       << rocsparse_matrixtype2string(arg.mattype) << '_'
+                       << rocsparse_fillmode2string(arg.uplo) << '_'
+                       << rocsparse_diagtype2string(arg.diag) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix) << '_' << arg.algo << '_'
                        << rocsparse_filename2string(arg.filename);
@@ -96,6 +99,9 @@ namespace
                        << rocsparse_datatype2string(arg.compute_type) << '_' << arg.M << '_'
                        << arg.N << '_' << arg.alpha << '_' << arg.alphai << '_' << arg.beta << '_'
                        << arg.betai << '_' << rocsparse_operation2string(arg.transA) << '_'
+                       << rocsparse_matrixtype2string(arg.mattype) << '_'
+                       << rocsparse_fillmode2string(arg.uplo) << '_'
+                       << rocsparse_diagtype2string(arg.diag) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix) << '_' << arg.algo;
             }
@@ -574,6 +574,355 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
                                  rocsparse_index_base            idx_base);
 /**@}*/
 
+/*! \ingroup level1_module
+*  \brief Compute the dot product of two sparse vectors.
+*
+*  \details
+*  \p rocsparse_spdot computes the dot product of the sparse vector \f$x\f$ with the
+*  sparse vector \f$y\f$, such that
+*  \f[
+*    \text{result} := y^T x
+*  \f]
+*
+*  \code{.c}
+*      for(i = 0; i < nnz_x; ++i)
+*      {
+*          for(j = 0; j < nnz_y; ++j)
+*          {
+*              if(x_ind[i] == y_ind[j])
+*              {
+*                  result += x_val[i] * y_val[j];
+*              }
+*          }
+*      }
+*  \endcode
+*
+*  \note
+*  The indices of \f$y\f$ are expected to be sorted in ascending order and unique.
+*  The indices of \f$x\f$ can be stored in any order.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  nnz_x       number of non-zero entries of vector \f$x\f$.
+*  @param[in]
+*  x_val       array of \p nnz_x values.
+*  @param[in]
+*  x_ind       array of \p nnz_x elements containing the indices of the non-zero
+*              values of \f$x\f$.
+*  @param[in]
+*  nnz_y       number of non-zero entries of vector \f$y\f$.
+*  @param[in]
+*  y_val       array of \p nnz_y values.
+*  @param[in]
+*  y_ind       array of \p nnz_y elements containing the sorted indices of the
+*              non-zero values of \f$y\f$.
+*  @param[out]
+*  result      pointer to the result, can be host or device memory
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+*  \retval rocsparse_status_invalid_size \p nnz_x or \p nnz_y is invalid.
+*  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y_val, \p y_ind
+*          or \p result pointer is invalid.
+*  \retval rocsparse_status_memory_error the buffer for the dot product reduction
+*          could not be allocated.
+*  \retval rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sspdot(rocsparse_handle     handle,
+                                  rocsparse_int        nnz_x,
+                                  const float*         x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        nnz_y,
+                                  const float*         y_val,
+                                  const rocsparse_int* y_ind,
+                                  float*               result,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dspdot(rocsparse_handle     handle,
+                                  rocsparse_int        nnz_x,
+                                  const double*        x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        nnz_y,
+                                  const double*        y_val,
+                                  const rocsparse_int* y_ind,
+                                  double*              result,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cspdot(rocsparse_handle               handle,
+                                  rocsparse_int                  nnz_x,
+                                  const rocsparse_float_complex* x_val,
+                                  const rocsparse_int*           x_ind,
+                                  rocsparse_int                  nnz_y,
+                                  const rocsparse_float_complex* y_val,
+                                  const rocsparse_int*           y_ind,
+                                  rocsparse_float_complex*       result,
+                                  rocsparse_index_base           idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zspdot(rocsparse_handle                handle,
+                                  rocsparse_int                   nnz_x,
+                                  const rocsparse_double_complex* x_val,
+                                  const rocsparse_int*            x_ind,
+                                  rocsparse_int                   nnz_y,
+                                  const rocsparse_double_complex* y_val,
+                                  const rocsparse_int*            y_ind,
+                                  rocsparse_double_complex*       result,
+                                  rocsparse_index_base            idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+*  \brief Sparse vector addition of two sparse vectors
+*
+*  \details
+*  \p rocsparse_spaxpy_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_spaxpy_nnz(), rocsparse_sspaxpy(), rocsparse_dspaxpy(),
+*  rocsparse_cspaxpy() and rocsparse_zspaxpy(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  nnz_x       number of non-zero entries of vector \f$x\f$.
+*  @param[in]
+*  nnz_y       number of non-zero entries of vector \f$y\f$.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_spaxpy_nnz() and rocsparse_Xspaxpy().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p nnz_x or \p nnz_y is invalid.
+*  \retval rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spaxpy_buffer_size(rocsparse_handle handle,
+                                              rocsparse_int    nnz_x,
+                                              rocsparse_int    nnz_y,
+                                              size_t*          buffer_size);
+
+/*! \ingroup level1_module
+*  \brief Sparse vector addition of two sparse vectors
+*
+*  \details
+*  \p rocsparse_spaxpy_nnz computes the number of non-zero entries of the sparse
+*  vector \f$z\f$, that is the union of the sparsity patterns of the sparse vectors
+*  \f$x\f$ and \f$y\f$. The indices of both vectors are expected to be sorted in
+*  ascending order and unique.
+*
+*  \note
+*  As indicated, \p nnz_z can be a host or device pointer.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host,
+*  if \p nnz_z is a device pointer.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  nnz_x       number of non-zero entries of vector \f$x\f$.
+*  @param[in]
+*  x_ind       array of \p nnz_x elements containing the sorted indices of the
+*              non-zero values of \f$x\f$.
+*  @param[in]
+*  nnz_y       number of non-zero entries of vector \f$y\f$.
+*  @param[in]
+*  y_ind       array of \p nnz_y elements containing the sorted indices of the
+*              non-zero values of \f$y\f$.
+*  @param[out]
+*  nnz_z       pointer to the number of non-zero entries of vector \f$z\f$.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_spaxpy_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+*  \retval rocsparse_status_invalid_size \p nnz_x or \p nnz_y is invalid.
+*  \retval rocsparse_status_invalid_pointer \p x_ind, \p y_ind, \p nnz_z or
+*          \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spaxpy_nnz(rocsparse_handle     handle,
+                                      rocsparse_int        nnz_x,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const rocsparse_int* y_ind,
+                                      rocsparse_int*       nnz_z,
+                                      rocsparse_index_base idx_base,
+                                      void*                temp_buffer);
+
+/*! \ingroup level1_module
+*  \brief Sparse vector addition of two sparse vectors
+*
+*  \details
+*  \p rocsparse_spaxpy multiplies the sparse vector \f$x\f$ with scalar \f$\alpha\f$
+*  and adds the result to the sparse vector \f$y\f$, such that
+*
+*  \f[
+*      z := \alpha \cdot x + y
+*  \f]
+*
+*  The sparse vector \f$z\f$ holds the union of the sparsity patterns of \f$x\f$
+*  and \f$y\f$ with its indices sorted in ascending order. The indices of \f$x\f$ and
+*  \f$y\f$ are expected to be sorted in ascending order and unique. The arrays
+*  \p z_val and \p z_ind have to be allocated by the user with the number of
+*  non-zero entries obtained by rocsparse_spaxpy_nnz().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  nnz_x       number of non-zero entries of vector \f$x\f$.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  x_val       array of \p nnz_x values.
+*  @param[in]
+*  x_ind       array of \p nnz_x elements containing the sorted indices of the
+*              non-zero values of \f$x\f$.
+*  @param[in]
+*  nnz_y       number of non-zero entries of vector \f$y\f$.
+*  @param[in]
+*  y_val       array of \p nnz_y values.
+*  @param[in]
+*  y_ind       array of \p nnz_y elements containing the sorted indices of the
+*              non-zero values of \f$y\f$.
+*  @param[out]
+*  z_val       array of \p nnz_z values.
+*  @param[out]
+*  z_ind       array of \p nnz_z elements containing the sorted indices of the
+*              non-zero values of \f$z\f$.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_spaxpy_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+*  \retval rocsparse_status_invalid_size \p nnz_x or \p nnz_y is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p x_val, \p x_ind, \p y_val,
+*          \p y_ind, \p z_val, \p z_ind or \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  \code{.c}
+*      // Obtain the required buffer size
+*      size_t buffer_size;
+*      rocsparse_spaxpy_buffer_size(handle, nnz_x, nnz_y, &buffer_size);
+*
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Obtain the number of non-zero entries of z
+*      rocsparse_int nnz_z;
+*      rocsparse_spaxpy_nnz(handle,
+*                           nnz_x,
+*                           x_ind,
+*                           nnz_y,
+*                           y_ind,
+*                           &nnz_z,
+*                           rocsparse_index_base_zero,
+*                           temp_buffer);
+*
+*      float*         z_val;
+*      rocsparse_int* z_ind;
+*      hipMalloc((void**)&z_val, sizeof(float) * nnz_z);
+*      hipMalloc((void**)&z_ind, sizeof(rocsparse_int) * nnz_z);
+*
+*      // Compute z = alpha * x + y
+*      rocsparse_sspaxpy(handle,
+*                        nnz_x,
+*                        &alpha,
+*                        x_val,
+*                        x_ind,
+*                        nnz_y,
+*                        y_val,
+*                        y_ind,
+*                        z_val,
+*                        z_ind,
+*                        rocsparse_index_base_zero,
+*                        temp_buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sspaxpy(rocsparse_handle     handle,
+                                   rocsparse_int        nnz_x,
+                                   const float*         alpha,
+                                   const float*         x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int        nnz_y,
+                                   const float*         y_val,
+                                   const rocsparse_int* y_ind,
+                                   float*               z_val,
+                                   rocsparse_int*       z_ind,
+                                   rocsparse_index_base idx_base,
+                                   void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dspaxpy(rocsparse_handle     handle,
+                                   rocsparse_int        nnz_x,
+                                   const double*        alpha,
+                                   const double*        x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int        nnz_y,
+                                   const double*        y_val,
+                                   const rocsparse_int* y_ind,
+                                   double*              z_val,
+                                   rocsparse_int*       z_ind,
+                                   rocsparse_index_base idx_base,
+                                   void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cspaxpy(rocsparse_handle               handle,
+                                   rocsparse_int                  nnz_x,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_float_complex* x_val,
+                                   const rocsparse_int*           x_ind,
+                                   rocsparse_int                  nnz_y,
+                                   const rocsparse_float_complex* y_val,
+                                   const rocsparse_int*           y_ind,
+                                   rocsparse_float_complex*       z_val,
+                                   rocsparse_int*                 z_ind,
+                                   rocsparse_index_base           idx_base,
+                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zspaxpy(rocsparse_handle                handle,
+                                   rocsparse_int                   nnz_x,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_double_complex* x_val,
+                                   const rocsparse_int*            x_ind,
+                                   rocsparse_int                   nnz_y,
+                                   const rocsparse_double_complex* y_val,
+                                   const rocsparse_int*            y_ind,
+                                   rocsparse_double_complex*       z_val,
+                                   rocsparse_int*                  z_ind,
+                                   rocsparse_index_base            idx_base,
+                                   void*                           temp_buffer);
+/**@}*/
+
 /*
 * ===========================================================================
 *    level 2 SPARSE
@@ -608,7 +957,16 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  Currently, \p trans != \ref rocsparse_operation_none is only supported for
+*  symmetric, Hermitian and triangular matrices.
+*
+*  \note
+*  For \ref rocsparse_matrix_type_symmetric, \ref rocsparse_matrix_type_hermitian and
+*  \ref rocsparse_matrix_type_triangular, only the triangle of the expanded scalar matrix
+*  that is given by the \ref rocsparse_fill_mode of \p descr and its diagonal are
+*  accessed, and \p mb must be equal to \p nb. If the \ref rocsparse_diag_type is
+*  \ref rocsparse_diag_type_unit, the diagonal is assumed to be one. The transposed
+*  contribution of the stored triangle is added using atomic operations.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -625,8 +983,7 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse BSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  descr       descriptor of the sparse BSR matrix.
 *  @param[in]
 *  bsr_val     array of \p nnzb blocks of the sparse BSR matrix.
 *  @param[in]
@@ -654,8 +1011,8 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
 *              \p bsr_row_ind, \p bsr_col_ind, \p x, \p beta or \p y pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \p trans != \ref rocsparse_operation_none and
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -762,6 +1119,50 @@ rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle,
                                             rocsparse_mat_info info,
                                             rocsparse_int*     position);
 
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrsv_level_info returns the level schedule of the meta data that has
+*  been collected by rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+*  rocsparse_cbsrsv_analysis() or rocsparse_zbsrsv_analysis(). Block rows of the same
+*  level can be processed in parallel, while levels are processed in order. The work of a
+*  block row is one plus the number of its off-diagonal blocks in the triangular part.
+*  The critical path is the largest accumulated work along a chain of dependent block
+*  rows, and the available parallelism is the total work divided by the critical path.
+*  Matrices with a low parallelism might benefit from reordering or coloring prior to the
+*  analysis.
+*
+*  If no meta data is available, all fields of \p level_info are set to zero.
+*
+*  \note \p rocsparse_bsrsv_level_info is a blocking function. The level schedule is
+*  computed on the host from the sparsity pattern the analysis has been performed on,
+*  which has to be left untouched.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type the analysis has been performed for.
+*  @param[in]
+*  descr       descriptor of the sparse BSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  level_info  level schedule of the analysis meta data, in host memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p info or \p level_info
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrsv_level_info(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_level_info*     level_info);
+
 /*! \ingroup level2_module
 *  \brief Sparse triangular solve using BSR storage format
 *
@@ -1440,6 +1841,15 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
 *
 *  \note
+*  For \p trans != \ref rocsparse_operation_none, the transposed sparsity pattern of the
+*  matrix is stored in \p info, such that subsequent calls to rocsparse_scsrmv(),
+*  rocsparse_dcsrmv(), rocsparse_ccsrmv() and rocsparse_zcsrmv() do not require atomic
+*  operations. This requires additional \f$\mathcal{O}(n + 2 \cdot nnz)\f$ integers of
+*  device memory, while the matrix values are accessed in place. The same holds for
+*  symmetric, Hermitian and triangular matrices of any operation type, whose transposed
+*  contribution of the stored triangle is obtained from the transposed sparsity pattern.
+*
+*  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
@@ -1474,9 +1884,6 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *  \retval     rocsparse_status_memory_error the buffer for the gathered information
 *              could not be allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -1585,6 +1992,8 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  or rocsparse_zcsrmv_analysis(). If present, the information will be used to speed up
 *  the \p csrmv computation. If \p info == \p NULL, general \p csrmv routine will be
 *  used instead.
+*  The algorithm can be selected explicitly using rocsparse_scsrmv_ex(),
+*  rocsparse_dcsrmv_ex(), rocsparse_ccsrmv_ex() or rocsparse_zcsrmv_ex().
 *
 *  \code{.c}
 *      for(i = 0; i < m; ++i)
@@ -1603,7 +2012,19 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  For \p trans != \ref rocsparse_operation_none without \p info, the entries of \p y
+*  are accumulated using atomic operations, such that the order of summation, and
+*  thus the rounding of the result, is not deterministic. If \p info has been
+*  obtained for the same operation type, the transposed sparsity pattern gathered
+*  during the analysis is used instead.
+*
+*  \note
+*  For \ref rocsparse_matrix_type_symmetric, \ref rocsparse_matrix_type_hermitian and
+*  \ref rocsparse_matrix_type_triangular, only the triangle given by the
+*  \ref rocsparse_fill_mode of \p descr and the diagonal are accessed, and \p m must be
+*  equal to \p n. If the \ref rocsparse_diag_type is \ref rocsparse_diag_type_unit, the
+*  diagonal is assumed to be one. The transposed contribution of the stored triangle is
+*  accumulated using atomic operations, unless \p info is present.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -1618,8 +2039,7 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
@@ -1649,9 +2069,6 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
 *              invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
 *  This example performs a sparse matrix vector multiplication in CSR format
@@ -1763,64 +2180,215 @@ rocsparse_status rocsparse_zcsrmv(rocsparse_handle                handle,
 /**@}*/
 
 /*! \ingroup level2_module
-*  \brief Sparse triangular solve using CSR storage format
+*  \brief Sparse matrix vector multiplication using CSR storage format with algorithm
+*  selection
 *
 *  \details
-*  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsrsv_solve(),
-*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() or rocsparse_zcsrsv_solve()
-*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
-*  using same index base as the CSR matrix.
+*  \p rocsparse_csrmv_ex multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
+*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+*  such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
 *
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*  In contrast to rocsparse_scsrmv(), rocsparse_dcsrmv(), rocsparse_ccsrmv() and
+*  rocsparse_zcsrmv(), the algorithm is selected explicitly by \p alg.
+*  \ref rocsparse_csrmv_alg_stream ignores \p info. \ref rocsparse_csrmv_alg_adaptive
+*  requires \p info to contain the information collected by rocsparse_scsrmv_analysis(),
+*  rocsparse_dcsrmv_analysis(), rocsparse_ccsrmv_analysis() or
+*  rocsparse_zcsrmv_analysis().
+*
+*  \ref rocsparse_csrmv_alg_merge_path requires no analysis and ignores \p info. The
+*  \p m row ends and the \p nnz non-zero entries are merged into a single sequence, which
+*  is split into chunks of equal length. Each thread processes one chunk, such that the
+*  work is balanced independently of the distribution of the non-zero entries among the
+*  rows. Partial sums of rows that are split are combined in a second pass. This makes
+*  the merge path algorithm preferable for matrices with highly irregular row lengths,
+*  that change too frequently to amortize the analysis of the adaptive algorithm.
 *
-*  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  \ref rocsparse_csrmv_alg_merge_path uses temporary storage of the size of
+*  \f$(m + nnz) / 2048\f$ elements. If this exceeds the internal buffer of \p handle,
+*  the temporary storage is allocated and this function might block.
+*
+*  \note
+*  \ref rocsparse_csrmv_alg_merge_path is only supported for
+*  \p trans == \ref rocsparse_operation_none and \ref rocsparse_matrix_type_general.
+*  Otherwise, \ref rocsparse_csrmv_alg_stream is used instead.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  alg         csrmv algorithm, see \ref rocsparse_csrmv_alg.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
-*  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        information collected by rocsparse_Xcsrmv_analysis(), only required for
+*              \ref rocsparse_csrmv_alg_adaptive.
+*  @param[in]
+*  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+*              invalid, or \p info does not contain analysis data for
+*              \ref rocsparse_csrmv_alg_adaptive.
+*  \retval     rocsparse_status_memory_error the temporary storage could not be
+*              allocated.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*
+*  \par Example
+*  This example performs a sparse matrix vector multiplication in CSR format
+*  without analysis using the merge path algorithm.
+*  \code{.c}
+*      // Compute y = Ax
+*      rocsparse_scsrmv_ex(handle,
+*                          rocsparse_operation_none,
+*                          rocsparse_csrmv_alg_merge_path,
+*                          m,
+*                          n,
+*                          nnz,
+*                          &alpha,
+*                          descr,
+*                          csr_val,
+*                          csr_row_ptr,
+*                          csr_col_ind,
+*                          NULL,
+*                          x,
+*                          &beta,
+*                          y);
+*  \endcode
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
-                                            const rocsparse_mat_descr descr,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_int*            position);
+rocsparse_status rocsparse_scsrmv_ex(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_csrmv_alg       alg,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_ex(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_csrmv_alg       alg,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmv_ex(rocsparse_handle               handle,
+                                     rocsparse_operation            trans,
+                                     rocsparse_csrmv_alg            alg,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     rocsparse_mat_info             info,
+                                     const rocsparse_float_complex* x,
+                                     const rocsparse_float_complex* beta,
+                                     rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmv_ex(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     rocsparse_csrmv_alg             alg,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     rocsparse_mat_info              info,
+                                     const rocsparse_double_complex* x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y);
+/**@}*/
 
 /*! \ingroup level2_module
-*  \brief Sparse triangular solve using CSR storage format
+*  \brief Sparse matrix sparse vector multiplication using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
-*  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(), rocsparse_scsrsv_solve(),
-*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve(). The
-*  temporary storage buffer must be allocated by the user. The size of the temporary
-*  storage buffer is identical to the size returned by rocsparse_scsrilu0_buffer_size(),
-*  rocsparse_dcsrilu0_buffer_size(), rocsparse_ccsrilu0_buffer_size() and
-*  rocsparse_zcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
-*  user allocated buffer can thus be shared between subsequent calls to those functions.
+*  \p rocsparse_csrmspv_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrmspv_analysis(), rocsparse_dcsrmspv_analysis(),
+*  rocsparse_ccsrmspv_analysis(), rocsparse_zcsrmspv_analysis(), rocsparse_scsrmspv(),
+*  rocsparse_dcsrmspv(), rocsparse_ccsrmspv() and rocsparse_zcsrmspv(). The temporary
+*  storage buffer must be allocated by the user. The size of the temporary storage
+*  buffer is identical for all operation types.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans       matrix operation type.
-*  @param[in]
 *  m           number of rows of the sparse CSR matrix.
 *  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
@@ -1833,98 +2401,78 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
 *  @param[out]
-*  info        structure that holds the information collected during the analysis step.
-*  @param[in]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*              rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*              rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(),
-*              rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve().
+*              rocsparse_Xcsrmspv_analysis() and rocsparse_Xcsrmspv().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr or \p buffer_size pointer is
+*              invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans == \ref rocsparse_operation_conjugate_transpose or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const float*              csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrmspv_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsrmspv_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle               handle,
-                                              rocsparse_operation            trans,
-                                              rocsparse_int                  m,
-                                              rocsparse_int                  nnz,
-                                              const rocsparse_mat_descr      descr,
-                                              const rocsparse_float_complex* csr_val,
-                                              const rocsparse_int*           csr_row_ptr,
-                                              const rocsparse_int*           csr_col_ind,
-                                              rocsparse_mat_info             info,
-                                              size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsrmspv_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  n,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                handle,
-                                              rocsparse_operation             trans,
-                                              rocsparse_int                   m,
-                                              rocsparse_int                   nnz,
-                                              const rocsparse_mat_descr       descr,
-                                              const rocsparse_double_complex* csr_val,
-                                              const rocsparse_int*            csr_row_ptr,
-                                              const rocsparse_int*            csr_col_ind,
-                                              rocsparse_mat_info              info,
-                                              size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsrmspv_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   n,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup level2_module
-*  \brief Sparse triangular solve using CSR storage format
+*  \brief Sparse matrix sparse vector multiplication using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve(),
-*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve(). It
-*  is expected that this function will be executed only once for a given matrix and
-*  particular operation type. The analysis meta data can be cleared by
-*  rocsparse_csrsv_clear().
-*
-*  \p rocsparse_csrsv_analysis can share its meta data with
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(),
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_ccsric0_analysis() and rocsparse_zcsric0_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
+*  \p rocsparse_csrmspv_analysis performs the analysis step for rocsparse_scsrmspv(),
+*  rocsparse_dcsrmspv(), rocsparse_ccsrmspv() and rocsparse_zcsrmspv(). It creates the
+*  transposed sparsity pattern of the CSR matrix, which enables both, the push and the
+*  pull based kernels for all operation types. It is expected that this function will
+*  be executed only once for a given matrix. The gathered analysis meta data can be
+*  cleared by rocsparse_csrmspv_clear().
 *
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  Changes to the matrix values do not require a new analysis.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1933,10 +2481,10 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans       matrix operation type.
-*  @param[in]
 *  m           number of rows of the sparse CSR matrix.
 *  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
@@ -1949,124 +2497,110 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
 *  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
-*  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
-*  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_Xcsrmspv_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
 *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the gathered information
+*              could not be allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans == \ref rocsparse_operation_conjugate_transpose or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_scsrmspv_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrmspv_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle               handle,
-                                           rocsparse_operation            trans,
-                                           rocsparse_int                  m,
-                                           rocsparse_int                  nnz,
-                                           const rocsparse_mat_descr      descr,
-                                           const rocsparse_float_complex* csr_val,
-                                           const rocsparse_int*           csr_row_ptr,
-                                           const rocsparse_int*           csr_col_ind,
-                                           rocsparse_mat_info             info,
-                                           rocsparse_analysis_policy      analysis,
-                                           rocsparse_solve_policy         solve,
-                                           void*                          temp_buffer);
+rocsparse_status rocsparse_ccsrmspv_analysis(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle                handle,
-                                           rocsparse_operation             trans,
-                                           rocsparse_int                   m,
-                                           rocsparse_int                   nnz,
-                                           const rocsparse_mat_descr       descr,
-                                           const rocsparse_double_complex* csr_val,
-                                           const rocsparse_int*            csr_row_ptr,
-                                           const rocsparse_int*            csr_col_ind,
-                                           rocsparse_mat_info              info,
-                                           rocsparse_analysis_policy       analysis,
-                                           rocsparse_solve_policy          solve,
-                                           void*                           temp_buffer);
-/**@}*/
-
-/*! \ingroup level2_module
-*  \brief Sparse triangular solve using CSR storage format
+rocsparse_status rocsparse_zcsrmspv_analysis(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+*  \brief Sparse matrix sparse vector multiplication using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis()
-*  or rocsparse_zcsrsv_analysis(). This is especially useful, if memory is an issue and
-*  the analysis data is not required for further computation, e.g. when switching to
-*  another sparse matrix format. Calling \p rocsparse_csrsv_clear is optional. All
-*  allocated resources will be cleared, when the opaque \ref rocsparse_mat_info struct
-*  is destroyed using rocsparse_destroy_mat_info().
+*  \p rocsparse_csrmspv_clear deallocates all memory that was allocated by
+*  rocsparse_scsrmspv_analysis(), rocsparse_dcsrmspv_analysis(),
+*  rocsparse_ccsrmspv_analysis() or rocsparse_zcsrmspv_analysis().
+*
+*  \note
+*  Calling \p rocsparse_csrmspv_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
 *  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
+*  info        structure that holds the information collected during analysis step.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
+*  \retval     rocsparse_status_memory_error the buffer for the gathered information
+*              could not be deallocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*/
+* */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
-                                       const rocsparse_mat_descr descr,
-                                       rocsparse_mat_info        info);
+rocsparse_status rocsparse_csrmspv_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup level2_module
-*  \brief Sparse triangular solve using CSR storage format
+*  \brief Sparse matrix sparse vector multiplication using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
-*  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
-*  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
+*  \p rocsparse_csrmspv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix, defined in CSR storage format, and the sparse vector \f$x\f$ and adds the
+*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+*  such that
 *  \f[
-*    op(A) \cdot y = \alpha \cdot x,
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
 *  \f]
 *  with
 *  \f[
@@ -2079,29 +2613,24 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *    \right.
 *  \f]
 *
-*  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
-*  returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
-*  rocsparse_ccsrsv_buffer_size() or rocsparse_zcsrsv_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsrsv_analysis(),
-*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() or
-*  rocsparse_zcsrsv_analysis(). \p rocsparse_csrsv_solve reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be checked calling
-*  rocsparse_csrsv_zero_pivot(). If
-*  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
-*  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+*  Depending on the number of non-zero entries of \f$x\f$, either a push based kernel,
+*  that scatters the columns of \f$op(A)\f$ selected by \f$x\f$ into \f$y\f$, or a
+*  pull based kernel, that expands \f$x\f$ into a dense vector and performs a
+*  sparse matrix dense vector multiplication, is chosen. Without meta data from
+*  rocsparse_Xcsrmspv_analysis(), only the pull based kernel is available for
+*  \f$op(A) = A\f$ and only the push based kernel is available for \f$op(A) = A^T\f$
+*  and \f$op(A) = A^H\f$. If both kernels are available, the kernel with less
+*  estimated memory traffic is chosen, based on the dimensions of \f$op(A)\f$, its
+*  number of non-zero entries and the number of non-zero entries of \f$x\f$.
 *
 *  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
+*  The indices of \f$x\f$ can be stored in any order. If \f$x\f$ contains duplicate
+*  indices, their contributions are summed up.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none and
-*  \p trans == \ref rocsparse_operation_transpose is supported.
-*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
@@ -2109,11 +2638,14 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  @param[in]
 *  m           number of rows of the sparse CSR matrix.
 *  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  descr       descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
@@ -2123,2402 +2655,2147 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  info        information collected by rocsparse_Xcsrmspv_analysis() and optionally
+*              rocsparse_Xcsrmv_analysis(), can be \p NULL if no information is
+*              available.
 *  @param[in]
-*  x           array of \p m elements, holding the right-hand side.
-*  @param[out]
-*  y           array of \p m elements, holding the solution.
+*  nnz_x       number of non-zero entries of vector \f$x\f$.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  x_val       array of \p nnz_x values.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  x_ind       array of \p nnz_x elements containing the indices of the non-zero
+*              values of \f$x\f$, using the index base of \p descr.
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_Xcsrmspv_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p nnz_x is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+*              \p csr_row_ptr, \p csr_col_ind, \p x_val, \p x_ind, \p beta, \p y or
+*              \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans == \ref rocsparse_operation_conjugate_transpose or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
-*  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
-*
-*      // Create matrix descriptor
-*      rocsparse_mat_descr descr;
-*      rocsparse_create_mat_descr(&descr);
-*      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
-*
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
-*
-*      // Obtain required buffer size
-*      size_t buffer_size;
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size);
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
-*
-*      // Perform analysis step
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*
-*      // Solve Ly = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
-*
-*      // No zero pivot should be found, with L having unit diagonal
-*
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const float*              alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const float*              csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const float*              x,
-                                        float*                    y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_scsrmspv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nnz_x,
+                                    const float*              x_val,
+                                    const rocsparse_int*      x_ind,
+                                    const float*              beta,
+                                    float*                    y,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const double*             alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const double*             csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const double*             x,
-                                        double*                   y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrmspv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nnz_x,
+                                    const double*             x_val,
+                                    const rocsparse_int*      x_ind,
+                                    const double*             beta,
+                                    double*                   y,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle               handle,
-                                        rocsparse_operation            trans,
-                                        rocsparse_int                  m,
-                                        rocsparse_int                  nnz,
-                                        const rocsparse_float_complex* alpha,
-                                        const rocsparse_mat_descr      descr,
-                                        const rocsparse_float_complex* csr_val,
-                                        const rocsparse_int*           csr_row_ptr,
-                                        const rocsparse_int*           csr_col_ind,
-                                        rocsparse_mat_info             info,
-                                        const rocsparse_float_complex* x,
-                                        rocsparse_float_complex*       y,
-                                        rocsparse_solve_policy         policy,
-                                        void*                          temp_buffer);
+rocsparse_status rocsparse_ccsrmspv(rocsparse_handle               handle,
+                                    rocsparse_operation            trans,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_int                  nnz_x,
+                                    const rocsparse_float_complex* x_val,
+                                    const rocsparse_int*           x_ind,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       y,
+                                    void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle                handle,
-                                        rocsparse_operation             trans,
-                                        rocsparse_int                   m,
-                                        rocsparse_int                   nnz,
-                                        const rocsparse_double_complex* alpha,
-                                        const rocsparse_mat_descr       descr,
-                                        const rocsparse_double_complex* csr_val,
-                                        const rocsparse_int*            csr_row_ptr,
-                                        const rocsparse_int*            csr_col_ind,
-                                        rocsparse_mat_info              info,
-                                        const rocsparse_double_complex* x,
-                                        rocsparse_double_complex*       y,
-                                        rocsparse_solve_policy          policy,
-                                        void*                           temp_buffer);
+rocsparse_status rocsparse_zcsrmspv(rocsparse_handle                handle,
+                                    rocsparse_operation             trans,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_int                   nnz_x,
+                                    const rocsparse_double_complex* x_val,
+                                    const rocsparse_int*            x_ind,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       y,
+                                    void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup level2_module
-*  \brief Sparse matrix vector multiplication using ELL storage format
+*  \brief Sparse triangular solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
-*  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
-*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
-*  such that
-*  \f[
-*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans == rocsparse_operation_none} \\
-*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*
-*  \code{.c}
-*      for(i = 0; i < m; ++i)
-*      {
-*          y[i] = beta * y[i];
-*
-*          for(p = 0; p < ell_width; ++p)
-*          {
-*              idx = p * m + i;
-*
-*              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
-*              {
-*                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
-*              }
-*          }
-*      }
-*  \endcode
+*  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrsv_solve(),
+*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() or rocsparse_zcsrsv_solve()
+*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
+*  using same index base as the CSR matrix.
 *
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
 *
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
+*  performance negatively.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans       matrix operation type.
-*  @param[in]
-*  m           number of rows of the sparse ELL matrix.
-*  @param[in]
-*  n           number of columns of the sparse ELL matrix.
-*  @param[in]
-*  alpha       scalar \f$\alpha\f$.
-*  @param[in]
-*  descr       descriptor of the sparse ELL matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  ell_val     array that contains the elements of the sparse ELL matrix. Padded
-*              elements should be zero.
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            position);
+
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_level_info returns the level schedule of the meta data that has
+*  been collected by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis() or rocsparse_zcsrsv_analysis(). Rows of the same level can
+*  be processed in parallel, while levels are processed in order. The work of a row is
+*  one plus the number of its off-diagonal entries in the triangular part. The critical
+*  path is the largest accumulated work along a chain of dependent rows, and the
+*  available parallelism is the total work divided by the critical path. Matrices with a
+*  low parallelism might benefit from reordering or coloring prior to the analysis.
+*
+*  If no meta data is available, all fields of \p level_info are set to zero.
+*
+*  \note \p rocsparse_csrsv_level_info is a blocking function. The level schedule is
+*  computed on the host from the sparsity pattern the analysis has been performed on,
+*  which has to be left untouched.
+*
 *  @param[in]
-*  ell_col_ind array that contains the column indices of the sparse ELL matrix.
-*              Padded column indices should be -1.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+*  trans       matrix operation type the analysis has been performed for.
 *  @param[in]
-*  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
-*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  beta        scalar \f$\beta\f$.
-*  @param[inout]
-*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
-*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  level_info  level schedule of the analysis meta data, in host memory.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
-*              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p info or \p level_info
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cellmv(rocsparse_handle               handle,
-                                  rocsparse_operation            trans,
-                                  rocsparse_int                  m,
-                                  rocsparse_int                  n,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr      descr,
-                                  const rocsparse_float_complex* ell_val,
-                                  const rocsparse_int*           ell_col_ind,
-                                  rocsparse_int                  ell_width,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex*       y);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zellmv(rocsparse_handle                handle,
-                                  rocsparse_operation             trans,
-                                  rocsparse_int                   m,
-                                  rocsparse_int                   n,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr       descr,
-                                  const rocsparse_double_complex* ell_val,
-                                  const rocsparse_int*            ell_col_ind,
-                                  rocsparse_int                   ell_width,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex*       y);
-/**@}*/
+rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_level_info*     level_info);
 
 /*! \ingroup level2_module
-*  \brief Sparse matrix vector multiplication using HYB storage format
+*  \brief Sparse triangular solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
-*  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
-*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
-*  such that
-*  \f[
-*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans == rocsparse_operation_none} \\
-*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(), rocsparse_scsrsv_solve(),
+*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve(). The
+*  temporary storage buffer must be allocated by the user. The size of the temporary
+*  storage buffer is identical to the size returned by rocsparse_scsrilu0_buffer_size(),
+*  rocsparse_dcsrilu0_buffer_size(), rocsparse_ccsrilu0_buffer_size() and
+*  rocsparse_zcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
+*  user allocated buffer can thus be shared between subsequent calls to those functions.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
 *  trans       matrix operation type.
 *  @param[in]
-*  alpha       scalar \f$\alpha\f$.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  descr       descriptor of the sparse HYB matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  hyb         matrix in HYB storage format.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
-*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  beta        scalar \f$\beta\f$.
-*  @param[inout]
-*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
-*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*              rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*              rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(),
+*              rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
-*              valid matrix sizes.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
-*              \p beta or \p y pointer is invalid.
-*  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
-*              with a valid partitioning type.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_memory_error the buffer could not be allocated.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
+*              \p trans == \ref rocsparse_operation_conjugate_transpose or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
+rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_chybmv(rocsparse_handle               handle,
-                                  rocsparse_operation            trans,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr      descr,
-                                  const rocsparse_hyb_mat        hyb,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex*       y);
+rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zhybmv(rocsparse_handle                handle,
-                                  rocsparse_operation             trans,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr       descr,
-                                  const rocsparse_hyb_mat         hyb,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex*       y);
+rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_operation            trans,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int*           csr_row_ptr,
+                                              const rocsparse_int*           csr_col_ind,
+                                              rocsparse_mat_info             info,
+                                              size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_operation             trans,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*            csr_row_ptr,
+                                              const rocsparse_int*            csr_col_ind,
+                                              rocsparse_mat_info              info,
+                                              size_t*                         buffer_size);
 /**@}*/
 
-/*
-* ===========================================================================
-*    level 3 SPARSE
-* ===========================================================================
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve(),
+*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve(). It
+*  is expected that this function will be executed only once for a given matrix and
+*  particular operation type. The analysis meta data can be cleared by
+*  rocsparse_csrsv_clear().
+*
+*  \p rocsparse_csrsv_analysis can share its meta data with
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(),
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis() and rocsparse_zcsric0_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
 
-/*! \ingroup level3_module
- *  \brief Sparse matrix dense matrix multiplication using BSR storage format
- *
- *  \details
- *  \p rocsparse_bsrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$mb \times kb\f$
- *  matrix \f$A\f$, defined in BSR storage format, and the dense \f$k \times n\f$
- *  matrix \f$B\f$ (where \f$k = block\_dim \times kb\f$) and adds the result to the dense
- *  \f$m \times n\f$ matrix \f$C\f$ (where \f$m = block\_dim \times mb\f$) that
- *  is multiplied by the scalar \f$\beta\f$, such that
- *  \f[
- *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans_A == rocsparse_operation_none} \\
- *    \end{array}
- *    \right.
- *  \f]
- *  and
- *  \f[
- *    op(B) = \left\{
- *    \begin{array}{ll}
- *        B,   & \text{if trans_B == rocsparse_operation_none} \\
- *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
- *    \end{array}
- *    \right.
- *  \f]
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  \note
- *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         the storage format of the blocks. Can be \ref rocsparse_direction_row or \ref rocsparse_direction_column.
- *  @param[in]
- *  trans_A     matrix \f$A\f$ operation type. Currently, only \ref rocsparse_operation_none is supported.
- *  @param[in]
- *  trans_B     matrix \f$B\f$ operation type. Currently, only \ref rocsparse_operation_none and rocsparse_operation_transpose
- *              are supported.
- *  @param[in]
- *  mb          number of block rows of the sparse BSR matrix \f$A\f$.
- *  @param[in]
- *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
- *  @param[in]
- *  kb          number of block columns of the sparse BSR matrix \f$A\f$.
- *  @param[in]
- *  nnzb        number of non-zero blocks of the sparse BSR matrix \f$A\f$.
- *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix \f$A\f$. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
- *  @param[in]
- *  bsr_val     array of \p nnzb*block_dim*block_dim elements of the sparse BSR matrix \f$A\f$.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix \f$A\f$.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse
- *              BSR matrix \f$A\f$.
- *  @param[in]
- *  block_dim   size of the blocks in the sparse BSR matrix.
- *  @param[in]
- *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
- *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$).
- *  @param[in]
- *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$ where \f$k = block\_dim \times kb\f$.
- *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  C           array of dimension \f$ldc \times n\f$.
- *  @param[in]
- *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$ where \f$m = block\_dim \times mb\f$.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p n, \p kb, \p nnzb, \p ldb or \p ldc
- *              is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p bsr_val,
- *              \p bsr_row_ptr, \p bsr_col_ind, \p B, \p beta or \p C pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans_A != \ref rocsparse_operation_none or
- *              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example multiplies a BSR matrix with a dense matrix.
- *  \code{.c}
- *      //     1 2 0 3 0 0
- *      // A = 0 4 5 0 0 0
- *      //     0 0 0 7 8 0
- *      //     0 0 1 2 4 1
- *
- *      rocsparse_int block_dim = 2;
- *      rocsparse_int mb   = 2;
- *      rocsparse_int kb   = 3;
- *      rocsparse_int nnzb = 4;
- *      rocsparse_direction dir = rocsparse_direction_row;
- *
- *      bsr_row_ptr[mb+1]                 = {0, 2, 4};                                        // device memory
- *      bsr_col_ind[nnzb]                 = {0, 1, 1, 2};                                     // device memory
- *      bsr_val[nnzb*block_dim*block_dim] = {1, 2, 0, 4, 0, 3, 5, 0, 0, 7, 1, 2, 8, 0, 4, 1}; // device memory
- *
- *      // Set dimension n of B
- *      rocsparse_int n = 64;
- *      rocsparse_int m = mb * block_dim;
- *      rocsparse_int k = kb * block_dim;
- *
- *      // Allocate and generate dense matrix B
- *      std::vector<float> hB(k * n);
- *      for(rocsparse_int i = 0; i < k * n; ++i)
- *      {
- *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
- *      }
- *
- *      // Copy B to the device
- *      float* B;
- *      hipMalloc((void**)&B, sizeof(float) * k * n);
- *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
- *
- *      // alpha and beta
- *      float alpha = 1.0f;
- *      float beta  = 0.0f;
- *
- *      // Allocate memory for the resulting matrix C
- *      float* C;
- *      hipMalloc((void**)&C, sizeof(float) * m * n);
- *
- *      // Perform the matrix multiplication
- *      rocsparse_sbsrmm(handle,
- *                       dir,
- *                       rocsparse_operation_none,
- *                       rocsparse_operation_none,
- *                       mb,
- *                       n,
- *                       kb,
- *                       nnzb,
- *                       &alpha,
- *                       descr,
- *                       bsr_val,
- *                       bsr_row_ptr,
- *                       bsr_col_ind,
- *                       block_dim,
- *                       B,
- *                       k,
- *                       &beta,
- *                       C,
- *                       m);
- *  \endcode
- */
-/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrmm(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             n,
-                                  rocsparse_int             kb,
-                                  rocsparse_int             nnzb,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  const float*              B,
-                                  rocsparse_int             ldb,
-                                  const float*              beta,
-                                  float*                    C,
-                                  rocsparse_int             ldc);
+rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrmm(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             n,
-                                  rocsparse_int             kb,
-                                  rocsparse_int             nnzb,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  const double*             B,
-                                  rocsparse_int             ldb,
-                                  const double*             beta,
-                                  double*                   C,
-                                  rocsparse_int             ldc);
+rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle               handle,
+                                           rocsparse_operation            trans,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           csr_row_ptr,
+                                           const rocsparse_int*           csr_col_ind,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_analysis_policy      analysis,
+                                           rocsparse_solve_policy         solve,
+                                           void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrmm(rocsparse_handle               handle,
-                                  rocsparse_direction            dir,
-                                  rocsparse_operation            trans_A,
-                                  rocsparse_operation            trans_B,
-                                  rocsparse_int                  mb,
-                                  rocsparse_int                  n,
-                                  rocsparse_int                  kb,
-                                  rocsparse_int                  nnzb,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr      descr,
-                                  const rocsparse_float_complex* bsr_val,
-                                  const rocsparse_int*           bsr_row_ptr,
-                                  const rocsparse_int*           bsr_col_ind,
-                                  rocsparse_int                  block_dim,
-                                  const rocsparse_float_complex* B,
-                                  rocsparse_int                  ldb,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex*       C,
-                                  rocsparse_int                  ldc);
+rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle                handle,
+                                           rocsparse_operation             trans,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            csr_row_ptr,
+                                           const rocsparse_int*            csr_col_ind,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_analysis_policy       analysis,
+                                           rocsparse_solve_policy          solve,
+                                           void*                           temp_buffer);
+/**@}*/
 
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis()
+*  or rocsparse_zcsrsv_analysis(). This is especially useful, if memory is an issue and
+*  the analysis data is not required for further computation, e.g. when switching to
+*  another sparse matrix format. Calling \p rocsparse_csrsv_clear is optional. All
+*  allocated resources will be cleared, when the opaque \ref rocsparse_mat_info struct
+*  is destroyed using rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrmm(rocsparse_handle                handle,
-                                  rocsparse_direction             dir,
-                                  rocsparse_operation             trans_A,
-                                  rocsparse_operation             trans_B,
-                                  rocsparse_int                   mb,
-                                  rocsparse_int                   n,
-                                  rocsparse_int                   kb,
-                                  rocsparse_int                   nnzb,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr       descr,
-                                  const rocsparse_double_complex* bsr_val,
-                                  const rocsparse_int*            bsr_row_ptr,
-                                  const rocsparse_int*            bsr_col_ind,
-                                  rocsparse_int                   block_dim,
-                                  const rocsparse_double_complex* B,
-                                  rocsparse_int                   ldb,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex*       C,
-                                  rocsparse_int                   ldc);
-/**@}*/
+rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info);
 
-/*! \ingroup level3_module
-*  \brief Sparse matrix dense matrix multiplication using CSR storage format
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
-*  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
-*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
-*  is multiplied by the scalar \f$\beta\f$, such that
+*  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
+*  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
+*  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
 *  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+*    op(A) \cdot y = \alpha \cdot x,
 *  \f]
 *  with
 *  \f[
 *    op(A) = \left\{
 *    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
 *    \end{array}
 *    \right.
 *  \f]
 *
-*  \code{.c}
-*      for(i = 0; i < ldc; ++i)
-*      {
-*          for(j = 0; j < n; ++j)
-*          {
-*              C[i][j] = beta * C[i][j];
+*  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
+*  rocsparse_ccsrsv_buffer_size() or rocsparse_zcsrsv_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrsv_analysis(),
+*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() or
+*  rocsparse_zcsrsv_analysis(). \p rocsparse_csrsv_solve reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be checked calling
+*  rocsparse_csrsv_zero_pivot(). If
+*  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+*  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
 *
-*              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
-*              {
-*                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
-*              }
-*          }
-*      }
-*  \endcode
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  Currently, only \p trans == \ref rocsparse_operation_none and
+*  \p trans == \ref rocsparse_operation_transpose is supported.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A     matrix \f$A\f$ operation type.
+*  trans       matrix operation type.
 *  @param[in]
-*  trans_B     matrix \f$B\f$ operation type.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
-*  @param[in]
-*  k           number of columns of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix \f$A\f$.
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix \f$A\f$.
+*              CSR matrix.
 *  @param[in]
-*  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
-*              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
-*              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
-*              \f$op(A) == A^H\f$).
+*  x           array of \p m elements, holding the right-hand side.
+*  @param[out]
+*  y           array of \p m elements, holding the solution.
 *  @param[in]
-*  beta        scalar \f$\beta\f$.
-*  @param[inout]
-*  C           array of dimension \f$ldc \times n\f$.
+*  policy      \ref rocsparse_solve_policy_auto.
 *  @param[in]
-*  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
-*              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
-*              \f$op(A) == A^H\f$).
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
-*              is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+*              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans_A != \ref rocsparse_operation_none or
+*              \p trans == \ref rocsparse_operation_conjugate_transpose or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example multiplies a CSR matrix with a dense matrix.
+*  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
+*  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
 *  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
 *
-*      rocsparse_int m   = 3;
-*      rocsparse_int k   = 5;
-*      rocsparse_int nnz = 8;
+*      // Create matrix descriptor
+*      rocsparse_mat_descr descr;
+*      rocsparse_create_mat_descr(&descr);
+*      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
 *
-*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
 *
-*      // Set dimension n of B
-*      rocsparse_int n = 64;
+*      // Obtain required buffer size
+*      size_t buffer_size;
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size);
 *
-*      // Allocate and generate dense matrix B
-*      std::vector<float> hB(k * n);
-*      for(rocsparse_int i = 0; i < k * n; ++i)
-*      {
-*          hB[i] = static_cast<float>(rand()) / RAND_MAX;
-*      }
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
 *
-*      // Copy B to the device
-*      float* B;
-*      hipMalloc((void**)&B, sizeof(float) * k * n);
-*      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
+*      // Perform analysis step
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
 *
-*      // alpha and beta
-*      float alpha = 1.0f;
-*      float beta  = 0.0f;
+*      // Solve Ly = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
 *
-*      // Allocate memory for the resulting matrix C
-*      float* C;
-*      hipMalloc((void**)&C, sizeof(float) * m * n);
+*      // No zero pivot should be found, with L having unit diagonal
 *
-*      // Perform the matrix multiplication
-*      rocsparse_scsrmm(handle,
-*                       rocsparse_operation_none,
-*                       rocsparse_operation_none,
-*                       m,
-*                       n,
-*                       k,
-*                       nnz,
-*                       &alpha,
-*                       descr,
-*                       csr_val,
-*                       csr_row_ptr,
-*                       csr_col_ind,
-*                       B,
-*                       k,
-*                       &beta,
-*                       C,
-*                       m);
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr);
+*      rocsparse_destroy_handle(handle);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const float*              B,
-                                  rocsparse_int             ldb,
-                                  const float*              beta,
-                                  float*                    C,
-                                  rocsparse_int             ldc);
+rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        float*                    y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const double*             B,
-                                  rocsparse_int             ldb,
-                                  const double*             beta,
-                                  double*                   C,
-                                  rocsparse_int             ldc);
+rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        double*                   y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmm(rocsparse_handle               handle,
-                                  rocsparse_operation            trans_A,
-                                  rocsparse_operation            trans_B,
-                                  rocsparse_int                  m,
-                                  rocsparse_int                  n,
-                                  rocsparse_int                  k,
-                                  rocsparse_int                  nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr      descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int*           csr_row_ptr,
-                                  const rocsparse_int*           csr_col_ind,
-                                  const rocsparse_float_complex* B,
-                                  rocsparse_int                  ldb,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex*       C,
-                                  rocsparse_int                  ldc);
+rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle               handle,
+                                        rocsparse_operation            trans,
+                                        rocsparse_int                  m,
+                                        rocsparse_int                  nnz,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr      descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int*           csr_row_ptr,
+                                        const rocsparse_int*           csr_col_ind,
+                                        rocsparse_mat_info             info,
+                                        const rocsparse_float_complex* x,
+                                        rocsparse_float_complex*       y,
+                                        rocsparse_solve_policy         policy,
+                                        void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmm(rocsparse_handle                handle,
-                                  rocsparse_operation             trans_A,
-                                  rocsparse_operation             trans_B,
-                                  rocsparse_int                   m,
-                                  rocsparse_int                   n,
-                                  rocsparse_int                   k,
-                                  rocsparse_int                   nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr       descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int*            csr_row_ptr,
-                                  const rocsparse_int*            csr_col_ind,
-                                  const rocsparse_double_complex* B,
-                                  rocsparse_int                   ldb,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex*       C,
-                                  rocsparse_int                   ldc);
+rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle                handle,
+                                        rocsparse_operation             trans,
+                                        rocsparse_int                   m,
+                                        rocsparse_int                   nnz,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int*            csr_row_ptr,
+                                        const rocsparse_int*            csr_col_ind,
+                                        rocsparse_mat_info              info,
+                                        const rocsparse_double_complex* x,
+                                        rocsparse_double_complex*       y,
+                                        rocsparse_solve_policy          policy,
+                                        void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup level3_module
-*  \brief Sparse triangular system solve using CSR storage format
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using ELL storage format
 *
 *  \details
-*  \p rocsparse_csrsm_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsrsm_solve(),
-*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() or rocsparse_zcsrsm_solve()
-*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
-*  using same index base as the CSR matrix.
+*  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
+*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+*  such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
 *
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*  \code{.c}
+*      for(i = 0; i < m; ++i)
+*      {
+*          y[i] = beta * y[i];
 *
-*  \note \p rocsparse_csrsm_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*          for(p = 0; p < ell_width; ++p)
+*          {
+*              idx = p * m + i;
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  info        structure that holds the information collected during the analysis step.
-*  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
+*              {
+*                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
+*              }
+*          }
+*      }
+*  \endcode
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle,
-                                            rocsparse_mat_info info,
-                                            rocsparse_int*     position);
-
-/*! \ingroup level3_module
-*  \brief Sparse triangular system solve using CSR storage format
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
-*  \details
-*  \p rocsparse_csrsm_buffer_size returns the size of the temporary storage buffer that
-*  is required by rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(), rocsparse_scsrsm_solve(),
-*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve(). The
-*  temporary storage buffer must be allocated by the user.
+*  \note
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A     matrix A operation type.
-*  @param[in]
-*  trans_B     matrix B operation type.
-*  @param[in]
-*  m           number of rows of the sparse CSR matrix A.
+*  trans       matrix operation type.
 *  @param[in]
-*  nrhs        number of columns of the dense matrix op(B).
+*  m           number of rows of the sparse ELL matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix A.
+*  n           number of columns of the sparse ELL matrix.
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix A.
-*  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
-*  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix A.
+*  descr       descriptor of the sparse ELL matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix A.
+*  ell_val     array that contains the elements of the sparse ELL matrix. Padded
+*              elements should be zero.
 *  @param[in]
-*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
+*  ell_col_ind array that contains the column indices of the sparse ELL matrix.
+*              Padded column indices should be -1.
 *  @param[in]
-*  ldb         leading dimension of rhs matrix B.
+*  ell_width   number of non-zero elements per row of the sparse ELL matrix.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
-*  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*              rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(),
-*              rocsparse_scsrsm_solve(), rocsparse_dcsrsm_solve(),
-*              rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve().
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p buffer_size pointer
-*              is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
+*              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
-*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsm_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans_A,
-                                              rocsparse_operation       trans_B,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nrhs,
-                                              rocsparse_int             nnz,
-                                              const float*              alpha,
-                                              const rocsparse_mat_descr descr,
-                                              const float*              csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              const float*              B,
-                                              rocsparse_int             ldb,
-                                              rocsparse_mat_info        info,
-                                              rocsparse_solve_policy    policy,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsm_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans_A,
-                                              rocsparse_operation       trans_B,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nrhs,
-                                              rocsparse_int             nnz,
-                                              const double*             alpha,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              const double*             B,
-                                              rocsparse_int             ldb,
-                                              rocsparse_mat_info        info,
-                                              rocsparse_solve_policy    policy,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsm_buffer_size(rocsparse_handle               handle,
-                                              rocsparse_operation            trans_A,
-                                              rocsparse_operation            trans_B,
-                                              rocsparse_int                  m,
-                                              rocsparse_int                  nrhs,
-                                              rocsparse_int                  nnz,
-                                              const rocsparse_float_complex* alpha,
-                                              const rocsparse_mat_descr      descr,
-                                              const rocsparse_float_complex* csr_val,
-                                              const rocsparse_int*           csr_row_ptr,
-                                              const rocsparse_int*           csr_col_ind,
-                                              const rocsparse_float_complex* B,
-                                              rocsparse_int                  ldb,
-                                              rocsparse_mat_info             info,
-                                              rocsparse_solve_policy         policy,
-                                              size_t*                        buffer_size);
+rocsparse_status rocsparse_cellmv(rocsparse_handle               handle,
+                                  rocsparse_operation            trans,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* ell_val,
+                                  const rocsparse_int*           ell_col_ind,
+                                  rocsparse_int                  ell_width,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsm_buffer_size(rocsparse_handle                handle,
-                                              rocsparse_operation             trans_A,
-                                              rocsparse_operation             trans_B,
-                                              rocsparse_int                   m,
-                                              rocsparse_int                   nrhs,
-                                              rocsparse_int                   nnz,
-                                              const rocsparse_double_complex* alpha,
-                                              const rocsparse_mat_descr       descr,
-                                              const rocsparse_double_complex* csr_val,
-                                              const rocsparse_int*            csr_row_ptr,
-                                              const rocsparse_int*            csr_col_ind,
-                                              const rocsparse_double_complex* B,
-                                              rocsparse_int                   ldb,
-                                              rocsparse_mat_info              info,
-                                              rocsparse_solve_policy          policy,
-                                              size_t*                         buffer_size);
+rocsparse_status rocsparse_zellmv(rocsparse_handle                handle,
+                                  rocsparse_operation             trans,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* ell_val,
+                                  const rocsparse_int*            ell_col_ind,
+                                  rocsparse_int                   ell_width,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       y);
 /**@}*/
 
-/*! \ingroup level3_module
-*  \brief Sparse triangular system solve using CSR storage format
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using HYB storage format
 *
 *  \details
-*  \p rocsparse_csrsm_analysis performs the analysis step for rocsparse_scsrsm_solve(),
-*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve(). It
-*  is expected that this function will be executed only once for a given matrix and
-*  particular operation type. The analysis meta data can be cleared by
-*  rocsparse_csrsm_clear().
-*
-*  \p rocsparse_csrsm_analysis can share its meta data with
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis() and rocsparse_zcsrsv_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
-*
-*  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
+*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+*  such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
+*  \note
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A     matrix A operation type.
-*  @param[in]
-*  trans_B     matrix B operation type.
-*  @param[in]
-*  m           number of rows of the sparse CSR matrix A.
-*  @param[in]
-*  nrhs        number of columns of the dense matrix op(B).
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix A.
+*  trans       matrix operation type.
 *  @param[in]
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix A.
-*  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
-*  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix A.
-*  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix A.
-*  @param[in]
-*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
-*  @param[in]
-*  ldb         leading dimension of rhs matrix B.
-*  @param[out]
-*  info        structure that holds the information collected during the analysis step.
+*  descr       descriptor of the sparse HYB matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  hyb         matrix in HYB storage format.
 *  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p temp_buffer pointer
-*              is invalid.
+*  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
+*              valid matrix sizes.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
+*              \p beta or \p y pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
+*              with a valid partitioning type.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_memory_error the buffer could not be allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
-*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsm_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans_A,
-                                           rocsparse_operation       trans_B,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nrhs,
-                                           rocsparse_int             nnz,
-                                           const float*              alpha,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           const float*              B,
-                                           rocsparse_int             ldb,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsm_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans_A,
-                                           rocsparse_operation       trans_B,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nrhs,
-                                           rocsparse_int             nnz,
-                                           const double*             alpha,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           const double*             B,
-                                           rocsparse_int             ldb,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsm_analysis(rocsparse_handle               handle,
-                                           rocsparse_operation            trans_A,
-                                           rocsparse_operation            trans_B,
-                                           rocsparse_int                  m,
-                                           rocsparse_int                  nrhs,
-                                           rocsparse_int                  nnz,
-                                           const rocsparse_float_complex* alpha,
-                                           const rocsparse_mat_descr      descr,
-                                           const rocsparse_float_complex* csr_val,
-                                           const rocsparse_int*           csr_row_ptr,
-                                           const rocsparse_int*           csr_col_ind,
-                                           const rocsparse_float_complex* B,
-                                           rocsparse_int                  ldb,
-                                           rocsparse_mat_info             info,
-                                           rocsparse_analysis_policy      analysis,
-                                           rocsparse_solve_policy         solve,
-                                           void*                          temp_buffer);
+rocsparse_status rocsparse_chybmv(rocsparse_handle               handle,
+                                  rocsparse_operation            trans,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_hyb_mat        hyb,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsm_analysis(rocsparse_handle                handle,
-                                           rocsparse_operation             trans_A,
-                                           rocsparse_operation             trans_B,
-                                           rocsparse_int                   m,
-                                           rocsparse_int                   nrhs,
-                                           rocsparse_int                   nnz,
-                                           const rocsparse_double_complex* alpha,
-                                           const rocsparse_mat_descr       descr,
-                                           const rocsparse_double_complex* csr_val,
-                                           const rocsparse_int*            csr_row_ptr,
-                                           const rocsparse_int*            csr_col_ind,
-                                           const rocsparse_double_complex* B,
-                                           rocsparse_int                   ldb,
-                                           rocsparse_mat_info              info,
-                                           rocsparse_analysis_policy       analysis,
-                                           rocsparse_solve_policy          solve,
-                                           void*                           temp_buffer);
+rocsparse_status rocsparse_zhybmv(rocsparse_handle                handle,
+                                  rocsparse_operation             trans,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_hyb_mat         hyb,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       y);
 /**@}*/
 
-/*! \ingroup level3_module
-*  \brief Sparse triangular system solve using CSR storage format
-*
-*  \details
-*  \p rocsparse_csrsm_clear deallocates all memory that was allocated by
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(), rocsparse_ccsrsm_analysis()
-*  or rocsparse_zcsrsm_analysis(). This is especially useful, if memory is an issue and
-*  the analysis data is not required for further computation, e.g. when switching to
-*  another sparse matrix format. Calling \p rocsparse_csrsm_clear is optional. All
-*  allocated resources will be cleared, when the opaque \ref rocsparse_mat_info struct
-*  is destroyed using rocsparse_destroy_mat_info().
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle, rocsparse_mat_info info);
-
-/*! \ingroup level3_module
-*  \brief Sparse triangular system solve using CSR storage format
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using SELL-C-\f$\sigma\f$ storage format
 *
 *  \details
-*  \p rocsparse_csrsm_solve solves a sparse triangular linear system of a sparse
-*  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution matrix
-*  \f$X\f$ and the right-hand side matrix \f$B\f$ that is multiplied by \f$\alpha\f$, such that
+*  \p rocsparse_sellcmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix, defined in SELL-C-\f$\sigma\f$ storage format, and the dense vector \f$x\f$
+*  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+*  \f$\beta\f$, such that
 *  \f[
-*    op(A) \cdot op(X) = \alpha \cdot op(B),
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
 *  \f]
 *  with
 *  \f[
 *    op(A) = \left\{
 *    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  ,
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
-*  \f[
-*    op(X) = \left\{
-*    \begin{array}{ll}
-*        X,   & \text{if trans_B == rocsparse_operation_none} \\
-*        X^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        X^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
 *    \end{array}
 *    \right.
 *  \f]
 *
-*  \p rocsparse_csrsm_solve requires a user allocated temporary buffer. Its size is
-*  returned by rocsparse_scsrsm_buffer_size(), rocsparse_dcsrsm_buffer_size(),
-*  rocsparse_ccsrsm_buffer_size() or rocsparse_zcsrsm_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsrsm_analysis(),
-*  rocsparse_dcsrsm_analysis(), rocsparse_ccsrsm_analysis() or
-*  rocsparse_zcsrsm_analysis(). \p rocsparse_csrsm_solve reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be checked calling
-*  rocsparse_csrsm_zero_pivot(). If
-*  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
-*  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+*  \code{.c}
+*      for(i = 0; i < m; ++i)
+*      {
+*          s    = i / sell_slice_size;
+*          lane = i % sell_slice_size;
+*          row  = sell_perm[i];
 *
-*  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
+*          width = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / sell_slice_size;
+*          sum   = 0;
+*
+*          for(p = 0; p < width; ++p)
+*          {
+*              idx = sell_slice_ptr[s] + lane + p * sell_slice_size;
+*
+*              if((sell_col_ind[idx] >= 0) && (sell_col_ind[idx] < n))
+*              {
+*                  sum = sum + sell_val[idx] * x[sell_col_ind[idx]];
+*              }
+*          }
+*
+*          y[row] = alpha * sum + beta * y[row];
+*      }
+*  \endcode
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  \note
-*  Currently, only \p trans_A != \ref rocsparse_operation_conjugate_transpose and
-*  \p trans_B != \ref rocsparse_operation_conjugate_transpose is supported.
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  trans_A     matrix A operation type.
-*  @param[in]
-*  trans_B     matrix B operation type.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix A.
+*  trans           matrix operation type.
 *  @param[in]
-*  nrhs        number of columns of the dense matrix op(B).
+*  m               number of rows of the sparse SELL-C-\f$\sigma\f$ matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix A.
+*  n               number of columns of the sparse SELL-C-\f$\sigma\f$ matrix.
 *  @param[in]
-*  alpha       scalar \f$\alpha\f$.
+*  alpha           scalar \f$\alpha\f$.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix A.
+*  descr           descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
+*  sell_val        array that contains the elements of the sparse SELL-C-\f$\sigma\f$
+*                  matrix. Padded elements should be zero.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix A.
+*  sell_slice_ptr  array of \p nslices+1 elements that point to the start of every
+*                  slice of the sparse SELL-C-\f$\sigma\f$ matrix, where
+*                  \f$\text{nslices} = \lceil m / \text{sell_slice_size} \rceil\f$.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix A.
-*  @param[inout]
-*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
+*  sell_col_ind    array that contains the column indices of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix. Padded column indices should be -1.
 *  @param[in]
-*  ldb         leading dimension of rhs matrix B.
+*  sell_perm       array of \p m elements that maps the rows of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix to the rows of \f$A\f$.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  x               array of \p n elements (\f$op(A) == A\f$) or \p m elements
+*                  (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  beta            scalar \f$\beta\f$.
+*  @param[inout]
+*  y               array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*                  (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p temp_buffer pointer
-*              is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p sell_slice_size is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p sell_val,
+*              \p sell_slice_ptr, \p sell_col_ind, \p sell_perm, \p x, \p beta or \p y
+*              pointer is invalid.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
-*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
-*  storage format with unit diagonal. The following example solves \f$L \cdot X = B\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
-*
-*      // Create matrix descriptor
-*      rocsparse_mat_descr descr;
-*      rocsparse_create_mat_descr(&descr);
-*      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
-*
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
-*
-*      // Obtain required buffer size
-*      size_t buffer_size;
-*      rocsparse_dcsrsm_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nrhs,
-*                                   nnz,
-*                                   &alpha,
-*                                   descr,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   B,
-*                                   ldb,
-*                                   info,
-*                                   rocsparse_solve_policy_auto,
-*                                   &buffer_size);
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
-*
-*      // Perform analysis step
-*      rocsparse_dcsrsm_analysis(handle,
-*                                rocsparse_operation_none,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nrhs,
-*                                nnz,
-*                                &alpha,
-*                                descr,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                B,
-*                                ldb,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*
-*      // Solve LX = B
-*      rocsparse_dcsrsm_solve(handle,
-*                             rocsparse_operation_none,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nrhs,
-*                             nnz,
-*                             &alpha,
-*                             descr,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             B,
-*                             ldb,
-*                             info,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
-*
-*      // No zero pivot should be found, with L having unit diagonal
-*
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans_A,
-                                        rocsparse_operation       trans_B,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nrhs,
-                                        rocsparse_int             nnz,
-                                        const float*              alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const float*              csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        float*                    B,
-                                        rocsparse_int             ldb,
-                                        rocsparse_mat_info        info,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_ssellcmv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              sell_val,
+                                    const rocsparse_int*      sell_slice_ptr,
+                                    const rocsparse_int*      sell_col_ind,
+                                    const rocsparse_int*      sell_perm,
+                                    rocsparse_int             sell_slice_size,
+                                    const float*              x,
+                                    const float*              beta,
+                                    float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans_A,
-                                        rocsparse_operation       trans_B,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nrhs,
-                                        rocsparse_int             nnz,
-                                        const double*             alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const double*             csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        double*                   B,
-                                        rocsparse_int             ldb,
-                                        rocsparse_mat_info        info,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_dsellcmv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             sell_val,
+                                    const rocsparse_int*      sell_slice_ptr,
+                                    const rocsparse_int*      sell_col_ind,
+                                    const rocsparse_int*      sell_perm,
+                                    rocsparse_int             sell_slice_size,
+                                    const double*             x,
+                                    const double*             beta,
+                                    double*                   y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrsm_solve(rocsparse_handle               handle,
-                                        rocsparse_operation            trans_A,
-                                        rocsparse_operation            trans_B,
-                                        rocsparse_int                  m,
-                                        rocsparse_int                  nrhs,
-                                        rocsparse_int                  nnz,
-                                        const rocsparse_float_complex* alpha,
-                                        const rocsparse_mat_descr      descr,
-                                        const rocsparse_float_complex* csr_val,
-                                        const rocsparse_int*           csr_row_ptr,
-                                        const rocsparse_int*           csr_col_ind,
-                                        rocsparse_float_complex*       B,
-                                        rocsparse_int                  ldb,
-                                        rocsparse_mat_info             info,
-                                        rocsparse_solve_policy         policy,
-                                        void*                          temp_buffer);
+rocsparse_status rocsparse_csellcmv(rocsparse_handle               handle,
+                                    rocsparse_operation            trans,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* sell_val,
+                                    const rocsparse_int*           sell_slice_ptr,
+                                    const rocsparse_int*           sell_col_ind,
+                                    const rocsparse_int*           sell_perm,
+                                    rocsparse_int                  sell_slice_size,
+                                    const rocsparse_float_complex* x,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrsm_solve(rocsparse_handle                handle,
-                                        rocsparse_operation             trans_A,
-                                        rocsparse_operation             trans_B,
-                                        rocsparse_int                   m,
-                                        rocsparse_int                   nrhs,
-                                        rocsparse_int                   nnz,
-                                        const rocsparse_double_complex* alpha,
-                                        const rocsparse_mat_descr       descr,
-                                        const rocsparse_double_complex* csr_val,
-                                        const rocsparse_int*            csr_row_ptr,
-                                        const rocsparse_int*            csr_col_ind,
-                                        rocsparse_double_complex*       B,
-                                        rocsparse_int                   ldb,
-                                        rocsparse_mat_info              info,
-                                        rocsparse_solve_policy          policy,
-                                        void*                           temp_buffer);
+rocsparse_status rocsparse_zsellcmv(rocsparse_handle                handle,
+                                    rocsparse_operation             trans,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* sell_val,
+                                    const rocsparse_int*            sell_slice_ptr,
+                                    const rocsparse_int*            sell_col_ind,
+                                    const rocsparse_int*            sell_perm,
+                                    rocsparse_int                   sell_slice_size,
+                                    const rocsparse_double_complex* x,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       y);
 /**@}*/
 
-/*! \ingroup level3_module
-*  \brief Dense matrix sparse matrix multiplication using CSR storage format
+/*! \ingroup level2_module
+*  \brief Sparse matrix vector multiplication using delta compressed CSR storage format
 *
 *  \details
-*  \p rocsparse_gemmi multiplies the scalar \f$\alpha\f$ with a dense \f$m \times k\f$
-*  matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$, defined in CSR
-*  storage format and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
-*  is multiplied by the scalar \f$\beta\f$, such that
+*  \p rocsparse_csrdeltamv multiplies the scalar \f$\alpha\f$ with a sparse
+*  \f$m \times n\f$ matrix, defined in delta compressed CSR storage format, and the dense
+*  vector \f$x\f$ and adds the result to the dense vector \f$y\f$ that is multiplied by
+*  the scalar \f$\beta\f$, such that
 *  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
 *  \f]
 *  with
 *  \f[
 *    op(A) = \left\{
 *    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
 *    \end{array}
 *    \right.
 *  \f]
 *
+*  The column indices are decoded on the fly from the packed offsets that have been
+*  computed by rocsparse_csr2csrdelta(). Compared to rocsparse_csrmv(), up to three
+*  quarters of the column index traffic are saved, which pays off for matrices where
+*  the performance is bound by memory bandwidth.
+*
+*  \code{.c}
+*      for(i = 0; i < m; ++i)
+*      {
+*          b     = i / block_dim;
+*          width = csrdelta_width[b];
+*          sum   = 0;
+*
+*          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+*          {
+*              // p-th offset of width bytes, packed from csrdelta_col_ind[csrdelta_block_ptr[b]]
+*              p   = j - csr_row_ptr[b * block_dim];
+*              col = csrdelta_row_col[i] + offset(b, width, p);
+*
+*              sum = sum + csr_val[j] * x[col];
+*          }
+*
+*          y[i] = alpha * sum + beta * y[i];
+*      }
+*  \endcode
+*
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
+*  \note
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle             handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A     matrix \f$A\f$ operation type.
+*  trans              matrix operation type.
 *  @param[in]
-*  trans_B     matrix \f$B\f$ operation type.
+*  m                  number of rows of the sparse CSR matrix.
 *  @param[in]
-*  m           number of rows of the dense matrix \f$A\f$.
+*  n                  number of columns of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix \f$op(B)\f$ and \f$C\f$.
+*  nnz                number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  k           number of columns of the dense matrix \f$A\f$.
+*  alpha              scalar \f$\alpha\f$.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  descr              descriptor of the sparse CSR matrix. Currently, only
+*                     \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  alpha       scalar \f$\alpha\f$.
+*  csr_val            array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  A           array of dimension \f$lda \times k\f$ (\f$op(A) == A\f$) or
-*              \f$lda \times m\f$ (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  csr_row_ptr        array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of \f$A\f$, must be at least \f$m\f$
-*              (\f$op(A) == A\f$) or \f$k\f$ (\f$op(A) == A^T\f$ or
-*              \f$op(A) == A^H\f$).
+*  block_dim          number of rows that share the width of their packed offsets.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix \f$B\f$. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  csrdelta_block_ptr array of \p nblocks+1 elements that point to the start of every
+*                     block of rows in \p csrdelta_col_ind, where
+*                     \f$\text{nblocks} = \lceil m / \text{block_dim} \rceil\f$.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix \f$B\f$.
+*  csrdelta_width     array of \p nblocks elements that contain the width of the packed
+*                     offsets of every block of rows in bytes.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix \f$B\f$.
+*  csrdelta_row_col   array of \p m elements that contain the first column index of
+*                     every row.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse CSR
-*              matrix \f$B\f$.
+*  csrdelta_col_ind   array that contains the packed column offsets.
 *  @param[in]
-*  beta        scalar \f$\beta\f$.
-*  @param[inout]
-*  C           array of dimension \f$ldc \times n\f$ that holds the values of \f$C\f$.
+*  x                  array of \p n elements (\f$op(A) == A\f$) or \p m elements
+*                     (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *  @param[in]
-*  ldc         leading dimension of \f$C\f$, must be at least \f$m\f$.
+*  beta               scalar \f$\beta\f$.
+*  @param[inout]
+*  y                  array of \p m elements (\f$op(A) == A\f$) or \p n elements
+*                     (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p lda or \p ldc
-*              is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p alpha, \p A, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p beta or \p C pointer is invalid.
-*
-*  \par Example
-*  This example multiplies a dense matrix with a CSC matrix.
-*  \code{.c}
-*      rocsparse_int m   = 2;
-*      rocsparse_int n   = 5;
-*      rocsparse_int k   = 3;
-*      rocsparse_int nnz = 8;
-*      rocsparse_int lda = m;
-*      rocsparse_int ldc = m;
-*
-*      // Matrix A (m x k)
-*      // (  9.0  10.0  11.0 )
-*      // ( 12.0  13.0  14.0 )
-*
-*      // Matrix B (k x n)
-*      // ( 1.0  2.0  0.0  3.0  0.0 )
-*      // ( 0.0  4.0  5.0  0.0  0.0 )
-*      // ( 6.0  0.0  0.0  7.0  8.0 )
-*
-*      // Matrix C (m x n)
-*      // ( 15.0  16.0  17.0  18.0  19.0 )
-*      // ( 20.0  21.0  22.0  23.0  24.0 )
-*
-*      A[lda * k]           = {9.0, 12.0, 10.0, 13.0, 11.0, 14.0};      // device memory
-*      csc_col_ptr_B[n + 1] = {0, 2, 4, 5, 7, 8};                       // device memory
-*      csc_row_ind_B[nnz]   = {0, 0, 1, 1, 2, 3, 3, 4};                 // device memory
-*      csc_val_B[nnz]       = {1.0, 6.0, 2.0, 4.0, 5.0, 3.0, 7.0, 8.0}; // device memory
-*      C[ldc * n]           = {15.0, 20.0, 16.0, 21.0, 17.0, 22.0,      // device memory
-*                              18.0, 23.0, 19.0, 24.0};
-*
-*      // alpha and beta
-*      float alpha = 1.0f;
-*      float beta  = 0.0f;
-*
-*      // Perform the matrix multiplication
-*      rocsparse_sgemmi(handle,
-*                       rocsparse_operation_none,
-*                       rocsparse_operation_transpose,
-*                       m,
-*                       n,
-*                       k,
-*                       nnz,
-*                       &alpha,
-*                       A,
-*                       lda,
-*                       descr_B,
-*                       csc_val_B,
-*                       csc_col_ptr_B,
-*                       csc_row_ind_B,
-*                       &beta,
-*                       C,
-*                       ldc);
-*  \endcode
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p block_dim is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+*              \p csr_row_ptr, \p csrdelta_block_ptr, \p csrdelta_width,
+*              \p csrdelta_row_col, \p csrdelta_col_ind, \p x, \p beta or \p y pointer is
+*              invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgemmi(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const float*              A,
-                                  rocsparse_int             lda,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const float*              beta,
-                                  float*                    C,
-                                  rocsparse_int             ldc);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgemmi(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const double*             A,
-                                  rocsparse_int             lda,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const double*             beta,
-                                  double*                   C,
-                                  rocsparse_int             ldc);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgemmi(rocsparse_handle               handle,
-                                  rocsparse_operation            trans_A,
-                                  rocsparse_operation            trans_B,
-                                  rocsparse_int                  m,
-                                  rocsparse_int                  n,
-                                  rocsparse_int                  k,
-                                  rocsparse_int                  nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_float_complex* A,
-                                  rocsparse_int                  lda,
-                                  const rocsparse_mat_descr      descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int*           csr_row_ptr,
-                                  const rocsparse_int*           csr_col_ind,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex*       C,
-                                  rocsparse_int                  ldc);
+rocsparse_status rocsparse_scsrdeltamv(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_int*      csrdelta_block_ptr,
+                                       const rocsparse_int*      csrdelta_width,
+                                       const rocsparse_int*      csrdelta_row_col,
+                                       const rocsparse_int*      csrdelta_col_ind,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgemmi(rocsparse_handle                handle,
-                                  rocsparse_operation             trans_A,
-                                  rocsparse_operation             trans_B,
-                                  rocsparse_int                   m,
-                                  rocsparse_int                   n,
-                                  rocsparse_int                   k,
-                                  rocsparse_int                   nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_double_complex* A,
-                                  rocsparse_int                   lda,
-                                  const rocsparse_mat_descr       descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int*            csr_row_ptr,
-                                  const rocsparse_int*            csr_col_ind,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex*       C,
-                                  rocsparse_int                   ldc);
+rocsparse_status rocsparse_dcsrdeltamv(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const double*             alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_int*      csrdelta_block_ptr,
+                                       const rocsparse_int*      csrdelta_width,
+                                       const rocsparse_int*      csrdelta_row_col,
+                                       const rocsparse_int*      csrdelta_col_ind,
+                                       const double*             x,
+                                       const double*             beta,
+                                       double*                   y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrdeltamv(rocsparse_handle               handle,
+                                       rocsparse_operation            trans,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  n,
+                                       rocsparse_int                  nnz,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr      descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int*           csr_row_ptr,
+                                       rocsparse_int                  block_dim,
+                                       const rocsparse_int*           csrdelta_block_ptr,
+                                       const rocsparse_int*           csrdelta_width,
+                                       const rocsparse_int*           csrdelta_row_col,
+                                       const rocsparse_int*           csrdelta_col_ind,
+                                       const rocsparse_float_complex* x,
+                                       const rocsparse_float_complex* beta,
+                                       rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrdeltamv(rocsparse_handle                handle,
+                                       rocsparse_operation             trans,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   n,
+                                       rocsparse_int                   nnz,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr       descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int*            csr_row_ptr,
+                                       rocsparse_int                   block_dim,
+                                       const rocsparse_int*            csrdelta_block_ptr,
+                                       const rocsparse_int*            csrdelta_width,
+                                       const rocsparse_int*            csrdelta_row_col,
+                                       const rocsparse_int*            csrdelta_col_ind,
+                                       const rocsparse_double_complex* x,
+                                       const rocsparse_double_complex* beta,
+                                       rocsparse_double_complex*       y);
 /**@}*/
 
 /*
 * ===========================================================================
-*    extra SPARSE
+*    level 3 SPARSE
 * ===========================================================================
 */
 
-/*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix addition using CSR storage format
-*
-*  \details
-*  \p rocsparse_csrgeam_nnz computes the total CSR non-zero elements and the CSR row
-*  offsets, that point to the start of every row of the sparse CSR matrix, of the
-*  resulting matrix C. It is assumed that \p csr_row_ptr_C has been allocated with
-*  size \p m + 1.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*  \note
-*  Currently, only \ref rocsparse_matrix_type_general is supported.
-*
-*  @param[in]
-*  handle          handle to the rocsparse library context queue.
-*  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
-*  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
-*  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
-*  @param[out]
-*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
-*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
-*
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
-*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
-*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
-*          \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       const rocsparse_mat_descr descr_A,
-                                       rocsparse_int             nnz_A,
-                                       const rocsparse_int*      csr_row_ptr_A,
-                                       const rocsparse_int*      csr_col_ind_A,
-                                       const rocsparse_mat_descr descr_B,
-                                       rocsparse_int             nnz_B,
-                                       const rocsparse_int*      csr_row_ptr_B,
-                                       const rocsparse_int*      csr_col_ind_B,
-                                       const rocsparse_mat_descr descr_C,
-                                       rocsparse_int*            csr_row_ptr_C,
-                                       rocsparse_int*            nnz_C);
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$mb \times kb\f$
+ *  matrix \f$A\f$, defined in BSR storage format, and the dense \f$k \times n\f$
+ *  matrix \f$B\f$ (where \f$k = block\_dim \times kb\f$) and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ (where \f$m = block\_dim \times mb\f$) that
+ *  is multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         the storage format of the blocks. Can be \ref rocsparse_direction_row or \ref rocsparse_direction_column.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type. Currently, only \ref rocsparse_operation_none is supported.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type. Currently, only \ref rocsparse_operation_none and rocsparse_operation_transpose
+ *              are supported.
+ *  @param[in]
+ *  mb          number of block rows of the sparse BSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  @param[in]
+ *  kb          number of block columns of the sparse BSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnzb        number of non-zero blocks of the sparse BSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  bsr_val     array of \p nnzb*block_dim*block_dim elements of the sparse BSR matrix \f$A\f$.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix \f$A\f$.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse
+ *              BSR matrix \f$A\f$.
+ *  @param[in]
+ *  block_dim   size of the blocks in the sparse BSR matrix.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+ *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$ where \f$k = block\_dim \times kb\f$.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$ where \f$m = block\_dim \times mb\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p n, \p kb, \p nnzb, \p ldb or \p ldc
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p bsr_val,
+ *              \p bsr_row_ptr, \p bsr_col_ind, \p B, \p beta or \p C pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none or
+ *              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example multiplies a BSR matrix with a dense matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0 0
+ *      // A = 0 4 5 0 0 0
+ *      //     0 0 0 7 8 0
+ *      //     0 0 1 2 4 1
+ *
+ *      rocsparse_int block_dim = 2;
+ *      rocsparse_int mb   = 2;
+ *      rocsparse_int kb   = 3;
+ *      rocsparse_int nnzb = 4;
+ *      rocsparse_direction dir = rocsparse_direction_row;
+ *
+ *      bsr_row_ptr[mb+1]                 = {0, 2, 4};                                        // device memory
+ *      bsr_col_ind[nnzb]                 = {0, 1, 1, 2};                                     // device memory
+ *      bsr_val[nnzb*block_dim*block_dim] = {1, 2, 0, 4, 0, 3, 5, 0, 0, 7, 1, 2, 8, 0, 4, 1}; // device memory
+ *
+ *      // Set dimension n of B
+ *      rocsparse_int n = 64;
+ *      rocsparse_int m = mb * block_dim;
+ *      rocsparse_int k = kb * block_dim;
+ *
+ *      // Allocate and generate dense matrix B
+ *      std::vector<float> hB(k * n);
+ *      for(rocsparse_int i = 0; i < k * n; ++i)
+ *      {
+ *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
+ *      }
+ *
+ *      // Copy B to the device
+ *      float* B;
+ *      hipMalloc((void**)&B, sizeof(float) * k * n);
+ *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
+ *
+ *      // alpha and beta
+ *      float alpha = 1.0f;
+ *      float beta  = 0.0f;
+ *
+ *      // Allocate memory for the resulting matrix C
+ *      float* C;
+ *      hipMalloc((void**)&C, sizeof(float) * m * n);
+ *
+ *      // Perform the matrix multiplication
+ *      rocsparse_sbsrmm(handle,
+ *                       dir,
+ *                       rocsparse_operation_none,
+ *                       rocsparse_operation_none,
+ *                       mb,
+ *                       n,
+ *                       kb,
+ *                       nnzb,
+ *                       &alpha,
+ *                       descr,
+ *                       bsr_val,
+ *                       bsr_row_ptr,
+ *                       bsr_col_ind,
+ *                       block_dim,
+ *                       B,
+ *                       k,
+ *                       &beta,
+ *                       C,
+ *                       m);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrmm(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             n,
+                                  rocsparse_int             kb,
+                                  rocsparse_int             nnzb,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
 
-/*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix addition using CSR storage format
-*
-*  \details
-*  \p rocsparse_csrgeam multiplies the scalar \f$\alpha\f$ with the sparse
-*  \f$m \times n\f$ matrix \f$A\f$, defined in CSR storage format, multiplies the
-*  scalar \f$\beta\f$ with the sparse \f$m \times n\f$ matrix \f$B\f$, defined in CSR
-*  storage format, and adds both resulting matrices to obtain the sparse
-*  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
-*  \f[
-*    C := \alpha \cdot A + \beta \cdot B.
-*  \f]
-*
-*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
-*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
-*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
-*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgeam_nnz().
-*
-*  \note Both scalars \f$\alpha\f$ and \f$beta\f$ have to be valid.
-*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
-*  \note This function is non blocking and executed asynchronously with respect to the
-*        host. It may return before the actual computation has finished.
-*
-*  @param[in]
-*  handle          handle to the rocsparse library context queue.
-*  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
-*  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
-*  @param[in]
-*  alpha           scalar \f$\alpha\f$.
-*  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  beta            scalar \f$\beta\f$.
-*  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrmm(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             n,
+                                  rocsparse_int             kb,
+                                  rocsparse_int             nnzb,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrmm(rocsparse_handle               handle,
+                                  rocsparse_direction            dir,
+                                  rocsparse_operation            trans_A,
+                                  rocsparse_operation            trans_B,
+                                  rocsparse_int                  mb,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  kb,
+                                  rocsparse_int                  nnzb,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* bsr_val,
+                                  const rocsparse_int*           bsr_row_ptr,
+                                  const rocsparse_int*           bsr_col_ind,
+                                  rocsparse_int                  block_dim,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int                  ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       C,
+                                  rocsparse_int                  ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrmm(rocsparse_handle                handle,
+                                  rocsparse_direction             dir,
+                                  rocsparse_operation             trans_A,
+                                  rocsparse_operation             trans_B,
+                                  rocsparse_int                   mb,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   kb,
+                                  rocsparse_int                   nnzb,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* bsr_val,
+                                  const rocsparse_int*            bsr_row_ptr,
+                                  const rocsparse_int*            bsr_col_ind,
+                                  rocsparse_int                   block_dim,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int                   ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       C,
+                                  rocsparse_int                   ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sparse matrix dense matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+*  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
+*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+*  is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  \code{.c}
+*      for(i = 0; i < ldc; ++i)
+*      {
+*          for(j = 0; j < n; ++j)
+*          {
+*              C[i][j] = beta * C[i][j];
+*
+*              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+*              {
+*                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
+*              }
+*          }
+*      }
+*  \endcode
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, \p trans_A != \ref rocsparse_operation_none is only supported for
+*  symmetric, Hermitian and triangular matrices.
+*
+*  \note
+*  For \ref rocsparse_matrix_type_symmetric, \ref rocsparse_matrix_type_hermitian and
+*  \ref rocsparse_matrix_type_triangular, only the triangle given by the
+*  \ref rocsparse_fill_mode of \p descr and the diagonal are accessed, and \p m must be
+*  equal to \p k. If the \ref rocsparse_diag_type is \ref rocsparse_diag_type_unit, the
+*  diagonal is assumed to be one. The transposed contribution of the stored triangle is
+*  accumulated using atomic operations.
+*
 *  @param[in]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
-*  @param[out]
-*  csr_col_ind_C   array of elements containing the column indices of the
-*                  sparse CSR matrix \f$C\f$.
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A     matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B     matrix \f$B\f$ operation type.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+*  @param[in]
+*  k           number of columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix \f$A\f$.
+*  @param[in]
+*  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+*              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+*  @param[in]
+*  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
+*              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
+*              \f$op(A) == A^H\f$).
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  C           array of dimension \f$ldc \times n\f$.
+*  @param[in]
+*  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
+*              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
+*              \f$op(A) == A^H\f$).
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
-*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
-*          \p csr_row_ptr_A, \p csr_col_ind_A, \p beta, \p descr_B, \p csr_val_B,
-*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
-*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A != \ref rocsparse_operation_none and
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_general, or
+*              \p trans_B == \ref rocsparse_operation_conjugate_transpose.
 *
 *  \par Example
-*  This example adds two CSR matrices.
+*  This example multiplies a CSR matrix with a dense matrix.
 *  \code{.c}
-*  // Initialize scalar multipliers
-*  float alpha = 1.0f;
-*  float beta  = 1.0f;
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
 *
-*  // Create matrix descriptors
-*  rocsparse_mat_descr descr_A;
-*  rocsparse_mat_descr descr_B;
-*  rocsparse_mat_descr descr_C;
+*      rocsparse_int m   = 3;
+*      rocsparse_int k   = 5;
+*      rocsparse_int nnz = 8;
 *
-*  rocsparse_create_mat_descr(&descr_A);
-*  rocsparse_create_mat_descr(&descr_B);
-*  rocsparse_create_mat_descr(&descr_C);
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
 *
-*  // Set pointer mode
-*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*      // Set dimension n of B
+*      rocsparse_int n = 64;
 *
-*  // Obtain number of total non-zero entries in C and row pointers of C
-*  rocsparse_int nnz_C;
-*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*      // Allocate and generate dense matrix B
+*      std::vector<float> hB(k * n);
+*      for(rocsparse_int i = 0; i < k * n; ++i)
+*      {
+*          hB[i] = static_cast<float>(rand()) / RAND_MAX;
+*      }
 *
-*  rocsparse_csrgeam_nnz(handle,
-*                        m,
-*                        n,
-*                        descr_A,
-*                        nnz_A,
-*                        csr_row_ptr_A,
-*                        csr_col_ind_A,
-*                        descr_B,
-*                        nnz_B,
-*                        csr_row_ptr_B,
-*                        csr_col_ind_B,
-*                        descr_C,
-*                        csr_row_ptr_C,
-*                        &nnz_C);
+*      // Copy B to the device
+*      float* B;
+*      hipMalloc((void**)&B, sizeof(float) * k * n);
+*      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
 *
-*  // Compute column indices and values of C
-*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
-*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*      // alpha and beta
+*      float alpha = 1.0f;
+*      float beta  = 0.0f;
 *
-*  rocsparse_scsrgeam(handle,
-*                     m,
-*                     n,
-*                     &alpha,
-*                     descr_A,
-*                     nnz_A,
-*                     csr_val_A,
-*                     csr_row_ptr_A,
-*                     csr_col_ind_A,
-*                     &beta,
-*                     descr_B,
-*                     nnz_B,
-*                     csr_val_B,
-*                     csr_row_ptr_B,
-*                     csr_col_ind_B,
-*                     descr_C,
-*                     csr_val_C,
-*                     csr_row_ptr_C,
-*                     csr_col_ind_C);
+*      // Allocate memory for the resulting matrix C
+*      float* C;
+*      hipMalloc((void**)&C, sizeof(float) * m * n);
+*
+*      // Perform the matrix multiplication
+*      rocsparse_scsrmm(handle,
+*                       rocsparse_operation_none,
+*                       rocsparse_operation_none,
+*                       m,
+*                       n,
+*                       k,
+*                       nnz,
+*                       &alpha,
+*                       descr,
+*                       csr_val,
+*                       csr_row_ptr,
+*                       csr_col_ind,
+*                       B,
+*                       k,
+*                       &beta,
+*                       C,
+*                       m);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const float*              alpha,
-                                    const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const float*              csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
-                                    const float*              beta,
-                                    const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const float*              csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
-                                    const rocsparse_mat_descr descr_C,
-                                    float*                    csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C);
+rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const double*             alpha,
-                                    const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const double*             csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
-                                    const double*             beta,
-                                    const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const double*             csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
-                                    const rocsparse_mat_descr descr_C,
-                                    double*                   csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C);
+rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgeam(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    const rocsparse_float_complex* alpha,
-                                    const rocsparse_mat_descr      descr_A,
-                                    rocsparse_int                  nnz_A,
-                                    const rocsparse_float_complex* csr_val_A,
-                                    const rocsparse_int*           csr_row_ptr_A,
-                                    const rocsparse_int*           csr_col_ind_A,
-                                    const rocsparse_float_complex* beta,
-                                    const rocsparse_mat_descr      descr_B,
-                                    rocsparse_int                  nnz_B,
-                                    const rocsparse_float_complex* csr_val_B,
-                                    const rocsparse_int*           csr_row_ptr_B,
-                                    const rocsparse_int*           csr_col_ind_B,
-                                    const rocsparse_mat_descr      descr_C,
-                                    rocsparse_float_complex*       csr_val_C,
-                                    const rocsparse_int*           csr_row_ptr_C,
-                                    rocsparse_int*                 csr_col_ind_C);
+rocsparse_status rocsparse_ccsrmm(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_A,
+                                  rocsparse_operation            trans_B,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int*           csr_row_ptr,
+                                  const rocsparse_int*           csr_col_ind,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int                  ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       C,
+                                  rocsparse_int                  ldc);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    const rocsparse_double_complex* alpha,
-                                    const rocsparse_mat_descr       descr_A,
-                                    rocsparse_int                   nnz_A,
-                                    const rocsparse_double_complex* csr_val_A,
-                                    const rocsparse_int*            csr_row_ptr_A,
-                                    const rocsparse_int*            csr_col_ind_A,
-                                    const rocsparse_double_complex* beta,
-                                    const rocsparse_mat_descr       descr_B,
-                                    rocsparse_int                   nnz_B,
-                                    const rocsparse_double_complex* csr_val_B,
-                                    const rocsparse_int*            csr_row_ptr_B,
-                                    const rocsparse_int*            csr_col_ind_B,
-                                    const rocsparse_mat_descr       descr_C,
-                                    rocsparse_double_complex*       csr_val_C,
-                                    const rocsparse_int*            csr_row_ptr_C,
-                                    rocsparse_int*                  csr_col_ind_C);
+rocsparse_status rocsparse_zcsrmm(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_A,
+                                  rocsparse_operation             trans_B,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*            csr_row_ptr,
+                                  const rocsparse_int*            csr_col_ind,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int                   ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       C,
+                                  rocsparse_int                   ldc);
 /**@}*/
 
-/*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(),
-*  rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and rocsparse_zcsrgemm(). The temporary
-*  storage buffer must be allocated by the user.
+*  \p rocsparse_csrsm_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrsm_solve(),
+*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() or rocsparse_zcsrsm_solve()
+*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
+*  using same index base as the CSR matrix.
 *
-*  \note
-*  Please note, that for matrix products with more than 4096 non-zero entries per row,
-*  additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
-*  supported.
-*  \note
-*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrsm_zero_pivot is a blocking function. It might influence
+*  performance negatively.
 *
 *  @param[in]
-*  handle          handle to the rocsparse library context queue.
-*  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int*     position);
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsm_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(), rocsparse_scsrsm_solve(),
+*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve(). The
+*  temporary storage buffer must be allocated by the user.
+*
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
+*  trans_A     matrix A operation type.
 *  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  trans_B     matrix B operation type.
 *  @param[in]
-*  alpha           scalar \f$\alpha\f$.
+*  m           number of rows of the sparse CSR matrix A.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  nrhs        number of columns of the dense matrix op(B).
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnz         number of non-zero entries of the sparse CSR matrix A.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
+*  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  descr       descriptor of the sparse CSR matrix A.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix A.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
-*  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
-*  @param[in]
-*  beta            scalar \f$\beta\f$.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix A.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  ldb         leading dimension of rhs matrix B.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
-*                  CSR matrix \f$D\f$.
-*  @param[inout]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  policy      \ref rocsparse_solve_policy_auto.
 *  @param[out]
-*  buffer_size     number of bytes of the temporary storage buffer required by
-*                  rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(), rocsparse_dcsrgemm(),
-*                  rocsparse_ccsrgemm() and rocsparse_zcsrgemm().
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*              rocsparse_ccsrsm_analysis(), rocsparse_zcsrsm_analysis(),
+*              rocsparse_scsrsm_solve(), rocsparse_dcsrsm_solve(),
+*              rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve().
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
-*          \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha is valid,
-*          \p descr_D, \p csr_row_ptr_D or \p csr_col_ind_D is invalid if \p beta is
-*          valid, \p info_C or \p buffer_size is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none,
-*          \p trans_B != \ref rocsparse_operation_none, or
-*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p buffer_size pointer
+*              is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgemm_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_operation       trans_A,
-                                                rocsparse_operation       trans_B,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                rocsparse_int             k,
-                                                const float*              alpha,
-                                                const rocsparse_mat_descr descr_A,
-                                                rocsparse_int             nnz_A,
-                                                const rocsparse_int*      csr_row_ptr_A,
-                                                const rocsparse_int*      csr_col_ind_A,
-                                                const rocsparse_mat_descr descr_B,
-                                                rocsparse_int             nnz_B,
-                                                const rocsparse_int*      csr_row_ptr_B,
-                                                const rocsparse_int*      csr_col_ind_B,
-                                                const float*              beta,
-                                                const rocsparse_mat_descr descr_D,
-                                                rocsparse_int             nnz_D,
-                                                const rocsparse_int*      csr_row_ptr_D,
-                                                const rocsparse_int*      csr_col_ind_D,
-                                                rocsparse_mat_info        info_C,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrsm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nrhs,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              B,
+                                              rocsparse_int             ldb,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_solve_policy    policy,
+                                              size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgemm_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_operation       trans_A,
-                                                rocsparse_operation       trans_B,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                rocsparse_int             k,
-                                                const double*             alpha,
-                                                const rocsparse_mat_descr descr_A,
-                                                rocsparse_int             nnz_A,
-                                                const rocsparse_int*      csr_row_ptr_A,
-                                                const rocsparse_int*      csr_col_ind_A,
-                                                const rocsparse_mat_descr descr_B,
-                                                rocsparse_int             nnz_B,
-                                                const rocsparse_int*      csr_row_ptr_B,
-                                                const rocsparse_int*      csr_col_ind_B,
-                                                const double*             beta,
-                                                const rocsparse_mat_descr descr_D,
-                                                rocsparse_int             nnz_D,
-                                                const rocsparse_int*      csr_row_ptr_D,
-                                                const rocsparse_int*      csr_col_ind_D,
-                                                rocsparse_mat_info        info_C,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsrsm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nrhs,
+                                              rocsparse_int             nnz,
+                                              const double*             alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const double*             B,
+                                              rocsparse_int             ldb,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_solve_policy    policy,
+                                              size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgemm_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_operation            trans_A,
-                                                rocsparse_operation            trans_B,
-                                                rocsparse_int                  m,
-                                                rocsparse_int                  n,
-                                                rocsparse_int                  k,
-                                                const rocsparse_float_complex* alpha,
-                                                const rocsparse_mat_descr      descr_A,
-                                                rocsparse_int                  nnz_A,
-                                                const rocsparse_int*           csr_row_ptr_A,
-                                                const rocsparse_int*           csr_col_ind_A,
-                                                const rocsparse_mat_descr      descr_B,
-                                                rocsparse_int                  nnz_B,
-                                                const rocsparse_int*           csr_row_ptr_B,
-                                                const rocsparse_int*           csr_col_ind_B,
-                                                const rocsparse_float_complex* beta,
-                                                const rocsparse_mat_descr      descr_D,
-                                                rocsparse_int                  nnz_D,
-                                                const rocsparse_int*           csr_row_ptr_D,
-                                                const rocsparse_int*           csr_col_ind_D,
-                                                rocsparse_mat_info             info_C,
-                                                size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsrsm_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_operation            trans_A,
+                                              rocsparse_operation            trans_B,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  nrhs,
+                                              rocsparse_int                  nnz,
+                                              const rocsparse_float_complex* alpha,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int*           csr_row_ptr,
+                                              const rocsparse_int*           csr_col_ind,
+                                              const rocsparse_float_complex* B,
+                                              rocsparse_int                  ldb,
+                                              rocsparse_mat_info             info,
+                                              rocsparse_solve_policy         policy,
+                                              size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_operation             trans_A,
-                                                rocsparse_operation             trans_B,
-                                                rocsparse_int                   m,
-                                                rocsparse_int                   n,
-                                                rocsparse_int                   k,
-                                                const rocsparse_double_complex* alpha,
-                                                const rocsparse_mat_descr       descr_A,
-                                                rocsparse_int                   nnz_A,
-                                                const rocsparse_int*            csr_row_ptr_A,
-                                                const rocsparse_int*            csr_col_ind_A,
-                                                const rocsparse_mat_descr       descr_B,
-                                                rocsparse_int                   nnz_B,
-                                                const rocsparse_int*            csr_row_ptr_B,
-                                                const rocsparse_int*            csr_col_ind_B,
-                                                const rocsparse_double_complex* beta,
-                                                const rocsparse_mat_descr       descr_D,
-                                                rocsparse_int                   nnz_D,
-                                                const rocsparse_int*            csr_row_ptr_D,
-                                                const rocsparse_int*            csr_col_ind_D,
-                                                rocsparse_mat_info              info_C,
-                                                size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsrsm_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_operation             trans_A,
+                                              rocsparse_operation             trans_B,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   nrhs,
+                                              rocsparse_int                   nnz,
+                                              const rocsparse_double_complex* alpha,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*            csr_row_ptr,
+                                              const rocsparse_int*            csr_col_ind,
+                                              const rocsparse_double_complex* B,
+                                              rocsparse_int                   ldb,
+                                              rocsparse_mat_info              info,
+                                              rocsparse_solve_policy          policy,
+                                              size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm_nnz computes the total CSR non-zero elements and the CSR row
-*  offsets, that point to the start of every row of the sparse CSR matrix, of the
-*  resulting multiplied matrix C. It is assumed that \p csr_row_ptr_C has been allocated
-*  with size \p m + 1.
-*  The required buffer size can be obtained by rocsparse_scsrgemm_buffer_size(),
-*  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() and
-*  rocsparse_zcsrgemm_buffer_size(), respectively.
+*  \p rocsparse_csrsm_analysis performs the analysis step for rocsparse_scsrsm_solve(),
+*  rocsparse_dcsrsm_solve(), rocsparse_ccsrsm_solve() and rocsparse_zcsrsm_solve(). It
+*  is expected that this function will be executed only once for a given matrix and
+*  particular operation type. The analysis meta data can be cleared by
+*  rocsparse_csrsm_clear().
+*
+*  \p rocsparse_csrsm_analysis can share its meta data with
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis() and rocsparse_zcsrsv_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
-*  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
-*  supported.
-*  \note
-*  Currently, only \ref rocsparse_matrix_type_general is supported.
 *
 *  @param[in]
-*  handle          handle to the rocsparse library context queue.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
+*  trans_A     matrix A operation type.
 *  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
+*  trans_B     matrix B operation type.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  m           number of rows of the sparse CSR matrix A.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
-*  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
-*  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
+*  nrhs        number of columns of the dense matrix op(B).
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  nnz         number of non-zero entries of the sparse CSR matrix A.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  descr       descriptor of the sparse CSR matrix A.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix A.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix A.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  ldb         leading dimension of rhs matrix B.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
-*                  CSR matrix \f$D\f$.
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
-*  @param[out]
-*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
-*                  matrix \f$C\f$.
+*  solve       \ref rocsparse_solve_policy_auto.
 *  @param[in]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p temp_buffer pointer
+*              is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              B,
+                                           rocsparse_int             ldb,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             B,
+                                           rocsparse_int             ldb,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsm_analysis(rocsparse_handle               handle,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_B,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  nrhs,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           csr_row_ptr,
+                                           const rocsparse_int*           csr_col_ind,
+                                           const rocsparse_float_complex* B,
+                                           rocsparse_int                  ldb,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_analysis_policy      analysis,
+                                           rocsparse_solve_policy         solve,
+                                           void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsm_analysis(rocsparse_handle                handle,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_B,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   nrhs,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            csr_row_ptr,
+                                           const rocsparse_int*            csr_col_ind,
+                                           const rocsparse_double_complex* B,
+                                           rocsparse_int                   ldb,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_analysis_policy       analysis,
+                                           rocsparse_solve_policy          solve,
+                                           void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsm_clear deallocates all memory that was allocated by
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(), rocsparse_ccsrsm_analysis()
+*  or rocsparse_zcsrsm_analysis(). This is especially useful, if memory is an issue and
+*  the analysis data is not required for further computation, e.g. when switching to
+*  another sparse matrix format. Calling \p rocsparse_csrsm_clear is optional. All
+*  allocated resources will be cleared, when the opaque \ref rocsparse_mat_info struct
+*  is destroyed using rocsparse_destroy_mat_info().
+*
 *  @param[in]
-*  temp_buffer     temporary storage buffer allocated by the user, size is returned
-*                  by rocsparse_scsrgemm_buffer_size(),
-*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
-*                  rocsparse_zcsrgemm_buffer_size().
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
-*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
-*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
-*          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
-*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
-*  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none,
-*          \p trans_B != \ref rocsparse_operation_none, or
-*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
-                                       rocsparse_operation       trans_A,
-                                       rocsparse_operation       trans_B,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       rocsparse_int             k,
-                                       const rocsparse_mat_descr descr_A,
-                                       rocsparse_int             nnz_A,
-                                       const rocsparse_int*      csr_row_ptr_A,
-                                       const rocsparse_int*      csr_col_ind_A,
-                                       const rocsparse_mat_descr descr_B,
-                                       rocsparse_int             nnz_B,
-                                       const rocsparse_int*      csr_row_ptr_B,
-                                       const rocsparse_int*      csr_col_ind_B,
-                                       const rocsparse_mat_descr descr_D,
-                                       rocsparse_int             nnz_D,
-                                       const rocsparse_int*      csr_row_ptr_D,
-                                       const rocsparse_int*      csr_col_ind_D,
-                                       const rocsparse_mat_descr descr_C,
-                                       rocsparse_int*            csr_row_ptr_C,
-                                       rocsparse_int*            nnz_C,
-                                       const rocsparse_mat_info  info_C,
-                                       void*                     temp_buffer);
+rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
-/*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using CSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm multiplies the scalar \f$\alpha\f$ with the sparse
-*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
-*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
-*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. The
-*  final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR
-*  storage format, such
-*  that
+*  \p rocsparse_csrsm_solve solves a sparse triangular linear system of a sparse
+*  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution matrix
+*  \f$X\f$ and the right-hand side matrix \f$B\f$ that is multiplied by \f$\alpha\f$, such that
 *  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*    op(A) \cdot op(X) = \alpha \cdot op(B),
 *  \f]
 *  with
 *  \f[
@@ -4530,7 +4807,7 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *    \end{array}
 *    \right.
 *  \f]
-*  and
+*  ,
 *  \f[
 *    op(B) = \left\{
 *    \begin{array}{ll}
@@ -4540,433 +4817,3482 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *    \end{array}
 *    \right.
 *  \f]
+*  and
+*  \f[
+*    op(X) = \left\{
+*    \begin{array}{ll}
+*        X,   & \text{if trans_B == rocsparse_operation_none} \\
+*        X^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        X^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
 *
-*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
-*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
-*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
-*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgemm_nnz(). The
-*  required buffer size for the computation can be obtained by
-*  rocsparse_scsrgemm_buffer_size(), rocsparse_dcsrgemm_buffer_size(),
-*  rocsparse_ccsrgemm_buffer_size() and rocsparse_zcsrgemm_buffer_size(), respectively.
+*  \p rocsparse_csrsm_solve requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrsm_buffer_size(), rocsparse_dcsrsm_buffer_size(),
+*  rocsparse_ccsrsm_buffer_size() or rocsparse_zcsrsm_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrsm_analysis(),
+*  rocsparse_dcsrsm_analysis(), rocsparse_ccsrsm_analysis() or
+*  rocsparse_zcsrsm_analysis(). \p rocsparse_csrsm_solve reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be checked calling
+*  rocsparse_csrsm_zero_pivot(). If
+*  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+*  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
 *
-*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
-*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be computed.
-*  \note \f$\alpha == beta == 0\f$ is invalid.
-*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
-*  \note This function is non blocking and executed asynchronously with respect to the
-*        host. It may return before the actual computation has finished.
-*  \note Please note, that for matrix products with more than 4096 non-zero entries per
-*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \p trans_A != \ref rocsparse_operation_conjugate_transpose and
+*  \p trans_B != \ref rocsparse_operation_conjugate_transpose is supported.
 *
 *  @param[in]
-*  handle          handle to the rocsparse library context queue.
-*  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
-*  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
-*  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
-*  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
-*  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
-*  @param[in]
-*  alpha           scalar \f$\alpha\f$.
-*  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
-*  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
-*  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  trans_A     matrix A operation type.
 *  @param[in]
-*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  trans_B     matrix B operation type.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
+*  m           number of rows of the sparse CSR matrix A.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  nrhs        number of columns of the dense matrix op(B).
 *  @param[in]
-*  beta            scalar \f$\beta\f$.
+*  nnz         number of non-zero entries of the sparse CSR matrix A.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  descr       descriptor of the sparse CSR matrix A.
 *  @param[in]
-*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix A.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix A.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
-*                  sparse CSR matrix \f$D\f$.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix A.
+*  @param[inout]
+*  B           array of \p m \f$\times\f$ \p nrhs elements of the rhs matrix B.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  ldb         leading dimension of rhs matrix B.
 *  @param[in]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
-*  @param[out]
-*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
-*                  sparse CSR matrix \f$C\f$.
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  policy      \ref rocsparse_solve_policy_auto.
 *  @param[in]
-*  temp_buffer     temporary storage buffer allocated by the user, size is returned
-*                  by rocsparse_scsrgemm_buffer_size(),
-*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
-*                  rocsparse_zcsrgemm_buffer_size().
+*  temp_buffer temporary storage buffer allocated by the user.
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
-*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
-*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
-*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
-*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
-*  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none,
-*          \p trans_B != \ref rocsparse_operation_none, or
-*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nrhs or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p B, \p info or \p temp_buffer pointer
+*              is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_B == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example multiplies two CSR matrices with a scalar alpha and adds the result to
-*  another CSR matrix.
+*  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
+*  storage format with unit diagonal. The following example solves \f$L \cdot X = B\f$.
 *  \code{.c}
-*  // Initialize scalar multipliers
-*  float alpha = 2.0f;
-*  float beta  = 1.0f;
-*
-*  // Create matrix descriptors
-*  rocsparse_mat_descr descr_A;
-*  rocsparse_mat_descr descr_B;
-*  rocsparse_mat_descr descr_C;
-*  rocsparse_mat_descr descr_D;
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
 *
-*  rocsparse_create_mat_descr(&descr_A);
-*  rocsparse_create_mat_descr(&descr_B);
-*  rocsparse_create_mat_descr(&descr_C);
-*  rocsparse_create_mat_descr(&descr_D);
+*      // Create matrix descriptor
+*      rocsparse_mat_descr descr;
+*      rocsparse_create_mat_descr(&descr);
+*      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
 *
-*  // Create matrix info structure
-*  rocsparse_mat_info info_C;
-*  rocsparse_create_mat_info(&info_C);
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
 *
-*  // Set pointer mode
-*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*      // Obtain required buffer size
+*      size_t buffer_size;
+*      rocsparse_dcsrsm_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nrhs,
+*                                   nnz,
+*                                   &alpha,
+*                                   descr,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   B,
+*                                   ldb,
+*                                   info,
+*                                   rocsparse_solve_policy_auto,
+*                                   &buffer_size);
 *
-*  // Query rocsparse for the required buffer size
-*  size_t buffer_size;
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
 *
-*  rocsparse_scsrgemm_buffer_size(handle,
-*                                 rocsparse_operation_none,
-*                                 rocsparse_operation_none,
-*                                 m,
-*                                 n,
-*                                 k,
-*                                 &alpha,
-*                                 descr_A,
-*                                 nnz_A,
-*                                 csr_row_ptr_A,
-*                                 csr_col_ind_A,
-*                                 descr_B,
-*                                 nnz_B,
-*                                 csr_row_ptr_B,
-*                                 csr_col_ind_B,
-*                                 &beta,
-*                                 descr_D,
-*                                 nnz_D,
-*                                 csr_row_ptr_D,
-*                                 csr_col_ind_D,
-*                                 info_C,
-*                                 &buffer_size);
+*      // Perform analysis step
+*      rocsparse_dcsrsm_analysis(handle,
+*                                rocsparse_operation_none,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nrhs,
+*                                nnz,
+*                                &alpha,
+*                                descr,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                B,
+*                                ldb,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
 *
-*  // Allocate buffer
-*  void* buffer;
-*  hipMalloc(&buffer, buffer_size);
+*      // Solve LX = B
+*      rocsparse_dcsrsm_solve(handle,
+*                             rocsparse_operation_none,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nrhs,
+*                             nnz,
+*                             &alpha,
+*                             descr,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             B,
+*                             ldb,
+*                             info,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
 *
-*  // Obtain number of total non-zero entries in C and row pointers of C
-*  rocsparse_int nnz_C;
-*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*      // No zero pivot should be found, with L having unit diagonal
 *
-*  rocsparse_csrgemm_nnz(handle,
-*                        rocsparse_operation_none,
-*                        rocsparse_operation_none,
-*                        m,
-*                        n,
-*                        k,
-*                        descr_A,
-*                        nnz_A,
-*                        csr_row_ptr_A,
-*                        csr_col_ind_A,
-*                        descr_B,
-*                        nnz_B,
-*                        csr_row_ptr_B,
-*                        csr_col_ind_B,
-*                        descr_D,
-*                        nnz_D,
-*                        csr_row_ptr_D,
-*                        csr_col_ind_D,
-*                        descr_C,
-*                        csr_row_ptr_C,
-*                        &nnz_C,
-*                        info_C,
-*                        buffer);
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans_A,
+                                        rocsparse_operation       trans_B,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        float*                    B,
+                                        rocsparse_int             ldb,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans_A,
+                                        rocsparse_operation       trans_B,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        double*                   B,
+                                        rocsparse_int             ldb,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsm_solve(rocsparse_handle               handle,
+                                        rocsparse_operation            trans_A,
+                                        rocsparse_operation            trans_B,
+                                        rocsparse_int                  m,
+                                        rocsparse_int                  nrhs,
+                                        rocsparse_int                  nnz,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr      descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int*           csr_row_ptr,
+                                        const rocsparse_int*           csr_col_ind,
+                                        rocsparse_float_complex*       B,
+                                        rocsparse_int                  ldb,
+                                        rocsparse_mat_info             info,
+                                        rocsparse_solve_policy         policy,
+                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsm_solve(rocsparse_handle                handle,
+                                        rocsparse_operation             trans_A,
+                                        rocsparse_operation             trans_B,
+                                        rocsparse_int                   m,
+                                        rocsparse_int                   nrhs,
+                                        rocsparse_int                   nnz,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int*            csr_row_ptr,
+                                        const rocsparse_int*            csr_col_ind,
+                                        rocsparse_double_complex*       B,
+                                        rocsparse_int                   ldb,
+                                        rocsparse_mat_info              info,
+                                        rocsparse_solve_policy          policy,
+                                        void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using BSR storage format
 *
-*  // Compute column indices and values of C
-*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
-*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*  \details
+*  \p rocsparse_bsrsm_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_sbsrsm_solve(),
+*  rocsparse_dbsrsm_solve(), rocsparse_cbsrsm_solve() or rocsparse_zbsrsm_solve()
+*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
+*  using same index base as the BSR matrix.
 *
-*  rocsparse_scsrgemm(handle,
-*                     rocsparse_operation_none,
-*                     rocsparse_operation_none,
-*                     m,
-*                     n,
-*                     k,
-*                     &alpha,
-*                     descr_A,
-*                     nnz_A,
-*                     csr_val_A,
-*                     csr_row_ptr_A,
-*                     csr_col_ind_A,
-*                     descr_B,
-*                     nnz_B,
-*                     csr_val_B,
-*                     csr_row_ptr_B,
-*                     csr_col_ind_B,
-*                     &beta,
-*                     descr_D,
-*                     nnz_D,
-*                     csr_val_D,
-*                     csr_row_ptr_D,
-*                     csr_col_ind_D,
-*                     descr_C,
-*                     csr_val_C,
-*                     csr_row_ptr_C,
-*                     csr_col_ind_C,
-*                     info_C,
-*                     buffer);
-*  \endcode
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_bsrsm_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrsm_zero_pivot(rocsparse_handle   handle,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int*     position);
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrsm_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+*  rocsparse_cbsrsm_analysis(), rocsparse_zbsrsm_analysis(), rocsparse_sbsrsm_solve(),
+*  rocsparse_dbsrsm_solve(), rocsparse_cbsrsm_solve() and rocsparse_zbsrsm_solve(). The
+*  temporary storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  dir         matrix storage of BSR blocks.
+*  @param[in]
+*  trans_A     matrix A operation type.
+*  @param[in]
+*  trans_X     matrix X operation type.
+*  @param[in]
+*  mb          number of block rows of the sparse BSR matrix A.
+*  @param[in]
+*  nrhs        number of columns of the dense matrix op(X).
+*  @param[in]
+*  nnzb        number of non-zero blocks of the sparse BSR matrix A.
+*  @param[in]
+*  descr       descriptor of the sparse BSR matrix A.
+*  @param[in]
+*  bsr_val     array of \p nnzb blocks of the sparse BSR matrix.
+*  @param[in]
+*  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+*              the sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind array of \p nnzb containing the block column indices of the sparse BSR
+*              matrix.
+*  @param[in]
+*  block_dim   block dimension of the sparse BSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+*              rocsparse_cbsrsm_analysis(), rocsparse_zbsrsm_analysis(),
+*              rocsparse_sbsrsm_solve(), rocsparse_dbsrsm_solve(),
+*              rocsparse_cbsrsm_solve() and rocsparse_zbsrsm_solve().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nrhs, \p nnzb or \p block_dim is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+*              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_X == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
-                                    rocsparse_operation       trans_A,
-                                    rocsparse_operation       trans_B,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    rocsparse_int             k,
-                                    const float*              alpha,
-                                    const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const float*              csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
-                                    const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const float*              csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
-                                    const float*              beta,
-                                    const rocsparse_mat_descr descr_D,
-                                    rocsparse_int             nnz_D,
-                                    const float*              csr_val_D,
-                                    const rocsparse_int*      csr_row_ptr_D,
-                                    const rocsparse_int*      csr_col_ind_D,
-                                    const rocsparse_mat_descr descr_C,
-                                    float*                    csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C,
-                                    const rocsparse_mat_info  info_C,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_sbsrsm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_X,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nrhs,
+                                              rocsparse_int             nnzb,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             block_dim,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrsm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_X,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nrhs,
+                                              rocsparse_int             nnzb,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             block_dim,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrsm_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_direction            dir,
+                                              rocsparse_operation            trans_A,
+                                              rocsparse_operation            trans_X,
+                                              rocsparse_int                  mb,
+                                              rocsparse_int                  nrhs,
+                                              rocsparse_int                  nnzb,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* bsr_val,
+                                              const rocsparse_int*           bsr_row_ptr,
+                                              const rocsparse_int*           bsr_col_ind,
+                                              rocsparse_int                  block_dim,
+                                              rocsparse_mat_info             info,
+                                              size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrsm_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_direction             dir,
+                                              rocsparse_operation             trans_A,
+                                              rocsparse_operation             trans_X,
+                                              rocsparse_int                   mb,
+                                              rocsparse_int                   nrhs,
+                                              rocsparse_int                   nnzb,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* bsr_val,
+                                              const rocsparse_int*            bsr_row_ptr,
+                                              const rocsparse_int*            bsr_col_ind,
+                                              rocsparse_int                   block_dim,
+                                              rocsparse_mat_info              info,
+                                              size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrsm_analysis performs the analysis step for rocsparse_sbsrsm_solve(),
+*  rocsparse_dbsrsm_solve(), rocsparse_cbsrsm_solve() and rocsparse_zbsrsm_solve(). It
+*  is expected that this function will be executed only once for a given matrix and
+*  particular operation type. The analysis meta data can be cleared by
+*  rocsparse_bsrsm_clear().
+*
+*  \p rocsparse_bsrsm_analysis can share its meta data with
+*  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+*  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+*  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+*  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+*  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+*  rocsparse_cbsrsv_analysis() and rocsparse_zbsrsv_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  dir         matrix storage of BSR blocks.
+*  @param[in]
+*  trans_A     matrix A operation type.
+*  @param[in]
+*  trans_X     matrix X operation type.
+*  @param[in]
+*  mb          number of block rows of the sparse BSR matrix A.
+*  @param[in]
+*  nrhs        number of columns of the dense matrix op(X).
+*  @param[in]
+*  nnzb        number of non-zero blocks of the sparse BSR matrix A.
+*  @param[in]
+*  descr       descriptor of the sparse BSR matrix A.
+*  @param[in]
+*  bsr_val     array of \p nnzb blocks of the sparse BSR matrix.
+*  @param[in]
+*  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+*              the sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind array of \p nnzb containing the block column indices of the sparse BSR
+*              matrix.
+*  @param[in]
+*  block_dim   block dimension of the sparse BSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nrhs, \p nnzb or \p block_dim is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+*              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_X == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrsm_analysis(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_X,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrsm_analysis(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_X,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrsm_analysis(rocsparse_handle               handle,
+                                           rocsparse_direction            dir,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_X,
+                                           rocsparse_int                  mb,
+                                           rocsparse_int                  nrhs,
+                                           rocsparse_int                  nnzb,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* bsr_val,
+                                           const rocsparse_int*           bsr_row_ptr,
+                                           const rocsparse_int*           bsr_col_ind,
+                                           rocsparse_int                  block_dim,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_analysis_policy      analysis,
+                                           rocsparse_solve_policy         solve,
+                                           void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrsm_analysis(rocsparse_handle                handle,
+                                           rocsparse_direction             dir,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_X,
+                                           rocsparse_int                   mb,
+                                           rocsparse_int                   nrhs,
+                                           rocsparse_int                   nnzb,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* bsr_val,
+                                           const rocsparse_int*            bsr_row_ptr,
+                                           const rocsparse_int*            bsr_col_ind,
+                                           rocsparse_int                   block_dim,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_analysis_policy       analysis,
+                                           rocsparse_solve_policy          solve,
+                                           void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrsm_clear deallocates all memory that was allocated by
+*  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(), rocsparse_cbsrsm_analysis()
+*  or rocsparse_zbsrsm_analysis(). This is especially useful, if memory is an issue and
+*  the analysis data is not required for further computation, e.g. when switching to
+*  another sparse matrix format. Calling \p rocsparse_bsrsm_clear is optional. All
+*  allocated resources will be cleared, when the opaque \ref rocsparse_mat_info struct
+*  is destroyed using rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrsm_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup level3_module
+*  \brief Sparse triangular system solve using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrsm_solve solves a sparse triangular linear system of a sparse
+*  \f$m \times m\f$ matrix, defined in BSR storage format, a dense solution matrix
+*  \f$X\f$ and the right-hand side matrix \f$B\f$ that is multiplied by \f$\alpha\f$, such that
+*  \f[
+*    op(A) \cdot op(X) = \alpha \cdot op(B),
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  ,
+*  \f[
+*    op(X) = \left\{
+*    \begin{array}{ll}
+*        X,   & \text{if trans_X == rocsparse_operation_none} \\
+*        X^T, & \text{if trans_X == rocsparse_operation_transpose} \\
+*        X^H, & \text{if trans_X == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and \f$op(B)\f$ defined accordingly, where \f$m = mb \cdot block\_dim\f$.
+*
+*  Each sweep over the block rows of the factor processes a chunk of up to 1024
+*  right-hand sides at once, such that the BSR blocks are read only once per chunk.
+*
+*  \p rocsparse_bsrsm_solve requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_sbsrsm_buffer_size(), rocsparse_dbsrsm_buffer_size(),
+*  rocsparse_cbsrsm_buffer_size() or rocsparse_zbsrsm_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_sbsrsm_analysis(),
+*  rocsparse_dbsrsm_analysis(), rocsparse_cbsrsm_analysis() or
+*  rocsparse_zbsrsm_analysis(). \p rocsparse_bsrsm_solve reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be checked calling
+*  rocsparse_bsrsm_zero_pivot(). If
+*  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+*  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+*
+*  \note
+*  The sparse BSR matrix has to be sorted.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \p trans_A != \ref rocsparse_operation_conjugate_transpose and
+*  \p trans_X != \ref rocsparse_operation_conjugate_transpose is supported.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  dir         matrix storage of BSR blocks.
+*  @param[in]
+*  trans_A     matrix A operation type.
+*  @param[in]
+*  trans_X     matrix X operation type.
+*  @param[in]
+*  mb          number of block rows of the sparse BSR matrix A.
+*  @param[in]
+*  nrhs        number of columns of the dense matrix op(X).
+*  @param[in]
+*  nnzb        number of non-zero blocks of the sparse BSR matrix A.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  descr       descriptor of the sparse BSR matrix A.
+*  @param[in]
+*  bsr_val     array of \p nnzb blocks of the sparse BSR matrix.
+*  @param[in]
+*  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of
+*              the sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind array of \p nnzb containing the block column indices of the sparse BSR
+*              matrix.
+*  @param[in]
+*  block_dim   block dimension of the sparse BSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  B           rhs matrix B with leading dimension \p ldb.
+*  @param[in]
+*  ldb         leading dimension of rhs matrix B.
+*  @param[out]
+*  X           solution matrix X with leading dimension \p ldx.
+*  @param[in]
+*  ldx         leading dimension of solution matrix X.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nrhs, \p nnzb, \p block_dim,
+*              \p ldb or \p ldx is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr, \p bsr_val,
+*              \p bsr_row_ptr, \p bsr_col_ind, \p B, \p X, \p info or \p temp_buffer
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*              \p trans_X == \ref rocsparse_operation_conjugate_transpose or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_operation       trans_A,
+                                        rocsparse_operation       trans_X,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnzb,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              bsr_val,
+                                        const rocsparse_int*      bsr_row_ptr,
+                                        const rocsparse_int*      bsr_col_ind,
+                                        rocsparse_int             block_dim,
+                                        rocsparse_mat_info        info,
+                                        const float*              B,
+                                        rocsparse_int             ldb,
+                                        float*                    X,
+                                        rocsparse_int             ldx,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_operation       trans_A,
+                                        rocsparse_operation       trans_X,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnzb,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             bsr_val,
+                                        const rocsparse_int*      bsr_row_ptr,
+                                        const rocsparse_int*      bsr_col_ind,
+                                        rocsparse_int             block_dim,
+                                        rocsparse_mat_info        info,
+                                        const double*             B,
+                                        rocsparse_int             ldb,
+                                        double*                   X,
+                                        rocsparse_int             ldx,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrsm_solve(rocsparse_handle               handle,
+                                        rocsparse_direction            dir,
+                                        rocsparse_operation            trans_A,
+                                        rocsparse_operation            trans_X,
+                                        rocsparse_int                  mb,
+                                        rocsparse_int                  nrhs,
+                                        rocsparse_int                  nnzb,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr      descr,
+                                        const rocsparse_float_complex* bsr_val,
+                                        const rocsparse_int*           bsr_row_ptr,
+                                        const rocsparse_int*           bsr_col_ind,
+                                        rocsparse_int                  block_dim,
+                                        rocsparse_mat_info             info,
+                                        const rocsparse_float_complex* B,
+                                        rocsparse_int                  ldb,
+                                        rocsparse_float_complex*       X,
+                                        rocsparse_int                  ldx,
+                                        rocsparse_solve_policy         policy,
+                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrsm_solve(rocsparse_handle                handle,
+                                        rocsparse_direction             dir,
+                                        rocsparse_operation             trans_A,
+                                        rocsparse_operation             trans_X,
+                                        rocsparse_int                   mb,
+                                        rocsparse_int                   nrhs,
+                                        rocsparse_int                   nnzb,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* bsr_val,
+                                        const rocsparse_int*            bsr_row_ptr,
+                                        const rocsparse_int*            bsr_col_ind,
+                                        rocsparse_int                   block_dim,
+                                        rocsparse_mat_info              info,
+                                        const rocsparse_double_complex* B,
+                                        rocsparse_int                   ldb,
+                                        rocsparse_double_complex*       X,
+                                        rocsparse_int                   ldx,
+                                        rocsparse_solve_policy          policy,
+                                        void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Dense matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_gemmi multiplies the scalar \f$\alpha\f$ with a dense \f$m \times k\f$
+*  matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$, defined in CSR
+*  storage format and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+*  is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A     matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B     matrix \f$B\f$ operation type.
+*  @param[in]
+*  m           number of rows of the dense matrix \f$A\f$.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix \f$op(B)\f$ and \f$C\f$.
+*  @param[in]
+*  k           number of columns of the dense matrix \f$A\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  A           array of dimension \f$lda \times k\f$ (\f$op(A) == A\f$) or
+*              \f$lda \times m\f$ (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  @param[in]
+*  lda         leading dimension of \f$A\f$, must be at least \f$m\f$
+*              (\f$op(A) == A\f$) or \f$k\f$ (\f$op(A) == A^T\f$ or
+*              \f$op(A) == A^H\f$).
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix \f$B\f$. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse CSR
+*              matrix \f$B\f$.
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  C           array of dimension \f$ldc \times n\f$ that holds the values of \f$C\f$.
+*  @param[in]
+*  ldc         leading dimension of \f$C\f$, must be at least \f$m\f$.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p lda or \p ldc
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p A, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p beta or \p C pointer is invalid.
+*
+*  \par Example
+*  This example multiplies a dense matrix with a CSC matrix.
+*  \code{.c}
+*      rocsparse_int m   = 2;
+*      rocsparse_int n   = 5;
+*      rocsparse_int k   = 3;
+*      rocsparse_int nnz = 8;
+*      rocsparse_int lda = m;
+*      rocsparse_int ldc = m;
+*
+*      // Matrix A (m x k)
+*      // (  9.0  10.0  11.0 )
+*      // ( 12.0  13.0  14.0 )
+*
+*      // Matrix B (k x n)
+*      // ( 1.0  2.0  0.0  3.0  0.0 )
+*      // ( 0.0  4.0  5.0  0.0  0.0 )
+*      // ( 6.0  0.0  0.0  7.0  8.0 )
+*
+*      // Matrix C (m x n)
+*      // ( 15.0  16.0  17.0  18.0  19.0 )
+*      // ( 20.0  21.0  22.0  23.0  24.0 )
+*
+*      A[lda * k]           = {9.0, 12.0, 10.0, 13.0, 11.0, 14.0};      // device memory
+*      csc_col_ptr_B[n + 1] = {0, 2, 4, 5, 7, 8};                       // device memory
+*      csc_row_ind_B[nnz]   = {0, 0, 1, 1, 2, 3, 3, 4};                 // device memory
+*      csc_val_B[nnz]       = {1.0, 6.0, 2.0, 4.0, 5.0, 3.0, 7.0, 8.0}; // device memory
+*      C[ldc * n]           = {15.0, 20.0, 16.0, 21.0, 17.0, 22.0,      // device memory
+*                              18.0, 23.0, 19.0, 24.0};
+*
+*      // alpha and beta
+*      float alpha = 1.0f;
+*      float beta  = 0.0f;
+*
+*      // Perform the matrix multiplication
+*      rocsparse_sgemmi(handle,
+*                       rocsparse_operation_none,
+*                       rocsparse_operation_transpose,
+*                       m,
+*                       n,
+*                       k,
+*                       nnz,
+*                       &alpha,
+*                       A,
+*                       lda,
+*                       descr_B,
+*                       csc_val_B,
+*                       csc_col_ptr_B,
+*                       csc_row_ind_B,
+*                       &beta,
+*                       C,
+*                       ldc);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgemmi(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const float*              A,
+                                  rocsparse_int             lda,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgemmi(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const double*             A,
+                                  rocsparse_int             lda,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgemmi(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_A,
+                                  rocsparse_operation            trans_B,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_float_complex* A,
+                                  rocsparse_int                  lda,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int*           csr_row_ptr,
+                                  const rocsparse_int*           csr_col_ind,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       C,
+                                  rocsparse_int                  ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgemmi(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_A,
+                                  rocsparse_operation             trans_B,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_double_complex* A,
+                                  rocsparse_int                   lda,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*            csr_row_ptr,
+                                  const rocsparse_int*            csr_col_ind,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       C,
+                                  rocsparse_int                   ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+*  \brief Sampled dense matrix dense matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsddmm multiplies the scalar \f$\alpha\f$ with the product of the dense
+*  \f$m \times k\f$ matrix \f$op(A)\f$ and the dense \f$k \times n\f$ matrix \f$op(B)\f$,
+*  sampled at the sparsity pattern of the \f$m \times n\f$ sparse matrix \f$C\f$, defined
+*  in CSR storage format, and adds the result to \f$C\f$ that is multiplied by the scalar
+*  \f$\beta\f$, such that
+*  \f[
+*    C := \alpha \cdot (op(A) \cdot op(B)) \circ spy(C) + \beta \cdot C
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  where \f$spy(C)\f$ is the sparsity pattern of \f$C\f$. Only the non-zero entries of
+*  \f$C\f$ are computed, the sparsity pattern of \f$C\f$ remains unchanged.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A     matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B     matrix \f$B\f$ operation type.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix \f$C\f$ and the dense matrix
+*              \f$op(A)\f$.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix \f$C\f$ and the dense matrix
+*              \f$op(B)\f$.
+*  @param[in]
+*  k           number of columns of the dense matrix \f$op(A)\f$ and rows of the dense
+*              matrix \f$op(B)\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  A           array of dimension \f$lda \times k\f$ (\f$op(A) == A\f$) or
+*              \f$lda \times m\f$ (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+*  @param[in]
+*  lda         leading dimension of \f$A\f$, must be at least \f$m\f$
+*              (\f$op(A) == A\f$) or \f$k\f$ (\f$op(A) == A^T\f$ or
+*              \f$op(A) == A^H\f$).
+*  @param[in]
+*  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+*              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+*  @param[in]
+*  ldb         leading dimension of \f$B\f$, must be at least \f$k\f$
+*              (\f$op(B) == B\f$) or \f$n\f$ (\f$op(B) == B^T\f$ or
+*              \f$op(B) == B^H\f$).
+*  @param[in]
+*  beta        scalar \f$\beta\f$.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix \f$C\f$. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse CSR
+*              matrix \f$C\f$.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p lda or \p ldb
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p A, \p B, \p beta, \p descr,
+*              \p csr_val, \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example computes the product of two dense matrices at the sparsity pattern of a
+*  CSR matrix.
+*  \code{.c}
+*      rocsparse_int m   = 2;
+*      rocsparse_int n   = 3;
+*      rocsparse_int k   = 2;
+*      rocsparse_int nnz = 3;
+*      rocsparse_int lda = m;
+*      rocsparse_int ldb = k;
+*
+*      // Matrix A (m x k)
+*      // ( 1.0  2.0 )
+*      // ( 3.0  4.0 )
+*
+*      // Matrix B (k x n)
+*      // ( 1.0  0.0  2.0 )
+*      // ( 0.0  1.0  1.0 )
+*
+*      // Sparsity pattern of C (m x n)
+*      // ( x  0  x )
+*      // ( 0  x  0 )
+*
+*      A[lda * k]         = {1.0, 3.0, 2.0, 4.0};           // device memory
+*      B[ldb * n]         = {1.0, 0.0, 0.0, 1.0, 2.0, 1.0}; // device memory
+*      csr_row_ptr[m + 1] = {0, 2, 3};                      // device memory
+*      csr_col_ind[nnz]   = {0, 2, 1};                      // device memory
+*      csr_val[nnz]       = {0.0, 0.0, 0.0};                // device memory
+*
+*      // alpha and beta
+*      float alpha = 1.0f;
+*      float beta  = 0.0f;
+*
+*      // Perform the sampled matrix multiplication
+*      rocsparse_scsrsddmm(handle,
+*                          rocsparse_operation_none,
+*                          rocsparse_operation_none,
+*                          m,
+*                          n,
+*                          k,
+*                          nnz,
+*                          &alpha,
+*                          A,
+*                          lda,
+*                          B,
+*                          ldb,
+*                          &beta,
+*                          descr,
+*                          csr_val,
+*                          csr_row_ptr,
+*                          csr_col_ind);
+*
+*      // csr_val = {1.0, 4.0, 4.0}
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsddmm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const float*              A,
+                                     rocsparse_int             lda,
+                                     const float*              B,
+                                     rocsparse_int             ldb,
+                                     const float*              beta,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsddmm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const double*             A,
+                                     rocsparse_int             lda,
+                                     const double*             B,
+                                     rocsparse_int             ldb,
+                                     const double*             beta,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsddmm(rocsparse_handle               handle,
+                                     rocsparse_operation            trans_A,
+                                     rocsparse_operation            trans_B,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     rocsparse_int                  k,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_float_complex* A,
+                                     rocsparse_int                  lda,
+                                     const rocsparse_float_complex* B,
+                                     rocsparse_int                  ldb,
+                                     const rocsparse_float_complex* beta,
+                                     const rocsparse_mat_descr      descr,
+                                     rocsparse_float_complex*       csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsddmm(rocsparse_handle                handle,
+                                     rocsparse_operation             trans_A,
+                                     rocsparse_operation             trans_B,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     rocsparse_int                   k,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_double_complex* A,
+                                     rocsparse_int                   lda,
+                                     const rocsparse_double_complex* B,
+                                     rocsparse_int                   ldb,
+                                     const rocsparse_double_complex* beta,
+                                     const rocsparse_mat_descr       descr,
+                                     rocsparse_double_complex*       csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind);
+/**@}*/
+
+/*
+* ===========================================================================
+*    extra SPARSE
+* ===========================================================================
+*/
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting matrix C. It is assumed that \p csr_row_ptr_C has been allocated with
+*  size \p m + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C);
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times n\f$ matrix \f$A\f$, defined in CSR storage format, multiplies the
+*  scalar \f$\beta\f$ with the sparse \f$m \times n\f$ matrix \f$B\f$, defined in CSR
+*  storage format, and adds both resulting matrices to obtain the sparse
+*  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
+*  \f[
+*    C := \alpha \cdot A + \beta \cdot B.
+*  \f]
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgeam_nnz().
+*
+*  \note Both scalars \f$\alpha\f$ and \f$beta\f$ have to be valid.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p beta, \p descr_B, \p csr_val_B,
+*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
+*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example adds two CSR matrices.
+*  \code{.c}
+*  // Initialize scalar multipliers
+*  float alpha = 1.0f;
+*  float beta  = 1.0f;
+*
+*  // Create matrix descriptors
+*  rocsparse_mat_descr descr_A;
+*  rocsparse_mat_descr descr_B;
+*  rocsparse_mat_descr descr_C;
+*
+*  rocsparse_create_mat_descr(&descr_A);
+*  rocsparse_create_mat_descr(&descr_B);
+*  rocsparse_create_mat_descr(&descr_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgeam_nnz(handle,
+*                        m,
+*                        n,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        descr_B,
+*                        nnz_B,
+*                        csr_row_ptr_B,
+*                        csr_col_ind_B,
+*                        descr_C,
+*                        csr_row_ptr_C,
+*                        &nnz_C);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgeam(handle,
+*                     m,
+*                     n,
+*                     &alpha,
+*                     descr_A,
+*                     nnz_A,
+*                     csr_val_A,
+*                     csr_row_ptr_A,
+*                     csr_col_ind_A,
+*                     &beta,
+*                     descr_B,
+*                     nnz_B,
+*                     csr_val_B,
+*                     csr_row_ptr_B,
+*                     csr_col_ind_B,
+*                     descr_C,
+*                     csr_val_C,
+*                     csr_row_ptr_C,
+*                     csr_col_ind_C);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgeam(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnz_B,
+                                    const rocsparse_float_complex* csr_val_B,
+                                    const rocsparse_int*           csr_row_ptr_B,
+                                    const rocsparse_int*           csr_col_ind_B,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       csr_val_C,
+                                    const rocsparse_int*           csr_row_ptr_C,
+                                    rocsparse_int*                 csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnz_B,
+                                    const rocsparse_double_complex* csr_val_B,
+                                    const rocsparse_int*            csr_row_ptr_B,
+                                    const rocsparse_int*            csr_col_ind_B,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       csr_val_C,
+                                    const rocsparse_int*            csr_row_ptr_C,
+                                    rocsparse_int*                  csr_col_ind_C);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(),
+*  rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and rocsparse_zcsrgemm(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  \note
+*  Please note, that for matrix products with more than 4096 non-zero entries per row,
+*  additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  Please note, that for matrix products with more than 8192 intermediate products per
+*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
+*                  CSR matrix \f$D\f$.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(), rocsparse_dcsrgemm(),
+*                  rocsparse_ccsrgemm() and rocsparse_zcsrgemm().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha is valid,
+*          \p descr_D, \p csr_row_ptr_D or \p csr_col_ind_D is invalid if \p beta is
+*          valid, \p info_C or \p buffer_size is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr_A,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_B,
+                                                rocsparse_int             nnz_B,
+                                                const rocsparse_int*      csr_row_ptr_B,
+                                                const rocsparse_int*      csr_col_ind_B,
+                                                const float*              beta,
+                                                const rocsparse_mat_descr descr_D,
+                                                rocsparse_int             nnz_D,
+                                                const rocsparse_int*      csr_row_ptr_D,
+                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_mat_info        info_C,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr_A,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_B,
+                                                rocsparse_int             nnz_B,
+                                                const rocsparse_int*      csr_row_ptr_B,
+                                                const rocsparse_int*      csr_col_ind_B,
+                                                const double*             beta,
+                                                const rocsparse_mat_descr descr_D,
+                                                rocsparse_int             nnz_D,
+                                                const rocsparse_int*      csr_row_ptr_D,
+                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_mat_info        info_C,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_operation            trans_A,
+                                                rocsparse_operation            trans_B,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  n,
+                                                rocsparse_int                  k,
+                                                const rocsparse_float_complex* alpha,
+                                                const rocsparse_mat_descr      descr_A,
+                                                rocsparse_int                  nnz_A,
+                                                const rocsparse_int*           csr_row_ptr_A,
+                                                const rocsparse_int*           csr_col_ind_A,
+                                                const rocsparse_mat_descr      descr_B,
+                                                rocsparse_int                  nnz_B,
+                                                const rocsparse_int*           csr_row_ptr_B,
+                                                const rocsparse_int*           csr_col_ind_B,
+                                                const rocsparse_float_complex* beta,
+                                                const rocsparse_mat_descr      descr_D,
+                                                rocsparse_int                  nnz_D,
+                                                const rocsparse_int*           csr_row_ptr_D,
+                                                const rocsparse_int*           csr_col_ind_D,
+                                                rocsparse_mat_info             info_C,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_operation             trans_A,
+                                                rocsparse_operation             trans_B,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   n,
+                                                rocsparse_int                   k,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr_A,
+                                                rocsparse_int                   nnz_A,
+                                                const rocsparse_int*            csr_row_ptr_A,
+                                                const rocsparse_int*            csr_col_ind_A,
+                                                const rocsparse_mat_descr       descr_B,
+                                                rocsparse_int                   nnz_B,
+                                                const rocsparse_int*            csr_row_ptr_B,
+                                                const rocsparse_int*            csr_col_ind_B,
+                                                const rocsparse_double_complex* beta,
+                                                const rocsparse_mat_descr       descr_D,
+                                                rocsparse_int                   nnz_D,
+                                                const rocsparse_int*            csr_row_ptr_D,
+                                                const rocsparse_int*            csr_col_ind_D,
+                                                rocsparse_mat_info              info_C,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting multiplied matrix C. It is assumed that \p csr_row_ptr_C has been allocated
+*  with size \p m + 1.
+*  The required buffer size can be obtained by rocsparse_scsrgemm_buffer_size(),
+*  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() and
+*  rocsparse_zcsrgemm_buffer_size(), respectively.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host,
+*  if the pointer mode is set to device. It may return before the actual computation has
+*  finished. If the pointer mode is set to host, it blocks until \p nnz_C is available.
+*  \note
+*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
+*                  CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_D,
+                                       rocsparse_int             nnz_D,
+                                       const rocsparse_int*      csr_row_ptr_D,
+                                       const rocsparse_int*      csr_col_ind_D,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C,
+                                       const rocsparse_mat_info  info_C,
+                                       void*                     temp_buffer);
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
+*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. The
+*  final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR
+*  storage format, such
+*  that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgemm_nnz(). The
+*  required buffer size for the computation can be obtained by
+*  rocsparse_scsrgemm_buffer_size(), rocsparse_dcsrgemm_buffer_size(),
+*  rocsparse_ccsrgemm_buffer_size() and rocsparse_zcsrgemm_buffer_size(), respectively.
+*
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*  \note Please note, that for matrix products with more than 4096 non-zero entries per
+*  row, additional temporary storage buffer is allocated by the algorithm.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
+*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example multiplies two CSR matrices with a scalar alpha and adds the result to
+*  another CSR matrix.
+*  \code{.c}
+*  // Initialize scalar multipliers
+*  float alpha = 2.0f;
+*  float beta  = 1.0f;
+*
+*  // Create matrix descriptors
+*  rocsparse_mat_descr descr_A;
+*  rocsparse_mat_descr descr_B;
+*  rocsparse_mat_descr descr_C;
+*  rocsparse_mat_descr descr_D;
+*
+*  rocsparse_create_mat_descr(&descr_A);
+*  rocsparse_create_mat_descr(&descr_B);
+*  rocsparse_create_mat_descr(&descr_C);
+*  rocsparse_create_mat_descr(&descr_D);
+*
+*  // Create matrix info structure
+*  rocsparse_mat_info info_C;
+*  rocsparse_create_mat_info(&info_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Query rocsparse for the required buffer size
+*  size_t buffer_size;
+*
+*  rocsparse_scsrgemm_buffer_size(handle,
+*                                 rocsparse_operation_none,
+*                                 rocsparse_operation_none,
+*                                 m,
+*                                 n,
+*                                 k,
+*                                 &alpha,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 descr_B,
+*                                 nnz_B,
+*                                 csr_row_ptr_B,
+*                                 csr_col_ind_B,
+*                                 &beta,
+*                                 descr_D,
+*                                 nnz_D,
+*                                 csr_row_ptr_D,
+*                                 csr_col_ind_D,
+*                                 info_C,
+*                                 &buffer_size);
+*
+*  // Allocate buffer
+*  void* buffer;
+*  hipMalloc(&buffer, buffer_size);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgemm_nnz(handle,
+*                        rocsparse_operation_none,
+*                        rocsparse_operation_none,
+*                        m,
+*                        n,
+*                        k,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        descr_B,
+*                        nnz_B,
+*                        csr_row_ptr_B,
+*                        csr_col_ind_B,
+*                        descr_D,
+*                        nnz_D,
+*                        csr_row_ptr_D,
+*                        csr_col_ind_D,
+*                        descr_C,
+*                        csr_row_ptr_C,
+*                        &nnz_C,
+*                        info_C,
+*                        buffer);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgemm(handle,
+*                     rocsparse_operation_none,
+*                     rocsparse_operation_none,
+*                     m,
+*                     n,
+*                     k,
+*                     &alpha,
+*                     descr_A,
+*                     nnz_A,
+*                     csr_val_A,
+*                     csr_row_ptr_A,
+*                     csr_col_ind_A,
+*                     descr_B,
+*                     nnz_B,
+*                     csr_val_B,
+*                     csr_row_ptr_B,
+*                     csr_col_ind_B,
+*                     &beta,
+*                     descr_D,
+*                     nnz_D,
+*                     csr_val_D,
+*                     csr_row_ptr_D,
+*                     csr_col_ind_D,
+*                     descr_C,
+*                     csr_val_C,
+*                     csr_row_ptr_C,
+*                     csr_col_ind_C,
+*                     info_C,
+*                     buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_D,
+                                    rocsparse_int             nnz_D,
+                                    const float*              csr_val_D,
+                                    const rocsparse_int*      csr_row_ptr_D,
+                                    const rocsparse_int*      csr_col_ind_D,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_D,
+                                    rocsparse_int             nnz_D,
+                                    const double*             csr_val_D,
+                                    const rocsparse_int*      csr_row_ptr_D,
+                                    const rocsparse_int*      csr_col_ind_D,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm(rocsparse_handle               handle,
+                                    rocsparse_operation            trans_A,
+                                    rocsparse_operation            trans_B,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnz_B,
+                                    const rocsparse_float_complex* csr_val_B,
+                                    const rocsparse_int*           csr_row_ptr_B,
+                                    const rocsparse_int*           csr_col_ind_B,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr_D,
+                                    rocsparse_int                  nnz_D,
+                                    const rocsparse_float_complex* csr_val_D,
+                                    const rocsparse_int*           csr_row_ptr_D,
+                                    const rocsparse_int*           csr_col_ind_D,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       csr_val_C,
+                                    const rocsparse_int*           csr_row_ptr_C,
+                                    rocsparse_int*                 csr_col_ind_C,
+                                    const rocsparse_mat_info       info_C,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                handle,
+                                    rocsparse_operation             trans_A,
+                                    rocsparse_operation             trans_B,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnz_B,
+                                    const rocsparse_double_complex* csr_val_B,
+                                    const rocsparse_int*            csr_row_ptr_B,
+                                    const rocsparse_int*            csr_col_ind_B,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr_D,
+                                    rocsparse_int                   nnz_D,
+                                    const rocsparse_double_complex* csr_val_D,
+                                    const rocsparse_int*            csr_row_ptr_D,
+                                    const rocsparse_int*            csr_col_ind_D,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       csr_val_C,
+                                    const rocsparse_int*            csr_row_ptr_C,
+                                    rocsparse_int*                  csr_col_ind_C,
+                                    const rocsparse_mat_info        info_C,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_symbolic computes the column indices of the resulting
+*  multiplied sparse CSR matrix C, such that repeated multiplications of matrices with
+*  the same sparsity patterns but different values can be performed by
+*  rocsparse_scsrgemm_numeric(), rocsparse_dcsrgemm_numeric(),
+*  rocsparse_ccsrgemm_numeric() and rocsparse_zcsrgemm_numeric(). The row offsets of C
+*  must have been computed by rocsparse_csrgemm_nnz() before. The grouping of the rows
+*  of C, that is required by the numeric phase, is stored in \p info_C.
+*  The required buffer size can be obtained by rocsparse_scsrgemm_buffer_size(),
+*  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() and
+*  rocsparse_zcsrgemm_buffer_size(), respectively.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*  \note
+*  Please note, that for matrix products with more than 4096 non-zero entries per row,
+*  additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
+*                  CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_C           number of non-zero entries of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B,
+*          \p nnz_D or \p nnz_C is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
+*          \p csr_row_ptr_C, \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows or the
+*          symbolic data could not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgemm_symbolic(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnz_D,
+                                            const rocsparse_int*      csr_row_ptr_D,
+                                            const rocsparse_int*      csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            rocsparse_int             nnz_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            rocsparse_mat_info        info_C,
+                                            void*                     temp_buffer);
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_numeric multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
+*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. The
+*  final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR
+*  storage format, such that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*  \f]
+*
+*  In contrast to rocsparse_scsrgemm(), rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and
+*  rocsparse_zcsrgemm(), only the values of C are computed. The sparsity pattern of C
+*  must have been computed by rocsparse_csrgemm_symbolic() before, using the same
+*  sparsity patterns of \f$A\f$, \f$B\f$ and \f$D\f$. Thus, repeated multiplications
+*  with changing values only require the numeric phase to be executed.
+*
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be
+*  computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_C           number of non-zero entries of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$, as computed by rocsparse_csrgemm_symbolic().
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B,
+*          \p nnz_D or \p nnz_C is invalid or does not match the symbolic phase.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
+*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid, or
+*          rocsparse_csrgemm_symbolic() has not been called for \p info_C.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example multiplies two CSR matrices repeatedly, where only the values of
+*  \f$A\f$ and \f$B\f$ change between the multiplications.
+*  \code{.c}
+*  // Obtain buffer size, number of total non-zero entries in C and row pointers of C
+*  // using rocsparse_scsrgemm_buffer_size() and rocsparse_csrgemm_nnz()
+*  // ...
+*
+*  // Compute column indices of C once
+*  rocsparse_csrgemm_symbolic(handle,
+*                             rocsparse_operation_none,
+*                             rocsparse_operation_none,
+*                             m,
+*                             n,
+*                             k,
+*                             descr_A,
+*                             nnz_A,
+*                             csr_row_ptr_A,
+*                             csr_col_ind_A,
+*                             descr_B,
+*                             nnz_B,
+*                             csr_row_ptr_B,
+*                             csr_col_ind_B,
+*                             descr_D,
+*                             0,
+*                             NULL,
+*                             NULL,
+*                             descr_C,
+*                             nnz_C,
+*                             csr_row_ptr_C,
+*                             csr_col_ind_C,
+*                             info_C,
+*                             buffer);
+*
+*  for(int i = 0; i < iter; ++i)
+*  {
+*      // Update values of A and B
+*      // ...
+*
+*      // Compute values of C
+*      rocsparse_scsrgemm_numeric(handle,
+*                                 rocsparse_operation_none,
+*                                 rocsparse_operation_none,
+*                                 m,
+*                                 n,
+*                                 k,
+*                                 &alpha,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_val_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 descr_B,
+*                                 nnz_B,
+*                                 csr_val_B,
+*                                 csr_row_ptr_B,
+*                                 csr_col_ind_B,
+*                                 NULL,
+*                                 descr_D,
+*                                 0,
+*                                 NULL,
+*                                 NULL,
+*                                 NULL,
+*                                 descr_C,
+*                                 nnz_C,
+*                                 csr_val_C,
+*                                 csr_row_ptr_C,
+*                                 csr_col_ind_C,
+*                                 info_C,
+*                                 buffer);
+*  }
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm_numeric(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const float*              alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const float*              csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const float*              csr_val_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const float*              beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnz_D,
+                                            const float*              csr_val_D,
+                                            const rocsparse_int*      csr_row_ptr_D,
+                                            const rocsparse_int*      csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            rocsparse_int             nnz_C,
+                                            float*                    csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            const rocsparse_int*      csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_numeric(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const double*             alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const double*             csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const double*             csr_val_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const double*             beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnz_D,
+                                            const double*             csr_val_D,
+                                            const rocsparse_int*      csr_row_ptr_D,
+                                            const rocsparse_int*      csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            rocsparse_int             nnz_C,
+                                            double*                   csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            const rocsparse_int*      csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_numeric(rocsparse_handle               handle,
+                                            rocsparse_operation            trans_A,
+                                            rocsparse_operation            trans_B,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  n,
+                                            rocsparse_int                  k,
+                                            const rocsparse_float_complex* alpha,
+                                            const rocsparse_mat_descr      descr_A,
+                                            rocsparse_int                  nnz_A,
+                                            const rocsparse_float_complex* csr_val_A,
+                                            const rocsparse_int*           csr_row_ptr_A,
+                                            const rocsparse_int*           csr_col_ind_A,
+                                            const rocsparse_mat_descr      descr_B,
+                                            rocsparse_int                  nnz_B,
+                                            const rocsparse_float_complex* csr_val_B,
+                                            const rocsparse_int*           csr_row_ptr_B,
+                                            const rocsparse_int*           csr_col_ind_B,
+                                            const rocsparse_float_complex* beta,
+                                            const rocsparse_mat_descr      descr_D,
+                                            rocsparse_int                  nnz_D,
+                                            const rocsparse_float_complex* csr_val_D,
+                                            const rocsparse_int*           csr_row_ptr_D,
+                                            const rocsparse_int*           csr_col_ind_D,
+                                            const rocsparse_mat_descr      descr_C,
+                                            rocsparse_int                  nnz_C,
+                                            rocsparse_float_complex*       csr_val_C,
+                                            const rocsparse_int*           csr_row_ptr_C,
+                                            const rocsparse_int*           csr_col_ind_C,
+                                            const rocsparse_mat_info       info_C,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_numeric(rocsparse_handle                handle,
+                                            rocsparse_operation             trans_A,
+                                            rocsparse_operation             trans_B,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   n,
+                                            rocsparse_int                   k,
+                                            const rocsparse_double_complex* alpha,
+                                            const rocsparse_mat_descr       descr_A,
+                                            rocsparse_int                   nnz_A,
+                                            const rocsparse_double_complex* csr_val_A,
+                                            const rocsparse_int*            csr_row_ptr_A,
+                                            const rocsparse_int*            csr_col_ind_A,
+                                            const rocsparse_mat_descr       descr_B,
+                                            rocsparse_int                   nnz_B,
+                                            const rocsparse_double_complex* csr_val_B,
+                                            const rocsparse_int*            csr_row_ptr_B,
+                                            const rocsparse_int*            csr_col_ind_B,
+                                            const rocsparse_double_complex* beta,
+                                            const rocsparse_mat_descr       descr_D,
+                                            rocsparse_int                   nnz_D,
+                                            const rocsparse_double_complex* csr_val_D,
+                                            const rocsparse_int*            csr_row_ptr_D,
+                                            const rocsparse_int*            csr_col_ind_D,
+                                            const rocsparse_mat_descr       descr_C,
+                                            rocsparse_int                   nnz_C,
+                                            rocsparse_double_complex*       csr_val_C,
+                                            const rocsparse_int*            csr_row_ptr_C,
+                                            const rocsparse_int*            csr_col_ind_C,
+                                            const rocsparse_mat_info        info_C,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*
+* ===========================================================================
+*    preconditioner SPARSE
+* ===========================================================================
+*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
+ *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
+ *  index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
+ *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
+ *  (numerical zero).
+ *
+ *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
+ *  storage buffer must be allocated by the user. The size of the temporary storage
+ *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
+ *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
+ *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
+ *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
+ *              and rocsparse_zbsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nnzb,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int*           bsr_row_ptr,
+                                               const rocsparse_int*           bsr_col_ind,
+                                               rocsparse_int                  block_dim,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nnzb,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int*            bsr_row_ptr,
+                                               const rocsparse_int*            bsr_col_ind,
+                                               rocsparse_int                   block_dim,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
+ *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
+ *  that this function will be executed only once for a given matrix and particular
+ *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
+ *
+ *  \p rocsparse_bsric0_analysis can share its meta data with
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+ *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
+ *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+ *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
+ *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
+ *  the analysis data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LL^T
+ *  \f]
+ *
+ *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
+ *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
+ *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
+ *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
+ *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[inout]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
+ *              or \p bsr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
+ *  storage format. The following example computes the incomplete Cholesky factorization
+ *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for L'
+ *      rocsparse_mat_descr descr_Lt;
+ *      rocsparse_create_mat_descr(&descr_Lt);
+ *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_Lt;
+ *      rocsparse_dbsric0_buffer_size(handle,
+ *                                     rocsparse_direction_row,
+ *                                     mb,
+ *                                     nnzb,
+ *                                     descr_M,
+ *                                     bsr_val,
+ *                                     bsr_row_ptr,
+ *                                     bsr_col_ind,
+ *                                     block_dim,
+ *                                     info,
+ *                                     &buffer_size_M);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_none,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_L,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_transpose,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_Lt,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_Lt);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dbsric0_analysis(handle,
+ *                                  rocsparse_direction_row,
+ *                                  mb,
+ *                                  nnzb,
+ *                                  descr_M,
+ *                                  bsr_val,
+ *                                  bsr_row_ptr,
+ *                                  bsr_col_ind,
+ *                                  block_dim,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_none,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_L,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_transpose,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_Lt,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete Cholesky factorization M = LL'
+ *      rocsparse_dbsric0(handle,
+ *                         rocsparse_direction_row,
+ *                         mb,
+ *                         nnzb,
+ *                         descr_M,
+ *                         bsr_val,
+ *                         bsr_row_ptr,
+ *                         bsr_col_ind,
+ *                         block_dim,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_none,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_L,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve L'y = z
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_transpose,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_Lt,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_Lt);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
-                                    rocsparse_operation       trans_A,
-                                    rocsparse_operation       trans_B,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    rocsparse_int             k,
-                                    const double*             alpha,
-                                    const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const double*             csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
-                                    const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const double*             csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
-                                    const double*             beta,
-                                    const rocsparse_mat_descr descr_D,
-                                    rocsparse_int             nnz_D,
-                                    const double*             csr_val_D,
-                                    const rocsparse_int*      csr_row_ptr_D,
-                                    const rocsparse_int*      csr_col_ind_D,
-                                    const rocsparse_mat_descr descr_C,
-                                    double*                   csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C,
-                                    const rocsparse_mat_info  info_C,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgemm(rocsparse_handle               handle,
-                                    rocsparse_operation            trans_A,
-                                    rocsparse_operation            trans_B,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    rocsparse_int                  k,
-                                    const rocsparse_float_complex* alpha,
-                                    const rocsparse_mat_descr      descr_A,
-                                    rocsparse_int                  nnz_A,
-                                    const rocsparse_float_complex* csr_val_A,
-                                    const rocsparse_int*           csr_row_ptr_A,
-                                    const rocsparse_int*           csr_col_ind_A,
-                                    const rocsparse_mat_descr      descr_B,
-                                    rocsparse_int                  nnz_B,
-                                    const rocsparse_float_complex* csr_val_B,
-                                    const rocsparse_int*           csr_row_ptr_B,
-                                    const rocsparse_int*           csr_col_ind_B,
-                                    const rocsparse_float_complex* beta,
-                                    const rocsparse_mat_descr      descr_D,
-                                    rocsparse_int                  nnz_D,
-                                    const rocsparse_float_complex* csr_val_D,
-                                    const rocsparse_int*           csr_row_ptr_D,
-                                    const rocsparse_int*           csr_col_ind_D,
-                                    const rocsparse_mat_descr      descr_C,
-                                    rocsparse_float_complex*       csr_val_C,
-                                    const rocsparse_int*           csr_row_ptr_C,
-                                    rocsparse_int*                 csr_col_ind_C,
-                                    const rocsparse_mat_info       info_C,
-                                    void*                          temp_buffer);
+rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                handle,
-                                    rocsparse_operation             trans_A,
-                                    rocsparse_operation             trans_B,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    rocsparse_int                   k,
-                                    const rocsparse_double_complex* alpha,
-                                    const rocsparse_mat_descr       descr_A,
-                                    rocsparse_int                   nnz_A,
-                                    const rocsparse_double_complex* csr_val_A,
-                                    const rocsparse_int*            csr_row_ptr_A,
-                                    const rocsparse_int*            csr_col_ind_A,
-                                    const rocsparse_mat_descr       descr_B,
-                                    rocsparse_int                   nnz_B,
-                                    const rocsparse_double_complex* csr_val_B,
-                                    const rocsparse_int*            csr_row_ptr_B,
-                                    const rocsparse_int*            csr_col_ind_B,
-                                    const rocsparse_double_complex* beta,
-                                    const rocsparse_mat_descr       descr_D,
-                                    rocsparse_int                   nnz_D,
-                                    const rocsparse_double_complex* csr_val_D,
-                                    const rocsparse_int*            csr_row_ptr_D,
-                                    const rocsparse_int*            csr_col_ind_D,
-                                    const rocsparse_mat_descr       descr_C,
-                                    rocsparse_double_complex*       csr_val_C,
-                                    const rocsparse_int*            csr_row_ptr_C,
-                                    rocsparse_int*                  csr_col_ind_C,
-                                    const rocsparse_mat_info        info_C,
-                                    void*                           temp_buffer);
+rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 /**@}*/
 
-/*
-* ===========================================================================
-*    preconditioner SPARSE
-* ===========================================================================
-*/
-
 /*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
+ *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
  *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
  *  index base as the BSR matrix.
  *
  *  \p position can be in host or device memory. If no zero pivot has been found,
  *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
  *
- *  \note
- *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
- *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
- *  (numerical zero).
+ *  \note
+ *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
+ *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
+ *  invertible (numerical zero).
+ *
+ *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
  *
- *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
+ *  \note \p tol and \p boost_val can be in host or device memory.
  *
  *  @param[in]
- *  handle      handle to the rocsparse library context queue.
+ *  handle          handle to the rocsparse library context queue.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
+rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
+ *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
  *  storage buffer must be allocated by the user. The size of the temporary storage
  *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
  *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
- *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
+ *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
  *  allocated buffer can thus be shared between subsequent calls to those functions.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  dir 	    direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
  *              \ref rocsparse_direction_row.
  *  @param[in]
  *  mb          number of block rows in the sparse BSR matrix.
@@ -4987,10 +8313,10 @@ rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
  *  info        structure that holds the information collected during the analysis step.
  *  @param[in]
  *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
- *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
- *              and rocsparse_zbsric0().
+ *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
+ *              and rocsparse_zbsrilu0().
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
@@ -5003,71 +8329,71 @@ rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_direction            dir,
-                                               rocsparse_int                  mb,
-                                               rocsparse_int                  nnzb,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* bsr_val,
-                                               const rocsparse_int*           bsr_row_ptr,
-                                               const rocsparse_int*           bsr_col_ind,
-                                               rocsparse_int                  block_dim,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
+rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* bsr_val,
+                                                const rocsparse_int*           bsr_row_ptr,
+                                                const rocsparse_int*           bsr_col_ind,
+                                                rocsparse_int                  block_dim,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_direction             dir,
-                                               rocsparse_int                   mb,
-                                               rocsparse_int                   nnzb,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* bsr_val,
-                                               const rocsparse_int*            bsr_row_ptr,
-                                               const rocsparse_int*            bsr_col_ind,
-                                               rocsparse_int                   block_dim,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
+rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* bsr_val,
+                                                const rocsparse_int*            bsr_row_ptr,
+                                                const rocsparse_int*            bsr_col_ind,
+                                                rocsparse_int                   block_dim,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
- *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
- *  that this function will be executed only once for a given matrix and particular
- *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
+ *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
+ *  that this function will be executed only once for a given matrix. The analysis meta
+ *  data can be cleared by rocsparse_bsrilu0_clear().
  *
- *  \p rocsparse_bsric0_analysis can share its meta data with
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *  \p rocsparse_bsrilu0_analysis can share its meta data with
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
  *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
  *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
  *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
@@ -5087,8 +8413,8 @@ rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                h
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
  *  @param[in]
  *  mb          number of block rows in the sparse BSR matrix.
  *  @param[in]
@@ -5126,78 +8452,78 @@ rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                h
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
-                                            rocsparse_direction            dir,
-                                            rocsparse_int                  mb,
-                                            rocsparse_int                  nnzb,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* bsr_val,
-                                            const rocsparse_int*           bsr_row_ptr,
-                                            const rocsparse_int*           bsr_col_ind,
-                                            rocsparse_int                  block_dim,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
-                                            rocsparse_direction             dir,
-                                            rocsparse_int                   mb,
-                                            rocsparse_int                   nnzb,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* bsr_val,
-                                            const rocsparse_int*            bsr_row_ptr,
-                                            const rocsparse_int*            bsr_col_ind,
-                                            rocsparse_int                   block_dim,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
+rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
- *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
+ *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
+ *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
  *  the analysis data is not required for further computation.
  *
  *  \note
- *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
+ *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
  *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
  *  rocsparse_destroy_mat_info().
  *
@@ -5214,26 +8540,27 @@ rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                hand
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
- *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
  *  \f[
- *    A \approx LL^T
+ *    A \approx LU
  *  \f]
  *
- *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
- *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
- *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
- *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
- *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
+ *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
+ *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
+ *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
+ *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_bsrilu0_zero_pivot().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -5242,8 +8569,8 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
  *  @param[in]
  *  mb          number of block rows in the sparse BSR matrix.
  *  @param[in]
@@ -5278,8 +8605,8 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *
  *  \par Example
  *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete Cholesky factorization
- *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
  *  \code{.c}
  *      // Create rocSPARSE handle
  *      rocsparse_handle handle;
@@ -5295,11 +8622,11 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
  *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
  *
- *      // Create matrix descriptor for L'
- *      rocsparse_mat_descr descr_Lt;
- *      rocsparse_create_mat_descr(&descr_Lt);
- *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
  *
  *      // Create matrix info structure
  *      rocsparse_mat_info info;
@@ -5308,8 +8635,8 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *      // Obtain required buffer size
  *      size_t buffer_size_M;
  *      size_t buffer_size_L;
- *      size_t buffer_size_Lt;
- *      rocsparse_dbsric0_buffer_size(handle,
+ *      size_t buffer_size_U;
+ *      rocsparse_dbsrilu0_buffer_size(handle,
  *                                     rocsparse_direction_row,
  *                                     mb,
  *                                     nnzb,
@@ -5337,15 +8664,15 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *                                   rocsparse_operation_transpose,
  *                                   mb,
  *                                   nnzb,
- *                                   descr_Lt,
+ *                                   descr_U,
  *                                   bsr_val,
  *                                   bsr_row_ptr,
  *                                   bsr_col_ind,
  *                                   block_dim,
  *                                   info,
- *                                   &buffer_size_Lt);
+ *                                   &buffer_size_U);
  *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
  *
  *      // Allocate temporary buffer
  *      void* temp_buffer;
@@ -5353,7 +8680,7 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *
  *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
  *      // computation performance
- *      rocsparse_dbsric0_analysis(handle,
+ *      rocsparse_dbsrilu0_analysis(handle,
  *                                  rocsparse_direction_row,
  *                                  mb,
  *                                  nnzb,
@@ -5385,7 +8712,7 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *                                rocsparse_operation_transpose,
  *                                mb,
  *                                nnzb,
- *                                descr_Lt,
+ *                                descr_U,
  *                                bsr_val,
  *                                bsr_row_ptr,
  *                                bsr_col_ind,
@@ -5397,15 +8724,15 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *
  *      // Check for zero pivot
  *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
  *                                                                    info,
  *                                                                    &position))
  *      {
  *          printf("A has structural zero at A(%d,%d)\n", position, position);
  *      }
  *
- *      // Compute incomplete Cholesky factorization M = LL'
- *      rocsparse_dbsric0(handle,
+ *      // Compute incomplete LU factorization M = LU
+ *      rocsparse_dbsrilu0(handle,
  *                         rocsparse_direction_row,
  *                         mb,
  *                         nnzb,
@@ -5419,7 +8746,7 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *                         temp_buffer);
  *
  *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
  *                                                                     info,
  *                                                                     &position))
  *      {
@@ -5446,14 +8773,14 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *                             rocsparse_solve_policy_auto,
  *                             temp_buffer);
  *
- *      // Solve L'y = z
+ *      // Solve Uy = z
  *      rocsparse_dbsrsv_solve(handle,
  *                             rocsparse_direction_row,
  *                             rocsparse_operation_transpose,
  *                             mb,
  *                             nnzb,
  *                             &alpha,
- *                             descr_Lt,
+ *                             descr_U,
  *                             bsr_val,
  *                             bsr_row_ptr,
  *                             bsr_col_ind,
@@ -5469,804 +8796,1045 @@ rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_i
  *      rocsparse_destroy_mat_info(info);
  *      rocsparse_destroy_mat_descr(descr_M);
  *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_Lt);
+ *      rocsparse_destroy_mat_descr(descr_U);
  *      rocsparse_destroy_handle(handle);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-/**@}*/
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
- *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
- *  index base as the BSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note
- *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
- *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
- *  invertible (numerical zero).
- *
- *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
+rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsric0() or
+*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+*  is stored in \p position, using same index base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+*  be allocated by the user. The size of the temporary storage buffer is identical to
+*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
+*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
+*  sparsity pattern is identical. The user allocated buffer can thus be shared between
+*  subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*              rocsparse_scsric0() and rocsparse_dcsric0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
+rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
- *  storage buffer must be allocated by the user. The size of the temporary storage
- *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
- *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
- *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
- *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
- *              and rocsparse_zbsrilu0().
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+*  and rocsparse_dcsric0(). It is expected that this function will be executed only
+*  once for a given matrix and particular operation type. The analysis meta data can be
+*  cleared by rocsparse_csric0_clear().
+*
+*  \p rocsparse_csric0_analysis can share its meta data with
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_direction            dir,
-                                                rocsparse_int                  mb,
-                                                rocsparse_int                  nnzb,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* bsr_val,
-                                                const rocsparse_int*           bsr_row_ptr,
-                                                const rocsparse_int*           bsr_col_ind,
-                                                rocsparse_int                  block_dim,
-                                                rocsparse_mat_info             info,
-                                                size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_direction             dir,
-                                                rocsparse_int                   mb,
-                                                rocsparse_int                   nnzb,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* bsr_val,
-                                                const rocsparse_int*            bsr_row_ptr,
-                                                const rocsparse_int*            bsr_col_ind,
-                                                rocsparse_int                   block_dim,
-                                                rocsparse_mat_info              info,
-                                                size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
- *  that this function will be executed only once for a given matrix. The analysis meta
- *  data can be cleared by rocsparse_bsrilu0_clear().
- *
- *  \p rocsparse_bsrilu0_analysis can share its meta data with
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
- *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
- *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
- *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
- *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
- *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
- *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LL^T
+*  \f]
+*
+*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csric0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete Cholesky factorization
+*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for L'
+*      rocsparse_mat_descr descr_Lt;
+*      rocsparse_create_mat_descr(&descr_Lt);
+*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_Lt;
+*      rocsparse_dcsric0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_transpose,
+*                                   m,
+*                                   nnz,
+*                                   descr_Lt,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_Lt);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsric0_analysis(handle,
+*                                 m,
+*                                 nnz,
+*                                 descr_M,
+*                                 csr_val,
+*                                 csr_row_ptr,
+*                                 csr_col_ind,
+*                                 info,
+*                                 rocsparse_analysis_policy_reuse,
+*                                 rocsparse_solve_policy_auto,
+*                                 temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_transpose,
+*                                m,
+*                                nnz,
+*                                descr_Lt,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete Cholesky factorization M = LL'
+*      rocsparse_dcsric0(handle,
+*                        m,
+*                        nnz,
+*                        descr_M,
+*                        csr_val,
+*                        csr_row_ptr,
+*                        csr_col_ind,
+*                        info,
+*                        rocsparse_solve_policy_auto,
+*                        temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve L'y = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_transpose,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_Lt,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_Lt);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_direction            dir,
-                                             rocsparse_int                  mb,
-                                             rocsparse_int                  nnzb,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* bsr_val,
-                                             const rocsparse_int*           bsr_row_ptr,
-                                             const rocsparse_int*           bsr_col_ind,
-                                             rocsparse_int                  block_dim,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
+rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_direction             dir,
-                                             rocsparse_int                   mb,
-                                             rocsparse_int                   nnzb,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* bsr_val,
-                                             const rocsparse_int*            bsr_row_ptr,
-                                             const rocsparse_int*            bsr_col_ind,
-                                             rocsparse_int                   block_dim,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
- *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
- *  the analysis data is not required for further computation.
- *
- *  \note
- *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
- *  \f[
- *    A \approx LU
- *  \f]
- *
- *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
- *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
- *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
- *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_bsrilu0_zero_pivot().
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[inout]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
- *              or \p bsr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
- *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
- *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dbsrilu0_buffer_size(handle,
- *                                     rocsparse_direction_row,
- *                                     mb,
- *                                     nnzb,
- *                                     descr_M,
- *                                     bsr_val,
- *                                     bsr_row_ptr,
- *                                     bsr_col_ind,
- *                                     block_dim,
- *                                     info,
- *                                     &buffer_size_M);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_none,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_L,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_transpose,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_U,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_U);
- *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dbsrilu0_analysis(handle,
- *                                  rocsparse_direction_row,
- *                                  mb,
- *                                  nnzb,
- *                                  descr_M,
- *                                  bsr_val,
- *                                  bsr_row_ptr,
- *                                  bsr_col_ind,
- *                                  block_dim,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_none,
- *                                mb,
- *                                nnzb,
- *                                descr_L,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_transpose,
- *                                mb,
- *                                nnzb,
- *                                descr_U,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
- *                                                                    info,
- *                                                                    &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
+rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
+*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
+*  base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_level_info returns the level schedule of the meta data that has
+*  been collected by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). Rows of the same level
+*  can be processed in parallel, while levels are processed in order. The work of a row
+*  is one plus the number of its off-diagonal entries in the lower triangular part. The
+*  critical path is the largest accumulated work along a chain of dependent rows, and the
+*  available parallelism is the total work divided by the critical path. Matrices with a
+*  low parallelism might benefit from reordering or coloring prior to the analysis.
+*
+*  If no meta data is available, all fields of \p level_info are set to zero.
+*
+*  \note \p rocsparse_csrilu0_level_info is a blocking function. The level schedule is
+*  computed on the host from the sparsity pattern the analysis has been performed on,
+*  which has to be left untouched.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  level_info  level schedule of the analysis meta data, in host memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p level_info pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_level_info(rocsparse_handle      handle,
+                                              rocsparse_mat_info    info,
+                                              rocsparse_level_info* level_info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
+ *  format
  *
- *      // Compute incomplete LU factorization M = LU
- *      rocsparse_dbsrilu0(handle,
- *                         rocsparse_direction_row,
- *                         mb,
- *                         nnzb,
- *                         descr_M,
- *                         bsr_val,
- *                         bsr_row_ptr,
- *                         bsr_col_ind,
- *                         block_dim,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
+ *  \details
+ *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
  *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
  *
- *      // Solve Lz = x
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_none,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_L,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  \note \p tol and \p boost_val can be in host or device memory.
  *
- *      // Solve Uy = z
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_transpose,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_U,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
  *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
+*  storage buffer must be allocated by the user. The size of the temporary storage
+*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
+*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
+*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+*  allocated buffer can thus be shared between subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
+*              rocsparse_zcsrilu0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsric0() or
-*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
-*  is stored in \p position, using same index base as the CSR matrix.
+*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
+*  that this function will be executed only once for a given matrix and particular
+*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
 *
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*  \p rocsparse_csrilu0_analysis can share its meta data with
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
 *
-*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*  info        structure that holds the information collected during the analysis step.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
-*  be allocated by the user. The size of the temporary storage buffer is identical to
-*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
-*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
-*  sparsity pattern is identical. The user allocated buffer can thus be shared between
-*  subsequent calls to those functions.
+*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*
+*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
+*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -6276,1247 +9844,1142 @@ rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
-*  @param[in]
+*  @param[inout]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
-*  @param[out]
+*  @param[in]
 *  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*              rocsparse_scsric0() and rocsparse_dcsric0().
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
 *              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete LU factorization
+*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for U
+*      rocsparse_mat_descr descr_U;
+*      rocsparse_create_mat_descr(&descr_U);
+*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_U;
+*      rocsparse_dcsrilu0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_U,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_U);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsrilu0_analysis(handle,
+*                                  m,
+*                                  nnz,
+*                                  descr_M,
+*                                  csr_val,
+*                                  csr_row_ptr,
+*                                  csr_col_ind,
+*                                  info,
+*                                  rocsparse_analysis_policy_reuse,
+*                                  rocsparse_solve_policy_auto,
+*                                  temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_U,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete LU factorization
+*      rocsparse_dcsrilu0(handle,
+*                         m,
+*                         nnz,
+*                         descr_M,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         info,
+*                         rocsparse_solve_policy_auto,
+*                         temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve Uy = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_U,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_U);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_int                  m,
-                                               rocsparse_int                  nnz,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* csr_val,
-                                               const rocsparse_int*           csr_row_ptr,
-                                               const rocsparse_int*           csr_col_ind,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_int                   m,
-                                               rocsparse_int                   nnz,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* csr_val,
-                                               const rocsparse_int*            csr_row_ptr,
-                                               const rocsparse_int*            csr_col_ind,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
+rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
-*
+/*
+* ===========================================================================
+*    Sparse Format Conversions
+* ===========================================================================
+*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero elements per row or column and the total number of nonzero elements in a dense matrix.
 *  \details
-*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
-*  and rocsparse_dcsric0(). It is expected that this function will be executed only
-*  once for a given matrix and particular operation type. The analysis meta data can be
-*  cleared by rocsparse_csric0_clear().
-*
-*  \p rocsparse_csric0_analysis can share its meta data with
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
-*
-*  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
+*  The routine does support asynchronous execution if the pointer mode is set to device.
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  dir        direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+*
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  descr      the descriptor of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  A           array of dimensions (\p ld, \p n)
+*
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  ld         leading dimension of dense array \p A.
+*
 *  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
-*  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
-*  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
-*  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  nnz_per_row_columns
+*              array of size \p m or \p n containing the number of nonzero elements per row or column, respectively.
+*  @param[out]
+*  nnz_total_dev_host_ptr
+*              total number of nonzero elements in device or host memory.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_row_columns or \p nnz_total_dev_host_ptr
+*              pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_snnz(rocsparse_handle          handle,
+                                rocsparse_direction       dir,
+                                rocsparse_int             m,
+                                rocsparse_int             n,
+                                const rocsparse_mat_descr descr,
+                                const float*              A,
+                                rocsparse_int             ld,
+                                rocsparse_int*            nnz_per_row_columns,
+                                rocsparse_int*            nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_dnnz(rocsparse_handle          handle,
+                                rocsparse_direction       dir,
+                                rocsparse_int             m,
+                                rocsparse_int             n,
+                                const rocsparse_mat_descr descr,
+                                const double*             A,
+                                rocsparse_int             ld,
+                                rocsparse_int*            nnz_per_row_columns,
+                                rocsparse_int*            nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
-                                            rocsparse_int                  m,
-                                            rocsparse_int                  nnz,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* csr_val,
-                                            const rocsparse_int*           csr_row_ptr,
-                                            const rocsparse_int*           csr_col_ind,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+rocsparse_status rocsparse_cnnz(rocsparse_handle               handle,
+                                rocsparse_direction            dir,
+                                rocsparse_int                  m,
+                                rocsparse_int                  n,
+                                const rocsparse_mat_descr      descr,
+                                const rocsparse_float_complex* A,
+                                rocsparse_int                  ld,
+                                rocsparse_int*                 nnz_per_row_columns,
+                                rocsparse_int*                 nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
-                                            rocsparse_int                   m,
-                                            rocsparse_int                   nnz,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* csr_val,
-                                            const rocsparse_int*            csr_row_ptr,
-                                            const rocsparse_int*            csr_col_ind,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
+rocsparse_status rocsparse_znnz(rocsparse_handle                handle,
+                                rocsparse_direction             dir,
+                                rocsparse_int                   m,
+                                rocsparse_int                   n,
+                                const rocsparse_mat_descr       descr,
+                                const rocsparse_double_complex* A,
+                                rocsparse_int                   ld,
+                                rocsparse_int*                  nnz_per_row_columns,
+                                rocsparse_int*                  nnz_total_dev_host_ptr);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
-*
-*  \details
-*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
-*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
-*  useful, if memory is an issue and the analysis data is not required for further
-*  computation.
-*
-*  \note
-*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
-*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
-*  rocsparse_destroy_mat_info().
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
-
-/*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
-*
-*  \details
-*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
-*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
-*  \f[
-*    A \approx LL^T
-*  \f]
-*
-*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
-*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csric0_zero_pivot().
-*
-*  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  m           number of rows of the sparse CSR matrix.
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
-*  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
-*  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
-*  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format.
+*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnzPerRow, which can be pre-computed with rocsparse_xnnz().
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \details
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  m           number of rows of the dense matrix \p A.
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
 *
-*  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete Cholesky factorization
-*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
+*  @param[in]
+*  A           array of dimensions (\p ld, \p n)
 *
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*  @param[in]
+*  ld         leading dimension of dense array \p A.
 *
-*      // Create matrix descriptor for L'
-*      rocsparse_mat_descr descr_Lt;
-*      rocsparse_create_mat_descr(&descr_Lt);
-*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+*  @param[in]
+*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
 *
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
+*  @param[out]
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[out]
+*  csr_row_ptr
+*              integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[out]
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
-*      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_Lt;
-*      rocsparse_dcsric0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_transpose,
-*                                   m,
-*                                   nnz,
-*                                   descr_Lt,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_Lt);
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p csr_val \p csr_row_ptr or \p csr_col_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      float*                    csr_val,
+                                      rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      double*                   csr_val,
+                                      rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdense2csr(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* A,
+                                      rocsparse_int                  ld,
+                                      const rocsparse_int*           nnz_per_rows,
+                                      rocsparse_float_complex*       csr_val,
+                                      rocsparse_int*                 csr_row_ptr,
+                                      rocsparse_int*                 csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdense2csr(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* A,
+                                      rocsparse_int                   ld,
+                                      const rocsparse_int*            nnz_per_rows,
+                                      rocsparse_double_complex*       csr_val,
+                                      rocsparse_int*                  csr_row_ptr,
+                                      rocsparse_int*                  csr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the the size of the user allocated temporary storage buffer used when converting and pruning
+*  a dense matrix to a CSR matrix.
 *
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*  \details
+*  \p rocsparse_prune_dense2csr_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
+*  rocsparse_sprune_dense2csr(), and rocsparse_dprune_dense2csr(). The temporary
+*  storage buffer must be allocated by the user.
 *
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsric0_analysis(handle,
-*                                 m,
-*                                 nnz,
-*                                 descr_M,
-*                                 csr_val,
-*                                 csr_row_ptr,
-*                                 csr_col_ind,
-*                                 info,
-*                                 rocsparse_analysis_policy_reuse,
-*                                 rocsparse_solve_policy_auto,
-*                                 temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_transpose,
-*                                m,
-*                                nnz,
-*                                descr_Lt,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
 *
-*      // Compute incomplete Cholesky factorization M = LL'
-*      rocsparse_dcsric0(handle,
-*                        m,
-*                        nnz,
-*                        descr_M,
-*                        csr_val,
-*                        csr_row_ptr,
-*                        csr_col_ind,
-*                        info,
-*                        rocsparse_solve_policy_auto,
-*                        temp_buffer);
+*  @param[in]
+*  A           array of dimensions (\p lda, \p n)
 *
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
+*  @param[in]
+*  lda         leading dimension of dense array \p A.
 *
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
 *
-*      // Solve L'y = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_transpose,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_Lt,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_Lt);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
+*  @param[in]
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[in]
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[in]
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
+*              rocsparse_sprune_dense2csr() and rocsparse_dprune_dense2csr().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_sprune_dense2csr_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const float*              A,
+                                                        rocsparse_int             lda,
+                                                        const float*              threshold,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_dprune_dense2csr_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const double*             A,
+                                                        rocsparse_int             lda,
+                                                        const double*             threshold,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix once
+*  elements less than the threshold are pruned from the matrix.
 *
 *  \details
-*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
-*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
-*  base as the CSR matrix.
+*  The routine does support asynchronous execution if the pointer mode is set to device.
 *
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
-*  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*  A           array of dimensions (\p lda, \p n)
+*
+*  @param[in]
+*  lda         leading dimension of dense array \p A.
+*
+*  @param[in]
+*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
+*
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A.
+*
+*  @param[out]
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[out]
+*  nnz_total_dev_host_ptr
+*              total number of nonzero elements in device or host memory.
+*
+*  @param[out]
+*  temp_buffer
+*              buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p threshold or \p descr or \p csr_row_ptr
+*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
+rocsparse_status rocsparse_sprune_dense2csr_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const float*              A,
+                                                rocsparse_int             lda,
+                                                const float*              threshold,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_int*            csr_row_ptr,
+                                                rocsparse_int*            nnz_total_dev_host_ptr,
+                                                void*                     temp_buffer);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_dense2csr_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const double*             A,
+                                                rocsparse_int             lda,
+                                                const double*             threshold,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_int*            csr_row_ptr,
+                                                rocsparse_int*            nnz_total_dev_host_ptr,
+                                                void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
+*  that are less than the threshold. All the parameters are assumed to have been pre-allocated by the user.
+*
+*  \details
+*  The user first allocates \p csr_row_ptr to have \p m+1 elements and then calls rocsparse_xprune_dense2csr_nnz()
+*  which fills in the \p csr_row_ptr array and stores the number of elements that are larger than the pruning threshold
+*  in \p nnz_total_dev_host_ptr. The user then allocates \p csr_col_ind and \p csr_val to have size \p nnz_total_dev_host_ptr
+*  and completes the conversion by calling rocsparse_xprune_dense2csr(). A temporary storage buffer is used by both
+*  rocsparse_xprune_dense2csr_nnz() and rocsparse_xprune_dense2csr() and must be allocated by the user and whose size is determined
+*  by rocsparse_xprune_dense2csr_buffer_size(). The routine rocsparse_xprune_dense2csr() is executed asynchronously with
+*  respect to the host and may return control to the application on the host before the entire result is ready.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  A           array of dimensions (\p lda, \p n)
+*
+*  @param[in]
+*  lda         leading dimension of dense array \p A.
+*
+*  @param[in]
+*  threshold   pointer to the non-negative pruning threshold which can exist in either host or device memory.
+*
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[out]
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[in]
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[out]
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_xprune_dense2csr_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p threshold or \p csr_val
+*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
+rocsparse_status rocsparse_sprune_dense2csr(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const float*              A,
+                                            rocsparse_int             lda,
+                                            const float*              threshold,
+                                            const rocsparse_mat_descr descr,
+                                            float*                    csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            rocsparse_int*            csr_col_ind,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_dprune_dense2csr(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const double*             A,
+                                            rocsparse_int             lda,
+                                            const double*             threshold,
+                                            const rocsparse_mat_descr descr,
+                                            double*                   csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            rocsparse_int*            csr_col_ind,
+                                            void*                     temp_buffer);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the size of the user allocated temporary storage buffer used when converting and pruning by percentage a
+*  dense matrix to a CSR matrix.
 *
 *  \details
-*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
-*  storage buffer must be allocated by the user. The size of the temporary storage
-*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
-*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
-*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
-*  allocated buffer can thus be shared between subsequent calls to those functions.
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
+*
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
+*  \f[
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
+*  \f]
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
+*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
+*
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  lda         leading dimension of dense array \p A.
+*
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  percentage  percentage >= 0 and percentage <= 100.
+*
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  info        structure that holds the information collected during the analysis step.
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  csr_val    array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*
+*  @param[in]
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*
+*  @param[in]
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
 *  @param[in]
+*  info prune information structure
+*
+*  @param[out]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
-*              rocsparse_zcsrilu0().
+*              rocsparse_sprune_dense2csr_nnz_by_percentage(), rocsparse_dprune_dense2csr_nnz_by_percentage(),
+*              rocsparse_sprune_dense2csr_by_percentage() and rocsparse_dprune_dense2csr_by_percentage().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_int                  m,
-                                                rocsparse_int                  nnz,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* csr_val,
-                                                const rocsparse_int*           csr_row_ptr,
-                                                const rocsparse_int*           csr_col_ind,
-                                                rocsparse_mat_info             info,
-                                                size_t*                        buffer_size);
+rocsparse_status
+    rocsparse_sprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const float*              A,
+                                                         rocsparse_int             lda,
+                                                         float                     percentage,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_int                   m,
-                                                rocsparse_int                   nnz,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* csr_val,
-                                                const rocsparse_int*            csr_row_ptr,
-                                                const rocsparse_int*            csr_col_ind,
-                                                rocsparse_mat_info              info,
-                                                size_t*                         buffer_size);
+rocsparse_status
+    rocsparse_dprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const double*             A,
+                                                         rocsparse_int             lda,
+                                                         double                    percentage,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix
+*  when converting and pruning by percentage a dense matrix to a CSR matrix.
 *
 *  \details
-*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
-*  that this function will be executed only once for a given matrix and particular
-*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
-*
-*  \p rocsparse_csrilu0_analysis can share its meta data with
-*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
-*
-*  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
 *
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
+*  \f[
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
+*  \f]
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. The routine does
+*  support asynchronous execution if the pointer mode is set to device.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
+*
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  lda         leading dimension of dense array \p A.
+*
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  percentage  percentage >= 0 and percentage <= 100.
+*
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  descr       the descriptor of the dense matrix \p A.
+*
 *  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
-*  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
-*  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*
+*  @param[out]
+*  nnz_total_dev_host_ptr total number of nonzero elements in device or host memory.
+*
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  info prune information structure
+*
+*  @param[out]
+*  temp_buffer buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_row_ptr
+*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_int                  m,
-                                             rocsparse_int                  nnz,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* csr_val,
-                                             const rocsparse_int*           csr_row_ptr,
-                                             const rocsparse_int*           csr_col_ind,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
+rocsparse_status rocsparse_sprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
+                                                              rocsparse_int             m,
+                                                              rocsparse_int             n,
+                                                              const float*              A,
+                                                              rocsparse_int             lda,
+                                                              float                     percentage,
+                                                              const rocsparse_mat_descr descr,
+                                                              rocsparse_int*            csr_row_ptr,
+                                                              rocsparse_int* nnz_total_dev_host_ptr,
+                                                              rocsparse_mat_info info,
+                                                              void*              temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_int                   m,
-                                             rocsparse_int                   nnz,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* csr_val,
-                                             const rocsparse_int*            csr_row_ptr,
-                                             const rocsparse_int*            csr_col_ind,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
+rocsparse_status rocsparse_dprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
+                                                              rocsparse_int             m,
+                                                              rocsparse_int             n,
+                                                              const double*             A,
+                                                              rocsparse_int             lda,
+                                                              double                    percentage,
+                                                              const rocsparse_mat_descr descr,
+                                                              rocsparse_int*            csr_row_ptr,
+                                                              rocsparse_int* nnz_total_dev_host_ptr,
+                                                              rocsparse_mat_info info,
+                                                              void*              temp_buffer);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
+*  based on percentage.
 *
 *  \details
-*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
-*  useful, if memory is an issue and the analysis data is not required for further
-*  computation.
-*
-*  \note
-*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
-*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
-*  rocsparse_destroy_mat_info().
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
-
-/*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
 *
-*  \details
-*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
-*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
 *  \f[
-*    A \approx LU
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
 *  \f]
-*
-*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
-*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
-*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
-*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csrilu0_zero_pivot().
-*
-*  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
+*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
-*  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
-*  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
-*  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  A           array of dimensions (\p lda, \p n)
+*
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  lda         leading dimension of dense array \p A.
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  @param[in]
+*  percentage  percentage >= 0 and percentage <= 100.
 *
-*  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete LU factorization
-*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
+*  @param[in]
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
+*  @param[out]
+*  csr_val array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
 *
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*  @param[in]
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
 *
-*      // Create matrix descriptor for U
-*      rocsparse_mat_descr descr_U;
-*      rocsparse_create_mat_descr(&descr_U);
-*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+*  @param[out]
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
+*  @param[in]
+*  info prune information structure
 *
-*      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_U;
-*      rocsparse_dcsrilu0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_U,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_U);
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_xprune_dense2csr_buffer_size().
 *
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_val
+*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_dense2csr_by_percentage(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          const float*              A,
+                                                          rocsparse_int             lda,
+                                                          float                     percentage,
+                                                          const rocsparse_mat_descr descr,
+                                                          float*                    csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          rocsparse_int*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_dense2csr_by_percentage(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          const double*             A,
+                                                          rocsparse_int             lda,
+                                                          double                    percentage,
+                                                          const rocsparse_mat_descr descr,
+                                                          double*                   csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          rocsparse_int*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
 *
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*  This function converts the matrix A in dense format into a sparse matrix in CSC format.
+*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_columns, which can be pre-computed with rocsparse_xnnz().
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsrilu0_analysis(handle,
-*                                  m,
-*                                  nnz,
-*                                  descr_M,
-*                                  csr_val,
-*                                  csr_row_ptr,
-*                                  csr_col_ind,
-*                                  info,
-*                                  rocsparse_analysis_policy_reuse,
-*                                  rocsparse_solve_policy_auto,
-*                                  temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_U,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
-*      // Compute incomplete LU factorization
-*      rocsparse_dcsrilu0(handle,
-*                         m,
-*                         nnz,
-*                         descr_M,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         info,
-*                         rocsparse_solve_policy_auto,
-*                         temp_buffer);
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
 *
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  A           array of dimensions (\p ld, \p n)
 *
-*      // Solve Uy = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_U,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  ld         leading dimension of dense array \p A.
 *
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_U);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
+*  @param[in]
+*  nnz_per_columns   array of size \p n containing the number of non-zero elements per column.
+*
+*  @param[out]
+*  csc_val
+*              array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[out]
+*  csc_col_ptr
+*              integer array of m+1 elements that contains the start of every column and the end of the last column plus one.
+*  @param[out]
+*  csc_row_ind
+*              integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_columns or \p csc_val \p csc_col_ptr or \p cscColIndA
+*              pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_sdense2csc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_columns,
+                                      float*                    csc_val,
+                                      rocsparse_int*            csc_col_ptr,
+                                      rocsparse_int*            csc_row_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
-
+rocsparse_status rocsparse_ddense2csc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_columns,
+                                      double*                   csc_val,
+                                      rocsparse_int*            csc_col_ptr,
+                                      rocsparse_int*            csc_row_ind);
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_cdense2csc(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* A,
+                                      rocsparse_int                  ld,
+                                      const rocsparse_int*           nnz_per_columns,
+                                      rocsparse_float_complex*       csc_val,
+                                      rocsparse_int*                 csc_col_ptr,
+                                      rocsparse_int*                 csc_row_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_zdense2csc(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* A,
+                                      rocsparse_int                   ld,
+                                      const rocsparse_int*            nnz_per_columns,
+                                      rocsparse_double_complex*       csc_val,
+                                      rocsparse_int*                  csc_col_ptr,
+                                      rocsparse_int*                  csc_row_ind);
 /**@}*/
 
-/*
-* ===========================================================================
-*    Sparse Format Conversions
-* ===========================================================================
-*/
-
 /*! \ingroup conv_module
 *  \brief
-*  This function computes the number of nonzero elements per row or column and the total number of nonzero elements in a dense matrix.
+*  This function converts the sparse matrix in CSR format into a dense matrix.
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *
 *  @param[in]
-*  dir        direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
-*
-*  @param[in]
 *  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
 *  n           number of columns of the dense matrix \p A.
 *
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A.
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  csr_val     array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
+*  csr_row_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[in]
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
 *  @param[out]
-*  nnz_per_row_columns
-*              array of size \p m or \p n containing the number of nonzero elements per row or column, respectively.
+*  A           array of dimensions (\p ld, \p n)
+*
 *  @param[out]
-*  nnz_total_dev_host_ptr
-*              total number of nonzero elements in device or host memory.
+*  ld          leading dimension of dense array \p A.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_row_columns or \p nnz_total_dev_host_ptr
+*  \retval     rocsparse_status_invalid_pointer \p A or \p csr_val \p csr_row_ptr or \p csr_col_ind
 *              pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_snnz(rocsparse_handle          handle,
-                                rocsparse_direction       dir,
-                                rocsparse_int             m,
-                                rocsparse_int             n,
-                                const rocsparse_mat_descr descr,
-                                const float*              A,
-                                rocsparse_int             ld,
-                                rocsparse_int*            nnz_per_row_columns,
-                                rocsparse_int*            nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_scsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      float*                    A,
+                                      rocsparse_int             ld);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dnnz(rocsparse_handle          handle,
-                                rocsparse_direction       dir,
-                                rocsparse_int             m,
-                                rocsparse_int             n,
-                                const rocsparse_mat_descr descr,
-                                const double*             A,
-                                rocsparse_int             ld,
-                                rocsparse_int*            nnz_per_row_columns,
-                                rocsparse_int*            nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_dcsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      double*                   A,
+                                      rocsparse_int             ld);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cnnz(rocsparse_handle               handle,
-                                rocsparse_direction            dir,
-                                rocsparse_int                  m,
-                                rocsparse_int                  n,
-                                const rocsparse_mat_descr      descr,
-                                const rocsparse_float_complex* A,
-                                rocsparse_int                  ld,
-                                rocsparse_int*                 nnz_per_row_columns,
-                                rocsparse_int*                 nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_ccsr2dense(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      const rocsparse_int*           csr_col_ind,
+                                      rocsparse_float_complex*       A,
+                                      rocsparse_int                  ld);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_znnz(rocsparse_handle                handle,
-                                rocsparse_direction             dir,
-                                rocsparse_int                   m,
-                                rocsparse_int                   n,
-                                const rocsparse_mat_descr       descr,
-                                const rocsparse_double_complex* A,
-                                rocsparse_int                   ld,
-                                rocsparse_int*                  nnz_per_row_columns,
-                                rocsparse_int*                  nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_zcsr2dense(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      const rocsparse_int*            csr_col_ind,
+                                      rocsparse_double_complex*       A,
+                                      rocsparse_int                   ld);
 /**@}*/
 
 /*! \ingroup conv_module
 *  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format.
-*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnzPerRow, which can be pre-computed with rocsparse_xnnz().
+*  This function converts the sparse matrix in CSC format into a dense matrix.
 *  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *  \details
 *  @param[in]
@@ -7529,1357 +10992,1578 @@ rocsparse_status rocsparse_znnz(rocsparse_handle                handle,
 *  n           number of columns of the dense matrix \p A.
 *
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  csc_val     array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
+*  csc_col_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
 *  @param[in]
-*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
+*  csc_row_ind integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
 *  @param[out]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*  @param[out]
-*  csr_row_ptr
-*              integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  A           array of dimensions (\p ld, \p n)
+*
 *  @param[out]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*  ld          leading dimension of dense array \p A.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p csr_val \p csr_row_ptr or \p csr_col_ind
+*  \retval     rocsparse_status_invalid_pointer \p A or \p csc_val \p csc_col_ptr or \p csc_row_ind
 *              pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sdense2csr(rocsparse_handle          handle,
+rocsparse_status rocsparse_scsc2dense(rocsparse_handle          handle,
                                       rocsparse_int             m,
                                       rocsparse_int             n,
                                       const rocsparse_mat_descr descr,
-                                      const float*              A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      float*                    csr_val,
-                                      rocsparse_int*            csr_row_ptr,
-                                      rocsparse_int*            csr_col_ind);
+                                      const float*              csc_val,
+                                      const rocsparse_int*      csc_col_ptr,
+                                      const rocsparse_int*      csc_row_ind,
+                                      float*                    A,
+                                      rocsparse_int             ld);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ddense2csr(rocsparse_handle          handle,
+rocsparse_status rocsparse_dcsc2dense(rocsparse_handle          handle,
                                       rocsparse_int             m,
                                       rocsparse_int             n,
                                       const rocsparse_mat_descr descr,
-                                      const double*             A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      double*                   csr_val,
-                                      rocsparse_int*            csr_row_ptr,
-                                      rocsparse_int*            csr_col_ind);
+                                      const double*             csc_val,
+                                      const rocsparse_int*      csc_col_ptr,
+                                      const rocsparse_int*      csc_row_ind,
+                                      double*                   A,
+                                      rocsparse_int             ld);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdense2csr(rocsparse_handle               handle,
+rocsparse_status rocsparse_ccsc2dense(rocsparse_handle               handle,
                                       rocsparse_int                  m,
                                       rocsparse_int                  n,
                                       const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* A,
-                                      rocsparse_int                  ld,
-                                      const rocsparse_int*           nnz_per_rows,
-                                      rocsparse_float_complex*       csr_val,
-                                      rocsparse_int*                 csr_row_ptr,
-                                      rocsparse_int*                 csr_col_ind);
+                                      const rocsparse_float_complex* csc_val,
+                                      const rocsparse_int*           csc_col_ptr,
+                                      const rocsparse_int*           csc_row_ind,
+                                      rocsparse_float_complex*       A,
+                                      rocsparse_int                  ld);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdense2csr(rocsparse_handle                handle,
+rocsparse_status rocsparse_zcsc2dense(rocsparse_handle                handle,
                                       rocsparse_int                   m,
                                       rocsparse_int                   n,
                                       const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* A,
-                                      rocsparse_int                   ld,
-                                      const rocsparse_int*            nnz_per_rows,
-                                      rocsparse_double_complex*       csr_val,
-                                      rocsparse_int*                  csr_row_ptr,
-                                      rocsparse_int*                  csr_col_ind);
+                                      const rocsparse_double_complex* csc_val,
+                                      const rocsparse_int*            csc_col_ptr,
+                                      const rocsparse_int*            csc_row_ind,
+                                      rocsparse_double_complex*       A,
+                                      rocsparse_int                   ld);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief
-*  This function computes the the size of the user allocated temporary storage buffer used when converting and pruning
-*  a dense matrix to a CSR matrix.
-*
-*  \details
-*  \p rocsparse_prune_dense2csr_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
-*  rocsparse_sprune_dense2csr(), and rocsparse_dprune_dense2csr(). The temporary
-*  storage buffer must be allocated by the user.
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
-*  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
-*  @param[in]
-*  A           array of dimensions (\p lda, \p n)
+*  Given a sparse CSR matrix and a non-negative tolerance, this function computes how many entries would be left
+*  in each row of the matrix if elements less than the tolerance were removed. It also computes the total number
+*  of remaining elements in the matrix.
 *
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
+*  handle        handle to the rocsparse library context queue.
 *
 *  @param[in]
-*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
+*  m             number of rows of the sparse CSR matrix.
 *
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*  descr_A       the descriptor of the sparse CSR matrix.
 *
 *  @param[in]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*  @param[in]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  csr_val_A     array of \p nnz_A elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
+*                uncompressed sparse CSR matrix.
 *  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
-*              rocsparse_sprune_dense2csr() and rocsparse_dprune_dense2csr().
+*  nnz_per_row   array of length \p m containing the number of entries that will be kept per row in
+*                the final compressed CSR matrix.
+*  @param[out]
+*  nnz_C         number of elements in the column indices and values arrays of the compressed
+*                sparse CSR matrix. Can be either host or device pointer.
+*  @param[in]
+*  tol           the non-negative tolerance used for compression. If \p tol is complex then only the magnitude
+*                of the real part is used. Entries in the input uncompressed CSR array that are below the tolerance
+*                are removed in output compressed CSR matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val_A or \p csr_row_ptr_A or \p nnz_per_row or \p nnz_C
+*              pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_buffer_size(rocsparse_handle          handle,
-                                                        rocsparse_int             m,
-                                                        rocsparse_int             n,
-                                                        const float*              A,
-                                                        rocsparse_int             lda,
-                                                        const float*              threshold,
-                                                        const rocsparse_mat_descr descr,
-                                                        const float*              csr_val,
-                                                        const rocsparse_int*      csr_row_ptr,
-                                                        const rocsparse_int*      csr_col_ind,
-                                                        size_t*                   buffer_size);
+rocsparse_status rocsparse_snnz_compress(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr descr_A,
+                                         const float*              csr_val_A,
+                                         const rocsparse_int*      csr_row_ptr_A,
+                                         rocsparse_int*            nnz_per_row,
+                                         rocsparse_int*            nnz_C,
+                                         float                     tol);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_buffer_size(rocsparse_handle          handle,
-                                                        rocsparse_int             m,
-                                                        rocsparse_int             n,
-                                                        const double*             A,
-                                                        rocsparse_int             lda,
-                                                        const double*             threshold,
-                                                        const rocsparse_mat_descr descr,
-                                                        const double*             csr_val,
-                                                        const rocsparse_int*      csr_row_ptr,
-                                                        const rocsparse_int*      csr_col_ind,
-                                                        size_t*                   buffer_size);
+rocsparse_status rocsparse_dnnz_compress(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr descr_A,
+                                         const double*             csr_val_A,
+                                         const rocsparse_int*      csr_row_ptr_A,
+                                         rocsparse_int*            nnz_per_row,
+                                         rocsparse_int*            nnz_C,
+                                         double                    tol);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cnnz_compress(rocsparse_handle               handle,
+                                         rocsparse_int                  m,
+                                         const rocsparse_mat_descr      descr_A,
+                                         const rocsparse_float_complex* csr_val_A,
+                                         const rocsparse_int*           csr_row_ptr_A,
+                                         rocsparse_int*                 nnz_per_row,
+                                         rocsparse_int*                 nnz_C,
+                                         rocsparse_float_complex        tol);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_znnz_compress(rocsparse_handle                handle,
+                                         rocsparse_int                   m,
+                                         const rocsparse_mat_descr       descr_A,
+                                         const rocsparse_double_complex* csr_val_A,
+                                         const rocsparse_int*            csr_row_ptr_A,
+                                         rocsparse_int*                  nnz_per_row,
+                                         rocsparse_int*                  nnz_C,
+                                         rocsparse_double_complex        tol);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix once
-*  elements less than the threshold are pruned from the matrix.
+*  \brief Convert a sparse CSR matrix into a sparse COO matrix
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
+*  to the start of every row, into a COO array of row indices.
+*
+*  \note
+*  It can also be used to convert a CSC array containing the column offsets into a COO
+*  array of column indices.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row
+*              of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  m           number of rows of the sparse CSR matrix.
+*  @param[out]
+*  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+*              matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
 *
-*  @param[in]
-*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+*              pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *
-*  @param[in]
-*  descr      the descriptor of the dense matrix \p A.
+*  \par Example
+*  This example converts a CSR matrix into a COO matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
 *
-*  @param[out]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*  @param[out]
-*  nnz_total_dev_host_ptr
-*              total number of nonzero elements in device or host memory.
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
 *
-*  @param[out]
-*  temp_buffer
-*              buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p threshold or \p descr or \p csr_row_ptr
-*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
+*      // Allocate COO matrix arrays
+*      rocsparse_int* coo_row_ind;
+*      rocsparse_int* coo_col_ind;
+*      float* coo_val;
+*
+*      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
+*      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
+*      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+*
+*      // Convert the csr row offsets into coo row indices
+*      rocsparse_csr2coo(handle,
+*                        csr_row_ptr,
+*                        nnz,
+*                        m,
+*                        coo_row_ind,
+*                        rocsparse_index_base_zero);
+*
+*      // Copy the column and value arrays
+*      hipMemcpy(coo_col_ind,
+*                csr_col_ind,
+*                sizeof(rocsparse_int) * nnz,
+*                hipMemcpyDeviceToDevice);
+*
+*      hipMemcpy(coo_val,
+*                csr_val,
+*                sizeof(float) * nnz,
+*                hipMemcpyDeviceToDevice);
+*  \endcode
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_nnz(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                const float*              A,
-                                                rocsparse_int             lda,
-                                                const float*              threshold,
-                                                const rocsparse_mat_descr descr,
-                                                rocsparse_int*            csr_row_ptr,
-                                                rocsparse_int*            nnz_total_dev_host_ptr,
-                                                void*                     temp_buffer);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_nnz(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                const double*             A,
-                                                rocsparse_int             lda,
-                                                const double*             threshold,
-                                                const rocsparse_mat_descr descr,
-                                                rocsparse_int*            csr_row_ptr,
-                                                rocsparse_int*            nnz_total_dev_host_ptr,
-                                                void*                     temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int        nnz,
+                                   rocsparse_int        m,
+                                   rocsparse_int*       coo_row_ind,
+                                   rocsparse_index_base idx_base);
 
 /*! \ingroup conv_module
-*  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
-*  that are less than the threshold. All the parameters are assumed to have been pre-allocated by the user.
+*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
 *
 *  \details
-*  The user first allocates \p csr_row_ptr to have \p m+1 elements and then calls rocsparse_xprune_dense2csr_nnz()
-*  which fills in the \p csr_row_ptr array and stores the number of elements that are larger than the pruning threshold
-*  in \p nnz_total_dev_host_ptr. The user then allocates \p csr_col_ind and \p csr_val to have size \p nnz_total_dev_host_ptr
-*  and completes the conversion by calling rocsparse_xprune_dense2csr(). A temporary storage buffer is used by both
-*  rocsparse_xprune_dense2csr_nnz() and rocsparse_xprune_dense2csr() and must be allocated by the user and whose size is determined
-*  by rocsparse_xprune_dense2csr_buffer_size(). The routine rocsparse_xprune_dense2csr() is executed asynchronously with
-*  respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
+*  required by rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
+*  rocsparse_zcsr2csc(). The temporary storage buffer must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
-*  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  n           number of columns of the sparse CSR matrix.
 *  @param[in]
-*  threshold   pointer to the non-negative pruning threshold which can exist in either host or device memory.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
-*  @param[out]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*  @param[out]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_xprune_dense2csr_buffer_size().
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
+*              rocsparse_zcsr2csc().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p threshold or \p csr_val
-*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
-/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             n,
-                                            const float*              A,
-                                            rocsparse_int             lda,
-                                            const float*              threshold,
-                                            const rocsparse_mat_descr descr,
-                                            float*                    csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            rocsparse_int*            csr_col_ind,
-                                            void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             n,
-                                            const double*             A,
-                                            rocsparse_int             lda,
-                                            const double*             threshold,
-                                            const rocsparse_mat_descr descr,
-                                            double*                   csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            rocsparse_int*            csr_col_ind,
-                                            void*                     temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               rocsparse_int        nnz,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_action     copy_values,
+                                               size_t*              buffer_size);
 
 /*! \ingroup conv_module
-*  \brief
-*  This function computes the size of the user allocated temporary storage buffer used when converting and pruning by percentage a
-*  dense matrix to a CSR matrix.
+*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
 *
 *  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
+*  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
+*  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
+*  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
+*  or not (\ref rocsparse_action_symbolic).
 *
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
-*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \note
+*  The resulting matrix can also be seen as the transpose of the input matrix.
 *
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  n           number of columns of the sparse CSR matrix.
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_val    array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  csc_val     array of \p nnz elements of the sparse CSC matrix.
+*  @param[out]
+*  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+*              matrix.
+*  @param[out]
+*  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+*              sparse CSC matrix.
 *  @param[in]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
 *  @param[in]
-*  info prune information structure
-*
-*  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sprune_dense2csr_nnz_by_percentage(), rocsparse_dprune_dense2csr_nnz_by_percentage(),
-*              rocsparse_sprune_dense2csr_by_percentage() and rocsparse_dprune_dense2csr_by_percentage().
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csr2csc_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  This example computes the transpose of a CSR matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
+*
+*      rocsparse_int m_A   = 3;
+*      rocsparse_int n_A   = 5;
+*      rocsparse_int nnz_A = 8;
+*
+*      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*
+*      // Allocate memory for transposed CSR matrix
+*      rocsparse_int m_T   = n_A;
+*      rocsparse_int n_T   = m_A;
+*      rocsparse_int nnz_T = nnz_A;
+*
+*      rocsparse_int* csr_row_ptr_T;
+*      rocsparse_int* csr_col_ind_T;
+*      float* csr_val_T;
+*
+*      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
+*      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
+*      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+*
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csr2csc_buffer_size(handle,
+*                                    m_A,
+*                                    n_A,
+*                                    nnz_A,
+*                                    csr_row_ptr_A,
+*                                    csr_col_ind_A,
+*                                    rocsparse_action_numeric,
+*                                    &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      rocsparse_scsr2csc(handle,
+*                         m_A,
+*                         n_A,
+*                         nnz_A,
+*                         csr_val_A,
+*                         csr_row_ptr_A,
+*                         csr_col_ind_A,
+*                         csr_val_T,
+*                         csr_col_ind_T,
+*                         csr_row_ptr_T,
+*                         rocsparse_action_numeric,
+*                         rocsparse_index_base_zero,
+*                         temp_buffer);
+*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_sprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
-                                                         rocsparse_int             m,
-                                                         rocsparse_int             n,
-                                                         const float*              A,
-                                                         rocsparse_int             lda,
-                                                         float                     percentage,
-                                                         const rocsparse_mat_descr descr,
-                                                         const float*              csr_val,
-                                                         const rocsparse_int*      csr_row_ptr,
-                                                         const rocsparse_int*      csr_col_ind,
-                                                         rocsparse_mat_info        info,
-                                                         size_t*                   buffer_size);
+rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const float*         csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    float*               csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_dprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
-                                                         rocsparse_int             m,
-                                                         rocsparse_int             n,
-                                                         const double*             A,
-                                                         rocsparse_int             lda,
-                                                         double                    percentage,
-                                                         const rocsparse_mat_descr descr,
-                                                         const double*             csr_val,
-                                                         const rocsparse_int*      csr_row_ptr,
-                                                         const rocsparse_int*      csr_col_ind,
-                                                         rocsparse_mat_info        info,
-                                                         size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const double*        csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    double*              csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csc(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_float_complex*       csc_val,
+                                    rocsparse_int*                 csc_row_ind,
+                                    rocsparse_int*                 csc_col_ptr,
+                                    rocsparse_action               copy_values,
+                                    rocsparse_index_base           idx_base,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csc(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_double_complex*       csc_val,
+                                    rocsparse_int*                  csc_row_ind,
+                                    rocsparse_int*                  csc_col_ptr,
+                                    rocsparse_action                copy_values,
+                                    rocsparse_index_base            idx_base,
+                                    void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix
-*  when converting and pruning by percentage a dense matrix to a CSR matrix.
+*  \brief Compute the mapping of CSR entries onto a CSC matrix
 *
 *  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
-*
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. The routine does
-*  support asynchronous execution if the pointer mode is set to device.
+*  \p rocsparse_csr2csc_map computes the position of every entry of a CSR matrix in the
+*  value array of its CSC representation, as obtained by rocsparse_scsr2csc(),
+*  rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and rocsparse_zcsr2csc(). As long as the
+*  sparsity pattern does not change, the CSC values can then be refreshed from new CSR
+*  values by a single call to rocsparse_ssctr(), rocsparse_dsctr(), rocsparse_csctr()
+*  or rocsparse_zsctr(), without sorting the matrix again.
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \p rocsparse_csr2csc_map requires the temporary storage buffer of
+*  rocsparse_csr2csc_buffer_size() with \ref rocsparse_action_numeric.
 *
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  n           number of columns of the sparse CSR matrix.
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A.
-*
-*  @param[out]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
 *  @param[out]
-*  nnz_total_dev_host_ptr total number of nonzero elements in device or host memory.
-*
+*  csc_map     array of \p nnz elements containing the zero based position of each CSR
+*              entry in the CSC value array.
 *  @param[in]
-*  info prune information structure
-*
-*  @param[out]
-*  temp_buffer buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csr2csc_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_row_ptr
-*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_col_ind, \p csc_map or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  \code{.c}
+*      // Convert once and record the mapping
+*      rocsparse_scsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, csr_col_ind,
+*                         csc_val, csc_row_ind, csc_col_ptr,
+*                         rocsparse_action_numeric, rocsparse_index_base_zero,
+*                         temp_buffer);
+*
+*      rocsparse_csr2csc_map(handle, m, n, nnz, csr_col_ind, csc_map, temp_buffer);
+*
+*      // Refresh the CSC values after csr_val has changed
+*      rocsparse_ssctr(handle, nnz, csr_val, csc_map, csc_val, rocsparse_index_base_zero);
+*  \endcode
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
-                                                              rocsparse_int             m,
-                                                              rocsparse_int             n,
-                                                              const float*              A,
-                                                              rocsparse_int             lda,
-                                                              float                     percentage,
-                                                              const rocsparse_mat_descr descr,
-                                                              rocsparse_int*            csr_row_ptr,
-                                                              rocsparse_int* nnz_total_dev_host_ptr,
-                                                              rocsparse_mat_info info,
-                                                              void*              temp_buffer);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
-                                                              rocsparse_int             m,
-                                                              rocsparse_int             n,
-                                                              const double*             A,
-                                                              rocsparse_int             lda,
-                                                              double                    percentage,
-                                                              const rocsparse_mat_descr descr,
-                                                              rocsparse_int*            csr_row_ptr,
-                                                              rocsparse_int* nnz_total_dev_host_ptr,
-                                                              rocsparse_mat_info info,
-                                                              void*              temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csr2csc_map(rocsparse_handle     handle,
+                                       rocsparse_int        m,
+                                       rocsparse_int        n,
+                                       rocsparse_int        nnz,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_int*       csc_map,
+                                       void*                temp_buffer);
 
 /*! \ingroup conv_module
-*  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
-*  based on percentage.
+*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
 *
 *  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
-*
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
-*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_gebsr2gebsc_buffer_size returns the size of the temporary storage buffer
+*  required by rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
+*  rocsparse_zgebsr2gebsc(). The temporary storage buffer must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  mb           number of rows of the sparse GEneral BSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  nb           number of columns of the sparse GEneral BSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  nnzb         number of non-zero entries of the sparse GEneral BSR matrix.
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  bsr_val     array of \p nnzb*row_block_dim*col_block_dim containing the values of the sparse GEneral BSR matrix.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
-*  @param[out]
-*  csr_val array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*
+*  bsr_row_ptr array of \p mb+1 elements that point to the start of every row of the
+*              sparse GEneral BSR matrix.
 *  @param[in]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
-*  @param[out]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  bsr_col_ind array of \p nnzb elements containing the column indices of the sparse
+*              GEneral BSR matrix.
 *  @param[in]
-*  info prune information structure
-*
+*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_xprune_dense2csr_buffer_size().
+*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
+
+*  @param[out]
+*  p_buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
+*              rocsparse_zgebsr2gebsc().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_val
-*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr, \p bsr_col_ind or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_by_percentage(rocsparse_handle          handle,
-                                                          rocsparse_int             m,
-                                                          rocsparse_int             n,
-                                                          const float*              A,
-                                                          rocsparse_int             lda,
-                                                          float                     percentage,
-                                                          const rocsparse_mat_descr descr,
-                                                          float*                    csr_val,
-                                                          const rocsparse_int*      csr_row_ptr,
-                                                          rocsparse_int*            csr_col_ind,
-                                                          rocsparse_mat_info        info,
-                                                          void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_by_percentage(rocsparse_handle          handle,
-                                                          rocsparse_int             m,
-                                                          rocsparse_int             n,
-                                                          const double*             A,
-                                                          rocsparse_int             lda,
-                                                          double                    percentage,
-                                                          const rocsparse_mat_descr descr,
-                                                          double*                   csr_val,
-                                                          const rocsparse_int*      csr_row_ptr,
-                                                          rocsparse_int*            csr_col_ind,
-                                                          rocsparse_mat_info        info,
-                                                          void*                     temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_sgebsr2gebsc_buffer_size(rocsparse_handle     handle,
+                                                    rocsparse_int        mb,
+                                                    rocsparse_int        nb,
+                                                    rocsparse_int        nnzb,
+                                                    const float*         bsr_val,
+                                                    const rocsparse_int* bsr_row_ptr,
+                                                    const rocsparse_int* bsr_col_ind,
+                                                    rocsparse_int        row_block_dim,
+                                                    rocsparse_int        col_block_dim,
+                                                    size_t*              p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgebsr2gebsc_buffer_size(rocsparse_handle     handle,
+                                                    rocsparse_int        mb,
+                                                    rocsparse_int        nb,
+                                                    rocsparse_int        nnzb,
+                                                    const double*        bsr_val,
+                                                    const rocsparse_int* bsr_row_ptr,
+                                                    const rocsparse_int* bsr_col_ind,
+                                                    rocsparse_int        row_block_dim,
+                                                    rocsparse_int        col_block_dim,
+                                                    size_t*              p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgebsr2gebsc_buffer_size(rocsparse_handle               handle,
+                                                    rocsparse_int                  mb,
+                                                    rocsparse_int                  nb,
+                                                    rocsparse_int                  nnzb,
+                                                    const rocsparse_float_complex* bsr_val,
+                                                    const rocsparse_int*           bsr_row_ptr,
+                                                    const rocsparse_int*           bsr_col_ind,
+                                                    rocsparse_int                  row_block_dim,
+                                                    rocsparse_int                  col_block_dim,
+                                                    size_t*                        p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle                handle,
+                                                    rocsparse_int                   mb,
+                                                    rocsparse_int                   nb,
+                                                    rocsparse_int                   nnzb,
+                                                    const rocsparse_double_complex* bsr_val,
+                                                    const rocsparse_int*            bsr_row_ptr,
+                                                    const rocsparse_int*            bsr_col_ind,
+                                                    rocsparse_int                   row_block_dim,
+                                                    rocsparse_int                   col_block_dim,
+                                                    size_t*                         p_buffer_size);
 
-/*! \ingroup conv_module
-*  \brief
-*
-*  This function converts the matrix A in dense format into a sparse matrix in CSC format.
-*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_columns, which can be pre-computed with rocsparse_xnnz().
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
 *
 *  \details
+*  \p rocsparse_gebsr2gebsc converts a GEneral BSR matrix into a GEneral BSC matrix. \p rocsparse_gebsr2gebsc
+*  can also be used to convert a GEneral BSC matrix into a GEneral BSR matrix. \p copy_values decides
+*  whether \p bsc_val is being filled during conversion (\ref rocsparse_action_numeric)
+*  or not (\ref rocsparse_action_symbolic).
+*
+*  \p rocsparse_gebsr2gebsc requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_gebsr2gebsc_buffer_size().
+*
+*  \note
+*  The resulting matrix can also be seen as the transpose of the input matrix.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  mb          number of rows of the sparse GEneral BSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  nb          number of columns of the sparse GEneral BSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  nnzb        number of non-zero entries of the sparse GEneral BSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  bsr_val     array of \p nnzb * \p row_block_dim * \p col_block_dim  elements of the sparse GEneral BSR matrix.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
+*  bsr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse GEneral BSR matrix.
 *  @param[in]
-*  nnz_per_columns   array of size \p n containing the number of non-zero elements per column.
-*
+*  bsr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              GEneral BSR matrix.
+*  @param[in]
+*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  @param[in]
+*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
 *  @param[out]
-*  csc_val
-*              array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  bsc_val     array of \p nnz elements of the sparse BSC matrix.
 *  @param[out]
-*  csc_col_ptr
-*              integer array of m+1 elements that contains the start of every column and the end of the last column plus one.
+*  bsc_row_ind array of \p nnz elements containing the row indices of the sparse BSC
+*              matrix.
 *  @param[out]
-*  csc_row_ind
-*              integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*  bsc_col_ptr array of \p n+1 elements that point to the start of every column of the
+*              sparse BSC matrix.
+*  @param[in]
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_gebsr2gebsc_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_columns or \p csc_val \p csc_col_ptr or \p cscColIndA
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_val, \p bsr_row_ptr,
+*              \p bsr_col_ind, \p bsc_val, \p bsc_row_ind, \p bsc_col_ptr or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  This example computes the transpose of a GEneral BSR matrix.
+*  \code{.c}
+*      //     1 2 0 3
+*      // A = 0 4 5 0
+*      //     6 0 0 7
+*      //     1 2 3 4
+*
+*      rocsparse_int mb_A   = 2;
+*      rocsparse_int row_block_dim = 2;
+*      rocsparse_int col_block_dim = 2;
+*      rocsparse_int nb_A   = 2;
+*      rocsparse_int nnzb_A = 4;
+*
+*      bsr_row_ptr_A[mb_A+1] = {0, 2, 4};               // device memory
+*      bsr_col_ind_A[nnzb_A] = {0, 1, 0, 1}; // device memory
+*      bsr_val_A[nnzb_A]     = {1, 0, 2, 4, 0, 5, 3, 0, 6, 1, 0, 2, 0, 3, 7, 4}; // device memory
+*
+*      // Allocate memory for transposed BSR matrix
+*      rocsparse_int mb_T   = nb_A;
+*      rocsparse_int nb_T   = mb_A;
+*      rocsparse_int nnzb_T = nnzb_A;
+*
+*      rocsparse_int* bsr_row_ptr_T;
+*      rocsparse_int* bsr_col_ind_T;
+*      float* bsr_val_T;
+*
+*      hipMalloc((void**)&bsr_row_ptr_T, sizeof(rocsparse_int) * (mb_T + 1));
+*      hipMalloc((void**)&bsr_col_ind_T, sizeof(rocsparse_int) * nnzb_T);
+*      hipMalloc((void**)&bsr_val_T, sizeof(float) * nnzb_T);
+*
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_gebsr2gebsc_buffer_size(handle,
+*                                    mb_A,
+*                                    nb_A,
+*                                    nnzb_A,
+*                                    bsr_row_ptr_A,
+*                                    bsr_col_ind_A,
+*                                    rocsparse_action_numeric,
+*                                    &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      rocsparse_sgebsr2gebsc(handle,
+*                         mb_A,
+*                         nb_A,
+*                         nnzb_A,
+*                         bsr_val_A,
+*                         bsr_row_ptr_A,
+*                         bsr_col_ind_A,
+*                         row_block_dim,
+*                         col_block_dim,
+*                         bsr_val_T,
+*                         bsr_col_ind_T,
+*                         bsr_row_ptr_T,
+*                         rocsparse_action_numeric,
+*                         rocsparse_index_base_zero,
+*                         temp_buffer);
+*  \endcode
 */
 /**@{*/
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sdense2csc(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_columns,
-                                      float*                    csc_val,
-                                      rocsparse_int*            csc_col_ptr,
-                                      rocsparse_int*            csc_row_ind);
+rocsparse_status rocsparse_sgebsr2gebsc(rocsparse_handle     handle,
+                                        rocsparse_int        mb,
+                                        rocsparse_int        nb,
+                                        rocsparse_int        nnzb,
+                                        const float*         bsr_val,
+                                        const rocsparse_int* bsr_row_ptr,
+                                        const rocsparse_int* bsr_col_ind,
+                                        rocsparse_int        row_block_dim,
+                                        rocsparse_int        col_block_dim,
+                                        float*               bsc_val,
+                                        rocsparse_int*       bsc_row_ind,
+                                        rocsparse_int*       bsc_col_ptr,
+                                        rocsparse_action     copy_values,
+                                        rocsparse_index_base idx_base,
+                                        void*                temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ddense2csc(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_columns,
-                                      double*                   csc_val,
-                                      rocsparse_int*            csc_col_ptr,
-                                      rocsparse_int*            csc_row_ind);
+rocsparse_status rocsparse_dgebsr2gebsc(rocsparse_handle     handle,
+                                        rocsparse_int        mb,
+                                        rocsparse_int        nb,
+                                        rocsparse_int        nnzb,
+                                        const double*        bsr_val,
+                                        const rocsparse_int* bsr_row_ptr,
+                                        const rocsparse_int* bsr_col_ind,
+                                        rocsparse_int        row_block_dim,
+                                        rocsparse_int        col_block_dim,
+                                        double*              bsc_val,
+                                        rocsparse_int*       bsc_row_ind,
+                                        rocsparse_int*       bsc_col_ptr,
+                                        rocsparse_action     copy_values,
+                                        rocsparse_index_base idx_base,
+                                        void*                temp_buffer);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdense2csc(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* A,
-                                      rocsparse_int                  ld,
-                                      const rocsparse_int*           nnz_per_columns,
-                                      rocsparse_float_complex*       csc_val,
-                                      rocsparse_int*                 csc_col_ptr,
-                                      rocsparse_int*                 csc_row_ind);
+rocsparse_status rocsparse_cgebsr2gebsc(rocsparse_handle               handle,
+                                        rocsparse_int                  mb,
+                                        rocsparse_int                  nb,
+                                        rocsparse_int                  nnzb,
+                                        const rocsparse_float_complex* bsr_val,
+                                        const rocsparse_int*           bsr_row_ptr,
+                                        const rocsparse_int*           bsr_col_ind,
+                                        rocsparse_int                  row_block_dim,
+                                        rocsparse_int                  col_block_dim,
+                                        rocsparse_float_complex*       bsc_val,
+                                        rocsparse_int*                 bsc_row_ind,
+                                        rocsparse_int*                 bsc_col_ptr,
+                                        rocsparse_action               copy_values,
+                                        rocsparse_index_base           idx_base,
+                                        void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdense2csc(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* A,
-                                      rocsparse_int                   ld,
-                                      const rocsparse_int*            nnz_per_columns,
-                                      rocsparse_double_complex*       csc_val,
-                                      rocsparse_int*                  csc_col_ptr,
-                                      rocsparse_int*                  csc_row_ind);
+rocsparse_status rocsparse_zgebsr2gebsc(rocsparse_handle                handle,
+                                        rocsparse_int                   mb,
+                                        rocsparse_int                   nb,
+                                        rocsparse_int                   nnzb,
+                                        const rocsparse_double_complex* bsr_val,
+                                        const rocsparse_int*            bsr_row_ptr,
+                                        const rocsparse_int*            bsr_col_ind,
+                                        rocsparse_int                   row_block_dim,
+                                        rocsparse_int                   col_block_dim,
+                                        rocsparse_double_complex*       bsc_val,
+                                        rocsparse_int*                  bsc_row_ind,
+                                        rocsparse_int*                  bsc_col_ptr,
+                                        rocsparse_action                copy_values,
+                                        rocsparse_index_base            idx_base,
+                                        void*                           temp_buffer);
+
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief
-*  This function converts the sparse matrix in CSR format into a dense matrix.
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
-*  \details
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
 *
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
+*  \details
+*  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
+*  over all rows, the ELL \p width, for a given CSR matrix.
 *
-*  @param[in]
-*  n           number of columns of the dense matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  csr_val     array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
-*  @param[out]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  ld          leading dimension of dense array \p A.
+*  ell_width   pointer to the number of non-zero elements per row in ELL storage
+*              format.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p csr_val \p csr_row_ptr or \p csr_col_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
+*              \p ell_width pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              csr_val,
-                                      const rocsparse_int*      csr_row_ptr,
-                                      const rocsparse_int*      csr_col_ind,
-                                      float*                    A,
-                                      rocsparse_int             ld);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             csr_val,
-                                      const rocsparse_int*      csr_row_ptr,
-                                      const rocsparse_int*      csr_col_ind,
-                                      double*                   A,
-                                      rocsparse_int             ld);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2dense(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* csr_val,
-                                      const rocsparse_int*           csr_row_ptr,
-                                      const rocsparse_int*           csr_col_ind,
-                                      rocsparse_float_complex*       A,
-                                      rocsparse_int                  ld);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2dense(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* csr_val,
-                                      const rocsparse_int*            csr_row_ptr,
-                                      const rocsparse_int*            csr_col_ind,
-                                      rocsparse_double_complex*       A,
-                                      rocsparse_int                   ld);
-/**@}*/
+rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_mat_descr ell_descr,
+                                         rocsparse_int*            ell_width);
 
 /*! \ingroup conv_module
-*  \brief
-*  This function converts the sparse matrix in CSC format into a dense matrix.
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*
 *  \details
+*  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
+*  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
+*  number of rows times the number of ELL non-zero elements per row, such that
+*  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
+*  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  csr_val     array containing the values of the sparse CSR matrix.
 *  @param[in]
-*  csc_val     array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  csc_col_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  csr_col_ind array containing the column indices of the sparse CSR matrix.
 *  @param[in]
-*  csc_row_ind integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  ell_width   number of non-zero elements per row in ELL storage format.
 *  @param[out]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
 *  @param[out]
-*  ld          leading dimension of dense array \p A.
+*  ell_col_ind array of \p m times \p ell_width elements containing the column indices
+*              of the sparse ELL matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p csc_val \p csc_col_ptr or \p csc_row_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
+*              \p ell_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into an ELL matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
+*
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
+*
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*
+*      // Create ELL matrix descriptor
+*      rocsparse_mat_descr ell_descr;
+*      rocsparse_create_mat_descr(&ell_descr);
+*
+*      // Obtain the ELL width
+*      rocsparse_int ell_width;
+*      rocsparse_csr2ell_width(handle,
+*                              m,
+*                              csr_descr,
+*                              csr_row_ptr,
+*                              ell_descr,
+*                              &ell_width);
+*
+*      // Compute ELL non-zero entries
+*      rocsparse_int ell_nnz = m * ell_width;
+*
+*      // Allocate ELL column and value arrays
+*      rocsparse_int* ell_col_ind;
+*      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+*
+*      float* ell_val;
+*      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+*
+*      // Format conversion
+*      rocsparse_scsr2ell(handle,
+*                         m,
+*                         csr_descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         ell_descr,
+*                         ell_width,
+*                         ell_val,
+*                         ell_col_ind);
+*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsc2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              csc_val,
-                                      const rocsparse_int*      csc_col_ptr,
-                                      const rocsparse_int*      csc_row_ind,
-                                      float*                    A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    float*                    ell_val,
+                                    rocsparse_int*            ell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsc2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             csc_val,
-                                      const rocsparse_int*      csc_col_ptr,
-                                      const rocsparse_int*      csc_row_ind,
-                                      double*                   A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    double*                   ell_val,
+                                    rocsparse_int*            ell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsc2dense(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* csc_val,
-                                      const rocsparse_int*           csc_col_ptr,
-                                      const rocsparse_int*           csc_row_ind,
-                                      rocsparse_float_complex*       A,
-                                      rocsparse_int                  ld);
+rocsparse_status rocsparse_ccsr2ell(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    const rocsparse_mat_descr      csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    const rocsparse_mat_descr      ell_descr,
+                                    rocsparse_int                  ell_width,
+                                    rocsparse_float_complex*       ell_val,
+                                    rocsparse_int*                 ell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsc2dense(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* csc_val,
-                                      const rocsparse_int*            csc_col_ptr,
-                                      const rocsparse_int*            csc_row_ind,
-                                      rocsparse_double_complex*       A,
-                                      rocsparse_int                   ld);
+rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    const rocsparse_mat_descr       csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    const rocsparse_mat_descr       ell_descr,
+                                    rocsparse_int                   ell_width,
+                                    rocsparse_double_complex*       ell_val,
+                                    rocsparse_int*                  ell_col_ind);
 /**@}*/
 
 /*! \ingroup conv_module
-*  Given a sparse CSR matrix and a non-negative tolerance, this function computes how many entries would be left
-*  in each row of the matrix if elements less than the tolerance were removed. It also computes the total number
-*  of remaining elements in the matrix.
+*  \brief Compute the mapping of CSR entries onto an ELL matrix
 *
-*  @param[in]
-*  handle        handle to the rocsparse library context queue.
+*  \details
+*  \p rocsparse_csr2ell_map computes the position of every entry of a CSR matrix in the
+*  value array of its ELL representation, as obtained by rocsparse_scsr2ell(),
+*  rocsparse_dcsr2ell(), rocsparse_ccsr2ell() and rocsparse_zcsr2ell(). As long as the
+*  sparsity pattern does not change, the ELL values can then be refreshed from new CSR
+*  values by a single call to rocsparse_ssctr(), rocsparse_dsctr(), rocsparse_csctr()
+*  or rocsparse_zsctr(). The padding of the ELL matrix is left untouched.
 *
-*  @param[in]
-*  m             number of rows of the sparse CSR matrix.
+*  \note
+*  \p ell_width has to be at least the maximum number of non-zero entries per row, as
+*  computed by rocsparse_csr2ell_width(). Entries that do not fit into the ELL matrix
+*  are marked with -1.
 *
-*  @param[in]
-*  descr_A       the descriptor of the sparse CSR matrix.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  csr_val_A     array of \p nnz_A elements of the sparse CSR matrix.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
-*                uncompressed sparse CSR matrix.
-*  @param[out]
-*  nnz_per_row   array of length \p m containing the number of entries that will be kept per row in
-*                the final compressed CSR matrix.
-*  @param[out]
-*  nnz_C         number of elements in the column indices and values arrays of the compressed
-*                sparse CSR matrix. Can be either host or device pointer.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  tol           the non-negative tolerance used for compression. If \p tol is complex then only the magnitude
-*                of the real part is used. Entries in the input uncompressed CSR array that are below the tolerance
-*                are removed in output compressed CSR matrix.
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  ell_width   number of non-zero elements per row in ELL storage format.
+*  @param[out]
+*  ell_map     array of \p nnz elements containing the zero based position of each CSR
+*              entry in the ELL value array.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
-*  \retval     rocsparse_status_invalid_value \p tol is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_val_A or \p csr_row_ptr_A or \p nnz_per_row or \p nnz_C
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+*  \retval     rocsparse_status_invalid_value the index base of \p csr_descr is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr or
+*              \p ell_map pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_snnz_compress(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr descr_A,
-                                         const float*              csr_val_A,
-                                         const rocsparse_int*      csr_row_ptr_A,
-                                         rocsparse_int*            nnz_per_row,
-                                         rocsparse_int*            nnz_C,
-                                         float                     tol);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dnnz_compress(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr descr_A,
-                                         const double*             csr_val_A,
-                                         const rocsparse_int*      csr_row_ptr_A,
-                                         rocsparse_int*            nnz_per_row,
-                                         rocsparse_int*            nnz_C,
-                                         double                    tol);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cnnz_compress(rocsparse_handle               handle,
-                                         rocsparse_int                  m,
-                                         const rocsparse_mat_descr      descr_A,
-                                         const rocsparse_float_complex* csr_val_A,
-                                         const rocsparse_int*           csr_row_ptr_A,
-                                         rocsparse_int*                 nnz_per_row,
-                                         rocsparse_int*                 nnz_C,
-                                         rocsparse_float_complex        tol);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_znnz_compress(rocsparse_handle                handle,
-                                         rocsparse_int                   m,
-                                         const rocsparse_mat_descr       descr_A,
-                                         const rocsparse_double_complex* csr_val_A,
-                                         const rocsparse_int*            csr_row_ptr_A,
-                                         rocsparse_int*                  nnz_per_row,
-                                         rocsparse_int*                  nnz_C,
-                                         rocsparse_double_complex        tol);
-/**@}*/
+rocsparse_status rocsparse_csr2ell_map(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       const rocsparse_mat_descr csr_descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       rocsparse_int             ell_width,
+                                       rocsparse_int*            ell_map);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse COO matrix
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
 *
 *  \details
-*  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
-*  to the start of every row, into a COO array of row indices.
+*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
+*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
 *
 *  \note
-*  It can also be used to convert a CSC array containing the column offsets into a COO
-*  array of column indices.
+*  This function requires a significant amount of storage for the HYB matrix,
+*  depending on the matrix structure.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function is blocking with respect to the host, since the storage of the HYB
+*  matrix is allocated by the library. rocsparse_csr2hyb_nnz() and
+*  rocsparse_scsr2hyb_ex(), rocsparse_dcsr2hyb_ex(), rocsparse_ccsr2hyb_ex() or
+*  rocsparse_zcsr2hyb_ex() perform the conversion into storage that is allocated by
+*  the user.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row
-*              of the sparse CSR matrix.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  n               number of columns of the sparse CSR matrix.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
 *  @param[out]
-*  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
-*              matrix.
+*  hyb             sparse matrix in HYB format.
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  @param[in]
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
-*              pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+*              allocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example converts a CSR matrix into a COO matrix.
+*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
 *  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
+*      // Create HYB matrix structure
+*      rocsparse_hyb_mat hyb;
+*      rocsparse_create_hyb_mat(&hyb);
 *
-*      rocsparse_int m   = 3;
-*      rocsparse_int n   = 5;
-*      rocsparse_int nnz = 8;
+*      // User defined ell width
+*      rocsparse_int user_ell_width = 5;
 *
-*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*      // Perform the conversion
+*      rocsparse_scsr2hyb(handle,
+*                         m,
+*                         n,
+*                         descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         hyb,
+*                         user_ell_width,
+*                         rocsparse_hyb_partition_user);
 *
-*      // Allocate COO matrix arrays
-*      rocsparse_int* coo_row_ind;
-*      rocsparse_int* coo_col_ind;
-*      float* coo_val;
+*      // Do some work
 *
-*      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
-*      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
-*      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+*      // Clean up
+*      rocsparse_destroy_hyb_mat(hyb);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_hyb_mat              hyb,
+                                    rocsparse_int                  user_ell_width,
+                                    rocsparse_hyb_partition        partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_hyb_mat               hyb,
+                                    rocsparse_int                   user_ell_width,
+                                    rocsparse_hyb_partition         partition_type);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
 *
-*      // Convert the csr row offsets into coo row indices
-*      rocsparse_csr2coo(handle,
-*                        csr_row_ptr,
-*                        nnz,
-*                        m,
-*                        coo_row_ind,
-*                        rocsparse_index_base_zero);
+*  \details
+*  \p rocsparse_csr2hyb_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csr2hyb_nnz() and rocsparse_scsr2hyb_ex(),
+*  rocsparse_dcsr2hyb_ex(), rocsparse_ccsr2hyb_ex() or rocsparse_zcsr2hyb_ex(). The
+*  temporary storage buffer must be allocated by the user.
 *
-*      // Copy the column and value arrays
-*      hipMemcpy(coo_col_ind,
-*                csr_col_ind,
-*                sizeof(rocsparse_int) * nnz,
-*                hipMemcpyDeviceToDevice);
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csr2hyb_nnz() and rocsparse_Xcsr2hyb_ex().
 *
-*      hipMemcpy(coo_val,
-*                csr_val,
-*                sizeof(float) * nnz,
-*                hipMemcpyDeviceToDevice);
-*  \endcode
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p buffer_size
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
-                                   const rocsparse_int* csr_row_ptr,
-                                   rocsparse_int        nnz,
-                                   rocsparse_int        m,
-                                   rocsparse_int*       coo_row_ind,
-                                   rocsparse_index_base idx_base);
+rocsparse_status rocsparse_csr2hyb_buffer_size(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               const rocsparse_int* csr_row_ptr,
+                                               size_t*              buffer_size);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
 *
 *  \details
-*  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
-*  required by rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
-*  rocsparse_zcsr2csc(). The temporary storage buffer must be allocated by the user.
+*  \p rocsparse_csr2hyb_nnz computes the width of the ELL part \p ell_width and the
+*  number of non-zero entries of the COO part \p coo_nnz of the HYB matrix for a given
+*  CSR matrix and partitioning. The ELL part requires \p ell_width \f$\cdot\f$ \p m
+*  elements. The COO row offsets are kept in \p temp_buffer for the subsequent
+*  conversion by rocsparse_Xcsr2hyb_ex().
+*
+*  In contrast to rocsparse_Xcsr2hyb(), \p user_ell_width is not limited with respect
+*  to the average number of non-zero entries per row, since the storage of the HYB
+*  matrix is allocated by the user.
+*
+*  \note
+*  The routine does support asynchronous execution if the pointer mode is set to device.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  n               number of columns of the sparse CSR matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
 *  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
 *  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
-*              rocsparse_zcsr2csc().
+*  ell_width       pointer to the width of the ELL part of the HYB matrix.
+*  @param[out]
+*  coo_nnz         pointer to the number of non-zero entries of the COO part of the HYB
+*                  matrix.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csr2hyb_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
-*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type or \p user_ell_width
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p ell_width, \p coo_nnz or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
-                                               rocsparse_int        m,
-                                               rocsparse_int        n,
-                                               rocsparse_int        nnz,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_action     copy_values,
-                                               size_t*              buffer_size);
+rocsparse_status rocsparse_csr2hyb_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       rocsparse_int             user_ell_width,
+                                       rocsparse_hyb_partition   partition_type,
+                                       rocsparse_int*            ell_width,
+                                       rocsparse_int*            coo_nnz,
+                                       void*                     temp_buffer);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
 *
 *  \details
-*  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
-*  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
-*  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
-*  or not (\ref rocsparse_action_symbolic).
-*
-*  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
-*  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
-*
-*  \note
-*  The resulting matrix can also be seen as the transpose of the input matrix.
+*  \p rocsparse_csr2hyb_ex converts a CSR matrix into a HYB matrix, using storage that
+*  is allocated by the user. It is assumed that \p ell_col_ind and \p ell_val are
+*  allocated with \p ell_width \f$\cdot\f$ \p m elements, that \p coo_row_ind,
+*  \p coo_col_ind and \p coo_val are allocated with \p coo_nnz elements, and that
+*  \p ell_width, \p coo_nnz and \p temp_buffer have been obtained by
+*  rocsparse_csr2hyb_nnz() with the same \p partition_type. The HYB matrix \p hyb
+*  refers to the user storage, which must stay valid for the lifetime of \p hyb and is
+*  not released by rocsparse_destroy_hyb_mat().
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  It may return before the actual computation has finished. If \p hyb holds storage
+*  of a previous call to rocsparse_Xcsr2hyb(), this storage is released, which blocks.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  n               number of columns of the sparse CSR matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  csr_val         array containing the values of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  csc_val     array of \p nnz elements of the sparse CSC matrix.
-*  @param[out]
-*  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
-*              matrix.
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
 *  @param[out]
-*  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
-*              sparse CSC matrix.
+*  hyb             sparse matrix in HYB format.
 *  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  partition_type  partitioning that has been passed to rocsparse_csr2hyb_nnz().
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  ell_width       width of the ELL part, computed by rocsparse_csr2hyb_nnz().
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_csr2csc_buffer_size().
+*  coo_nnz         number of non-zero entries of the COO part, computed by
+*                  rocsparse_csr2hyb_nnz().
+*  @param[out]
+*  ell_col_ind     array of \p ell_width \f$\cdot\f$ \p m elements containing the
+*                  column indices of the ELL part.
+*  @param[out]
+*  ell_val         array of \p ell_width \f$\cdot\f$ \p m elements containing the
+*                  values of the ELL part.
+*  @param[out]
+*  coo_row_ind     array of \p coo_nnz elements containing the row indices of the COO
+*                  part.
+*  @param[out]
+*  coo_col_ind     array of \p coo_nnz elements containing the column indices of the
+*                  COO part.
+*  @param[out]
+*  coo_val         array of \p coo_nnz elements containing the values of the COO part.
+*  @param[in]
+*  temp_buffer     temporary storage buffer that has been passed to
+*                  rocsparse_csr2hyb_nnz().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
-*              \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p ell_width or \p coo_nnz
+*              is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p ell_col_ind, \p ell_val,
+*              \p coo_row_ind, \p coo_col_ind, \p coo_val or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example computes the transpose of a CSR matrix.
+*  This example converts a CSR matrix into a HYB matrix without blocking the host.
 *  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
-*
-*      rocsparse_int m_A   = 3;
-*      rocsparse_int n_A   = 5;
-*      rocsparse_int nnz_A = 8;
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csr2hyb_buffer_size(handle, m, n, csr_row_ptr, &buffer_size);
 *
-*      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
 *
-*      // Allocate memory for transposed CSR matrix
-*      rocsparse_int m_T   = n_A;
-*      rocsparse_int n_T   = m_A;
-*      rocsparse_int nnz_T = nnz_A;
+*      // Compute the HYB partitioning into device memory
+*      rocsparse_int* d_sizes;
+*      hipMalloc((void**)&d_sizes, sizeof(rocsparse_int) * 2);
 *
-*      rocsparse_int* csr_row_ptr_T;
-*      rocsparse_int* csr_col_ind_T;
-*      float* csr_val_T;
+*      rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device);
+*      rocsparse_csr2hyb_nnz(handle,
+*                            m,
+*                            n,
+*                            descr,
+*                            csr_row_ptr,
+*                            0,
+*                            rocsparse_hyb_partition_auto,
+*                            &d_sizes[0],
+*                            &d_sizes[1],
+*                            temp_buffer);
 *
-*      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
-*      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
-*      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+*      // Do some other work, then obtain the sizes to allocate the HYB storage
+*      rocsparse_int h_sizes[2];
+*      hipMemcpy(h_sizes, d_sizes, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost);
 *
-*      // Obtain the temporary buffer size
-*      size_t buffer_size;
-*      rocsparse_csr2csc_buffer_size(handle,
-*                                    m_A,
-*                                    n_A,
-*                                    nnz_A,
-*                                    csr_row_ptr_A,
-*                                    csr_col_ind_A,
-*                                    rocsparse_action_numeric,
-*                                    &buffer_size);
+*      rocsparse_int ell_width = h_sizes[0];
+*      rocsparse_int coo_nnz   = h_sizes[1];
 *
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*      rocsparse_int* ell_col_ind;
+*      float*         ell_val;
+*      rocsparse_int* coo_row_ind;
+*      rocsparse_int* coo_col_ind;
+*      float*         coo_val;
+*      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_width * m);
+*      hipMalloc((void**)&ell_val, sizeof(float) * ell_width * m);
+*      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * coo_nnz);
+*      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * coo_nnz);
+*      hipMalloc((void**)&coo_val, sizeof(float) * coo_nnz);
 *
-*      rocsparse_scsr2csc(handle,
-*                         m_A,
-*                         n_A,
-*                         nnz_A,
-*                         csr_val_A,
-*                         csr_row_ptr_A,
-*                         csr_col_ind_A,
-*                         csr_val_T,
-*                         csr_col_ind_T,
-*                         csr_row_ptr_T,
-*                         rocsparse_action_numeric,
-*                         rocsparse_index_base_zero,
-*                         temp_buffer);
+*      // Perform the conversion
+*      rocsparse_scsr2hyb_ex(handle,
+*                            m,
+*                            n,
+*                            descr,
+*                            csr_val,
+*                            csr_row_ptr,
+*                            csr_col_ind,
+*                            hyb,
+*                            rocsparse_hyb_partition_auto,
+*                            ell_width,
+*                            coo_nnz,
+*                            ell_col_ind,
+*                            ell_val,
+*                            coo_row_ind,
+*                            coo_col_ind,
+*                            coo_val,
+*                            temp_buffer);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const float*         csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    float*               csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const double*        csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    double*              csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
+rocsparse_status rocsparse_scsr2hyb_ex(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_hyb_mat         hyb,
+                                       rocsparse_hyb_partition   partition_type,
+                                       rocsparse_int             ell_width,
+                                       rocsparse_int             coo_nnz,
+                                       rocsparse_int*            ell_col_ind,
+                                       float*                    ell_val,
+                                       rocsparse_int*            coo_row_ind,
+                                       rocsparse_int*            coo_col_ind,
+                                       float*                    coo_val,
+                                       void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2csc(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    rocsparse_int                  nnz,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_float_complex*       csc_val,
-                                    rocsparse_int*                 csc_row_ind,
-                                    rocsparse_int*                 csc_col_ptr,
-                                    rocsparse_action               copy_values,
-                                    rocsparse_index_base           idx_base,
-                                    void*                          temp_buffer);
+rocsparse_status rocsparse_dcsr2hyb_ex(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_hyb_mat         hyb,
+                                       rocsparse_hyb_partition   partition_type,
+                                       rocsparse_int             ell_width,
+                                       rocsparse_int             coo_nnz,
+                                       rocsparse_int*            ell_col_ind,
+                                       double*                   ell_val,
+                                       rocsparse_int*            coo_row_ind,
+                                       rocsparse_int*            coo_col_ind,
+                                       double*                   coo_val,
+                                       void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2csc(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    rocsparse_int                   nnz,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_double_complex*       csc_val,
-                                    rocsparse_int*                  csc_row_ind,
-                                    rocsparse_int*                  csc_col_ptr,
-                                    rocsparse_action                copy_values,
-                                    rocsparse_index_base            idx_base,
-                                    void*                           temp_buffer);
+rocsparse_status rocsparse_ccsr2hyb_ex(rocsparse_handle               handle,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  n,
+                                       const rocsparse_mat_descr      descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int*           csr_row_ptr,
+                                       const rocsparse_int*           csr_col_ind,
+                                       rocsparse_hyb_mat              hyb,
+                                       rocsparse_hyb_partition        partition_type,
+                                       rocsparse_int                  ell_width,
+                                       rocsparse_int                  coo_nnz,
+                                       rocsparse_int*                 ell_col_ind,
+                                       rocsparse_float_complex*       ell_val,
+                                       rocsparse_int*                 coo_row_ind,
+                                       rocsparse_int*                 coo_col_ind,
+                                       rocsparse_float_complex*       coo_val,
+                                       void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb_ex(rocsparse_handle                handle,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   n,
+                                       const rocsparse_mat_descr       descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int*            csr_row_ptr,
+                                       const rocsparse_int*            csr_col_ind,
+                                       rocsparse_hyb_mat               hyb,
+                                       rocsparse_hyb_partition         partition_type,
+                                       rocsparse_int                   ell_width,
+                                       rocsparse_int                   coo_nnz,
+                                       rocsparse_int*                  ell_col_ind,
+                                       rocsparse_double_complex*       ell_val,
+                                       rocsparse_int*                  coo_row_ind,
+                                       rocsparse_int*                  coo_col_ind,
+                                       rocsparse_double_complex*       coo_val,
+                                       void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+*  \brief Compute the mapping of CSR entries onto a HYB matrix
 *
 *  \details
-*  \p rocsparse_gebsr2gebsc_buffer_size returns the size of the temporary storage buffer
-*  required by rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
-*  rocsparse_zgebsr2gebsc(). The temporary storage buffer must be allocated by the user.
+*  \p rocsparse_csr2hyb_map computes the position of every entry of a CSR matrix in the
+*  HYB matrix \p hyb that has been obtained from it by rocsparse_scsr2hyb(),
+*  rocsparse_dcsr2hyb(), rocsparse_ccsr2hyb() or rocsparse_zcsr2hyb(). Positions of the
+*  ELL part are given by \f$[0, ell\_nnz)\f$, positions of the COO part are shifted by
+*  the number of ELL entries. As long as the sparsity pattern does not change, the HYB
+*  values can then be refreshed by rocsparse_scsr2hyb_values(),
+*  rocsparse_dcsr2hyb_values(), rocsparse_ccsr2hyb_values() or
+*  rocsparse_zcsr2hyb_values(), without recomputing the partitioning.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  mb           number of rows of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nb           number of columns of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nnzb         number of non-zero entries of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_val     array of \p nnzb*row_block_dim*col_block_dim containing the values of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_row_ptr array of \p mb+1 elements that point to the start of every row of the
-*              sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_col_ind array of \p nnzb elements containing the column indices of the sparse
-*              GEneral BSR matrix.
+*  descr       descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
-
+*  hyb         sparse matrix in HYB format, converted from the CSR matrix.
 *  @param[out]
-*  p_buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
-*              rocsparse_zgebsr2gebsc().
+*  hyb_map     array of \p nnz elements containing the position of each CSR entry in
+*              the HYB matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr, \p bsr_col_ind or
-*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_value the index base of \p descr is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_row_ptr or
+*              \p hyb_map pointer is invalid.
+*  \retval     rocsparse_status_memory_error the temporary buffer could not be
+*              allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgebsr2gebsc_buffer_size(rocsparse_handle     handle,
-                                                    rocsparse_int        mb,
-                                                    rocsparse_int        nb,
-                                                    rocsparse_int        nnzb,
-                                                    const float*         bsr_val,
-                                                    const rocsparse_int* bsr_row_ptr,
-                                                    const rocsparse_int* bsr_col_ind,
-                                                    rocsparse_int        row_block_dim,
-                                                    rocsparse_int        col_block_dim,
-                                                    size_t*              p_buffer_size);
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgebsr2gebsc_buffer_size(rocsparse_handle     handle,
-                                                    rocsparse_int        mb,
-                                                    rocsparse_int        nb,
-                                                    rocsparse_int        nnzb,
-                                                    const double*        bsr_val,
-                                                    const rocsparse_int* bsr_row_ptr,
-                                                    const rocsparse_int* bsr_col_ind,
-                                                    rocsparse_int        row_block_dim,
-                                                    rocsparse_int        col_block_dim,
-                                                    size_t*              p_buffer_size);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgebsr2gebsc_buffer_size(rocsparse_handle               handle,
-                                                    rocsparse_int                  mb,
-                                                    rocsparse_int                  nb,
-                                                    rocsparse_int                  nnzb,
-                                                    const rocsparse_float_complex* bsr_val,
-                                                    const rocsparse_int*           bsr_row_ptr,
-                                                    const rocsparse_int*           bsr_col_ind,
-                                                    rocsparse_int                  row_block_dim,
-                                                    rocsparse_int                  col_block_dim,
-                                                    size_t*                        p_buffer_size);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle                handle,
-                                                    rocsparse_int                   mb,
-                                                    rocsparse_int                   nb,
-                                                    rocsparse_int                   nnzb,
-                                                    const rocsparse_double_complex* bsr_val,
-                                                    const rocsparse_int*            bsr_row_ptr,
-                                                    const rocsparse_int*            bsr_col_ind,
-                                                    rocsparse_int                   row_block_dim,
-                                                    rocsparse_int                   col_block_dim,
-                                                    size_t*                         p_buffer_size);
-
-/**@}*/
+rocsparse_status rocsparse_csr2hyb_map(rocsparse_handle          handle,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_hyb_mat   hyb,
+                                       rocsparse_int*            hyb_map);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+*  \brief Refresh the values of a HYB matrix from a CSR matrix
 *
 *  \details
-*  \p rocsparse_gebsr2gebsc converts a GEneral BSR matrix into a GEneral BSC matrix. \p rocsparse_gebsr2gebsc
-*  can also be used to convert a GEneral BSC matrix into a GEneral BSR matrix. \p copy_values decides
-*  whether \p bsc_val is being filled during conversion (\ref rocsparse_action_numeric)
-*  or not (\ref rocsparse_action_symbolic).
-*
-*  \p rocsparse_gebsr2gebsc requires extra temporary storage buffer that has to be allocated
-*  by the user. Storage buffer size can be determined by rocsparse_gebsr2gebsc_buffer_size().
-*
-*  \note
-*  The resulting matrix can also be seen as the transpose of the input matrix.
+*  \p rocsparse_csr2hyb_values copies the values of a CSR matrix into the HYB matrix
+*  \p hyb, using the mapping computed by rocsparse_csr2hyb_map(). The sparsity pattern
+*  of the CSR matrix must be the one that \p hyb has been converted from.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -8888,278 +12572,244 @@ rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  mb          number of rows of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nb          number of columns of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nnzb        number of non-zero entries of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_val     array of \p nnzb * \p row_block_dim * \p col_block_dim  elements of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              GEneral BSR matrix.
-*  @param[in]
-*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
-*  @param[in]
-*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
-*  @param[out]
-*  bsc_val     array of \p nnz elements of the sparse BSC matrix.
-*  @param[out]
-*  bsc_row_ind array of \p nnz elements containing the row indices of the sparse BSC
-*              matrix.
-*  @param[out]
-*  bsc_col_ptr array of \p n+1 elements that point to the start of every column of the
-*              sparse BSC matrix.
-*  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  csr_val     array of \p nnz elements containing the values of the sparse CSR matrix.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_gebsr2gebsc_buffer_size().
+*  hyb_map     array of \p nnz elements computed by rocsparse_csr2hyb_map().
+*  @param[inout]
+*  hyb         sparse matrix in HYB format.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_val, \p bsr_row_ptr,
-*              \p bsr_col_ind, \p bsc_val, \p bsc_row_ind, \p bsc_col_ptr or
-*              \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p hyb_map or \p hyb
+*              pointer is invalid.
 *
 *  \par Example
-*  This example computes the transpose of a GEneral BSR matrix.
 *  \code{.c}
-*      //     1 2 0 3
-*      // A = 0 4 5 0
-*      //     6 0 0 7
-*      //     1 2 3 4
-*
-*      rocsparse_int mb_A   = 2;
-*      rocsparse_int row_block_dim = 2;
-*      rocsparse_int col_block_dim = 2;
-*      rocsparse_int nb_A   = 2;
-*      rocsparse_int nnzb_A = 4;
-*
-*      bsr_row_ptr_A[mb_A+1] = {0, 2, 4};               // device memory
-*      bsr_col_ind_A[nnzb_A] = {0, 1, 0, 1}; // device memory
-*      bsr_val_A[nnzb_A]     = {1, 0, 2, 4, 0, 5, 3, 0, 6, 1, 0, 2, 0, 3, 7, 4}; // device memory
-*
-*      // Allocate memory for transposed BSR matrix
-*      rocsparse_int mb_T   = nb_A;
-*      rocsparse_int nb_T   = mb_A;
-*      rocsparse_int nnzb_T = nnzb_A;
-*
-*      rocsparse_int* bsr_row_ptr_T;
-*      rocsparse_int* bsr_col_ind_T;
-*      float* bsr_val_T;
-*
-*      hipMalloc((void**)&bsr_row_ptr_T, sizeof(rocsparse_int) * (mb_T + 1));
-*      hipMalloc((void**)&bsr_col_ind_T, sizeof(rocsparse_int) * nnzb_T);
-*      hipMalloc((void**)&bsr_val_T, sizeof(float) * nnzb_T);
-*
-*      // Obtain the temporary buffer size
-*      size_t buffer_size;
-*      rocsparse_gebsr2gebsc_buffer_size(handle,
-*                                    mb_A,
-*                                    nb_A,
-*                                    nnzb_A,
-*                                    bsr_row_ptr_A,
-*                                    bsr_col_ind_A,
-*                                    rocsparse_action_numeric,
-*                                    &buffer_size);
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*      // Convert once and record the mapping
+*      rocsparse_scsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, hyb, 0,
+*                         rocsparse_hyb_partition_auto);
+*      rocsparse_csr2hyb_map(handle, descr, csr_row_ptr, hyb, hyb_map);
 *
-*      rocsparse_sgebsr2gebsc(handle,
-*                         mb_A,
-*                         nb_A,
-*                         nnzb_A,
-*                         bsr_val_A,
-*                         bsr_row_ptr_A,
-*                         bsr_col_ind_A,
-*                         row_block_dim,
-*                         col_block_dim,
-*                         bsr_val_T,
-*                         bsr_col_ind_T,
-*                         bsr_row_ptr_T,
-*                         rocsparse_action_numeric,
-*                         rocsparse_index_base_zero,
-*                         temp_buffer);
+*      // Refresh the HYB values after csr_val has changed
+*      rocsparse_scsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb);
 *  \endcode
 */
 /**@{*/
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgebsr2gebsc(rocsparse_handle     handle,
-                                        rocsparse_int        mb,
-                                        rocsparse_int        nb,
-                                        rocsparse_int        nnzb,
-                                        const float*         bsr_val,
-                                        const rocsparse_int* bsr_row_ptr,
-                                        const rocsparse_int* bsr_col_ind,
-                                        rocsparse_int        row_block_dim,
-                                        rocsparse_int        col_block_dim,
-                                        float*               bsc_val,
-                                        rocsparse_int*       bsc_row_ind,
-                                        rocsparse_int*       bsc_col_ptr,
-                                        rocsparse_action     copy_values,
-                                        rocsparse_index_base idx_base,
-                                        void*                temp_buffer);
+rocsparse_status rocsparse_scsr2hyb_values(rocsparse_handle     handle,
+                                           rocsparse_int        nnz,
+                                           const float*         csr_val,
+                                           const rocsparse_int* hyb_map,
+                                           rocsparse_hyb_mat    hyb);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgebsr2gebsc(rocsparse_handle     handle,
-                                        rocsparse_int        mb,
-                                        rocsparse_int        nb,
-                                        rocsparse_int        nnzb,
-                                        const double*        bsr_val,
-                                        const rocsparse_int* bsr_row_ptr,
-                                        const rocsparse_int* bsr_col_ind,
-                                        rocsparse_int        row_block_dim,
-                                        rocsparse_int        col_block_dim,
-                                        double*              bsc_val,
-                                        rocsparse_int*       bsc_row_ind,
-                                        rocsparse_int*       bsc_col_ptr,
-                                        rocsparse_action     copy_values,
-                                        rocsparse_index_base idx_base,
-                                        void*                temp_buffer);
+rocsparse_status rocsparse_dcsr2hyb_values(rocsparse_handle     handle,
+                                           rocsparse_int        nnz,
+                                           const double*        csr_val,
+                                           const rocsparse_int* hyb_map,
+                                           rocsparse_hyb_mat    hyb);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgebsr2gebsc(rocsparse_handle               handle,
-                                        rocsparse_int                  mb,
-                                        rocsparse_int                  nb,
-                                        rocsparse_int                  nnzb,
-                                        const rocsparse_float_complex* bsr_val,
-                                        const rocsparse_int*           bsr_row_ptr,
-                                        const rocsparse_int*           bsr_col_ind,
-                                        rocsparse_int                  row_block_dim,
-                                        rocsparse_int                  col_block_dim,
-                                        rocsparse_float_complex*       bsc_val,
-                                        rocsparse_int*                 bsc_row_ind,
-                                        rocsparse_int*                 bsc_col_ptr,
-                                        rocsparse_action               copy_values,
-                                        rocsparse_index_base           idx_base,
-                                        void*                          temp_buffer);
+rocsparse_status rocsparse_ccsr2hyb_values(rocsparse_handle               handle,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           hyb_map,
+                                           rocsparse_hyb_mat              hyb);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgebsr2gebsc(rocsparse_handle                handle,
-                                        rocsparse_int                   mb,
-                                        rocsparse_int                   nb,
-                                        rocsparse_int                   nnzb,
-                                        const rocsparse_double_complex* bsr_val,
-                                        const rocsparse_int*            bsr_row_ptr,
-                                        const rocsparse_int*            bsr_col_ind,
-                                        rocsparse_int                   row_block_dim,
-                                        rocsparse_int                   col_block_dim,
-                                        rocsparse_double_complex*       bsc_val,
-                                        rocsparse_int*                  bsc_row_ind,
-                                        rocsparse_int*                  bsc_col_ptr,
-                                        rocsparse_action                copy_values,
-                                        rocsparse_index_base            idx_base,
-                                        void*                           temp_buffer);
-
+rocsparse_status rocsparse_zcsr2hyb_values(rocsparse_handle                handle,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            hyb_map,
+                                           rocsparse_hyb_mat               hyb);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-\f$\sigma\f$ matrix
 *
 *  \details
-*  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
-*  over all rows, the ELL \p width, for a given CSR matrix.
+*  \p rocsparse_csr2sellc_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csr2sellc_nnz(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_sigma      number of consecutive rows that are sorted by their number of
+*                  non-zero elements.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csr2sellc_nnz().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p sell_slice_size or
+*              \p sell_sigma is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p buffer_size
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2sellc_buffer_size(rocsparse_handle     handle,
+                                                 rocsparse_int        m,
+                                                 rocsparse_int        n,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 rocsparse_int        sell_slice_size,
+                                                 rocsparse_int        sell_sigma,
+                                                 size_t*              buffer_size);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-\f$\sigma\f$ matrix
+*
+*  \details
+*  \p rocsparse_csr2sellc_nnz computes the row permutation \p sell_perm, the slice
+*  pointer array \p sell_slice_ptr and the total number of stored (including padded)
+*  elements \p sell_nnz of a SELL-C-\f$\sigma\f$ matrix for a given CSR matrix. The rows
+*  of the CSR matrix are partitioned into consecutive windows of \p sell_sigma rows and
+*  the rows of each window are sorted by their number of non-zero elements in
+*  descending order. Rows of equal length keep their original order. The permuted rows
+*  are then grouped into slices of \p sell_slice_size rows, and each slice is padded to
+*  the length of its longest row.
+*
+*  The padding overhead \f$\text{sell_nnz} - \text{nnz}\f$ can be used to tune
+*  \p sell_sigma. Larger windows reduce the padding, but decrease the locality of the
+*  accesses to \f$y\f$ in rocsparse_sellcmv(). \p sell_sigma = 1 keeps the original row
+*  order.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  The routine does support asynchronous execution if the pointer mode is set to device.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  n               number of columns of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_sigma      number of consecutive rows that are sorted by their number of
+*                  non-zero elements.
 *  @param[out]
-*  ell_width   pointer to the number of non-zero elements per row in ELL storage
-*              format.
+*  sell_slice_ptr  array of \p nslices+1 elements that point to the start of every
+*                  slice of the sparse SELL-C-\f$\sigma\f$ matrix, where
+*                  \f$\text{nslices} = \lceil m / \text{sell_slice_size} \rceil\f$.
+*  @param[out]
+*  sell_perm       array of \p m elements that maps the rows of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix to the rows of the sparse CSR matrix.
+*  @param[out]
+*  sell_nnz        pointer to the total number of stored elements of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix, including padding.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csr2sellc_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
-*              \p ell_width pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n, \p sell_slice_size or
+*              \p sell_sigma is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+*              \p sell_descr, \p sell_slice_ptr, \p sell_perm, \p sell_nnz or
+*              \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
+rocsparse_status rocsparse_csr2sellc_nnz(rocsparse_handle          handle,
                                          rocsparse_int             m,
+                                         rocsparse_int             n,
                                          const rocsparse_mat_descr csr_descr,
                                          const rocsparse_int*      csr_row_ptr,
-                                         const rocsparse_mat_descr ell_descr,
-                                         rocsparse_int*            ell_width);
+                                         const rocsparse_mat_descr sell_descr,
+                                         rocsparse_int             sell_slice_size,
+                                         rocsparse_int             sell_sigma,
+                                         rocsparse_int*            sell_slice_ptr,
+                                         rocsparse_int*            sell_perm,
+                                         rocsparse_int*            sell_nnz,
+                                         void*                     temp_buffer);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-\f$\sigma\f$ matrix
 *
 *  \details
-*  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
-*  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
-*  number of rows times the number of ELL non-zero elements per row, such that
-*  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
-*  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+*  \p rocsparse_csr2sellc converts a CSR matrix into a SELL-C-\f$\sigma\f$ matrix. It is
+*  assumed, that \p sell_val and \p sell_col_ind are allocated with \p sell_nnz
+*  elements, and that \p sell_slice_ptr and \p sell_perm have been computed by
+*  rocsparse_csr2sellc_nnz(). The elements of each slice are stored column by column,
+*  such that the \f$p\f$-th element of the \f$i\f$-th row of slice \f$s\f$ is located at
+*  \f$\text{sell_slice_ptr}[s] + i + p \cdot \text{sell_slice_size}\f$. Padded elements
+*  are set to zero with column index -1.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  n               number of columns of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array containing the values of the sparse CSR matrix.
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_val         array containing the values of the sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array containing the column indices of the sparse CSR matrix.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
 *  @param[in]
-*  ell_width   number of non-zero elements per row in ELL storage format.
+*  sell_descr      descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_slice_ptr  array of \p nslices+1 elements that point to the start of every
+*                  slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_perm       array of \p m elements that maps the rows of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix to the rows of the sparse CSR matrix.
 *  @param[out]
-*  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+*  sell_val        array of \p sell_nnz elements of the sparse SELL-C-\f$\sigma\f$ matrix.
 *  @param[out]
-*  ell_col_ind array of \p m times \p ell_width elements containing the column indices
-*              of the sparse ELL matrix.
+*  sell_col_ind    array of \p sell_nnz elements containing the column indices of the
+*                  sparse SELL-C-\f$\sigma\f$ matrix.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p sell_slice_size is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
-*              \p ell_col_ind pointer is invalid.
+*              \p csr_row_ptr, \p csr_col_ind, \p sell_descr, \p sell_slice_ptr,
+*              \p sell_perm, \p sell_val or \p sell_col_ind pointer is invalid.
 *  \retval     rocsparse_status_not_implemented
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example converts a CSR matrix into an ELL matrix.
+*  This example converts a CSR matrix into a SELL-C-\f$\sigma\f$ matrix.
 *  \code{.c}
 *      //     1 2 0 3 0
 *      // A = 0 4 5 0 0
@@ -9173,222 +12823,389 @@ rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
 *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
 *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
 *
-*      // Create ELL matrix descriptor
-*      rocsparse_mat_descr ell_descr;
-*      rocsparse_create_mat_descr(&ell_descr);
+*      // Slices of 2 rows, sort all rows by their length
+*      rocsparse_int sell_slice_size = 2;
+*      rocsparse_int sell_sigma      = 3;
+*      rocsparse_int nslices         = (m - 1) / sell_slice_size + 1;
 *
-*      // Obtain the ELL width
-*      rocsparse_int ell_width;
-*      rocsparse_csr2ell_width(handle,
+*      // Create SELL-C-sigma matrix descriptor
+*      rocsparse_mat_descr sell_descr;
+*      rocsparse_create_mat_descr(&sell_descr);
+*
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csr2sellc_buffer_size(handle,
+*                                      m,
+*                                      n,
+*                                      csr_row_ptr,
+*                                      sell_slice_size,
+*                                      sell_sigma,
+*                                      &buffer_size);
+*
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Allocate slice pointer and permutation arrays
+*      rocsparse_int* sell_slice_ptr;
+*      rocsparse_int* sell_perm;
+*      hipMalloc((void**)&sell_slice_ptr, sizeof(rocsparse_int) * (nslices + 1));
+*      hipMalloc((void**)&sell_perm, sizeof(rocsparse_int) * m);
+*
+*      // Compute permutation, slice pointers and stored elements
+*      rocsparse_int sell_nnz;
+*      rocsparse_csr2sellc_nnz(handle,
 *                              m,
+*                              n,
 *                              csr_descr,
 *                              csr_row_ptr,
-*                              ell_descr,
-*                              &ell_width);
+*                              sell_descr,
+*                              sell_slice_size,
+*                              sell_sigma,
+*                              sell_slice_ptr,
+*                              sell_perm,
+*                              &sell_nnz,
+*                              temp_buffer);
 *
-*      // Compute ELL non-zero entries
-*      rocsparse_int ell_nnz = m * ell_width;
+*      // Padding overhead is sell_nnz - nnz
 *
-*      // Allocate ELL column and value arrays
-*      rocsparse_int* ell_col_ind;
-*      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+*      // Allocate SELL-C-sigma column and value arrays
+*      rocsparse_int* sell_col_ind;
+*      hipMalloc((void**)&sell_col_ind, sizeof(rocsparse_int) * sell_nnz);
 *
-*      float* ell_val;
-*      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+*      float* sell_val;
+*      hipMalloc((void**)&sell_val, sizeof(float) * sell_nnz);
 *
 *      // Format conversion
-*      rocsparse_scsr2ell(handle,
-*                         m,
-*                         csr_descr,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         ell_descr,
-*                         ell_width,
-*                         ell_val,
-*                         ell_col_ind);
+*      rocsparse_scsr2sellc(handle,
+*                           m,
+*                           n,
+*                           csr_descr,
+*                           csr_val,
+*                           csr_row_ptr,
+*                           csr_col_ind,
+*                           sell_descr,
+*                           sell_slice_size,
+*                           sell_slice_ptr,
+*                           sell_perm,
+*                           sell_val,
+*                           sell_col_ind);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    float*                    ell_val,
-                                    rocsparse_int*            ell_col_ind);
+rocsparse_status rocsparse_scsr2sellc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr csr_descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const rocsparse_mat_descr sell_descr,
+                                      rocsparse_int             sell_slice_size,
+                                      const rocsparse_int*      sell_slice_ptr,
+                                      const rocsparse_int*      sell_perm,
+                                      float*                    sell_val,
+                                      rocsparse_int*            sell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    double*                   ell_val,
-                                    rocsparse_int*            ell_col_ind);
+rocsparse_status rocsparse_dcsr2sellc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr csr_descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const rocsparse_mat_descr sell_descr,
+                                      rocsparse_int             sell_slice_size,
+                                      const rocsparse_int*      sell_slice_ptr,
+                                      const rocsparse_int*      sell_perm,
+                                      double*                   sell_val,
+                                      rocsparse_int*            sell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2ell(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    const rocsparse_mat_descr      csr_descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    const rocsparse_mat_descr      ell_descr,
-                                    rocsparse_int                  ell_width,
-                                    rocsparse_float_complex*       ell_val,
-                                    rocsparse_int*                 ell_col_ind);
+rocsparse_status rocsparse_ccsr2sellc(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      csr_descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      const rocsparse_int*           csr_col_ind,
+                                      const rocsparse_mat_descr      sell_descr,
+                                      rocsparse_int                  sell_slice_size,
+                                      const rocsparse_int*           sell_slice_ptr,
+                                      const rocsparse_int*           sell_perm,
+                                      rocsparse_float_complex*       sell_val,
+                                      rocsparse_int*                 sell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2sellc(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       csr_descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      const rocsparse_int*            csr_col_ind,
+                                      const rocsparse_mat_descr       sell_descr,
+                                      rocsparse_int                   sell_slice_size,
+                                      const rocsparse_int*            sell_slice_ptr,
+                                      const rocsparse_int*            sell_perm,
+                                      rocsparse_double_complex*       sell_val,
+                                      rocsparse_int*                  sell_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse delta compressed CSR matrix
+*
+*  \details
+*  \p rocsparse_csr2csrdelta_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csr2csrdelta_nnz(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  block_dim       number of rows that share the width of their packed offsets.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csr2csrdelta_nnz().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p buffer_size
+*              pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csrdelta_buffer_size(rocsparse_handle     handle,
+                                                    rocsparse_int        m,
+                                                    rocsparse_int        n,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    rocsparse_int        block_dim,
+                                                    size_t*              buffer_size);
 
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse delta compressed CSR matrix
+*
+*  \details
+*  \p rocsparse_csr2csrdelta_nnz computes the width of the packed column offsets
+*  \p csrdelta_width, the block pointer array \p csrdelta_block_ptr and the total number
+*  of words \p csrdelta_nnz of a delta compressed CSR matrix for a given CSR matrix.
+*
+*  The delta compressed CSR format shares \p csr_val and \p csr_row_ptr with the CSR
+*  format, but replaces the column indices. Each row stores its first column index in
+*  \p csrdelta_row_col, and each entry stores the offset of its column index to the first
+*  column index of its row. The rows are partitioned into blocks of \p block_dim rows,
+*  and the offsets of each block are packed with 1, 2 or 4 bytes per entry, depending on
+*  the largest column span \f$\text{csr_col_ind}[\text{last}] -
+*  \text{csr_col_ind}[\text{first}]\f$ of the rows of the block. The packed offsets of
+*  every block start at a word boundary of \p csrdelta_col_ind.
+*
+*  The column indices take \f$\text{csrdelta_nnz} + m\f$ words instead of \p nnz words.
+*  Matrices with clustered column indices benefit the most. Smaller blocks adapt the
+*  width to the local structure of the matrix, at the cost of more block meta data.
+*
+*  \note
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*
+*  \note
+*  The column indices of each row of the CSR matrix have to be sorted.
+*
+*  @param[in]
+*  handle             handle to the rocsparse library context queue.
+*  @param[in]
+*  m                  number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n                  number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descr              descriptor of the sparse CSR matrix. Currently, only
+*                     \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr        array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind        array of \p nnz elements containing the column indices of the
+*                     sparse CSR matrix.
+*  @param[in]
+*  block_dim          number of rows that share the width of their packed offsets.
+*  @param[out]
+*  csrdelta_block_ptr array of \p nblocks+1 elements that point to the start of every
+*                     block of rows in \p csrdelta_col_ind, where
+*                     \f$\text{nblocks} = \lceil m / \text{block_dim} \rceil\f$.
+*  @param[out]
+*  csrdelta_width     array of \p nblocks elements that contain the width of the packed
+*                     offsets of every block of rows in bytes.
+*  @param[out]
+*  csrdelta_nnz       pointer to the total number of words of the packed offsets.
+*  @param[in]
+*  temp_buffer        temporary storage buffer allocated by the user, size is returned
+*                     by rocsparse_csr2csrdelta_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p csrdelta_block_ptr, \p csrdelta_width,
+*              \p csrdelta_nnz or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    const rocsparse_mat_descr       csr_descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    const rocsparse_mat_descr       ell_descr,
-                                    rocsparse_int                   ell_width,
-                                    rocsparse_double_complex*       ell_val,
-                                    rocsparse_int*                  ell_col_ind);
-/**@}*/
+rocsparse_status rocsparse_csr2csrdelta_nnz(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_int*            csrdelta_block_ptr,
+                                            rocsparse_int*            csrdelta_width,
+                                            rocsparse_int*            csrdelta_nnz,
+                                            void*                     temp_buffer);
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+*  \brief Convert a sparse CSR matrix into a sparse delta compressed CSR matrix
 *
 *  \details
-*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
-*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
-*
-*  \note
-*  This function requires a significant amount of storage for the HYB matrix,
-*  depending on the matrix structure.
+*  \p rocsparse_csr2csrdelta packs the column indices of a CSR matrix into the delta
+*  compressed CSR format. It is assumed, that \p csrdelta_col_ind is allocated with
+*  \p csrdelta_nnz words, and that \p csrdelta_block_ptr and \p csrdelta_width have been
+*  computed by rocsparse_csr2csrdelta_nnz(). The values and row pointers of the CSR
+*  matrix are used unchanged, only the column indices are replaced.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle          handle to the rocsparse library context queue.
+*  handle             handle to the rocsparse library context queue.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix.
+*  m                  number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix.
+*  n                  number of columns of the sparse CSR matrix.
 *  @param[in]
-*  descr           descriptor of the sparse CSR matrix. Currently, only
-*                  \ref rocsparse_matrix_type_general is supported.
+*  descr              descriptor of the sparse CSR matrix. Currently, only
+*                     \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  csr_val         array containing the values of the sparse CSR matrix.
+*  csr_row_ptr        array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix.
+*  csr_col_ind        array of \p nnz elements containing the column indices of the
+*                     sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
-*  @param[out]
-*  hyb             sparse matrix in HYB format.
+*  block_dim          number of rows that share the width of their packed offsets.
 *  @param[in]
-*  user_ell_width  width of the ELL part of the HYB matrix (only required if
-*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  csrdelta_block_ptr array of \p nblocks+1 elements that point to the start of every
+*                     block of rows in \p csrdelta_col_ind, where
+*                     \f$\text{nblocks} = \lceil m / \text{block_dim} \rceil\f$.
 *  @param[in]
-*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
-*                  \ref rocsparse_hyb_partition_user or
-*                  \ref rocsparse_hyb_partition_max.
+*  csrdelta_width     array of \p nblocks elements that contain the width of the packed
+*                     offsets of every block of rows in bytes.
+*  @param[out]
+*  csrdelta_row_col   array of \p m elements that contain the first column index of
+*                     every row.
+*  @param[out]
+*  csrdelta_col_ind   array of \p csrdelta_nnz words that contain the packed column
+*                     offsets.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
-*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
-*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
-*              allocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p csrdelta_block_ptr, \p csrdelta_width,
+*              \p csrdelta_row_col or \p csrdelta_col_ind pointer is invalid.
 *  \retval     rocsparse_status_not_implemented
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+*  This example converts a CSR matrix into a delta compressed CSR matrix.
 *  \code{.c}
-*      // Create HYB matrix structure
-*      rocsparse_hyb_mat hyb;
-*      rocsparse_create_hyb_mat(&hyb);
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
 *
-*      // User defined ell width
-*      rocsparse_int user_ell_width = 5;
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
 *
-*      // Perform the conversion
-*      rocsparse_scsr2hyb(handle,
-*                         m,
-*                         n,
-*                         descr,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         hyb,
-*                         user_ell_width,
-*                         rocsparse_hyb_partition_user);
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
 *
-*      // Do some work
+*      // Blocks of 2 rows
+*      rocsparse_int block_dim = 2;
+*      rocsparse_int nblocks   = (m - 1) / block_dim + 1;
 *
-*      // Clean up
-*      rocsparse_destroy_hyb_mat(hyb);
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csr2csrdelta_buffer_size(handle, m, n, csr_row_ptr, block_dim, &buffer_size);
+*
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Allocate block pointer and width arrays
+*      rocsparse_int* csrdelta_block_ptr;
+*      rocsparse_int* csrdelta_width;
+*      hipMalloc((void**)&csrdelta_block_ptr, sizeof(rocsparse_int) * (nblocks + 1));
+*      hipMalloc((void**)&csrdelta_width, sizeof(rocsparse_int) * nblocks);
+*
+*      // Compute block widths, block pointers and number of words
+*      rocsparse_int csrdelta_nnz;
+*      rocsparse_csr2csrdelta_nnz(handle,
+*                                 m,
+*                                 n,
+*                                 descr,
+*                                 csr_row_ptr,
+*                                 csr_col_ind,
+*                                 block_dim,
+*                                 csrdelta_block_ptr,
+*                                 csrdelta_width,
+*                                 &csrdelta_nnz,
+*                                 temp_buffer);
+*
+*      // csrdelta_block_ptr = {0, 2, 3}, csrdelta_width = {1, 1}, csrdelta_nnz = 3
+*
+*      // Allocate first column and packed offset arrays
+*      rocsparse_int* csrdelta_row_col;
+*      rocsparse_int* csrdelta_col_ind;
+*      hipMalloc((void**)&csrdelta_row_col, sizeof(rocsparse_int) * m);
+*      hipMalloc((void**)&csrdelta_col_ind, sizeof(rocsparse_int) * csrdelta_nnz);
+*
+*      // Format conversion
+*      rocsparse_csr2csrdelta(handle,
+*                             m,
+*                             n,
+*                             descr,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             block_dim,
+*                             csrdelta_block_ptr,
+*                             csrdelta_width,
+*                             csrdelta_row_col,
+*                             csrdelta_col_ind);
+*
+*      // csrdelta_row_col = {0, 1, 0}, packed byte offsets {0, 1, 3, 0, 1 | 0, 3, 4}
 *  \endcode
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    const rocsparse_mat_descr      descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_hyb_mat              hyb,
-                                    rocsparse_int                  user_ell_width,
-                                    rocsparse_hyb_partition        partition_type);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    const rocsparse_mat_descr       descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_hyb_mat               hyb,
-                                    rocsparse_int                   user_ell_width,
-                                    rocsparse_hyb_partition         partition_type);
-/**@}*/
+rocsparse_status rocsparse_csr2csrdelta(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_int             block_dim,
+                                        const rocsparse_int*      csrdelta_block_ptr,
+                                        const rocsparse_int*      csrdelta_width,
+                                        rocsparse_int*            csrdelta_row_col,
+                                        rocsparse_int*            csrdelta_col_ind);
 
 /*! \ingroup conv_module
 *  \brief
@@ -9397,6 +13214,9 @@ rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
 *
 *  \details
 *  The routine does support asynchronous execution if the pointer mode is set to device.
+*  Similar to rocsparse_csr2bsr(), temporary storage is allocated with hipMalloc, if
+*  \p block_dim>64 and the storage of a single block row exceeds the internal buffer of
+*  the handle.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -9463,6 +13283,12 @@ rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          handle,
 *
 *  \p rocsparse_csr2bsr requires extra temporary storage that is allocated internally if \p block_dim>16
 *
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished. If \p block_dim>64,
+*        the temporary storage of a single block row grows with \p block_dim. Only if it
+*        exceeds the internal buffer of the handle, the storage is allocated with hipMalloc
+*        and freed with hipFree, which synchronizes the host.
+*
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
@@ -9614,6 +13440,76 @@ rocsparse_status rocsparse_zcsr2bsr(rocsparse_handle                handle,
                                     rocsparse_int*                  bsr_col_ind);
 /**@}*/
 
+/*! \ingroup conv_module
+*  \brief Compute the mapping of CSR entries onto a BSR matrix
+*
+*  \details
+*  \p rocsparse_csr2bsr_map computes the position of every entry of a CSR matrix in the
+*  value array of its BSR representation, as obtained by rocsparse_scsr2bsr(),
+*  rocsparse_dcsr2bsr(), rocsparse_ccsr2bsr() and rocsparse_zcsr2bsr(). As long as the
+*  sparsity pattern does not change, the BSR values can then be refreshed from new CSR
+*  values by a single call to rocsparse_ssctr(), rocsparse_dsctr(), rocsparse_csctr()
+*  or rocsparse_zsctr(). The zero fill of the blocks is left untouched.
+*
+*  \note
+*  The column indices of the CSR matrix are expected to be sorted within each row.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  @param[in]
+*  m            number of rows in the sparse CSR matrix.
+*  @param[in]
+*  n            number of columns in the sparse CSR matrix.
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*               sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  block_dim    size of the blocks in the sparse BSR matrix.
+*  @param[in]
+*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  bsr_row_ptr  array of \p mb+1 elements that point to the start of every block row of the
+*               sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind  array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+*  @param[out]
+*  bsr_map      array of \p nnz elements containing the zero based position of each CSR
+*               entry in the BSR value array.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_value \p dir is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p bsr_descr,
+*              \p csr_row_ptr, \p csr_col_ind, \p bsr_row_ptr, \p bsr_col_ind or
+*              \p bsr_map pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2bsr_map(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr csr_descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_mat_descr bsr_descr,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int*            bsr_map);
+
 /*! \ingroup conv_module
 *  \brief
  *  \details
@@ -9803,6 +13699,9 @@ rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          handle,
 *  the GEneral BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
 *  \p csr2gebsr_nnz() which also fills in \p bsr_row_ptr.
 *
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
@@ -9967,6 +13866,79 @@ rocsparse_status rocsparse_zcsr2gebsr(rocsparse_handle                handle,
 
 /**@}*/
 
+/*! \ingroup conv_module
+*  \brief Compute the mapping of CSR entries onto a GEneral BSR matrix
+*
+*  \details
+*  \p rocsparse_csr2gebsr_map computes the position of every entry of a CSR matrix in
+*  the value array of its GEneral BSR representation, as obtained by
+*  rocsparse_scsr2gebsr(), rocsparse_dcsr2gebsr(), rocsparse_ccsr2gebsr() and
+*  rocsparse_zcsr2gebsr(). As long as the sparsity pattern does not change, the GEneral
+*  BSR values can then be refreshed from new CSR values by a single call to
+*  rocsparse_ssctr(), rocsparse_dsctr(), rocsparse_csctr() or rocsparse_zsctr(). The
+*  zero fill of the blocks is left untouched.
+*
+*  \note
+*  The column indices of the CSR matrix are expected to be sorted within each row.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  dir         the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*  @param[in]
+*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*  @param[in]
+*  bsr_descr   descriptor of the sparse GEneral BSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the General BSR matrix
+*  @param[in]
+*  bsr_col_ind integer array of the block column indices of the General BSR matrix
+*  @param[in]
+*  row_block_dim   row size of the blocks in the sparse General BSR matrix.
+*  @param[in]
+*  col_block_dim   column size of the blocks in the sparse General BSR matrix.
+*  @param[out]
+*  bsr_map     array of \p nnz elements containing the zero based position of each CSR
+*              entry in the General BSR value array.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim or
+*              \p col_block_dim is invalid.
+*  \retval     rocsparse_status_invalid_value \p dir is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p bsr_descr,
+*              \p csr_row_ptr, \p csr_col_ind, \p bsr_row_ptr, \p bsr_col_ind or
+*              \p bsr_map pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2gebsr_map(rocsparse_handle          handle,
+                                         rocsparse_direction       dir,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_mat_descr bsr_descr,
+                                         const rocsparse_int*      bsr_row_ptr,
+                                         const rocsparse_int*      bsr_col_ind,
+                                         rocsparse_int             row_block_dim,
+                                         rocsparse_int             col_block_dim,
+                                         rocsparse_int*            bsr_map);
+
 /*! \ingroup conv_module
  *  \brief Convert a sparse CSR matrix into a compressed sparse CSR matrix
  *
@@ -11119,6 +15091,256 @@ rocsparse_status rocsparse_zhyb2csr(rocsparse_handle          handle,
                                     void*                     temp_buffer);
 /**@}*/
 
+/*! \ingroup conv_module
+*  \brief Convert a sparse SELL-C-\f$\sigma\f$ matrix into a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_sellc2csr_nnz computes the total CSR non-zero elements and the CSR
+*  row offsets, that point to the start of every row of the sparse CSR matrix, for
+*  a given SELL-C-\f$\sigma\f$ matrix. It is assumed that \p csr_row_ptr has been
+*  allocated with size \p m + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  n               number of columns of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_slice_ptr  array of \p nslices+1 elements that point to the start of every
+*                  slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_col_ind    array containing the column indices of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_perm       array of \p m elements that maps the rows of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix to the rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[out]
+*  csr_nnz         pointer to the total number of non-zero elements in CSR storage
+*                  format.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p sell_slice_size is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p sell_descr, \p sell_slice_ptr,
+*              \p sell_col_ind, \p sell_perm, \p csr_descr, \p csr_row_ptr or
+*              \p csr_nnz pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the scan could not be
+*              allocated.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellc2csr_nnz(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         const rocsparse_mat_descr sell_descr,
+                                         rocsparse_int             sell_slice_size,
+                                         const rocsparse_int*      sell_slice_ptr,
+                                         const rocsparse_int*      sell_col_ind,
+                                         const rocsparse_int*      sell_perm,
+                                         const rocsparse_mat_descr csr_descr,
+                                         rocsparse_int*            csr_row_ptr,
+                                         rocsparse_int*            csr_nnz);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse SELL-C-\f$\sigma\f$ matrix into a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_sellc2csr converts a SELL-C-\f$\sigma\f$ matrix into a CSR matrix. It
+*  is assumed that \p csr_row_ptr has already been filled and that \p csr_val and
+*  \p csr_col_ind are allocated by the user. \p csr_row_ptr and allocation size of
+*  \p csr_col_ind and \p csr_val is defined by the number of CSR non-zero elements.
+*  Both can be obtained by rocsparse_sellc2csr_nnz(). Padded elements are dropped and
+*  the rows are restored to their original order.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  n               number of columns of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL-C-\f$\sigma\f$ matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_val        array containing the values of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_slice_ptr  array of \p nslices+1 elements that point to the start of every
+*                  slice of the sparse SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_col_ind    array containing the column indices of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix.
+*  @param[in]
+*  sell_perm       array of \p m elements that maps the rows of the sparse
+*                  SELL-C-\f$\sigma\f$ matrix to the rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[out]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p sell_slice_size is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p sell_descr, \p sell_val,
+*              \p sell_slice_ptr, \p sell_col_ind, \p sell_perm, \p csr_descr,
+*              \p csr_val, \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssellc2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr sell_descr,
+                                      rocsparse_int             sell_slice_size,
+                                      const float*              sell_val,
+                                      const rocsparse_int*      sell_slice_ptr,
+                                      const rocsparse_int*      sell_col_ind,
+                                      const rocsparse_int*      sell_perm,
+                                      const rocsparse_mat_descr csr_descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsellc2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr sell_descr,
+                                      rocsparse_int             sell_slice_size,
+                                      const double*             sell_val,
+                                      const rocsparse_int*      sell_slice_ptr,
+                                      const rocsparse_int*      sell_col_ind,
+                                      const rocsparse_int*      sell_perm,
+                                      const rocsparse_mat_descr csr_descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csellc2csr(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      sell_descr,
+                                      rocsparse_int                  sell_slice_size,
+                                      const rocsparse_float_complex* sell_val,
+                                      const rocsparse_int*           sell_slice_ptr,
+                                      const rocsparse_int*           sell_col_ind,
+                                      const rocsparse_int*           sell_perm,
+                                      const rocsparse_mat_descr      csr_descr,
+                                      rocsparse_float_complex*       csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      rocsparse_int*                 csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zsellc2csr(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       sell_descr,
+                                      rocsparse_int                   sell_slice_size,
+                                      const rocsparse_double_complex* sell_val,
+                                      const rocsparse_int*            sell_slice_ptr,
+                                      const rocsparse_int*            sell_col_ind,
+                                      const rocsparse_int*            sell_perm,
+                                      const rocsparse_mat_descr       csr_descr,
+                                      rocsparse_double_complex*       csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int*                  csr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse delta compressed CSR matrix into a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrdelta2csr decodes the packed column offsets of a delta compressed CSR
+*  matrix into the column indices of a CSR matrix. It is assumed, that \p csr_col_ind is
+*  allocated with \p nnz elements, where \p nnz is given by \p csr_row_ptr.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle             handle to the rocsparse library context queue.
+*  @param[in]
+*  m                  number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n                  number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descr              descriptor of the sparse CSR matrix. Currently, only
+*                     \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr        array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
+*  @param[in]
+*  block_dim          number of rows that share the width of their packed offsets.
+*  @param[in]
+*  csrdelta_block_ptr array of \p nblocks+1 elements that point to the start of every
+*                     block of rows in \p csrdelta_col_ind, where
+*                     \f$\text{nblocks} = \lceil m / \text{block_dim} \rceil\f$.
+*  @param[in]
+*  csrdelta_width     array of \p nblocks elements that contain the width of the packed
+*                     offsets of every block of rows in bytes.
+*  @param[in]
+*  csrdelta_row_col   array of \p m elements that contain the first column index of
+*                     every row.
+*  @param[in]
+*  csrdelta_col_ind   array that contains the packed column offsets.
+*  @param[out]
+*  csr_col_ind        array of \p nnz elements containing the column indices of the
+*                     sparse CSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csrdelta_block_ptr, \p csrdelta_width, \p csrdelta_row_col,
+*              \p csrdelta_col_ind or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrdelta2csr(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        rocsparse_int             block_dim,
+                                        const rocsparse_int*      csrdelta_block_ptr,
+                                        const rocsparse_int*      csrdelta_width,
+                                        const rocsparse_int*      csrdelta_row_col,
+                                        const rocsparse_int*      csrdelta_col_ind,
+                                        rocsparse_int*            csr_col_ind);
+
 /*! \ingroup conv_module
 *  \brief Create the identity map
 *
@@ -11713,6 +15935,220 @@ rocsparse_status rocsparse_coosort_by_column(rocsparse_handle handle,
                                              rocsparse_int*   perm,
                                              void*            temp_buffer);
 
+/*! \ingroup conv_module
+*  \brief Check the structure of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csr_check checks whether a matrix in CSR format is structurally valid.
+*  The row offsets must start at the index base, be monotone and end at \p nnz plus
+*  the index base. Column indices must be in range, sorted within each row and free of
+*  duplicates. All diagonal entries \f$(i, i)\f$, \f$i < \min(m, n)\f$, must be
+*  present. The most severe violation is reported in \p data_status, see
+*  \ref rocsparse_data_status. All properties are checked in a single pass over the
+*  matrix.
+*
+*  \note
+*  The diagonal is only checked if the matrix is otherwise structurally valid and the
+*  \ref rocsparse_diag_type of \p descr is \ref rocsparse_diag_type_non_unit.
+*
+*  \note
+*  \p data_status can be in host or device memory, depending on the
+*  \ref rocsparse_pointer_mode. In device pointer mode, this function is non blocking
+*  and executed asynchronously with respect to the host. It may return before the
+*  actual computation has finished. In host pointer mode, this function is blocking
+*  with respect to the host.
+*
+*  \note
+*  No temporary storage buffer is required.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  data_status     structural status of the sparse CSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p data_status pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  The following example checks a \f$3 \times 3\f$ CSR matrix with unsorted rows.
+*  \code{.c}
+*      //     1 2 3
+*      // A = 4 5 6
+*      //     7 8 9
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 3;
+*      rocsparse_int nnz = 9;
+*
+*      csr_row_ptr[m + 1] = {0, 3, 6, 9};                // device memory
+*      csr_col_ind[nnz]   = {2, 0, 1, 0, 1, 2, 0, 2, 1}; // device memory
+*
+*      // Check the CSR matrix
+*      rocsparse_data_status data_status;
+*      rocsparse_csr_check(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, &data_status);
+*
+*      // Sort the CSR matrix, if required
+*      if(data_status == rocsparse_data_status_invalid_sorting)
+*      {
+*          rocsparse_csrsort(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, NULL,
+*                            temp_buffer);
+*      }
+*  \endcode
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_check(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_data_status*    data_status);
+
+/*! \ingroup conv_module
+*  \brief Check the structure of a sparse COO matrix
+*
+*  \details
+*  \p rocsparse_coo_check checks whether a matrix in COO format is structurally valid.
+*  Row and column indices must be in range, sorted by row and by column within each
+*  row, and free of duplicates. All diagonal entries \f$(i, i)\f$,
+*  \f$i < \min(m, n)\f$, must be present. The most severe violation is reported in
+*  \p data_status, see \ref rocsparse_data_status. All properties are checked in a
+*  single pass over the matrix.
+*
+*  \note
+*  The diagonal is only checked if the matrix is otherwise structurally valid and the
+*  \ref rocsparse_diag_type of \p descr is \ref rocsparse_diag_type_non_unit.
+*
+*  \note
+*  \p data_status can be in host or device memory, depending on the
+*  \ref rocsparse_pointer_mode. In device pointer mode, this function is non blocking
+*  and executed asynchronously with respect to the host. It may return before the
+*  actual computation has finished. In host pointer mode, this function is blocking
+*  with respect to the host.
+*
+*  \note
+*  No temporary storage buffer is required.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse COO matrix.
+*  @param[in]
+*  n               number of columns of the sparse COO matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse COO matrix.
+*  @param[in]
+*  descr           descriptor of the sparse COO matrix.
+*  @param[in]
+*  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+*                  COO matrix.
+*  @param[in]
+*  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  COO matrix.
+*  @param[out]
+*  data_status     structural status of the sparse COO matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p coo_row_ind, \p coo_col_ind
+*              or \p data_status pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_coo_check(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_int*      coo_row_ind,
+                                     const rocsparse_int*      coo_col_ind,
+                                     rocsparse_data_status*    data_status);
+
+/*! \ingroup conv_module
+*  \brief Check the structure of a sparse BSR matrix
+*
+*  \details
+*  \p rocsparse_bsr_check checks whether the block structure of a matrix in BSR format
+*  is valid. The block row offsets must start at the index base, be monotone and end at
+*  \p nnzb plus the index base. Block column indices must be in range, sorted within
+*  each block row and free of duplicates. All diagonal blocks \f$(i, i)\f$,
+*  \f$i < \min(mb, nb)\f$, must be present. The most severe violation is reported in
+*  \p data_status, see \ref rocsparse_data_status. The values of the blocks are not
+*  accessed.
+*
+*  \note
+*  The diagonal is only checked if the matrix is otherwise structurally valid and the
+*  \ref rocsparse_diag_type of \p descr is \ref rocsparse_diag_type_non_unit.
+*
+*  \note
+*  \p data_status can be in host or device memory, depending on the
+*  \ref rocsparse_pointer_mode. In device pointer mode, this function is non blocking
+*  and executed asynchronously with respect to the host. It may return before the
+*  actual computation has finished. In host pointer mode, this function is blocking
+*  with respect to the host.
+*
+*  \note
+*  No temporary storage buffer is required.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrix.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix.
+*  @param[in]
+*  nnzb            number of non-zero blocks of the sparse BSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse BSR matrix.
+*  @param[in]
+*  bsr_row_ptr     array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind     array of \p nnzb elements containing the block column indices of the
+*                  sparse BSR matrix.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix.
+*  @param[out]
+*  data_status     structural status of the sparse BSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb, \p nnzb or \p block_dim is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_row_ptr, \p bsr_col_ind
+*              or \p data_status pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsr_check(rocsparse_handle          handle,
+                                     rocsparse_int             mb,
+                                     rocsparse_int             nb,
+                                     rocsparse_int             nnzb,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_int*      bsr_row_ptr,
+                                     const rocsparse_int*      bsr_col_ind,
+                                     rocsparse_int             block_dim,
+                                     rocsparse_data_status*    data_status);
+
 /*! \ingroup conv_module
 *  \brief Convert a sparse BSR matrix into a sparse CSR matrix
 *
@@ -213,6 +213,24 @@ typedef enum rocsparse_hyb_partition_
     rocsparse_hyb_partition_max  = 2 /**< max ELL nnz per row, no COO part. */
 } rocsparse_hyb_partition;
 
+/*! \ingroup types_module
+ *  \brief List of csrmv algorithms.
+ *
+ *  \details
+ *  The \ref rocsparse_csrmv_alg selects the algorithm that is used by e.g.
+ *  rocsparse_scsrmv_ex(). The stream algorithm processes each row by a group of threads
+ *  whose size depends on the average number of non-zero entries per row. The adaptive
+ *  algorithm balances the rows using meta data that has been collected by e.g.
+ *  rocsparse_scsrmv_analysis(). The merge path algorithm splits the row ends and
+ *  non-zero entries of the matrix evenly across all threads and requires no analysis.
+ */
+typedef enum rocsparse_csrmv_alg_
+{
+    rocsparse_csrmv_alg_stream     = 0, /**< row based, no analysis required. */
+    rocsparse_csrmv_alg_adaptive   = 1, /**< balanced rows, analysis required. */
+    rocsparse_csrmv_alg_merge_path = 2 /**< balanced non-zeros, no analysis required. */
+} rocsparse_csrmv_alg;
+
 /*! \ingroup types_module
  *  \brief Specify policy in analysis functions.
  *
@@ -239,6 +257,26 @@ typedef enum rocsparse_solve_policy_
     rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
 } rocsparse_solve_policy;
 
+/*! \ingroup types_module
+ *  \brief Level schedule of a sparse triangular analysis.
+ *
+ *  \details
+ *  The \ref rocsparse_level_info describes the level schedule that has been collected
+ *  during the analysis of a sparse triangular solve or incomplete factorization. Rows of
+ *  the same level do not depend on each other and can be processed in parallel, while
+ *  levels are processed in order. It can be obtained by e.g.
+ *  rocsparse_csrsv_level_info().
+ */
+typedef struct rocsparse_level_info_
+{
+    rocsparse_int levels; /**< number of levels. */
+    rocsparse_int min_width; /**< number of rows of the narrowest level. */
+    rocsparse_int max_width; /**< number of rows of the widest level. */
+    rocsparse_int width_histogram[32]; /**< number of levels with [2^i, 2^(i+1)) rows. */
+    int64_t       critical_path; /**< work of the most expensive dependency chain. */
+    double        parallelism; /**< total work divided by critical path. */
+} rocsparse_level_info;
+
 /*! \ingroup types_module
  *  \brief Indicates if the pointer is device pointer or host pointer.
  *
@@ -267,6 +305,25 @@ typedef enum rocsparse_layer_mode
     rocsparse_layer_mode_log_bench = 0x2 /**< layer is in benchmarking mode. */
 } rocsparse_layer_mode;
 
+/*! \ingroup types_module
+ *  \brief List of structural data status codes.
+ *
+ *  \details
+ *  The \ref rocsparse_data_status is returned by the structural checks, such as
+ *  rocsparse_csr_check(). If a matrix violates several properties, the status listed
+ *  first is reported. In particular, \ref rocsparse_data_status_missing_diagonal is
+ *  only reported for matrices that are otherwise structurally valid.
+ */
+typedef enum rocsparse_data_status_
+{
+    rocsparse_data_status_success            = 0, /**< structurally valid matrix. */
+    rocsparse_data_status_invalid_offset_ptr = 1, /**< offsets not monotone or mismatch nnz. */
+    rocsparse_data_status_invalid_index      = 2, /**< index out of range. */
+    rocsparse_data_status_invalid_sorting    = 3, /**< indices not sorted. */
+    rocsparse_data_status_duplicate_entry    = 4, /**< index appears more than once. */
+    rocsparse_data_status_missing_diagonal   = 5 /**< diagonal entry not stored. */
+} rocsparse_data_status;
+
 /*! \ingroup types_module
  *  \brief List of rocsparse status codes definition.
  *
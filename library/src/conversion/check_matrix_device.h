@@ -0,0 +1,241 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CHECK_MATRIX_DEVICE_H
+#define CHECK_MATRIX_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Structural violations are combined by their maximum rank, such that the status that
+// is listed first in rocsparse_data_status has the highest rank. Rank zero indicates
+// that no violation has been found.
+__device__ __forceinline__ rocsparse_int check_matrix_rank(rocsparse_data_status status)
+{
+    return (status == rocsparse_data_status_success)
+               ? 0
+               : rocsparse_data_status_missing_diagonal + 1 - status;
+}
+
+// Reduce rank and number of diagonal entries of the block and accumulate them in data
+template <unsigned int BLOCKSIZE>
+__device__ __forceinline__ void
+    check_matrix_block_reduce(rocsparse_int rank, rocsparse_int diag, rocsparse_int* data)
+{
+    int tid = hipThreadIdx_x;
+
+    __shared__ rocsparse_int srank[BLOCKSIZE];
+    __shared__ rocsparse_int sdiag[BLOCKSIZE];
+
+    srank[tid] = rank;
+    sdiag[tid] = diag;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<rocsparse_int, BLOCKSIZE>(tid, srank);
+    rocsparse_blockreduce_sum<rocsparse_int, BLOCKSIZE>(tid, sdiag);
+
+    if(tid == 0)
+    {
+        if(srank[0] > 0)
+        {
+            atomicMax(&data[0], srank[0]);
+        }
+
+        if(sdiag[0] > 0)
+        {
+            atomicAdd(&data[1], sdiag[0]);
+        }
+    }
+}
+
+// Check that the offsets start at the index base, are monotone and end at nnz
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void check_csr_offsets_kernel(rocsparse_int        m,
+                                  rocsparse_int        nnz,
+                                  rocsparse_index_base idx_base,
+                                  const rocsparse_int* csr_row_ptr,
+                                  rocsparse_int*       data)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    bool valid = true;
+
+    if(gid == 0)
+    {
+        valid = (csr_row_ptr[0] == idx_base);
+    }
+
+    if(gid < m)
+    {
+        valid = valid && (csr_row_ptr[gid + 1] >= csr_row_ptr[gid]);
+    }
+    else if(gid == m)
+    {
+        valid = valid && (csr_row_ptr[m] == nnz + idx_base);
+    }
+
+    check_matrix_block_reduce<BLOCKSIZE>(
+        valid ? 0 : check_matrix_rank(rocsparse_data_status_invalid_offset_ptr), 0, data);
+}
+
+// Check the column indices of each row for range, sorting and duplicates and count the
+// diagonal entries. Each row is processed by a segment of SEGMENT_SIZE threads.
+template <unsigned int BLOCKSIZE, unsigned int SEGMENT_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void check_csr_indices_kernel(rocsparse_int        m,
+                                  rocsparse_int        n,
+                                  rocsparse_int        nnz,
+                                  rocsparse_index_base idx_base,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_int*       data)
+{
+    rocsparse_int lid = hipThreadIdx_x & (SEGMENT_SIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / SEGMENT_SIZE;
+
+    rocsparse_int rank = 0;
+    rocsparse_int diag = 0;
+
+    if(row < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Invalid offsets are reported by check_csr_offsets_kernel, rows that would be
+        // accessed out of bounds are skipped
+        if(row_begin < 0 || row_begin > row_end || row_end > nnz)
+        {
+            row_end = row_begin;
+        }
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += SEGMENT_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            rocsparse_data_status status = rocsparse_data_status_success;
+
+            if(col < 0 || col >= n)
+            {
+                status = rocsparse_data_status_invalid_index;
+            }
+            else if(j > row_begin)
+            {
+                rocsparse_int prev = csr_col_ind[j - 1] - idx_base;
+
+                if(col < prev)
+                {
+                    status = rocsparse_data_status_invalid_sorting;
+                }
+                else if(col == prev)
+                {
+                    status = rocsparse_data_status_duplicate_entry;
+                }
+            }
+
+            rank = max(rank, check_matrix_rank(status));
+            diag += (col == row);
+        }
+    }
+
+    check_matrix_block_reduce<BLOCKSIZE>(rank, diag, data);
+}
+
+// Check the indices of each entry for range, row major sorting and duplicates and count
+// the diagonal entries
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void check_coo_indices_kernel(rocsparse_int        m,
+                                  rocsparse_int        n,
+                                  rocsparse_int        nnz,
+                                  rocsparse_index_base idx_base,
+                                  const rocsparse_int* coo_row_ind,
+                                  const rocsparse_int* coo_col_ind,
+                                  rocsparse_int*       data)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    rocsparse_int rank = 0;
+    rocsparse_int diag = 0;
+
+    if(gid < nnz)
+    {
+        rocsparse_int row = coo_row_ind[gid] - idx_base;
+        rocsparse_int col = coo_col_ind[gid] - idx_base;
+
+        rocsparse_data_status status = rocsparse_data_status_success;
+
+        if(row < 0 || row >= m || col < 0 || col >= n)
+        {
+            status = rocsparse_data_status_invalid_index;
+        }
+        else if(gid > 0)
+        {
+            rocsparse_int prev_row = coo_row_ind[gid - 1] - idx_base;
+            rocsparse_int prev_col = coo_col_ind[gid - 1] - idx_base;
+
+            if(row < prev_row || (row == prev_row && col < prev_col))
+            {
+                status = rocsparse_data_status_invalid_sorting;
+            }
+            else if(row == prev_row && col == prev_col)
+            {
+                status = rocsparse_data_status_duplicate_entry;
+            }
+        }
+
+        rank = check_matrix_rank(status);
+        diag = (row == col);
+    }
+
+    check_matrix_block_reduce<BLOCKSIZE>(rank, diag, data);
+}
+
+// Convert the accumulated rank into the data status. If the matrix is structurally
+// valid, all min(m, n) diagonal entries must be present unless check_diag is false.
+static __global__ void check_matrix_status_kernel(rocsparse_int          m,
+                                                  rocsparse_int          n,
+                                                  bool                   check_diag,
+                                                  const rocsparse_int*   data,
+                                                  rocsparse_data_status* status)
+{
+    if(data[0] > 0)
+    {
+        *status = static_cast<rocsparse_data_status>(rocsparse_data_status_missing_diagonal
+                                                     + 1 - data[0]);
+    }
+    else if(check_diag && data[1] < min(m, n))
+    {
+        *status = rocsparse_data_status_missing_diagonal;
+    }
+    else
+    {
+        *status = rocsparse_data_status_success;
+    }
+}
+
+#endif // CHECK_MATRIX_DEVICE_H
@@ -45,4 +45,87 @@ __launch_bounds__(BLOCKSIZE) __global__ void coosort_permute_kernel(rocsparse_in
     out[gid] = in[perm[gid]];
 }
 
+// Flag entries that are not ordered by row and by column within each row. The flag
+// stays on the device, such that the sort kernels can exit early without synchronizing
+// the host.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void coosort_is_sorted_kernel(rocsparse_int        nnz,
+                                                                      const rocsparse_int* row,
+                                                                      const rocsparse_int* col,
+                                                                      rocsparse_int*       unsorted)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz - 1)
+    {
+        return;
+    }
+
+    rocsparse_int row0 = row[gid];
+    rocsparse_int row1 = row[gid + 1];
+
+    if(row0 > row1 || (row0 == row1 && col[gid] > col[gid + 1]))
+    {
+        *unsorted = 1;
+    }
+}
+
+// Pack row and column index into a single 64 bit key, such that a single radix sort
+// orders the entries by row and by column within each row. The permutation is sorted
+// along with the keys. Nothing is done if the entries are sorted already.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void coosort_pack_kernel(rocsparse_int        nnz,
+                                                                 unsigned int         col_bits,
+                                                                 const rocsparse_int* row,
+                                                                 const rocsparse_int* col,
+                                                                 const rocsparse_int* perm,
+                                                                 uint64_t*            key,
+                                                                 rocsparse_int*       idx,
+                                                                 const rocsparse_int* unsorted)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz || *unsorted == 0)
+    {
+        return;
+    }
+
+    key[gid] = (static_cast<uint64_t>(row[gid]) << col_bits) | static_cast<uint64_t>(col[gid]);
+
+    if(perm != nullptr)
+    {
+        idx[gid] = perm[gid];
+    }
+}
+
+// Unpack the sorted 64 bit keys into row and column indices and write back the sorted
+// permutation. Nothing is done if the entries are sorted already.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void coosort_unpack_kernel(rocsparse_int        nnz,
+                                                                   unsigned int         col_bits,
+                                                                   const uint64_t*      key,
+                                                                   const rocsparse_int* idx,
+                                                                   rocsparse_int*       row,
+                                                                   rocsparse_int*       col,
+                                                                   rocsparse_int*       perm,
+                                                                   const rocsparse_int* unsorted)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz || *unsorted == 0)
+    {
+        return;
+    }
+
+    uint64_t k = key[gid];
+
+    row[gid] = static_cast<rocsparse_int>(k >> col_bits);
+    col[gid] = static_cast<rocsparse_int>(k & ((static_cast<uint64_t>(1) << col_bits) - 1));
+
+    if(perm != nullptr)
+    {
+        perm[gid] = idx[gid];
+    }
+}
+
 #endif // COOSORT_DEVICE_H
@@ -467,78 +467,81 @@ __launch_bounds__(BLOCK_SIZE) __global__
                                    rocsparse_int* __restrict__ bsr_row_ptr,
                                    rocsparse_int* __restrict__ temp1)
 {
-    rocsparse_int block_id = hipBlockIdx_x;
-    rocsparse_int lane_id  = hipThreadIdx_x;
-
-    rocsparse_int block_col    = 0;
-    rocsparse_int nnzb_per_row = 0;
+    rocsparse_int lane_id = hipThreadIdx_x;
 
-    // temp array used as global scratch pad
-    rocsparse_int* row_start
-        = temp1 + (2 * rows_per_segment * BLOCK_SIZE * block_id) + rows_per_segment * lane_id;
-    rocsparse_int* row_end = temp1 + (2 * rows_per_segment * BLOCK_SIZE * block_id)
+    // temp array used as global scratch pad, one slot per block
+    rocsparse_int* row_start = temp1 + (2 * rows_per_segment * BLOCK_SIZE * hipBlockIdx_x)
+                               + rows_per_segment * lane_id;
+    rocsparse_int* row_end = temp1 + (2 * rows_per_segment * BLOCK_SIZE * hipBlockIdx_x)
                              + rows_per_segment * BLOCK_SIZE + rows_per_segment * lane_id;
 
-    for(rocsparse_int j = 0; j < rows_per_segment; j++)
+    // Loop over block rows, such that the scratch pad is bounded by the grid size
+    for(rocsparse_int block_id = hipBlockIdx_x; block_id < mb; block_id += hipGridDim_x)
     {
-        row_start[j] = 0;
-        row_end[j]   = 0;
-
-        rocsparse_int row_index = block_dim * block_id + BLOCK_SIZE * j + lane_id;
+        rocsparse_int block_col    = 0;
+        rocsparse_int nnzb_per_row = 0;
 
-        if(row_index < m && (BLOCK_SIZE * j + lane_id) < block_dim)
+        for(rocsparse_int j = 0; j < rows_per_segment; j++)
         {
-            row_start[j] = csr_row_ptr[row_index] - csr_base;
-            row_end[j]   = csr_row_ptr[row_index + 1] - csr_base;
-        }
-    }
+            row_start[j] = 0;
+            row_end[j]   = 0;
 
-    while(block_col < nb)
-    {
-        // Find minimum column index that is also greater than or equal to col
-        rocsparse_int min_block_col_index = nb;
+            rocsparse_int row_index = block_dim * block_id + BLOCK_SIZE * j + lane_id;
 
-        for(rocsparse_int j = 0; j < rows_per_segment; j++)
-        {
-            for(rocsparse_int i = row_start[j]; i < row_end[j]; i++)
+            if(row_index < m && (BLOCK_SIZE * j + lane_id) < block_dim)
             {
-                rocsparse_int block_col_index = (csr_col_ind[i] - csr_base) / block_dim;
+                row_start[j] = csr_row_ptr[row_index] - csr_base;
+                row_end[j]   = csr_row_ptr[row_index + 1] - csr_base;
+            }
+        }
 
-                if(block_col_index >= block_col)
+        while(block_col < nb)
+        {
+            // Find minimum column index that is also greater than or equal to col
+            rocsparse_int min_block_col_index = nb;
+
+            for(rocsparse_int j = 0; j < rows_per_segment; j++)
+            {
+                for(rocsparse_int i = row_start[j]; i < row_end[j]; i++)
                 {
-                    if(block_col_index <= min_block_col_index)
+                    rocsparse_int block_col_index = (csr_col_ind[i] - csr_base) / block_dim;
+
+                    if(block_col_index >= block_col)
                     {
-                        min_block_col_index = block_col_index;
-                    }
+                        if(block_col_index <= min_block_col_index)
+                        {
+                            min_block_col_index = block_col_index;
+                        }
 
-                    row_start[j] = i;
+                        row_start[j] = i;
 
-                    break;
+                        break;
+                    }
                 }
             }
-        }
 
-        // last thread in segment will contain the min after this call
-        rocsparse_wfreduce_min<BLOCK_SIZE>(&min_block_col_index);
+            // last thread in segment will contain the min after this call
+            rocsparse_wfreduce_min<BLOCK_SIZE>(&min_block_col_index);
 
-        // broadcast min_block_col_index from last thread in segment to all threads in segment
-        min_block_col_index = __shfl(min_block_col_index, BLOCK_SIZE - 1, BLOCK_SIZE);
+            // broadcast min_block_col_index from last thread in segment to all threads in segment
+            min_block_col_index = __shfl(min_block_col_index, BLOCK_SIZE - 1, BLOCK_SIZE);
 
-        block_col = min_block_col_index + 1;
+            block_col = min_block_col_index + 1;
 
-        if(lane_id == BLOCK_SIZE - 1)
-        {
-            if(min_block_col_index < nb)
+            if(lane_id == BLOCK_SIZE - 1)
             {
-                nnzb_per_row++;
+                if(min_block_col_index < nb)
+                {
+                    nnzb_per_row++;
+                }
             }
         }
-    }
 
-    if(block_id < mb && lane_id == BLOCK_SIZE - 1)
-    {
-        bsr_row_ptr[0]            = bsr_base;
-        bsr_row_ptr[block_id + 1] = nnzb_per_row;
+        if(lane_id == BLOCK_SIZE - 1)
+        {
+            bsr_row_ptr[0]            = bsr_base;
+            bsr_row_ptr[block_id + 1] = nnzb_per_row;
+        }
     }
 }
 
@@ -562,121 +565,122 @@ __launch_bounds__(BLOCK_SIZE) __global__
                                rocsparse_int* __restrict__ temp1,
                                T* __restrict__ temp2)
 {
-    rocsparse_int block_id = hipBlockIdx_x;
-    rocsparse_int lane_id  = hipThreadIdx_x;
-
-    rocsparse_int bsr_row_start = 0;
-
-    if(block_id < mb)
-    {
-        bsr_row_start = bsr_row_ptr[block_id] - bsr_base;
-    }
-
-    rocsparse_int csr_col       = 0;
-    rocsparse_int bsr_block_col = 0;
-    rocsparse_int nnzb_per_row  = 0;
+    rocsparse_int lane_id = hipThreadIdx_x;
 
-    // temp arrays used as global scratch pad
-    rocsparse_int* row_start
-        = temp1 + (3 * rows_per_segment * BLOCK_SIZE * block_id) + rows_per_segment * lane_id;
-    rocsparse_int* row_end = temp1 + (3 * rows_per_segment * BLOCK_SIZE * block_id)
+    // temp arrays used as global scratch pad, one slot per block
+    rocsparse_int* row_start = temp1 + (3 * rows_per_segment * BLOCK_SIZE * hipBlockIdx_x)
+                               + rows_per_segment * lane_id;
+    rocsparse_int* row_end = temp1 + (3 * rows_per_segment * BLOCK_SIZE * hipBlockIdx_x)
                              + rows_per_segment * BLOCK_SIZE + rows_per_segment * lane_id;
-    rocsparse_int* csr_col_index = temp1 + (3 * rows_per_segment * BLOCK_SIZE * block_id)
+    rocsparse_int* csr_col_index = temp1 + (3 * rows_per_segment * BLOCK_SIZE * hipBlockIdx_x)
                                    + 2 * rows_per_segment * BLOCK_SIZE + rows_per_segment * lane_id;
-    T* csr_value = temp2 + (rows_per_segment * BLOCK_SIZE * block_id) + rows_per_segment * lane_id;
+    T* csr_value
+        = temp2 + (rows_per_segment * BLOCK_SIZE * hipBlockIdx_x) + rows_per_segment * lane_id;
 
-    for(rocsparse_int j = 0; j < rows_per_segment; j++)
+    // Loop over block rows, such that the scratch pad is bounded by the grid size
+    for(rocsparse_int block_id = hipBlockIdx_x; block_id < mb; block_id += hipGridDim_x)
     {
-        row_start[j] = 0;
-        row_end[j]   = 0;
+        rocsparse_int bsr_row_start = bsr_row_ptr[block_id] - bsr_base;
 
-        rocsparse_int row_index = block_dim * block_id + BLOCK_SIZE * j + lane_id;
+        rocsparse_int csr_col       = 0;
+        rocsparse_int bsr_block_col = 0;
+        rocsparse_int nnzb_per_row  = 0;
 
-        if(row_index < m && (BLOCK_SIZE * j + lane_id) < block_dim)
+        for(rocsparse_int j = 0; j < rows_per_segment; j++)
         {
-            row_start[j] = csr_row_ptr[row_index] - csr_base;
-            row_end[j]   = csr_row_ptr[row_index + 1] - csr_base;
-        }
-    }
+            row_start[j] = 0;
+            row_end[j]   = 0;
 
-    while(csr_col < n)
-    {
-        T             min_csr_value     = 0;
-        rocsparse_int min_csr_col_index = n;
+            rocsparse_int row_index = block_dim * block_id + BLOCK_SIZE * j + lane_id;
 
-        for(rocsparse_int j = 0; j < rows_per_segment; j++)
+            if(row_index < m && (BLOCK_SIZE * j + lane_id) < block_dim)
+            {
+                row_start[j] = csr_row_ptr[row_index] - csr_base;
+                row_end[j]   = csr_row_ptr[row_index + 1] - csr_base;
+            }
+        }
+
+        while(csr_col < n)
         {
-            csr_value[j]     = 0;
-            csr_col_index[j] = n;
+            T             min_csr_value     = 0;
+            rocsparse_int min_csr_col_index = n;
 
-            for(rocsparse_int i = row_start[j]; i < row_end[j]; i++)
+            for(rocsparse_int j = 0; j < rows_per_segment; j++)
             {
-                csr_value[j]     = csr_val[i];
-                csr_col_index[j] = csr_col_ind[i] - csr_base;
+                csr_value[j]     = 0;
+                csr_col_index[j] = n;
 
-                if(csr_col_index[j] >= csr_col)
+                for(rocsparse_int i = row_start[j]; i < row_end[j]; i++)
                 {
-                    if(csr_col_index[j] <= min_csr_col_index)
+                    csr_value[j]     = csr_val[i];
+                    csr_col_index[j] = csr_col_ind[i] - csr_base;
+
+                    if(csr_col_index[j] >= csr_col)
                     {
-                        min_csr_value     = csr_value[j];
-                        min_csr_col_index = csr_col_index[j];
-                    }
+                        if(csr_col_index[j] <= min_csr_col_index)
+                        {
+                            min_csr_value     = csr_value[j];
+                            min_csr_col_index = csr_col_index[j];
+                        }
 
-                    row_start[j] = i;
+                        row_start[j] = i;
 
-                    break;
+                        break;
+                    }
                 }
             }
-        }
 
-        // find minimum CSR column index across all threads in this segment and store in last thread of segment
-        rocsparse_wfreduce_min<BLOCK_SIZE>(&min_csr_col_index);
+            // find minimum CSR column index across all threads in this segment and store in
+            // last thread of segment
+            rocsparse_wfreduce_min<BLOCK_SIZE>(&min_csr_col_index);
 
-        // have last thread in segment write to BSR column indices array
-        if(min_csr_col_index < n && lane_id == BLOCK_SIZE - 1)
-        {
-            if((min_csr_col_index / block_dim) >= bsr_block_col)
+            // have last thread in segment write to BSR column indices array
+            if(min_csr_col_index < n && lane_id == BLOCK_SIZE - 1)
             {
-                bsr_col_ind[bsr_row_start + nnzb_per_row]
-                    = min_csr_col_index / block_dim + bsr_base;
+                if((min_csr_col_index / block_dim) >= bsr_block_col)
+                {
+                    bsr_col_ind[bsr_row_start + nnzb_per_row]
+                        = min_csr_col_index / block_dim + bsr_base;
 
-                nnzb_per_row++;
-                bsr_block_col = (min_csr_col_index / block_dim) + 1;
+                    nnzb_per_row++;
+                    bsr_block_col = (min_csr_col_index / block_dim) + 1;
+                }
             }
-        }
 
-        // broadcast CSR minimum column index from last thread in segment to all threads in segment
-        min_csr_col_index = __shfl(min_csr_col_index, BLOCK_SIZE - 1, BLOCK_SIZE);
+            // broadcast CSR minimum column index from last thread in segment to all threads in
+            // segment
+            min_csr_col_index = __shfl(min_csr_col_index, BLOCK_SIZE - 1, BLOCK_SIZE);
 
-        // broadcast nnzb_per_row from last thread in segment to all threads in segment
-        nnzb_per_row = __shfl(nnzb_per_row, BLOCK_SIZE - 1, BLOCK_SIZE);
+            // broadcast nnzb_per_row from last thread in segment to all threads in segment
+            nnzb_per_row = __shfl(nnzb_per_row, BLOCK_SIZE - 1, BLOCK_SIZE);
 
-        // Write BSR values
-        for(rocsparse_int j = 0; j < rows_per_segment; j++)
-        {
-            if(csr_col_index[j] < n
-               && csr_col_index[j] / block_dim == min_csr_col_index / block_dim)
+            // Write BSR values
+            for(rocsparse_int j = 0; j < rows_per_segment; j++)
             {
-                if(direction == rocsparse_direction_row)
+                if(csr_col_index[j] < n
+                   && csr_col_index[j] / block_dim == min_csr_col_index / block_dim)
                 {
-                    rocsparse_int k = (bsr_row_start + nnzb_per_row - 1) * block_dim * block_dim
-                                      + (BLOCK_SIZE * j + lane_id) * block_dim
-                                      + csr_col_index[j] % block_dim;
+                    if(direction == rocsparse_direction_row)
+                    {
+                        rocsparse_int k = (bsr_row_start + nnzb_per_row - 1) * block_dim * block_dim
+                                          + (BLOCK_SIZE * j + lane_id) * block_dim
+                                          + csr_col_index[j] % block_dim;
 
-                    bsr_val[k] = csr_value[j];
-                }
-                else
-                {
-                    rocsparse_int k = (bsr_row_start + nnzb_per_row - 1) * block_dim * block_dim
-                                      + (csr_col_index[j] % block_dim) * block_dim
-                                      + (BLOCK_SIZE * j + lane_id);
-                    bsr_val[k] = csr_value[j];
+                        bsr_val[k] = csr_value[j];
+                    }
+                    else
+                    {
+                        rocsparse_int k = (bsr_row_start + nnzb_per_row - 1) * block_dim * block_dim
+                                          + (csr_col_index[j] % block_dim) * block_dim
+                                          + (BLOCK_SIZE * j + lane_id);
+                        bsr_val[k] = csr_value[j];
+                    }
                 }
             }
-        }
 
-        // update csr_col for all threads in segment
-        csr_col = min_csr_col_index + 1;
+            // update csr_col for all threads in segment
+            csr_col = min_csr_col_index + 1;
+        }
     }
 }
 
@@ -732,6 +736,31 @@ __launch_bounds__(BLOCKSIZE) __global__
     }
 }
 
+// Zero the values of all blocks of a BSR block row, one thread block per block row, such
+// that the number of non-zero blocks does not need to be known on the host
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2bsr_fill_zero_kernel(rocsparse_int mb,
+                                  rocsparse_int block_dim,
+                                  const rocsparse_int* __restrict__ bsr_row_ptr,
+                                  T* __restrict__ bsr_val)
+{
+    rocsparse_int row = hipBlockIdx_x;
+
+    if(row >= mb)
+    {
+        return;
+    }
+
+    rocsparse_int start = (bsr_row_ptr[row] - bsr_row_ptr[0]) * block_dim * block_dim;
+    rocsparse_int end   = (bsr_row_ptr[row + 1] - bsr_row_ptr[0]) * block_dim * block_dim;
+
+    for(rocsparse_int i = start + hipThreadIdx_x; i < end; i += BLOCKSIZE)
+    {
+        bsr_val[i] = static_cast<T>(0);
+    }
+}
+
 template <typename T, rocsparse_int BLOCK_SIZE>
 __launch_bounds__(BLOCK_SIZE) __global__
     void csr2bsr_block_dim_equals_one_kernel(rocsparse_int              m,
@@ -49,4 +49,20 @@ __launch_bounds__(BLOCKSIZE) __global__ void csr2csc_permute_kernel(rocsparse_in
     out2[gid] = in2[idx];
 }
 
+// Invert the column sort permutation, such that every CSR entry knows its CSC position
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2csc_map_kernel(rocsparse_int        nnz,
+                                                                const rocsparse_int* perm,
+                                                                rocsparse_int*       csc_map)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csc_map[perm[gid]] = gid;
+}
+
 #endif // CSR2CSC_DEVICE_H
@@ -73,6 +73,19 @@ __launch_bounds__(BLOCK_SIZE) __global__
     }
 }
 
+// Set the first entry of the row pointer array to the index base on the device, such
+// that no (synchronous) copy from pageable host memory is required
+template <rocsparse_int BLOCK_SIZE>
+__launch_bounds__(BLOCK_SIZE) __global__
+    void set_row_ptr_base_kernel(rocsparse_index_base idx_base_C,
+                                 rocsparse_int* __restrict__ csr_row_ptr_C)
+{
+    if(hipThreadIdx_x == 0)
+    {
+        csr_row_ptr_C[0] = idx_base_C;
+    }
+}
+
 template <typename T,
           rocsparse_int BLOCK_SIZE,
           rocsparse_int SEGMENTS_PER_BLOCK,
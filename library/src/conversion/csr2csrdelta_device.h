@@ -0,0 +1,239 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2CSRDELTA_DEVICE_H
+#define CSR2CSRDELTA_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// Column indices of the delta compressed CSR format are stored as offsets to the first
+// column of their row. The offsets of a block of rows are packed with a common width of
+// 1, 2 or sizeof(rocsparse_int) bytes into an array of rocsparse_int words.
+static __device__ __forceinline__ rocsparse_int csrdelta_load_offset(
+    const rocsparse_int* __restrict__ words, rocsparse_int width, rocsparse_int p)
+{
+    if(width == 1)
+    {
+        return reinterpret_cast<const unsigned char*>(words)[p];
+    }
+    else if(width == 2)
+    {
+        return reinterpret_cast<const unsigned short*>(words)[p];
+    }
+
+    return words[p];
+}
+
+static __device__ __forceinline__ void csrdelta_store_offset(rocsparse_int* __restrict__ words,
+                                                             rocsparse_int width,
+                                                             rocsparse_int p,
+                                                             rocsparse_int offset)
+{
+    if(width == 1)
+    {
+        reinterpret_cast<unsigned char*>(words)[p] = offset;
+    }
+    else if(width == 2)
+    {
+        reinterpret_cast<unsigned short*>(words)[p] = offset;
+    }
+    else
+    {
+        words[p] = offset;
+    }
+}
+
+// Each thread determines the width that is required for the offsets of a row, which is
+// given by the span of its column indices. Only rows that require more than a single
+// byte update the width of their block.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdelta_row_width_kernel(rocsparse_int m,
+                                       rocsparse_int block_dim,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       rocsparse_int* __restrict__ csrdelta_width,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    if(row_begin == row_end)
+    {
+        return;
+    }
+
+    rocsparse_int span = csr_col_ind[row_end - 1] - csr_col_ind[row_begin];
+
+    if(span > 0xFFFF)
+    {
+        atomicMax(&csrdelta_width[ai / block_dim], (rocsparse_int)sizeof(rocsparse_int));
+    }
+    else if(span > 0xFF)
+    {
+        atomicMax(&csrdelta_width[ai / block_dim], 2);
+    }
+}
+
+// Each thread finalizes the width of a block and stores the number of words that are
+// required for its packed offsets in block_ptr for the subsequent scan.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdelta_block_nnz_kernel(rocsparse_int m,
+                                       rocsparse_int nblocks,
+                                       rocsparse_int block_dim,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       rocsparse_int* __restrict__ csrdelta_block_ptr,
+                                       rocsparse_int* __restrict__ csrdelta_width,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int b = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(b >= nblocks)
+    {
+        return;
+    }
+
+    if(b == 0)
+    {
+        csrdelta_block_ptr[0] = idx_base;
+    }
+
+    rocsparse_int width = max(csrdelta_width[b], 1);
+    rocsparse_int nnzb  = csr_row_ptr[min((b + 1) * block_dim, m)] - csr_row_ptr[b * block_dim];
+
+    csrdelta_width[b] = width;
+    csrdelta_block_ptr[b + 1]
+        = (nnzb == 0) ? 0 : (static_cast<size_t>(nnzb) * width - 1) / sizeof(rocsparse_int) + 1;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdelta_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// CSR to delta compressed CSR conversion kernel. Each thread packs the offsets of a row.
+// The thread of the last row of a block also clears the unused bytes of the last word,
+// such that the packed array is fully defined.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdelta_kernel(rocsparse_int m,
+                             rocsparse_int block_dim,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const rocsparse_int* __restrict__ csrdelta_block_ptr,
+                             const rocsparse_int* __restrict__ csrdelta_width,
+                             rocsparse_int* __restrict__ csrdelta_row_col,
+                             rocsparse_int* __restrict__ csrdelta_col_ind,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int b         = ai / block_dim;
+    rocsparse_int width     = csrdelta_width[b];
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    rocsparse_int block_begin = csr_row_ptr[b * block_dim] - idx_base;
+
+    rocsparse_int* words = csrdelta_col_ind + csrdelta_block_ptr[b] - idx_base;
+
+    // Empty rows store the index base as their first column
+    rocsparse_int first = (row_begin < row_end) ? csr_col_ind[row_begin] : idx_base;
+
+    csrdelta_row_col[ai] = first;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        csrdelta_store_offset(words, width, j - block_begin, csr_col_ind[j] - first);
+    }
+
+    if(ai == min((b + 1) * block_dim, m) - 1)
+    {
+        size_t used  = static_cast<size_t>(row_end - block_begin) * width;
+        size_t bytes = static_cast<size_t>(csrdelta_block_ptr[b + 1] - csrdelta_block_ptr[b])
+                       * sizeof(rocsparse_int);
+
+        for(size_t k = used; k < bytes; ++k)
+        {
+            reinterpret_cast<unsigned char*>(words)[k] = 0;
+        }
+    }
+}
+
+// Delta compressed CSR to CSR conversion kernel. Each thread decodes the column indices
+// of a row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrdelta2csr_kernel(rocsparse_int m,
+                             rocsparse_int block_dim,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csrdelta_block_ptr,
+                             const rocsparse_int* __restrict__ csrdelta_width,
+                             const rocsparse_int* __restrict__ csrdelta_row_col,
+                             const rocsparse_int* __restrict__ csrdelta_col_ind,
+                             rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int b         = ai / block_dim;
+    rocsparse_int width     = csrdelta_width[b];
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    rocsparse_int block_begin = csr_row_ptr[b * block_dim] - idx_base;
+
+    const rocsparse_int* words = csrdelta_col_ind + csrdelta_block_ptr[b] - idx_base;
+
+    rocsparse_int first = csrdelta_row_col[ai];
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        csr_col_ind[j] = first + csrdelta_load_offset(words, width, j - block_begin);
+    }
+}
+
+#endif // CSR2CSRDELTA_DEVICE_H
@@ -129,4 +129,31 @@ __launch_bounds__(BLOCKSIZE) __global__ void csr2ell_kernel(rocsparse_int
     }
 }
 
+// Compute the ELL position of each CSR entry. Entries that do not fit into ell_width
+// are marked with -1.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2ell_map_kernel(rocsparse_int        m,
+                                                                const rocsparse_int* csr_row_ptr,
+                                                                rocsparse_index_base csr_idx_base,
+                                                                rocsparse_int        ell_width,
+                                                                rocsparse_int*       ell_map)
+{
+    rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - csr_idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - csr_idx_base;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        rocsparse_int p = aj - row_begin;
+
+        ell_map[aj] = (p < ell_width) ? ELL_IND(ai, p, m, ell_width) : -1;
+    }
+}
+
 #endif // CSR2ELL_DEVICE_H
@@ -628,6 +628,33 @@ __launch_bounds__(BLOCKSIZE) __global__
     }
 }
 
+// Zero the values of all blocks of a GEBSR block row, one thread block per block row, such
+// that the number of non-zero blocks does not need to be known on the host
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2gebsr_fill_zero_kernel(rocsparse_int mb,
+                                    rocsparse_int row_block_dim,
+                                    rocsparse_int col_block_dim,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr,
+                                    T* __restrict__ bsr_val)
+{
+    rocsparse_int row = hipBlockIdx_x;
+
+    if(row >= mb)
+    {
+        return;
+    }
+
+    rocsparse_int block_size = row_block_dim * col_block_dim;
+    rocsparse_int start      = (bsr_row_ptr[row] - bsr_row_ptr[0]) * block_size;
+    rocsparse_int end        = (bsr_row_ptr[row + 1] - bsr_row_ptr[0]) * block_size;
+
+    for(rocsparse_int i = start + hipThreadIdx_x; i < end; i += BLOCKSIZE)
+    {
+        bsr_val[i] = static_cast<T>(0);
+    }
+}
+
 template <typename T, rocsparse_int BLOCK_SIZE>
 __launch_bounds__(BLOCK_SIZE) __global__
     void csr2gebsr_kernel_bm1_bn1(rocsparse_int              m,
@@ -654,4 +681,66 @@ __launch_bounds__(BLOCK_SIZE) __global__
     }
 }
 
+// Compute the GEBSR position of each CSR entry. The block of an entry is found by binary
+// search in the block row, starting behind the block of the previous entry of the row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2gebsr_map_kernel(rocsparse_direction  direction,
+                              rocsparse_int        m,
+                              rocsparse_index_base csr_base,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_index_base bsr_base,
+                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                              const rocsparse_int* __restrict__ bsr_col_ind,
+                              rocsparse_int row_block_dim,
+                              rocsparse_int col_block_dim,
+                              rocsparse_int* __restrict__ bsr_map)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int block_row = row / row_block_dim;
+    rocsparse_int local_row = row % row_block_dim;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+    rocsparse_int lo  = bsr_row_ptr[block_row] - bsr_base;
+    rocsparse_int end = bsr_row_ptr[block_row + 1] - bsr_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col       = csr_col_ind[j] - csr_base;
+        rocsparse_int block_col = col / col_block_dim;
+        rocsparse_int local_col = col % col_block_dim;
+
+        rocsparse_int hi = end - 1;
+
+        while(lo < hi)
+        {
+            rocsparse_int mid = (lo + hi) >> 1;
+
+            if(bsr_col_ind[mid] - bsr_base < block_col)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        rocsparse_int offset = (direction == rocsparse_direction_row)
+                                   ? col_block_dim * local_row + local_col
+                                   : row_block_dim * local_col + local_row;
+
+        bsr_map[j] = row_block_dim * col_block_dim * lo + offset;
+    }
+}
+
 #endif // CSR2GEBSR_DEVICE_H
@@ -29,14 +29,16 @@
 #include "handle.h"
 
 // Compute non-zero entries per CSR row to obtain the COO nnz per row.
-template <unsigned int BLOCKSIZE>
+// The ELL width is either a host value or a device pointer.
+template <unsigned int BLOCKSIZE, typename U>
 __launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
-                                                         rocsparse_int        ell_width,
+                                                         U                    ell_width_device_host,
                                                          const rocsparse_int* csr_row_ptr,
                                                          rocsparse_int*       coo_row_nnz,
                                                          rocsparse_index_base idx_base)
 {
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int gid       = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int ell_width = load_scalar_device_host(ell_width_device_host);
 
     if(gid < m)
     {
@@ -59,6 +61,42 @@ __launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
     }
 }
 
+// Determine the ELL width of the HYB matrix on the device, such that the
+// partitioning does not require the number of non-zeros on the host.
+__global__ void csr2hyb_ell_width_kernel(rocsparse_int           m,
+                                         const rocsparse_int*    csr_row_ptr,
+                                         rocsparse_hyb_partition partition_type,
+                                         rocsparse_int           user_ell_width,
+                                         const rocsparse_int*    max_row_nnz,
+                                         rocsparse_int*          ell_width,
+                                         rocsparse_index_base    idx_base)
+{
+    if(partition_type == rocsparse_hyb_partition_user)
+    {
+        // ELL width given by user
+        *ell_width = user_ell_width;
+    }
+    else if(partition_type == rocsparse_hyb_partition_auto)
+    {
+        // ELL width determined by average nnz per row
+        *ell_width = (csr_row_ptr[m] - idx_base - 1) / m + 1;
+    }
+    else
+    {
+        // HYB == ELL - no COO part - maximum nnz per row
+        *ell_width = max_row_nnz[0];
+    }
+}
+
+// Extract the COO nnz from the COO row offsets
+__global__ void csr2hyb_coo_nnz_kernel(rocsparse_int        m,
+                                       const rocsparse_int* coo_row_ptr,
+                                       rocsparse_int*       coo_nnz,
+                                       rocsparse_index_base idx_base)
+{
+    *coo_nnz = coo_row_ptr[m] - idx_base;
+}
+
 // CSR to HYB format conversion kernel
 template <typename T, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int        m,
@@ -116,4 +154,62 @@ __launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int
     }
 }
 
+// Compute the HYB position of each CSR entry. Positions of the ELL part are given by
+// [0, ell_nnz), positions of the COO part are shifted by ell_nnz.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_map_kernel(rocsparse_int        m,
+                                                                const rocsparse_int* csr_row_ptr,
+                                                                rocsparse_int        ell_width,
+                                                                rocsparse_int        ell_nnz,
+                                                                const rocsparse_int* workspace,
+                                                                rocsparse_int*       hyb_map,
+                                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+    rocsparse_int coo_idx   = workspace ? workspace[ai] - idx_base + ell_nnz : ell_nnz;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        rocsparse_int p = aj - row_begin;
+
+        hyb_map[aj] = (p < ell_width) ? ELL_IND(ai, p, m, ell_width) : coo_idx++;
+    }
+}
+
+// Refresh the values of a HYB matrix from its CSR source
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_values_kernel(rocsparse_int        nnz,
+                                                                   const T*             csr_val,
+                                                                   const rocsparse_int* hyb_map,
+                                                                   rocsparse_int        ell_nnz,
+                                                                   T*                   ell_val,
+                                                                   T*                   coo_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int idx = hyb_map[gid];
+
+    if(idx < ell_nnz)
+    {
+        ell_val[idx] = csr_val[gid];
+    }
+    else
+    {
+        coo_val[idx - ell_nnz] = csr_val[gid];
+    }
+}
+
 #endif // CSR2HYB_DEVICE_H
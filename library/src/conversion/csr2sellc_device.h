@@ -0,0 +1,174 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSR2SELLC_DEVICE_H
+#define CSR2SELLC_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// Compute the number of non-zero entries per CSR row and initialize the row permutation
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sellc_row_nnz_kernel(rocsparse_int m,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  rocsparse_int* __restrict__ row_nnz,
+                                  rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    row_nnz[ai] = csr_row_ptr[ai + 1] - csr_row_ptr[ai];
+    perm[ai]    = ai;
+}
+
+// Compute the offsets of the sorting windows of sigma consecutive rows
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sellc_window_offsets_kernel(rocsparse_int m,
+                                         rocsparse_int nwindows,
+                                         rocsparse_int sigma,
+                                         rocsparse_int* __restrict__ offsets)
+{
+    rocsparse_int w = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(w > nwindows)
+    {
+        return;
+    }
+
+    offsets[w] = min(w * sigma, m);
+}
+
+// Each thread determines the width of a slice, which is the maximum number of
+// non-zero entries of its permuted rows. The padded number of entries of the
+// slice is stored in slice_ptr for the subsequent scan.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sellc_slice_nnz_kernel(rocsparse_int m,
+                                    rocsparse_int nslices,
+                                    rocsparse_int slice_size,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ sell_perm,
+                                    rocsparse_int* __restrict__ sell_slice_ptr,
+                                    rocsparse_index_base sell_base)
+{
+    rocsparse_int s = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(s >= nslices)
+    {
+        return;
+    }
+
+    if(s == 0)
+    {
+        sell_slice_ptr[0] = sell_base;
+    }
+
+    rocsparse_int slice_begin = s * slice_size;
+    rocsparse_int slice_end   = min(slice_begin + slice_size, m);
+
+    rocsparse_int width = 0;
+
+    for(rocsparse_int i = slice_begin; i < slice_end; ++i)
+    {
+        rocsparse_int row = sell_perm[i];
+
+        width = max(width, csr_row_ptr[row + 1] - csr_row_ptr[row]);
+    }
+
+    sell_slice_ptr[s + 1] = width * slice_size;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sellc_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// CSR to SELL-C-sigma format conversion kernel. Each thread fills a row of a slice,
+// such that consecutive threads write consecutive entries of the column-major slices.
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sellc_kernel(rocsparse_int m,
+                          rocsparse_int nslices,
+                          const T* __restrict__ csr_val,
+                          const rocsparse_int* __restrict__ csr_row_ptr,
+                          const rocsparse_int* __restrict__ csr_col_ind,
+                          rocsparse_index_base csr_base,
+                          rocsparse_int        slice_size,
+                          const rocsparse_int* __restrict__ sell_slice_ptr,
+                          const rocsparse_int* __restrict__ sell_perm,
+                          T* __restrict__ sell_val,
+                          rocsparse_int* __restrict__ sell_col_ind,
+                          rocsparse_index_base sell_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= nslices * slice_size)
+    {
+        return;
+    }
+
+    rocsparse_int s    = ai / slice_size;
+    rocsparse_int lane = ai % slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base + lane;
+    rocsparse_int width       = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / slice_size;
+
+    rocsparse_int p = 0;
+
+    // Rows of the last slice beyond m are padding only
+    if(ai < m)
+    {
+        rocsparse_int row = sell_perm[ai];
+
+        rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+        // Fill SELL-C-sigma slice
+        for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+        {
+            rocsparse_int idx = slice_begin + (p++) * slice_size;
+            sell_col_ind[idx] = csr_col_ind[aj] - csr_base + sell_base;
+            sell_val[idx]     = csr_val[aj];
+        }
+    }
+
+    // Pad remaining SELL-C-sigma slice
+    for(; p < width; ++p)
+    {
+        rocsparse_int idx = slice_begin + p * slice_size;
+        sell_col_ind[idx] = -1;
+        sell_val[idx]     = static_cast<T>(0);
+    }
+}
+
+#endif // CSR2SELLC_DEVICE_H
@@ -27,20 +27,129 @@
 #define CSRSORT_DEVICE_H
 
 #include <hip/hip_runtime.h>
+#include <limits>
 
-// Shift CSR offsets
-template <unsigned int BLOCKSIZE>
+// Sort rows with at most SEGMENT_SIZE entries in registers. Each row is processed by a
+// segment of SEGMENT_SIZE threads, using a bitonic sort across the segment. Ties are
+// broken by the original position, such that the sort is stable. Rows that are sorted
+// already are skipped. Longer unsorted rows are stored as zero based segments for the
+// segmented radix sort, all other rows as empty segments.
+template <unsigned int BLOCKSIZE, unsigned int SEGMENT_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrsort_shift_kernel(rocsparse_int size, const rocsparse_int* in, rocsparse_int* out)
+    void csrsort_segment_kernel(rocsparse_int        m,
+                                rocsparse_index_base idx_base,
+                                const rocsparse_int* csr_row_ptr,
+                                rocsparse_int*       csr_col_ind,
+                                rocsparse_int*       perm,
+                                rocsparse_int*       seg_begin,
+                                rocsparse_int*       seg_end)
 {
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int lid = hipThreadIdx_x & (SEGMENT_SIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / SEGMENT_SIZE;
 
-    if(gid >= size)
+    if(row >= m)
     {
         return;
     }
 
-    out[gid] = in[gid] - 1;
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    rocsparse_int row_nnz   = row_end - row_begin;
+
+    // Determine whether the row is sorted already
+    int unsorted = 0;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end - 1; j += SEGMENT_SIZE)
+    {
+        if(csr_col_ind[j] > csr_col_ind[j + 1])
+        {
+            unsorted = 1;
+            break;
+        }
+    }
+
+    for(unsigned int j = SEGMENT_SIZE >> 1; j > 0; j >>= 1)
+    {
+        unsorted |= __shfl_xor(unsorted, j, SEGMENT_SIZE);
+    }
+
+    if(lid == 0)
+    {
+        seg_begin[row] = row_begin;
+        seg_end[row]   = (unsorted && row_nnz > SEGMENT_SIZE) ? row_end : row_begin;
+    }
+
+    // Skip sorted rows and rows that are left to the segmented radix sort
+    if(!unsorted || row_nnz > SEGMENT_SIZE)
+    {
+        return;
+    }
+
+    // Pad the segment with entries that are sorted to its end
+    rocsparse_int col = (lid < row_nnz) ? csr_col_ind[row_begin + lid]
+                                        : std::numeric_limits<rocsparse_int>::max();
+    rocsparse_int pos = lid;
+
+    for(unsigned int k = 2; k <= SEGMENT_SIZE; k <<= 1)
+    {
+        for(unsigned int j = k >> 1; j > 0; j >>= 1)
+        {
+            rocsparse_int other_col = __shfl_xor(col, j, SEGMENT_SIZE);
+            rocsparse_int other_pos = __shfl_xor(pos, j, SEGMENT_SIZE);
+
+            bool other_less = other_col < col || (other_col == col && other_pos < pos);
+
+            // The lower thread of an ascending pair and the upper thread of a descending
+            // pair keep the minimum
+            if(((lid & j) == 0) == ((lid & k) == 0) ? other_less : !other_less)
+            {
+                col = other_col;
+                pos = other_pos;
+            }
+        }
+    }
+
+    if(perm != nullptr)
+    {
+        rocsparse_int p = (lid < row_nnz) ? perm[row_begin + lid] : 0;
+
+        p = __shfl(p, pos, SEGMENT_SIZE);
+
+        if(lid < row_nnz)
+        {
+            perm[row_begin + lid] = p;
+        }
+    }
+
+    if(lid < row_nnz)
+    {
+        csr_col_ind[row_begin + lid] = col;
+    }
+}
+
+// Copy the rows that have been sorted by the segmented radix sort from the alternate
+// buffer. Each row is processed by a segment of SEGMENT_SIZE threads.
+template <unsigned int BLOCKSIZE, unsigned int SEGMENT_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csrsort_copy_kernel(rocsparse_int        m,
+                                                                 const rocsparse_int* seg_begin,
+                                                                 const rocsparse_int* seg_end,
+                                                                 const rocsparse_int* in,
+                                                                 rocsparse_int*       out)
+{
+    rocsparse_int lid = hipThreadIdx_x & (SEGMENT_SIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / SEGMENT_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_end = seg_end[row];
+
+    for(rocsparse_int j = seg_begin[row] + lid; j < row_end; j += SEGMENT_SIZE)
+    {
+        out[j] = in[j];
+    }
 }
 
 #endif // CSRSORT_DEVICE_H
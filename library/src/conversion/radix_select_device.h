@@ -0,0 +1,196 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef RADIX_SELECT_DEVICE_H
+#define RADIX_SELECT_DEVICE_H
+
+#include "common.h"
+
+// Unsigned integer type with the bit pattern of T. The bit patterns of non-negative
+// floating point values are ordered like the values, such that clearing the sign bit
+// yields the key of the absolute value.
+template <typename T>
+struct radix_select_key;
+
+template <>
+struct radix_select_key<float>
+{
+    using type = uint32_t;
+
+    static __device__ __forceinline__ type encode_abs(float x)
+    {
+        return __float_as_uint(x) & 0x7fffffffU;
+    }
+
+    static __device__ __forceinline__ float decode(type key)
+    {
+        return __uint_as_float(key);
+    }
+};
+
+template <>
+struct radix_select_key<double>
+{
+    using type = uint64_t;
+
+    static __device__ __forceinline__ type encode_abs(double x)
+    {
+        return __double_as_longlong(x) & 0x7fffffffffffffffULL;
+    }
+
+    static __device__ __forceinline__ double decode(type key)
+    {
+        return __longlong_as_double(key);
+    }
+};
+
+// Digits selected so far and rank of the selected element among all elements that
+// share these digits
+template <typename K>
+struct radix_select_state
+{
+    K       prefix;
+    int64_t rank;
+};
+
+template <unsigned int RADIX, typename K>
+__launch_bounds__(RADIX) __global__
+    void radix_select_init_kernel(int64_t rank,
+                                  radix_select_state<K>* __restrict__ state,
+                                  unsigned long long* __restrict__ histogram)
+{
+    histogram[hipThreadIdx_x] = 0;
+
+    if(hipThreadIdx_x == 0)
+    {
+        state->prefix = 0;
+        state->rank   = rank;
+    }
+}
+
+// Count the digits at position shift of the absolute values of A, that match all
+// previously selected digits
+template <unsigned int BLOCKSIZE, unsigned int RADIX_BITS, typename T, typename K>
+__launch_bounds__(BLOCKSIZE) __global__
+    void radix_select_histogram_kernel(rocsparse_int m,
+                                       rocsparse_int n,
+                                       const T* __restrict__ A,
+                                       rocsparse_int lda,
+                                       unsigned int  shift,
+                                       const radix_select_state<K>* __restrict__ state,
+                                       unsigned long long* __restrict__ histogram)
+{
+    constexpr unsigned int RADIX = 1 << RADIX_BITS;
+
+    __shared__ unsigned int shist[RADIX];
+
+    for(unsigned int i = hipThreadIdx_x; i < RADIX; i += BLOCKSIZE)
+    {
+        shist[i] = 0;
+    }
+
+    __syncthreads();
+
+    unsigned int upper  = shift + RADIX_BITS;
+    K            mask   = (upper == sizeof(K) * 8) ? 0 : ~static_cast<K>(0) << upper;
+    K            prefix = state->prefix;
+
+    int64_t size = static_cast<int64_t>(m) * n;
+
+    for(int64_t idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x; idx < size;
+        idx += hipGridDim_x * BLOCKSIZE)
+    {
+        K key = radix_select_key<T>::encode_abs(A[lda * (idx / m) + idx % m]);
+
+        if((key & mask) == prefix)
+        {
+            atomicAdd(&shist[(key >> shift) & (RADIX - 1)], 1U);
+        }
+    }
+
+    __syncthreads();
+
+    for(unsigned int i = hipThreadIdx_x; i < RADIX; i += BLOCKSIZE)
+    {
+        if(shist[i] > 0)
+        {
+            atomicAdd(&histogram[i], static_cast<unsigned long long>(shist[i]));
+        }
+    }
+}
+
+// Select the digit at position shift, whose range of ranks contains the rank of the
+// selected element. The histogram is reset for the next pass and the selected element
+// is written to value after the last pass.
+template <unsigned int RADIX, typename T, typename K>
+__launch_bounds__(RADIX) __global__
+    void radix_select_digit_kernel(unsigned int shift,
+                                   radix_select_state<K>* __restrict__ state,
+                                   unsigned long long* __restrict__ histogram,
+                                   T* __restrict__ value)
+{
+    unsigned int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[RADIX];
+
+    K                  prefix = state->prefix;
+    int64_t            rank   = state->rank;
+    unsigned long long count  = histogram[tid];
+
+    histogram[tid] = 0;
+    sdata[tid]     = count;
+
+    __syncthreads();
+
+    // Inclusive scan of the histogram
+    for(unsigned int i = 1; i < RADIX; i <<= 1)
+    {
+        unsigned long long sum = (tid >= i) ? sdata[tid - i] : 0;
+
+        __syncthreads();
+
+        sdata[tid] += sum;
+
+        __syncthreads();
+    }
+
+    int64_t end   = sdata[tid];
+    int64_t begin = end - count;
+
+    if(begin <= rank && rank < end)
+    {
+        prefix |= static_cast<K>(tid) << shift;
+
+        state->prefix = prefix;
+        state->rank   = rank - begin;
+
+        if(shift == 0)
+        {
+            *value = radix_select_key<T>::decode(prefix);
+        }
+    }
+}
+
+#endif // RADIX_SELECT_DEVICE_H
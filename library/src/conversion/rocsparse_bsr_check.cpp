@@ -0,0 +1,103 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_check_matrix.hpp"
+
+extern "C" rocsparse_status rocsparse_bsr_check(rocsparse_handle          handle,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_data_status*    data_status)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_bsr_check",
+              mb,
+              nb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)data_status);
+
+    log_bench(handle,
+              "./rocsparse-bench -f bsr_check",
+              "--mtx <matrix.mtx>",
+              "--blockdim",
+              block_dim);
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(data_status == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The block structure of a BSR matrix is a CSR matrix of dimension mb x nb
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_check_csr_structure(
+        handle, mb, nb, nnzb, descr->base, bsr_row_ptr, bsr_col_ind));
+
+    // Diagonal blocks are required for non unit diagonal matrices
+    return rocsparse_check_matrix_status(
+        handle, mb, nb, descr->diag_type == rocsparse_diag_type_non_unit, data_status);
+}
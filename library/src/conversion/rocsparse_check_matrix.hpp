@@ -0,0 +1,222 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CHECK_MATRIX_HPP
+#define ROCSPARSE_CHECK_MATRIX_HPP
+#include "utility.h"
+
+#include "check_matrix_device.h"
+#include "definitions.h"
+
+// The rank of the most severe violation and the number of diagonal entries are
+// accumulated in the first two entries of the handle device buffer, the third entry
+// holds the data status if it is requested in host pointer mode
+static inline rocsparse_int* rocsparse_check_matrix_workspace(rocsparse_handle handle)
+{
+    return reinterpret_cast<rocsparse_int*>(handle->buffer);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int SEGMENT_SIZE>
+static void rocsparse_check_csr_indices_launch(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               rocsparse_int        nnz,
+                                               rocsparse_index_base idx_base,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int*       data)
+{
+    hipLaunchKernelGGL((check_csr_indices_kernel<BLOCKSIZE, SEGMENT_SIZE>),
+                       dim3((m - 1) / (BLOCKSIZE / SEGMENT_SIZE) + 1),
+                       dim3(BLOCKSIZE),
+                       0,
+                       handle->stream,
+                       m,
+                       n,
+                       nnz,
+                       idx_base,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       data);
+}
+
+// Accumulate the structural violations of a CSR matrix in the workspace. Row offsets
+// and column indices are checked in a single pass over the matrix.
+static inline rocsparse_status rocsparse_check_csr_structure(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            rocsparse_int        n,
+                                                            rocsparse_int        nnz,
+                                                            rocsparse_index_base idx_base,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* data = rocsparse_check_matrix_workspace(handle);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(data, 0, sizeof(rocsparse_int) * 2, stream));
+
+#define CHECK_MATRIX_DIM 256
+    hipLaunchKernelGGL((check_csr_offsets_kernel<CHECK_MATRIX_DIM>),
+                       dim3(m / CHECK_MATRIX_DIM + 1),
+                       dim3(CHECK_MATRIX_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       idx_base,
+                       csr_row_ptr,
+                       data);
+
+    if(m > 0)
+    {
+        rocsparse_int nnz_per_row = nnz / m;
+
+#define CHECK_CSR_LAUNCH(SEGMENT_SIZE)                                  \
+    rocsparse_check_csr_indices_launch<CHECK_MATRIX_DIM, SEGMENT_SIZE>( \
+        handle, m, n, nnz, idx_base, csr_row_ptr, csr_col_ind, data)
+
+        if(nnz_per_row < 4)
+        {
+            CHECK_CSR_LAUNCH(2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            CHECK_CSR_LAUNCH(4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            CHECK_CSR_LAUNCH(8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            CHECK_CSR_LAUNCH(16);
+        }
+        else if(nnz_per_row < 64)
+        {
+            CHECK_CSR_LAUNCH(32);
+        }
+        else
+        {
+            CHECK_CSR_LAUNCH(64);
+        }
+
+#undef CHECK_CSR_LAUNCH
+    }
+#undef CHECK_MATRIX_DIM
+
+    return rocsparse_status_success;
+}
+
+// Accumulate the structural violations of a COO matrix in the workspace
+static inline rocsparse_status rocsparse_check_coo_structure(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            rocsparse_int        n,
+                                                            rocsparse_int        nnz,
+                                                            rocsparse_index_base idx_base,
+                                                            const rocsparse_int* coo_row_ind,
+                                                            const rocsparse_int* coo_col_ind)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* data = rocsparse_check_matrix_workspace(handle);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(data, 0, sizeof(rocsparse_int) * 2, stream));
+
+    if(nnz > 0)
+    {
+#define CHECK_MATRIX_DIM 256
+        hipLaunchKernelGGL((check_coo_indices_kernel<CHECK_MATRIX_DIM>),
+                           dim3((nnz - 1) / CHECK_MATRIX_DIM + 1),
+                           dim3(CHECK_MATRIX_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           nnz,
+                           idx_base,
+                           coo_row_ind,
+                           coo_col_ind,
+                           data);
+#undef CHECK_MATRIX_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
+// Convert the accumulated violations into the data status, which is either a host or
+// a device pointer, depending on the pointer mode
+static inline rocsparse_status rocsparse_check_matrix_status(rocsparse_handle       handle,
+                                                             rocsparse_int          m,
+                                                             rocsparse_int          n,
+                                                             bool                   check_diag,
+                                                             rocsparse_data_status* data_status)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* data = rocsparse_check_matrix_workspace(handle);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(check_matrix_status_kernel,
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           check_diag,
+                           data,
+                           data_status);
+    }
+    else
+    {
+        rocsparse_data_status* status = reinterpret_cast<rocsparse_data_status*>(data + 2);
+
+        hipLaunchKernelGGL(check_matrix_status_kernel,
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           check_diag,
+                           data,
+                           status);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            data_status, status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CHECK_MATRIX_HPP
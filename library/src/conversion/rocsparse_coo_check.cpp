@@ -0,0 +1,92 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_check_matrix.hpp"
+
+extern "C" rocsparse_status rocsparse_coo_check(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      coo_row_ind,
+                                                const rocsparse_int*      coo_col_ind,
+                                                rocsparse_data_status*    data_status)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_coo_check",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)data_status);
+
+    log_bench(handle, "./rocsparse-bench -f coo_check", "--mtx <matrix.mtx>");
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(data_status == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_check_coo_structure(handle, m, n, nnz, descr->base, coo_row_ind, coo_col_ind));
+
+    // Diagonal entries are implicit for unit diagonal matrices
+    return rocsparse_check_matrix_status(
+        handle, m, n, descr->diag_type == rocsparse_diag_type_non_unit, data_status);
+}
@@ -109,19 +109,34 @@ extern "C" rocsparse_status rocsparse_coosort_buffer_size(rocsparse_handle     h
     RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
         nullptr, size, rpdummy, rpdummy, nnz, m, ptr, ptr + 1, 0, 32, stream));
     *buffer_size = std::max(size, *buffer_size);
+
+    // Sort of packed row and column indices
+    uint64_t*                        kptr = reinterpret_cast<uint64_t*>(buffer_size);
+    rocprim::double_buffer<uint64_t> kdummy(kptr, kptr);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, kdummy, dummy, nnz, 0, 64, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(nullptr, size, kdummy, nnz, 0, 64, stream));
+    *buffer_size = std::max(size, *buffer_size);
     *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
 
     // rocPRIM does not support in-place sorting, so we need additional buffer
     // for all temporary arrays
 
-    // rows buffer
-    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
-    // columns buffer
-    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
-    // perm buffer
-    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // rows, columns and perm buffer
+    size_t work_size = sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256 * 3;
     // segment buffer
-    *buffer_size += sizeof(rocsparse_int) * (std::max(m, n) / 256 + 1) * 256;
+    work_size += sizeof(rocsparse_int) * (std::max(m, n) / 256 + 1) * 256;
+
+    // Two key and two perm buffers, if row and column indices are packed
+    size_t packed_size
+        = (sizeof(uint64_t) + sizeof(rocsparse_int)) * ((nnz - 1) / 256 + 1) * 256 * 2;
+
+    *buffer_size += std::max(work_size, packed_size);
+
+    // analysis buffer
+    *buffer_size += 256;
 
     return rocsparse_status_success;
 }
@@ -191,11 +206,108 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // analysis buffer
+    rocsparse_int* unsorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+#define COOSORT_DIM 512
+    dim3 coosort_blocks((nnz - 1) / COOSORT_DIM + 1);
+    dim3 coosort_threads(COOSORT_DIM);
+
     unsigned int startbit = 0;
     unsigned int endbit   = rocsparse_clz(m);
+    unsigned int col_bits = rocsparse_clz(n);
 
-    // Temporary buffer entry points
-    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    // If row and column indices fit into 64 bits, pack them into a single key, such that
+    // the entries are sorted by a single radix sort
+    if(endbit + col_bits <= 64)
+    {
+        size_t nnz_size = ((nnz - 1) / 256 + 1) * 256;
+
+        uint64_t* key1 = reinterpret_cast<uint64_t*>(ptr);
+        ptr += sizeof(uint64_t) * nnz_size;
+
+        uint64_t* key2 = reinterpret_cast<uint64_t*>(ptr);
+        ptr += sizeof(uint64_t) * nnz_size;
+
+        rocsparse_int* idx1 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * nnz_size;
+
+        rocsparse_int* idx2 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * nnz_size;
+
+        // Temporary rocprim buffer
+        size_t size        = 0;
+        void*  tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+        // Determine whether the entries are sorted already. The flag is only read on the
+        // device, where packing and unpacking of sorted entries is skipped, such that
+        // sorted input is left untouched without synchronizing the host.
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(unsorted, 0, sizeof(rocsparse_int), stream));
+
+        hipLaunchKernelGGL((coosort_is_sorted_kernel<COOSORT_DIM>),
+                           coosort_blocks,
+                           coosort_threads,
+                           0,
+                           stream,
+                           nnz,
+                           coo_row_ind,
+                           coo_col_ind,
+                           unsorted);
+
+        // The permutation is sorted along with the keys
+        hipLaunchKernelGGL((coosort_pack_kernel<COOSORT_DIM>),
+                           coosort_blocks,
+                           coosort_threads,
+                           0,
+                           stream,
+                           nnz,
+                           col_bits,
+                           coo_row_ind,
+                           coo_col_ind,
+                           perm,
+                           key1,
+                           idx1,
+                           unsorted);
+
+        rocprim::double_buffer<uint64_t>      keys(key1, key2);
+        rocprim::double_buffer<rocsparse_int> vals(idx1, idx2);
+
+        if(perm != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                nullptr, size, keys, vals, nnz, startbit, endbit + col_bits, stream));
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                tmp_rocprim, size, keys, vals, nnz, startbit, endbit + col_bits, stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
+                nullptr, size, keys, nnz, startbit, endbit + col_bits, stream));
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
+                tmp_rocprim, size, keys, nnz, startbit, endbit + col_bits, stream));
+        }
+
+        // Extract sorted rows, columns and permutation
+        hipLaunchKernelGGL((coosort_unpack_kernel<COOSORT_DIM>),
+                           coosort_blocks,
+                           coosort_threads,
+                           0,
+                           stream,
+                           nnz,
+                           col_bits,
+                           keys.current(),
+                           vals.current(),
+                           coo_row_ind,
+                           coo_col_ind,
+                           perm,
+                           unsorted);
+
+        return rocsparse_status_success;
+    }
 
     // Permutation vector given
     rocsparse_int* work1 = reinterpret_cast<rocsparse_int*>(ptr);
@@ -239,29 +351,23 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
                 coo_row_ind, output, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
         }
 
-        // Obtain segments for segmented sort by columns
+        // Obtain segments for segmented sort by columns. Each row is a segment, rows without
+        // entries are empty segments at the end, such that the number of non-empty rows is
+        // not required on the host.
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(work4, 0, sizeof(rocsparse_int) * (m + 1), stream));
         RETURN_IF_HIP_ERROR(rocprim::run_length_encode(
             nullptr, size, coo_row_ind, nnz, work3 + 1, work4, work3, stream));
         RETURN_IF_HIP_ERROR(rocprim::run_length_encode(
             tmp_rocprim, size, coo_row_ind, nnz, work3 + 1, work4, work3, stream));
 
-        rocsparse_int nsegm;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(&nsegm, work3, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        rocsparse_int nsegm = m;
 
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             nullptr, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             tmp_rocprim, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
 
-// Reorder columns
-#define COOSORT_DIM 512
-        dim3 coosort_blocks((nnz - 1) / COOSORT_DIM + 1);
-        dim3 coosort_threads(COOSORT_DIM);
-
+        // Reorder columns
         hipLaunchKernelGGL((coosort_permute_kernel<COOSORT_DIM>),
                            coosort_blocks,
                            coosort_threads,
@@ -281,10 +387,9 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
                            perm,
                            mapping,
                            alt_map);
-#undef COOSORT_DIM
 
         // Sort columns per row
-        endbit = rocsparse_clz(n);
+        endbit = col_bits;
 
         rocprim::double_buffer<rocsparse_int> keys2(work3, coo_col_ind);
         rocprim::double_buffer<rocsparse_int> vals2(alt_map, perm);
@@ -395,18 +500,16 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
                 coo_row_ind, output, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
         }
 
-        // Obtain segments for segmented sort by columns
+        // Obtain segments for segmented sort by columns. Each row is a segment, rows without
+        // entries are empty segments at the end, such that the number of non-empty rows is
+        // not required on the host.
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(work4, 0, sizeof(rocsparse_int) * (m + 1), stream));
         RETURN_IF_HIP_ERROR(rocprim::run_length_encode(
             nullptr, size, coo_row_ind, nnz, work3 + 1, work4, work3, stream));
         RETURN_IF_HIP_ERROR(rocprim::run_length_encode(
             tmp_rocprim, size, coo_row_ind, nnz, work3 + 1, work4, work3, stream));
 
-        rocsparse_int nsegm;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(&nsegm, work3, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        rocsparse_int nsegm = m;
 
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             nullptr, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
@@ -414,7 +517,7 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
             tmp_rocprim, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
 
         // Sort columns per row
-        endbit = rocsparse_clz(n);
+        endbit = col_bits;
 
         rocsparse_int avg_row_nnz = nnz / nsegm;
 
@@ -453,6 +556,7 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
                 coo_col_ind, output, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
         }
     }
+#undef COOSORT_DIM
 
     return rocsparse_status_success;
 }
@@ -192,10 +192,20 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
 
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hend,
+                                               &bsr_row_ptr[mb],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hstart,
+                                               &bsr_row_ptr[0],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
             *bsr_nnz = hend - hstart;
         }
 
@@ -265,20 +275,22 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
         constexpr rocsparse_int block_size       = 32;
         rocsparse_int           rows_per_segment = (block_dim + block_size - 1) / block_size;
 
-        rocsparse_int grid_size = mb;
+        // Scratch pad size per block
+        size_t block_buffer_size = block_size * 2 * rows_per_segment * sizeof(rocsparse_int);
 
-        size_t buffer_size = grid_size * block_size * 2 * rows_per_segment * sizeof(rocsparse_int);
+        // The grid is limited such that the scratch pad fits into the handle buffer, blocks
+        // loop over the remaining block rows. Temporary storage is only allocated, if the
+        // scratch pad of a single block exceeds the handle buffer.
+        rocsparse_int grid_size = static_cast<rocsparse_int>(
+            std::min(static_cast<size_t>(mb), handle->buffer_size / block_buffer_size));
 
         bool  temp_alloc       = false;
-        void* temp_storage_ptr = nullptr;
-        if(handle->buffer_size >= buffer_size)
+        void* temp_storage_ptr = handle->buffer;
+        if(grid_size == 0)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            grid_size = 1;
+
+            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, block_buffer_size));
             temp_alloc = true;
         }
 
@@ -356,16 +368,55 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
     {
         rocsparse_int hstart = 0;
         rocsparse_int hend   = 0;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hend,
+                                           &bsr_row_ptr[mb],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hstart,
+                                           &bsr_row_ptr[0],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
         *bsr_nnz = hend - hstart;
     }
 
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csr2bsr_map(rocsparse_handle          handle,
+                                                  rocsparse_direction       direction,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  const rocsparse_mat_descr bsr_descr,
+                                                  const rocsparse_int*      bsr_row_ptr,
+                                                  const rocsparse_int*      bsr_col_ind,
+                                                  rocsparse_int*            bsr_map)
+{
+    // BSR is GEBSR with square blocks
+    return rocsparse_csr2gebsr_map(handle,
+                                   direction,
+                                   m,
+                                   n,
+                                   csr_descr,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   bsr_descr,
+                                   bsr_row_ptr,
+                                   bsr_col_ind,
+                                   block_dim,
+                                   block_dim,
+                                   bsr_map);
+}
+
 extern "C" rocsparse_status rocsparse_scsr2bsr(rocsparse_handle          handle,
                                                rocsparse_direction       direction,
                                                rocsparse_int             m,
@@ -165,14 +165,18 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
     rocsparse_int mb = (m + block_dim - 1) / block_dim;
     rocsparse_int nb = (n + block_dim - 1) / block_dim;
 
-    rocsparse_int hstart = 0;
-    rocsparse_int hend   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-    hipMemset(bsr_val, 0, (hend - hstart) * block_dim * block_dim * sizeof(T));
+    // Set bsr val to zero, using the block row pointers on the device
+#define CSR2BSR_FILL_DIM 256
+    hipLaunchKernelGGL((csr2bsr_fill_zero_kernel<T, CSR2BSR_FILL_DIM>),
+                       dim3(mb),
+                       dim3(CSR2BSR_FILL_DIM),
+                       0,
+                       stream,
+                       mb,
+                       block_dim,
+                       bsr_row_ptr,
+                       bsr_val);
+#undef CSR2BSR_FILL_DIM
 
     if(block_dim == 1)
     {
@@ -300,22 +304,24 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
         constexpr rocsparse_int block_size       = 32;
         rocsparse_int           rows_per_segment = (block_dim + block_size - 1) / block_size;
 
-        rocsparse_int grid_size = mb;
-
-        size_t buffer_size
-            = grid_size * block_size
+        // Scratch pad size per block
+        size_t block_buffer_size
+            = block_size
               * (3 * rows_per_segment * sizeof(rocsparse_int) + rows_per_segment * sizeof(T));
 
+        // The grid is limited such that the scratch pad fits into the handle buffer, blocks
+        // loop over the remaining block rows. Temporary storage is only allocated, if the
+        // scratch pad of a single block exceeds the handle buffer.
+        rocsparse_int grid_size = static_cast<rocsparse_int>(
+            std::min(static_cast<size_t>(mb), handle->buffer_size / block_buffer_size));
+
         bool  temp_alloc       = false;
-        void* temp_storage_ptr = nullptr;
-        if(handle->buffer_size >= buffer_size)
+        void* temp_storage_ptr = handle->buffer;
+        if(grid_size == 0)
         {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+            grid_size = 1;
+
+            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, block_buffer_size));
             temp_alloc = true;
         }
 
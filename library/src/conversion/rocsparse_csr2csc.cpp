@@ -121,6 +121,113 @@ extern "C" rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     h
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csr2csc_map(rocsparse_handle     handle,
+                                                  rocsparse_int        m,
+                                                  rocsparse_int        n,
+                                                  rocsparse_int        nnz,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_int*       csc_map,
+                                                  void*                temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csc_map",
+              m,
+              n,
+              nnz,
+              (const void*&)csr_col_ind,
+              (const void*&)csc_map,
+              (const void*&)temp_buffer);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    // Temporary buffer entry points, same layout as rocsparse_csr2csc()
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identitiy permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, tmp_perm));
+
+    // Stable sort by columns, csc_map serves as alternate key buffer
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, csc_map);
+    rocprim::double_buffer<rocsparse_int> vals(tmp_perm, tmp_work2);
+
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Invert the permutation
+#define CSR2CSC_DIM 512
+    hipLaunchKernelGGL((csr2csc_map_kernel<CSR2CSC_DIM>),
+                       dim3((nnz - 1) / CSR2CSC_DIM + 1),
+                       dim3(CSR2CSC_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       vals.current(),
+                       csc_map);
+#undef CSR2CSC_DIM
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
                                                rocsparse_int        m,
                                                rocsparse_int        n,
@@ -0,0 +1,390 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+
+#include "csr2csrdelta_device.h"
+#include "definitions.h"
+
+#include <rocprim/rocprim.hpp>
+
+extern "C" rocsparse_status rocsparse_csr2csrdelta_buffer_size(rocsparse_handle     handle,
+                                                               rocsparse_int        m,
+                                                               rocsparse_int        n,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               rocsparse_int        block_dim,
+                                                               size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csrdelta_buffer_size",
+              m,
+              n,
+              (const void*&)csr_row_ptr,
+              block_dim,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || n < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int nblocks = (m - 1) / block_dim + 1;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                *buffer_size,
+                                                ptr,
+                                                ptr,
+                                                nblocks + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    // Do not return 0 as buffer size
+    *buffer_size = std::max(*buffer_size, static_cast<size_t>(4));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2csrdelta_nnz(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             block_dim,
+                                                       rocsparse_int*            csrdelta_block_ptr,
+                                                       rocsparse_int*            csrdelta_width,
+                                                       rocsparse_int*            csrdelta_nnz,
+                                                       void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csrdelta_nnz",
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)csrdelta_block_ptr,
+              (const void*&)csrdelta_width,
+              (const void*&)csrdelta_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check csrdelta_nnz pointer argument before setting
+    if(csrdelta_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csrdelta_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *csrdelta_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_block_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int nblocks = (m - 1) / block_dim + 1;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csrdelta_width, 0, sizeof(rocsparse_int) * nblocks, stream));
+
+#define CSR2CSRDELTA_DIM 256
+    // Determine the offset width of each block
+    hipLaunchKernelGGL((csr2csrdelta_row_width_kernel<CSR2CSRDELTA_DIM>),
+                       dim3((m - 1) / CSR2CSRDELTA_DIM + 1),
+                       dim3(CSR2CSRDELTA_DIM),
+                       0,
+                       stream,
+                       m,
+                       block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csrdelta_width,
+                       descr->base);
+
+    // Compute the number of words of each block
+    hipLaunchKernelGGL((csr2csrdelta_block_nnz_kernel<CSR2CSRDELTA_DIM>),
+                       dim3((nblocks - 1) / CSR2CSRDELTA_DIM + 1),
+                       dim3(CSR2CSRDELTA_DIM),
+                       0,
+                       stream,
+                       m,
+                       nblocks,
+                       block_dim,
+                       csr_row_ptr,
+                       csrdelta_block_ptr,
+                       csrdelta_width,
+                       descr->base);
+
+    // Inclusive sum to obtain csrdelta_block_ptr array and number of words
+    size_t size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                csrdelta_block_ptr,
+                                                csrdelta_block_ptr,
+                                                nblocks + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_buffer,
+                                                size,
+                                                csrdelta_block_ptr,
+                                                csrdelta_block_ptr,
+                                                nblocks + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrdelta_nnz,
+                                           csrdelta_block_ptr + nblocks,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz according to index base
+        if(descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL(
+                (csr2csrdelta_index_base<1>), dim3(1), dim3(1), 0, stream, csrdelta_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(csrdelta_nnz,
+                                      csrdelta_block_ptr + nblocks,
+                                      sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *csrdelta_nnz -= descr->base;
+    }
+#undef CSR2CSRDELTA_DIM
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2csrdelta(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   const rocsparse_int*      csrdelta_block_ptr,
+                                                   const rocsparse_int*      csrdelta_width,
+                                                   rocsparse_int*            csrdelta_row_col,
+                                                   rocsparse_int*            csrdelta_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csrdelta",
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)csrdelta_block_ptr,
+              (const void*&)csrdelta_width,
+              (const void*&)csrdelta_row_col,
+              (const void*&)csrdelta_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2csrdelta",
+              "--mtx <matrix.mtx>",
+              "--blockdim",
+              block_dim);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_block_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_row_col == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2CSRDELTA_DIM 256
+    hipLaunchKernelGGL((csr2csrdelta_kernel<CSR2CSRDELTA_DIM>),
+                       dim3((m - 1) / CSR2CSRDELTA_DIM + 1),
+                       dim3(CSR2CSRDELTA_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csrdelta_block_ptr,
+                       csrdelta_width,
+                       csrdelta_row_col,
+                       csrdelta_col_ind,
+                       descr->base);
+#undef CSR2CSRDELTA_DIM
+
+    return rocsparse_status_success;
+}
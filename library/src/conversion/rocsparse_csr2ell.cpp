@@ -161,6 +161,82 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csr2ell_map(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  rocsparse_int             ell_width,
+                                                  rocsparse_int*            ell_map)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2ell_map",
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              ell_width,
+              (const void*&)ell_map);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || ell_width < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || ell_width == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2ELL_DIM 512
+    hipLaunchKernelGGL((csr2ell_map_kernel<CSR2ELL_DIM>),
+                       dim3((m - 1) / CSR2ELL_DIM + 1),
+                       dim3(CSR2ELL_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       csr_row_ptr,
+                       csr_descr->base,
+                       ell_width,
+                       ell_map);
+#undef CSR2ELL_DIM
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                const rocsparse_mat_descr csr_descr,
@@ -170,10 +170,20 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
 
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hend,
+                                               &bsr_row_ptr[mb],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hstart,
+                                               &bsr_row_ptr[0],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
             *bsr_nnz_devhost = hend - hstart;
         }
 
@@ -208,20 +218,8 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
                                                     op,
                                                     handle->stream));
 
-        bool  temp_alloc       = false;
-        void* temp_storage_ptr = nullptr;
-        if(handle->buffer_size >= temp_storage_size_bytes)
-        {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
-            temp_alloc = true;
-        }
-
-        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
+        // The buffer size of rocsparse_csr2gebsr_buffer_size() accounts for the scan
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(p_buffer,
                                                     temp_storage_size_bytes,
                                                     bsr_row_ptr,
                                                     bsr_row_ptr,
@@ -229,10 +227,6 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
                                                     op,
                                                     handle->stream));
 
-        if(temp_alloc)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-        }
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
             hipLaunchKernelGGL(csr2gebsr_nnz_compute_nnz_total_kernel<1>,
@@ -248,10 +242,20 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
         {
             rocsparse_int hstart = 0;
             rocsparse_int hend   = 0;
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hend,
+                                               &bsr_row_ptr[mb],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hstart,
+                                               &bsr_row_ptr[0],
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               handle->stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
             *bsr_nnz_devhost = hend - hstart;
         }
 
@@ -370,22 +374,8 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
             = (number_of_wf_segments_needed + segments_per_wf - 1) / segments_per_wf;
         rocsparse_int grid_size = (wf_size * number_of_wfs_needed + block_size - 1) / block_size;
 
-        size_t buffer_size = grid_size * block_size * 2 * rows_per_segment * sizeof(rocsparse_int);
-
-        bool  temp_alloc       = false;
-        void* temp_storage_ptr = nullptr;
-        if(handle->buffer_size >= buffer_size)
-        {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
-            temp_alloc = true;
-        }
-
-        rocsparse_int* temp1 = (rocsparse_int*)temp_storage_ptr;
+        // Scratch pad of the kernel, accounted for by rocsparse_csr2gebsr_buffer_size()
+        rocsparse_int* temp1 = reinterpret_cast<rocsparse_int*>(p_buffer);
 
         hipLaunchKernelGGL((csr2gebsr_nnz_general_kernel<block_size, segment_size, wf_size>),
                            dim3(grid_size),
@@ -405,11 +395,6 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
                            bsr_descr->base,
                            bsr_row_ptr,
                            temp1);
-
-        if(temp_alloc)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-        }
     }
 
     // Perform inclusive scan on bsr row pointer array
@@ -418,20 +403,8 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
     RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
         nullptr, temp_storage_size_bytes, bsr_row_ptr, bsr_row_ptr, mb + 1, op, handle->stream));
 
-    bool  temp_alloc       = false;
-    void* temp_storage_ptr = nullptr;
-    if(handle->buffer_size >= temp_storage_size_bytes)
-    {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
-        temp_alloc = true;
-    }
-
-    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
+    // The buffer size of rocsparse_csr2gebsr_buffer_size() accounts for the scan
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(p_buffer,
                                                 temp_storage_size_bytes,
                                                 bsr_row_ptr,
                                                 bsr_row_ptr,
@@ -439,11 +412,6 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
                                                 op,
                                                 handle->stream));
 
-    if(temp_alloc)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-    }
-
     // Compute bsr_nnz
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -460,16 +428,123 @@ extern "C" rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          ha
     {
         rocsparse_int hstart = 0;
         rocsparse_int hend   = 0;
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hend,
+                                           &bsr_row_ptr[mb],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hstart,
+                                           &bsr_row_ptr[0],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
         *bsr_nnz_devhost = hend - hstart;
     }
 
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csr2gebsr_map(rocsparse_handle          handle,
+                                                    rocsparse_direction       direction,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const rocsparse_mat_descr bsr_descr,
+                                                    const rocsparse_int*      bsr_row_ptr,
+                                                    const rocsparse_int*      bsr_col_ind,
+                                                    rocsparse_int             row_block_dim,
+                                                    rocsparse_int             col_block_dim,
+                                                    rocsparse_int*            bsr_map)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check matrix descriptors
+    if(csr_descr == nullptr || bsr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2gebsr_map",
+              direction,
+              m,
+              n,
+              csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              bsr_descr,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              row_block_dim,
+              col_block_dim,
+              (const void*&)bsr_map);
+
+    //
+    // Check direction
+    //
+    if(direction != rocsparse_direction_row && direction != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    //
+    // Check sizes
+    //
+    if(m < 0 || n < 0 || row_block_dim < 0 || col_block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    //
+    // Quick return if possible, before checking pointer arguments.
+    //
+    if(m == 0 || n == 0 || row_block_dim == 0 || col_block_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    //
+    // Check pointer arguments
+    //
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || bsr_row_ptr == nullptr
+       || bsr_col_ind == nullptr || bsr_map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2GEBSR_MAP_DIM 256
+    hipLaunchKernelGGL((csr2gebsr_map_kernel<CSR2GEBSR_MAP_DIM>),
+                       dim3((m - 1) / CSR2GEBSR_MAP_DIM + 1),
+                       dim3(CSR2GEBSR_MAP_DIM),
+                       0,
+                       handle->stream,
+                       direction,
+                       m,
+                       csr_descr->base,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       bsr_descr->base,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       row_block_dim,
+                       col_block_dim,
+                       bsr_map);
+#undef CSR2GEBSR_MAP_DIM
+
+    return rocsparse_status_success;
+}
+
 //
 // C INTERFACE
 //
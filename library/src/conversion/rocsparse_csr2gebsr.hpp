@@ -31,6 +31,8 @@
 #include "csr2gebsr_device.h"
 #include "definitions.h"
 
+#include <rocprim/rocprim.hpp>
+
 #define launch_csr2gebsr_fast_kernel(T, direction, block_size, segment_size, wf_size)            \
     hipLaunchKernelGGL((csr2gebsr_fast_kernel<T, direction, block_size, segment_size, wf_size>), \
                        grid_size,                                                                \
@@ -143,8 +145,11 @@ rocsparse_status rocsparse_csr2gebsr_buffer_size_template(rocsparse_handle
         }
         else
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(p_buffer_size, &host_buffer_size, sizeof(size_t), hipMemcpyHostToDevice));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(p_buffer_size,
+                                               &host_buffer_size,
+                                               sizeof(size_t),
+                                               hipMemcpyHostToDevice,
+                                               handle->stream));
         }
         return rocsparse_status_success;
     }
@@ -158,15 +163,45 @@ rocsparse_status rocsparse_csr2gebsr_buffer_size_template(rocsparse_handle
     }
 
     {
+        rocsparse_int mb = (m + row_block_dim - 1) / row_block_dim;
+
         size_t host_buffer_size = 512 * sizeof(rocsparse_int);
+
+        // rocprim buffer for the scan of the BSR row pointers in rocsparse_csr2gebsr_nnz()
+        size_t rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                    rocprim_size,
+                                                    (rocsparse_int*)nullptr,
+                                                    (rocsparse_int*)nullptr,
+                                                    mb + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    handle->stream));
+
+        host_buffer_size = std::max(host_buffer_size, rocprim_size);
+
+        // Scratch pad of the kernels that handle large row block dimensions, with one
+        // segment of 32 threads per block row. The conversion requires three indices and
+        // one value per thread and row, which covers the two indices of the nnz kernel.
+        if(row_block_dim > 32)
+        {
+            size_t rows_per_segment = (row_block_dim + 32 - 1) / 32;
+            size_t scratch_size
+                = mb * 32 * rows_per_segment * (3 * sizeof(rocsparse_int) + sizeof(T));
+
+            host_buffer_size = std::max(host_buffer_size, scratch_size);
+        }
+
         if(mode == rocsparse_pointer_mode_host)
         {
             p_buffer_size[0] = host_buffer_size;
         }
         else
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpy(p_buffer_size, &host_buffer_size, sizeof(size_t), hipMemcpyHostToDevice));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(p_buffer_size,
+                                               &host_buffer_size,
+                                               sizeof(size_t),
+                                               hipMemcpyHostToDevice,
+                                               handle->stream));
         }
     }
 
@@ -266,19 +301,21 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
     rocsparse_int nb     = (n + col_block_dim - 1) / col_block_dim;
 
     //
-    // Stream
+    // Set bsr val to zero, using the block row pointers on the device.
     //
-    rocsparse_int hstart = 0;
-    rocsparse_int hend   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hend, &bsr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(&hstart, &bsr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+#define CSR2GEBSR_FILL_DIM 256
+    hipLaunchKernelGGL((csr2gebsr_fill_zero_kernel<T, CSR2GEBSR_FILL_DIM>),
+                       dim3(mb),
+                       dim3(CSR2GEBSR_FILL_DIM),
+                       0,
+                       stream,
+                       mb,
+                       row_block_dim,
+                       col_block_dim,
+                       bsr_row_ptr,
+                       bsr_val);
+#undef CSR2GEBSR_FILL_DIM
 
-    //
-    // Set bsr val to zero.
-    //
-    hipMemset(bsr_val, 0, (hend - hstart) * row_block_dim * col_block_dim * sizeof(T));
     if(row_block_dim == 1 && col_block_dim == 1)
     {
         constexpr rocsparse_int block_size = 256;
@@ -508,24 +545,8 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
             = (number_of_wf_segments_needed + segments_per_wf - 1) / segments_per_wf;
         rocsparse_int grid_size = (wf_size * number_of_wfs_needed + block_size - 1) / block_size;
 
-        size_t buffer_size
-            = grid_size * block_size
-              * (3 * rows_per_segment * sizeof(rocsparse_int) + rows_per_segment * sizeof(T));
-
-        bool  temp_alloc       = false;
-        void* temp_storage_ptr = nullptr;
-        if(handle->buffer_size >= buffer_size)
-        {
-            temp_storage_ptr = handle->buffer;
-            temp_alloc       = false;
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
-            temp_alloc = true;
-        }
-
-        char* temp = reinterpret_cast<char*>(temp_storage_ptr);
+        // Scratch pad of the kernel, accounted for by rocsparse_csr2gebsr_buffer_size()
+        char* temp = reinterpret_cast<char*>(p_buffer);
 
         rocsparse_int* temp1 = reinterpret_cast<rocsparse_int*>(temp);
         T*             temp2 = reinterpret_cast<T*>(
@@ -554,11 +575,6 @@ rocsparse_status rocsparse_csr2gebsr_template(rocsparse_handle          handle,
                            bsr_col_ind,
                            temp1,
                            temp2);
-
-        if(temp_alloc)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-        }
     }
 
     return rocsparse_status_success;
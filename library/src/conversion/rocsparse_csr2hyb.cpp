@@ -30,6 +30,434 @@
  * ===========================================================================
  */
 
+extern "C" rocsparse_status rocsparse_csr2hyb_buffer_size(rocsparse_handle     handle,
+                                                          rocsparse_int        m,
+                                                          rocsparse_int        n,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2hyb_buffer_size",
+              m,
+              n,
+              (const void*&)csr_row_ptr,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // rocprim buffer, shared with the ELL width reduction
+    size_t size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), handle->stream));
+    *buffer_size = std::max(size, sizeof(rocsparse_int) * ((m - 1) / 512 + 1));
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // COO row offsets
+    *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // ELL width and COO nnz
+    *buffer_size += 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2hyb_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  rocsparse_int             user_ell_width,
+                                                  rocsparse_hyb_partition   partition_type,
+                                                  rocsparse_int*            ell_width,
+                                                  rocsparse_int*            coo_nnz,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2hyb_nnz",
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              user_ell_width,
+              partition_type,
+              (const void*&)ell_width,
+              (const void*&)coo_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    // Check partition type
+    if(partition_type != rocsparse_hyb_partition_max
+       && partition_type != rocsparse_hyb_partition_user
+       && partition_type != rocsparse_hyb_partition_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // ELL width cannot be negative
+    if(partition_type == rocsparse_hyb_partition_user && user_ell_width < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output pointer arguments before setting
+    if(ell_width == nullptr || coo_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ell_width, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(coo_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ell_width = 0;
+            *coo_nnz   = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // COO row offsets, kept for the conversion
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // ELL width and COO nnz
+    rocsparse_int* d_sizes = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    // Temporary rocprim buffer
+    size_t size        = 0;
+    void*  tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+#define CSR2HYB_DIM 512
+    if(partition_type == rocsparse_hyb_partition_max)
+    {
+        rocsparse_int  blocks      = (m - 1) / CSR2HYB_DIM + 1;
+        rocsparse_int* row_nnz_max = reinterpret_cast<rocsparse_int*>(tmp_rocprim);
+
+        // Compute maximum nnz per row
+        hipLaunchKernelGGL((ell_width_kernel_part1<CSR2HYB_DIM>),
+                           dim3(blocks),
+                           dim3(CSR2HYB_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           row_nnz_max);
+
+        hipLaunchKernelGGL((ell_width_kernel_part2<CSR2HYB_DIM>),
+                           dim3(1),
+                           dim3(CSR2HYB_DIM),
+                           0,
+                           stream,
+                           blocks,
+                           row_nnz_max);
+    }
+
+    hipLaunchKernelGGL(csr2hyb_ell_width_kernel,
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       partition_type,
+                       user_ell_width,
+                       reinterpret_cast<const rocsparse_int*>(tmp_rocprim),
+                       d_sizes,
+                       descr->base);
+
+    if(partition_type == rocsparse_hyb_partition_max)
+    {
+        // HYB == ELL - no COO part
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_sizes + 1, 0, sizeof(rocsparse_int), stream));
+    }
+    else
+    {
+        // COO non-zero elements per row, using the ELL width from the device
+        hipLaunchKernelGGL((hyb_coo_nnz<CSR2HYB_DIM>),
+                           dim3((m - 1) / CSR2HYB_DIM + 1),
+                           dim3(CSR2HYB_DIM),
+                           0,
+                           stream,
+                           m,
+                           (const rocsparse_int*)d_sizes,
+                           csr_row_ptr,
+                           workspace,
+                           descr->base);
+
+        // Inclusive sum to obtain the COO row offsets
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                    size,
+                                                    workspace,
+                                                    workspace,
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+        RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(tmp_rocprim,
+                                                    size,
+                                                    workspace,
+                                                    workspace,
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+
+        hipLaunchKernelGGL(csr2hyb_coo_nnz_kernel,
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           workspace,
+                           d_sizes + 1,
+                           descr->base);
+    }
+#undef CSR2HYB_DIM
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ell_width, d_sizes, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            coo_nnz, d_sizes + 1, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        rocsparse_int h_sizes[2];
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            h_sizes, d_sizes, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        *ell_width = h_sizes[0];
+        *coo_nnz   = h_sizes[1];
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2hyb_map(rocsparse_handle          handle,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_hyb_mat   hyb,
+                                                  rocsparse_int*            hyb_map)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2hyb_map",
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)hyb,
+              (const void*&)hyb_map);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    rocsparse_int m = hyb->m;
+
+    // Quick return if possible
+    if(m == 0 || hyb->n == 0 || hyb->ell_nnz + hyb->coo_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb_map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR2HYB_DIM 512
+    // COO row offsets, without ELL part these are the CSR row offsets
+    const rocsparse_int* coo_row_ptr = nullptr;
+    rocsparse_int*       workspace   = nullptr;
+
+    if(hyb->coo_nnz > 0)
+    {
+        if(hyb->ell_nnz == 0)
+        {
+            coo_row_ptr = csr_row_ptr;
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
+
+            hipLaunchKernelGGL((hyb_coo_nnz<CSR2HYB_DIM>),
+                               dim3((m - 1) / CSR2HYB_DIM + 1),
+                               dim3(CSR2HYB_DIM),
+                               0,
+                               stream,
+                               m,
+                               hyb->ell_width,
+                               csr_row_ptr,
+                               workspace,
+                               descr->base);
+
+            // Inclusive sum on workspace
+            void*  d_temp_storage     = nullptr;
+            size_t temp_storage_bytes = 0;
+
+            // Obtain rocprim buffer size
+            RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                        temp_storage_bytes,
+                                                        workspace,
+                                                        workspace,
+                                                        m + 1,
+                                                        rocprim::plus<rocsparse_int>(),
+                                                        stream));
+
+            // Allocate rocprim buffer
+            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+
+            // Do inclusive sum
+            RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                        temp_storage_bytes,
+                                                        workspace,
+                                                        workspace,
+                                                        m + 1,
+                                                        rocprim::plus<rocsparse_int>(),
+                                                        stream));
+
+            // Clear rocprim buffer
+            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+
+            coo_row_ptr = workspace;
+        }
+    }
+
+    hipLaunchKernelGGL((csr2hyb_map_kernel<CSR2HYB_DIM>),
+                       dim3((m - 1) / CSR2HYB_DIM + 1),
+                       dim3(CSR2HYB_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       hyb->ell_width,
+                       hyb->ell_nnz,
+                       coo_row_ptr,
+                       hyb_map,
+                       descr->base);
+#undef CSR2HYB_DIM
+
+    if(workspace != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(workspace));
+    }
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             n,
@@ -121,3 +549,187 @@ extern "C" rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                h
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status rocsparse_scsr2hyb_ex(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_hyb_mat         hyb,
+                                                  rocsparse_hyb_partition   partition_type,
+                                                  rocsparse_int             ell_width,
+                                                  rocsparse_int             coo_nnz,
+                                                  rocsparse_int*            ell_col_ind,
+                                                  float*                    ell_val,
+                                                  rocsparse_int*            coo_row_ind,
+                                                  rocsparse_int*            coo_col_ind,
+                                                  float*                    coo_val,
+                                                  void*                     temp_buffer)
+{
+    return rocsparse_csr2hyb_ex_template(handle,
+                                         m,
+                                         n,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         hyb,
+                                         partition_type,
+                                         ell_width,
+                                         coo_nnz,
+                                         ell_col_ind,
+                                         ell_val,
+                                         coo_row_ind,
+                                         coo_col_ind,
+                                         coo_val,
+                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2hyb_ex(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_hyb_mat         hyb,
+                                                  rocsparse_hyb_partition   partition_type,
+                                                  rocsparse_int             ell_width,
+                                                  rocsparse_int             coo_nnz,
+                                                  rocsparse_int*            ell_col_ind,
+                                                  double*                   ell_val,
+                                                  rocsparse_int*            coo_row_ind,
+                                                  rocsparse_int*            coo_col_ind,
+                                                  double*                   coo_val,
+                                                  void*                     temp_buffer)
+{
+    return rocsparse_csr2hyb_ex_template(handle,
+                                         m,
+                                         n,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         hyb,
+                                         partition_type,
+                                         ell_width,
+                                         coo_nnz,
+                                         ell_col_ind,
+                                         ell_val,
+                                         coo_row_ind,
+                                         coo_col_ind,
+                                         coo_val,
+                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2hyb_ex(rocsparse_handle               handle,
+                                                  rocsparse_int                  m,
+                                                  rocsparse_int                  n,
+                                                  const rocsparse_mat_descr      descr,
+                                                  const rocsparse_float_complex* csr_val,
+                                                  const rocsparse_int*           csr_row_ptr,
+                                                  const rocsparse_int*           csr_col_ind,
+                                                  rocsparse_hyb_mat              hyb,
+                                                  rocsparse_hyb_partition        partition_type,
+                                                  rocsparse_int                  ell_width,
+                                                  rocsparse_int                  coo_nnz,
+                                                  rocsparse_int*                 ell_col_ind,
+                                                  rocsparse_float_complex*       ell_val,
+                                                  rocsparse_int*                 coo_row_ind,
+                                                  rocsparse_int*                 coo_col_ind,
+                                                  rocsparse_float_complex*       coo_val,
+                                                  void*                          temp_buffer)
+{
+    return rocsparse_csr2hyb_ex_template(handle,
+                                         m,
+                                         n,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         hyb,
+                                         partition_type,
+                                         ell_width,
+                                         coo_nnz,
+                                         ell_col_ind,
+                                         ell_val,
+                                         coo_row_ind,
+                                         coo_col_ind,
+                                         coo_val,
+                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2hyb_ex(rocsparse_handle                handle,
+                                                  rocsparse_int                   m,
+                                                  rocsparse_int                   n,
+                                                  const rocsparse_mat_descr       descr,
+                                                  const rocsparse_double_complex* csr_val,
+                                                  const rocsparse_int*            csr_row_ptr,
+                                                  const rocsparse_int*            csr_col_ind,
+                                                  rocsparse_hyb_mat               hyb,
+                                                  rocsparse_hyb_partition         partition_type,
+                                                  rocsparse_int                   ell_width,
+                                                  rocsparse_int                   coo_nnz,
+                                                  rocsparse_int*                  ell_col_ind,
+                                                  rocsparse_double_complex*       ell_val,
+                                                  rocsparse_int*                  coo_row_ind,
+                                                  rocsparse_int*                  coo_col_ind,
+                                                  rocsparse_double_complex*       coo_val,
+                                                  void*                           temp_buffer)
+{
+    return rocsparse_csr2hyb_ex_template(handle,
+                                         m,
+                                         n,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         hyb,
+                                         partition_type,
+                                         ell_width,
+                                         coo_nnz,
+                                         ell_col_ind,
+                                         ell_val,
+                                         coo_row_ind,
+                                         coo_col_ind,
+                                         coo_val,
+                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsr2hyb_values(rocsparse_handle     handle,
+                                                      rocsparse_int        nnz,
+                                                      const float*         csr_val,
+                                                      const rocsparse_int* hyb_map,
+                                                      rocsparse_hyb_mat    hyb)
+{
+    return rocsparse_csr2hyb_values_template(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2hyb_values(rocsparse_handle     handle,
+                                                      rocsparse_int        nnz,
+                                                      const double*        csr_val,
+                                                      const rocsparse_int* hyb_map,
+                                                      rocsparse_hyb_mat    hyb)
+{
+    return rocsparse_csr2hyb_values_template(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2hyb_values(rocsparse_handle               handle,
+                                                      rocsparse_int                  nnz,
+                                                      const rocsparse_float_complex* csr_val,
+                                                      const rocsparse_int*           hyb_map,
+                                                      rocsparse_hyb_mat              hyb)
+{
+    return rocsparse_csr2hyb_values_template(handle, nnz, csr_val, hyb_map, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2hyb_values(rocsparse_handle                handle,
+                                                      rocsparse_int                   nnz,
+                                                      const rocsparse_double_complex* csr_val,
+                                                      const rocsparse_int*            hyb_map,
+                                                      rocsparse_hyb_mat               hyb)
+{
+    return rocsparse_csr2hyb_values_template(handle, nnz, csr_val, hyb_map, hyb);
+}
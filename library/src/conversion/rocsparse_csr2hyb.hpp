@@ -33,6 +33,43 @@
 #include "definitions.h"
 #include <rocprim/rocprim.hpp>
 
+// Release the ELL and COO arrays of a HYB matrix, unless they are owned by the user
+static inline rocsparse_status rocsparse_csr2hyb_release(rocsparse_hyb_mat hyb)
+{
+    if(!hyb->user_storage)
+    {
+        if(hyb->ell_col_ind)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
+        }
+        if(hyb->ell_val)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
+        }
+        if(hyb->coo_row_ind)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
+        }
+        if(hyb->coo_col_ind)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
+        }
+        if(hyb->coo_val)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+        }
+    }
+
+    hyb->ell_col_ind  = nullptr;
+    hyb->ell_val      = nullptr;
+    hyb->coo_row_ind  = nullptr;
+    hyb->coo_col_ind  = nullptr;
+    hyb->coo_val      = nullptr;
+    hyb->user_storage = false;
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                                             rocsparse_int             m,
@@ -163,26 +200,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     hyb->ell_width = 0;
     hyb->coo_nnz   = 0;
 
-    if(hyb->ell_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-    }
-    if(hyb->ell_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-    }
-    if(hyb->coo_row_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-    }
-    if(hyb->coo_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-    }
-    if(hyb->coo_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
-    }
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_release(hyb));
 
     // Determine ELL width
 
@@ -359,4 +377,234 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_ex_template(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_hyb_mat         hyb,
+                                               rocsparse_hyb_partition   partition_type,
+                                               rocsparse_int             ell_width,
+                                               rocsparse_int             coo_nnz,
+                                               rocsparse_int*            ell_col_ind,
+                                               T*                        ell_val,
+                                               rocsparse_int*            coo_row_ind,
+                                               rocsparse_int*            coo_col_ind,
+                                               T*                        coo_val,
+                                               void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_ex"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)hyb,
+              partition_type,
+              ell_width,
+              coo_nnz,
+              (const void*&)ell_col_ind,
+              (const void*&)ell_val,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)coo_val,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    // Check partition type
+    if(partition_type != rocsparse_hyb_partition_max
+       && partition_type != rocsparse_hyb_partition_user
+       && partition_type != rocsparse_hyb_partition_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || ell_width < 0 || coo_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // A maximum partitioning has no COO part
+    if(partition_type == rocsparse_hyb_partition_max && coo_nnz > 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_width > 0 && (ell_col_ind == nullptr || ell_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_nnz > 0
+            && (coo_row_ind == nullptr || coo_col_ind == nullptr || coo_val == nullptr
+                || temp_buffer == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Release the storage of a previous rocsparse_Xcsr2hyb() call on the same
+    // HYB matrix. This is the only case where the host waits for the device.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_release(hyb));
+
+    hyb->m            = m;
+    hyb->n            = n;
+    hyb->partition    = partition_type;
+    hyb->ell_width    = ell_width;
+    hyb->ell_nnz      = ell_width * m;
+    hyb->coo_nnz      = coo_nnz;
+    hyb->user_storage = true;
+
+    if(hyb->ell_nnz > 0)
+    {
+        hyb->ell_col_ind = ell_col_ind;
+        hyb->ell_val     = ell_val;
+    }
+
+    if(coo_nnz > 0)
+    {
+        hyb->coo_row_ind = coo_row_ind;
+        hyb->coo_col_ind = coo_col_ind;
+        hyb->coo_val     = coo_val;
+    }
+
+    // COO row offsets have been computed by rocsparse_csr2hyb_nnz() and are
+    // located at the beginning of the temporary storage buffer
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(temp_buffer);
+
+#define CSR2HYB_DIM 512
+    hipLaunchKernelGGL((csr2hyb_kernel<T, CSR2HYB_DIM>),
+                       dim3((m - 1) / CSR2HYB_DIM + 1),
+                       dim3(CSR2HYB_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       hyb->ell_width,
+                       hyb->ell_col_ind,
+                       (T*)hyb->ell_val,
+                       hyb->coo_row_ind,
+                       hyb->coo_col_ind,
+                       (T*)hyb->coo_val,
+                       workspace,
+                       descr->base);
+#undef CSR2HYB_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_values_template(rocsparse_handle     handle,
+                                                   rocsparse_int        nnz,
+                                                   const T*             csr_val,
+                                                   const rocsparse_int* hyb_map,
+                                                   rocsparse_hyb_mat    hyb)
+{
+    // Check for valid handle and matrix
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_values"),
+              nnz,
+              (const void*&)csr_val,
+              (const void*&)hyb_map,
+              (const void*&)hyb);
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb_map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2HYB_DIM 512
+    hipLaunchKernelGGL((csr2hyb_values_kernel<T, CSR2HYB_DIM>),
+                       dim3((nnz - 1) / CSR2HYB_DIM + 1),
+                       dim3(CSR2HYB_DIM),
+                       0,
+                       handle->stream,
+                       nnz,
+                       csr_val,
+                       hyb_map,
+                       hyb->ell_nnz,
+                       (T*)hyb->ell_val,
+                       (T*)hyb->coo_val);
+#undef CSR2HYB_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSR2HYB_HPP
@@ -0,0 +1,402 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csr2sellc.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2sellc_buffer_size(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            rocsparse_int        n,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            rocsparse_int        sell_slice_size,
+                                                            rocsparse_int        sell_sigma,
+                                                            size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2sellc_buffer_size",
+              m,
+              n,
+              (const void*&)csr_row_ptr,
+              sell_slice_size,
+              sell_sigma,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || n < 0 || sell_slice_size <= 0 || sell_sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int nslices  = (m - 1) / sell_slice_size + 1;
+    rocsparse_int nwindows = (m - 1) / std::min(sell_sigma, m) + 1;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine rocprim buffer size
+    size_t size;
+    *buffer_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(
+        nullptr, size, ptr, ptr, ptr, ptr, m, nwindows, ptr, ptr + 1, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, nslices + 1, rocprim::plus<rocsparse_int>(), stream));
+    *buffer_size = std::max(size, *buffer_size);
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // Row non-zeros, sorted row non-zeros and identity permutation
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 3;
+
+    // Window offsets
+    *buffer_size += sizeof(rocsparse_int) * (nwindows / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2sellc_nnz(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_mat_descr sell_descr,
+                                                    rocsparse_int             sell_slice_size,
+                                                    rocsparse_int             sell_sigma,
+                                                    rocsparse_int*            sell_slice_ptr,
+                                                    rocsparse_int*            sell_perm,
+                                                    rocsparse_int*            sell_nnz,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2sellc_nnz",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              sell_sigma,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_perm,
+              (const void*&)sell_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || sell_slice_size <= 0 || sell_sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sell_nnz pointer argument before setting
+    if(sell_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(sell_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *sell_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Sorting windows larger than the matrix sort all rows
+    rocsparse_int sigma = std::min(sell_sigma, m);
+
+    rocsparse_int nslices  = (m - 1) / sell_slice_size + 1;
+    rocsparse_int nwindows = (m - 1) / sigma + 1;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    rocsparse_int* row_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* row_nnz_sorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* identity = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* offsets = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (nwindows / 256 + 1) * 256;
+
+    // Temporary rocprim buffer
+    size_t size        = 0;
+    void*  tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+#define CSR2SELLC_DIM 256
+    // Compute non-zero entries per row
+    hipLaunchKernelGGL((csr2sellc_row_nnz_kernel<CSR2SELLC_DIM>),
+                       dim3((m - 1) / CSR2SELLC_DIM + 1),
+                       dim3(CSR2SELLC_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       row_nnz,
+                       (sigma > 1) ? identity : sell_perm);
+
+    // Sort the rows of each window by their number of non-zero entries in
+    // descending order. The sort is stable, such that rows of equal length
+    // keep their original order.
+    if(sigma > 1)
+    {
+        hipLaunchKernelGGL((csr2sellc_window_offsets_kernel<CSR2SELLC_DIM>),
+                           dim3(nwindows / CSR2SELLC_DIM + 1),
+                           dim3(CSR2SELLC_DIM),
+                           0,
+                           stream,
+                           m,
+                           nwindows,
+                           sigma,
+                           offsets);
+
+        unsigned int startbit = 0;
+        unsigned int endbit   = rocsparse_clz(n);
+
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(nullptr,
+                                                                     size,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     identity,
+                                                                     sell_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     offsets,
+                                                                     offsets + 1,
+                                                                     startbit,
+                                                                     endbit,
+                                                                     stream));
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(tmp_rocprim,
+                                                                     size,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     identity,
+                                                                     sell_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     offsets,
+                                                                     offsets + 1,
+                                                                     startbit,
+                                                                     endbit,
+                                                                     stream));
+    }
+
+    // Compute padded non-zero entries per slice
+    hipLaunchKernelGGL((csr2sellc_slice_nnz_kernel<CSR2SELLC_DIM>),
+                       dim3((nslices - 1) / CSR2SELLC_DIM + 1),
+                       dim3(CSR2SELLC_DIM),
+                       0,
+                       stream,
+                       m,
+                       nslices,
+                       sell_slice_size,
+                       csr_row_ptr,
+                       sell_perm,
+                       sell_slice_ptr,
+                       sell_descr->base);
+
+    // Inclusive sum to obtain sell_slice_ptr array and number of padded entries
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(tmp_rocprim,
+                                                size,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(sell_nnz,
+                                           sell_slice_ptr + nslices,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz according to index base
+        if(sell_descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csr2sellc_index_base<1>), dim3(1), dim3(1), 0, stream, sell_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            sell_nnz, sell_slice_ptr + nslices, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *sell_nnz -= sell_descr->base;
+    }
+#undef CSR2SELLC_DIM
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_int             m,               \
+                                     rocsparse_int             n,               \
+                                     const rocsparse_mat_descr csr_descr,       \
+                                     const TYPE*               csr_val,         \
+                                     const rocsparse_int*      csr_row_ptr,     \
+                                     const rocsparse_int*      csr_col_ind,     \
+                                     const rocsparse_mat_descr sell_descr,      \
+                                     rocsparse_int             sell_slice_size, \
+                                     const rocsparse_int*      sell_slice_ptr,  \
+                                     const rocsparse_int*      sell_perm,       \
+                                     TYPE*                     sell_val,        \
+                                     rocsparse_int*            sell_col_ind)    \
+    {                                                                           \
+        return rocsparse_csr2sellc_template(handle,                             \
+                                            m,                                  \
+                                            n,                                  \
+                                            csr_descr,                          \
+                                            csr_val,                            \
+                                            csr_row_ptr,                        \
+                                            csr_col_ind,                        \
+                                            sell_descr,                         \
+                                            sell_slice_size,                    \
+                                            sell_slice_ptr,                     \
+                                            sell_perm,                          \
+                                            sell_val,                           \
+                                            sell_col_ind);                      \
+    }
+
+C_IMPL(rocsparse_scsr2sellc, float);
+C_IMPL(rocsparse_dcsr2sellc, double);
+C_IMPL(rocsparse_ccsr2sellc, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsr2sellc, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,180 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSR2SELLC_HPP
+#define ROCSPARSE_CSR2SELLC_HPP
+#include "utility.h"
+
+#include "csr2sellc_device.h"
+#include "definitions.h"
+
+template <typename T>
+rocsparse_status rocsparse_csr2sellc_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              const rocsparse_mat_descr csr_descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const rocsparse_mat_descr sell_descr,
+                                              rocsparse_int             sell_slice_size,
+                                              const rocsparse_int*      sell_slice_ptr,
+                                              const rocsparse_int*      sell_perm,
+                                              T*                        sell_val,
+                                              rocsparse_int*            sell_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sellc"),
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_perm,
+              (const void*&)sell_val,
+              (const void*&)sell_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2sellc -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> --slice-size",
+              sell_slice_size);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || sell_slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of slices
+    rocsparse_int nslices = (m - 1) / sell_slice_size + 1;
+
+#define CSR2SELLC_DIM 512
+    dim3 csr2sellc_blocks((nslices * sell_slice_size - 1) / CSR2SELLC_DIM + 1);
+    dim3 csr2sellc_threads(CSR2SELLC_DIM);
+
+    hipLaunchKernelGGL((csr2sellc_kernel<T, CSR2SELLC_DIM>),
+                       csr2sellc_blocks,
+                       csr2sellc_threads,
+                       0,
+                       stream,
+                       m,
+                       nslices,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       sell_slice_size,
+                       sell_slice_ptr,
+                       sell_perm,
+                       sell_val,
+                       sell_col_ind,
+                       sell_descr->base);
+#undef CSR2SELLC_DIM
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2SELLC_HPP
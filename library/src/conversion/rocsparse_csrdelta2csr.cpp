@@ -0,0 +1,141 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+
+#include "csr2csrdelta_device.h"
+#include "definitions.h"
+
+extern "C" rocsparse_status rocsparse_csrdelta2csr(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   rocsparse_int             block_dim,
+                                                   const rocsparse_int*      csrdelta_block_ptr,
+                                                   const rocsparse_int*      csrdelta_width,
+                                                   const rocsparse_int*      csrdelta_row_col,
+                                                   const rocsparse_int*      csrdelta_col_ind,
+                                                   rocsparse_int*            csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrdelta2csr",
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              block_dim,
+              (const void*&)csrdelta_block_ptr,
+              (const void*&)csrdelta_width,
+              (const void*&)csrdelta_row_col,
+              (const void*&)csrdelta_col_ind,
+              (const void*&)csr_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrdelta2csr",
+              "--mtx <matrix.mtx>",
+              "--blockdim",
+              block_dim);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_block_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_row_col == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdelta_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSRDELTA2CSR_DIM 256
+    hipLaunchKernelGGL((csrdelta2csr_kernel<CSRDELTA2CSR_DIM>),
+                       dim3((m - 1) / CSRDELTA2CSR_DIM + 1),
+                       dim3(CSRDELTA2CSR_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       block_dim,
+                       csr_row_ptr,
+                       csrdelta_block_ptr,
+                       csrdelta_width,
+                       csrdelta_row_col,
+                       csrdelta_col_ind,
+                       csr_col_ind,
+                       descr->base);
+#undef CSRDELTA2CSR_DIM
+
+    return rocsparse_status_success;
+}
@@ -105,7 +105,9 @@ extern "C" rocsparse_status rocsparse_csrsort_buffer_size(rocsparse_handle     h
     *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
     // perm buffer
     *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
-    // segm buffer
+    // segm begin buffer
+    *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+    // segm end buffer
     *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
 
     return rocsparse_status_success;
@@ -223,35 +225,39 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
     rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
     ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
 
-    // segm buffer
-    rocsparse_int* tmp_segm = reinterpret_cast<rocsparse_int*>(ptr);
-    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // segm begin buffer
+    rocsparse_int* tmp_segm_begin = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
 
-    // Index base one requires shift of offset positions
-    if(descr->base == rocsparse_index_base_one)
-    {
-#define CSRSORT_DIM 512
-        dim3 csrsort_blocks(m / CSRSORT_DIM + 1);
-        dim3 csrsort_threads(CSRSORT_DIM);
-
-        hipLaunchKernelGGL((csrsort_shift_kernel<CSRSORT_DIM>),
-                           csrsort_blocks,
-                           csrsort_threads,
-                           0,
-                           stream,
-                           m + 1,
-                           csr_row_ptr,
-                           tmp_segm);
-#undef CSRSORT_DIM
-    }
+    // segm end buffer
+    rocsparse_int* tmp_segm_end = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
 
     // rocprim buffer
     void* tmp_rocprim = reinterpret_cast<void*>(ptr);
 
-    // Switch between offsets
-    const rocsparse_int* offsets = descr->base == rocsparse_index_base_one ? tmp_segm : csr_row_ptr;
-
-    // Sort by columns and obtain permutation vector
+    // Sort short rows in registers and determine the segments of the remaining unsorted
+    // rows. Rows that are sorted already, e.g. when sorting the same matrix repeatedly, are
+    // skipped on the device, such that no host synchronization is required.
+#define CSRSORT_DIM 256
+#define CSRSORT_SEGMENT_SIZE 32
+    dim3 csrsort_blocks((m - 1) / (CSRSORT_DIM / CSRSORT_SEGMENT_SIZE) + 1);
+    dim3 csrsort_threads(CSRSORT_DIM);
+
+    hipLaunchKernelGGL((csrsort_segment_kernel<CSRSORT_DIM, CSRSORT_SEGMENT_SIZE>),
+                       csrsort_blocks,
+                       csrsort_threads,
+                       0,
+                       stream,
+                       m,
+                       descr->base,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       perm,
+                       tmp_segm_begin,
+                       tmp_segm_end);
+
+    // Sort the remaining rows by columns and obtain permutation vector
 
     if(perm != nullptr)
     {
@@ -272,8 +278,8 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
                                                                             vals,
                                                                             nnz,
                                                                             m,
-                                                                            offsets,
-                                                                            offsets + 1,
+                                                                            tmp_segm_begin,
+                                                                            tmp_segm_end,
                                                                             startbit,
                                                                             endbit,
                                                                             stream));
@@ -288,8 +294,8 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
                                                                             vals,
                                                                             nnz,
                                                                             m,
-                                                                            offsets,
-                                                                            offsets + 1,
+                                                                            tmp_segm_begin,
+                                                                            tmp_segm_end,
                                                                             startbit,
                                                                             endbit,
                                                                             stream));
@@ -304,8 +310,8 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
                                                                             vals,
                                                                             nnz,
                                                                             m,
-                                                                            offsets,
-                                                                            offsets + 1,
+                                                                            tmp_segm_begin,
+                                                                            tmp_segm_end,
                                                                             startbit,
                                                                             endbit,
                                                                             stream));
@@ -318,27 +324,37 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
                                                                     vals,
                                                                     nnz,
                                                                     m,
-                                                                    offsets,
-                                                                    offsets + 1,
+                                                                    tmp_segm_begin,
+                                                                    tmp_segm_end,
                                                                     startbit,
                                                                     endbit,
                                                                     stream));
         }
         if(keys.current() != csr_col_ind)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind,
-                                               keys.current(),
-                                               sizeof(rocsparse_int) * nnz,
-                                               hipMemcpyDeviceToDevice,
-                                               stream));
+            hipLaunchKernelGGL((csrsort_copy_kernel<CSRSORT_DIM, CSRSORT_SEGMENT_SIZE>),
+                               csrsort_blocks,
+                               csrsort_threads,
+                               0,
+                               stream,
+                               m,
+                               tmp_segm_begin,
+                               tmp_segm_end,
+                               keys.current(),
+                               csr_col_ind);
         }
         if(vals.current() != perm)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(perm,
-                                               vals.current(),
-                                               sizeof(rocsparse_int) * nnz,
-                                               hipMemcpyDeviceToDevice,
-                                               stream));
+            hipLaunchKernelGGL((csrsort_copy_kernel<CSRSORT_DIM, CSRSORT_SEGMENT_SIZE>),
+                               csrsort_blocks,
+                               csrsort_threads,
+                               0,
+                               stream,
+                               m,
+                               tmp_segm_begin,
+                               tmp_segm_end,
+                               vals.current(),
+                               perm);
         }
     }
     else
@@ -353,36 +369,76 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
         {
             using config
                 = rocprim::segmented_radix_sort_config<6, 5, rocprim::kernel_config<64, 1>>;
-            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(
-                tmp_rocprim, size, keys, nnz, m, offsets, offsets + 1, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(tmp_rocprim,
+                                                                           size,
+                                                                           keys,
+                                                                           nnz,
+                                                                           m,
+                                                                           tmp_segm_begin,
+                                                                           tmp_segm_end,
+                                                                           startbit,
+                                                                           endbit,
+                                                                           stream));
         }
         else if(avg_row_nnz < 128)
         {
             using config
                 = rocprim::segmented_radix_sort_config<6, 5, rocprim::kernel_config<64, 2>>;
-            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(
-                tmp_rocprim, size, keys, nnz, m, offsets, offsets + 1, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(tmp_rocprim,
+                                                                           size,
+                                                                           keys,
+                                                                           nnz,
+                                                                           m,
+                                                                           tmp_segm_begin,
+                                                                           tmp_segm_end,
+                                                                           startbit,
+                                                                           endbit,
+                                                                           stream));
         }
         else if(avg_row_nnz < 256)
         {
             using config
                 = rocprim::segmented_radix_sort_config<6, 5, rocprim::kernel_config<64, 4>>;
-            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(
-                tmp_rocprim, size, keys, nnz, m, offsets, offsets + 1, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys<config>(tmp_rocprim,
+                                                                           size,
+                                                                           keys,
+                                                                           nnz,
+                                                                           m,
+                                                                           tmp_segm_begin,
+                                                                           tmp_segm_end,
+                                                                           startbit,
+                                                                           endbit,
+                                                                           stream));
         }
         else
         {
-            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(
-                tmp_rocprim, size, keys, nnz, m, offsets, offsets + 1, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(tmp_rocprim,
+                                                                   size,
+                                                                   keys,
+                                                                   nnz,
+                                                                   m,
+                                                                   tmp_segm_begin,
+                                                                   tmp_segm_end,
+                                                                   startbit,
+                                                                   endbit,
+                                                                   stream));
         }
         if(keys.current() != csr_col_ind)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind,
-                                               keys.current(),
-                                               sizeof(rocsparse_int) * nnz,
-                                               hipMemcpyDeviceToDevice,
-                                               stream));
+            hipLaunchKernelGGL((csrsort_copy_kernel<CSRSORT_DIM, CSRSORT_SEGMENT_SIZE>),
+                               csrsort_blocks,
+                               csrsort_threads,
+                               0,
+                               stream,
+                               m,
+                               tmp_segm_begin,
+                               tmp_segm_end,
+                               keys.current(),
+                               csr_col_ind);
         }
     }
+#undef CSRSORT_SEGMENT_SIZE
+#undef CSRSORT_DIM
+
     return rocsparse_status_success;
 }
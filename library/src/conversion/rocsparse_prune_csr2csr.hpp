@@ -548,9 +548,13 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
     }
 
     // Compute csr_row_ptr_C with the right index base.
-    rocsparse_int first_value = csr_descr_C->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr_C, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+    hipLaunchKernelGGL((set_row_ptr_base_kernel<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle->stream,
+                       csr_descr_C->base,
+                       csr_row_ptr_C);
 
     // Perform inclusive scan on csr row pointer array
     auto   op = rocprim::plus<rocsparse_int>();
@@ -593,10 +597,14 @@ rocsparse_status rocsparse_prune_csr2csr_nnz_template(rocsparse_handle
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_total_dev_host_ptr,
-                                      &csr_row_ptr_C[m],
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_total_dev_host_ptr,
+                                           &csr_row_ptr_C[m],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         *nnz_total_dev_host_ptr -= csr_descr_C->base;
     }
@@ -29,27 +29,10 @@
 #include "csr2csr_compress_device.h"
 #include "definitions.h"
 #include "nnz_compress_device.h"
-#include "prune_csr2csr_by_percentage_device.h"
+#include "rocsparse_radix_select.hpp"
 #include "utility.h"
 #include <rocprim/rocprim.hpp>
 
-template <typename T,
-          rocsparse_int BLOCK_SIZE,
-          rocsparse_int SEGMENTS_PER_BLOCK,
-          rocsparse_int SEGMENT_SIZE,
-          rocsparse_int WF_SIZE>
-__launch_bounds__(BLOCK_SIZE) __global__
-    void nnz_compress_kernel_host_pointer(rocsparse_int        m,
-                                          rocsparse_index_base idx_base_A,
-                                          const T* __restrict__ csr_val_A,
-                                          const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                          rocsparse_int* __restrict__ nnz_per_row,
-                                          T threshold)
-{
-    nnz_compress_kernel<T, BLOCK_SIZE, SEGMENTS_PER_BLOCK, SEGMENT_SIZE, WF_SIZE>(
-        m, idx_base_A, csr_val_A, csr_row_ptr_A, nnz_per_row, threshold);
-}
-
 template <typename T,
           rocsparse_int BLOCK_SIZE,
           rocsparse_int SEGMENTS_PER_BLOCK,
@@ -67,39 +50,6 @@ __launch_bounds__(BLOCK_SIZE) __global__
         m, idx_base_A, csr_val_A, csr_row_ptr_A, nnz_per_row, *threshold);
 }
 
-template <typename T,
-          rocsparse_int BLOCK_SIZE,
-          rocsparse_int SEGMENTS_PER_BLOCK,
-          rocsparse_int SEGMENT_SIZE,
-          rocsparse_int WF_SIZE>
-__launch_bounds__(BLOCK_SIZE) __global__
-    void csr2csr_compress_kernel_host_pointer(rocsparse_int        m,
-                                              rocsparse_int        n,
-                                              rocsparse_index_base idx_base_A,
-                                              const T* __restrict__ csr_val_A,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                              const rocsparse_int* __restrict__ csr_col_ind_A,
-                                              rocsparse_int        nnz_A,
-                                              rocsparse_index_base idx_base_C,
-                                              T* __restrict__ csr_val_C,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_C,
-                                              rocsparse_int* __restrict__ csr_col_ind_C,
-                                              T threshold)
-{
-    csr2csr_compress_kernel<T, BLOCK_SIZE, SEGMENTS_PER_BLOCK, SEGMENT_SIZE, WF_SIZE>(m,
-                                                                                      n,
-                                                                                      idx_base_A,
-                                                                                      csr_val_A,
-                                                                                      csr_row_ptr_A,
-                                                                                      csr_col_ind_A,
-                                                                                      nnz_A,
-                                                                                      idx_base_C,
-                                                                                      csr_val_C,
-                                                                                      csr_row_ptr_C,
-                                                                                      csr_col_ind_C,
-                                                                                      threshold);
-}
-
 template <typename T,
           rocsparse_int BLOCK_SIZE,
           rocsparse_int SEGMENTS_PER_BLOCK,
@@ -145,42 +95,21 @@ void nnz_compress(rocsparse_handle     handle,
     constexpr rocsparse_int SEGMENTS_PER_BLOCK = BLOCK_SIZE / SEGMENT_SIZE;
     rocsparse_int           grid_size          = (m + SEGMENTS_PER_BLOCK - 1) / SEGMENTS_PER_BLOCK;
 
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        hipLaunchKernelGGL((nnz_compress_kernel_device_pointer<T,
-                                                               BLOCK_SIZE,
-                                                               SEGMENTS_PER_BLOCK,
-                                                               SEGMENT_SIZE,
-                                                               WF_SIZE>),
-                           dim3(grid_size),
-                           dim3(BLOCK_SIZE),
-                           0,
-                           handle->stream,
-                           m,
-                           idx_base_A,
-                           csr_val_A,
-                           csr_row_ptr_A,
-                           nnz_per_row,
-                           threshold);
-    }
-    else
-    {
-        hipLaunchKernelGGL((nnz_compress_kernel_host_pointer<T,
-                                                             BLOCK_SIZE,
-                                                             SEGMENTS_PER_BLOCK,
-                                                             SEGMENT_SIZE,
-                                                             WF_SIZE>),
-                           dim3(grid_size),
-                           dim3(BLOCK_SIZE),
-                           0,
-                           handle->stream,
-                           m,
-                           idx_base_A,
-                           csr_val_A,
-                           csr_row_ptr_A,
-                           nnz_per_row,
-                           *threshold);
-    }
+    hipLaunchKernelGGL((nnz_compress_kernel_device_pointer<T,
+                                                           BLOCK_SIZE,
+                                                           SEGMENTS_PER_BLOCK,
+                                                           SEGMENT_SIZE,
+                                                           WF_SIZE>),
+                       dim3(grid_size),
+                       dim3(BLOCK_SIZE),
+                       0,
+                       handle->stream,
+                       m,
+                       idx_base_A,
+                       csr_val_A,
+                       csr_row_ptr_A,
+                       nnz_per_row,
+                       threshold);
 }
 
 template <typename T, rocsparse_int BLOCK_SIZE, rocsparse_int SEGMENT_SIZE, rocsparse_int WF_SIZE>
@@ -201,54 +130,27 @@ void csr2csr_compress(rocsparse_handle     handle,
     constexpr rocsparse_int SEGMENTS_PER_BLOCK = BLOCK_SIZE / SEGMENT_SIZE;
     rocsparse_int           grid_size          = (m + SEGMENTS_PER_BLOCK - 1) / SEGMENTS_PER_BLOCK;
 
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        hipLaunchKernelGGL((csr2csr_compress_kernel_device_pointer<T,
-                                                                   BLOCK_SIZE,
-                                                                   SEGMENTS_PER_BLOCK,
-                                                                   SEGMENT_SIZE,
-                                                                   WF_SIZE>),
-                           dim3(grid_size),
-                           dim3(BLOCK_SIZE),
-                           0,
-                           handle->stream,
-                           m,
-                           n,
-                           idx_base_A,
-                           csr_val_A,
-                           csr_row_ptr_A,
-                           csr_col_ind_A,
-                           nnz_A,
-                           idx_base_C,
-                           csr_val_C,
-                           csr_row_ptr_C,
-                           csr_col_ind_C,
-                           threshold);
-    }
-    else
-    {
-        hipLaunchKernelGGL((csr2csr_compress_kernel_host_pointer<T,
-                                                                 BLOCK_SIZE,
-                                                                 SEGMENTS_PER_BLOCK,
-                                                                 SEGMENT_SIZE,
-                                                                 WF_SIZE>),
-                           dim3(grid_size),
-                           dim3(BLOCK_SIZE),
-                           0,
-                           handle->stream,
-                           m,
-                           n,
-                           idx_base_A,
-                           csr_val_A,
-                           csr_row_ptr_A,
-                           csr_col_ind_A,
-                           nnz_A,
-                           idx_base_C,
-                           csr_val_C,
-                           csr_row_ptr_C,
-                           csr_col_ind_C,
-                           *threshold);
-    }
+    hipLaunchKernelGGL((csr2csr_compress_kernel_device_pointer<T,
+                                                               BLOCK_SIZE,
+                                                               SEGMENTS_PER_BLOCK,
+                                                               SEGMENT_SIZE,
+                                                               WF_SIZE>),
+                       dim3(grid_size),
+                       dim3(BLOCK_SIZE),
+                       0,
+                       handle->stream,
+                       m,
+                       n,
+                       idx_base_A,
+                       csr_val_A,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       nnz_A,
+                       idx_base_C,
+                       csr_val_C,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       threshold);
 }
 
 template <typename T>
@@ -310,7 +212,18 @@ rocsparse_status rocsparse_prune_csr2csr_by_percentage_buffer_size_template(
         return rocsparse_status_invalid_pointer;
     }
 
-    *buffer_size = std::max(2 * nnz_A * static_cast<rocsparse_int>(sizeof(T)), 512);
+    // rocprim buffer
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                static_cast<rocsparse_int*>(nullptr),
+                                                static_cast<rocsparse_int*>(nullptr),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    // Threshold, radix select and rocprim buffer
+    *buffer_size = 256 + rocsparse_radix_select_buffer_size() + rocprim_size;
 
     return rocsparse_status_success;
 }
@@ -423,67 +336,28 @@ rocsparse_status
     pos               = std::min(pos, nnz_A - 1);
     pos               = std::max(pos, 0);
 
-    T* output = reinterpret_cast<T*>(temp_buffer);
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
 
-    // Compute absolute value of csr_val_A and store in first half of output array
-    {
-        dim3 grid((nnz_A - 1) / 256 + 1);
-        dim3 threads(256);
+    // Threshold, which is kept at the beginning of the buffer for
+    // rocsparse_prune_csr2csr_by_percentage()
+    T* d_threshold = reinterpret_cast<T*>(ptr);
+    ptr += 256;
 
-        hipLaunchKernelGGL(
-            (abs_kernel<256, T>), grid, threads, 0, stream, nnz_A, csr_val_A, output);
-    }
+    // Radix select buffer
+    void* select_buffer = reinterpret_cast<void*>(ptr);
+    ptr += rocsparse_radix_select_buffer_size();
 
-    // Determine amount of temporary storage needed for rocprim sort and inclusive scan and allocate if necessary
-    size_t temp_storage_size_bytes_sort = 0;
-    size_t temp_storage_size_bytes_scan = 0;
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
 
-    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
-        nullptr, temp_storage_size_bytes_sort, output, (output + nnz_A), nnz_A));
+    // Select the threshold among the absolute values of csr_val_A
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_radix_select_abs_template(
+        handle, nnz_A, 1, csr_val_A, nnz_A, pos, d_threshold, select_buffer));
 
-    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
-                                                temp_storage_size_bytes_scan,
-                                                csr_row_ptr_C,
-                                                csr_row_ptr_C,
-                                                m + 1,
-                                                rocprim::plus<rocsparse_int>(),
-                                                handle->stream));
-
-    size_t temp_storage_size_bytes
-        = std::max(temp_storage_size_bytes_sort, temp_storage_size_bytes_scan);
-
-    // Device buffer should be sufficient for rocprim in most cases
-    bool  temp_alloc       = false;
-    void* temp_storage_ptr = nullptr;
-    if(handle->buffer_size >= temp_storage_size_bytes)
-    {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
-        temp_alloc = true;
-    }
-
-    // perform sort on first half of output array and store result in second half of output array
-    rocprim::radix_sort_keys(
-        temp_storage_ptr, temp_storage_size_bytes, output, (output + nnz_A), nnz_A);
-
-    // Determine threshold on host or device
-    T  h_threshold;
-    T* threshold = nullptr;
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        threshold = &output[nnz_A + pos];
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(&h_threshold, &output[nnz_A + pos], sizeof(T), hipMemcpyDeviceToHost));
-
-        threshold = &h_threshold;
-    }
+    // The threshold has been selected on the device, thus it is read by the kernels
+    // independently of the pointer mode
+    const T* threshold = d_threshold;
 
     constexpr rocsparse_int block_size = 1024;
 
@@ -614,28 +488,31 @@ rocsparse_status
         return rocsparse_status_arch_mismatch;
     }
 
-    // Store threshold at first entry in output array
-    RETURN_IF_HIP_ERROR(
-        hipMemcpy(output, &output[nnz_A + pos], sizeof(T), hipMemcpyDeviceToDevice));
-
     // Compute csr_row_ptr_C with the right index base.
-    rocsparse_int first_value = csr_descr_C->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr_C, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+    hipLaunchKernelGGL((set_row_ptr_base_kernel<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle->stream,
+                       csr_descr_C->base,
+                       csr_row_ptr_C);
 
     // Perform actual inclusive sum
-    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
-                                                temp_storage_size_bytes,
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
                                                 csr_row_ptr_C,
                                                 csr_row_ptr_C,
                                                 m + 1,
                                                 rocprim::plus<rocsparse_int>(),
                                                 handle->stream));
-    // Free rocprim buffer, if allocated
-    if(temp_alloc == true)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-    }
 
     // compute nnz_total_dev_host_ptr
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -651,10 +528,14 @@ rocsparse_status
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_total_dev_host_ptr,
-                                      &csr_row_ptr_C[m],
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_total_dev_host_ptr,
+                                           &csr_row_ptr_C[m],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         *nnz_total_dev_host_ptr -= csr_descr_C->base;
     }
@@ -736,22 +617,9 @@ rocsparse_status
         return rocsparse_status_invalid_pointer;
     }
 
-    // Determine threshold on host or device
-    T  h_threshold;
-    T* threshold = nullptr;
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        threshold = &(reinterpret_cast<T*>(temp_buffer))[0];
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_threshold,
-                                      &(reinterpret_cast<T*>(temp_buffer))[0],
-                                      sizeof(T),
-                                      hipMemcpyDeviceToHost));
-
-        threshold = &h_threshold;
-    }
+    // The threshold, kept at the beginning of the buffer by
+    // rocsparse_prune_csr2csr_nnz_by_percentage(), is read by the kernels on the device
+    const T* threshold = reinterpret_cast<const T*>(temp_buffer);
 
     constexpr rocsparse_int block_size = 1024;
 
@@ -268,9 +268,13 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
     }
 
     // Compute csr_row_ptr with the right index base.
-    rocsparse_int first_value = descr->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+    hipLaunchKernelGGL((set_row_ptr_base_kernel<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle->stream,
+                       descr->base,
+                       csr_row_ptr);
 
     // Obtain rocprim buffer size
     size_t temp_storage_bytes = 0;
@@ -326,8 +330,14 @@ rocsparse_status rocsparse_prune_dense2csr_nnz_template(rocsparse_handle
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            nnz_total_dev_host_ptr, &csr_row_ptr[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_total_dev_host_ptr,
+                                           &csr_row_ptr[m],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         *nnz_total_dev_host_ptr -= descr->base;
     }
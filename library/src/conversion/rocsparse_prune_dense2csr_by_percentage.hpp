@@ -28,24 +28,12 @@
 
 #include "csr2csr_compress_device.h"
 #include "definitions.h"
-#include "prune_dense2csr_by_percentage_device.h"
 #include "prune_dense2csr_device.h"
+#include "rocsparse_radix_select.hpp"
 #include "utility.h"
 
 #include <rocprim/rocprim.hpp>
 
-template <rocsparse_int DIM_X, rocsparse_int DIM_Y, typename T>
-__launch_bounds__(DIM_X* DIM_Y) __global__
-    void prune_dense2csr_nnz_kernel_host_pointer(rocsparse_int m,
-                                                 rocsparse_int n,
-                                                 const T* __restrict__ A,
-                                                 rocsparse_int lda,
-                                                 T             threshold,
-                                                 rocsparse_int* __restrict__ nnz_per_rows)
-{
-    prune_dense2csr_nnz_kernel<DIM_X, DIM_Y, T>(m, n, A, lda, threshold, nnz_per_rows);
-}
-
 template <rocsparse_int DIM_X, rocsparse_int DIM_Y, typename T>
 __launch_bounds__(DIM_X* DIM_Y) __global__
     void prune_dense2csr_nnz_kernel_device_pointer(rocsparse_int m,
@@ -115,12 +103,29 @@ rocsparse_status
               replaceX<T>("X"),
               "--mtx <matrix.mtx>");
 
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     if(buffer_size == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    *buffer_size = 2 * m * n * sizeof(T);
+    // rocprim buffer
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                static_cast<rocsparse_int*>(nullptr),
+                                                static_cast<rocsparse_int*>(nullptr),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    // Threshold, radix select and rocprim buffer
+    *buffer_size = 256 + rocsparse_radix_select_buffer_size() + rocprim_size;
 
     return rocsparse_status_success;
 }
@@ -223,58 +228,29 @@ rocsparse_status
         return rocsparse_status_invalid_pointer;
     }
 
-    rocsparse_int nnz_A = m * n;
-    rocsparse_int pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
-    pos                 = std::min(pos, nnz_A - 1);
-    pos                 = std::max(pos, 0);
+    int64_t nnz_A = static_cast<int64_t>(m) * n;
+    int64_t pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
+    pos           = std::min(pos, nnz_A - 1);
+    pos           = std::max(pos, static_cast<int64_t>(0));
 
-    T* output = reinterpret_cast<T*>(temp_buffer);
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
 
-    // Compute absolute value of A and store in first half of output array
-    {
-        dim3 grid((nnz_A - 1) / 256 + 1);
-        dim3 threads(256);
+    // Threshold, which is kept at the beginning of the buffer for
+    // rocsparse_prune_dense2csr_by_percentage()
+    T* d_threshold = reinterpret_cast<T*>(ptr);
+    ptr += 256;
 
-        hipLaunchKernelGGL((abs_kernel<256, T>), grid, threads, 0, stream, m, n, A, lda, output);
-    }
-
-    // Determine amount of temporary storage needed for rocprim sort and inclusive scan and allocate if necessary
-    size_t temp_storage_size_bytes_sort = 0;
-    size_t temp_storage_size_bytes_scan = 0;
-
-    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
-        nullptr, temp_storage_size_bytes_sort, output, (output + nnz_A), nnz_A));
-
-    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
-                                                temp_storage_size_bytes_scan,
-                                                csr_row_ptr,
-                                                csr_row_ptr,
-                                                m + 1,
-                                                rocprim::plus<rocsparse_int>(),
-                                                handle->stream));
-
-    size_t temp_storage_size_bytes
-        = std::max(temp_storage_size_bytes_sort, temp_storage_size_bytes_scan);
-
-    // Device buffer should be sufficient for rocprim in most cases
-    bool  temp_alloc       = false;
-    void* temp_storage_ptr = nullptr;
-    if(handle->buffer_size >= temp_storage_size_bytes)
-    {
-        temp_storage_ptr = handle->buffer;
-        temp_alloc       = false;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
-        temp_alloc = true;
-    }
+    // Radix select buffer
+    void* select_buffer = reinterpret_cast<void*>(ptr);
+    ptr += rocsparse_radix_select_buffer_size();
 
-    // perform sort on first half of output array and store result in second half of output array
-    rocprim::radix_sort_keys(
-        temp_storage_ptr, temp_storage_size_bytes, output, (output + nnz_A), nnz_A);
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
 
-    T* d_threshold = &output[nnz_A + pos];
+    // Select the threshold among the absolute values of A
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_radix_select_abs_template(
+        handle, m, n, A, lda, pos, d_threshold, select_buffer));
 
     static constexpr int NNZ_DIM_X = 64;
     static constexpr int NNZ_DIM_Y = 16;
@@ -282,58 +258,45 @@ rocsparse_status
     dim3 grid((m - 1) / (NNZ_DIM_X * 4) + 1);
     dim3 threads(NNZ_DIM_X, NNZ_DIM_Y);
 
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        hipLaunchKernelGGL((prune_dense2csr_nnz_kernel_device_pointer<NNZ_DIM_X, NNZ_DIM_Y, T>),
-                           grid,
-                           threads,
-                           0,
-                           stream,
-                           m,
-                           n,
-                           A,
-                           lda,
-                           d_threshold,
-                           &csr_row_ptr[1]);
-    }
-    else
-    {
-        T h_threshold = 0;
-        RETURN_IF_HIP_ERROR(hipMemcpy(&h_threshold, d_threshold, sizeof(T), hipMemcpyDeviceToHost));
-        hipLaunchKernelGGL((prune_dense2csr_nnz_kernel_host_pointer<NNZ_DIM_X, NNZ_DIM_Y, T>),
-                           grid,
-                           threads,
-                           0,
-                           stream,
-                           m,
-                           n,
-                           A,
-                           lda,
-                           h_threshold,
-                           &csr_row_ptr[1]);
-    }
-
-    // Store threshold at first entry in output array
-    RETURN_IF_HIP_ERROR(hipMemcpy(output, d_threshold, sizeof(T), hipMemcpyDeviceToDevice));
+    // The threshold has been selected on the device, thus it is read by the kernel
+    // independently of the pointer mode
+    hipLaunchKernelGGL((prune_dense2csr_nnz_kernel_device_pointer<NNZ_DIM_X, NNZ_DIM_Y, T>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       d_threshold,
+                       &csr_row_ptr[1]);
 
     // Compute csr_row_ptr with the right index base.
-    rocsparse_int first_value = descr->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+    hipLaunchKernelGGL((set_row_ptr_base_kernel<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle->stream,
+                       descr->base,
+                       csr_row_ptr);
 
     // Perform actual inclusive sum
-    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
-                                                temp_storage_size_bytes,
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
                                                 csr_row_ptr,
                                                 csr_row_ptr,
                                                 m + 1,
                                                 rocprim::plus<rocsparse_int>(),
                                                 handle->stream));
-    // Free rocprim buffer, if allocated
-    if(temp_alloc == true)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
-    }
 
     // Extract nnz_total_dev_host_ptr
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -351,8 +314,14 @@ rocsparse_status
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            nnz_total_dev_host_ptr, &csr_row_ptr[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_total_dev_host_ptr,
+                                           &csr_row_ptr[m],
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         *nnz_total_dev_host_ptr -= descr->base;
     }
@@ -0,0 +1,118 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_RADIX_SELECT_HPP
+#define ROCSPARSE_RADIX_SELECT_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "radix_select_device.h"
+
+#include <algorithm>
+
+#define RADIX_SELECT_BITS 8
+#define RADIX_SELECT_DIM 1024
+
+// Size of the temporary storage required by rocsparse_radix_select_abs_template
+inline size_t rocsparse_radix_select_buffer_size()
+{
+    // Selection state and histogram
+    return 256 + sizeof(unsigned long long) * (1 << RADIX_SELECT_BITS);
+}
+
+// Select the element of given rank among the absolute values of the dense m x n matrix A
+// and store it in value, which has to be in device memory. Each pass over A selects one
+// digit of the bit pattern of the element, such that A is neither copied nor sorted.
+template <typename T>
+rocsparse_status rocsparse_radix_select_abs_template(rocsparse_handle handle,
+                                                     rocsparse_int    m,
+                                                     rocsparse_int    n,
+                                                     const T*         A,
+                                                     rocsparse_int    lda,
+                                                     int64_t          rank,
+                                                     T*               value,
+                                                     void*            temp_buffer)
+{
+    using K = typename radix_select_key<T>::type;
+
+    constexpr unsigned int radix = 1 << RADIX_SELECT_BITS;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    radix_select_state<K>* state = reinterpret_cast<radix_select_state<K>*>(ptr);
+    ptr += 256;
+
+    unsigned long long* histogram = reinterpret_cast<unsigned long long*>(ptr);
+
+    hipLaunchKernelGGL((radix_select_init_kernel<radix, K>),
+                       dim3(1),
+                       dim3(radix),
+                       0,
+                       stream,
+                       rank,
+                       state,
+                       histogram);
+
+    // Each block accumulates its histogram in shared memory, thus the number of blocks is
+    // limited to a few per compute unit
+    int64_t size       = static_cast<int64_t>(m) * n;
+    int64_t max_blocks = static_cast<int64_t>(handle->properties.multiProcessorCount) * 8;
+    int64_t blocks     = std::min((size - 1) / RADIX_SELECT_DIM + 1, max_blocks);
+
+    for(int shift = sizeof(K) * 8 - RADIX_SELECT_BITS; shift >= 0; shift -= RADIX_SELECT_BITS)
+    {
+        hipLaunchKernelGGL(
+            (radix_select_histogram_kernel<RADIX_SELECT_DIM, RADIX_SELECT_BITS, T, K>),
+            dim3(blocks),
+            dim3(RADIX_SELECT_DIM),
+            0,
+            stream,
+            m,
+            n,
+            A,
+            lda,
+            shift,
+            state,
+            histogram);
+
+        hipLaunchKernelGGL((radix_select_digit_kernel<radix, T, K>),
+                           dim3(1),
+                           dim3(radix),
+                           0,
+                           stream,
+                           shift,
+                           state,
+                           histogram,
+                           value);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_RADIX_SELECT_HPP
@@ -0,0 +1,269 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_sellc2csr.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sellc2csr_nnz(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr sell_descr,
+                                                    rocsparse_int             sell_slice_size,
+                                                    const rocsparse_int*      sell_slice_ptr,
+                                                    const rocsparse_int*      sell_col_ind,
+                                                    const rocsparse_int*      sell_perm,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    rocsparse_int*            csr_row_ptr,
+                                                    rocsparse_int*            csr_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_sellc2csr_nnz",
+              m,
+              n,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_col_ind,
+              (const void*&)sell_perm,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_nnz);
+
+    // Check index base
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || sell_slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check csr_nnz pointer argument before setting
+    if(csr_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csr_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *csr_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+// Count nnz per row
+#define SELLC2CSR_DIM 256
+    dim3 sellc2csr_blocks((m - 1) / SELLC2CSR_DIM + 1);
+    dim3 sellc2csr_threads(SELLC2CSR_DIM);
+
+    hipLaunchKernelGGL((sellc2csr_nnz_per_row<SELLC2CSR_DIM>),
+                       sellc2csr_blocks,
+                       sellc2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       sell_slice_size,
+                       sell_slice_ptr,
+                       sell_col_ind,
+                       sell_perm,
+                       sell_descr->base,
+                       csr_row_ptr,
+                       csr_descr->base);
+#undef SELLC2CSR_DIM
+
+    // Inclusive sum to obtain csr_row_ptr array and number of non-zero elements
+    size_t temp_storage_bytes = 0;
+
+    // Obtain rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_bytes,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Get rocprim buffer
+    bool  d_temp_alloc;
+    void* d_temp_storage;
+
+    // Device buffer should be sufficient for rocprim in most cases
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        d_temp_storage = handle->buffer;
+        d_temp_alloc   = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    // Perform actual inclusive sum
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz according to index base
+        if(csr_descr->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((sellc2csr_index_base<1>), dim3(1), dim3(1), 0, stream, csr_nnz);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *csr_nnz -= csr_descr->base;
+    }
+
+    // Free rocprim buffer, if allocated
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_int             m,               \
+                                     rocsparse_int             n,               \
+                                     const rocsparse_mat_descr sell_descr,      \
+                                     rocsparse_int             sell_slice_size, \
+                                     const TYPE*               sell_val,        \
+                                     const rocsparse_int*      sell_slice_ptr,  \
+                                     const rocsparse_int*      sell_col_ind,    \
+                                     const rocsparse_int*      sell_perm,       \
+                                     const rocsparse_mat_descr csr_descr,       \
+                                     TYPE*                     csr_val,         \
+                                     const rocsparse_int*      csr_row_ptr,     \
+                                     rocsparse_int*            csr_col_ind)     \
+    {                                                                           \
+        return rocsparse_sellc2csr_template(handle,                             \
+                                            m,                                  \
+                                            n,                                  \
+                                            sell_descr,                         \
+                                            sell_slice_size,                    \
+                                            sell_val,                           \
+                                            sell_slice_ptr,                     \
+                                            sell_col_ind,                       \
+                                            sell_perm,                          \
+                                            csr_descr,                          \
+                                            csr_val,                            \
+                                            csr_row_ptr,                        \
+                                            csr_col_ind);                       \
+    }
+
+C_IMPL(rocsparse_ssellc2csr, float);
+C_IMPL(rocsparse_dsellc2csr, double);
+C_IMPL(rocsparse_csellc2csr, rocsparse_float_complex);
+C_IMPL(rocsparse_zsellc2csr, rocsparse_double_complex);
+
+#undef C_IMPL
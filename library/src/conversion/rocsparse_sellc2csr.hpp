@@ -0,0 +1,179 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_SELLC2CSR_HPP
+#define ROCSPARSE_SELLC2CSR_HPP
+
+#include "utility.h"
+
+#include "definitions.h"
+#include "sellc2csr_device.h"
+
+template <typename T>
+rocsparse_status rocsparse_sellc2csr_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              const rocsparse_mat_descr sell_descr,
+                                              rocsparse_int             sell_slice_size,
+                                              const T*                  sell_val,
+                                              const rocsparse_int*      sell_slice_ptr,
+                                              const rocsparse_int*      sell_col_ind,
+                                              const rocsparse_int*      sell_perm,
+                                              const rocsparse_mat_descr csr_descr,
+                                              T*                        csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              rocsparse_int*            csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsellc2csr"),
+              m,
+              n,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              (const void*&)sell_val,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_col_ind,
+              (const void*&)sell_perm,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f sellc2csr -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> --slice-size",
+              sell_slice_size);
+
+    // Check index base
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || sell_slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(sell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define SELLC2CSR_DIM 256
+    dim3 sellc2csr_blocks((m - 1) / SELLC2CSR_DIM + 1);
+    dim3 sellc2csr_threads(SELLC2CSR_DIM);
+
+    hipLaunchKernelGGL((sellc2csr_fill<T, SELLC2CSR_DIM>),
+                       sellc2csr_blocks,
+                       sellc2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       sell_slice_size,
+                       sell_val,
+                       sell_slice_ptr,
+                       sell_col_ind,
+                       sell_perm,
+                       sell_descr->base,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_descr->base);
+#undef SELLC2CSR_DIM
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SELLC2CSR_HPP
@@ -0,0 +1,138 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef SELLC2CSR_DEVICE_H
+#define SELLC2CSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void sellc2csr_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// Each thread counts the non-padded entries of a row of a slice
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void sellc2csr_nnz_per_row(rocsparse_int m,
+                               rocsparse_int n,
+                               rocsparse_int slice_size,
+                               const rocsparse_int* __restrict__ sell_slice_ptr,
+                               const rocsparse_int* __restrict__ sell_col_ind,
+                               const rocsparse_int* __restrict__ sell_perm,
+                               rocsparse_index_base sell_base,
+                               rocsparse_int* __restrict__ csr_row_ptr,
+                               rocsparse_index_base csr_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    if(ai == 0)
+    {
+        csr_row_ptr[0] = csr_base;
+    }
+
+    rocsparse_int s    = ai / slice_size;
+    rocsparse_int lane = ai % slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base + lane;
+    rocsparse_int width       = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / slice_size;
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int col = sell_col_ind[slice_begin + p * slice_size] - sell_base;
+
+        if(col >= 0 && col < n)
+        {
+            ++nnz;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    csr_row_ptr[sell_perm[ai] + 1] = nnz;
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void sellc2csr_fill(rocsparse_int m,
+                        rocsparse_int n,
+                        rocsparse_int slice_size,
+                        const T* __restrict__ sell_val,
+                        const rocsparse_int* __restrict__ sell_slice_ptr,
+                        const rocsparse_int* __restrict__ sell_col_ind,
+                        const rocsparse_int* __restrict__ sell_perm,
+                        rocsparse_index_base sell_base,
+                        const rocsparse_int* __restrict__ csr_row_ptr,
+                        rocsparse_int* __restrict__ csr_col_ind,
+                        T* __restrict__ csr_val,
+                        rocsparse_index_base csr_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int s    = ai / slice_size;
+    rocsparse_int lane = ai % slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[s] - sell_base + lane;
+    rocsparse_int width       = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / slice_size;
+
+    rocsparse_int csr_idx = csr_row_ptr[sell_perm[ai]] - csr_base;
+
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int sell_idx = slice_begin + p * slice_size;
+        rocsparse_int sell_col = sell_col_ind[sell_idx] - sell_base;
+
+        if(sell_col >= 0 && sell_col < n)
+        {
+            csr_col_ind[csr_idx] = sell_col + csr_base;
+            csr_val[csr_idx]     = sell_val[sell_idx];
+            ++csr_idx;
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+#endif // SELLC2CSR_DEVICE_H
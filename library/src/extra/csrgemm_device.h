@@ -402,10 +402,11 @@ static __device__ __forceinline__ void insert_pair(rocsparse_int key,
     }
 }
 
-// Compute non-zero entries per row, where each row is processed by a single wavefront
+// Compute non-zero entries per row, where each row is processed by a single wavefront.
+// The number of rows in the group is read from the device, the grid loops over the rows
 template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASHSIZE, unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_nnz_wf_per_row(rocsparse_int m,
+    void csrgemm_nnz_wf_per_row(const rocsparse_int* __restrict__ size,
                                 const rocsparse_int* __restrict__ offset,
                                 const rocsparse_int* __restrict__ perm,
                                 const rocsparse_int* __restrict__ csr_row_ptr_A,
@@ -426,8 +427,8 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Wavefront id
     rocsparse_int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each (sub)wavefront processes a row
-    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+    // Number of rows in the group
+    rocsparse_int m = *size;
 
     // Hash table in shared memory
     __shared__ rocsparse_int stable[BLOCKSIZE / WFSIZE * HASHSIZE];
@@ -435,82 +436,83 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Local hash table
     rocsparse_int* table = &stable[wid * HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    // Each (sub)wavefront processes a row
+    for(rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid; idx < m;
+        idx += hipGridDim_x * BLOCKSIZE / WFSIZE)
     {
-        table[i] = -1;
-    }
+        // Initialize hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            table[i] = -1;
+        }
 
-    __threadfence_block();
+        __threadfence_block();
 
-    // Bounds check
-    if(row >= m)
-    {
-        return;
-    }
+        // Apply permutation
+        rocsparse_int row = perm[idx + *offset];
 
-    // Apply permutation, if available
-    row = perm ? perm[row + *offset] : row;
+        // Initialize row nnz
+        rocsparse_int nnz = 0;
 
-    // Initialize row nnz
-    rocsparse_int nnz = 0;
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
 
-    // alpha * A * B part
-    if(mul == true)
-    {
-        // Get row boundaries of the current row in A
-        rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+            // Loop over columns of A in current row
+            for(rocsparse_int j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+            {
+                // Column of A in current row
+                rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
 
-        // Loop over columns of A in current row
-        for(rocsparse_int j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
-        {
-            // Column of A in current row
-            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+                // Loop over columns of B in row col_A
+                rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-            // Loop over columns of B in row col_A
-            rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+                // Insert all columns of B into hash table
+                for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+                {
+                    // Count the actual insertions to obtain row nnz of C
+                    nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                }
+            }
+        }
 
-            // Insert all columns of B into hash table
-            for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(rocsparse_int j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
             {
                 // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
             }
         }
-    }
 
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+        // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
+        // of the current row
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz);
 
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(rocsparse_int j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
+        // Write result to global memory
+        if(lid == WFSIZE - 1)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            row_nnz[row] = nnz;
         }
     }
-
-    // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
-    // of the current row
-    rocsparse_wfreduce_sum<WFSIZE>(&nnz);
-
-    // Write result to global memory
-    if(lid == WFSIZE - 1)
-    {
-        row_nnz[row] = nnz;
-    }
 }
 
-// Compute non-zero entries per row, where each row is processed by a single block
+// Compute non-zero entries per row, where each row is processed by a single block.
+// The number of rows in the group is read from the device, the grid loops over the rows
 template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASHSIZE, unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_nnz_block_per_row(const rocsparse_int* __restrict__ offset,
+    void csrgemm_nnz_block_per_row(const rocsparse_int* __restrict__ size,
+                                   const rocsparse_int* __restrict__ offset,
                                    const rocsparse_int* __restrict__ perm,
                                    const rocsparse_int* __restrict__ csr_row_ptr_A,
                                    const rocsparse_int* __restrict__ csr_col_ind_A,
@@ -530,90 +532,100 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Wavefront id
     rocsparse_int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each block processes a row (apply permutation)
-    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+    // Number of rows in the group
+    rocsparse_int m = *size;
 
     // Hash table in shared memory
     __shared__ rocsparse_int table[HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    // Each block processes a row
+    for(rocsparse_int idx = hipBlockIdx_x; idx < m; idx += hipGridDim_x)
     {
-        table[i] = -1;
-    }
+        // Apply permutation
+        rocsparse_int row = perm[idx + *offset];
 
-    // Wait for all threads to finish initialization
-    __syncthreads();
+        // Wait for all threads to finish the previous row
+        __syncthreads();
 
-    // Initialize row nnz
-    rocsparse_int nnz = 0;
+        // Initialize hash table
+        for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+        {
+            table[i] = -1;
+        }
 
-    // alpha * A * B part
-    if(mul == true)
-    {
-        // Get row boundaries of the current row in A
-        rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        // Wait for all threads to finish initialization
+        __syncthreads();
 
-        // Loop over columns of A in current row
-        for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
-        {
-            // Column of A in current row
-            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+        // Initialize row nnz
+        rocsparse_int nnz = 0;
 
-            // Loop over columns of B in row col_A
-            rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
 
-            for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            // Loop over columns of A in current row
+            for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
             {
-                // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                // Column of A in current row
+                rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+                // Loop over columns of B in row col_A
+                rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+                {
+                    // Count the actual insertions to obtain row nnz of C
+                    nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                }
             }
         }
-    }
-
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(rocsparse_int j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
+        // beta * D part
+        if(add == true)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            // Get row boundaries of the current row in D
+            rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(rocsparse_int j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
+            {
+                // Count the actual insertions to obtain row nnz of C
+                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            }
         }
-    }
 
-    // Wait for all threads to finish hash operation
-    __syncthreads();
+        // Wait for all threads to finish hash operation
+        __syncthreads();
 
-    // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
-    // of the current row
-    rocsparse_wfreduce_sum<WFSIZE>(&nnz);
+        // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
+        // of the current row
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz);
 
-    // Write result to shared memory for final reduction by first wavefront
-    if(lid == WFSIZE - 1)
-    {
-        table[wid] = nnz;
-    }
+        // Write result to shared memory for final reduction by first wavefront
+        if(lid == WFSIZE - 1)
+        {
+            table[wid] = nnz;
+        }
 
-    // Wait for all threads to finish reduction
-    __syncthreads();
+        // Wait for all threads to finish reduction
+        __syncthreads();
 
-    // Gather row nnz for the whole block
-    nnz = (hipThreadIdx_x < BLOCKSIZE / WFSIZE) ? table[hipThreadIdx_x] : 0;
+        // Gather row nnz for the whole block
+        nnz = (hipThreadIdx_x < BLOCKSIZE / WFSIZE) ? table[hipThreadIdx_x] : 0;
 
-    // First wavefront computes final sum
-    rocsparse_wfreduce_sum<BLOCKSIZE / WFSIZE>(&nnz);
+        // First wavefront computes final sum
+        rocsparse_wfreduce_sum<BLOCKSIZE / WFSIZE>(&nnz);
 
-    // Write result to global memory
-    if(hipThreadIdx_x == BLOCKSIZE / WFSIZE - 1)
-    {
-        row_nnz[row] = nnz;
+        // Write result to global memory
+        if(hipThreadIdx_x == BLOCKSIZE / WFSIZE - 1)
+        {
+            row_nnz[row] = nnz;
+        }
     }
 }
 
@@ -624,6 +636,7 @@ __launch_bounds__(BLOCKSIZE) __global__
 template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrgemm_nnz_block_per_row_multipass(rocsparse_int n,
+                                             const rocsparse_int* __restrict__ size,
                                              const rocsparse_int* __restrict__ offset,
                                              const rocsparse_int* __restrict__ perm,
                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
@@ -645,8 +658,8 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Wavefront id
     rocsparse_int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each block processes a row (apply permutation)
-    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+    // Number of rows in the group
+    rocsparse_int m = *size;
 
     // Row nnz marker
     __shared__ bool table[CHUNKSIZE];
@@ -658,166 +671,176 @@ __launch_bounds__(BLOCKSIZE) __global__
     // current chunk
     __shared__ rocsparse_int next_chunk;
 
-    // Begin of the current row chunk (this is the column index of the current row)
-    rocsparse_int chunk_begin = 0;
-    rocsparse_int chunk_end   = CHUNKSIZE;
-
-    // Initialize row nnz for the full row
-    if(hipThreadIdx_x == 0)
+    // Each block processes a row
+    for(rocsparse_int idx = hipBlockIdx_x; idx < m; idx += hipGridDim_x)
     {
-        nnz = 0;
-    }
+        // Apply permutation
+        rocsparse_int row = perm[idx + *offset];
 
-    // Get row boundaries of the current row in A
-    rocsparse_int row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
-    rocsparse_int row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
+        // Wait for all threads to finish the previous row
+        __syncthreads();
 
-    // Loop over the row chunks until the end of the row has been reached (which is
-    // the number of total columns)
-    while(chunk_begin < n)
-    {
-        // Initialize row nnz table
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
-        {
-            table[i] = false;
-        }
+        // Begin of the current row chunk (this is the column index of the current row)
+        rocsparse_int chunk_begin = 0;
+        rocsparse_int chunk_end   = CHUNKSIZE;
 
-        // Initialize next chunk column index
+        // Initialize row nnz for the full row
         if(hipThreadIdx_x == 0)
         {
-            next_chunk = n;
+            nnz = 0;
         }
 
-        // Wait for all threads to finish initialization
-        __syncthreads();
-
-        // Initialize the beginning of the next chunk
-        rocsparse_int min_col = n;
+        // Get row boundaries of the current row in A
+        rocsparse_int row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
+        rocsparse_int row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
 
-        // alpha * A * B part
-        if(mul == true)
+        // Loop over the row chunks until the end of the row has been reached (which is
+        // the number of total columns)
+        while(chunk_begin < n)
         {
-            // Loop over columns of A in current row
-            for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            // Initialize row nnz table
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
             {
-                // Column of A in current row
-                rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+                table[i] = false;
+            }
 
-                // Loop over columns of B in row col_A
-                rocsparse_int row_begin_B
-                    = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
-                rocsparse_int row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+            // Initialize next chunk column index
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = n;
+            }
 
-                // Keep track of the first k where the column index of B is exceeding
-                // the current chunks end point
-                rocsparse_int next_k = row_begin_B + lid;
+            // Wait for all threads to finish initialization
+            __syncthreads();
 
-                for(rocsparse_int k = next_k; k < row_end_B; k += WFSIZE)
+            // Initialize the beginning of the next chunk
+            rocsparse_int min_col = n;
+
+            // alpha * A * B part
+            if(mul == true)
+            {
+                // Loop over columns of A in current row
+                for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
                 {
-                    // Column of B in row col_A
-                    rocsparse_int col_B = csr_col_ind_B[k] - idx_base_B;
+                    // Column of A in current row
+                    rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
 
-                    if(col_B >= chunk_begin && col_B < chunk_end)
+                    // Loop over columns of B in row col_A
+                    rocsparse_int row_begin_B
+                        = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+                    rocsparse_int row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                    // Keep track of the first k where the column index of B is exceeding
+                    // the current chunks end point
+                    rocsparse_int next_k = row_begin_B + lid;
+
+                    for(rocsparse_int k = next_k; k < row_end_B; k += WFSIZE)
                     {
-                        // Mark nnz table if entry at col_B
-                        table[col_B - chunk_begin] = true;
+                        // Column of B in row col_A
+                        rocsparse_int col_B = csr_col_ind_B[k] - idx_base_B;
+
+                        if(col_B >= chunk_begin && col_B < chunk_end)
+                        {
+                            // Mark nnz table if entry at col_B
+                            table[col_B - chunk_begin] = true;
+                        }
+                        else if(col_B >= chunk_end)
+                        {
+                            // If column index exceeds chunks end point, store k as starting
+                            // point of the columns of B for the next pass
+                            next_k = k;
+
+                            // Store the first column index of B that exceeds the current chunk
+                            min_col = min(min_col, col_B);
+                            break;
+                        }
                     }
-                    else if(col_B >= chunk_end)
-                    {
-                        // If column index exceeds chunks end point, store k as starting
-                        // point of the columns of B for the next pass
-                        next_k = k;
 
-                        // Store the first column index of B that exceeds the current chunk
-                        min_col = min(min_col, col_B);
-                        break;
+                    // Obtain the minimum of all k that exceed the current chunks end point
+                    rocsparse_wfreduce_min<WFSIZE>(&next_k);
+
+                    // Store the minimum globally for the next chunk
+                    if(lid == WFSIZE - 1)
+                    {
+                        workspace_B[j] = next_k;
                     }
                 }
+            }
 
-                // Obtain the minimum of all k that exceed the current chunks end point
-                rocsparse_wfreduce_min<WFSIZE>(&next_k);
+            // beta * D part
+            if(add == true)
+            {
+                // Get row boundaries of the current row in D
+                rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+                rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-                // Store the minimum globally for the next chunk
-                if(lid == WFSIZE - 1)
+                // Loop over columns of D in current row and insert all columns of D into hash table
+                for(rocsparse_int j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
                 {
-                    workspace_B[j] = next_k;
+                    // Column of D in current row
+                    rocsparse_int col_D = csr_col_ind_D[j] - idx_base_D;
+
+                    if(col_D >= chunk_begin && col_D < chunk_end)
+                    {
+                        // Mark nnz table if entry at col_D
+                        table[col_D - chunk_begin] = true;
+                    }
+                    else if(col_D >= chunk_end)
+                    {
+                        // Store the first column index of D that exceeds the current chunk
+                        min_col = min(min_col, col_D);
+                        break;
+                    }
                 }
             }
-        }
 
-        // beta * D part
-        if(add == true)
-        {
-            // Get row boundaries of the current row in D
-            rocsparse_int row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-            rocsparse_int row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+            // Gather wavefront-wide minimum for the next chunks starting column index
+            rocsparse_wfreduce_min<WFSIZE>(&min_col);
 
-            // Loop over columns of D in current row and insert all columns of D into hash table
-            for(rocsparse_int j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
+            // Last thread in each wavefront finds block-wide minimum atomically
+            if(lid == WFSIZE - 1)
             {
-                // Column of D in current row
-                rocsparse_int col_D = csr_col_ind_D[j] - idx_base_D;
-
-                if(col_D >= chunk_begin && col_D < chunk_end)
-                {
-                    // Mark nnz table if entry at col_D
-                    table[col_D - chunk_begin] = true;
-                }
-                else if(col_D >= chunk_end)
-                {
-                    // Store the first column index of D that exceeds the current chunk
-                    min_col = min(min_col, col_D);
-                    break;
-                }
+                // Atomically determine the new chunks beginning (minimum column index of B
+                // that is larger than the current chunks end point)
+                atomicMin(&next_chunk, min_col);
             }
-        }
 
-        // Gather wavefront-wide minimum for the next chunks starting column index
-        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+            // Wait for all threads to finish row nnz operation
+            __syncthreads();
 
-        // Last thread in each wavefront finds block-wide minimum atomically
-        if(lid == WFSIZE - 1)
-        {
-            // Atomically determine the new chunks beginning (minimum column index of B
-            // that is larger than the current chunks end point)
-            atomicMin(&next_chunk, min_col);
-        }
+            // Each thread loads its entry for the current chunk
+            rocsparse_int chunk_nnz = 0;
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                chunk_nnz += (table[i] == true) ? 1 : 0;
+            }
 
-        // Wait for all threads to finish row nnz operation
-        __syncthreads();
+            // Gather wavefront-wide nnz for the current chunk
+            rocsparse_wfreduce_sum<WFSIZE>(&chunk_nnz);
 
-        // Each thread loads its entry for the current chunk
-        rocsparse_int chunk_nnz = 0;
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
-        {
-            chunk_nnz += (table[i] == true) ? 1 : 0;
-        }
+            // Last thread in each wavefront accumulates block-wide nnz atomically
+            if(lid == WFSIZE - 1)
+            {
+                // Atomically add this chunks nnz to the total row nnz
+                atomicAdd(&nnz, chunk_nnz);
+            }
 
-        // Gather wavefront-wide nnz for the current chunk
-        rocsparse_wfreduce_sum<WFSIZE>(&chunk_nnz);
-
-        // Last thread in each wavefront accumulates block-wide nnz atomically
-        if(lid == WFSIZE - 1)
-        {
-            // Atomically add this chunks nnz to the total row nnz
-            atomicAdd(&nnz, chunk_nnz);
-        }
-
-        // Wait for atomics to be processed
-        __syncthreads();
+            // Wait for atomics to be processed
+            __syncthreads();
 
-        // Each thread loads the new chunk beginning and end point
-        chunk_begin = next_chunk;
-        chunk_end   = chunk_begin + CHUNKSIZE;
+            // Each thread loads the new chunk beginning and end point
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
 
-        // Wait for all threads to finish load from shared memory
-        __syncthreads();
-    }
+            // Wait for all threads to finish load from shared memory
+            __syncthreads();
+        }
 
-    // Write accumulated total row nnz to global memory
-    if(hipThreadIdx_x == 0)
-    {
-        row_nnz[row] = nnz;
+        // Write accumulated total row nnz to global memory
+        if(hipThreadIdx_x == 0)
+        {
+            row_nnz[row] = nnz;
+        }
     }
 }
 
@@ -1419,4 +1442,746 @@ __device__ void
     }
 }
 
+// Compute column entries of C, where each row is processed by a single wavefront.
+// Only the sparsity pattern is computed, values are accumulated in the numeric phase.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASHSIZE, unsigned int HASHVAL>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_wf_per_row(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ offset,
+                                     const rocsparse_int* __restrict__ perm,
+                                     const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                     const rocsparse_int* __restrict__ csr_col_ind_A,
+                                     const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                     const rocsparse_int* __restrict__ csr_col_ind_B,
+                                     const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                     rocsparse_int* __restrict__ csr_col_ind_C,
+                                     rocsparse_index_base idx_base_A,
+                                     rocsparse_index_base idx_base_B,
+                                     rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Hash table in shared memory
+    __shared__ rocsparse_int stable[BLOCKSIZE / WFSIZE * HASHSIZE];
+
+    // Local hash table
+    rocsparse_int* table = &stable[wid * HASHSIZE];
+
+    // Initialize hash table
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        table[i] = -1;
+    }
+
+    __threadfence_block();
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Apply permutation, if available
+    row = perm ? perm[row + *offset] : row;
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(rocsparse_int j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+    {
+        // Column of A in current row
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+        // Loop over columns of B in row col_A
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        // Insert all columns of B into hash table
+        for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+        {
+            insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+        }
+    }
+
+    __threadfence_block();
+
+    // Entry point of current row into C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over hash table
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        // Get column from hash table to fill it into C
+        rocsparse_int col_C = table[i];
+
+        // Skip hash table entry if not present
+        if(col_C == -1)
+        {
+            continue;
+        }
+
+        // Initialize index into C
+        rocsparse_int idx_C = row_begin_C;
+
+        // Loop through hash table to find the (sorted) index into C for the
+        // current column index
+        for(unsigned int hash_idx = 0; hash_idx < HASHSIZE; ++hash_idx)
+        {
+            // Increment index into C if column entry is greater than a valid table entry
+            rocsparse_int key = table[hash_idx];
+
+            if(key != -1 && col_C > key)
+            {
+                ++idx_C;
+            }
+        }
+
+        // Write column to the obtained position in C
+        csr_col_ind_C[idx_C] = col_C + idx_base_C;
+    }
+}
+
+// Compute column entries of C, where each row is processed by a single block.
+// Only the sparsity pattern is computed, values are accumulated in the numeric phase.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASHSIZE, unsigned int HASHVAL>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_block_per_row(const rocsparse_int* __restrict__ offset,
+                                        const rocsparse_int* __restrict__ perm,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                        const rocsparse_int* __restrict__ csr_col_ind_A,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                        const rocsparse_int* __restrict__ csr_col_ind_B,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                        rocsparse_int* __restrict__ csr_col_ind_C,
+                                        rocsparse_index_base idx_base_A,
+                                        rocsparse_index_base idx_base_B,
+                                        rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Hash table in shared memory
+    __shared__ rocsparse_int table[HASHSIZE];
+
+    // Initialize hash table
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        table[i] = -1;
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Each block processes a row (apply permutation)
+    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of A in current row
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+        // Loop over columns of B in row col_A
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+        }
+    }
+
+    // Wait for hash operations to finish
+    __syncthreads();
+
+    // Compress hash table, such that valid entries come first
+    __shared__ rocsparse_int scan_offsets[BLOCKSIZE / warpSize + 1];
+
+    // Offset into hash table
+    rocsparse_int hash_offset = 0;
+
+    // Loop over the hash table and do the compression
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        // Get column from hash table
+        rocsparse_int col_C = table[i];
+
+        // Boolean to store if thread owns a non-zero element
+        bool has_nnz = col_C != -1;
+
+        // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+        // to compute its wavefront-wide non-zero offset
+        unsigned long long mask = __ballot(has_nnz);
+
+        // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+        int nnz = __popcll(mask);
+
+        // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+        unsigned long long lanemask_le
+            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+        // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+        int offset = __popcll(lanemask_le & mask);
+
+        // Need to sync here to make sure reading from table array has finished
+        __syncthreads();
+
+        // Each wavefront writes its offset / nnz into shared memory so we can compute the
+        // scan offset
+        scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+        // Wait for all wavefronts to finish writing
+        __syncthreads();
+
+        // Each thread accumulates the offset of all previous wavefronts to obtain its offset
+        for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+        {
+            if(hipThreadIdx_x >= j * warpSize)
+            {
+                offset += scan_offsets[j - 1];
+            }
+        }
+
+        // Offset depends on all previously added non-zeros and need to be shifted by
+        // 1 (zero-based indexing)
+        rocsparse_int idx = hash_offset + offset - 1;
+
+        // Only threads with a non-zero entry write their column
+        if(has_nnz)
+        {
+            table[idx] = col_C;
+        }
+
+        // Last thread in block writes the block-wide offset such that all subsequent
+        // entries are shifted by this offset
+        if(hipThreadIdx_x == BLOCKSIZE - 1)
+        {
+            scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+        }
+
+        // Wait for last thread in block to finish writing
+        __syncthreads();
+
+        // Each thread reads the block-wide offset and adds it to its local offset
+        hash_offset += scan_offsets[BLOCKSIZE / warpSize - 1];
+    }
+
+    // Entry point into row of C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+    rocsparse_int row_nnz     = row_end_C - row_begin_C;
+
+    // Loop over all valid entries in hash table
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnz; i += BLOCKSIZE)
+    {
+        rocsparse_int col_C = table[i];
+
+        // Index into C
+        rocsparse_int idx_C = row_begin_C;
+
+        // Loop through hash table to find the (sorted) index into C for the
+        // current column index
+        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        {
+            // Increment index into C if column entry is greater than table entry
+            if(col_C > table[j])
+            {
+                ++idx_C;
+            }
+        }
+
+        // Write column to the obtained position in C
+        csr_col_ind_C[idx_C] = col_C + idx_base_C;
+    }
+}
+
+// Compute column entries of C, where each row is processed by a single block. Splitting
+// row into several chunks such that we can use shared memory to store whether a column
+// index is populated or not. Only the sparsity pattern is computed, values are
+// accumulated in the numeric phase.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_block_per_row_multipass(rocsparse_int n,
+                                                  const rocsparse_int* __restrict__ offset,
+                                                  const rocsparse_int* __restrict__ perm,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                                  const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                                  const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                                  rocsparse_int* __restrict__ csr_col_ind_C,
+                                                  rocsparse_int* __restrict__ workspace_B,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row (apply permutation)
+    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+
+    // Row entry marker
+    __shared__ bool table[CHUNKSIZE];
+
+    // Shared memory to communicate the scan offsets of each wavefront
+    __shared__ int scan_offsets[BLOCKSIZE / warpSize];
+
+    // Shared memory to determine the minimum of all column indices of B that exceed the
+    // current chunk
+    __shared__ rocsparse_int next_chunk;
+
+    // Begin of the current row chunk (this is the column index of the current row)
+    rocsparse_int chunk_begin = 0;
+    rocsparse_int chunk_end   = CHUNKSIZE;
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Entry point into columns of C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over the row chunks until the end of the row has been reached (which is
+    // the number of total columns)
+    while(chunk_begin < n)
+    {
+        // Initialize row nnz table
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = 0;
+        }
+
+        // Initialize next chunk column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = n;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = n;
+
+        // Loop over columns of A in current row
+        for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of A in current row
+            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+            // Loop over columns of B in row col_A
+            rocsparse_int row_begin_B
+                = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+            rocsparse_int row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            // Keep track of the first k where the column index of B is exceeding
+            // the current chunks end point
+            rocsparse_int next_k = row_begin_B + lid;
+
+            // Loop over columns of B in row col_A
+            for(rocsparse_int k = next_k; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B in row col_A
+                rocsparse_int col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_begin && col_B < chunk_end)
+                {
+                    // Mark nnz table if entry at col_B
+                    table[col_B - chunk_begin] = 1;
+                }
+                else if(col_B >= chunk_end)
+                {
+                    // If column index exceeds chunks end point, store k as starting
+                    // point of the columns of B for the next pass
+                    next_k = k;
+
+                    // Store the first column index of B that exceeds the current chunk
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+            }
+
+            // Obtain the minimum of all k that exceed the current chunks end point
+            rocsparse_wfreduce_min<WFSIZE>(&next_k);
+
+            // Store the minimum globally for the next chunk
+            if(lid == WFSIZE - 1)
+            {
+                workspace_B[j] = next_k;
+            }
+        }
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+
+        // Last thread in each wavefront finds block-wide minimum atomically
+        if(lid == WFSIZE - 1)
+        {
+            // Atomically determine the new chunks beginning (minimum column index of B
+            // that is larger than the current chunks end point)
+            atomicMin(&next_chunk, min_col);
+        }
+
+        // Wait for all threads to finish
+        __syncthreads();
+
+        // "Pseudo compress" the table array, we do an exclusive scan to obtain the index
+        // where each column has to be written to
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            // Each thread loads its marker to know whether it has to process a non-zero
+            // entry or not
+            bool has_nnz = table[i];
+
+            // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+            // to compute its wavefront-wide non-zero offset in C
+            unsigned long long mask = __ballot(has_nnz == true);
+
+            // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+            int nnz = __popcll(mask);
+
+            // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+            unsigned long long lanemask_le
+                = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+            // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+            int offset = __popcll(lanemask_le & mask);
+
+            // Each wavefront writes its offset / nnz into shared memory so we can compute the
+            // scan offset
+            scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+            // Wait for all wavefronts to finish writing
+            __syncthreads();
+
+            // Each thread accumulates the offset of all previous wavefronts to obtain its
+            // offset into C
+            for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+            {
+                if(hipThreadIdx_x >= j * warpSize)
+                {
+                    offset += scan_offsets[j - 1];
+                }
+            }
+
+            // Only threads with a non-zero entry write to C
+            if(has_nnz)
+            {
+                csr_col_ind_C[row_begin_C + offset - 1] = i + chunk_begin + idx_base_C;
+            }
+
+            // Wait for all threads to finish reading the scan offsets
+            __syncthreads();
+
+            // Last thread in block writes the block-wide offset into C such that all subsequent
+            // entries are shifted by this offset
+            if(hipThreadIdx_x == BLOCKSIZE - 1)
+            {
+                scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+            }
+
+            // Wait for last thread in block to finish writing
+            __syncthreads();
+
+            // Each thread reads the block-wide offset and adds it to its local offset into C
+            row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+
+            // Wait for all threads to finish reading the block-wide offset
+            __syncthreads();
+        }
+
+        // Each thread loads the new chunk beginning and end point
+        chunk_begin = next_chunk;
+        chunk_end   = chunk_begin + CHUNKSIZE;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+}
+
+// Binary search for the position of a column index within a sorted row of C. The
+// column index is guaranteed to be present, as it has been computed by the symbolic phase
+static __device__ __forceinline__ rocsparse_int
+    csrgemm_find_col(rocsparse_int col, const rocsparse_int* __restrict__ cols, rocsparse_int nnz)
+{
+    rocsparse_int l = 0;
+    rocsparse_int r = nnz - 1;
+
+    while(l < r)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(cols[mid] < col)
+        {
+            l = mid + 1;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    return l;
+}
+
+// Accumulate values of C, using the sparsity pattern of the symbolic phase, where each
+// row is processed by a single wavefront
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int ROWSIZE>
+__device__ void csrgemm_numeric_wf_per_row_device(rocsparse_int m,
+                                                  const rocsparse_int* __restrict__ offset,
+                                                  const rocsparse_int* __restrict__ perm,
+                                                  T alpha,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                                  const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                  const T* __restrict__ csr_val_A,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                                  const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                  const T* __restrict__ csr_val_B,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                                  const rocsparse_int* __restrict__ csr_col_ind_C,
+                                                  T* __restrict__ csr_val_C,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Row pattern and accumulator in shared memory
+    __shared__ rocsparse_int scol[BLOCKSIZE / WFSIZE * ROWSIZE];
+    __shared__ T             sdata[BLOCKSIZE / WFSIZE * ROWSIZE];
+
+    // Local row pattern and accumulator
+    rocsparse_int* col  = &scol[wid * ROWSIZE];
+    T*             data = &sdata[wid * ROWSIZE];
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Apply permutation, if available
+    row = perm ? perm[row + *offset] : row;
+
+    // Row boundaries of the current row in C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+    // Load the sorted columns of the current row of C
+    for(rocsparse_int i = lid; i < row_nnz_C; i += WFSIZE)
+    {
+        col[i]  = csr_col_ind_C[row_begin_C + i] - idx_base_C;
+        data[i] = static_cast<T>(0);
+    }
+
+    __threadfence_block();
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(rocsparse_int j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+    {
+        // Column of A in current row
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+        // Value of A in current row
+        T val_A = alpha * csr_val_A[j];
+
+        // Loop over columns of B in row col_A
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+        {
+            // Position of the product within the current row of C
+            rocsparse_int pos = csrgemm_find_col(csr_col_ind_B[k] - idx_base_B, col, row_nnz_C);
+
+            atomicAdd(&data[pos], val_A * csr_val_B[k]);
+        }
+    }
+
+    __threadfence_block();
+
+    // Write accumulated values to C
+    for(rocsparse_int i = lid; i < row_nnz_C; i += WFSIZE)
+    {
+        csr_val_C[row_begin_C + i] = data[i];
+    }
+}
+
+// Accumulate values of C, using the sparsity pattern of the symbolic phase, where each
+// row is processed by a single block
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int ROWSIZE>
+__device__ void
+    csrgemm_numeric_block_per_row_device(const rocsparse_int* __restrict__ offset,
+                                         const rocsparse_int* __restrict__ perm,
+                                         T alpha,
+                                         const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                         const rocsparse_int* __restrict__ csr_col_ind_A,
+                                         const T* __restrict__ csr_val_A,
+                                         const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                         const rocsparse_int* __restrict__ csr_col_ind_B,
+                                         const T* __restrict__ csr_val_B,
+                                         const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                         const rocsparse_int* __restrict__ csr_col_ind_C,
+                                         T* __restrict__ csr_val_C,
+                                         rocsparse_index_base idx_base_A,
+                                         rocsparse_index_base idx_base_B,
+                                         rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Row pattern and accumulator in shared memory
+    __shared__ rocsparse_int col[ROWSIZE];
+    __shared__ T             data[ROWSIZE];
+
+    // Each block processes a row (apply permutation)
+    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+
+    // Row boundaries of the current row in C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+    // Load the sorted columns of the current row of C
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+    {
+        col[i]  = csr_col_ind_C[row_begin_C + i] - idx_base_C;
+        data[i] = static_cast<T>(0);
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of A in current row
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+        // Value of A in current row
+        T val_A = alpha * csr_val_A[j];
+
+        // Loop over columns of B in row col_A
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            // Position of the product within the current row of C
+            rocsparse_int pos = csrgemm_find_col(csr_col_ind_B[k] - idx_base_B, col, row_nnz_C);
+
+            atomicAdd(&data[pos], val_A * csr_val_B[k]);
+        }
+    }
+
+    // Wait for all threads to finish accumulation
+    __syncthreads();
+
+    // Write accumulated values to C
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+    {
+        csr_val_C[row_begin_C + i] = data[i];
+    }
+}
+
+// Accumulate values of C, using the sparsity pattern of the symbolic phase, where each
+// row is processed by a single block. The row of C exceeds the available shared memory,
+// thus the products are accumulated directly in global memory
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void
+    csrgemm_numeric_block_per_row_global_device(const rocsparse_int* __restrict__ offset,
+                                                const rocsparse_int* __restrict__ perm,
+                                                T alpha,
+                                                const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                                const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                const T* __restrict__ csr_val_A,
+                                                const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                                const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                const T* __restrict__ csr_val_B,
+                                                const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                                const rocsparse_int* __restrict__ csr_col_ind_C,
+                                                T* __restrict__ csr_val_C,
+                                                rocsparse_index_base idx_base_A,
+                                                rocsparse_index_base idx_base_B,
+                                                rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row (apply permutation)
+    rocsparse_int row = perm[hipBlockIdx_x + *offset];
+
+    // Row boundaries of the current row in C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+    // Initialize the current row of C
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+    {
+        csr_val_C[row_begin_C + i] = static_cast<T>(0);
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of A in current row
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+        // Value of A in current row
+        T val_A = alpha * csr_val_A[j];
+
+        // Loop over columns of B in row col_A
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            // Position of the product within the current row of C
+            rocsparse_int pos = csrgemm_find_col(csr_col_ind_B[k] - idx_base_B + idx_base_C,
+                                                 &csr_col_ind_C[row_begin_C],
+                                                 row_nnz_C);
+
+            atomicAdd(&csr_val_C[row_begin_C + pos], val_A * csr_val_B[k]);
+        }
+    }
+}
+
 #endif // CSRGEMM_DEVICE_H
@@ -30,6 +30,17 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_index_base(rocsparse_int* n
     --(*nnz);
 }
 
+// Grid size of the group kernels. The number of rows per group is only known on the
+// device, thus the grid is bounded by what the device can hold and the kernels loop
+// over the rows of their group.
+template <unsigned int BLOCKSIZE>
+static inline dim3 csrgemm_nnz_grid(rocsparse_handle handle, rocsparse_int nblocks)
+{
+    rocsparse_int nmax = handle->properties.multiProcessorCount * (2048 / BLOCKSIZE);
+
+    return dim3(std::max(std::min(nblocks, nmax), 1));
+}
+
 static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
@@ -57,13 +68,781 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Index base
-    rocsparse_index_base base_A
-        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_B
-        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_D
-        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
+    // Index base
+    rocsparse_index_base base_A
+        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B
+        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_D
+        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
+
+    // Temporary buffer
+    char* buffer = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer
+    size_t rocprim_size;
+    void*  rocprim_buffer;
+
+    // Group offset buffer
+    rocsparse_int* d_group_offset = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += sizeof(rocsparse_int) * 256;
+
+    // Group size buffer
+    rocsparse_int* d_group_size = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += sizeof(rocsparse_int) * 256 * CSRGEMM_MAXGROUPS;
+
+    // Workspace for rows with more than 8192 intermediate products
+    rocsparse_int* workspace_B = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += ((sizeof(rocsparse_int) * nnz_A - 1) / 256 + 1) * 256;
+
+    // Compute number of intermediate products for each row
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+    hipLaunchKernelGGL((csrgemm_intermediate_products<CSRGEMM_DIM, CSRGEMM_SUB>),
+                       dim3((m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_row_ptr_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // The rows are always processed in groups of similar sized intermediate products.
+    // Group sizes and offsets stay on the device, such that the host does not need to
+    // wait for the stream.
+
+    // Determine number of rows per group
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(CSRGEMM_DIM),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_C,
+                       d_group_size);
+
+    hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       d_group_size);
+#undef CSRGEMM_DIM
+
+    // Exclusive sum to obtain group offsets
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    rocprim_buffer = reinterpret_cast<void*>(buffer);
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Permutation temporary arrays
+    rocsparse_int* tmp_vals = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(buffer);
+    buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Create identity permutation for group access
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, tmp_perm));
+
+    rocprim::double_buffer<rocsparse_int> d_keys(csr_row_ptr_C, tmp_keys);
+    rocprim::double_buffer<rocsparse_int> d_vals(tmp_perm, tmp_vals);
+
+    // Sort pairs (by groups)
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+    rocprim_buffer = reinterpret_cast<void*>(buffer);
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+
+    // Permutation array
+    rocsparse_int* d_perm = d_vals.current();
+
+    // Release tmp_keys buffer
+    buffer -= ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Compute non-zero entries per row for each group. Each group is launched for the
+    // worst case, the kernels loop over the rows of their group, if there are any.
+
+    // Group 0: 0 - 32 intermediate products
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 4
+#define CSRGEMM_HASHSIZE 32
+    hipLaunchKernelGGL(
+        (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
+        csrgemm_nnz_grid<CSRGEMM_DIM>(handle, (m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+        dim3(CSRGEMM_DIM),
+        0,
+        stream,
+        &d_group_size[0],
+        &d_group_offset[0],
+        d_perm,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_row_ptr_C,
+        base_A,
+        base_B,
+        base_D,
+        info_C->csrgemm_info->mul,
+        info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 1: 33 - 64 intermediate products
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_HASHSIZE 64
+    hipLaunchKernelGGL(
+        (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
+        csrgemm_nnz_grid<CSRGEMM_DIM>(handle, (m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+        dim3(CSRGEMM_DIM),
+        0,
+        stream,
+        &d_group_size[1],
+        &d_group_offset[1],
+        d_perm,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_row_ptr_C,
+        base_A,
+        base_B,
+        base_D,
+        info_C->csrgemm_info->mul,
+        info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 2: 65 - 512 intermediate products
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 8
+#define CSRGEMM_HASHSIZE 512
+    hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                  CSRGEMM_SUB,
+                                                  CSRGEMM_HASHSIZE,
+                                                  CSRGEMM_NNZ_HASH>),
+                       csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       &d_group_size[2],
+                       &d_group_offset[2],
+                       d_perm,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       base_B,
+                       base_D,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 3: 513 - 1024 intermediate products
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 8
+#define CSRGEMM_HASHSIZE 1024
+    hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                  CSRGEMM_SUB,
+                                                  CSRGEMM_HASHSIZE,
+                                                  CSRGEMM_NNZ_HASH>),
+                       csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       &d_group_size[3],
+                       &d_group_offset[3],
+                       d_perm,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       base_B,
+                       base_D,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 4: 1025 - 2048 intermediate products
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_HASHSIZE 2048
+    hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                  CSRGEMM_SUB,
+                                                  CSRGEMM_HASHSIZE,
+                                                  CSRGEMM_NNZ_HASH>),
+                       csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       &d_group_size[4],
+                       &d_group_offset[4],
+                       d_perm,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       base_B,
+                       base_D,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 5: 2049 - 4096 intermediate products
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+#define CSRGEMM_HASHSIZE 4096
+    hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                  CSRGEMM_SUB,
+                                                  CSRGEMM_HASHSIZE,
+                                                  CSRGEMM_NNZ_HASH>),
+                       csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       &d_group_size[5],
+                       &d_group_offset[5],
+                       d_perm,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       base_B,
+                       base_D,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 6: 4097 - 8192 intermediate products
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_HASHSIZE 8192
+    hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                  CSRGEMM_SUB,
+                                                  CSRGEMM_HASHSIZE,
+                                                  CSRGEMM_NNZ_HASH>),
+                       csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       &d_group_size[6],
+                       &d_group_offset[6],
+                       d_perm,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       base_A,
+                       base_B,
+                       base_D,
+                       info_C->csrgemm_info->mul,
+                       info_C->csrgemm_info->add);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Group 7: more than 8192 intermediate products
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+#define CSRGEMM_CHUNKSIZE 2048
+    hipLaunchKernelGGL(
+        (csrgemm_nnz_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
+        csrgemm_nnz_grid<CSRGEMM_DIM>(handle, m),
+        dim3(CSRGEMM_DIM),
+        0,
+        stream,
+        n,
+        &d_group_size[7],
+        &d_group_offset[7],
+        d_perm,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_row_ptr_C,
+        workspace_B,
+        base_A,
+        base_B,
+        base_D,
+        info_C->csrgemm_info->mul,
+        info_C->csrgemm_info->add);
+#undef CSRGEMM_CHUNKSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Exclusive sum to obtain row pointers of C
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    rocprim_buffer = reinterpret_cast<void*>(buffer);
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Store nnz of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Adjust nnz by index base
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             k,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   rocsparse_int             nnz_A,
+                                                   const rocsparse_int*      csr_row_ptr_A,
+                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   rocsparse_int             nnz_B,
+                                                   const rocsparse_int*      csr_row_ptr_B,
+                                                   const rocsparse_int*      csr_col_ind_B,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   rocsparse_int*            csr_row_ptr_C,
+                                                   rocsparse_int*            nnz_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid info structure
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Perform nnz calculation
+    return rocsparse_csrgemm_nnz_calc(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      descr_C,
+                                      csr_row_ptr_C,
+                                      nnz_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   rocsparse_int             nnz_D,
+                                                   const rocsparse_int*      csr_row_ptr_D,
+                                                   const rocsparse_int*      csr_col_ind_D,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   rocsparse_int*            csr_row_ptr_C,
+                                                   rocsparse_int*            nnz_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid info structure
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || nnz_D < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_D == nullptr || csr_row_ptr_D == nullptr || csr_col_ind_D == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_D->base != rocsparse_index_base_zero && descr_D->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_D->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz_D == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Copy row pointers
+#define CSRGEMM_DIM 1024
+    hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
+                       dim3(m / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m + 1,
+                       csr_row_ptr_D,
+                       csr_row_ptr_C,
+                       descr_D->base,
+                       descr_C->base);
+#undef CSRGEMM_DIM
+
+    // When scaling a matrix, nnz of C will always be equal to nnz of D
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // Take nnz from the row pointers, such that no pageable host memory is copied
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        *nnz_C = nnz_D;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans_A,
+                                                  rocsparse_operation       trans_B,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             k,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  rocsparse_int             nnz_A,
+                                                  const rocsparse_int*      csr_row_ptr_A,
+                                                  const rocsparse_int*      csr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  rocsparse_int             nnz_B,
+                                                  const rocsparse_int*      csr_row_ptr_B,
+                                                  const rocsparse_int*      csr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_D,
+                                                  rocsparse_int             nnz_D,
+                                                  const rocsparse_int*      csr_row_ptr_D,
+                                                  const rocsparse_int*      csr_col_ind_D,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  rocsparse_int*            csr_row_ptr_C,
+                                                  rocsparse_int*            nnz_C,
+                                                  const rocsparse_mat_info  info_C,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_nnz",
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Either mult, add or multadd need to be performed
+    if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
+    {
+        // C = alpha * A * B + beta * D
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
+    {
+        // C = alpha * A * B
+        return rocsparse_csrgemm_nnz_mult(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info_C,
+                                          temp_buffer);
+    }
+    else if(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true)
+    {
+        // C = beta * D
+        return rocsparse_csrgemm_nnz_scal(handle,
+                                          m,
+                                          n,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info_C,
+                                          temp_buffer);
+    }
+    else
+    {
+        // C = 0
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status rocsparse_csrgemm_symbolic_calc(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             k,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        rocsparse_int             nnz_A,
+                                                        const rocsparse_int*      csr_row_ptr_A,
+                                                        const rocsparse_int*      csr_col_ind_A,
+                                                        const rocsparse_mat_descr descr_B,
+                                                        const rocsparse_int*      csr_row_ptr_B,
+                                                        const rocsparse_int*      csr_col_ind_B,
+                                                        const rocsparse_mat_descr descr_C,
+                                                        const rocsparse_int*      csr_row_ptr_C,
+                                                        rocsparse_int*            csr_col_ind_C,
+                                                        const rocsparse_mat_info  info_C,
+                                                        void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Symbolic data
+    rocsparse_csrgemm_info csrgemm = info_C->csrgemm_info;
 
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
@@ -72,83 +851,71 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
     size_t rocprim_size;
     void*  rocprim_buffer;
 
-    // Compute number of intermediate products for each row
+    // Determine maximum non-zero entries per row of all rows
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(buffer);
+
 #define CSRGEMM_DIM 256
-#define CSRGEMM_SUB 8
-    hipLaunchKernelGGL((csrgemm_intermediate_products<CSRGEMM_DIM, CSRGEMM_SUB>),
-                       dim3((m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<CSRGEMM_DIM>),
+                       dim3(CSRGEMM_DIM),
                        dim3(CSRGEMM_DIM),
                        0,
                        stream,
                        m,
-                       csr_row_ptr_A,
-                       csr_col_ind_A,
-                       csr_row_ptr_B,
-                       csr_row_ptr_D,
                        csr_row_ptr_C,
-                       base_A,
-                       info_C->csrgemm_info->mul,
-                       info_C->csrgemm_info->add);
-#undef CSRGEMM_SUB
+                       workspace);
+
+    hipLaunchKernelGGL(
+        (csrgemm_max_row_nnz_part2<CSRGEMM_DIM>), dim3(1), dim3(CSRGEMM_DIM), 0, stream, workspace);
 #undef CSRGEMM_DIM
 
-    // Determine maximum of all intermediate products
-    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<rocsparse_int>(),
-                                        stream));
-    rocprim_buffer = reinterpret_cast<void*>(buffer);
-    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<rocsparse_int>(),
-                                        stream));
-
-    rocsparse_int int_max;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &int_max, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    rocsparse_int nnz_max;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&nnz_max, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-    // Group offset buffer
-    rocsparse_int* d_group_offset = reinterpret_cast<rocsparse_int*>(buffer);
-    buffer += sizeof(rocsparse_int) * 256;
-
-    // Group size buffer
-    rocsparse_int h_group_size[CSRGEMM_MAXGROUPS];
+    // Group offsets are kept in the info structure, such that they can be re-used by
+    // the numeric phase
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&csrgemm->group_offset, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS));
 
     // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS);
-
-    // Permutation array
-    rocsparse_int* d_perm = nullptr;
+    memset(&csrgemm->group_size[0], 0, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS);
 
-    // If maximum of intermediate products exceeds 32, we process the rows in groups of
-    // similar sized intermediate products
-    if(int_max > 32)
+    // If maximum of row nnz exceeds 16, we process the rows in groups of
+    // similar sized row nnz
+    if(nnz_max > 16)
     {
         // Group size buffer
         rocsparse_int* d_group_size = reinterpret_cast<rocsparse_int*>(buffer);
         buffer += sizeof(rocsparse_int) * 256 * CSRGEMM_MAXGROUPS;
 
-        // Determine number of rows per group
+        // Permutation temporary arrays
+        rocsparse_int* tmp_vals = reinterpret_cast<rocsparse_int*>(buffer);
+        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(buffer);
+        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(buffer);
+        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_groups = reinterpret_cast<rocsparse_int*>(buffer);
+        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+        // Determine number of rows per group. Groups are independent of the data type,
+        // the numeric phase takes care of rows that exceed the available shared memory
 #define CSRGEMM_DIM 256
-        hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+        hipLaunchKernelGGL((csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, false>),
                            dim3(CSRGEMM_DIM),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
                            m,
                            csr_row_ptr_C,
-                           d_group_size);
+                           d_group_size,
+                           tmp_groups);
 
         hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
                            dim3(1),
@@ -162,7 +929,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
                                                     rocprim_size,
                                                     d_group_size,
-                                                    d_group_offset,
+                                                    csrgemm->group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
                                                     rocprim::plus<rocsparse_int>(),
@@ -171,14 +938,14 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
                                                     rocprim_size,
                                                     d_group_size,
-                                                    d_group_offset,
+                                                    csrgemm->group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
                                                     rocprim::plus<rocsparse_int>(),
                                                     stream));
 
         // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrgemm->group_size,
                                            d_group_size,
                                            sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS,
                                            hipMemcpyDeviceToHost,
@@ -187,20 +954,10 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         // Wait for host transfer to finish
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-        // Permutation temporary arrays
-        rocsparse_int* tmp_vals = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
-
-        rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
-
-        rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
-
         // Create identity permutation for group access
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, tmp_perm));
 
-        rocprim::double_buffer<rocsparse_int> d_keys(csr_row_ptr_C, tmp_keys);
+        rocprim::double_buffer<rocsparse_int> d_keys(tmp_groups, tmp_keys);
         rocprim::double_buffer<rocsparse_int> d_vals(tmp_perm, tmp_vals);
 
         // Sort pairs (by groups)
@@ -210,94 +967,100 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
             rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
 
-        d_perm = d_vals.current();
-
-        // Release tmp_keys buffer
-        buffer -= ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        // Store the permutation in the info structure
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrgemm->perm, sizeof(rocsparse_int) * m));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrgemm->perm,
+                                           d_vals.current(),
+                                           sizeof(rocsparse_int) * m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
     else
     {
         // First group processes all rows
-        h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(rocsparse_int), stream));
+        csrgemm->group_size[0] = m;
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(csrgemm->group_offset, 0, sizeof(rocsparse_int), stream));
     }
 
-    // Compute non-zero entries per row for each group
+    const rocsparse_int* h_group_size   = csrgemm->group_size;
+    const rocsparse_int* d_group_offset = csrgemm->group_offset;
+    const rocsparse_int* d_perm         = csrgemm->perm;
 
-    // Group 0: 0 - 32 intermediate products
+    // Compute columns of C for each group
+
+    // Group 0: 0 - 16 non-zeros per row
     if(h_group_size[0] > 0)
     {
-#define CSRGEMM_DIM 128
-#define CSRGEMM_SUB 4
-#define CSRGEMM_HASHSIZE 32
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[0],
-            &d_group_offset[0],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_HASHSIZE 16
+        hipLaunchKernelGGL((csrgemm_symbolic_wf_per_row<CSRGEMM_DIM,
+                                                        CSRGEMM_SUB,
+                                                        CSRGEMM_HASHSIZE,
+                                                        CSRGEMM_FLL_HASH>),
+                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[0],
+                           &d_group_offset[0],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 1: 33 - 64 intermediate products
+    // Group 1: 17 - 32 non-zeros per row
     if(h_group_size[1] > 0)
     {
 #define CSRGEMM_DIM 256
-#define CSRGEMM_SUB 8
-#define CSRGEMM_HASHSIZE 64
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[1],
-            &d_group_offset[1],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+#define CSRGEMM_SUB 16
+#define CSRGEMM_HASHSIZE 32
+        hipLaunchKernelGGL((csrgemm_symbolic_wf_per_row<CSRGEMM_DIM,
+                                                        CSRGEMM_SUB,
+                                                        CSRGEMM_HASHSIZE,
+                                                        CSRGEMM_FLL_HASH>),
+                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[1],
+                           &d_group_offset[1],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 2: 65 - 512 intermediate products
+    // Group 2: 33 - 256 non-zeros per row
     if(h_group_size[2] > 0)
     {
 #define CSRGEMM_DIM 128
-#define CSRGEMM_SUB 8
-#define CSRGEMM_HASHSIZE 512
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
-                                                      CSRGEMM_SUB,
-                                                      CSRGEMM_HASHSIZE,
-                                                      CSRGEMM_NNZ_HASH>),
+#define CSRGEMM_SUB 16
+#define CSRGEMM_HASHSIZE 256
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row<CSRGEMM_DIM,
+                                                           CSRGEMM_SUB,
+                                                           CSRGEMM_HASHSIZE,
+                                                           CSRGEMM_FLL_HASH>),
                            dim3(h_group_size[2]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -308,29 +1071,26 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_col_ind_A,
                            csr_row_ptr_B,
                            csr_col_ind_B,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
                            csr_row_ptr_C,
-                           base_A,
-                           base_B,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 3: 513 - 1024 intermediate products
+    // Group 3: 257 - 512 non-zeros per row
     if(h_group_size[3] > 0)
     {
-#define CSRGEMM_DIM 128
-#define CSRGEMM_SUB 8
-#define CSRGEMM_HASHSIZE 1024
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
-                                                      CSRGEMM_SUB,
-                                                      CSRGEMM_HASHSIZE,
-                                                      CSRGEMM_NNZ_HASH>),
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+#define CSRGEMM_HASHSIZE 512
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row<CSRGEMM_DIM,
+                                                           CSRGEMM_SUB,
+                                                           CSRGEMM_HASHSIZE,
+                                                           CSRGEMM_FLL_HASH>),
                            dim3(h_group_size[3]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -341,29 +1101,26 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_col_ind_A,
                            csr_row_ptr_B,
                            csr_col_ind_B,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
                            csr_row_ptr_C,
-                           base_A,
-                           base_B,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 4: 1025 - 2048 intermediate products
+    // Group 4: 513 - 1024 non-zeros per row
     if(h_group_size[4] > 0)
     {
-#define CSRGEMM_DIM 256
-#define CSRGEMM_SUB 16
-#define CSRGEMM_HASHSIZE 2048
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
-                                                      CSRGEMM_SUB,
-                                                      CSRGEMM_HASHSIZE,
-                                                      CSRGEMM_NNZ_HASH>),
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 32
+#define CSRGEMM_HASHSIZE 1024
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row<CSRGEMM_DIM,
+                                                           CSRGEMM_SUB,
+                                                           CSRGEMM_HASHSIZE,
+                                                           CSRGEMM_FLL_HASH>),
                            dim3(h_group_size[4]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -374,29 +1131,26 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_col_ind_A,
                            csr_row_ptr_B,
                            csr_col_ind_B,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
                            csr_row_ptr_C,
-                           base_A,
-                           base_B,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 5: 2049 - 4096 intermediate products
+    // Group 5: 1025 - 2048 non-zeros per row
     if(h_group_size[5] > 0)
     {
-#define CSRGEMM_DIM 512
-#define CSRGEMM_SUB 16
-#define CSRGEMM_HASHSIZE 4096
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
-                                                      CSRGEMM_SUB,
-                                                      CSRGEMM_HASHSIZE,
-                                                      CSRGEMM_NNZ_HASH>),
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_HASHSIZE 2048
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row<CSRGEMM_DIM,
+                                                           CSRGEMM_SUB,
+                                                           CSRGEMM_HASHSIZE,
+                                                           CSRGEMM_FLL_HASH>),
                            dim3(h_group_size[5]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -407,29 +1161,27 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_col_ind_A,
                            csr_row_ptr_B,
                            csr_col_ind_B,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
                            csr_row_ptr_C,
-                           base_A,
-                           base_B,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Group 6: 4097 - 8192 intermediate products
+#ifndef rocsparse_ILP64
+    // Group 6: 2049 - 4096 non-zeros per row
     if(h_group_size[6] > 0)
     {
 #define CSRGEMM_DIM 1024
-#define CSRGEMM_SUB 32
-#define CSRGEMM_HASHSIZE 8192
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
-                                                      CSRGEMM_SUB,
-                                                      CSRGEMM_HASHSIZE,
-                                                      CSRGEMM_NNZ_HASH>),
+#define CSRGEMM_SUB 64
+#define CSRGEMM_HASHSIZE 4096
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row<CSRGEMM_DIM,
+                                                           CSRGEMM_SUB,
+                                                           CSRGEMM_HASHSIZE,
+                                                           CSRGEMM_FLL_HASH>),
                            dim3(h_group_size[6]),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -440,20 +1192,18 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_col_ind_A,
                            csr_row_ptr_B,
                            csr_col_ind_B,
-                           csr_row_ptr_D,
-                           csr_col_ind_D,
                            csr_row_ptr_C,
-                           base_A,
-                           base_B,
-                           base_D,
-                           info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
+#endif
 
-    // Group 7: more than 8192 intermediate products
+    // Group 7: more than 4096 non-zeros per row
     if(h_group_size[7] > 0)
     {
 #define CSRGEMM_DIM 512
@@ -461,115 +1211,60 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_CHUNKSIZE 2048
         rocsparse_int* workspace_B = nullptr;
 
-        if(info_C->csrgemm_info->mul == true)
-        {
-            // Allocate additional buffer for C = alpha * A * B
-            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(rocsparse_int) * nnz_A));
-        }
+        // Allocate additional buffer for the chunk entry points into B
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(rocsparse_int) * nnz_A));
 
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
-            dim3(h_group_size[7]),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            n,
-            &d_group_offset[7],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            workspace_B,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
-
-        if(info_C->csrgemm_info->mul == true)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-        }
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row_multipass<CSRGEMM_DIM,
+                                                                     CSRGEMM_SUB,
+                                                                     CSRGEMM_CHUNKSIZE>),
+                           dim3(h_group_size[7]),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           n,
+                           &d_group_offset[7],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           workspace_B,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+
+        RETURN_IF_HIP_ERROR(hipFree(workspace_B));
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
-    // Exclusive sum to obtain row pointers of C
-    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
-                                                rocprim_size,
-                                                csr_row_ptr_C,
-                                                csr_row_ptr_C,
-                                                descr_C->base,
-                                                m + 1,
-                                                rocprim::plus<rocsparse_int>(),
-                                                stream));
-    rocprim_buffer = reinterpret_cast<void*>(buffer);
-    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
-                                                rocprim_size,
-                                                csr_row_ptr_C,
-                                                csr_row_ptr_C,
-                                                descr_C->base,
-                                                m + 1,
-                                                rocprim::plus<rocsparse_int>(),
-                                                stream));
-
-    // Store nnz of C
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
-
-        // Adjust nnz by index base
-        if(descr_C->base == rocsparse_index_base_one)
-        {
-            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
-        }
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-        // Adjust nnz by index base
-        *nnz_C -= descr_C->base;
-    }
-
     return rocsparse_status_success;
 }
 
-static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          handle,
-                                                   rocsparse_operation       trans_A,
-                                                   rocsparse_operation       trans_B,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   rocsparse_int             k,
-                                                   const rocsparse_mat_descr descr_A,
-                                                   rocsparse_int             nnz_A,
-                                                   const rocsparse_int*      csr_row_ptr_A,
-                                                   const rocsparse_int*      csr_col_ind_A,
-                                                   const rocsparse_mat_descr descr_B,
-                                                   rocsparse_int             nnz_B,
-                                                   const rocsparse_int*      csr_row_ptr_B,
-                                                   const rocsparse_int*      csr_col_ind_B,
-                                                   const rocsparse_mat_descr descr_C,
-                                                   rocsparse_int*            csr_row_ptr_C,
-                                                   rocsparse_int*            nnz_C,
-                                                   const rocsparse_mat_info  info_C,
-                                                   void*                     temp_buffer)
+static rocsparse_status rocsparse_csrgemm_symbolic_mult(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             k,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        rocsparse_int             nnz_A,
+                                                        const rocsparse_int*      csr_row_ptr_A,
+                                                        const rocsparse_int*      csr_col_ind_A,
+                                                        const rocsparse_mat_descr descr_B,
+                                                        rocsparse_int             nnz_B,
+                                                        const rocsparse_int*      csr_row_ptr_B,
+                                                        const rocsparse_int*      csr_col_ind_B,
+                                                        const rocsparse_mat_descr descr_C,
+                                                        rocsparse_int             nnz_C,
+                                                        const rocsparse_int*      csr_row_ptr_C,
+                                                        rocsparse_int*            csr_col_ind_C,
+                                                        const rocsparse_mat_info  info_C,
+                                                        void*                     temp_buffer)
 {
-    // Check for valid info structure
-    if(info_C->csrgemm_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
     // Check valid sizes
-    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0)
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_C < 0)
     {
         return rocsparse_status_invalid_size;
     }
@@ -577,7 +1272,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          han
     // Check valid pointers
     if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
        || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
-       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr
        || temp_buffer == nullptr)
     {
         return rocsparse_status_invalid_pointer;
@@ -611,78 +1306,54 @@ static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          han
         return rocsparse_status_not_implemented;
     }
 
-    // Stream
-    hipStream_t stream = handle->stream;
-
     // Quick return if possible
-    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0 || nnz_C == 0)
     {
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
-        }
-        else
-        {
-            *nnz_C = 0;
-        }
-
         return rocsparse_status_success;
     }
 
-    // Perform nnz calculation
-    return rocsparse_csrgemm_nnz_calc(handle,
-                                      trans_A,
-                                      trans_B,
-                                      m,
-                                      n,
-                                      k,
-                                      descr_A,
-                                      nnz_A,
-                                      csr_row_ptr_A,
-                                      csr_col_ind_A,
-                                      descr_B,
-                                      nnz_B,
-                                      csr_row_ptr_B,
-                                      csr_col_ind_B,
-                                      nullptr,
-                                      0,
-                                      nullptr,
-                                      nullptr,
-                                      descr_C,
-                                      csr_row_ptr_C,
-                                      nnz_C,
-                                      info_C,
-                                      temp_buffer);
+    // Perform symbolic calculation
+    return rocsparse_csrgemm_symbolic_calc(handle,
+                                           m,
+                                           n,
+                                           k,
+                                           descr_A,
+                                           nnz_A,
+                                           csr_row_ptr_A,
+                                           csr_col_ind_A,
+                                           descr_B,
+                                           csr_row_ptr_B,
+                                           csr_col_ind_B,
+                                           descr_C,
+                                           csr_row_ptr_C,
+                                           csr_col_ind_C,
+                                           info_C,
+                                           temp_buffer);
 }
 
-static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          handle,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   const rocsparse_mat_descr descr_D,
-                                                   rocsparse_int             nnz_D,
-                                                   const rocsparse_int*      csr_row_ptr_D,
-                                                   const rocsparse_int*      csr_col_ind_D,
-                                                   const rocsparse_mat_descr descr_C,
-                                                   rocsparse_int*            csr_row_ptr_C,
-                                                   rocsparse_int*            nnz_C,
-                                                   const rocsparse_mat_info  info_C,
-                                                   void*                     temp_buffer)
+static rocsparse_status rocsparse_csrgemm_symbolic_scal(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const rocsparse_mat_descr descr_D,
+                                                        rocsparse_int             nnz_D,
+                                                        const rocsparse_int*      csr_row_ptr_D,
+                                                        const rocsparse_int*      csr_col_ind_D,
+                                                        const rocsparse_mat_descr descr_C,
+                                                        rocsparse_int             nnz_C,
+                                                        const rocsparse_int*      csr_row_ptr_C,
+                                                        rocsparse_int*            csr_col_ind_C,
+                                                        const rocsparse_mat_info  info_C,
+                                                        void*                     temp_buffer)
 {
-    // Check for valid info structure
-    if(info_C->csrgemm_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
     // Check valid sizes
-    if(m < 0 || n < 0 || nnz_D < 0)
+    if(m < 0 || n < 0 || nnz_D < 0 || nnz_C < 0)
     {
         return rocsparse_status_invalid_size;
     }
 
     // Check valid pointers
     if(descr_D == nullptr || csr_row_ptr_D == nullptr || csr_col_ind_D == nullptr
-       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr
        || temp_buffer == nullptr)
     {
         return rocsparse_status_invalid_pointer;
@@ -708,45 +1379,31 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
         return rocsparse_status_not_implemented;
     }
 
-    // Stream
-    hipStream_t stream = handle->stream;
+    // When scaling a matrix, nnz of C will always be equal to nnz of D
+    if(nnz_C != nnz_D)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Quick return if possible
     if(m == 0 || n == 0 || nnz_D == 0)
     {
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
-        }
-        else
-        {
-            *nnz_C = 0;
-        }
-
         return rocsparse_status_success;
     }
 
-    // When scaling a matrix, nnz of C will always be equal to nnz of D
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(nnz_C, &nnz_D, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-    }
-    else
-    {
-        *nnz_C = nnz_D;
-    }
+    // Stream
+    hipStream_t stream = handle->stream;
 
-    // Copy row pointers
+    // Copy column entries
 #define CSRGEMM_DIM 1024
     hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
-                       dim3(m / CSRGEMM_DIM + 1),
+                       dim3((nnz_D - 1) / CSRGEMM_DIM + 1),
                        dim3(CSRGEMM_DIM),
                        0,
                        stream,
-                       m + 1,
-                       csr_row_ptr_D,
-                       csr_row_ptr_C,
+                       nnz_D,
+                       csr_col_ind_D,
+                       csr_col_ind_C,
                        descr_D->base,
                        descr_C->base);
 #undef CSRGEMM_DIM
@@ -754,29 +1411,30 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
-                                                  rocsparse_operation       trans_A,
-                                                  rocsparse_operation       trans_B,
-                                                  rocsparse_int             m,
-                                                  rocsparse_int             n,
-                                                  rocsparse_int             k,
-                                                  const rocsparse_mat_descr descr_A,
-                                                  rocsparse_int             nnz_A,
-                                                  const rocsparse_int*      csr_row_ptr_A,
-                                                  const rocsparse_int*      csr_col_ind_A,
-                                                  const rocsparse_mat_descr descr_B,
-                                                  rocsparse_int             nnz_B,
-                                                  const rocsparse_int*      csr_row_ptr_B,
-                                                  const rocsparse_int*      csr_col_ind_B,
-                                                  const rocsparse_mat_descr descr_D,
-                                                  rocsparse_int             nnz_D,
-                                                  const rocsparse_int*      csr_row_ptr_D,
-                                                  const rocsparse_int*      csr_col_ind_D,
-                                                  const rocsparse_mat_descr descr_C,
-                                                  rocsparse_int*            csr_row_ptr_C,
-                                                  rocsparse_int*            nnz_C,
-                                                  const rocsparse_mat_info  info_C,
-                                                  void*                     temp_buffer)
+extern "C" rocsparse_status rocsparse_csrgemm_symbolic(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             k,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       rocsparse_int             nnz_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       rocsparse_int             nnz_B,
+                                                       const rocsparse_int*      csr_row_ptr_B,
+                                                       const rocsparse_int*      csr_col_ind_B,
+                                                       const rocsparse_mat_descr descr_D,
+                                                       rocsparse_int             nnz_D,
+                                                       const rocsparse_int*      csr_row_ptr_D,
+                                                       const rocsparse_int*      csr_col_ind_D,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       rocsparse_int             nnz_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       rocsparse_int*            csr_col_ind_C,
+                                                       rocsparse_mat_info        info_C,
+                                                       void*                     temp_buffer)
 {
     // Check for valid handle and info structure
     if(handle == nullptr)
@@ -786,7 +1444,7 @@ extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          hand
 
     // Logging
     log_trace(handle,
-              "rocsparse_csrgemm_nnz",
+              "rocsparse_csrgemm_symbolic",
               trans_A,
               trans_B,
               m,
@@ -805,8 +1463,9 @@ extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          hand
               (const void*&)csr_row_ptr_D,
               (const void*&)csr_col_ind_D,
               (const void*&)descr_C,
+              nnz_C,
               (const void*&)csr_row_ptr_C,
-              (const void*&)nnz_C,
+              (const void*&)csr_col_ind_C,
               (const void*&)info_C,
               (const void*&)temp_buffer);
 
@@ -822,51 +1481,70 @@ extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          hand
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_csrgemm_info csrgemm = info_C->csrgemm_info;
+
+    // Clear symbolic data of a previous run
+    csrgemm->symbolic = false;
+
+    if(csrgemm->group_offset != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrgemm->group_offset));
+        csrgemm->group_offset = nullptr;
+    }
+
+    if(csrgemm->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrgemm->perm));
+        csrgemm->perm = nullptr;
+    }
+
+    memset(&csrgemm->group_size[0], 0, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS);
+
     // Either mult, add or multadd need to be performed
-    if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
+    if(csrgemm->mul == true && csrgemm->add == true)
     {
         // C = alpha * A * B + beta * D
         // TODO
         return rocsparse_status_not_implemented;
     }
-    else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
+    else if(csrgemm->mul == true && csrgemm->add == false)
     {
         // C = alpha * A * B
-        return rocsparse_csrgemm_nnz_mult(handle,
-                                          trans_A,
-                                          trans_B,
-                                          m,
-                                          n,
-                                          k,
-                                          descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
-                                          descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
-                                          descr_C,
-                                          csr_row_ptr_C,
-                                          nnz_C,
-                                          info_C,
-                                          temp_buffer);
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic_mult(handle,
+                                                                  m,
+                                                                  n,
+                                                                  k,
+                                                                  descr_A,
+                                                                  nnz_A,
+                                                                  csr_row_ptr_A,
+                                                                  csr_col_ind_A,
+                                                                  descr_B,
+                                                                  nnz_B,
+                                                                  csr_row_ptr_B,
+                                                                  csr_col_ind_B,
+                                                                  descr_C,
+                                                                  nnz_C,
+                                                                  csr_row_ptr_C,
+                                                                  csr_col_ind_C,
+                                                                  info_C,
+                                                                  temp_buffer));
     }
-    else if(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true)
+    else if(csrgemm->mul == false && csrgemm->add == true)
     {
         // C = beta * D
-        return rocsparse_csrgemm_nnz_scal(handle,
-                                          m,
-                                          n,
-                                          descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
-                                          descr_C,
-                                          csr_row_ptr_C,
-                                          nnz_C,
-                                          info_C,
-                                          temp_buffer);
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_symbolic_scal(handle,
+                                                                  m,
+                                                                  n,
+                                                                  descr_D,
+                                                                  nnz_D,
+                                                                  csr_row_ptr_D,
+                                                                  csr_col_ind_D,
+                                                                  descr_C,
+                                                                  nnz_C,
+                                                                  csr_row_ptr_C,
+                                                                  csr_col_ind_C,
+                                                                  info_C,
+                                                                  temp_buffer));
     }
     else
     {
@@ -874,6 +1552,19 @@ extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          hand
         return rocsparse_status_invalid_pointer;
     }
 
+    // Store some data to verify correct execution of the numeric phase
+    csrgemm->m             = m;
+    csrgemm->n             = n;
+    csrgemm->k             = k;
+    csrgemm->nnz_A         = nnz_A;
+    csrgemm->nnz_B         = nnz_B;
+    csrgemm->nnz_D         = nnz_D;
+    csrgemm->nnz_C         = nnz_C;
+    csrgemm->csr_row_ptr_C = csr_row_ptr_C;
+    csrgemm->csr_col_ind_C = csr_col_ind_C;
+
+    csrgemm->symbolic = true;
+
     return rocsparse_status_success;
 }
 
@@ -1314,3 +2005,255 @@ extern "C" rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                h
                                       info_C,
                                       temp_buffer);
 }
+
+extern "C" rocsparse_status rocsparse_scsrgemm_numeric(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             k,
+                                                       const float*              alpha,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       rocsparse_int             nnz_A,
+                                                       const float*              csr_val_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       rocsparse_int             nnz_B,
+                                                       const float*              csr_val_B,
+                                                       const rocsparse_int*      csr_row_ptr_B,
+                                                       const rocsparse_int*      csr_col_ind_B,
+                                                       const float*              beta,
+                                                       const rocsparse_mat_descr descr_D,
+                                                       rocsparse_int             nnz_D,
+                                                       const float*              csr_val_D,
+                                                       const rocsparse_int*      csr_row_ptr_D,
+                                                       const rocsparse_int*      csr_col_ind_D,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       rocsparse_int             nnz_C,
+                                                       float*                    csr_val_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       const rocsparse_int*      csr_col_ind_C,
+                                                       const rocsparse_mat_info  info_C,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_numeric_template(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_val_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              descr_C,
+                                              nnz_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C,
+                                              info_C,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrgemm_numeric(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             k,
+                                                       const double*             alpha,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       rocsparse_int             nnz_A,
+                                                       const double*             csr_val_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       rocsparse_int             nnz_B,
+                                                       const double*             csr_val_B,
+                                                       const rocsparse_int*      csr_row_ptr_B,
+                                                       const rocsparse_int*      csr_col_ind_B,
+                                                       const double*             beta,
+                                                       const rocsparse_mat_descr descr_D,
+                                                       rocsparse_int             nnz_D,
+                                                       const double*             csr_val_D,
+                                                       const rocsparse_int*      csr_row_ptr_D,
+                                                       const rocsparse_int*      csr_col_ind_D,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       rocsparse_int             nnz_C,
+                                                       double*                   csr_val_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       const rocsparse_int*      csr_col_ind_C,
+                                                       const rocsparse_mat_info  info_C,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_numeric_template(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_val_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              descr_C,
+                                              nnz_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C,
+                                              info_C,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrgemm_numeric(rocsparse_handle               handle,
+                                                       rocsparse_operation            trans_A,
+                                                       rocsparse_operation            trans_B,
+                                                       rocsparse_int                  m,
+                                                       rocsparse_int                  n,
+                                                       rocsparse_int                  k,
+                                                       const rocsparse_float_complex* alpha,
+                                                       const rocsparse_mat_descr      descr_A,
+                                                       rocsparse_int                  nnz_A,
+                                                       const rocsparse_float_complex* csr_val_A,
+                                                       const rocsparse_int*           csr_row_ptr_A,
+                                                       const rocsparse_int*           csr_col_ind_A,
+                                                       const rocsparse_mat_descr      descr_B,
+                                                       rocsparse_int                  nnz_B,
+                                                       const rocsparse_float_complex* csr_val_B,
+                                                       const rocsparse_int*           csr_row_ptr_B,
+                                                       const rocsparse_int*           csr_col_ind_B,
+                                                       const rocsparse_float_complex* beta,
+                                                       const rocsparse_mat_descr      descr_D,
+                                                       rocsparse_int                  nnz_D,
+                                                       const rocsparse_float_complex* csr_val_D,
+                                                       const rocsparse_int*           csr_row_ptr_D,
+                                                       const rocsparse_int*           csr_col_ind_D,
+                                                       const rocsparse_mat_descr      descr_C,
+                                                       rocsparse_int                  nnz_C,
+                                                       rocsparse_float_complex*       csr_val_C,
+                                                       const rocsparse_int*           csr_row_ptr_C,
+                                                       const rocsparse_int*           csr_col_ind_C,
+                                                       const rocsparse_mat_info       info_C,
+                                                       void*                          temp_buffer)
+{
+    return rocsparse_csrgemm_numeric_template(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_val_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              descr_C,
+                                              nnz_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C,
+                                              info_C,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrgemm_numeric(rocsparse_handle                handle,
+                                                       rocsparse_operation             trans_A,
+                                                       rocsparse_operation             trans_B,
+                                                       rocsparse_int                   m,
+                                                       rocsparse_int                   n,
+                                                       rocsparse_int                   k,
+                                                       const rocsparse_double_complex* alpha,
+                                                       const rocsparse_mat_descr       descr_A,
+                                                       rocsparse_int                   nnz_A,
+                                                       const rocsparse_double_complex* csr_val_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       rocsparse_int             nnz_B,
+                                                       const rocsparse_double_complex* csr_val_B,
+                                                       const rocsparse_int* csr_row_ptr_B,
+                                                       const rocsparse_int* csr_col_ind_B,
+                                                       const rocsparse_double_complex* beta,
+                                                       const rocsparse_mat_descr       descr_D,
+                                                       rocsparse_int                   nnz_D,
+                                                       const rocsparse_double_complex* csr_val_D,
+                                                       const rocsparse_int*      csr_row_ptr_D,
+                                                       const rocsparse_int*      csr_col_ind_D,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       rocsparse_int             nnz_C,
+                                                       rocsparse_double_complex* csr_val_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       const rocsparse_int*      csr_col_ind_C,
+                                                       const rocsparse_mat_info  info_C,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_numeric_template(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_val_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              descr_C,
+                                              nnz_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C,
+                                              info_C,
+                                              temp_buffer);
+}
@@ -33,7 +33,6 @@
 #include <rocprim/rocprim.hpp>
 #include <type_traits>
 
-#define CSRGEMM_MAXGROUPS 8
 #define CSRGEMM_NNZ_HASH 79
 #define CSRGEMM_FLL_HASH 137
 
@@ -493,6 +492,9 @@ rocsparse_status rocsparse_csrgemm_mult_buffer_size_template(rocsparse_handle
     *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
     *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
 
+    // Workspace for rows with more than 8192 intermediate products
+    *buffer_size += ((sizeof(rocsparse_int) * nnz_A - 1) / 256 + 1) * 256;
+
     return rocsparse_status_success;
 }
 
@@ -2185,4 +2187,882 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int ROWSIZE,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_wf_per_row(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ offset,
+                                    const rocsparse_int* __restrict__ perm,
+                                    U alpha_device_host,
+                                    const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                    const rocsparse_int* __restrict__ csr_col_ind_A,
+                                    const T* __restrict__ csr_val_A,
+                                    const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                    const rocsparse_int* __restrict__ csr_col_ind_B,
+                                    const T* __restrict__ csr_val_B,
+                                    const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                    const rocsparse_int* __restrict__ csr_col_ind_C,
+                                    T* __restrict__ csr_val_C,
+                                    rocsparse_index_base idx_base_A,
+                                    rocsparse_index_base idx_base_B,
+                                    rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrgemm_numeric_wf_per_row_device<T, BLOCKSIZE, WFSIZE, ROWSIZE>(m,
+                                                                     offset,
+                                                                     perm,
+                                                                     alpha,
+                                                                     csr_row_ptr_A,
+                                                                     csr_col_ind_A,
+                                                                     csr_val_A,
+                                                                     csr_row_ptr_B,
+                                                                     csr_col_ind_B,
+                                                                     csr_val_B,
+                                                                     csr_row_ptr_C,
+                                                                     csr_col_ind_C,
+                                                                     csr_val_C,
+                                                                     idx_base_A,
+                                                                     idx_base_B,
+                                                                     idx_base_C);
+}
+
+template <typename T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int ROWSIZE,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_block_per_row(const rocsparse_int* __restrict__ offset,
+                                       const rocsparse_int* __restrict__ perm,
+                                       U alpha_device_host,
+                                       const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                       const rocsparse_int* __restrict__ csr_col_ind_A,
+                                       const T* __restrict__ csr_val_A,
+                                       const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                       const rocsparse_int* __restrict__ csr_col_ind_B,
+                                       const T* __restrict__ csr_val_B,
+                                       const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                       const rocsparse_int* __restrict__ csr_col_ind_C,
+                                       T* __restrict__ csr_val_C,
+                                       rocsparse_index_base idx_base_A,
+                                       rocsparse_index_base idx_base_B,
+                                       rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrgemm_numeric_block_per_row_device<T, BLOCKSIZE, WFSIZE, ROWSIZE>(offset,
+                                                                        perm,
+                                                                        alpha,
+                                                                        csr_row_ptr_A,
+                                                                        csr_col_ind_A,
+                                                                        csr_val_A,
+                                                                        csr_row_ptr_B,
+                                                                        csr_col_ind_B,
+                                                                        csr_val_B,
+                                                                        csr_row_ptr_C,
+                                                                        csr_col_ind_C,
+                                                                        csr_val_C,
+                                                                        idx_base_A,
+                                                                        idx_base_B,
+                                                                        idx_base_C);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_block_per_row_global(const rocsparse_int* __restrict__ offset,
+                                              const rocsparse_int* __restrict__ perm,
+                                              U alpha_device_host,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ csr_col_ind_A,
+                                              const T* __restrict__ csr_val_A,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                              const rocsparse_int* __restrict__ csr_col_ind_B,
+                                              const T* __restrict__ csr_val_B,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                              const rocsparse_int* __restrict__ csr_col_ind_C,
+                                              T* __restrict__ csr_val_C,
+                                              rocsparse_index_base idx_base_A,
+                                              rocsparse_index_base idx_base_B,
+                                              rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrgemm_numeric_block_per_row_global_device<T, BLOCKSIZE, WFSIZE>(offset,
+                                                                      perm,
+                                                                      alpha,
+                                                                      csr_row_ptr_A,
+                                                                      csr_col_ind_A,
+                                                                      csr_val_A,
+                                                                      csr_row_ptr_B,
+                                                                      csr_col_ind_B,
+                                                                      csr_val_B,
+                                                                      csr_row_ptr_C,
+                                                                      csr_col_ind_C,
+                                                                      csr_val_C,
+                                                                      idx_base_A,
+                                                                      idx_base_B,
+                                                                      idx_base_C);
+}
+
+// Rows with up to 4096 non-zero entries are accumulated in shared memory, except for
+// rocsparse_double_complex, as required size would exceed available memory
+template <typename T,
+          typename U,
+          typename std::enable_if<std::is_same<T, rocsparse_double_complex>::value, int>::type = 0>
+inline void csrgemm_numeric_launcher(hipStream_t          stream,
+                                     rocsparse_int        group_size,
+                                     const rocsparse_int* group_offset,
+                                     const rocsparse_int* perm,
+                                     U                    alpha_device_host,
+                                     const rocsparse_int* csr_row_ptr_A,
+                                     const rocsparse_int* csr_col_ind_A,
+                                     const T*             csr_val_A,
+                                     const rocsparse_int* csr_row_ptr_B,
+                                     const rocsparse_int* csr_col_ind_B,
+                                     const T*             csr_val_B,
+                                     const rocsparse_int* csr_row_ptr_C,
+                                     const rocsparse_int* csr_col_ind_C,
+                                     T*                   csr_val_C,
+                                     rocsparse_index_base base_A,
+                                     rocsparse_index_base base_B,
+                                     rocsparse_index_base base_C)
+{
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+    hipLaunchKernelGGL((csrgemm_numeric_block_per_row_global<T, CSRGEMM_DIM, CSRGEMM_SUB>),
+                       dim3(group_size),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       group_offset,
+                       perm,
+                       alpha_device_host,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_val_B,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       base_A,
+                       base_B,
+                       base_C);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+}
+
+template <typename T,
+          typename U,
+          typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value
+                                      || std::is_same<T, rocsparse_float_complex>::value,
+                                  int>::type
+          = 0>
+inline void csrgemm_numeric_launcher(hipStream_t          stream,
+                                     rocsparse_int        group_size,
+                                     const rocsparse_int* group_offset,
+                                     const rocsparse_int* perm,
+                                     U                    alpha_device_host,
+                                     const rocsparse_int* csr_row_ptr_A,
+                                     const rocsparse_int* csr_col_ind_A,
+                                     const T*             csr_val_A,
+                                     const rocsparse_int* csr_row_ptr_B,
+                                     const rocsparse_int* csr_col_ind_B,
+                                     const T*             csr_val_B,
+                                     const rocsparse_int* csr_row_ptr_C,
+                                     const rocsparse_int* csr_col_ind_C,
+                                     T*                   csr_val_C,
+                                     rocsparse_index_base base_A,
+                                     rocsparse_index_base base_B,
+                                     rocsparse_index_base base_C)
+{
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_ROWSIZE 4096
+    hipLaunchKernelGGL(
+        (csrgemm_numeric_block_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+        dim3(group_size),
+        dim3(CSRGEMM_DIM),
+        0,
+        stream,
+        group_offset,
+        perm,
+        alpha_device_host,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        base_A,
+        base_B,
+        base_C);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrgemm_numeric_dispatch(rocsparse_handle          handle,
+                                                    U                         alpha_device_host,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    const T*                  csr_val_A,
+                                                    const rocsparse_int*      csr_row_ptr_A,
+                                                    const rocsparse_int*      csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    const T*                  csr_val_B,
+                                                    const rocsparse_int*      csr_row_ptr_B,
+                                                    const rocsparse_int*      csr_col_ind_B,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    const rocsparse_int*      csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Symbolic data
+    const rocsparse_int* h_group_size   = info_C->csrgemm_info->group_size;
+    const rocsparse_int* d_group_offset = info_C->csrgemm_info->group_offset;
+    const rocsparse_int* d_perm         = info_C->csrgemm_info->perm;
+
+    // The row pattern of C is known, thus each product is accumulated into its position
+    // within the row of C, without any hashing
+
+    // Group 0: 0 - 16 non-zeros per row
+    if(h_group_size[0] > 0)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_ROWSIZE 16
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_wf_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            h_group_size[0],
+            &d_group_offset[0],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 1: 17 - 32 non-zeros per row
+    if(h_group_size[1] > 0)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_ROWSIZE 32
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_wf_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            h_group_size[1],
+            &d_group_offset[1],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 2: 33 - 256 non-zeros per row
+    if(h_group_size[2] > 0)
+    {
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 16
+#define CSRGEMM_ROWSIZE 256
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_block_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3(h_group_size[2]),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            &d_group_offset[2],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 3: 257 - 512 non-zeros per row
+    if(h_group_size[3] > 0)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+#define CSRGEMM_ROWSIZE 512
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_block_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3(h_group_size[3]),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            &d_group_offset[3],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 4: 513 - 1024 non-zeros per row
+    if(h_group_size[4] > 0)
+    {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 32
+#define CSRGEMM_ROWSIZE 1024
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_block_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3(h_group_size[4]),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            &d_group_offset[4],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 5: 1025 - 2048 non-zeros per row
+    if(h_group_size[5] > 0)
+    {
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_ROWSIZE 2048
+        hipLaunchKernelGGL(
+            (csrgemm_numeric_block_per_row<T, CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_ROWSIZE>),
+            dim3(h_group_size[5]),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            &d_group_offset[5],
+            d_perm,
+            alpha_device_host,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_val_B,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_A->base,
+            descr_B->base,
+            descr_C->base);
+#undef CSRGEMM_ROWSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+#ifndef rocsparse_ILP64
+    // Group 6: 2049 - 4096 non-zeros per row
+    if(h_group_size[6] > 0)
+    {
+        csrgemm_numeric_launcher<T>(stream,
+                                    h_group_size[6],
+                                    &d_group_offset[6],
+                                    d_perm,
+                                    alpha_device_host,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    csr_val_A,
+                                    csr_row_ptr_B,
+                                    csr_col_ind_B,
+                                    csr_val_B,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C,
+                                    csr_val_C,
+                                    descr_A->base,
+                                    descr_B->base,
+                                    descr_C->base);
+    }
+#endif
+
+    // Group 7: more than 4096 non-zeros per row
+    if(h_group_size[7] > 0)
+    {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+        hipLaunchKernelGGL((csrgemm_numeric_block_per_row_global<T, CSRGEMM_DIM, CSRGEMM_SUB>),
+                           dim3(h_group_size[7]),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           &d_group_offset[7],
+                           d_perm,
+                           alpha_device_host,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_numeric_mult_template(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const T*                  alpha,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const T*                  csr_val_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         rocsparse_int             nnz_B,
+                                                         const T*                  csr_val_B,
+                                                         const rocsparse_int*      csr_row_ptr_B,
+                                                         const rocsparse_int*      csr_col_ind_B,
+                                                         const rocsparse_mat_descr descr_C,
+                                                         rocsparse_int             nnz_C,
+                                                         T*                        csr_val_C,
+                                                         const rocsparse_int*      csr_row_ptr_C,
+                                                         const rocsparse_int*      csr_col_ind_C,
+                                                         const rocsparse_mat_info  info_C,
+                                                         void*                     temp_buffer)
+{
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_C < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_val_A == nullptr || csr_row_ptr_A == nullptr
+       || csr_col_ind_A == nullptr || descr_B == nullptr || csr_val_B == nullptr
+       || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr || descr_C == nullptr
+       || csr_val_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr
+       || temp_buffer == nullptr || alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check if symbolic data matches current matrices
+    rocsparse_csrgemm_info csrgemm = info_C->csrgemm_info;
+
+    if(csrgemm->m != m || csrgemm->n != n || csrgemm->k != k || csrgemm->nnz_A != nnz_A
+       || csrgemm->nnz_B != nnz_B || csrgemm->nnz_C != nnz_C)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(csrgemm->csr_row_ptr_C != csr_row_ptr_C || csrgemm->csr_col_ind_C != csr_col_ind_C)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0 || nnz_C == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrgemm_numeric_dispatch(handle,
+                                                  alpha,
+                                                  descr_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C);
+    }
+    else
+    {
+        return rocsparse_csrgemm_numeric_dispatch(handle,
+                                                  *alpha,
+                                                  descr_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  csr_val_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  descr_C,
+                                                  csr_val_C,
+                                                  csr_row_ptr_C,
+                                                  csr_col_ind_C,
+                                                  info_C);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_numeric_scal_template(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const T*                  beta,
+                                                         const rocsparse_mat_descr descr_D,
+                                                         rocsparse_int             nnz_D,
+                                                         const T*                  csr_val_D,
+                                                         const rocsparse_int*      csr_row_ptr_D,
+                                                         const rocsparse_int*      csr_col_ind_D,
+                                                         const rocsparse_mat_descr descr_C,
+                                                         rocsparse_int             nnz_C,
+                                                         T*                        csr_val_C,
+                                                         const rocsparse_int*      csr_row_ptr_C,
+                                                         const rocsparse_int*      csr_col_ind_C,
+                                                         const rocsparse_mat_info  info_C,
+                                                         void*                     temp_buffer)
+{
+    // Check valid sizes
+    if(m < 0 || n < 0 || nnz_D < 0 || nnz_C < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_D == nullptr || csr_val_D == nullptr || csr_row_ptr_D == nullptr
+       || csr_col_ind_D == nullptr || descr_C == nullptr || csr_val_C == nullptr
+       || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr || temp_buffer == nullptr
+       || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_D->base != rocsparse_index_base_zero && descr_D->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_D->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check if symbolic data matches current matrices
+    rocsparse_csrgemm_info csrgemm = info_C->csrgemm_info;
+
+    if(csrgemm->m != m || csrgemm->n != n || csrgemm->nnz_D != nnz_D || csrgemm->nnz_C != nnz_C)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(csrgemm->csr_row_ptr_C != csr_row_ptr_C || csrgemm->csr_col_ind_C != csr_col_ind_C)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz_D == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The pattern of C equals the pattern of D, thus only the values need to be scaled
+#define CSRGEMM_DIM 1024
+    dim3 csrgemm_blocks((nnz_D - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_threads(CSRGEMM_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrgemm_copy_scale_device_pointer<T, CSRGEMM_DIM>),
+                           csrgemm_blocks,
+                           csrgemm_threads,
+                           0,
+                           stream,
+                           nnz_D,
+                           beta,
+                           csr_val_D,
+                           csr_val_C);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgemm_copy_scale_host_pointer<T, CSRGEMM_DIM>),
+                           csrgemm_blocks,
+                           csrgemm_threads,
+                           0,
+                           stream,
+                           nnz_D,
+                           *beta,
+                           csr_val_D,
+                           csr_val_C);
+    }
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_numeric_template(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    rocsparse_int             nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const rocsparse_int*      csr_row_ptr_A,
+                                                    const rocsparse_int*      csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    rocsparse_int             nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const rocsparse_int*      csr_row_ptr_B,
+                                                    const rocsparse_int*      csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    rocsparse_int             nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const rocsparse_int*      csr_row_ptr_D,
+                                                    const rocsparse_int*      csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    rocsparse_int             nnz_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    const rocsparse_int*      csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_numeric"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)alpha,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)beta,
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              nnz_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info, holding the symbolic data
+    if(info_C->csrgemm_info == nullptr || info_C->csrgemm_info->symbolic == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Either mult, add or multadd need to be performed
+    if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
+    {
+        // C = alpha * A * B + beta * D
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
+    {
+        // C = alpha * A * B
+        return rocsparse_csrgemm_numeric_mult_template<T>(handle,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          descr_A,
+                                                          nnz_A,
+                                                          csr_val_A,
+                                                          csr_row_ptr_A,
+                                                          csr_col_ind_A,
+                                                          descr_B,
+                                                          nnz_B,
+                                                          csr_val_B,
+                                                          csr_row_ptr_B,
+                                                          csr_col_ind_B,
+                                                          descr_C,
+                                                          nnz_C,
+                                                          csr_val_C,
+                                                          csr_row_ptr_C,
+                                                          csr_col_ind_C,
+                                                          info_C,
+                                                          temp_buffer);
+    }
+    else if(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true)
+    {
+        // C = beta * D
+        return rocsparse_csrgemm_numeric_scal_template<T>(handle,
+                                                          m,
+                                                          n,
+                                                          beta,
+                                                          descr_D,
+                                                          nnz_D,
+                                                          csr_val_D,
+                                                          csr_row_ptr_D,
+                                                          csr_col_ind_D,
+                                                          descr_C,
+                                                          nnz_C,
+                                                          csr_val_C,
+                                                          csr_row_ptr_C,
+                                                          csr_col_ind_C,
+                                                          info_C,
+                                                          temp_buffer);
+    }
+    else
+    {
+        // C = 0
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSRGEMM_HPP
@@ -205,6 +205,22 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
     }
 
+    // Clean up transposed pattern
+    if(info->csc_col_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_col_ptr));
+    }
+
+    if(info->csc_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_row_ind));
+    }
+
+    if(info->csc_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_perm));
+    }
+
     // Destruct
     try
     {
@@ -218,8 +234,73 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
 }
 
 /********************************************************************************
- * \brief rocsparse_trm_info is a structure holding the rocsparse bsrsv, csrsv,
- * csrsm, csrilu0 and csric0 data gathered during csrsv_analysis,
+ * \brief rocsparse_csrmspv_info is a structure holding the rocsparse csrmspv info
+ * data gathered during csrmspv_analysis. It must be initialized using the
+ * rocsparse_create_csrmspv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrmspv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmspv_info(rocsparse_csrmspv_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrmspv_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csrmspv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmspv_info(rocsparse_csrmspv_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up transposed pattern
+    if(info->csc_col_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_col_ptr));
+    }
+
+    if(info->csc_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_row_ind));
+    }
+
+    if(info->csc_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csc_perm));
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_trm_info is a structure holding the rocsparse bsrsv, bsrsm,
+ * csrsv, csrsm, csrilu0 and csric0 data gathered during csrsv_analysis,
  * csrilu0_analysis and csric0_analysis. It must be initialized using the
  * rocsparse_create_trm_info() routine. It should be destroyed at the end
  * using rocsparse_destroy_trm_info().
@@ -320,6 +401,14 @@ bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_inf
         ++shared;
     if(trm == info->bsrsvt_upper_info)
         ++shared;
+    if(trm == info->bsrsm_lower_info)
+        ++shared;
+    if(trm == info->bsrsm_upper_info)
+        ++shared;
+    if(trm == info->bsrsmt_lower_info)
+        ++shared;
+    if(trm == info->bsrsmt_upper_info)
+        ++shared;
     if(trm == info->bsrilu0_info)
         ++shared;
     if(trm == info->bsric0_info)
@@ -381,6 +470,19 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
         return rocsparse_status_success;
     }
 
+    // Clear symbolic arrays
+    if(info->group_offset != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->group_offset));
+        info->group_offset = nullptr;
+    }
+
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->perm));
+        info->perm = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -36,6 +36,7 @@
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
 typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
+typedef struct _rocsparse_csrmspv_info* rocsparse_csrmspv_info;
 typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
 
 /********************************************************************************
@@ -135,6 +136,9 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void*          coo_val     = nullptr;
+
+    // ELL and COO arrays are owned by the user (see rocsparse_csr2hyb_ex)
+    bool user_storage = false;
 };
 
 /********************************************************************************
@@ -151,10 +155,15 @@ struct _rocsparse_mat_info
     rocsparse_trm_info bsrsv_lower_info  = nullptr;
     rocsparse_trm_info bsrsvt_upper_info = nullptr;
     rocsparse_trm_info bsrsvt_lower_info = nullptr;
+    rocsparse_trm_info bsrsm_upper_info  = nullptr;
+    rocsparse_trm_info bsrsm_lower_info  = nullptr;
+    rocsparse_trm_info bsrsmt_upper_info = nullptr;
+    rocsparse_trm_info bsrsmt_lower_info = nullptr;
     rocsparse_trm_info bsric0_info       = nullptr;
     rocsparse_trm_info bsrilu0_info      = nullptr;
 
     rocsparse_csrmv_info   csrmv_info        = nullptr;
+    rocsparse_csrmspv_info csrmspv_info      = nullptr;
     rocsparse_trm_info     csric0_info       = nullptr;
     rocsparse_trm_info     csrilu0_info      = nullptr;
     rocsparse_trm_info     csrsv_upper_info  = nullptr;
@@ -167,7 +176,7 @@ struct _rocsparse_mat_info
     rocsparse_trm_info     csrsmt_lower_info = nullptr;
     rocsparse_csrgemm_info csrgemm_info      = nullptr;
 
-    // zero pivot for csrsv, csrsm, csrilu0, csric0
+    // zero pivot for bsrsv, bsrsm, csrsv, csrsm, csrilu0, csric0
     rocsparse_int* zero_pivot = nullptr;
 
     // numeric boost for ilu0
@@ -190,6 +199,12 @@ struct _rocsparse_csrmv_info
     // row blocks
     unsigned long long* row_blocks = nullptr;
 
+    // device arrays to hold the transposed (CSC) pattern for trans != none
+    rocsparse_int* csc_col_ptr = nullptr;
+    rocsparse_int* csc_row_ind = nullptr;
+    // device array to hold the permutation into the CSR value array
+    rocsparse_int* csc_perm = nullptr;
+
     // some data to verify correct execution
     rocsparse_operation         trans;
     rocsparse_int               m;
@@ -213,6 +228,42 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info);
 
+/********************************************************************************
+ * \brief rocsparse_csrmspv_info is a structure holding the rocsparse csrmspv info
+ * data gathered during csrmspv_analysis. It must be initialized using the
+ * rocsparse_create_csrmspv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrmspv_info().
+ *******************************************************************************/
+struct _rocsparse_csrmspv_info
+{
+    // device arrays to hold the transposed (CSC) pattern
+    rocsparse_int* csc_col_ptr = nullptr;
+    rocsparse_int* csc_row_ind = nullptr;
+    // device array to hold the permutation into the CSR value array
+    rocsparse_int* csc_perm = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int               m;
+    rocsparse_int               n;
+    rocsparse_int               nnz;
+    const _rocsparse_mat_descr* descr;
+    const rocsparse_int*        csr_row_ptr;
+    const rocsparse_int*        csr_col_ind;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrmspv_info is a structure holding the rocsparse csrmspv info
+ * data gathered during csrmspv_analysis. It must be initialized using the
+ * rocsparse_create_csrmspv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrmspv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmspv_info(rocsparse_csrmspv_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrmspv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmspv_info(rocsparse_csrmspv_info info);
+
 struct _rocsparse_trm_info
 {
     // maximum non-zero entries per row
@@ -255,11 +306,14 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info);
  *******************************************************************************/
 bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_info trm);
 
+// Number of row groups used by csrgemm
+#define CSRGEMM_MAXGROUPS 8
+
 /********************************************************************************
  * \brief rocsparse_csrgemm_info is a structure holding the rocsparse csrgemm
- * info data gathered during csrgemm_buffer_size. It must be initialized using
- * the rocsparse_create_csrgemm_info() routine. It should be destroyed at the
- * end using rocsparse_destroy_csrgemm_info().
+ * info data gathered during csrgemm_buffer_size and csrgemm_symbolic. It must
+ * be initialized using the rocsparse_create_csrgemm_info() routine. It should be
+ * destroyed at the end using rocsparse_destroy_csrgemm_info().
  *******************************************************************************/
 struct _rocsparse_csrgemm_info
 {
@@ -267,6 +321,27 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+
+    // Symbolic data gathered during csrgemm_symbolic
+    bool symbolic = false;
+
+    // number of rows of C in each row group (host)
+    rocsparse_int group_size[CSRGEMM_MAXGROUPS];
+    // device array to hold the row group offsets
+    rocsparse_int* group_offset = nullptr;
+    // device array to hold the row permutation (sorted by row groups)
+    rocsparse_int* perm = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int        m;
+    rocsparse_int        n;
+    rocsparse_int        k;
+    rocsparse_int        nnz_A;
+    rocsparse_int        nnz_B;
+    rocsparse_int        nnz_D;
+    rocsparse_int        nnz_C;
+    const rocsparse_int* csr_row_ptr_C;
+    const rocsparse_int* csr_col_ind_C;
 };
 
 /********************************************************************************
@@ -158,6 +158,46 @@ catch(...)
     return rocsparse_status_internal_error;
 }
 
+// Contributions of the stored triangle T and the diagonal D of a symmetric
+// (T + D + T^T), Hermitian (T + D + T^H) or triangular (T + D) matrix to op(A) * x.
+// The row part multiplies the entries of T with x at their column index and adds the
+// result to their row index, the column part does the opposite.
+struct rocsparse_matrix_parts
+{
+    bool row;
+    bool row_conj;
+    bool col;
+    bool col_conj;
+    bool diag_conj;
+};
+
+static inline rocsparse_matrix_parts rocsparse_get_matrix_parts(rocsparse_matrix_type type,
+                                                                rocsparse_operation   trans)
+{
+    bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+    switch(type)
+    {
+    case rocsparse_matrix_type_symmetric:
+        return {true, conj, true, conj, conj};
+    case rocsparse_matrix_type_hermitian:
+        return {true,
+                trans == rocsparse_operation_transpose,
+                true,
+                trans != rocsparse_operation_transpose,
+                false};
+    case rocsparse_matrix_type_triangular:
+        if(trans == rocsparse_operation_none)
+        {
+            return {true, false, false, false, false};
+        }
+
+        return {false, false, true, conj, conj};
+    default:
+        return {true, false, false, false, false};
+    }
+}
+
 // For host scalars
 template <typename T>
 __forceinline__ __device__ __host__ T load_scalar_device_host(T x)
@@ -0,0 +1,282 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_spaxpy.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spaxpy_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_int    nnz_x,
+                                                         rocsparse_int    nnz_y,
+                                                         size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_spaxpy_buffer_size", nnz_x, nnz_y, (const void*&)buffer_size);
+
+    // Check sizes
+    if(nnz_x < 0 || nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check invalid buffer size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Offset array
+    *buffer_size = sizeof(rocsparse_int) * (nnz_x / 256 + 1) * 256;
+
+    // Exclusive scan
+    size_t         rocprim_size;
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                ptr,
+                                                ptr,
+                                                0,
+                                                nnz_x + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_spaxpy_nnz(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz_x,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        nnz_y,
+                                                 const rocsparse_int* y_ind,
+                                                 rocsparse_int*       nnz_z,
+                                                 rocsparse_index_base idx_base,
+                                                 void*                temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spaxpy_nnz",
+              nnz_x,
+              (const void*&)x_ind,
+              nnz_y,
+              (const void*&)y_ind,
+              (const void*&)nnz_z,
+              idx_base,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz_x < 0 || nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz_z pointer
+    if(nnz_z == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(nnz_x == 0 || nnz_y == 0)
+    {
+        rocsparse_int nnz = nnz_x + nnz_y;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(nnz_z, &nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+        }
+        else
+        {
+            *nnz_z = nnz;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_ind == nullptr || y_ind == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Determine the number of entries of x that are not part of y
+    rocsparse_int* offset;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spaxpy_offset(handle, nnz_x, x_ind, nnz_y, y_ind, temp_buffer, &offset));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(
+            (spaxpy_nnz_kernel), dim3(1), dim3(1), 0, stream, nnz_x, nnz_y, offset, nnz_z);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_z, offset + nnz_x, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *nnz_z += nnz_y;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sspaxpy(rocsparse_handle     handle,
+                                              rocsparse_int        nnz_x,
+                                              const float*         alpha,
+                                              const float*         x_val,
+                                              const rocsparse_int* x_ind,
+                                              rocsparse_int        nnz_y,
+                                              const float*         y_val,
+                                              const rocsparse_int* y_ind,
+                                              float*               z_val,
+                                              rocsparse_int*       z_ind,
+                                              rocsparse_index_base idx_base,
+                                              void*                temp_buffer)
+{
+    return rocsparse_spaxpy_template(handle,
+                                     nnz_x,
+                                     alpha,
+                                     x_val,
+                                     x_ind,
+                                     nnz_y,
+                                     y_val,
+                                     y_ind,
+                                     z_val,
+                                     z_ind,
+                                     idx_base,
+                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dspaxpy(rocsparse_handle     handle,
+                                              rocsparse_int        nnz_x,
+                                              const double*        alpha,
+                                              const double*        x_val,
+                                              const rocsparse_int* x_ind,
+                                              rocsparse_int        nnz_y,
+                                              const double*        y_val,
+                                              const rocsparse_int* y_ind,
+                                              double*              z_val,
+                                              rocsparse_int*       z_ind,
+                                              rocsparse_index_base idx_base,
+                                              void*                temp_buffer)
+{
+    return rocsparse_spaxpy_template(handle,
+                                     nnz_x,
+                                     alpha,
+                                     x_val,
+                                     x_ind,
+                                     nnz_y,
+                                     y_val,
+                                     y_ind,
+                                     z_val,
+                                     z_ind,
+                                     idx_base,
+                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_cspaxpy(rocsparse_handle               handle,
+                                              rocsparse_int                  nnz_x,
+                                              const rocsparse_float_complex* alpha,
+                                              const rocsparse_float_complex* x_val,
+                                              const rocsparse_int*           x_ind,
+                                              rocsparse_int                  nnz_y,
+                                              const rocsparse_float_complex* y_val,
+                                              const rocsparse_int*           y_ind,
+                                              rocsparse_float_complex*       z_val,
+                                              rocsparse_int*                 z_ind,
+                                              rocsparse_index_base           idx_base,
+                                              void*                          temp_buffer)
+{
+    return rocsparse_spaxpy_template(handle,
+                                     nnz_x,
+                                     alpha,
+                                     x_val,
+                                     x_ind,
+                                     nnz_y,
+                                     y_val,
+                                     y_ind,
+                                     z_val,
+                                     z_ind,
+                                     idx_base,
+                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zspaxpy(rocsparse_handle                handle,
+                                              rocsparse_int                   nnz_x,
+                                              const rocsparse_double_complex* alpha,
+                                              const rocsparse_double_complex* x_val,
+                                              const rocsparse_int*            x_ind,
+                                              rocsparse_int                   nnz_y,
+                                              const rocsparse_double_complex* y_val,
+                                              const rocsparse_int*            y_ind,
+                                              rocsparse_double_complex*       z_val,
+                                              rocsparse_int*                  z_ind,
+                                              rocsparse_index_base            idx_base,
+                                              void*                           temp_buffer)
+{
+    return rocsparse_spaxpy_template(handle,
+                                     nnz_x,
+                                     alpha,
+                                     x_val,
+                                     x_ind,
+                                     nnz_y,
+                                     y_val,
+                                     y_ind,
+                                     z_val,
+                                     z_ind,
+                                     idx_base,
+                                     temp_buffer);
+}
@@ -0,0 +1,312 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPAXPY_HPP
+#define ROCSPARSE_SPAXPY_HPP
+
+#include "definitions.h"
+#include "spaxpy_device.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+#define SPAXPY_DIM 256
+
+// Computes the exclusive scan over all entries of x that are not part of y. The
+// scanned array holds nnz_x + 1 entries, where the last entry is the total count.
+static inline rocsparse_status rocsparse_spaxpy_offset(rocsparse_handle     handle,
+                                                       rocsparse_int        nnz_x,
+                                                       const rocsparse_int* x_ind,
+                                                       rocsparse_int        nnz_y,
+                                                       const rocsparse_int* y_ind,
+                                                       void*                temp_buffer,
+                                                       rocsparse_int**      offset)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Offset array
+    *offset = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (nnz_x / 256 + 1) * 256;
+
+    // rocprim buffer
+    void*  rocprim_buffer = reinterpret_cast<void*>(ptr);
+    size_t rocprim_size;
+
+    hipLaunchKernelGGL((spaxpy_flag_kernel<SPAXPY_DIM>),
+                       dim3(nnz_x / SPAXPY_DIM + 1),
+                       dim3(SPAXPY_DIM),
+                       0,
+                       stream,
+                       nnz_x,
+                       x_ind,
+                       nnz_y,
+                       y_ind,
+                       *offset);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                *offset,
+                                                *offset,
+                                                0,
+                                                nnz_x + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                *offset,
+                                                *offset,
+                                                0,
+                                                nnz_x + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void spaxpy_merge_y_kernel(rocsparse_int        nnz_x,
+                               U                    alpha_device_host,
+                               const T*             x_val,
+                               const rocsparse_int* x_ind,
+                               rocsparse_int        nnz_y,
+                               const T*             y_val,
+                               const rocsparse_int* y_ind,
+                               const rocsparse_int* offset,
+                               T*                   z_val,
+                               rocsparse_int*       z_ind)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    spaxpy_merge_y_device<BLOCKSIZE>(
+        nnz_x, alpha, x_val, x_ind, nnz_y, y_val, y_ind, offset, z_val, z_ind);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void spaxpy_merge_x_kernel(rocsparse_int        nnz_x,
+                               U                    alpha_device_host,
+                               const T*             x_val,
+                               const rocsparse_int* x_ind,
+                               rocsparse_int        nnz_y,
+                               const rocsparse_int* y_ind,
+                               const rocsparse_int* offset,
+                               T*                   z_val,
+                               rocsparse_int*       z_ind)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    spaxpy_merge_x_device<BLOCKSIZE>(
+        nnz_x, alpha, x_val, x_ind, nnz_y, y_ind, offset, z_val, z_ind);
+}
+
+template <typename T>
+rocsparse_status rocsparse_spaxpy_template(rocsparse_handle     handle,
+                                           rocsparse_int        nnz_x,
+                                           const T*             alpha,
+                                           const T*             x_val,
+                                           const rocsparse_int* x_ind,
+                                           rocsparse_int        nnz_y,
+                                           const T*             y_val,
+                                           const rocsparse_int* y_ind,
+                                           T*                   z_val,
+                                           rocsparse_int*       z_ind,
+                                           rocsparse_index_base idx_base,
+                                           void*                temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspaxpy"),
+                  nnz_x,
+                  *alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  (const void*&)z_val,
+                  (const void*&)z_ind,
+                  idx_base,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f spaxpy -r",
+                  replaceX<T>("X"),
+                  "--mtx <vector.mtx> ",
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspaxpy"),
+                  nnz_x,
+                  (const void*&)alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  (const void*&)z_val,
+                  (const void*&)z_ind,
+                  idx_base,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check size
+    if(nnz_x < 0 || nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz_x == 0 && nnz_y == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || z_val == nullptr || z_ind == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_x > 0 && (x_val == nullptr || x_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_y > 0 && (y_val == nullptr || y_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Determine the position of each entry of x in z
+    rocsparse_int* offset;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spaxpy_offset(handle, nnz_x, x_ind, nnz_y, y_ind, temp_buffer, &offset));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(nnz_y > 0)
+        {
+            hipLaunchKernelGGL((spaxpy_merge_y_kernel<SPAXPY_DIM>),
+                               dim3((nnz_y - 1) / SPAXPY_DIM + 1),
+                               dim3(SPAXPY_DIM),
+                               0,
+                               stream,
+                               nnz_x,
+                               alpha,
+                               x_val,
+                               x_ind,
+                               nnz_y,
+                               y_val,
+                               y_ind,
+                               offset,
+                               z_val,
+                               z_ind);
+        }
+
+        if(nnz_x > 0)
+        {
+            hipLaunchKernelGGL((spaxpy_merge_x_kernel<SPAXPY_DIM>),
+                               dim3((nnz_x - 1) / SPAXPY_DIM + 1),
+                               dim3(SPAXPY_DIM),
+                               0,
+                               stream,
+                               nnz_x,
+                               alpha,
+                               x_val,
+                               x_ind,
+                               nnz_y,
+                               y_ind,
+                               offset,
+                               z_val,
+                               z_ind);
+        }
+    }
+    else
+    {
+        if(nnz_y > 0)
+        {
+            hipLaunchKernelGGL((spaxpy_merge_y_kernel<SPAXPY_DIM>),
+                               dim3((nnz_y - 1) / SPAXPY_DIM + 1),
+                               dim3(SPAXPY_DIM),
+                               0,
+                               stream,
+                               nnz_x,
+                               *alpha,
+                               x_val,
+                               x_ind,
+                               nnz_y,
+                               y_val,
+                               y_ind,
+                               offset,
+                               z_val,
+                               z_ind);
+        }
+
+        if(nnz_x > 0)
+        {
+            hipLaunchKernelGGL((spaxpy_merge_x_kernel<SPAXPY_DIM>),
+                               dim3((nnz_x - 1) / SPAXPY_DIM + 1),
+                               dim3(SPAXPY_DIM),
+                               0,
+                               stream,
+                               nnz_x,
+                               *alpha,
+                               x_val,
+                               x_ind,
+                               nnz_y,
+                               y_ind,
+                               offset,
+                               z_val,
+                               z_ind);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SPAXPY_HPP
@@ -0,0 +1,188 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPDOT_HPP
+#define ROCSPARSE_SPDOT_HPP
+#include "utility.h"
+
+#include "definitions.h"
+#include "doti_device.h"
+#include "spdot_device.h"
+
+template <typename T>
+rocsparse_status rocsparse_spdot_template(rocsparse_handle     handle,
+                                          rocsparse_int        nnz_x,
+                                          const T*             x_val,
+                                          const rocsparse_int* x_ind,
+                                          rocsparse_int        nnz_y,
+                                          const T*             y_val,
+                                          const rocsparse_int* y_ind,
+                                          T*                   result,
+                                          rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspdot"),
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  *result,
+                  idx_base);
+
+        log_bench(handle, "./rocsparse-bench -f spdot -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xspdot"),
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  nnz_y,
+                  (const void*&)y_val,
+                  (const void*&)y_ind,
+                  (const void*&)result,
+                  idx_base);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz_x < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check result pointer
+    if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible, the result of an empty dot product is zero
+    if(nnz_x == 0 || nnz_y == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(result, 0, sizeof(T), stream));
+        }
+        else
+        {
+            *result = static_cast<T>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define SPDOT_DIM 256
+    // Get workspace from handle device buffer
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    // Each entry of x is looked up in y by binary search, thus the number of
+    // memory accesses scales with nnz_x * log(nnz_y) instead of the length of
+    // the (dense) vectors
+    hipLaunchKernelGGL((spdot_kernel_part1<T, SPDOT_DIM>),
+                       dim3(SPDOT_DIM),
+                       dim3(SPDOT_DIM),
+                       0,
+                       stream,
+                       nnz_x,
+                       x_val,
+                       x_ind,
+                       nnz_y,
+                       y_val,
+                       y_ind,
+                       workspace);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((doti_kernel_part2<T, SPDOT_DIM>),
+                           dim3(1),
+                           dim3(SPDOT_DIM),
+                           0,
+                           stream,
+                           SPDOT_DIM,
+                           workspace,
+                           result);
+    }
+    else
+    {
+        hipLaunchKernelGGL((doti_kernel_part2<T, SPDOT_DIM>),
+                           dim3(1),
+                           dim3(SPDOT_DIM),
+                           0,
+                           stream,
+                           SPDOT_DIM,
+                           workspace,
+                           nullptr);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef SPDOT_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SPDOT_HPP
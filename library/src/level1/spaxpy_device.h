@@ -0,0 +1,138 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SPAXPY_DEVICE_H
+#define SPAXPY_DEVICE_H
+
+#include "../conversion/coo2csr_device.h"
+#include "common.h"
+
+// Flag all entries of sparse x that do not appear in sparse y
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void spaxpy_flag_kernel(rocsparse_int        nnz_x,
+                                                                const rocsparse_int* x_ind,
+                                                                rocsparse_int        nnz_y,
+                                                                const rocsparse_int* y_ind,
+                                                                rocsparse_int*       flag)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > nnz_x)
+    {
+        return;
+    }
+
+    // Additional entry, such that the exclusive scan yields the total count
+    if(gid == nnz_x)
+    {
+        flag[gid] = 0;
+        return;
+    }
+
+    rocsparse_int key = x_ind[gid];
+    rocsparse_int pos = lower_bound(y_ind, key, 0, nnz_y);
+
+    flag[gid] = (pos < nnz_y && y_ind[pos] == key) ? 0 : 1;
+}
+
+// Obtain number of non-zero entries of z from the scanned flags
+__global__ void spaxpy_nnz_kernel(rocsparse_int        nnz_x,
+                                  rocsparse_int        nnz_y,
+                                  const rocsparse_int* offset,
+                                  rocsparse_int*       nnz_z)
+{
+    *nnz_z = nnz_y + offset[nnz_x];
+}
+
+// Each entry of y is placed in z after all entries of x that are not part of y
+// and have a smaller index. Matching entries of x are merged into y.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void spaxpy_merge_y_device(rocsparse_int        nnz_x,
+                                      T                    alpha,
+                                      const T*             x_val,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const T*             y_val,
+                                      const rocsparse_int* y_ind,
+                                      const rocsparse_int* offset,
+                                      T*                   z_val,
+                                      rocsparse_int*       z_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz_y)
+    {
+        return;
+    }
+
+    rocsparse_int key = y_ind[gid];
+    rocsparse_int pos = lower_bound(x_ind, key, 0, nnz_x);
+    rocsparse_int idx = gid + offset[pos];
+
+    T val = y_val[gid];
+
+    if(pos < nnz_x && x_ind[pos] == key)
+    {
+        val = rocsparse_fma(alpha, x_val[pos], val);
+    }
+
+    z_ind[idx] = key;
+    z_val[idx] = val;
+}
+
+// Each entry of x that is not part of y is placed in z after all entries of y
+// with a smaller index
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void spaxpy_merge_x_device(rocsparse_int        nnz_x,
+                                      T                    alpha,
+                                      const T*             x_val,
+                                      const rocsparse_int* x_ind,
+                                      rocsparse_int        nnz_y,
+                                      const rocsparse_int* y_ind,
+                                      const rocsparse_int* offset,
+                                      T*                   z_val,
+                                      rocsparse_int*       z_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz_x)
+    {
+        return;
+    }
+
+    // Skip entries that have already been merged into y
+    if(offset[gid + 1] == offset[gid])
+    {
+        return;
+    }
+
+    rocsparse_int key = x_ind[gid];
+    rocsparse_int idx = offset[gid] + lower_bound(y_ind, key, 0, nnz_y);
+
+    z_ind[idx] = key;
+    z_val[idx] = alpha * x_val[gid];
+}
+
+#endif // SPAXPY_DEVICE_H
@@ -0,0 +1,72 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SPDOT_DEVICE_H
+#define SPDOT_DEVICE_H
+
+#include "../conversion/coo2csr_device.h"
+#include "common.h"
+
+// Dot product of sparse x and sparse y, where y indices are sorted
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void spdot_kernel_part1(rocsparse_int        nnz_x,
+                                                                const T*             x_val,
+                                                                const rocsparse_int* x_ind,
+                                                                rocsparse_int        nnz_y,
+                                                                const T*             y_val,
+                                                                const rocsparse_int* y_ind,
+                                                                T*                   workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = BLOCKSIZE * hipBlockIdx_x + tid;
+
+    T dot = static_cast<T>(0);
+
+    for(rocsparse_int idx = gid; idx < nnz_x; idx += hipGridDim_x * BLOCKSIZE)
+    {
+        // Both vectors share the same index base, thus no adjustment is required
+        rocsparse_int key = x_ind[idx];
+        rocsparse_int pos = lower_bound(y_ind, key, 0, nnz_y);
+
+        if(pos < nnz_y && y_ind[pos] == key)
+        {
+            dot = rocsparse_fma(y_val[pos], x_val[idx], dot);
+        }
+    }
+
+    __shared__ T sdata[BLOCKSIZE];
+    sdata[tid] = dot;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+#endif // SPDOT_DEVICE_H
@@ -0,0 +1,98 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRDELTAMV_DEVICE_H
+#define CSRDELTAMV_DEVICE_H
+
+#include "../conversion/csr2csrdelta_device.h"
+#include "common.h"
+
+// Delta compressed CSR SpMV for general, non-transposed matrices. Each wavefront
+// processes one row and decodes the column indices on the fly. Since the offsets are
+// relative to the first column of their row, all lanes decode independently.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+static __device__ void csrdeltamvn_device(rocsparse_int m,
+                                          rocsparse_int block_dim,
+                                          T             alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const T* __restrict__ csr_val,
+                                          const rocsparse_int* __restrict__ csrdelta_block_ptr,
+                                          const rocsparse_int* __restrict__ csrdelta_width,
+                                          const rocsparse_int* __restrict__ csrdelta_row_col,
+                                          const rocsparse_int* __restrict__ csrdelta_col_ind,
+                                          const T* __restrict__ x,
+                                          T beta,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Packed offsets of the block of rows
+        rocsparse_int b           = row / block_dim;
+        rocsparse_int width       = csrdelta_width[b];
+        rocsparse_int block_begin = csr_row_ptr[b * block_dim] - idx_base;
+        rocsparse_int first       = csrdelta_row_col[row] - idx_base;
+
+        const rocsparse_int* words = csrdelta_col_ind + csrdelta_block_ptr[b] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = first + csrdelta_load_offset(words, width, j - block_begin);
+
+            sum = rocsparse_fma(alpha * csr_val[j], rocsparse_ldg(x + col), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+#endif // CSRDELTAMV_DEVICE_H
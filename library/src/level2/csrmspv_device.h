@@ -0,0 +1,118 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMSPV_DEVICE_H
+#define CSRMSPV_DEVICE_H
+
+#include "common.h"
+
+// Scale dense y by beta. If beta is zero, y is set to zero, such that y does not
+// need to be initialized.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void csrmspv_scale_device(rocsparse_int size, T beta, T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        y[gid] = static_cast<T>(0);
+    }
+    else
+    {
+        y[gid] *= beta;
+    }
+}
+
+// Push-style sparse matrix sparse vector multiplication. Each sub-wavefront picks
+// one non-zero entry x_k of the sparse vector and scatters alpha * x_k times the
+// corresponding compressed vector of the matrix into y. If PERM is set, the
+// matrix values are accessed through the permutation obtained in the analysis.
+// If CONJ is set, the matrix values are conjugated. Contributions are merged with
+// atomics rather than by sorting them into row buckets, since the push kernel is
+// only selected when few entries of y are touched and requires no temporary storage.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool PERM, bool CONJ, typename T>
+__device__ void csrmspv_push_device(rocsparse_int nnz_x,
+                                    T             alpha,
+                                    const T* __restrict__ x_val,
+                                    const rocsparse_int* __restrict__ x_ind,
+                                    const rocsparse_int* __restrict__ ptr,
+                                    const rocsparse_int* __restrict__ ind,
+                                    const T* __restrict__ val,
+                                    const rocsparse_int* __restrict__ perm,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over non-zero entries of x
+    for(rocsparse_int k = gid / WF_SIZE; k < nnz_x; k += nwf)
+    {
+        rocsparse_int idx   = x_ind[k] - idx_base;
+        T             scale = alpha * x_val[k];
+
+        rocsparse_int start = ptr[idx] - idx_base;
+        rocsparse_int end   = ptr[idx + 1] - idx_base;
+
+        // Scatter the compressed vector into y
+        for(rocsparse_int j = start + lid; j < end; j += WF_SIZE)
+        {
+            T v = PERM ? val[perm[j]] : val[j];
+
+            if(CONJ)
+            {
+                v = rocsparse_conj(v);
+            }
+
+            atomicAdd(&y[ind[j] - idx_base], scale * v);
+        }
+    }
+}
+
+// Gather the conjugated matrix values into the transposed pattern
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void csrmspv_gthr_conj_device(rocsparse_int nnz,
+                                         const T* __restrict__ val,
+                                         const rocsparse_int* __restrict__ perm,
+                                         T* __restrict__ csc_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csc_val[gid] = rocsparse_conj(val[perm[gid]]);
+}
+
+#endif // CSRMSPV_DEVICE_H
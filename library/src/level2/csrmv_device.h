@@ -78,6 +78,454 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
     }
 }
 
+// Scale y by beta. If beta is zero, y is set to zero, such that y does not need to be
+// initialized.
+template <unsigned int BLOCKSIZE, typename T>
+static __device__ void csrmvt_scale_device(rocsparse_int size, T beta, T* y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        y[gid] = static_cast<T>(0);
+    }
+    else
+    {
+        y[gid] *= beta;
+    }
+}
+
+// Transposed csrmv without analysis. Each wavefront processes one row of A and scatters
+// alpha * x[row] times the (conjugated) row into y using atomics.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool CONJ, typename T>
+static __device__ void csrmvt_general_device(rocsparse_int        m,
+                                             T                    alpha,
+                                             const rocsparse_int* row_offset,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T*             csr_val,
+                                             const T*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T scale = alpha * x[row];
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T val = CONJ ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+            atomicAdd(&y[csr_col_ind[j] - idx_base], scale * val);
+        }
+    }
+}
+
+// Transposed csrmv using the transposed pattern obtained in the analysis. Each wavefront
+// processes one column of A, whose values are accessed through the permutation into the
+// CSR value array, such that no atomics are required.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool CONJ, typename T>
+static __device__ void csrmvt_perm_device(rocsparse_int        n,
+                                          T                    alpha,
+                                          const rocsparse_int* col_offset,
+                                          const rocsparse_int* csc_row_ind,
+                                          const rocsparse_int* csc_perm,
+                                          const T*             csr_val,
+                                          const T*             x,
+                                          T                    beta,
+                                          T*                   y,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over columns
+    for(rocsparse_int col = gid / WF_SIZE; col < n; col += nwf)
+    {
+        // Each wavefront processes one column
+        rocsparse_int col_start = col_offset[col] - idx_base;
+        rocsparse_int col_end   = col_offset[col + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = col_start + lid; j < col_end; j += WF_SIZE)
+        {
+            T val = CONJ ? rocsparse_conj(csr_val[csc_perm[j]]) : csr_val[csc_perm[j]];
+
+            sum = rocsparse_fma(alpha * val, rocsparse_ldg(x + csc_row_ind[j] - idx_base), sum);
+        }
+
+        // Obtain column sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[col] = sum;
+            }
+            else
+            {
+                y[col] = rocsparse_fma(beta, y[col], sum);
+            }
+        }
+    }
+}
+
+// csrmv for symmetric, Hermitian and triangular matrices, where only the triangle given
+// by uplo and the diagonal are read from A. Each wavefront processes one row of op(A),
+// which consists of the row part of the stored row and, if the transposed pattern is
+// available, the column part of the stored column. Without the transposed pattern, the
+// column part has to be scattered by csrmvs_scatter_device afterwards.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+static __device__ void csrmvs_general_device(rocsparse_int          m,
+                                             T                      alpha,
+                                             const rocsparse_int*   row_offset,
+                                             const rocsparse_int*   csr_col_ind,
+                                             const T*               csr_val,
+                                             const rocsparse_int*   col_offset,
+                                             const rocsparse_int*   csc_row_ind,
+                                             const rocsparse_int*   csc_perm,
+                                             const T*               x,
+                                             T                      beta,
+                                             T*                     y,
+                                             rocsparse_matrix_parts parts,
+                                             rocsparse_fill_mode    uplo,
+                                             rocsparse_diag_type    diag,
+                                             rocsparse_index_base   idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Row part and diagonal of the stored row
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col == row)
+            {
+                if(diag == rocsparse_diag_type_non_unit)
+                {
+                    T val = parts.diag_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+                    sum   = rocsparse_fma(alpha * val, x[row], sum);
+                }
+            }
+            else if(parts.row && (lower ? col < row : col > row))
+            {
+                T val = parts.row_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+                sum   = rocsparse_fma(alpha * val, rocsparse_ldg(x + col), sum);
+            }
+        }
+
+        // Column part of the stored column
+        if(parts.col && col_offset != nullptr)
+        {
+            rocsparse_int col_start = col_offset[row] - idx_base;
+            rocsparse_int col_end   = col_offset[row + 1] - idx_base;
+
+            for(rocsparse_int j = col_start + lid; j < col_end; j += WF_SIZE)
+            {
+                rocsparse_int k = csc_row_ind[j] - idx_base;
+
+                if(lower ? k > row : k < row)
+                {
+                    T val = csr_val[csc_perm[j]];
+                    val   = parts.col_conj ? rocsparse_conj(val) : val;
+                    sum   = rocsparse_fma(alpha * val, rocsparse_ldg(x + k), sum);
+                }
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(diag == rocsparse_diag_type_unit)
+            {
+                sum = rocsparse_fma(alpha, x[row], sum);
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// Column part of csrmvs_general_device without the transposed pattern. Each wavefront
+// processes one stored row and scatters it into y using atomics.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+static __device__ void csrmvs_scatter_device(rocsparse_int          m,
+                                             T                      alpha,
+                                             const rocsparse_int*   row_offset,
+                                             const rocsparse_int*   csr_col_ind,
+                                             const T*               csr_val,
+                                             const T*               x,
+                                             T*                     y,
+                                             rocsparse_matrix_parts parts,
+                                             rocsparse_fill_mode    uplo,
+                                             rocsparse_index_base   idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T scale = alpha * x[row];
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(lower ? col < row : col > row)
+            {
+                T val = parts.col_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+                atomicAdd(&y[col], scale * val);
+            }
+        }
+    }
+}
+
+// Merge path search. The row ends and the indices of the non-zero entries are merged into
+// a single sequence of m + nnz items, where the end of a row is taken before a non-zero
+// entry of the same offset. Returns the number of row ends within the first diag items,
+// which is searched for in [row_lo, row_hi].
+static __device__ __forceinline__ rocsparse_int
+    csrmvn_merge_path_search(rocsparse_int        diag,
+                             rocsparse_int        row_lo,
+                             rocsparse_int        row_hi,
+                             rocsparse_int        nnz,
+                             const rocsparse_int* row_offset,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int lo = max(diag - nnz, row_lo);
+    rocsparse_int hi = min(diag, row_hi);
+
+    while(lo < hi)
+    {
+        rocsparse_int pivot = (lo + hi) >> 1;
+
+        if(row_offset[pivot + 1] - idx_base <= diag - pivot - 1)
+        {
+            lo = pivot + 1;
+        }
+        else
+        {
+            hi = pivot;
+        }
+    }
+
+    return lo;
+}
+
+template <typename T>
+static __device__ __forceinline__ void csrmvn_merge_path_store(T beta, T sum, T* y)
+{
+    if(beta == static_cast<T>(0))
+    {
+        *y = sum;
+    }
+    else
+    {
+        *y = rocsparse_fma(beta, *y, sum);
+    }
+}
+
+// Non-transposed csrmv without analysis. Each thread consumes ITEMS_PER_THREAD items of the
+// merged sequence of row ends and non-zero entries, such that the work is balanced
+// independently of the row lengths. Partial sums of rows that span multiple threads are
+// combined by a segmented scan within the block. The partial sum of the last row of each
+// block is written to carry_row and carry_val and added by csrmvn_merge_path_fixup_device.
+template <unsigned int BLOCKSIZE, unsigned int ITEMS_PER_THREAD, typename T>
+static __device__ void csrmvn_merge_path_device(rocsparse_int        m,
+                                                rocsparse_int        nnz,
+                                                T                    alpha,
+                                                const rocsparse_int* row_offset,
+                                                const rocsparse_int* csr_col_ind,
+                                                const T*             csr_val,
+                                                const T*             x,
+                                                T                    beta,
+                                                T*                   y,
+                                                rocsparse_int*       carry_row,
+                                                T*                   carry_val,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int bid = hipBlockIdx_x;
+
+    __shared__ rocsparse_int srow_bound[2];
+    __shared__ rocsparse_int srow[BLOCKSIZE];
+    __shared__ T             ssum[BLOCKSIZE];
+
+    rocsparse_int nitems           = m + nnz;
+    rocsparse_int items_per_thread = ITEMS_PER_THREAD;
+    rocsparse_int items_per_block  = BLOCKSIZE * ITEMS_PER_THREAD;
+
+    // First and last row of the block
+    if(tid < 2)
+    {
+        rocsparse_int diag = min((bid + tid) * items_per_block, nitems);
+
+        srow_bound[tid] = csrmvn_merge_path_search(diag, 0, m, nnz, row_offset, idx_base);
+    }
+
+    __syncthreads();
+
+    // Start of the thread on the merge path
+    rocsparse_int diag     = min(bid * items_per_block + tid * items_per_thread, nitems);
+    rocsparse_int diag_end = min(diag + items_per_thread, nitems);
+
+    rocsparse_int row
+        = csrmvn_merge_path_search(diag, srow_bound[0], srow_bound[1], nnz, row_offset, idx_base);
+    rocsparse_int j = diag - row;
+
+    rocsparse_int first_row = row;
+    rocsparse_int row_end   = (row < m) ? row_offset[row + 1] - idx_base : nnz;
+
+    T sum       = static_cast<T>(0);
+    T first_sum = static_cast<T>(0);
+
+    // Consume the items of the thread
+    for(rocsparse_int k = diag; k < diag_end; ++k)
+    {
+        if(j < row_end)
+        {
+            sum = rocsparse_fma(
+                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+            ++j;
+        }
+        else
+        {
+            // The first row might have been started by preceding threads
+            if(row == first_row)
+            {
+                first_sum = sum;
+            }
+            else
+            {
+                csrmvn_merge_path_store(beta, sum, &y[row]);
+            }
+
+            sum = static_cast<T>(0);
+            ++row;
+            row_end = (row < m) ? row_offset[row + 1] - idx_base : nnz;
+        }
+    }
+
+    // Segmented inclusive scan over the partial sums of the last row of each thread
+    srow[tid] = row;
+    ssum[tid] = sum;
+
+    __syncthreads();
+
+    for(unsigned int offset = 1; offset < BLOCKSIZE; offset <<= 1)
+    {
+        T partial = (tid >= offset && srow[tid - offset] == row) ? ssum[tid - offset]
+                                                                 : static_cast<T>(0);
+        __syncthreads();
+        ssum[tid] += partial;
+        __syncthreads();
+    }
+
+    // The last row of the preceding thread is the first row of this thread, such that its
+    // scanned partial sum contains all contributions of the block to the first row
+    if(row != first_row)
+    {
+        T carry = (tid > 0) ? ssum[tid - 1] : static_cast<T>(0);
+
+        csrmvn_merge_path_store(beta, first_sum + carry, &y[first_row]);
+    }
+
+    // The last row of the block is completed by subsequent blocks
+    if(tid == BLOCKSIZE - 1)
+    {
+        carry_row[bid] = row;
+        carry_val[bid] = ssum[tid];
+    }
+}
+
+// Add the partial sums of rows that span multiple blocks of csrmvn_merge_path_device. The
+// carries are sorted by row, and the first carry of each row sums up all carries of this
+// row, such that the result does not depend on the order of execution.
+template <unsigned int BLOCKSIZE, typename T>
+static __device__ void csrmvn_merge_path_fixup_device(rocsparse_int        m,
+                                                      rocsparse_int        nblocks,
+                                                      const rocsparse_int* carry_row,
+                                                      const T*             carry_val,
+                                                      T*                   y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nblocks)
+    {
+        return;
+    }
+
+    rocsparse_int row = carry_row[gid];
+
+    if(row >= m || (gid > 0 && carry_row[gid - 1] == row))
+    {
+        return;
+    }
+
+    T sum = carry_val[gid];
+
+    for(rocsparse_int i = gid + 1; i < nblocks && carry_row[i] == row; ++i)
+    {
+        sum += carry_val[i];
+    }
+
+    y[row] += sum;
+}
+
 template <typename T>
 static inline __device__ T sum2_reduce(
     T cur_sum, T* partial, rocsparse_int lid, rocsparse_int max_size, rocsparse_int reduc_size)
@@ -43,6 +43,25 @@ rocsparse_status rocsparse_bsrmv_template_dispatch(rocsparse_handle          han
                                                    U                         beta_device_host,
                                                    T*                        y)
 {
+    // Symmetric, Hermitian and triangular matrices
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        bsrmvs_general(handle,
+                       dir,
+                       trans,
+                       mb,
+                       alpha_device_host,
+                       descr,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       x,
+                       beta_device_host,
+                       y);
+
+        return rocsparse_status_success;
+    }
 
     // Run different bsrmv kernels
     if(trans == rocsparse_operation_none)
@@ -289,18 +308,18 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_value;
     }
 
-    if(descr->type != rocsparse_matrix_type_general)
+    //
+    // Check sizes
+    //
+    if(mb < 0 || nb < 0 || nnzb < 0 || bsr_dim < 0)
     {
-        //
-        // TODO ?
-        //
-        return rocsparse_status_not_implemented;
+        return rocsparse_status_invalid_size;
     }
 
     //
-    // Check sizes
+    // Symmetric, Hermitian and triangular matrices have to be square
     //
-    if(mb < 0 || nb < 0 || nnzb < 0 || bsr_dim < 0)
+    if(descr->type != rocsparse_matrix_type_general && mb != nb)
     {
         return rocsparse_status_invalid_size;
     }
@@ -145,4 +145,22 @@ void bsrmvn_general(rocsparse_handle     handle,
                     T*                   y,
                     rocsparse_index_base base);
 
+// BSRMV for symmetric, Hermitian and triangular matrices that works for any BSR block
+// dimensions, where only the triangle of the expanded matrix given by the fill mode of
+// descr and its diagonal are read
+template <typename T, typename U>
+void bsrmvs_general(rocsparse_handle          handle,
+                    rocsparse_direction       dir,
+                    rocsparse_operation       trans,
+                    rocsparse_int             mb,
+                    U                         alpha_device_host,
+                    const rocsparse_mat_descr descr,
+                    const rocsparse_int*      bsr_row_ptr,
+                    const rocsparse_int*      bsr_col_ind,
+                    const T*                  bsr_val,
+                    rocsparse_int             bsr_dim,
+                    const T*                  x,
+                    U                         beta_device_host,
+                    T*                        y);
+
 #endif // ROCSPARSE_BSRMV_HPP
@@ -0,0 +1,393 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_bsrmv_spzl.hpp"
+
+// BSRMV for symmetric, Hermitian and triangular matrices. The matrix is treated as the
+// expanded scalar matrix, such that the stored triangle may cut through the diagonal
+// blocks. Each thread block processes a BSR row and each wavefront a row of the BSR
+// block, which accumulates the row part and the diagonal.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void bsrmvs_general_device(rocsparse_direction dir,
+                                      T                   alpha,
+                                      const rocsparse_int* __restrict__ bsr_row_ptr,
+                                      const rocsparse_int* __restrict__ bsr_col_ind,
+                                      const T* __restrict__ bsr_val,
+                                      rocsparse_int bsr_dim,
+                                      const T* __restrict__ x,
+                                      T beta,
+                                      T* __restrict__ y,
+                                      rocsparse_matrix_parts parts,
+                                      rocsparse_fill_mode    uplo,
+                                      rocsparse_diag_type    diag,
+                                      rocsparse_index_base   idx_base)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each thread block processes a BSR row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // BSR row entry and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    // Loop over the rows of the BSR block in chunks of WFSIZE, such that each
+    // wavefront will process a row
+    for(rocsparse_int bi = wid; bi < bsr_dim; bi += WFSIZE)
+    {
+        // Scalar row index
+        rocsparse_int r = row * bsr_dim + bi;
+
+        // BSR block row accumulator
+        T sum = static_cast<T>(0);
+
+        // Loop over all BSR blocks in the current row
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            // BSR column index
+            rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+            // Loop over the columns of the BSR block in chunks of WFSIZE, such that
+            // each lane will process a single value of the BSR block
+            for(rocsparse_int bj = lid; bj < bsr_dim; bj += WFSIZE)
+            {
+                // Scalar column index
+                rocsparse_int c = col * bsr_dim + bj;
+
+                if(c == r)
+                {
+                    if(diag == rocsparse_diag_type_non_unit)
+                    {
+                        T val = bsr_val[BSR_IND(j, bi, bj, dir)];
+                        val   = parts.diag_conj ? rocsparse_conj(val) : val;
+                        sum   = rocsparse_fma(val, x[c], sum);
+                    }
+                }
+                else if(parts.row && (lower ? c < r : c > r))
+                {
+                    T val = bsr_val[BSR_IND(j, bi, bj, dir)];
+                    val   = parts.row_conj ? rocsparse_conj(val) : val;
+                    sum   = rocsparse_fma(val, x[c], sum);
+                }
+            }
+        }
+
+        // Each wavefront accumulates its BSR block row sum
+        sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
+
+        // Last lane of each wavefront writes its result to global memory
+        if(lid == WFSIZE - 1)
+        {
+            if(diag == rocsparse_diag_type_unit)
+            {
+                sum += x[r];
+            }
+
+            if(beta != static_cast<T>(0))
+            {
+                y[r] = rocsparse_fma(beta, y[r], alpha * sum);
+            }
+            else
+            {
+                y[r] = alpha * sum;
+            }
+        }
+    }
+}
+
+// Column part of bsrmvs_general_device. Each lane scatters a single value of the
+// stored triangle into y using atomics.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void bsrmvs_scatter_device(rocsparse_direction dir,
+                                      T                   alpha,
+                                      const rocsparse_int* __restrict__ bsr_row_ptr,
+                                      const rocsparse_int* __restrict__ bsr_col_ind,
+                                      const T* __restrict__ bsr_val,
+                                      rocsparse_int bsr_dim,
+                                      const T* __restrict__ x,
+                                      T* __restrict__ y,
+                                      rocsparse_matrix_parts parts,
+                                      rocsparse_fill_mode    uplo,
+                                      rocsparse_index_base   idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+    rocsparse_int row = hipBlockIdx_x;
+
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    for(rocsparse_int bi = wid; bi < bsr_dim; bi += WFSIZE)
+    {
+        rocsparse_int r = row * bsr_dim + bi;
+
+        T scale = alpha * x[r];
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+            for(rocsparse_int bj = lid; bj < bsr_dim; bj += WFSIZE)
+            {
+                rocsparse_int c = col * bsr_dim + bj;
+
+                if(lower ? c < r : c > r)
+                {
+                    T val = bsr_val[BSR_IND(j, bi, bj, dir)];
+                    val   = parts.col_conj ? rocsparse_conj(val) : val;
+
+                    atomicAdd(&y[c], scale * val);
+                }
+            }
+        }
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvs_general_kernel(rocsparse_direction dir,
+                               U                   alpha_device_host,
+                               const rocsparse_int* __restrict__ bsr_row_ptr,
+                               const rocsparse_int* __restrict__ bsr_col_ind,
+                               const T* __restrict__ bsr_val,
+                               rocsparse_int bsr_dim,
+                               const T* __restrict__ x,
+                               U beta_device_host,
+                               T* __restrict__ y,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_diag_type    diag,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        bsrmvs_general_device<BLOCKSIZE, WFSIZE>(dir,
+                                                 alpha,
+                                                 bsr_row_ptr,
+                                                 bsr_col_ind,
+                                                 bsr_val,
+                                                 bsr_dim,
+                                                 x,
+                                                 beta,
+                                                 y,
+                                                 parts,
+                                                 uplo,
+                                                 diag,
+                                                 idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvs_scatter_kernel(rocsparse_direction dir,
+                               U                   alpha_device_host,
+                               const rocsparse_int* __restrict__ bsr_row_ptr,
+                               const rocsparse_int* __restrict__ bsr_col_ind,
+                               const T* __restrict__ bsr_val,
+                               rocsparse_int bsr_dim,
+                               const T* __restrict__ x,
+                               T* __restrict__ y,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        bsrmvs_scatter_device<BLOCKSIZE, WFSIZE>(
+            dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, y, parts, uplo, idx_base);
+    }
+}
+
+template <unsigned int WFSIZE, typename T, typename U>
+static void bsrmvs_launch(rocsparse_handle          handle,
+                          rocsparse_direction       dir,
+                          rocsparse_matrix_parts    parts,
+                          rocsparse_int             mb,
+                          U                         alpha_device_host,
+                          const rocsparse_mat_descr descr,
+                          const rocsparse_int*      bsr_row_ptr,
+                          const rocsparse_int*      bsr_col_ind,
+                          const T*                  bsr_val,
+                          rocsparse_int             bsr_dim,
+                          const T*                  x,
+                          U                         beta_device_host,
+                          T*                        y)
+{
+    hipLaunchKernelGGL((bsrmvs_general_kernel<WFSIZE * WFSIZE, WFSIZE>),
+                       dim3(mb),
+                       dim3(WFSIZE * WFSIZE),
+                       0,
+                       handle->stream,
+                       dir,
+                       alpha_device_host,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       x,
+                       beta_device_host,
+                       y,
+                       parts,
+                       descr->fill_mode,
+                       descr->diag_type,
+                       descr->base);
+
+    // The column part has to be added after the row part has been written
+    if(parts.col)
+    {
+        hipLaunchKernelGGL((bsrmvs_scatter_kernel<WFSIZE * WFSIZE, WFSIZE>),
+                           dim3(mb),
+                           dim3(WFSIZE * WFSIZE),
+                           0,
+                           handle->stream,
+                           dir,
+                           alpha_device_host,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           bsr_dim,
+                           x,
+                           y,
+                           parts,
+                           descr->fill_mode,
+                           descr->base);
+    }
+}
+
+template <typename T, typename U>
+void bsrmvs_general(rocsparse_handle          handle,
+                    rocsparse_direction       dir,
+                    rocsparse_operation       trans,
+                    rocsparse_int             mb,
+                    U                         alpha_device_host,
+                    const rocsparse_mat_descr descr,
+                    const rocsparse_int*      bsr_row_ptr,
+                    const rocsparse_int*      bsr_col_ind,
+                    const T*                  bsr_val,
+                    rocsparse_int             bsr_dim,
+                    const T*                  x,
+                    U                         beta_device_host,
+                    T*                        y)
+{
+    rocsparse_matrix_parts parts = rocsparse_get_matrix_parts(descr->type, trans);
+
+    // Differentiate BSR block dimensions
+    if(bsr_dim <= 8)
+    {
+        bsrmvs_launch<8>(handle,
+                         dir,
+                         parts,
+                         mb,
+                         alpha_device_host,
+                         descr,
+                         bsr_row_ptr,
+                         bsr_col_ind,
+                         bsr_val,
+                         bsr_dim,
+                         x,
+                         beta_device_host,
+                         y);
+    }
+    else if(bsr_dim <= 16)
+    {
+        bsrmvs_launch<16>(handle,
+                          dir,
+                          parts,
+                          mb,
+                          alpha_device_host,
+                          descr,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          bsr_val,
+                          bsr_dim,
+                          x,
+                          beta_device_host,
+                          y);
+    }
+    else
+    {
+        bsrmvs_launch<32>(handle,
+                          dir,
+                          parts,
+                          mb,
+                          alpha_device_host,
+                          descr,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          bsr_val,
+                          bsr_dim,
+                          x,
+                          beta_device_host,
+                          y);
+    }
+}
+
+//
+// INSTANTIATE.
+//
+#define INSTANTIATE(TYPE)                                                     \
+    template void bsrmvs_general(rocsparse_handle          handle,            \
+                                 rocsparse_direction       dir,               \
+                                 rocsparse_operation       trans,             \
+                                 rocsparse_int             mb,                \
+                                 const TYPE*               alpha_device_host, \
+                                 const rocsparse_mat_descr descr,             \
+                                 const rocsparse_int*      bsr_row_ptr,       \
+                                 const rocsparse_int*      bsr_col_ind,       \
+                                 const TYPE*               bsr_val,           \
+                                 rocsparse_int             bsr_dim,           \
+                                 const TYPE*               x,                 \
+                                 const TYPE*               beta_device_host,  \
+                                 TYPE*                     y);                \
+    template void bsrmvs_general(rocsparse_handle          handle,            \
+                                 rocsparse_direction       dir,               \
+                                 rocsparse_operation       trans,             \
+                                 rocsparse_int             mb,                \
+                                 TYPE                      alpha_device_host, \
+                                 const rocsparse_mat_descr descr,             \
+                                 const rocsparse_int*      bsr_row_ptr,       \
+                                 const rocsparse_int*      bsr_col_ind,       \
+                                 const TYPE*               bsr_val,           \
+                                 rocsparse_int             bsr_dim,           \
+                                 const TYPE*               x,                 \
+                                 TYPE                      beta_device_host,  \
+                                 TYPE*                     y)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+
+#undef INSTANTIATE
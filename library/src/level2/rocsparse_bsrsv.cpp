@@ -589,3 +589,61 @@ extern "C" rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_bsrsv_level_info(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       const rocsparse_mat_descr descr,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_level_info*     level_info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_bsrsv_level_info",
+              trans,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)level_info);
+
+    // Check pointer arguments
+    if(level_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    bool lower = (descr->fill_mode == rocsparse_fill_mode_lower);
+
+    // The transposed analysis is performed on the transposed matrix, such that the
+    // triangular part is flipped
+    if(trans == rocsparse_operation_none)
+    {
+        return rocsparse_trm_level_info(handle,
+                                        lower ? info->bsrsv_lower_info : info->bsrsv_upper_info,
+                                        descr->fill_mode,
+                                        level_info);
+    }
+
+    return rocsparse_trm_level_info(handle,
+                                    lower ? info->bsrsvt_lower_info : info->bsrsvt_upper_info,
+                                    lower ? rocsparse_fill_mode_upper : rocsparse_fill_mode_lower,
+                                    level_info);
+}
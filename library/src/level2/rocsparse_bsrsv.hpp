@@ -469,13 +469,19 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            //            // Check for other upper analysis meta data that could be used
-            //            if(trans == rocsparse_operation_none && info->bsrsm_upper_info != nullptr)
-            //            {
-            //                // bsrsm meta data
-            //                info->bsrsv_upper_info = info->bsrsm_upper_info;
-            //                return rocsparse_status_success;
-            //            }
+            // Check for other upper analysis meta data that could be used
+            if(trans == rocsparse_operation_none && info->bsrsm_upper_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsv_upper_info = info->bsrsm_upper_info;
+                return rocsparse_status_success;
+            }
+            else if(trans == rocsparse_operation_transpose && info->bsrsmt_upper_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsvt_upper_info = info->bsrsmt_upper_info;
+                return rocsparse_status_success;
+            }
         }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
@@ -537,12 +543,18 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
                 info->bsrsv_lower_info = info->bsrilu0_info;
                 return rocsparse_status_success;
             }
-            // else if(trans == rocsparse_operation_none && info->bsrsm_lower_info != nullptr)
-            // {
-            //     // bsrsm meta data
-            //     info->bsrsv_lower_info = info->bsrsm_lower_info;
-            //     return rocsparse_status_success;
-            // }
+            else if(trans == rocsparse_operation_none && info->bsrsm_lower_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsv_lower_info = info->bsrsm_lower_info;
+                return rocsparse_status_success;
+            }
+            else if(trans == rocsparse_operation_transpose && info->bsrsmt_lower_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsvt_lower_info = info->bsrsmt_lower_info;
+                return rocsparse_status_success;
+            }
         }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
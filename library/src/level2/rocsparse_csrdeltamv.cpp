@@ -0,0 +1,76 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrdeltamv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                         \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,             \
+                                     rocsparse_operation       trans,              \
+                                     rocsparse_int             m,                  \
+                                     rocsparse_int             n,                  \
+                                     rocsparse_int             nnz,                \
+                                     const TYPE*               alpha,              \
+                                     const rocsparse_mat_descr descr,              \
+                                     const TYPE*               csr_val,            \
+                                     const rocsparse_int*      csr_row_ptr,        \
+                                     rocsparse_int             block_dim,          \
+                                     const rocsparse_int*      csrdelta_block_ptr, \
+                                     const rocsparse_int*      csrdelta_width,     \
+                                     const rocsparse_int*      csrdelta_row_col,   \
+                                     const rocsparse_int*      csrdelta_col_ind,   \
+                                     const TYPE*               x,                  \
+                                     const TYPE*               beta,               \
+                                     TYPE*                     y)                  \
+    {                                                                              \
+        return rocsparse_csrdeltamv_template(handle,                               \
+                                             trans,                                \
+                                             m,                                    \
+                                             n,                                    \
+                                             nnz,                                  \
+                                             alpha,                                \
+                                             descr,                                \
+                                             csr_val,                              \
+                                             csr_row_ptr,                          \
+                                             block_dim,                            \
+                                             csrdelta_block_ptr,                   \
+                                             csrdelta_width,                       \
+                                             csrdelta_row_col,                     \
+                                             csrdelta_col_ind,                     \
+                                             x,                                    \
+                                             beta,                                 \
+                                             y);                                   \
+    }
+
+C_IMPL(rocsparse_scsrdeltamv, float);
+C_IMPL(rocsparse_dcsrdeltamv, double);
+C_IMPL(rocsparse_ccsrdeltamv, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrdeltamv, rocsparse_double_complex);
+
+#undef C_IMPL
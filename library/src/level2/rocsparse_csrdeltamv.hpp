@@ -0,0 +1,314 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRDELTAMV_HPP
+#define ROCSPARSE_CSRDELTAMV_HPP
+
+#include "csrdeltamv_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrdeltamvn_kernel(rocsparse_int m,
+                            rocsparse_int block_dim,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const T* __restrict__ csr_val,
+                            const rocsparse_int* __restrict__ csrdelta_block_ptr,
+                            const rocsparse_int* __restrict__ csrdelta_width,
+                            const rocsparse_int* __restrict__ csrdelta_row_col,
+                            const rocsparse_int* __restrict__ csrdelta_col_ind,
+                            const T* __restrict__ x,
+                            U beta_device_host,
+                            T* __restrict__ y,
+                            rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrdeltamvn_device<BLOCKSIZE, WF_SIZE>(m,
+                                               block_dim,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_val,
+                                               csrdelta_block_ptr,
+                                               csrdelta_width,
+                                               csrdelta_row_col,
+                                               csrdelta_col_ind,
+                                               x,
+                                               beta,
+                                               y,
+                                               idx_base);
+    }
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrdeltamv_dispatch(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               U                         alpha_device_host,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               rocsparse_int             block_dim,
+                                               const rocsparse_int*      csrdelta_block_ptr,
+                                               const rocsparse_int*      csrdelta_width,
+                                               const rocsparse_int*      csrdelta_row_col,
+                                               const rocsparse_int*      csrdelta_col_ind,
+                                               const T*                  x,
+                                               U                         beta_device_host,
+                                               T*                        y)
+{
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    rocsparse_int nnz_per_row = nnz / m;
+
+#define CSRDELTAMVN_DIM 512
+#define CSRDELTAMVN_LAUNCH(WF_SIZE)                                     \
+    hipLaunchKernelGGL((csrdeltamvn_kernel<CSRDELTAMVN_DIM, WF_SIZE>),  \
+                       dim3((m - 1) / (CSRDELTAMVN_DIM / WF_SIZE) + 1), \
+                       dim3(CSRDELTAMVN_DIM),                           \
+                       0,                                               \
+                       handle->stream,                                  \
+                       m,                                               \
+                       block_dim,                                       \
+                       alpha_device_host,                               \
+                       csr_row_ptr,                                     \
+                       csr_val,                                         \
+                       csrdelta_block_ptr,                              \
+                       csrdelta_width,                                  \
+                       csrdelta_row_col,                                \
+                       csrdelta_col_ind,                                \
+                       x,                                               \
+                       beta_device_host,                                \
+                       y,                                               \
+                       descr->base)
+
+    if(nnz_per_row < 4)
+    {
+        CSRDELTAMVN_LAUNCH(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        CSRDELTAMVN_LAUNCH(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        CSRDELTAMVN_LAUNCH(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        CSRDELTAMVN_LAUNCH(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        CSRDELTAMVN_LAUNCH(32);
+    }
+    else
+    {
+        CSRDELTAMVN_LAUNCH(64);
+    }
+
+#undef CSRDELTAMVN_LAUNCH
+#undef CSRDELTAMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrdeltamv_template(rocsparse_handle          handle,
+                                               rocsparse_operation       trans,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const T*                  alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               rocsparse_int             block_dim,
+                                               const rocsparse_int*      csrdelta_block_ptr,
+                                               const rocsparse_int*      csrdelta_width,
+                                               const rocsparse_int*      csrdelta_row_col,
+                                               const rocsparse_int*      csrdelta_col_ind,
+                                               const T*                  x,
+                                               const T*                  beta,
+                                               T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrdeltamv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  block_dim,
+                  (const void*&)csrdelta_block_ptr,
+                  (const void*&)csrdelta_width,
+                  (const void*&)csrdelta_row_col,
+                  (const void*&)csrdelta_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrdeltamv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--blockdim",
+                  block_dim,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrdeltamv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  block_dim,
+                  (const void*&)csrdelta_block_ptr,
+                  (const void*&)csrdelta_width,
+                  (const void*&)csrdelta_row_col,
+                  (const void*&)csrdelta_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csrdelta_block_ptr == nullptr
+       || csrdelta_width == nullptr || csrdelta_row_col == nullptr || csrdelta_col_ind == nullptr
+       || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrdeltamv_dispatch(handle,
+                                             m,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             block_dim,
+                                             csrdelta_block_ptr,
+                                             csrdelta_width,
+                                             csrdelta_row_col,
+                                             csrdelta_col_ind,
+                                             x,
+                                             beta,
+                                             y);
+    }
+    else
+    {
+        return rocsparse_csrdeltamv_dispatch(handle,
+                                             m,
+                                             nnz,
+                                             *alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             block_dim,
+                                             csrdelta_block_ptr,
+                                             csrdelta_width,
+                                             csrdelta_row_col,
+                                             csrdelta_col_ind,
+                                             x,
+                                             *beta,
+                                             y);
+    }
+}
+
+#endif // ROCSPARSE_CSRDELTAMV_HPP
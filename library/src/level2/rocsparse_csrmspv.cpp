@@ -0,0 +1,319 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_csrmspv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrmspv_buffer_size(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             n,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const float*              csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           size_t*                   buffer_size)
+{
+    return rocsparse_csrmspv_buffer_size_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmspv_buffer_size(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             n,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const double*             csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           size_t*                   buffer_size)
+{
+    return rocsparse_csrmspv_buffer_size_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmspv_buffer_size(rocsparse_handle               handle,
+                                                           rocsparse_int                  m,
+                                                           rocsparse_int                  n,
+                                                           rocsparse_int                  nnz,
+                                                           const rocsparse_mat_descr      descr,
+                                                           const rocsparse_float_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           size_t*              buffer_size)
+{
+    return rocsparse_csrmspv_buffer_size_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmspv_buffer_size(rocsparse_handle                handle,
+                                                           rocsparse_int                   m,
+                                                           rocsparse_int                   n,
+                                                           rocsparse_int                   nnz,
+                                                           const rocsparse_mat_descr       descr,
+                                                           const rocsparse_double_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           size_t*              buffer_size)
+{
+    return rocsparse_csrmspv_buffer_size_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmspv_analysis(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer)
+{
+    return rocsparse_csrmspv_analysis_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmspv_analysis(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer)
+{
+    return rocsparse_csrmspv_analysis_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmspv_analysis(rocsparse_handle               handle,
+                                                        rocsparse_int                  m,
+                                                        rocsparse_int                  n,
+                                                        rocsparse_int                  nnz,
+                                                        const rocsparse_mat_descr      descr,
+                                                        const rocsparse_float_complex* csr_val,
+                                                        const rocsparse_int*           csr_row_ptr,
+                                                        const rocsparse_int*           csr_col_ind,
+                                                        rocsparse_mat_info             info,
+                                                        void*                          temp_buffer)
+{
+    return rocsparse_csrmspv_analysis_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmspv_analysis(rocsparse_handle                handle,
+                                                        rocsparse_int                   m,
+                                                        rocsparse_int                   n,
+                                                        rocsparse_int                   nnz,
+                                                        const rocsparse_mat_descr       descr,
+                                                        const rocsparse_double_complex* csr_val,
+                                                        const rocsparse_int*            csr_row_ptr,
+                                                        const rocsparse_int*            csr_col_ind,
+                                                        rocsparse_mat_info              info,
+                                                        void*                           temp_buffer)
+{
+    return rocsparse_csrmspv_analysis_template(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmspv(rocsparse_handle          handle,
+                                               rocsparse_operation       trans,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const float*              alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_int             nnz_x,
+                                               const float*              x_val,
+                                               const rocsparse_int*      x_ind,
+                                               const float*              beta,
+                                               float*                    y,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csrmspv_template(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      nnz_x,
+                                      x_val,
+                                      x_ind,
+                                      beta,
+                                      y,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmspv(rocsparse_handle          handle,
+                                               rocsparse_operation       trans,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const double*             alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_int             nnz_x,
+                                               const double*             x_val,
+                                               const rocsparse_int*      x_ind,
+                                               const double*             beta,
+                                               double*                   y,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csrmspv_template(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      nnz_x,
+                                      x_val,
+                                      x_ind,
+                                      beta,
+                                      y,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmspv(rocsparse_handle               handle,
+                                               rocsparse_operation            trans,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_float_complex* alpha,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_mat_info             info,
+                                               rocsparse_int                  nnz_x,
+                                               const rocsparse_float_complex* x_val,
+                                               const rocsparse_int*           x_ind,
+                                               const rocsparse_float_complex* beta,
+                                               rocsparse_float_complex*       y,
+                                               void*                          temp_buffer)
+{
+    return rocsparse_csrmspv_template(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      nnz_x,
+                                      x_val,
+                                      x_ind,
+                                      beta,
+                                      y,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmspv(rocsparse_handle                handle,
+                                               rocsparse_operation             trans,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_double_complex* alpha,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               rocsparse_int                   nnz_x,
+                                               const rocsparse_double_complex* x_val,
+                                               const rocsparse_int*            x_ind,
+                                               const rocsparse_double_complex* beta,
+                                               rocsparse_double_complex*       y,
+                                               void*                           temp_buffer)
+{
+    return rocsparse_csrmspv_template(handle,
+                                      trans,
+                                      m,
+                                      n,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      nnz_x,
+                                      x_val,
+                                      x_ind,
+                                      beta,
+                                      y,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csrmspv_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmspv_clear", (const void*&)info);
+
+    // Destroy csrmspv info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmspv_info(info->csrmspv_info));
+    info->csrmspv_info = nullptr;
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,825 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMSPV_HPP
+#define ROCSPARSE_CSRMSPV_HPP
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "../level1/rocsparse_gthr.hpp"
+#include "../level1/rocsparse_sctr.hpp"
+#include "csrmspv_device.h"
+#include "rocsparse_csrmv.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+#define CSRMSPV_DIM 256
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmspv_scale_kernel(rocsparse_int size, U beta_device_host, T* __restrict__ y)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != static_cast<T>(1))
+    {
+        csrmspv_scale_device<BLOCKSIZE>(size, beta, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         PERM,
+          bool         CONJ,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmspv_push_kernel(rocsparse_int nnz_x,
+                             U             alpha_device_host,
+                             const T* __restrict__ x_val,
+                             const rocsparse_int* __restrict__ x_ind,
+                             const rocsparse_int* __restrict__ ptr,
+                             const rocsparse_int* __restrict__ ind,
+                             const T* __restrict__ val,
+                             const rocsparse_int* __restrict__ perm,
+                             T* __restrict__ y,
+                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmspv_push_device<BLOCKSIZE, WF_SIZE, PERM, CONJ>(
+            nnz_x, alpha, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmspv_gthr_conj_kernel(rocsparse_int nnz,
+                                  const T* __restrict__ val,
+                                  const rocsparse_int* __restrict__ perm,
+                                  T* __restrict__ csc_val)
+{
+    csrmspv_gthr_conj_device<BLOCKSIZE>(nnz, val, perm, csc_val);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmspv_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmspv_buffer_size"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Analysis requires two work arrays and the rocprim sort buffer
+    size_t         rocprim_size;
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy, dummy, nnz, 0, 32, stream));
+
+    size_t analysis_size = rocprim_size;
+    analysis_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256 * 2;
+
+    // Pull path requires the expanded vector x and, for the transposed operation,
+    // the permuted matrix values
+    size_t solve_size = sizeof(T) * ((std::max(m, n) - 1) / 256 + 1) * 256;
+    solve_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    *buffer_size = std::max(analysis_size, solve_size);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmspv_analysis_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmspv_analysis"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Clear csrmspv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmspv_info(info->csrmspv_info));
+
+    // Create csrmspv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmspv_info(&info->csrmspv_info));
+
+    rocsparse_csrmspv_info csrmspv = info->csrmspv_info;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrmspv->csc_perm, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&csrmspv->csc_col_ptr, sizeof(rocsparse_int) * (n + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrmspv->csc_row_ind, sizeof(rocsparse_int) * nnz));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_create_identity_permutation(handle, nnz, csrmspv->csc_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, csrmspv->csc_row_ind);
+    rocprim::double_buffer<rocsparse_int> vals(csrmspv->csc_perm, tmp_work2);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    size_t rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Copy permutation vector, if not already available
+    if(vals.current() != csrmspv->csc_perm)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrmspv->csc_perm,
+                                           vals.current(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnz, n, csrmspv->csc_col_ptr, descr->base));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_work1, descr->base));
+
+    // Permute row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
+                                                      nnz,
+                                                      tmp_work1,
+                                                      csrmspv->csc_row_ind,
+                                                      csrmspv->csc_perm,
+                                                      rocsparse_index_base_zero));
+
+    // Store some pointers to verify correct execution
+    csrmspv->m           = m;
+    csrmspv->n           = n;
+    csrmspv->nnz         = nnz;
+    csrmspv->descr       = descr;
+    csrmspv->csr_row_ptr = csr_row_ptr;
+    csrmspv->csr_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WF_SIZE, bool PERM, bool CONJ, typename T, typename U>
+static void rocsparse_csrmspv_push_launch(rocsparse_handle     handle,
+                                          rocsparse_int        nnz_x,
+                                          U                    alpha_device_host,
+                                          const T*             x_val,
+                                          const rocsparse_int* x_ind,
+                                          const rocsparse_int* ptr,
+                                          const rocsparse_int* ind,
+                                          const T*             val,
+                                          const rocsparse_int* perm,
+                                          T*                   y,
+                                          rocsparse_index_base idx_base)
+{
+    hipLaunchKernelGGL((csrmspv_push_kernel<CSRMSPV_DIM, WF_SIZE, PERM, CONJ>),
+                       dim3((nnz_x - 1) / (CSRMSPV_DIM / WF_SIZE) + 1),
+                       dim3(CSRMSPV_DIM),
+                       0,
+                       handle->stream,
+                       nnz_x,
+                       alpha_device_host,
+                       x_val,
+                       x_ind,
+                       ptr,
+                       ind,
+                       val,
+                       perm,
+                       y,
+                       idx_base);
+}
+
+template <bool PERM, bool CONJ, typename T, typename U>
+static rocsparse_status rocsparse_csrmspv_push_dispatch(rocsparse_handle     handle,
+                                                        rocsparse_int        nnz_per_vec,
+                                                        rocsparse_int        nnz_x,
+                                                        U                    alpha_device_host,
+                                                        const T*             x_val,
+                                                        const rocsparse_int* x_ind,
+                                                        const rocsparse_int* ptr,
+                                                        const rocsparse_int* ind,
+                                                        const T*             val,
+                                                        const rocsparse_int* perm,
+                                                        T*                   y,
+                                                        rocsparse_index_base idx_base)
+{
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Sub-wavefront size depends on the average length of the scattered vectors
+    if(nnz_per_vec < 4)
+    {
+        rocsparse_csrmspv_push_launch<2, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+    else if(nnz_per_vec < 8)
+    {
+        rocsparse_csrmspv_push_launch<4, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+    else if(nnz_per_vec < 16)
+    {
+        rocsparse_csrmspv_push_launch<8, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+    else if(nnz_per_vec < 32)
+    {
+        rocsparse_csrmspv_push_launch<16, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+    else if(nnz_per_vec < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmspv_push_launch<32, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+    else
+    {
+        rocsparse_csrmspv_push_launch<64, PERM, CONJ>(
+            handle, nnz_x, alpha_device_host, x_val, x_ind, ptr, ind, val, perm, y, idx_base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmspv_push_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 U                         alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_csrmspv_info    info,
+                                                 rocsparse_int             nnz_x,
+                                                 const T*                  x_val,
+                                                 const rocsparse_int*      x_ind,
+                                                 U                         beta_device_host,
+                                                 T*                        y)
+{
+    rocsparse_int len_y = (trans == rocsparse_operation_none) ? m : n;
+
+    // Scale y with beta
+    hipLaunchKernelGGL((csrmspv_scale_kernel<CSRMSPV_DIM>),
+                       dim3((len_y - 1) / CSRMSPV_DIM + 1),
+                       dim3(CSRMSPV_DIM),
+                       0,
+                       handle->stream,
+                       len_y,
+                       beta_device_host,
+                       y);
+
+    // Quick return if there is nothing to scatter
+    if(nnz == 0 || nnz_x == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Rows of A are the columns of A^T and can be scattered directly, while the
+    // columns of A require the transposed pattern from the analysis
+    if(trans == rocsparse_operation_transpose)
+    {
+        return rocsparse_csrmspv_push_dispatch<false, false>(handle,
+                                                             nnz / m,
+                                                             nnz_x,
+                                                             alpha_device_host,
+                                                             x_val,
+                                                             x_ind,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             csr_val,
+                                                             (const rocsparse_int*)nullptr,
+                                                             y,
+                                                             descr->base);
+    }
+    else if(trans == rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_csrmspv_push_dispatch<false, true>(handle,
+                                                            nnz / m,
+                                                            nnz_x,
+                                                            alpha_device_host,
+                                                            x_val,
+                                                            x_ind,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csr_val,
+                                                            (const rocsparse_int*)nullptr,
+                                                            y,
+                                                            descr->base);
+    }
+    else
+    {
+        return rocsparse_csrmspv_push_dispatch<true, false>(handle,
+                                                            nnz / n,
+                                                            nnz_x,
+                                                            alpha_device_host,
+                                                            x_val,
+                                                            x_ind,
+                                                            info->csc_col_ptr,
+                                                            info->csc_row_ind,
+                                                            csr_val,
+                                                            info->csc_perm,
+                                                            y,
+                                                            descr->base);
+    }
+}
+
+// Estimated global memory traffic in bytes of the push and pull kernels. Coalesced
+// streams are charged by their size, scattered accesses by one memory sector and
+// atomics by two sectors (read and write). Scaling y is common to both and omitted.
+#define CSRMSPV_SECTOR 32
+
+template <typename T>
+static inline bool rocsparse_csrmspv_use_push(rocsparse_operation trans,
+                                              rocsparse_int       m,
+                                              rocsparse_int       n,
+                                              rocsparse_int       nnz,
+                                              rocsparse_int       nnz_x)
+{
+    double len_x = (trans == rocsparse_operation_none) ? n : m;
+
+    // Non-zero entries of op(A) expected to be selected by x
+    double touched = static_cast<double>(nnz_x) * nnz / len_x;
+
+    // Push: load x, gather the column bounds of each entry of x and scatter the
+    // selected entries into y. For op(A) = A, the values are gathered through the
+    // permutation of the transposed pattern.
+    double push_entry = sizeof(rocsparse_int) + 2 * CSRMSPV_SECTOR
+                        + ((trans == rocsparse_operation_none) ? 2 * CSRMSPV_SECTOR : sizeof(T));
+    double push = nnz_x * (sizeof(T) + sizeof(rocsparse_int) + CSRMSPV_SECTOR)
+                  + touched * push_entry;
+
+    // Pull: expand x into its dense representation and stream the whole matrix
+    // through csrmv. For op(A) != A, the values are gathered into the transposed
+    // pattern first.
+    double pull = len_x * sizeof(T) + nnz_x * (sizeof(T) + sizeof(rocsparse_int) + CSRMSPV_SECTOR)
+                  + static_cast<double>(nnz) * (sizeof(rocsparse_int) + 2 * sizeof(T));
+
+    if(trans != rocsparse_operation_none)
+    {
+        pull += static_cast<double>(nnz) * (sizeof(rocsparse_int) + sizeof(T) + CSRMSPV_SECTOR);
+    }
+
+    return push < pull;
+}
+
+#undef CSRMSPV_SECTOR
+
+template <typename T>
+rocsparse_status rocsparse_csrmspv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             nnz_x,
+                                            const T*                  x_val,
+                                            const rocsparse_int*      x_ind,
+                                            const T*                  beta,
+                                            T*                        y,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmspv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  *beta,
+                  (const void*&)y,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmspv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--transposeA",
+                  trans,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmspv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  nnz_x,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0 || nnz_x < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr || y == nullptr || csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_x > 0 && (x_val == nullptr || x_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Transposed pattern, if available
+    rocsparse_csrmspv_info csrmspv = (info != nullptr) ? info->csrmspv_info : nullptr;
+
+    // Check if info matches current matrix
+    if(csrmspv != nullptr)
+    {
+        if(csrmspv->m != m || csrmspv->n != n || csrmspv->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        if(csrmspv->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        if(csrmspv->csr_row_ptr != csr_row_ptr || csrmspv->csr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Length of the dense representation of x
+    rocsparse_int len_x = (trans == rocsparse_operation_none) ? n : m;
+
+    // Without analysis, only the native direction of the CSR format is available,
+    // i.e. pull for y = A * x and push for y = A^T * x and y = A^H * x
+    bool push_available = trans != rocsparse_operation_none || csrmspv != nullptr;
+    bool pull_available = trans == rocsparse_operation_none || csrmspv != nullptr;
+
+    // If both are available, the kernel with less estimated memory traffic is used
+    bool push = nnz == 0 || nnz_x == 0 || !pull_available
+                || (push_available && rocsparse_csrmspv_use_push<T>(trans, m, n, nnz, nnz_x));
+
+    if(push)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmspv_push_template(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csrmspv,
+                                                   nnz_x,
+                                                   x_val,
+                                                   x_ind,
+                                                   beta,
+                                                   y);
+        }
+        else
+        {
+            return rocsparse_csrmspv_push_template(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   *alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csrmspv,
+                                                   nnz_x,
+                                                   x_val,
+                                                   x_ind,
+                                                   *beta,
+                                                   y);
+        }
+    }
+
+    // Pull path requires the temporary buffer
+    if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Expanded vector x
+    T* x_dense = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((std::max(m, n) - 1) / 256 + 1) * 256;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(x_dense, 0, sizeof(T) * len_x, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_sctr_template(handle, nnz_x, x_val, x_ind, x_dense, descr->base));
+
+    if(trans == rocsparse_operation_none)
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x_dense,
+                                        beta,
+                                        y);
+    }
+
+    // Permute matrix values into the transposed pattern
+    T* csc_val = reinterpret_cast<T*>(ptr);
+
+    if(trans == rocsparse_operation_transpose)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
+            handle, nnz, csr_val, csc_val, csrmspv->csc_perm, rocsparse_index_base_zero));
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmspv_gthr_conj_kernel<CSRMSPV_DIM>),
+                           dim3((nnz - 1) / CSRMSPV_DIM + 1),
+                           dim3(CSRMSPV_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           csr_val,
+                           csrmspv->csc_perm,
+                           csc_val);
+    }
+
+    return rocsparse_csrmv_template(handle,
+                                    rocsparse_operation_none,
+                                    n,
+                                    m,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csc_val,
+                                    csrmspv->csc_col_ptr,
+                                    csrmspv->csc_row_ind,
+                                    (rocsparse_mat_info) nullptr,
+                                    x_dense,
+                                    beta,
+                                    y);
+}
+
+#endif // ROCSPARSE_CSRMSPV_HPP
@@ -25,14 +25,20 @@
 
 #include "rocsparse_csrmv.hpp"
 
+#include "../level1/rocsparse_gthr.hpp"
 #include "csrmv_device.h"
 
+#include <rocprim/rocprim.hpp>
+
 #define BLOCK_SIZE 1024
 #define BLOCK_MULTIPLIER 3
 #define ROWS_FOR_VECTOR 1
 #define WG_BITS 24
 #define ROW_BITS 32
 #define WG_SIZE 256
+#define CSRMVT_DIM 512
+#define CSRMVN_MERGE_DIM 256
+#define CSRMVN_MERGE_ITEMS 8
 
 __attribute__((unused)) static unsigned int flp2(unsigned int x)
 {
@@ -286,6 +292,137 @@ static inline void ComputeRowBlocks(unsigned long long*  rowBlocks,
     }
 }
 
+// Compute the row blocks of csrmv adaptive
+static rocsparse_status rocsparse_csrmv_analysis_row_blocks(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            rocsparse_csrmv_info info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // row blocks size
+    info->size = 0;
+
+    // Temporary arrays to hold device data
+    std::vector<rocsparse_int> hptr(m + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Determine row blocks array size
+    ComputeRowBlocks((unsigned long long*)NULL, info->size, hptr.data(), m, false);
+
+    // Create row blocks structure
+    std::vector<unsigned long long> row_blocks(info->size, 0);
+
+    ComputeRowBlocks(row_blocks.data(), info->size, hptr.data(), m, true);
+
+    // Allocate memory on device to hold csrmv info, if required
+    if(info->size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->row_blocks,
+                                      sizeof(unsigned long long) * info->size));
+
+        // Copy row blocks information to device
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->row_blocks,
+                                           row_blocks.data(),
+                                           sizeof(unsigned long long) * info->size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Compute the transposed (CSC) pattern of the matrix and the permutation into the CSR
+// value array, such that transposed csrmv can be computed without atomics.
+static rocsparse_status rocsparse_csrmv_analysis_transpose(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             n,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_csrmv_info      info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csc_perm, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csc_col_ptr, sizeof(rocsparse_int) * (n + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csc_row_ind, sizeof(rocsparse_int) * nnz));
+
+    // Determine rocprim buffer size
+    rocprim::double_buffer<rocsparse_int> dummy(info->csc_row_ind, info->csc_row_ind);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, dummy, dummy, nnz, startbit, endbit, stream));
+
+    // Temporary buffer for two work arrays and rocprim
+    size_t work_size   = sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    char*  temp_buffer = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&temp_buffer, 2 * work_size + rocprim_size));
+
+    rocsparse_int* tmp_work1      = reinterpret_cast<rocsparse_int*>(temp_buffer);
+    rocsparse_int* tmp_work2      = reinterpret_cast<rocsparse_int*>(temp_buffer + work_size);
+    void*          rocprim_buffer = reinterpret_cast<void*>(temp_buffer + 2 * work_size);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, info->csc_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, info->csc_row_ind);
+    rocprim::double_buffer<rocsparse_int> vals(info->csc_perm, tmp_work2);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Copy permutation vector, if not already available
+    if(vals.current() != info->csc_perm)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csc_perm,
+                                           vals.current(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnz, n, info->csc_col_ptr, descr->base));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_work1, descr->base));
+
+    // Permute row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
+                                                      nnz,
+                                                      tmp_work1,
+                                                      info->csc_row_ind,
+                                                      info->csc_perm,
+                                                      rocsparse_index_base_zero));
+
+    // Free temporary buffer
+    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -330,11 +467,6 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
 
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
@@ -342,6 +474,12 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric, Hermitian and triangular matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -360,43 +498,17 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Create csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
 
-    // Stream
-    hipStream_t stream = handle->stream;
-
-    // row blocks size
-    info->csrmv_info->size = 0;
-
-    // Temporary arrays to hold device data
-    std::vector<rocsparse_int> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Determine row blocks array size
-    ComputeRowBlocks((unsigned long long*)NULL, info->csrmv_info->size, hptr.data(), m, false);
-
-    // Create row blocks structure
-    std::vector<unsigned long long> row_blocks(info->csrmv_info->size, 0);
-
-    ComputeRowBlocks(row_blocks.data(), info->csrmv_info->size, hptr.data(), m, true);
-
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
+    // Transposed operations and the column part of symmetric, Hermitian and triangular
+    // matrices work on the transposed pattern instead of row blocks
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
-
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(unsigned long long) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_transpose(
+            handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info->csrmv_info));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis_row_blocks(handle, m, csr_row_ptr, info->csrmv_info));
     }
 
     // Store some pointers to verify correct execution
@@ -458,6 +570,415 @@ __launch_bounds__(WG_SIZE) __global__
     }
 }
 
+template <unsigned int BLOCKSIZE, unsigned int ITEMS_PER_THREAD, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_path_kernel(rocsparse_int m,
+                                  rocsparse_int nnz,
+                                  U             alpha_device_host,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const T* __restrict__ csr_val,
+                                  const T* __restrict__ x,
+                                  U beta_device_host,
+                                  T* __restrict__ y,
+                                  rocsparse_int* __restrict__ carry_row,
+                                  T* __restrict__ carry_val,
+                                  rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_merge_path_device<BLOCKSIZE, ITEMS_PER_THREAD>(m,
+                                                              nnz,
+                                                              alpha,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              csr_val,
+                                                              x,
+                                                              beta,
+                                                              y,
+                                                              carry_row,
+                                                              carry_val,
+                                                              idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_path_fixup_kernel(rocsparse_int m,
+                                        rocsparse_int nblocks,
+                                        U             alpha_device_host,
+                                        const rocsparse_int* __restrict__ carry_row,
+                                        const T* __restrict__ carry_val,
+                                        U beta_device_host,
+                                        T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_merge_path_fixup_device<BLOCKSIZE>(m, nblocks, carry_row, carry_val, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_scale_kernel(rocsparse_int size, U beta_device_host, T* __restrict__ y)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != static_cast<T>(1))
+    {
+        csrmvt_scale_device<BLOCKSIZE>(size, beta, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool CONJ, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_general_kernel(rocsparse_int m,
+                               U             alpha_device_host,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               const T* __restrict__ x,
+                               T* __restrict__ y,
+                               rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvt_general_device<BLOCKSIZE, WF_SIZE, CONJ>(
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool CONJ, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_perm_kernel(rocsparse_int n,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csc_col_ptr,
+                            const rocsparse_int* __restrict__ csc_row_ind,
+                            const rocsparse_int* __restrict__ csc_perm,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            U beta_device_host,
+                            T* __restrict__ y,
+                            rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvt_perm_device<BLOCKSIZE, WF_SIZE, CONJ>(
+            n, alpha, csc_col_ptr, csc_row_ind, csc_perm, csr_val, x, beta, y, idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvs_general_kernel(rocsparse_int m,
+                               U             alpha_device_host,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               const rocsparse_int* __restrict__ csc_col_ptr,
+                               const rocsparse_int* __restrict__ csc_row_ind,
+                               const rocsparse_int* __restrict__ csc_perm,
+                               const T* __restrict__ x,
+                               U beta_device_host,
+                               T* __restrict__ y,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_diag_type    diag,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvs_general_device<BLOCKSIZE, WF_SIZE>(m,
+                                                  alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  csc_col_ptr,
+                                                  csc_row_ind,
+                                                  csc_perm,
+                                                  x,
+                                                  beta,
+                                                  y,
+                                                  parts,
+                                                  uplo,
+                                                  diag,
+                                                  idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvs_scatter_kernel(rocsparse_int m,
+                               U             alpha_device_host,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               const T* __restrict__ x,
+                               T* __restrict__ y,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvs_scatter_device<BLOCKSIZE, WF_SIZE>(
+            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, parts, uplo, idx_base);
+    }
+}
+
+// Launch the symmetric, Hermitian and triangular csrmv kernels. If the transposed
+// pattern is not available, the column part is scattered after the row part has been
+// written.
+template <unsigned int WF_SIZE, typename T, typename U>
+static void rocsparse_csrmvs_launch(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             m,
+                                    U                         alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const T*                  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_int*      csc_col_ptr,
+                                    const rocsparse_int*      csc_row_ind,
+                                    const rocsparse_int*      csc_perm,
+                                    const T*                  x,
+                                    U                         beta,
+                                    T*                        y)
+{
+    rocsparse_matrix_parts parts = rocsparse_get_matrix_parts(descr->type, trans);
+
+    dim3 csrmvs_blocks((m - 1) / (CSRMVT_DIM / WF_SIZE) + 1);
+    dim3 csrmvs_threads(CSRMVT_DIM);
+
+    hipLaunchKernelGGL((csrmvs_general_kernel<CSRMVT_DIM, WF_SIZE>),
+                       csrmvs_blocks,
+                       csrmvs_threads,
+                       0,
+                       handle->stream,
+                       m,
+                       alpha,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csc_col_ptr,
+                       csc_row_ind,
+                       csc_perm,
+                       x,
+                       beta,
+                       y,
+                       parts,
+                       descr->fill_mode,
+                       descr->diag_type,
+                       descr->base);
+
+    if(parts.col && csc_col_ptr == nullptr)
+    {
+        hipLaunchKernelGGL((csrmvs_scatter_kernel<CSRMVT_DIM, WF_SIZE>),
+                           csrmvs_blocks,
+                           csrmvs_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           parts,
+                           descr->fill_mode,
+                           descr->base);
+    }
+}
+
+template <typename T, typename U>
+static rocsparse_status rocsparse_csrmvs_dispatch(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  U                         alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  const rocsparse_int*      csc_col_ptr,
+                                                  const rocsparse_int*      csc_row_ind,
+                                                  const rocsparse_int*      csc_perm,
+                                                  const T*                  x,
+                                                  U                         beta,
+                                                  T*                        y)
+{
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Rows of op(A) gather entries from both the stored row and the stored column
+    rocsparse_int nnz_per_row = (csc_col_ptr != nullptr) ? 2 * (nnz / m) : nnz / m;
+
+#define CSRMVS_LAUNCH(WF_SIZE)                                         \
+    rocsparse_csrmvs_launch<WF_SIZE>(handle,                           \
+                                     trans,                            \
+                                     m,                                \
+                                     alpha,                            \
+                                     descr,                            \
+                                     csr_val,                          \
+                                     csr_row_ptr,                      \
+                                     csr_col_ind,                      \
+                                     csc_col_ptr,                      \
+                                     csc_row_ind,                      \
+                                     csc_perm,                         \
+                                     x,                                \
+                                     beta,                             \
+                                     y)
+
+    if(nnz_per_row < 4)
+    {
+        CSRMVS_LAUNCH(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        CSRMVS_LAUNCH(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        CSRMVS_LAUNCH(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        CSRMVS_LAUNCH(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        CSRMVS_LAUNCH(32);
+    }
+    else
+    {
+        CSRMVS_LAUNCH(64);
+    }
+
+#undef CSRMVS_LAUNCH
+
+    return rocsparse_status_success;
+}
+
+// Launch the transposed csrmv kernels, where size is the number of rows (scatter) or
+// columns (perm) of A and each of them is processed by a sub-wavefront of size WF_SIZE
+template <unsigned int WF_SIZE, bool PERM, bool CONJ, typename T, typename U>
+static void rocsparse_csrmvt_launch(rocsparse_handle     handle,
+                                    rocsparse_int        size,
+                                    U                    alpha,
+                                    const rocsparse_int* ptr,
+                                    const rocsparse_int* ind,
+                                    const rocsparse_int* perm,
+                                    const T*             csr_val,
+                                    const T*             x,
+                                    U                    beta,
+                                    T*                   y,
+                                    rocsparse_index_base idx_base)
+{
+    dim3 csrmvt_blocks((size - 1) / (CSRMVT_DIM / WF_SIZE) + 1);
+    dim3 csrmvt_threads(CSRMVT_DIM);
+
+    if(PERM)
+    {
+        hipLaunchKernelGGL((csrmvt_perm_kernel<CSRMVT_DIM, WF_SIZE, CONJ>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           size,
+                           alpha,
+                           ptr,
+                           ind,
+                           perm,
+                           csr_val,
+                           x,
+                           beta,
+                           y,
+                           idx_base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvt_general_kernel<CSRMVT_DIM, WF_SIZE, CONJ>),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           handle->stream,
+                           size,
+                           alpha,
+                           ptr,
+                           ind,
+                           csr_val,
+                           x,
+                           y,
+                           idx_base);
+    }
+}
+
+template <bool PERM, bool CONJ, typename T, typename U>
+static rocsparse_status rocsparse_csrmvt_dispatch(rocsparse_handle     handle,
+                                                  rocsparse_int        nnz_per_vec,
+                                                  rocsparse_int        size,
+                                                  U                    alpha,
+                                                  const rocsparse_int* ptr,
+                                                  const rocsparse_int* ind,
+                                                  const rocsparse_int* perm,
+                                                  const T*             csr_val,
+                                                  const T*             x,
+                                                  U                    beta,
+                                                  T*                   y,
+                                                  rocsparse_index_base idx_base)
+{
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Sub-wavefront size depends on the average number of entries per row or column
+    if(nnz_per_vec < 4)
+    {
+        rocsparse_csrmvt_launch<2, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+    else if(nnz_per_vec < 8)
+    {
+        rocsparse_csrmvt_launch<4, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+    else if(nnz_per_vec < 16)
+    {
+        rocsparse_csrmvt_launch<8, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+    else if(nnz_per_vec < 32)
+    {
+        rocsparse_csrmvt_launch<16, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+    else if(nnz_per_vec < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmvt_launch<32, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+    else
+    {
+        rocsparse_csrmvt_launch<64, PERM, CONJ>(
+            handle, size, alpha, ptr, ind, perm, csr_val, x, beta, y, idx_base);
+    }
+
+    return rocsparse_status_success;
+}
+
 template <typename T, typename U>
 rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          handle,
                                                   rocsparse_operation       trans,
@@ -476,6 +997,26 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Symmetric, Hermitian and triangular matrices without the transposed pattern
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_csrmvs_dispatch(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         alpha_device_host,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         (const rocsparse_int*)nullptr,
+                                         (const rocsparse_int*)nullptr,
+                                         (const rocsparse_int*)nullptr,
+                                         x,
+                                         beta_device_host,
+                                         y);
+    }
+
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
@@ -687,8 +1228,47 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Scale y with beta
+        hipLaunchKernelGGL((csrmvt_scale_kernel<CSRMVT_DIM>),
+                           dim3((n - 1) / CSRMVT_DIM + 1),
+                           dim3(CSRMVT_DIM),
+                           0,
+                           stream,
+                           n,
+                           beta_device_host,
+                           y);
+
+        // Scatter the rows of A, which are the columns of op(A), into y
+        if(trans == rocsparse_operation_transpose)
+        {
+            return rocsparse_csrmvt_dispatch<false, false>(handle,
+                                                           nnz / m,
+                                                           m,
+                                                           alpha_device_host,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           (const rocsparse_int*)nullptr,
+                                                           csr_val,
+                                                           x,
+                                                           beta_device_host,
+                                                           y,
+                                                           descr->base);
+        }
+        else
+        {
+            return rocsparse_csrmvt_dispatch<false, true>(handle,
+                                                          nnz / m,
+                                                          m,
+                                                          alpha_device_host,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          (const rocsparse_int*)nullptr,
+                                                          csr_val,
+                                                          x,
+                                                          beta_device_host,
+                                                          y,
+                                                          descr->base);
+        }
     }
     return rocsparse_status_success;
 }
@@ -733,6 +1313,26 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Symmetric, Hermitian and triangular matrices using the transposed pattern
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_csrmvs_dispatch(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         alpha_device_host,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info->csc_col_ptr,
+                                         info->csc_row_ind,
+                                         info->csc_perm,
+                                         x,
+                                         beta_device_host,
+                                         y);
+    }
+
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
@@ -753,14 +1353,323 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
                            y,
                            descr->base);
     }
+    else if(trans == rocsparse_operation_transpose)
+    {
+        return rocsparse_csrmvt_dispatch<true, false>(handle,
+                                                      nnz / n,
+                                                      n,
+                                                      alpha_device_host,
+                                                      info->csc_col_ptr,
+                                                      info->csc_row_ind,
+                                                      info->csc_perm,
+                                                      csr_val,
+                                                      x,
+                                                      beta_device_host,
+                                                      y,
+                                                      descr->base);
+    }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        return rocsparse_csrmvt_dispatch<true, true>(handle,
+                                                     nnz / n,
+                                                     n,
+                                                     alpha_device_host,
+                                                     info->csc_col_ptr,
+                                                     info->csc_row_ind,
+                                                     info->csc_perm,
+                                                     csr_val,
+                                                     x,
+                                                     beta_device_host,
+                                                     y,
+                                                     descr->base);
     }
     return rocsparse_status_success;
 }
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmv_merge_path_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     U                         alpha_device_host,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const T*                  x,
+                                                     U                         beta_device_host,
+                                                     T*                        y)
+{
+    // Transposed operations and symmetric, Hermitian and triangular matrices are not split
+    // along the merge path
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_csrmv_general_template(handle,
+                                                trans,
+                                                m,
+                                                n,
+                                                nnz,
+                                                alpha_device_host,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                x,
+                                                beta_device_host,
+                                                y);
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Each block consumes a fixed number of row ends and non-zero entries
+    rocsparse_int nblocks = (m + nnz - 1) / (CSRMVN_MERGE_DIM * CSRMVN_MERGE_ITEMS) + 1;
+
+    // Temporary storage for the partial sums of rows that span multiple blocks
+    size_t carry_row_size          = ((sizeof(rocsparse_int) * nblocks - 1) / 256 + 1) * 256;
+    size_t temp_storage_size_bytes = carry_row_size + sizeof(T) * nblocks;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= temp_storage_size_bytes)
+    {
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* carry_row = reinterpret_cast<rocsparse_int*>(temp_storage_ptr);
+    T* carry_val = reinterpret_cast<T*>(reinterpret_cast<char*>(temp_storage_ptr) + carry_row_size);
+
+    hipLaunchKernelGGL((csrmvn_merge_path_kernel<CSRMVN_MERGE_DIM, CSRMVN_MERGE_ITEMS>),
+                       dim3(nblocks),
+                       dim3(CSRMVN_MERGE_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       alpha_device_host,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       x,
+                       beta_device_host,
+                       y,
+                       carry_row,
+                       carry_val,
+                       descr->base);
+
+    hipLaunchKernelGGL((csrmvn_merge_path_fixup_kernel<CSRMVN_MERGE_DIM>),
+                       dim3((nblocks - 1) / CSRMVN_MERGE_DIM + 1),
+                       dim3(CSRMVN_MERGE_DIM),
+                       0,
+                       stream,
+                       m,
+                       nblocks,
+                       alpha_device_host,
+                       carry_row,
+                       carry_val,
+                       beta_device_host,
+                       y);
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+static rocsparse_status rocsparse_csrmv_dispatch(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_csrmv_alg       alg,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 U                         alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 const T*                  x,
+                                                 U                         beta_device_host,
+                                                 T*                        y)
+{
+    switch(alg)
+    {
+    case rocsparse_csrmv_alg_stream:
+        return rocsparse_csrmv_general_template(handle,
+                                                trans,
+                                                m,
+                                                n,
+                                                nnz,
+                                                alpha_device_host,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                x,
+                                                beta_device_host,
+                                                y);
+    case rocsparse_csrmv_alg_adaptive:
+        return rocsparse_csrmv_adaptive_template(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 alpha_device_host,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 info->csrmv_info,
+                                                 x,
+                                                 beta_device_host,
+                                                 y);
+    case rocsparse_csrmv_alg_merge_path:
+        return rocsparse_csrmv_merge_path_template(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   alpha_device_host,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   x,
+                                                   beta_device_host,
+                                                   y);
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+// Argument checks and algorithm dispatch of rocsparse_csrmv_template and
+// rocsparse_csrmv_ex_template
+template <typename T>
+static rocsparse_status rocsparse_csrmv_alg_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_csrmv_alg       alg,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     const T*                  alpha_device_host,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     const T*                  x,
+                                                     const T*                  beta_device_host,
+                                                     T*                        y)
+{
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check algorithm
+    if(alg != rocsparse_csrmv_alg_stream && alg != rocsparse_csrmv_alg_adaptive
+       && alg != rocsparse_csrmv_alg_merge_path)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Symmetric, Hermitian and triangular matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    //
+    // Another quick return.
+    //
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    //
+    // Check the rest of pointer arguments
+    //
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The adaptive algorithm requires the csrmv info of the analysis step
+    if(alg == rocsparse_csrmv_alg_adaptive && (info == nullptr || info->csrmv_info == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_dispatch(handle,
+                                        trans,
+                                        alg,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta_device_host,
+                                        y);
+    }
+    else
+    {
+        return rocsparse_csrmv_dispatch(handle,
+                                        trans,
+                                        alg,
+                                        m,
+                                        n,
+                                        nnz,
+                                        *alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        *beta_device_host,
+                                        y);
+    }
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -834,130 +1743,121 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                   (const void*&)y);
     }
 
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0 || n < 0 || nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Quick return if possible
-    if(m == 0 || n == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Check pointer arguments
-    if(alpha_device_host == nullptr || beta_device_host == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
+    // Use the adaptive algorithm, if csrmv info is available
+    rocsparse_csrmv_alg alg = (info != nullptr && info->csrmv_info != nullptr)
+                                  ? rocsparse_csrmv_alg_adaptive
+                                  : rocsparse_csrmv_alg_stream;
+
+    return rocsparse_csrmv_alg_template(handle,
+                                        trans,
+                                        alg,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta_device_host,
+                                        y);
+}
 
-    //
-    // Another quick return.
-    //
-    if(handle->pointer_mode == rocsparse_pointer_mode_host
-       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+template <typename T>
+rocsparse_status rocsparse_csrmv_ex_template(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_csrmv_alg       alg,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const T*                  alpha_device_host,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const T*                  x,
+                                             const T*                  beta_device_host,
+                                             T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
     {
-        return rocsparse_status_success;
+        return rocsparse_status_invalid_handle;
     }
 
-    //
-    // Check the rest of pointer arguments
-    //
-    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
-       || y == nullptr)
+    if(descr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
 
-    if(info == nullptr || info->csrmv_info == nullptr)
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
-        // If csrmv info is not available, call csrmv general
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_ex"),
+                  trans,
+                  alg,
+                  m,
+                  n,
+                  nnz,
+                  *alpha_device_host,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta_device_host,
+                  (const void*&)y,
+                  (const void*&)info);
 
-            return rocsparse_csrmv_general_template(handle,
-                                                    trans,
-                                                    m,
-                                                    n,
-                                                    nnz,
-                                                    alpha_device_host,
-                                                    descr,
-                                                    csr_val,
-                                                    csr_row_ptr,
-                                                    csr_col_ind,
-                                                    x,
-                                                    beta_device_host,
-                                                    y);
-        }
-        else
-        {
-            return rocsparse_csrmv_general_template(handle,
-                                                    trans,
-                                                    m,
-                                                    n,
-                                                    nnz,
-                                                    *alpha_device_host,
-                                                    descr,
-                                                    csr_val,
-                                                    csr_row_ptr,
-                                                    csr_col_ind,
-                                                    x,
-                                                    *beta_device_host,
-                                                    y);
-        }
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--csrmv-alg",
+                  alg,
+                  "--alpha",
+                  *alpha_device_host,
+                  "--beta",
+                  *beta_device_host);
     }
     else
     {
-        // If csrmv info is available, call csrmv adaptive
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-
-            return rocsparse_csrmv_adaptive_template(handle,
-                                                     trans,
-                                                     m,
-                                                     n,
-                                                     nnz,
-                                                     alpha_device_host,
-                                                     descr,
-                                                     csr_val,
-                                                     csr_row_ptr,
-                                                     csr_col_ind,
-                                                     info->csrmv_info,
-                                                     x,
-                                                     beta_device_host,
-                                                     y);
-        }
-        else
-        {
-
-            return rocsparse_csrmv_adaptive_template(handle,
-                                                     trans,
-                                                     m,
-                                                     n,
-                                                     nnz,
-                                                     *alpha_device_host,
-                                                     descr,
-                                                     csr_val,
-                                                     csr_row_ptr,
-                                                     csr_col_ind,
-                                                     info->csrmv_info,
-                                                     x,
-                                                     *beta_device_host,
-                                                     y);
-        }
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_ex"),
+                  trans,
+                  alg,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha_device_host,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta_device_host,
+                  (const void*&)y);
     }
+
+    return rocsparse_csrmv_alg_template(handle,
+                                        trans,
+                                        alg,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta_device_host,
+                                        y);
 }
 
 /*
@@ -1033,6 +1933,49 @@ C_IMPL(rocsparse_ccsrmv, rocsparse_float_complex);
 C_IMPL(rocsparse_zcsrmv, rocsparse_double_complex);
 #undef C_IMPL
 
+//
+// rocsparse_xcsrmv_ex
+//
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_operation       trans,       \
+                                     rocsparse_csrmv_alg       alg,         \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             n,           \
+                                     rocsparse_int             nnz,         \
+                                     const TYPE*               alpha,       \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     const TYPE*               x,           \
+                                     const TYPE*               beta,        \
+                                     TYPE*                     y)           \
+    {                                                                       \
+        return rocsparse_csrmv_ex_template(handle,                          \
+                                           trans,                           \
+                                           alg,                             \
+                                           m,                               \
+                                           n,                               \
+                                           nnz,                             \
+                                           alpha,                           \
+                                           descr,                           \
+                                           csr_val,                         \
+                                           csr_row_ptr,                     \
+                                           csr_col_ind,                     \
+                                           info,                            \
+                                           x,                               \
+                                           beta,                            \
+                                           y);                              \
+    }
+
+C_IMPL(rocsparse_scsrmv_ex, float);
+C_IMPL(rocsparse_dcsrmv_ex, double);
+C_IMPL(rocsparse_ccsrmv_ex, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmv_ex, rocsparse_double_complex);
+#undef C_IMPL
+
 extern "C" rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info)
 {
     // Check for valid handle and matrix descriptor
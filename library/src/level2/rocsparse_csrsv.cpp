@@ -24,6 +24,107 @@
 
 #include "rocsparse_csrsv.hpp"
 
+#include <algorithm>
+#include <vector>
+
+rocsparse_status rocsparse_trm_level_info(rocsparse_handle      handle,
+                                          rocsparse_trm_info    info,
+                                          rocsparse_fill_mode   fill_mode,
+                                          rocsparse_level_info* level_info)
+{
+    *level_info = {};
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    if(info == nullptr || info->m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int m   = info->m;
+    rocsparse_int nnz = info->nnz;
+
+    std::vector<rocsparse_int> row_ptr(m + 1);
+    std::vector<rocsparse_int> col_ind(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr.data(),
+                                       info->trm_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(col_ind.data(),
+                                       info->trm_col_ind,
+                                       sizeof(rocsparse_int) * nnz,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The row pointer array starts with the index base
+    rocsparse_int base = row_ptr[0];
+
+    // Level and accumulated work of the dependency chain of each row. The work of a row
+    // is one plus its number of off-diagonal entries in the triangular part.
+    std::vector<rocsparse_int> level(m, 0);
+    std::vector<int64_t>       chain(m, 0);
+
+    bool    lower = (fill_mode == rocsparse_fill_mode_lower);
+    int64_t work  = 0;
+
+    for(rocsparse_int k = 0; k < m; ++k)
+    {
+        rocsparse_int i = lower ? k : m - 1 - k;
+
+        int64_t row_work = 1;
+
+        for(rocsparse_int j = row_ptr[i] - base; j < row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = col_ind[j] - base;
+
+            if(lower ? (col < i) : (col > i && col < m))
+            {
+                level[i] = std::max(level[i], level[col] + 1);
+                chain[i] = std::max(chain[i], chain[col]);
+                ++row_work;
+            }
+        }
+
+        chain[i] += row_work;
+        work += row_work;
+    }
+
+    level_info->levels        = *std::max_element(level.begin(), level.end()) + 1;
+    level_info->critical_path = *std::max_element(chain.begin(), chain.end());
+    level_info->parallelism   = static_cast<double>(work) / level_info->critical_path;
+
+    // Level widths
+    std::vector<rocsparse_int> width(level_info->levels, 0);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        ++width[level[i]];
+    }
+
+    level_info->min_width = *std::min_element(width.begin(), width.end());
+    level_info->max_width = *std::max_element(width.begin(), width.end());
+
+    // The last bin also counts all wider levels
+    for(rocsparse_int w : width)
+    {
+        int bin = 0;
+        while(bin < 31 && (static_cast<int64_t>(2) << bin) <= w)
+        {
+            ++bin;
+        }
+
+        ++level_info->width_histogram[bin];
+    }
+
+    return rocsparse_status_success;
+}
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -458,3 +559,61 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       const rocsparse_mat_descr descr,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_level_info*     level_info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_level_info",
+              trans,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)level_info);
+
+    // Check pointer arguments
+    if(level_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    bool lower = (descr->fill_mode == rocsparse_fill_mode_lower);
+
+    // The transposed analysis is performed on the transposed matrix, such that the
+    // triangular part is flipped
+    if(trans == rocsparse_operation_none)
+    {
+        return rocsparse_trm_level_info(handle,
+                                        lower ? info->csrsv_lower_info : info->csrsv_upper_info,
+                                        descr->fill_mode,
+                                        level_info);
+    }
+
+    return rocsparse_trm_level_info(handle,
+                                    lower ? info->csrsvt_lower_info : info->csrsvt_upper_info,
+                                    lower ? rocsparse_fill_mode_upper : rocsparse_fill_mode_lower,
+                                    level_info);
+}
@@ -35,6 +35,13 @@
 
 #include <rocprim/rocprim.hpp>
 
+// Compute the level schedule of the analysis meta data on the host. Rows depend on
+// the entries of the triangular part given by fill_mode.
+rocsparse_status rocsparse_trm_level_info(rocsparse_handle      handle,
+                                          rocsparse_trm_info    info,
+                                          rocsparse_fill_mode   fill_mode,
+                                          rocsparse_level_info* level_info);
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
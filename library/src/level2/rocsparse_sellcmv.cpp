@@ -0,0 +1,71 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_sellcmv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_operation       trans,           \
+                                     rocsparse_int             m,               \
+                                     rocsparse_int             n,               \
+                                     const TYPE*               alpha,           \
+                                     const rocsparse_mat_descr descr,           \
+                                     const TYPE*               sell_val,        \
+                                     const rocsparse_int*      sell_slice_ptr,  \
+                                     const rocsparse_int*      sell_col_ind,    \
+                                     const rocsparse_int*      sell_perm,       \
+                                     rocsparse_int             sell_slice_size, \
+                                     const TYPE*               x,               \
+                                     const TYPE*               beta,            \
+                                     TYPE*                     y)               \
+    {                                                                           \
+        return rocsparse_sellcmv_template(handle,                               \
+                                          trans,                                \
+                                          m,                                    \
+                                          n,                                    \
+                                          alpha,                                \
+                                          descr,                                \
+                                          sell_val,                             \
+                                          sell_slice_ptr,                       \
+                                          sell_col_ind,                         \
+                                          sell_perm,                            \
+                                          sell_slice_size,                      \
+                                          x,                                    \
+                                          beta,                                 \
+                                          y);                                   \
+    }
+
+C_IMPL(rocsparse_ssellcmv, float);
+C_IMPL(rocsparse_dsellcmv, double);
+C_IMPL(rocsparse_csellcmv, rocsparse_float_complex);
+C_IMPL(rocsparse_zsellcmv, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,273 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_SELLCMV_HPP
+#define ROCSPARSE_SELLCMV_HPP
+
+#include "definitions.h"
+#include "sellcmv_device.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void sellcmvn_kernel(rocsparse_int m,
+                         rocsparse_int n,
+                         rocsparse_int slice_size,
+                         U             alpha_device_host,
+                         const T* __restrict__ sell_val,
+                         const rocsparse_int* __restrict__ sell_slice_ptr,
+                         const rocsparse_int* __restrict__ sell_col_ind,
+                         const rocsparse_int* __restrict__ sell_perm,
+                         const T* __restrict__ x,
+                         U beta_device_host,
+                         T* __restrict__ y,
+                         rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        sellcmvn_device<BLOCKSIZE>(m,
+                                   n,
+                                   slice_size,
+                                   alpha,
+                                   sell_val,
+                                   sell_slice_ptr,
+                                   sell_col_ind,
+                                   sell_perm,
+                                   x,
+                                   beta,
+                                   y,
+                                   idx_base);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_sellcmv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  sell_val,
+                                            const rocsparse_int*      sell_slice_ptr,
+                                            const rocsparse_int*      sell_col_ind,
+                                            const rocsparse_int*      sell_perm,
+                                            rocsparse_int             sell_slice_size,
+                                            const T*                  x,
+                                            const T*                  beta,
+                                            T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcmv"),
+                  trans,
+                  m,
+                  n,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)sell_val,
+                  (const void*&)sell_slice_ptr,
+                  (const void*&)sell_col_ind,
+                  (const void*&)sell_perm,
+                  sell_slice_size,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f sellcmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--slice-size",
+                  sell_slice_size,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsellcmv"),
+                  trans,
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)sell_val,
+                  (const void*&)sell_slice_ptr,
+                  (const void*&)sell_col_ind,
+                  (const void*&)sell_perm,
+                  sell_slice_size,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sell_slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(sell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different sellcmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define SELLCMVN_DIM 512
+        dim3 sellcmvn_blocks((m - 1) / SELLCMVN_DIM + 1);
+        dim3 sellcmvn_threads(SELLCMVN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((sellcmvn_kernel<SELLCMVN_DIM>),
+                               sellcmvn_blocks,
+                               sellcmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               sell_slice_size,
+                               alpha,
+                               sell_val,
+                               sell_slice_ptr,
+                               sell_col_ind,
+                               sell_perm,
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((sellcmvn_kernel<SELLCMVN_DIM>),
+                               sellcmvn_blocks,
+                               sellcmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               sell_slice_size,
+                               *alpha,
+                               sell_val,
+                               sell_slice_ptr,
+                               sell_col_ind,
+                               sell_perm,
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+#undef SELLCMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SELLCMV_HPP
@@ -0,0 +1,93 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef SELLCMV_DEVICE_H
+#define SELLCMV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// SELL-C-sigma SpMV for general, non-transposed matrices. Each thread processes a
+// row of a slice. Since the rows of a slice are stored column-major, consecutive
+// threads access consecutive entries of the slice.
+template <unsigned int BLOCKSIZE, typename T>
+static __device__ void sellcmvn_device(rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int slice_size,
+                                       T             alpha,
+                                       const T* __restrict__ sell_val,
+                                       const rocsparse_int* __restrict__ sell_slice_ptr,
+                                       const rocsparse_int* __restrict__ sell_col_ind,
+                                       const rocsparse_int* __restrict__ sell_perm,
+                                       const T* __restrict__ x,
+                                       T beta,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int s    = ai / slice_size;
+    rocsparse_int lane = ai % slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[s] - idx_base + lane;
+    rocsparse_int width       = (sell_slice_ptr[s + 1] - sell_slice_ptr[s]) / slice_size;
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int idx = slice_begin + p * slice_size;
+        rocsparse_int col = rocsparse_nontemporal_load(sell_col_ind + idx) - idx_base;
+
+        // Padded entries are stored at the end of each row
+        if(col >= 0 && col < n)
+        {
+            sum = rocsparse_fma(
+                rocsparse_nontemporal_load(sell_val + idx), rocsparse_ldg(x + col), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    rocsparse_int row = sell_perm[ai];
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // SELLCMV_DEVICE_H
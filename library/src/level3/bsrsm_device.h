@@ -0,0 +1,278 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRSM_DEVICE_H
+#define BSRSM_DEVICE_H
+
+#include "common.h"
+
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__device__ void bsrsm_device(rocsparse_int mb,
+                             rocsparse_int nrhs,
+                             T             alpha,
+                             const rocsparse_int* __restrict__ bsr_row_ptr,
+                             const rocsparse_int* __restrict__ bsr_col_ind,
+                             const T* __restrict__ bsr_val,
+                             rocsparse_int bsr_dim,
+                             T* __restrict__ X,
+                             rocsparse_int ldx,
+                             int* __restrict__ done_array,
+                             rocsparse_int* __restrict__ map,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode  fill_mode,
+                             rocsparse_diag_type  diag_type,
+                             rocsparse_direction  dir)
+{
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x % mb;
+
+    // Shared memory to hold a chunk of the current BSR block
+    __shared__ T sbsr_val[BLOCKSIZE];
+
+    // Get the BSR row this thread block will operate on
+    rocsparse_int row = map[idx];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // Column index into X
+    rocsparse_int col_X = hipBlockIdx_x / mb * BLOCKSIZE + hipThreadIdx_x;
+
+    // Index into done array
+    rocsparse_int id = hipBlockIdx_x / mb * mb;
+
+    // Number of entries per BSR block
+    rocsparse_int bsr_nnz = bsr_dim * bsr_dim;
+
+    // Initialize X with alpha and B
+    if(col_X < nrhs)
+    {
+        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        {
+            X[(row * bsr_dim + bi) * ldx + col_X] *= alpha;
+        }
+    }
+
+    // Diagonal block entry point
+    rocsparse_int diag_j = -1;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        // Current column block (uniform across the thread block)
+        rocsparse_int local_col = bsr_col_ind[j] - idx_base;
+
+        // Diagonal block is processed after all off-diagonal blocks
+        if(local_col == row)
+        {
+            diag_j = j;
+
+            if(fill_mode == rocsparse_fill_mode_lower)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        // Ignore all blocks that are not part of the triangular matrix
+        if(fill_mode == rocsparse_fill_mode_upper && local_col < row)
+        {
+            continue;
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower && local_col > row)
+        {
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        if(hipThreadIdx_x == 0)
+        {
+            int          local_done    = atomicOr(&done_array[local_col + id], 0);
+            unsigned int times_through = 0;
+            while(!local_done)
+            {
+                if(SLEEP)
+                {
+                    for(unsigned int i = 0; i < times_through; ++i)
+                    {
+                        __builtin_amdgcn_s_sleep(1);
+                    }
+
+                    if(times_through < 3907)
+                    {
+                        ++times_through;
+                    }
+                }
+
+                local_done = atomicOr(&done_array[local_col + id], 0);
+            }
+        }
+
+        // Wait for spin looping thread to finish as the whole block depends on this row
+        __syncthreads();
+
+        // Make sure updated X is visible globally
+        __threadfence();
+
+        // Subtract the off-diagonal block times the already solved block row of X.
+        // The block is staged through shared memory in chunks of BLOCKSIZE entries,
+        // such that it is loaded only once for all rhs columns of this thread block.
+        for(rocsparse_int k = 0; k < bsr_nnz; k += BLOCKSIZE)
+        {
+            // Wait for all threads to finish reading the previous chunk
+            __syncthreads();
+
+            if(hipThreadIdx_x < bsr_nnz - k)
+            {
+                sbsr_val[hipThreadIdx_x] = bsr_val[bsr_nnz * j + k + hipThreadIdx_x];
+            }
+
+            // Wait for preload to finish
+            __syncthreads();
+
+            if(col_X < nrhs)
+            {
+                rocsparse_int chunk = min(static_cast<rocsparse_int>(BLOCKSIZE), bsr_nnz - k);
+
+                // Position of the first chunk entry inside the BSR block
+                rocsparse_int outer = k / bsr_dim;
+                rocsparse_int inner = k % bsr_dim;
+
+                for(rocsparse_int l = 0; l < chunk; ++l)
+                {
+                    rocsparse_int bi = (dir == rocsparse_direction_row) ? outer : inner;
+                    rocsparse_int bj = (dir == rocsparse_direction_row) ? inner : outer;
+
+                    rocsparse_int idx_X = (row * bsr_dim + bi) * ldx + col_X;
+
+                    X[idx_X] = rocsparse_fma(
+                        -sbsr_val[l], X[(local_col * bsr_dim + bj) * ldx + col_X], X[idx_X]);
+
+                    if(++inner == bsr_dim)
+                    {
+                        inner = 0;
+                        ++outer;
+                    }
+                }
+            }
+        }
+    }
+
+    bool pivot = false;
+
+    // Process diagonal block
+    if(diag_j != -1 && col_X < nrhs)
+    {
+        if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                // Load diagonal matrix entry
+                T diag = (diag_type == rocsparse_diag_type_non_unit)
+                             ? bsr_val[BSR_IND(diag_j, bi, bi, dir)]
+                             : static_cast<T>(1);
+
+                rocsparse_int idx_X = (row * bsr_dim + bi) * ldx + col_X;
+
+                // Load result of bi-th BSR row
+                T val = X[idx_X];
+
+                // Check for numerical pivot
+                if(diag == static_cast<T>(0))
+                {
+                    pivot = true;
+                }
+                else
+                {
+                    // Divide result of bi-th BSR row by diagonal entry
+                    X[idx_X] = val /= diag;
+                }
+
+                // Update remaining rows of the block
+                for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                {
+                    rocsparse_int idx_Y = (row * bsr_dim + bj) * ldx + col_X;
+
+                    X[idx_Y] = rocsparse_fma(-bsr_val[BSR_IND(diag_j, bj, bi, dir)], val, X[idx_Y]);
+                }
+            }
+        }
+        else
+        {
+            for(rocsparse_int bi = bsr_dim - 1; bi >= 0; --bi)
+            {
+                // Load diagonal matrix entry
+                T diag = (diag_type == rocsparse_diag_type_non_unit)
+                             ? bsr_val[BSR_IND(diag_j, bi, bi, dir)]
+                             : static_cast<T>(1);
+
+                rocsparse_int idx_X = (row * bsr_dim + bi) * ldx + col_X;
+
+                // Load result of bi-th BSR row
+                T val = X[idx_X];
+
+                // Check for numerical pivot
+                if(diag == static_cast<T>(0))
+                {
+                    pivot = true;
+                }
+                else
+                {
+                    // Divide result of bi-th BSR row by diagonal entry
+                    X[idx_X] = val /= diag;
+                }
+
+                // Update remaining rows of the block
+                for(rocsparse_int bj = 0; bj < bi; ++bj)
+                {
+                    rocsparse_int idx_Y = (row * bsr_dim + bj) * ldx + col_X;
+
+                    X[idx_Y] = rocsparse_fma(-bsr_val[BSR_IND(diag_j, bj, bi, dir)], val, X[idx_Y]);
+                }
+            }
+        }
+    }
+
+    // Wait for all threads to finish writing into global memory before we mark the row "done"
+    __syncthreads();
+
+    // Make sure X is written to global memory before setting row is done flag
+    __threadfence();
+
+    if(hipThreadIdx_x == 0)
+    {
+        // Write the "row is done" flag
+        atomicOr(&done_array[row + id], 1);
+
+        if(pivot == true)
+        {
+            atomicMin(zero_pivot, row + idx_base);
+        }
+    }
+}
+
+#endif // BSRSM_DEVICE_H
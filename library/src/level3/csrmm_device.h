@@ -168,4 +168,137 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
     }
 }
 
+// csrmm for symmetric, Hermitian and triangular matrices, where only the triangle given
+// by uplo and the diagonal are read from A. Each wavefront processes one row of A and
+// each lane one column of C. The column part of the stored triangle is scattered by
+// csrmms_scatter_device afterwards.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static __device__ void csrmms_general_device(rocsparse_int M,
+                                             rocsparse_int N,
+                                             T             alpha,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             rocsparse_operation trans_B,
+                                             const T* __restrict__ B,
+                                             rocsparse_int ldb,
+                                             T             beta,
+                                             T* __restrict__ C,
+                                             rocsparse_int          ldc,
+                                             rocsparse_matrix_parts parts,
+                                             rocsparse_fill_mode    uplo,
+                                             rocsparse_diag_type    diag,
+                                             rocsparse_index_base   idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
+
+    if(col >= N)
+    {
+        return;
+    }
+
+    // Strides of B, such that B(k, col) = B[k * incb + colB]
+    rocsparse_int incb = (trans_B == rocsparse_operation_none) ? 1 : ldb;
+    rocsparse_int colB = (trans_B == rocsparse_operation_none) ? col * ldb : col;
+    rocsparse_int colC = col * ldc;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = (diag == rocsparse_diag_type_unit) ? B[row * incb + colB] : static_cast<T>(0);
+
+        for(rocsparse_int j = row_start; j < row_end; ++j)
+        {
+            rocsparse_int k = csr_col_ind[j] - idx_base;
+
+            if(k == row)
+            {
+                if(diag == rocsparse_diag_type_non_unit)
+                {
+                    T val = parts.diag_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+                    sum   = rocsparse_fma(val, B[k * incb + colB], sum);
+                }
+            }
+            else if(parts.row && (lower ? k < row : k > row))
+            {
+                T val = parts.row_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+                sum   = rocsparse_fma(val, B[k * incb + colB], sum);
+            }
+        }
+
+        if(beta == static_cast<T>(0))
+        {
+            C[row + colC] = alpha * sum;
+        }
+        else
+        {
+            C[row + colC] = rocsparse_fma(beta, C[row + colC], alpha * sum);
+        }
+    }
+}
+
+// Column part of csrmms_general_device. Each wavefront processes one stored row and
+// scatters it into C using atomics.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static __device__ void csrmms_scatter_device(rocsparse_int M,
+                                             rocsparse_int N,
+                                             T             alpha,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             rocsparse_operation trans_B,
+                                             const T* __restrict__ B,
+                                             rocsparse_int ldb,
+                                             T* __restrict__ C,
+                                             rocsparse_int          ldc,
+                                             rocsparse_matrix_parts parts,
+                                             rocsparse_fill_mode    uplo,
+                                             rocsparse_index_base   idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
+
+    if(col >= N)
+    {
+        return;
+    }
+
+    rocsparse_int incb = (trans_B == rocsparse_operation_none) ? 1 : ldb;
+    rocsparse_int colB = (trans_B == rocsparse_operation_none) ? col * ldb : col;
+    rocsparse_int colC = col * ldc;
+
+    bool lower = (uplo == rocsparse_fill_mode_lower);
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T scale = alpha * B[row * incb + colB];
+
+        for(rocsparse_int j = row_start; j < row_end; ++j)
+        {
+            rocsparse_int k = csr_col_ind[j] - idx_base;
+
+            if(lower ? k < row : k > row)
+            {
+                T val = parts.col_conj ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+                atomicAdd(&C[k + colC], scale * val);
+            }
+        }
+    }
+}
+
 #endif // CSRMM_DEVICE_H
@@ -0,0 +1,167 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRSDDMM_DEVICE_H
+#define CSRSDDMM_DEVICE_H
+
+#include "common.h"
+
+// Load an entry of op(A) or op(B) from column major storage. The offset is computed from the
+// strides of the operated matrix, e.g. (1, lda) for non-transposed and (lda, 1) for
+// (conjugate) transposed A.
+template <typename T>
+static __device__ __forceinline__ T csrsddmm_load(const T* __restrict__ X,
+                                                  rocsparse_int offset,
+                                                  bool          conj)
+{
+    T val = rocsparse_ldg(X + offset);
+    return conj ? rocsparse_conj(val) : val;
+}
+
+// Short k variant: each lane of a sub-wavefront computes the full dot product of length k for
+// one entry of the sparsity pattern. The row of op(A) is shared by all lanes of the
+// sub-wavefront and thus stays in cache.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+static __device__ void csrsddmm_short_device(rocsparse_int m,
+                                             rocsparse_int k,
+                                             T             alpha,
+                                             const T* __restrict__ A,
+                                             rocsparse_int inc_A_row,
+                                             rocsparse_int inc_A_col,
+                                             bool          conj_A,
+                                             const T* __restrict__ B,
+                                             rocsparse_int inc_B_row,
+                                             rocsparse_int inc_B_col,
+                                             bool          conj_B,
+                                             T             beta,
+                                             T* __restrict__ csr_val,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Each lane processes one non-zero entry of the row
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int l = 0; l < k; ++l)
+            {
+                T val_A = csrsddmm_load(A, row * inc_A_row + l * inc_A_col, conj_A);
+                T val_B = csrsddmm_load(B, l * inc_B_row + col * inc_B_col, conj_B);
+
+                sum = rocsparse_fma(val_A, val_B, sum);
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                csr_val[j] = alpha * sum;
+            }
+            else
+            {
+                csr_val[j] = rocsparse_fma(beta, csr_val[j], alpha * sum);
+            }
+        }
+    }
+}
+
+// Long k variant: each sub-wavefront processes one row and computes the dot products of its
+// non-zero entries cooperatively, every lane accumulating a strided part of the k dimension.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+static __device__ void csrsddmm_long_device(rocsparse_int m,
+                                            rocsparse_int k,
+                                            T             alpha,
+                                            const T* __restrict__ A,
+                                            rocsparse_int inc_A_row,
+                                            rocsparse_int inc_A_col,
+                                            bool          conj_A,
+                                            const T* __restrict__ B,
+                                            rocsparse_int inc_B_row,
+                                            rocsparse_int inc_B_col,
+                                            bool          conj_B,
+                                            T             beta,
+                                            T* __restrict__ csr_val,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Loop over non-zero entries of the row
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int l = lid; l < k; l += WF_SIZE)
+            {
+                T val_A = csrsddmm_load(A, row * inc_A_row + l * inc_A_col, conj_A);
+                T val_B = csrsddmm_load(B, l * inc_B_row + col * inc_B_col, conj_B);
+
+                sum = rocsparse_fma(val_A, val_B, sum);
+            }
+
+            // Obtain dot product using parallel reduction
+            sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+            // Last lane of each sub-wavefront writes result into global memory
+            if(lid == WF_SIZE - 1)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    csr_val[j] = alpha * sum;
+                }
+                else
+                {
+                    csr_val[j] = rocsparse_fma(beta, csr_val[j], alpha * sum);
+                }
+            }
+        }
+    }
+}
+
+#endif // CSRSDDMM_DEVICE_H
@@ -0,0 +1,597 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_bsrsm.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_bsrsm_zero_pivot(rocsparse_handle   handle,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_bsrsm_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If mb == 0 || nrhs == 0 || nnzb == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int zero_pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &zero_pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(zero_pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sbsrsm_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_X,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             nrhs,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             block_dim,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size)
+{
+    return rocsparse_bsrsm_buffer_size_template(handle,
+                                                dir,
+                                                trans_A,
+                                                trans_X,
+                                                mb,
+                                                nrhs,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrsm_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_X,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             nrhs,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             block_dim,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size)
+{
+    return rocsparse_bsrsm_buffer_size_template(handle,
+                                                dir,
+                                                trans_A,
+                                                trans_X,
+                                                mb,
+                                                nrhs,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrsm_buffer_size(rocsparse_handle               handle,
+                                                         rocsparse_direction            dir,
+                                                         rocsparse_operation            trans_A,
+                                                         rocsparse_operation            trans_X,
+                                                         rocsparse_int                  mb,
+                                                         rocsparse_int                  nrhs,
+                                                         rocsparse_int                  nnzb,
+                                                         const rocsparse_mat_descr      descr,
+                                                         const rocsparse_float_complex* bsr_val,
+                                                         const rocsparse_int*           bsr_row_ptr,
+                                                         const rocsparse_int*           bsr_col_ind,
+                                                         rocsparse_int                  block_dim,
+                                                         rocsparse_mat_info             info,
+                                                         size_t*                        buffer_size)
+{
+    return rocsparse_bsrsm_buffer_size_template(handle,
+                                                dir,
+                                                trans_A,
+                                                trans_X,
+                                                mb,
+                                                nrhs,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrsm_buffer_size(rocsparse_handle                handle,
+                                                         rocsparse_direction             dir,
+                                                         rocsparse_operation             trans_A,
+                                                         rocsparse_operation             trans_X,
+                                                         rocsparse_int                   mb,
+                                                         rocsparse_int                   nrhs,
+                                                         rocsparse_int                   nnzb,
+                                                         const rocsparse_mat_descr       descr,
+                                                         const rocsparse_double_complex* bsr_val,
+                                                         const rocsparse_int* bsr_row_ptr,
+                                                         const rocsparse_int* bsr_col_ind,
+                                                         rocsparse_int        block_dim,
+                                                         rocsparse_mat_info   info,
+                                                         size_t*              buffer_size)
+{
+    return rocsparse_bsrsm_buffer_size_template(handle,
+                                                dir,
+                                                trans_A,
+                                                trans_X,
+                                                mb,
+                                                nrhs,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_sbsrsm_analysis(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_X,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nrhs,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy    solve,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_bsrsm_analysis_template(handle,
+                                             dir,
+                                             trans_A,
+                                             trans_X,
+                                             mb,
+                                             nrhs,
+                                             nnzb,
+                                             descr,
+                                             bsr_val,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             block_dim,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrsm_analysis(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_X,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nrhs,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy    solve,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_bsrsm_analysis_template(handle,
+                                             dir,
+                                             trans_A,
+                                             trans_X,
+                                             mb,
+                                             nrhs,
+                                             nnzb,
+                                             descr,
+                                             bsr_val,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             block_dim,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrsm_analysis(rocsparse_handle               handle,
+                                                      rocsparse_direction            dir,
+                                                      rocsparse_operation            trans_A,
+                                                      rocsparse_operation            trans_X,
+                                                      rocsparse_int                  mb,
+                                                      rocsparse_int                  nrhs,
+                                                      rocsparse_int                  nnzb,
+                                                      const rocsparse_mat_descr      descr,
+                                                      const rocsparse_float_complex* bsr_val,
+                                                      const rocsparse_int*           bsr_row_ptr,
+                                                      const rocsparse_int*           bsr_col_ind,
+                                                      rocsparse_int                  block_dim,
+                                                      rocsparse_mat_info             info,
+                                                      rocsparse_analysis_policy      analysis,
+                                                      rocsparse_solve_policy         solve,
+                                                      void*                          temp_buffer)
+{
+    return rocsparse_bsrsm_analysis_template(handle,
+                                             dir,
+                                             trans_A,
+                                             trans_X,
+                                             mb,
+                                             nrhs,
+                                             nnzb,
+                                             descr,
+                                             bsr_val,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             block_dim,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrsm_analysis(rocsparse_handle                handle,
+                                                      rocsparse_direction             dir,
+                                                      rocsparse_operation             trans_A,
+                                                      rocsparse_operation             trans_X,
+                                                      rocsparse_int                   mb,
+                                                      rocsparse_int                   nrhs,
+                                                      rocsparse_int                   nnzb,
+                                                      const rocsparse_mat_descr       descr,
+                                                      const rocsparse_double_complex* bsr_val,
+                                                      const rocsparse_int*            bsr_row_ptr,
+                                                      const rocsparse_int*            bsr_col_ind,
+                                                      rocsparse_int                   block_dim,
+                                                      rocsparse_mat_info              info,
+                                                      rocsparse_analysis_policy       analysis,
+                                                      rocsparse_solve_policy          solve,
+                                                      void*                           temp_buffer)
+{
+    return rocsparse_bsrsm_analysis_template(handle,
+                                             dir,
+                                             trans_A,
+                                             trans_X,
+                                             mb,
+                                             nrhs,
+                                             nnzb,
+                                             descr,
+                                             bsr_val,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             block_dim,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_bsrsm_clear(rocsparse_handle handle, rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_bsrsm_clear", (const void*&)info);
+
+    // Clear bsrsm meta data (this includes lower, upper and their transposed equivalents
+    if(!rocsparse_check_trm_shared(info, info->bsrsm_lower_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_lower_info));
+    }
+    if(!rocsparse_check_trm_shared(info, info->bsrsmt_lower_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsmt_lower_info));
+    }
+    if(!rocsparse_check_trm_shared(info, info->bsrsm_upper_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_upper_info));
+    }
+    if(!rocsparse_check_trm_shared(info, info->bsrsmt_upper_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsmt_upper_info));
+    }
+
+    info->bsrsm_lower_info  = nullptr;
+    info->bsrsmt_lower_info = nullptr;
+    info->bsrsm_upper_info  = nullptr;
+    info->bsrsmt_upper_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sbsrsm_solve(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_X,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnzb,
+                                                   const float*              alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   rocsparse_mat_info        info,
+                                                   const float*              B,
+                                                   rocsparse_int             ldb,
+                                                   float*                    X,
+                                                   rocsparse_int             ldx,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_bsrsm_solve_template(handle,
+                                          dir,
+                                          trans_A,
+                                          trans_X,
+                                          mb,
+                                          nrhs,
+                                          nnzb,
+                                          alpha,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          B,
+                                          ldb,
+                                          X,
+                                          ldx,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrsm_solve(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_X,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnzb,
+                                                   const double*             alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   rocsparse_mat_info        info,
+                                                   const double*             B,
+                                                   rocsparse_int             ldb,
+                                                   double*                   X,
+                                                   rocsparse_int             ldx,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_bsrsm_solve_template(handle,
+                                          dir,
+                                          trans_A,
+                                          trans_X,
+                                          mb,
+                                          nrhs,
+                                          nnzb,
+                                          alpha,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          B,
+                                          ldb,
+                                          X,
+                                          ldx,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrsm_solve(rocsparse_handle               handle,
+                                                   rocsparse_direction            dir,
+                                                   rocsparse_operation            trans_A,
+                                                   rocsparse_operation            trans_X,
+                                                   rocsparse_int                  mb,
+                                                   rocsparse_int                  nrhs,
+                                                   rocsparse_int                  nnzb,
+                                                   const rocsparse_float_complex* alpha,
+                                                   const rocsparse_mat_descr      descr,
+                                                   const rocsparse_float_complex* bsr_val,
+                                                   const rocsparse_int*           bsr_row_ptr,
+                                                   const rocsparse_int*           bsr_col_ind,
+                                                   rocsparse_int                  block_dim,
+                                                   rocsparse_mat_info             info,
+                                                   const rocsparse_float_complex* B,
+                                                   rocsparse_int                  ldb,
+                                                   rocsparse_float_complex*       X,
+                                                   rocsparse_int                  ldx,
+                                                   rocsparse_solve_policy         policy,
+                                                   void*                          temp_buffer)
+{
+    return rocsparse_bsrsm_solve_template(handle,
+                                          dir,
+                                          trans_A,
+                                          trans_X,
+                                          mb,
+                                          nrhs,
+                                          nnzb,
+                                          alpha,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          B,
+                                          ldb,
+                                          X,
+                                          ldx,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrsm_solve(rocsparse_handle                handle,
+                                                   rocsparse_direction             dir,
+                                                   rocsparse_operation             trans_A,
+                                                   rocsparse_operation             trans_X,
+                                                   rocsparse_int                   mb,
+                                                   rocsparse_int                   nrhs,
+                                                   rocsparse_int                   nnzb,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr       descr,
+                                                   const rocsparse_double_complex* bsr_val,
+                                                   const rocsparse_int*            bsr_row_ptr,
+                                                   const rocsparse_int*            bsr_col_ind,
+                                                   rocsparse_int                   block_dim,
+                                                   rocsparse_mat_info              info,
+                                                   const rocsparse_double_complex* B,
+                                                   rocsparse_int                   ldb,
+                                                   rocsparse_double_complex*       X,
+                                                   rocsparse_int                   ldx,
+                                                   rocsparse_solve_policy          policy,
+                                                   void*                           temp_buffer)
+{
+    return rocsparse_bsrsm_solve_template(handle,
+                                          dir,
+                                          trans_A,
+                                          trans_X,
+                                          mb,
+                                          nrhs,
+                                          nnzb,
+                                          alpha,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          B,
+                                          ldb,
+                                          X,
+                                          ldx,
+                                          policy,
+                                          temp_buffer);
+}
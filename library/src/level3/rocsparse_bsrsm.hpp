@@ -0,0 +1,1054 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRSM_HPP
+#define ROCSPARSE_BSRSM_HPP
+
+#include "../level2/bsrsv_device.h"
+#include "../level2/rocsparse_csrsv.hpp"
+#include "bsrsm_device.h"
+#include "csrsm_device.h"
+
+#define LAUNCH_BSRSM_GTHR_DIM(bsize, wfsize, dim)                      \
+    hipLaunchKernelGGL((bsrsv_gather<T, wfsize, bsize / wfsize, dim>), \
+                       dim3((wfsize * nnzb - 1) / bsize + 1),          \
+                       dim3(wfsize, bsize / wfsize),                   \
+                       0,                                              \
+                       stream,                                         \
+                       nnzb,                                           \
+                       bsrsm->trmt_perm,                               \
+                       bsr_val,                                        \
+                       bsrt_val,                                       \
+                       block_dim);
+
+#define LAUNCH_BSRSM_GTHR(bsize, wfsize, dim) \
+    if(dim <= 2)                              \
+    {                                         \
+        LAUNCH_BSRSM_GTHR_DIM(bsize, 4, 2)    \
+    }                                         \
+    else if(dim <= 4)                         \
+    {                                         \
+        LAUNCH_BSRSM_GTHR_DIM(bsize, 16, 4)   \
+    }                                         \
+    else if(wfsize == 32)                     \
+    {                                         \
+        LAUNCH_BSRSM_GTHR_DIM(bsize, 16, 4)   \
+    }                                         \
+    else                                      \
+    {                                         \
+        LAUNCH_BSRSM_GTHR_DIM(bsize, 64, 8)   \
+    }
+
+#define LAUNCH_BSRSM(ptr, bsize, arch, asic)    \
+    if(ptr == rocsparse_pointer_mode_host)      \
+    {                                           \
+        if(arch == 908 && asic < 2)             \
+        {                                       \
+            LAUNCH_BSRSM_HOSTPTR(bsize, true);  \
+        }                                       \
+        else                                    \
+        {                                       \
+            LAUNCH_BSRSM_HOSTPTR(bsize, false); \
+        }                                       \
+    }                                           \
+    else                                        \
+    {                                           \
+        if(arch == 908 && asic < 2)             \
+        {                                       \
+            LAUNCH_BSRSM_DEVPTR(bsize, true);   \
+        }                                       \
+        else                                    \
+        {                                       \
+            LAUNCH_BSRSM_DEVPTR(bsize, false);  \
+        }                                       \
+    }
+
+#define LAUNCH_BSRSM_HOSTPTR(bsize, arch)                    \
+    hipLaunchKernelGGL((bsrsm_host_pointer<T, bsize, arch>), \
+                       dim3(((nrhs - 1) / bsize + 1) * mb),  \
+                       dim3(bsize),                          \
+                       0,                                    \
+                       stream,                               \
+                       mb,                                   \
+                       nrhs,                                 \
+                       *alpha,                               \
+                       local_bsr_row_ptr,                    \
+                       local_bsr_col_ind,                    \
+                       local_bsr_val,                        \
+                       block_dim,                            \
+                       Xt,                                   \
+                       ldimX,                                \
+                       done_array,                           \
+                       bsrsm->row_map,                       \
+                       info->zero_pivot,                     \
+                       descr->base,                          \
+                       fill_mode,                            \
+                       descr->diag_type,                     \
+                       dir)
+
+#define LAUNCH_BSRSM_DEVPTR(bsize, arch)                       \
+    hipLaunchKernelGGL((bsrsm_device_pointer<T, bsize, arch>), \
+                       dim3(((nrhs - 1) / bsize + 1) * mb),    \
+                       dim3(bsize),                            \
+                       0,                                      \
+                       stream,                                 \
+                       mb,                                     \
+                       nrhs,                                   \
+                       alpha,                                  \
+                       local_bsr_row_ptr,                      \
+                       local_bsr_col_ind,                      \
+                       local_bsr_val,                          \
+                       block_dim,                              \
+                       Xt,                                     \
+                       ldimX,                                  \
+                       done_array,                             \
+                       bsrsm->row_map,                         \
+                       info->zero_pivot,                       \
+                       descr->base,                            \
+                       fill_mode,                              \
+                       descr->diag_type,                       \
+                       dir)
+
+// Number of rhs columns that are processed by a single thread block
+static inline int rocsparse_bsrsm_blockdim(rocsparse_int nrhs)
+{
+    int blockdim = 512;
+    while(nrhs <= blockdim && blockdim > 32)
+    {
+        blockdim >>= 1;
+    }
+
+    return blockdim << 1;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_buffer_size_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_X,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nrhs,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info,
+                                                      size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrsm_buffer_size"),
+              dir,
+              trans_A,
+              trans_X,
+              mb,
+              nrhs,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none && trans_A != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_X != rocsparse_operation_none && trans_X != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of rows of the sparse matrix
+    rocsparse_int m = mb * block_dim;
+
+    // rocsparse_int max_nnz
+    *buffer_size = 256;
+
+    // Each thread block performs at most blockdim columns of the
+    // rhs matrix. Therefore, the number of blocks depend on nrhs
+    // and the blocksize.
+    int narrays = (nrhs - 1) / rocsparse_bsrsm_blockdim(nrhs) + 1;
+
+    // int done_array
+    *buffer_size += sizeof(int) * ((mb * narrays - 1) / 256 + 1) * 256;
+
+    // rocsparse_int workspace
+    *buffer_size += sizeof(rocsparse_int) * ((mb - 1) / 256 + 1) * 256;
+
+    // int workspace2
+    *buffer_size += sizeof(int) * ((mb - 1) / 256 + 1) * 256;
+
+    size_t         rocprim_size;
+    rocsparse_int* ptr  = reinterpret_cast<rocsparse_int*>(buffer_size);
+    int*           ptr2 = reinterpret_cast<int*>(buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+    rocprim::double_buffer<int>           dummy2(ptr2, ptr2);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy2, dummy, mb, 0, 32, stream));
+
+    // rocprim buffer
+    *buffer_size += rocprim_size;
+
+    // Additional buffer to store transpose of B, if trans_X == rocsparse_operation_none
+    if(trans_X == rocsparse_operation_none)
+    {
+        *buffer_size += sizeof(T) * ((m * nrhs - 1) / 256 + 1) * 256;
+    }
+
+    // Additional buffer to store transpose A, if trans_A == rocsparse_operation_transpose
+    if(trans_A == rocsparse_operation_transpose)
+    {
+        size_t transpose_size;
+
+        // Determine rocprim buffer size
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, transpose_size, dummy, dummy, nnzb, 0, 32, stream));
+
+        // rocPRIM does not support in-place sorting, so we need an additional buffer
+        transpose_size += sizeof(rocsparse_int) * ((nnzb - 1) / 256 + 1) * 256;
+
+        // Transposed BSR values
+        transpose_size += sizeof(T) * ((nnzb * block_dim * block_dim - 1) / 256 + 1) * 256;
+
+        *buffer_size += transpose_size;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_X,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnzb,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_analysis_policy analysis,
+                                                   rocsparse_solve_policy    solve,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrsm_analysis"),
+              dir,
+              trans_A,
+              trans_X,
+              mb,
+              nrhs,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              analysis,
+              solve,
+              (const void*&)temp_buffer);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none && trans_A != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_X != rocsparse_operation_none && trans_X != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Switch between lower and upper triangular analysis
+    if(descr->fill_mode == rocsparse_fill_mode_upper)
+    {
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed upper part, if available.
+            // It is the user's responsibility that this data is still valid,
+            // since he passed the 'reuse' flag.
+
+            // If bsrsm meta data is already available, do nothing
+            if(trans_A == rocsparse_operation_none && info->bsrsm_upper_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+            else if(trans_A == rocsparse_operation_transpose && info->bsrsmt_upper_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Check for other upper analysis meta data
+
+            if(trans_A == rocsparse_operation_none && info->bsrsv_upper_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsm_upper_info = info->bsrsv_upper_info;
+                return rocsparse_status_success;
+            }
+
+            if(trans_A == rocsparse_operation_transpose && info->bsrsvt_upper_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsmt_upper_info = info->bsrsvt_upper_info;
+                return rocsparse_status_success;
+            }
+        }
+
+        // User is explicitly asking to force a re-analysis, or no valid data has been
+        // found to be re-used
+
+        // Clear bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info((trans_A == rocsparse_operation_none)
+                                                                 ? info->bsrsm_upper_info
+                                                                 : info->bsrsmt_upper_info));
+
+        // Create bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info((trans_A == rocsparse_operation_none)
+                                                                ? &info->bsrsm_upper_info
+                                                                : &info->bsrsmt_upper_info));
+
+        // Perform analysis on the block sparsity pattern
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                         trans_A,
+                                                         mb,
+                                                         nnzb,
+                                                         descr,
+                                                         bsr_val,
+                                                         bsr_row_ptr,
+                                                         bsr_col_ind,
+                                                         (trans_A == rocsparse_operation_none)
+                                                             ? info->bsrsm_upper_info
+                                                             : info->bsrsmt_upper_info,
+                                                         &info->zero_pivot,
+                                                         temp_buffer));
+    }
+    else
+    {
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed lower part, if available.
+            // It is the user's responsibility that this data is still valid,
+            // since he passed the 'reuse' flag.
+
+            // If bsrsm meta data is already available, do nothing
+            if(trans_A == rocsparse_operation_none && info->bsrsm_lower_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+            else if(trans_A == rocsparse_operation_transpose && info->bsrsmt_lower_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Check for other lower analysis meta data
+
+            if(trans_A == rocsparse_operation_none && info->bsrilu0_info != nullptr)
+            {
+                // bsrilu0 meta data
+                info->bsrsm_lower_info = info->bsrilu0_info;
+                return rocsparse_status_success;
+            }
+            else if(trans_A == rocsparse_operation_none && info->bsric0_info != nullptr)
+            {
+                // bsric0 meta data
+                info->bsrsm_lower_info = info->bsric0_info;
+                return rocsparse_status_success;
+            }
+            else if(trans_A == rocsparse_operation_none && info->bsrsv_lower_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsm_lower_info = info->bsrsv_lower_info;
+                return rocsparse_status_success;
+            }
+
+            if(trans_A == rocsparse_operation_transpose && info->bsrsvt_lower_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsmt_lower_info = info->bsrsvt_lower_info;
+                return rocsparse_status_success;
+            }
+        }
+
+        // User is explicitly asking to force a re-analysis, or no valid data has been
+        // found to be re-used
+
+        // Clear bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info((trans_A == rocsparse_operation_none)
+                                                                 ? info->bsrsm_lower_info
+                                                                 : info->bsrsmt_lower_info));
+
+        // Create bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info((trans_A == rocsparse_operation_none)
+                                                                ? &info->bsrsm_lower_info
+                                                                : &info->bsrsmt_lower_info));
+
+        // Perform analysis on the block sparsity pattern
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                         trans_A,
+                                                         mb,
+                                                         nnzb,
+                                                         descr,
+                                                         bsr_val,
+                                                         bsr_row_ptr,
+                                                         bsr_col_ind,
+                                                         (trans_A == rocsparse_operation_none)
+                                                             ? info->bsrsm_lower_info
+                                                             : info->bsrsmt_lower_info,
+                                                         &info->zero_pivot,
+                                                         temp_buffer));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrsm_host_pointer(rocsparse_int mb,
+                            rocsparse_int nrhs,
+                            T             alpha,
+                            const rocsparse_int* __restrict__ bsr_row_ptr,
+                            const rocsparse_int* __restrict__ bsr_col_ind,
+                            const T* __restrict__ bsr_val,
+                            rocsparse_int bsr_dim,
+                            T* __restrict__ X,
+                            rocsparse_int ldx,
+                            int* __restrict__ done_array,
+                            rocsparse_int* __restrict__ map,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type,
+                            rocsparse_direction  dir)
+{
+    bsrsm_device<T, BLOCKSIZE, SLEEP>(mb,
+                                      nrhs,
+                                      alpha,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      bsr_val,
+                                      bsr_dim,
+                                      X,
+                                      ldx,
+                                      done_array,
+                                      map,
+                                      zero_pivot,
+                                      idx_base,
+                                      fill_mode,
+                                      diag_type,
+                                      dir);
+}
+
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrsm_device_pointer(rocsparse_int mb,
+                              rocsparse_int nrhs,
+                              const T*      alpha,
+                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                              const rocsparse_int* __restrict__ bsr_col_ind,
+                              const T* __restrict__ bsr_val,
+                              rocsparse_int bsr_dim,
+                              T* __restrict__ X,
+                              rocsparse_int ldx,
+                              int* __restrict__ done_array,
+                              rocsparse_int* __restrict__ map,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type,
+                              rocsparse_direction  dir)
+{
+    bsrsm_device<T, BLOCKSIZE, SLEEP>(mb,
+                                      nrhs,
+                                      *alpha,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      bsr_val,
+                                      bsr_dim,
+                                      X,
+                                      ldx,
+                                      done_array,
+                                      map,
+                                      zero_pivot,
+                                      idx_base,
+                                      fill_mode,
+                                      diag_type,
+                                      dir);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_solve_template(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_X,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnzb,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                const T*                  B,
+                                                rocsparse_int             ldb,
+                                                T*                        X,
+                                                rocsparse_int             ldx,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrsm_solve"),
+                  dir,
+                  trans_A,
+                  trans_X,
+                  mb,
+                  nrhs,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)info,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)X,
+                  ldx,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f bsrsm -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--blockdim",
+                  block_dim,
+                  "-k",
+                  nrhs,
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrsm_solve"),
+                  dir,
+                  trans_A,
+                  trans_X,
+                  mb,
+                  nrhs,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)info,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)X,
+                  ldx,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none && trans_A != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_X != rocsparse_operation_none && trans_X != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Number of rows of the sparse matrix
+    rocsparse_int m = mb * block_dim;
+
+    // Check leading dimensions
+    if(trans_X == rocsparse_operation_none)
+    {
+        if(ldb < m || ldx < m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+    else
+    {
+        if(ldb < nrhs || ldx < nrhs)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(X == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // Each thread block performs at most blockdim columns of the
+    // rhs matrix. Therefore, the number of blocks depend on nrhs
+    // and the blocksize.
+    // Because of this, we might need a larger done_array compared
+    // to bsrsv.
+    int blockdim = rocsparse_bsrsm_blockdim(nrhs);
+    int narrays  = (nrhs - 1) / blockdim + 1;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((mb * narrays - 1) / 256 + 1) * 256;
+
+    // Temporary array to store transpose of B, the solve is done in place
+    T*            Xt    = X;
+    rocsparse_int ldimX = ldx;
+    if(trans_X == rocsparse_operation_none)
+    {
+        Xt    = reinterpret_cast<T*>(ptr);
+        ldimX = nrhs;
+        ptr += sizeof(T) * ((m * nrhs - 1) / 256 + 1) * 256;
+    }
+
+    // Temporary array to store transpose of A
+    T* At = nullptr;
+    if(trans_A == rocsparse_operation_transpose)
+    {
+        At = reinterpret_cast<T*>(ptr);
+    }
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * mb * narrays, stream));
+
+    rocsparse_trm_info bsrsm
+        = (descr->fill_mode == rocsparse_fill_mode_upper)
+              ? ((trans_A == rocsparse_operation_none) ? info->bsrsm_upper_info
+                                                       : info->bsrsmt_upper_info)
+              : ((trans_A == rocsparse_operation_none) ? info->bsrsm_lower_info
+                                                       : info->bsrsmt_lower_info);
+
+    if(bsrsm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+#define BSRSM_DIM_X 32
+#define BSRSM_DIM_Y 8
+    // Load B into X, such that each row of op(X) is contiguous in memory
+    if(trans_X == rocsparse_operation_none)
+    {
+        hipLaunchKernelGGL((csrsm_transpose<T, BSRSM_DIM_X, BSRSM_DIM_Y>),
+                           dim3((m - 1) / BSRSM_DIM_X + 1),
+                           dim3(BSRSM_DIM_X * BSRSM_DIM_Y),
+                           0,
+                           stream,
+                           m,
+                           nrhs,
+                           B,
+                           ldb,
+                           Xt,
+                           ldimX);
+    }
+    else if(B != X)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(X,
+                                             sizeof(T) * ldx,
+                                             B,
+                                             sizeof(T) * ldb,
+                                             sizeof(T) * nrhs,
+                                             m,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+    }
+
+    // Pointers to differentiate between transpose mode
+    const rocsparse_int* local_bsr_row_ptr = bsr_row_ptr;
+    const rocsparse_int* local_bsr_col_ind = bsr_col_ind;
+    const T*             local_bsr_val     = bsr_val;
+
+    rocsparse_fill_mode fill_mode = descr->fill_mode;
+
+    // When computing transposed triangular solve, we first need to update the
+    // transposed matrix values
+    if(trans_A == rocsparse_operation_transpose)
+    {
+        T* bsrt_val = At;
+
+        // Gather transposed values
+        LAUNCH_BSRSM_GTHR(256, handle->wavefront_size, block_dim);
+
+        local_bsr_row_ptr = bsrsm->trmt_row_ptr;
+        local_bsr_col_ind = bsrsm->trmt_col_ind;
+        local_bsr_val     = bsrt_val;
+
+        fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
+                                                             : rocsparse_fill_mode_lower;
+    }
+
+    // Determine gcnArch and ASIC revision
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+    // Each thread block processes blockdim rhs columns of a single block row, such
+    // that the BSR blocks are read once per sweep for all columns of the chunk
+    if(blockdim == 64)
+    {
+        LAUNCH_BSRSM(handle->pointer_mode, 64, gcnArch, asicRev);
+    }
+    else if(blockdim == 128)
+    {
+        LAUNCH_BSRSM(handle->pointer_mode, 128, gcnArch, asicRev);
+    }
+    else if(blockdim == 256)
+    {
+        LAUNCH_BSRSM(handle->pointer_mode, 256, gcnArch, asicRev);
+    }
+    else if(blockdim == 512)
+    {
+        LAUNCH_BSRSM(handle->pointer_mode, 512, gcnArch, asicRev);
+    }
+    else if(blockdim == 1024)
+    {
+        LAUNCH_BSRSM(handle->pointer_mode, 1024, gcnArch, asicRev);
+    }
+    else
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Transpose X back if X was not initially transposed
+    if(trans_X == rocsparse_operation_none)
+    {
+        hipLaunchKernelGGL((csrsm_transpose_back<T, BSRSM_DIM_X, BSRSM_DIM_Y>),
+                           dim3((m - 1) / BSRSM_DIM_X + 1),
+                           dim3(BSRSM_DIM_X * BSRSM_DIM_Y),
+                           0,
+                           stream,
+                           m,
+                           nrhs,
+                           Xt,
+                           ldimX,
+                           X,
+                           ldx);
+    }
+#undef BSRSM_DIM_X
+#undef BSRSM_DIM_Y
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_BSRSM_HPP
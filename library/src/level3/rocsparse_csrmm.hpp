@@ -156,6 +156,167 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                   idx_base);
 }
 
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmms_general_kernel(rocsparse_int m,
+                               rocsparse_int n,
+                               U             alpha_device_host,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               rocsparse_operation trans_B,
+                               const T* __restrict__ B,
+                               rocsparse_int ldb,
+                               U             beta_device_host,
+                               T* __restrict__ C,
+                               rocsparse_int          ldc,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_diag_type    diag,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmms_general_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                                     n,
+                                                     alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     trans_B,
+                                                     B,
+                                                     ldb,
+                                                     beta,
+                                                     C,
+                                                     ldc,
+                                                     parts,
+                                                     uplo,
+                                                     diag,
+                                                     idx_base);
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmms_scatter_kernel(rocsparse_int m,
+                               rocsparse_int n,
+                               U             alpha_device_host,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               rocsparse_operation trans_B,
+                               const T* __restrict__ B,
+                               rocsparse_int ldb,
+                               T* __restrict__ C,
+                               rocsparse_int          ldc,
+                               rocsparse_matrix_parts parts,
+                               rocsparse_fill_mode    uplo,
+                               rocsparse_index_base   idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmms_scatter_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                                     n,
+                                                     alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     trans_B,
+                                                     B,
+                                                     ldb,
+                                                     C,
+                                                     ldc,
+                                                     parts,
+                                                     uplo,
+                                                     idx_base);
+    }
+}
+
+// csrmm for symmetric, Hermitian and triangular matrices, where op(A) is obtained from
+// the stored triangle. The row part is computed first, then the column part is added
+// using atomics.
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmms_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           U                         alpha_device_host,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const T*                  B,
+                                           rocsparse_int             ldb,
+                                           U                         beta_device_host,
+                                           T*                        C,
+                                           rocsparse_int             ldc)
+{
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    rocsparse_matrix_parts parts = rocsparse_get_matrix_parts(descr->type, trans_A);
+
+#define CSRMMS_DIM 256
+#define SUB_WF_SIZE 8
+    dim3 csrmms_blocks((SUB_WF_SIZE * m - 1) / CSRMMS_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+    dim3 csrmms_threads(CSRMMS_DIM);
+
+    hipLaunchKernelGGL((csrmms_general_kernel<T, CSRMMS_DIM, SUB_WF_SIZE>),
+                       csrmms_blocks,
+                       csrmms_threads,
+                       0,
+                       handle->stream,
+                       m,
+                       n,
+                       alpha_device_host,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       trans_B,
+                       B,
+                       ldb,
+                       beta_device_host,
+                       C,
+                       ldc,
+                       parts,
+                       descr->fill_mode,
+                       descr->diag_type,
+                       descr->base);
+
+    if(parts.col)
+    {
+        hipLaunchKernelGGL((csrmms_scatter_kernel<T, CSRMMS_DIM, SUB_WF_SIZE>),
+                           csrmms_blocks,
+                           csrmms_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           n,
+                           alpha_device_host,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           trans_B,
+                           B,
+                           ldb,
+                           C,
+                           ldc,
+                           parts,
+                           descr->fill_mode,
+                           descr->base);
+    }
+#undef SUB_WF_SIZE
+#undef CSRMMS_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans_A,
@@ -234,11 +395,6 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
 
     // Check sizes
     if(m < 0)
@@ -258,6 +414,12 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric, Hermitian and triangular matrices have to be square
+    if(descr->type != rocsparse_matrix_type_general && m != k)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0 || nnz == 0)
     {
@@ -340,6 +502,52 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Symmetric, Hermitian and triangular matrices
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmms_template(handle,
+                                             trans_A,
+                                             trans_B,
+                                             m,
+                                             n,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            return rocsparse_csrmms_template(handle,
+                                             trans_A,
+                                             trans_B,
+                                             m,
+                                             n,
+                                             *alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             *beta,
+                                             C,
+                                             ldc);
+        }
+    }
+
     // Run different csrmv kernels
     if(trans_A == rocsparse_operation_none)
     {
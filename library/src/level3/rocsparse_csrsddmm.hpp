@@ -0,0 +1,406 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRSDDMM_HPP
+#define ROCSPARSE_CSRSDDMM_HPP
+
+#include "csrsddmm_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+// Largest dimension k that is processed by the short k kernels
+#define CSRSDDMM_SHORT_K_MAX 16
+
+#define launch_csrsddmm_kernel(kernel, wf_size)                      \
+    hipLaunchKernelGGL((kernel<CSRSDDMM_DIM, wf_size>),              \
+                       dim3((m - 1) / (CSRSDDMM_DIM / wf_size) + 1), \
+                       dim3(CSRSDDMM_DIM),                           \
+                       0,                                            \
+                       stream,                                       \
+                       m,                                            \
+                       k,                                            \
+                       alpha_device_host,                            \
+                       A,                                            \
+                       inc_A_row,                                    \
+                       inc_A_col,                                    \
+                       conj_A,                                       \
+                       B,                                            \
+                       inc_B_row,                                    \
+                       inc_B_col,                                    \
+                       conj_B,                                       \
+                       beta_device_host,                             \
+                       csr_val,                                      \
+                       csr_row_ptr,                                  \
+                       csr_col_ind,                                  \
+                       descr->base);
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsddmm_short_kernel(rocsparse_int m,
+                               rocsparse_int k,
+                               U             alpha_device_host,
+                               const T* __restrict__ A,
+                               rocsparse_int inc_A_row,
+                               rocsparse_int inc_A_col,
+                               bool          conj_A,
+                               const T* __restrict__ B,
+                               rocsparse_int inc_B_row,
+                               rocsparse_int inc_B_col,
+                               bool          conj_B,
+                               U             beta_device_host,
+                               T* __restrict__ csr_val,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrsddmm_short_device<BLOCKSIZE, WF_SIZE>(m,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  inc_A_row,
+                                                  inc_A_col,
+                                                  conj_A,
+                                                  B,
+                                                  inc_B_row,
+                                                  inc_B_col,
+                                                  conj_B,
+                                                  beta,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsddmm_long_kernel(rocsparse_int m,
+                              rocsparse_int k,
+                              U             alpha_device_host,
+                              const T* __restrict__ A,
+                              rocsparse_int inc_A_row,
+                              rocsparse_int inc_A_col,
+                              bool          conj_A,
+                              const T* __restrict__ B,
+                              rocsparse_int inc_B_row,
+                              rocsparse_int inc_B_col,
+                              bool          conj_B,
+                              U             beta_device_host,
+                              T* __restrict__ csr_val,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrsddmm_long_device<BLOCKSIZE, WF_SIZE>(m,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 inc_A_row,
+                                                 inc_A_col,
+                                                 conj_A,
+                                                 B,
+                                                 inc_B_row,
+                                                 inc_B_col,
+                                                 conj_B,
+                                                 beta,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 idx_base);
+    }
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsddmm_dispatch(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             U                         alpha_device_host,
+                                             const T*                  A,
+                                             rocsparse_int             lda,
+                                             const T*                  B,
+                                             rocsparse_int             ldb,
+                                             U                         beta_device_host,
+                                             const rocsparse_mat_descr descr,
+                                             T*                        csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Strides of op(A) and op(B), A and B are stored column major
+    rocsparse_int inc_A_row = (trans_A == rocsparse_operation_none) ? 1 : lda;
+    rocsparse_int inc_A_col = (trans_A == rocsparse_operation_none) ? lda : 1;
+    rocsparse_int inc_B_row = (trans_B == rocsparse_operation_none) ? 1 : ldb;
+    rocsparse_int inc_B_col = (trans_B == rocsparse_operation_none) ? ldb : 1;
+
+    bool conj_A = (trans_A == rocsparse_operation_conjugate_transpose);
+    bool conj_B = (trans_B == rocsparse_operation_conjugate_transpose);
+
+#define CSRSDDMM_DIM 256
+    if(k <= CSRSDDMM_SHORT_K_MAX)
+    {
+        // Short k, each lane computes a full dot product. The sub-wavefront size is
+        // chosen by the average number of non-zero entries per row.
+        rocsparse_int nnz_per_row = nnz / m;
+
+        if(nnz_per_row < 4)
+        {
+            launch_csrsddmm_kernel(csrsddmm_short_kernel, 2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            launch_csrsddmm_kernel(csrsddmm_short_kernel, 4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            launch_csrsddmm_kernel(csrsddmm_short_kernel, 8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            launch_csrsddmm_kernel(csrsddmm_short_kernel, 16);
+        }
+        else
+        {
+            launch_csrsddmm_kernel(csrsddmm_short_kernel, 32);
+        }
+    }
+    else
+    {
+        // Long k, each dot product is computed by a sub-wavefront. The sub-wavefront
+        // size is chosen by k.
+        if(k <= 32)
+        {
+            launch_csrsddmm_kernel(csrsddmm_long_kernel, 16);
+        }
+        else if(k <= 64 || handle->wavefront_size == 32)
+        {
+            launch_csrsddmm_kernel(csrsddmm_long_kernel, 32);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            launch_csrsddmm_kernel(csrsddmm_long_kernel, 64);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSDDMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsddmm_template(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const T*                  alpha,
+                                             const T*                  A,
+                                             rocsparse_int             lda,
+                                             const T*                  B,
+                                             rocsparse_int             ldb,
+                                             const T*                  beta,
+                                             const rocsparse_mat_descr descr,
+                                             T*                        csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsddmm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrsddmm -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> -k",
+                  k,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsddmm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || k < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // A and B are only required if k != 0
+    if(k != 0 && (A == nullptr || B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    if(lda < std::max(1, (trans_A == rocsparse_operation_none) ? m : k)
+       || ldb < std::max(1, (trans_B == rocsparse_operation_none) ? k : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrsddmm_dispatch(handle,
+                                           trans_A,
+                                           trans_B,
+                                           m,
+                                           n,
+                                           k,
+                                           nnz,
+                                           alpha,
+                                           A,
+                                           lda,
+                                           B,
+                                           ldb,
+                                           beta,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind);
+    }
+    else
+    {
+        return rocsparse_csrsddmm_dispatch(handle,
+                                           trans_A,
+                                           trans_B,
+                                           m,
+                                           n,
+                                           k,
+                                           nnz,
+                                           *alpha,
+                                           A,
+                                           lda,
+                                           B,
+                                           ldb,
+                                           *beta,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind);
+    }
+}
+
+#endif // ROCSPARSE_CSRSDDMM_HPP
@@ -251,6 +251,12 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
             info->bsric0_info = info->bsrsv_lower_info;
             return rocsparse_status_success;
         }
+
+        if(info->bsrsm_lower_info != nullptr)
+        {
+            info->bsric0_info = info->bsrsm_lower_info;
+            return rocsparse_status_success;
+        }
     }
 
     // User is explicitly asking to force a re-analysis, or no valid data has been
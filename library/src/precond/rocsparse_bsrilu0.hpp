@@ -409,6 +409,13 @@ rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          h
             info->bsrilu0_info = info->bsrsv_lower_info;
             return rocsparse_status_success;
         }
+
+        if(info->bsrsm_lower_info != nullptr)
+        {
+            // bsrsm meta data
+            info->bsrilu0_info = info->bsrsm_lower_info;
+            return rocsparse_status_success;
+        }
     }
 
     // User is explicitly asking to force a re-analysis, or no valid data has been
@@ -473,3 +473,30 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   hand
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_csrilu0_level_info(rocsparse_handle      handle,
+                                                         rocsparse_mat_info    info,
+                                                         rocsparse_level_info* level_info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilu0_level_info", (const void*&)info, (const void*&)level_info);
+
+    // Check pointer arguments
+    if(level_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_trm_level_info(
+        handle, info->csrilu0_info, rocsparse_fill_mode_lower, level_info);
+}
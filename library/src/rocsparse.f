@@ -622,6 +622,195 @@ module rocsparse
             integer(c_int), value :: idx_base
         end function rocsparse_zsctr
 
+!       rocsparse_spdot
+        function rocsparse_sspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, &
+                result, idx_base) &
+                bind(c, name = 'rocsparse_sspdot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sspdot
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: result
+            integer(c_int), value :: idx_base
+        end function rocsparse_sspdot
+
+        function rocsparse_dspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, &
+                result, idx_base) &
+                bind(c, name = 'rocsparse_dspdot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dspdot
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: result
+            integer(c_int), value :: idx_base
+        end function rocsparse_dspdot
+
+        function rocsparse_cspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, &
+                result, idx_base) &
+                bind(c, name = 'rocsparse_cspdot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cspdot
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: result
+            integer(c_int), value :: idx_base
+        end function rocsparse_cspdot
+
+        function rocsparse_zspdot(handle, nnz_x, x_val, x_ind, nnz_y, y_val, y_ind, &
+                result, idx_base) &
+                bind(c, name = 'rocsparse_zspdot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zspdot
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: result
+            integer(c_int), value :: idx_base
+        end function rocsparse_zspdot
+
+!       rocsparse_spaxpy_buffer_size
+        function rocsparse_spaxpy_buffer_size(handle, nnz_x, nnz_y, buffer_size) &
+                bind(c, name = 'rocsparse_spaxpy_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_spaxpy_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            integer(c_int), value :: nnz_y
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_spaxpy_buffer_size
+
+!       rocsparse_spaxpy_nnz
+        function rocsparse_spaxpy_nnz(handle, nnz_x, x_ind, nnz_y, y_ind, nnz_z, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_spaxpy_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_spaxpy_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: nnz_z
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_spaxpy_nnz
+
+!       rocsparse_spaxpy
+        function rocsparse_sspaxpy(handle, nnz_x, alpha, x_val, x_ind, nnz_y, y_val, &
+                y_ind, z_val, z_ind, idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_sspaxpy')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sspaxpy
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: z_val
+            type(c_ptr), value :: z_ind
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sspaxpy
+
+        function rocsparse_dspaxpy(handle, nnz_x, alpha, x_val, x_ind, nnz_y, y_val, &
+                y_ind, z_val, z_ind, idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_dspaxpy')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dspaxpy
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: z_val
+            type(c_ptr), value :: z_ind
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dspaxpy
+
+        function rocsparse_cspaxpy(handle, nnz_x, alpha, x_val, x_ind, nnz_y, y_val, &
+                y_ind, z_val, z_ind, idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_cspaxpy')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cspaxpy
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: z_val
+            type(c_ptr), value :: z_ind
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cspaxpy
+
+        function rocsparse_zspaxpy(handle, nnz_x, alpha, x_val, x_ind, nnz_y, y_val, &
+                y_ind, z_val, z_ind, idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_zspaxpy')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zspaxpy
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            integer(c_int), value :: nnz_y
+            type(c_ptr), intent(in), value :: y_val
+            type(c_ptr), intent(in), value :: y_ind
+            type(c_ptr), value :: z_val
+            type(c_ptr), value :: z_ind
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zspaxpy
+
 ! ===========================================================================
 !   level 2 SPARSE
 ! ===========================================================================
@@ -1303,250 +1492,277 @@ module rocsparse
             type(c_ptr), value :: y
         end function rocsparse_zcsrmv
 
-!       rocsparse_csrsv_zero_pivot
-        function rocsparse_csrsv_zero_pivot(handle, descr, info, position) &
-                bind(c, name = 'rocsparse_csrsv_zero_pivot')
+!       rocsparse_csrmv_ex
+        function rocsparse_scsrmv_ex(handle, trans, alg, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                bind(c, name = 'rocsparse_scsrmv_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmv_ex
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csrsv_zero_pivot
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrmv_ex
 
-!       rocsparse_csrsv_buffer_size
-        function rocsparse_scsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_scsrsv_buffer_size')
+        function rocsparse_dcsrmv_ex(handle, trans, alg, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                bind(c, name = 'rocsparse_dcsrmv_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmv_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
+            integer(c_int), value :: alg
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrsv_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrmv_ex
 
-        function rocsparse_dcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_dcsrsv_buffer_size')
+        function rocsparse_ccsrmv_ex(handle, trans, alg, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                bind(c, name = 'rocsparse_ccsrmv_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmv_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
+            integer(c_int), value :: alg
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrsv_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrmv_ex
 
-        function rocsparse_ccsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_ccsrsv_buffer_size')
+        function rocsparse_zcsrmv_ex(handle, trans, alg, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                bind(c, name = 'rocsparse_zcsrmv_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmv_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
+            integer(c_int), value :: alg
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrsv_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrmv_ex
 
-        function rocsparse_zcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_zcsrsv_buffer_size')
+!       rocsparse_csrmspv_buffer_size
+        function rocsparse_scsrmspv_buffer_size(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsrmspv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmspv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrsv_buffer_size
+        end function rocsparse_scsrmspv_buffer_size
 
-!       rocsparse_csrsv_analysis
-        function rocsparse_scsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrsv_analysis')
+        function rocsparse_dcsrmspv_buffer_size(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrmspv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmspv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsv_analysis
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrmspv_buffer_size
 
-        function rocsparse_dcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrsv_analysis')
+        function rocsparse_ccsrmspv_buffer_size(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrmspv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmspv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsv_analysis
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrmspv_buffer_size
 
-        function rocsparse_ccsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrsv_analysis')
+        function rocsparse_zcsrmspv_buffer_size(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrmspv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmspv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsv_analysis
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrmspv_buffer_size
 
-        function rocsparse_zcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrsv_analysis')
+!       rocsparse_csrmspv_analysis
+        function rocsparse_scsrmspv_analysis(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrmspv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmspv_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsv_analysis
+        end function rocsparse_scsrmspv_analysis
 
-!       rocsparse_csrsv_clear
-        function rocsparse_csrsv_clear(handle, descr, info) &
-                bind(c, name = 'rocsparse_csrsv_clear')
+        function rocsparse_dcsrmspv_analysis(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrmspv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmspv_analysis
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-        end function rocsparse_csrsv_clear
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrmspv_analysis
 
-!       rocsparse_csrsv_solve
-        function rocsparse_scsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrsv_solve')
+        function rocsparse_ccsrmspv_analysis(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrmspv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmspv_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), value :: y
-            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsv_solve
+        end function rocsparse_ccsrmspv_analysis
 
-        function rocsparse_dcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrsv_solve')
+        function rocsparse_zcsrmspv_analysis(handle, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrmspv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmspv_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), value :: y
-            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsv_solve
+        end function rocsparse_zcsrmspv_analysis
 
-        function rocsparse_ccsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrsv_solve')
+!       rocsparse_csrmspv_clear
+        function rocsparse_csrmspv_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrmspv_clear')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmspv_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrmspv_clear
+
+!       rocsparse_csrmspv
+        function rocsparse_scsrmspv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, nnz_x, x_val, x_ind, beta, y, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_scsrmspv')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmspv
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
@@ -1554,782 +1770,851 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsv_solve
+        end function rocsparse_scsrmspv
 
-        function rocsparse_zcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrsv_solve')
+        function rocsparse_dcsrmspv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, nnz_x, x_val, x_ind, beta, y, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrmspv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmspv
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
-            compleX(c_double_complex), intent(in) :: alpha
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsv_solve
+        end function rocsparse_dcsrmspv
 
-!       rocsparse_ellmv
-        function rocsparse_sellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
-                bind(c, name = 'rocsparse_sellmv')
+        function rocsparse_ccsrmspv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, nnz_x, x_val, x_ind, beta, y, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrmspv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sellmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmspv
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
-            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_sellmv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrmspv
 
-        function rocsparse_dellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
-                bind(c, name = 'rocsparse_dellmv')
+        function rocsparse_zcsrmspv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, nnz_x, x_val, x_ind, beta, y, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrmspv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dellmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmspv
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
-            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nnz_x
+            type(c_ptr), intent(in), value :: x_val
+            type(c_ptr), intent(in), value :: x_ind
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_dellmv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrmspv
 
-        function rocsparse_cellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
-                bind(c, name = 'rocsparse_cellmv')
+!       rocsparse_csrsv_zero_pivot
+        function rocsparse_csrsv_zero_pivot(handle, descr, info, position) &
+                bind(c, name = 'rocsparse_csrsv_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cellmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrsv_zero_pivot
+
+!       rocsparse_csrsv_buffer_size
+        function rocsparse_scsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsrsv_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_cellmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsv_buffer_size
 
-        function rocsparse_zellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
-                bind(c, name = 'rocsparse_zellmv')
+        function rocsparse_dcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zellmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_zellmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsv_buffer_size
 
-!       rocsparse_hybmv
-        function rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
-                bind(c, name = 'rocsparse_shybmv')
+        function rocsparse_ccsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_shybmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_shybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsv_buffer_size
 
-        function rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
-                bind(c, name = 'rocsparse_dhybmv')
+        function rocsparse_zcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dhybmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_dhybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrsv_buffer_size
 
-        function rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
-                bind(c, name = 'rocsparse_chybmv')
+!       rocsparse_csrsv_analysis
+        function rocsparse_scsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrsv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_chybmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_chybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_analysis
 
-        function rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
-                bind(c, name = 'rocsparse_zhybmv')
+        function rocsparse_dcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrsv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zhybmv
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_zhybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_analysis
 
-! ===========================================================================
-!   level 3 SPARSE
-! ===========================================================================
-!       rocsparse_bsrmm
-        function rocsparse_sbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_sbsrmm')
+        function rocsparse_ccsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrsv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
-            integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_sbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_analysis
 
-        function rocsparse_dbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_dbsrmm')
+        function rocsparse_zcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrsv_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
-            integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_dbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_analysis
 
-        function rocsparse_cbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_cbsrmm')
+!       rocsparse_csrsv_clear
+        function rocsparse_csrsv_clear(handle, descr, info) &
+                bind(c, name = 'rocsparse_csrsv_clear')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_clear
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
-            integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_cbsrmm
+            type(c_ptr), value :: info
+        end function rocsparse_csrsv_clear
 
-        function rocsparse_zbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_zbsrmm')
+!       rocsparse_csrsv_solve
+        function rocsparse_scsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrsv_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsv_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
-            integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_zbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_solve
 
-!       rocsparse_csrmm
-        function rocsparse_scsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_scsrmm')
+        function rocsparse_dcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrsv_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsv_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_scsrmm
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_solve
 
-        function rocsparse_dcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_dcsrmm')
+        function rocsparse_ccsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrsv_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsv_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_dcsrmm
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_solve
 
-        function rocsparse_ccsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_ccsrmm')
+        function rocsparse_zcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrsv_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsv_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
+            compleX(c_double_complex), intent(in) :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_ccsrmm
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_solve
 
-        function rocsparse_zcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
-                bind(c, name = 'rocsparse_zcsrmm')
+!       rocsparse_ellmv
+        function rocsparse_sellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                bind(c, name = 'rocsparse_sellmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmm
+            integer(kind(rocsparse_status_success)) :: rocsparse_sellmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
-            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_zcsrmm
+            type(c_ptr), value :: y
+        end function rocsparse_sellmv
 
-!       rocsparse_csrsm_zero_pivot
-        function rocsparse_csrsm_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_csrsm_zero_pivot')
+        function rocsparse_dellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                bind(c, name = 'rocsparse_dellmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrsm_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_dellmv
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csrsm_zero_pivot
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dellmv
 
-!       rocsparse_csrsm_buffer_size
-        function rocsparse_scsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_scsrsm_buffer_size')
+        function rocsparse_cellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                bind(c, name = 'rocsparse_cellmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cellmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrsm_buffer_size
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cellmv
 
-        function rocsparse_dcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_dcsrsm_buffer_size')
+        function rocsparse_zellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                bind(c, name = 'rocsparse_zellmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zellmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrsm_buffer_size
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zellmv
 
-        function rocsparse_ccsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_ccsrsm_buffer_size')
+!       rocsparse_hybmv
+        function rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                bind(c, name = 'rocsparse_shybmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_shybmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: trans
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrsm_buffer_size
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_shybmv
 
-        function rocsparse_zcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_zcsrsm_buffer_size')
+        function rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                bind(c, name = 'rocsparse_dhybmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dhybmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: trans
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrsm_buffer_size
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dhybmv
 
-!       rocsparse_csrsm_analysis
-        function rocsparse_scsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrsm_analysis')
+        function rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                bind(c, name = 'rocsparse_chybmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_chybmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: trans
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsm_analysis
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_chybmv
 
-        function rocsparse_dcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrsm_analysis')
+        function rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                bind(c, name = 'rocsparse_zhybmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zhybmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: trans
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsm_analysis
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zhybmv
 
-        function rocsparse_ccsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrsm_analysis')
+!       rocsparse_sellcmv
+        function rocsparse_ssellcmv(handle, trans, m, n, alpha, descr, sell_val, &
+                sell_slice_ptr, sell_col_ind, sell_perm, sell_slice_size, x, beta, y) &
+                bind(c, name = 'rocsparse_ssellcmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ssellcmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsm_analysis
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ssellcmv
 
-        function rocsparse_zcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrsm_analysis')
+        function rocsparse_dsellcmv(handle, trans, m, n, alpha, descr, sell_val, &
+                sell_slice_ptr, sell_col_ind, sell_perm, sell_slice_size, x, beta, y) &
+                bind(c, name = 'rocsparse_dsellcmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dsellcmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsm_analysis
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dsellcmv
 
-!       rocsparse_csrsm_clear
-        function rocsparse_csrsm_clear(handle, info) &
-                bind(c, name = 'rocsparse_csrsm_clear')
+        function rocsparse_csellcmv(handle, trans, m, n, alpha, descr, sell_val, &
+                sell_slice_ptr, sell_col_ind, sell_perm, sell_slice_size, x, beta, y) &
+                bind(c, name = 'rocsparse_csellcmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrsm_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_csellcmv
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_csrsm_clear
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_csellcmv
 
-!       rocsparse_csrsm_solve
-        function rocsparse_scsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_scsrsm_solve')
+        function rocsparse_zsellcmv(handle, trans, m, n, alpha, descr, sell_val, &
+                sell_slice_ptr, sell_col_ind, sell_perm, sell_slice_size, x, beta, y) &
+                bind(c, name = 'rocsparse_zsellcmv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_zsellcmv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsm_solve
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zsellcmv
 
-        function rocsparse_dcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrsm_solve')
+!       rocsparse_csrdeltamv
+        function rocsparse_scsrdeltamv(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, block_dim, csrdelta_block_ptr, csrdelta_width, &
+                csrdelta_row_col, csrdelta_col_ind, x, beta, y) &
+                bind(c, name = 'rocsparse_scsrdeltamv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrdeltamv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsm_solve
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), intent(in), value :: csrdelta_row_col
+            type(c_ptr), intent(in), value :: csrdelta_col_ind
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrdeltamv
 
-        function rocsparse_ccsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrsm_solve')
+        function rocsparse_dcsrdeltamv(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, block_dim, csrdelta_block_ptr, csrdelta_width, &
+                csrdelta_row_col, csrdelta_col_ind, x, beta, y) &
+                bind(c, name = 'rocsparse_dcsrdeltamv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrdeltamv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsm_solve
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), intent(in), value :: csrdelta_row_col
+            type(c_ptr), intent(in), value :: csrdelta_col_ind
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrdeltamv
 
-        function rocsparse_zcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrsm_solve')
+        function rocsparse_ccsrdeltamv(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, block_dim, csrdelta_block_ptr, csrdelta_width, &
+                csrdelta_row_col, csrdelta_col_ind, x, beta, y) &
+                bind(c, name = 'rocsparse_ccsrdeltamv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_solve
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrdeltamv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsm_solve
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), intent(in), value :: csrdelta_row_col
+            type(c_ptr), intent(in), value :: csrdelta_col_ind
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrdeltamv
 
-!       rocsparse_gemmi
-        function rocsparse_sgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
-                bind(c, name = 'rocsparse_sgemmi')
+        function rocsparse_zcsrdeltamv(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, block_dim, csrdelta_block_ptr, csrdelta_width, &
+                csrdelta_row_col, csrdelta_col_ind, x, beta, y) &
+                bind(c, name = 'rocsparse_zcsrdeltamv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgemmi
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrdeltamv
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), intent(in), value :: csrdelta_row_col
+            type(c_ptr), intent(in), value :: csrdelta_col_ind
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrdeltamv
+
+! ===========================================================================
+!   level 3 SPARSE
+! ===========================================================================
+!       rocsparse_bsrmm
+        function rocsparse_sbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_sbsrmm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrmm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocsparse_sgemmi
+        end function rocsparse_sbsrmm
 
-        function rocsparse_dgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
-                bind(c, name = 'rocsparse_dgemmi')
+        function rocsparse_dbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_dbsrmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgemmi
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrmm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dbsrmm
+
+        function rocsparse_cbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_cbsrmm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrmm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_cbsrmm
+
+        function rocsparse_zbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_zbsrmm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrmm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zbsrmm
+
+!       rocsparse_csrmm
+        function rocsparse_scsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_scsrmm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmm
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
@@ -2338,24 +2623,24 @@ module rocsparse
             integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocsparse_dgemmi
+        end function rocsparse_scsrmm
 
-        function rocsparse_cgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
-                bind(c, name = 'rocsparse_cgemmi')
+        function rocsparse_dcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_dcsrmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgemmi
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmm
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
@@ -2364,24 +2649,24 @@ module rocsparse
             integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocsparse_cgemmi
+        end function rocsparse_dcsrmm
 
-        function rocsparse_zgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
-                bind(c, name = 'rocsparse_zgemmi')
+        function rocsparse_ccsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_ccsrmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgemmi
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmm
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
@@ -2390,527 +2675,412 @@ module rocsparse
             integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function rocsparse_zgemmi
-
-! ===========================================================================
-!   extra SPARSE
-! ===========================================================================
+        end function rocsparse_ccsrmm
 
-!       rocsparse_csrgeam_nnz
-        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
-                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
-                csr_row_ptr_C, nnz_C) &
-                bind(c, name = 'rocsparse_csrgeam_nnz')
+        function rocsparse_zcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                bind(c, name = 'rocsparse_zcsrmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrgeam_nnz
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmm
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_row_ptr_C
-            type(c_ptr), value :: nnz_C
-        end function rocsparse_csrgeam_nnz
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zcsrmm
 
-!       rocsparse_csrgeam
-        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_scsrgeam')
+!       rocsparse_csrsm_zero_pivot
+        function rocsparse_csrsm_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrsm_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsm_zero_pivot
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_scsrgeam
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrsm_zero_pivot
 
-        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_dcsrgeam')
+!       rocsparse_csrsm_buffer_size
+        function rocsparse_scsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_scsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_dcsrgeam
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsm_buffer_size
 
-        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_ccsrgeam')
+        function rocsparse_dcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dcsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_ccsrgeam
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsm_buffer_size
 
-        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_zcsrgeam')
+        function rocsparse_ccsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_ccsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_zcsrgeam
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsm_buffer_size
 
-!       rocsparse_csrgemm_buffer_size
-        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+        function rocsparse_zcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
                 buffer_size) &
-                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+                bind(c, name = 'rocsparse_zcsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrgemm_buffer_size
+        end function rocsparse_zcsrsm_buffer_size
 
-        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+!       rocsparse_csrsm_analysis
+        function rocsparse_scsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsm_analysis
 
-        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+        function rocsparse_dcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsm_analysis
 
-        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+        function rocsparse_ccsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsm_analysis
 
-!       rocsparse_csrgemm_nnz
-        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
-                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
-                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
-                bind(c, name = 'rocsparse_csrgemm_nnz')
+        function rocsparse_zcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_nnz
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_row_ptr_C
-            type(c_ptr), value :: nnz_C
-            type(c_ptr), intent(in), value :: info_C
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_csrgemm_nnz
+        end function rocsparse_zcsrsm_analysis
 
-!       rocsparse_csrgemm
-        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+!       rocsparse_csrsm_clear
+        function rocsparse_csrsm_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrsm_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsm_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrsm_clear
+
+!       rocsparse_csrsm_solve
+        function rocsparse_scsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
                 temp_buffer) &
-                bind(c, name = 'rocsparse_scsrgemm')
+                bind(c, name = 'rocsparse_scsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrgemm
+        end function rocsparse_scsrsm_solve
 
-        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+        function rocsparse_dcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
                 temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrgemm')
+                bind(c, name = 'rocsparse_dcsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrgemm
+        end function rocsparse_dcsrsm_solve
 
-        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+        function rocsparse_ccsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
                 temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrgemm')
+                bind(c, name = 'rocsparse_ccsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrgemm
+        end function rocsparse_ccsrsm_solve
 
-        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+        function rocsparse_zcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
                 temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrgemm')
+                bind(c, name = 'rocsparse_zcsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
             integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrgemm
-
-! ===========================================================================
-!   preconditioner SPARSE
-! ===========================================================================
+        end function rocsparse_zcsrsm_solve
 
-!       rocsparse_bsric0_zero_pivot
-        function rocsparse_bsric0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+!       rocsparse_bsrsm_zero_pivot
+        function rocsparse_bsrsm_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrsm_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrsm_zero_pivot
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
             type(c_ptr), value :: position
-        end function rocsparse_bsric0_zero_pivot
+        end function rocsparse_bsrsm_zero_pivot
 
-!       rocsparse_bsric0_buffer_size
-        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+!       rocsparse_bsrsm_buffer_size
+        function rocsparse_sbsrsm_buffer_size(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_sbsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrsm_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -2919,18 +3089,22 @@ module rocsparse
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsric0_buffer_size
+        end function rocsparse_sbsrsm_buffer_size
 
-        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+        function rocsparse_dbsrsm_buffer_size(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dbsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrsm_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -2939,18 +3113,22 @@ module rocsparse
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsric0_buffer_size
+        end function rocsparse_dbsrsm_buffer_size
 
-        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsric0_buffer_size')
+        function rocsparse_cbsrsm_buffer_size(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_cbsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrsm_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -2959,18 +3137,22 @@ module rocsparse
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsric0_buffer_size
+        end function rocsparse_cbsrsm_buffer_size
 
-        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+        function rocsparse_zbsrsm_buffer_size(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zbsrsm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrsm_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -2979,19 +3161,23 @@ module rocsparse
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsric0_buffer_size
+        end function rocsparse_zbsrsm_buffer_size
 
-!       rocsparse_bsric0_analysis
-        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0_analysis')
+!       rocsparse_bsrsm_analysis
+        function rocsparse_sbsrsm_analysis(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -3002,18 +3188,22 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0_analysis
+        end function rocsparse_sbsrsm_analysis
 
-        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0_analysis')
+        function rocsparse_dbsrsm_analysis(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -3024,18 +3214,22 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0_analysis
+        end function rocsparse_dbsrsm_analysis
 
-        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0_analysis')
+        function rocsparse_cbsrsm_analysis(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -3046,18 +3240,22 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0_analysis
+        end function rocsparse_cbsrsm_analysis
 
-        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0_analysis')
+        function rocsparse_zbsrsm_analysis(handle, dir, trans_A, trans_X, mb, nrhs, &
+                nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, &
+                analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrsm_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrsm_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -3068,326 +3266,1543 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0_analysis
+        end function rocsparse_zbsrsm_analysis
 
-!       rocsparse_bsric0_clear
-        function rocsparse_bsric0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsric0_clear')
+!       rocsparse_bsrsm_clear
+        function rocsparse_bsrsm_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsrsm_clear')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrsm_clear
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
-        end function rocsparse_bsric0_clear
+        end function rocsparse_bsrsm_clear
 
-!       rocsparse_bsric0
-        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0')
+!       rocsparse_bsrsm_solve
+        function rocsparse_sbsrsm_solve(handle, dir, trans_A, trans_X, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, B, &
+                ldb, X, ldx, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0
+        end function rocsparse_sbsrsm_solve
 
-        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0')
+        function rocsparse_dbsrsm_solve(handle, dir, trans_A, trans_X, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, B, &
+                ldb, X, ldx, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0
+        end function rocsparse_dbsrsm_solve
 
-        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0')
+        function rocsparse_cbsrsm_solve(handle, dir, trans_A, trans_X, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, B, &
+                ldb, X, ldx, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0
+        end function rocsparse_cbsrsm_solve
 
-        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0')
+        function rocsparse_zbsrsm_solve(handle, dir, trans_A, trans_X, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, B, &
+                ldb, X, ldx, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrsm_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrsm_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_X
             integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: block_dim
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0
-
-!       rocsparse_bsrilu0_zero_pivot
-        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
-            use rocsparse_enums
-            use iso_c_binding
-            implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
-            type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsrilu0_zero_pivot
+        end function rocsparse_zbsrsm_solve
 
-!       rocsparse_bsrilu0_buffer_size
-        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+!       rocsparse_gemmi
+        function rocsparse_sgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                bind(c, name = 'rocsparse_sgemmi')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgemmi
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_sgemmi
 
-        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+        function rocsparse_dgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                bind(c, name = 'rocsparse_dgemmi')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgemmi
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dgemmi
 
-        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+        function rocsparse_cgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                bind(c, name = 'rocsparse_cgemmi')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgemmi
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_cgemmi
 
-        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+        function rocsparse_zgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                bind(c, name = 'rocsparse_zgemmi')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgemmi
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zgemmi
 
-!       rocsparse_bsrilu0_analysis
-        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+!       rocsparse_csrsddmm
+        function rocsparse_scsrsddmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, B, ldb, beta, descr, csr_val, csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_scsrsddmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsddmm
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0_analysis
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_scsrsddmm
 
-        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+        function rocsparse_dcsrsddmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, B, ldb, beta, descr, csr_val, csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_dcsrsddmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsddmm
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrilu0_analysis
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_dcsrsddmm
 
-        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+        function rocsparse_ccsrsddmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, B, ldb, beta, descr, csr_val, csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_ccsrsddmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsddmm
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrilu0_analysis
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_ccsrsddmm
 
-        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+        function rocsparse_zcsrsddmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, B, ldb, beta, descr, csr_val, csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_zcsrsddmm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsddmm
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrilu0_analysis
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_zcsrsddmm
 
-!       rocsparse_bsrilu0_clear
-        function rocsparse_bsrilu0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsrilu0_clear')
+! ===========================================================================
+!   extra SPARSE
+! ===========================================================================
+
+!       rocsparse_csrgeam_nnz
+        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
+                csr_row_ptr_C, nnz_C) &
+                bind(c, name = 'rocsparse_csrgeam_nnz')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgeam_nnz
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_bsrilu0_clear
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+        end function rocsparse_csrgeam_nnz
 
-!       rocsparse_bsrilu0
-        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0')
+!       rocsparse_csrgeam
+        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_scsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_scsrgeam
 
-        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0')
+        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_dcsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_dcsrgeam
+
+        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_ccsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_ccsrgeam
+
+        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_zcsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_zcsrgeam
+
+!       rocsparse_csrgemm_buffer_size
+        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrgemm_buffer_size
+
+        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrgemm_buffer_size
+
+        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrgemm_buffer_size
+
+        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrgemm_buffer_size
+
+!       rocsparse_csrgemm_nnz
+        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
+                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_csrgemm_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_nnz
+
+!       rocsparse_csrgemm
+        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm
+
+        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm
+
+        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm
+
+        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm
+
+!       rocsparse_csrgemm_symbolic
+        function rocsparse_csrgemm_symbolic(handle, trans_A, trans_B, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, nnz_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_csrgemm_symbolic')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_symbolic
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            integer(c_int), value :: nnz_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_symbolic
+
+!       rocsparse_csrgemm_numeric
+        function rocsparse_scsrgemm_numeric(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, nnz_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            integer(c_int), value :: nnz_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm_numeric
+
+        function rocsparse_dcsrgemm_numeric(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, nnz_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            integer(c_int), value :: nnz_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm_numeric
+
+        function rocsparse_ccsrgemm_numeric(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, nnz_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            integer(c_int), value :: nnz_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm_numeric
+
+        function rocsparse_zcsrgemm_numeric(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, nnz_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            integer(c_int), value :: nnz_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm_numeric
+
+! ===========================================================================
+!   preconditioner SPARSE
+! ===========================================================================
+
+!       rocsparse_bsric0_zero_pivot
+        function rocsparse_bsric0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsric0_zero_pivot
+
+!       rocsparse_bsric0_buffer_size
+        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsric0_buffer_size
+
+        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsric0_buffer_size
+
+        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsric0_buffer_size
+
+        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsric0_buffer_size
+
+!       rocsparse_bsric0_analysis
+        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0_analysis
+
+        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0_analysis
+
+        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0_analysis
+
+        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0_analysis
+
+!       rocsparse_bsric0_clear
+        function rocsparse_bsric0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsric0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsric0_clear
+
+!       rocsparse_bsric0
+        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0
+
+        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0
+
+        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0
+
+        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0
+
+!       rocsparse_bsrilu0_zero_pivot
+        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrilu0_zero_pivot
+
+!       rocsparse_bsrilu0_buffer_size
+        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrilu0_buffer_size
+
+        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrilu0_buffer_size
+
+        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrilu0_buffer_size
+
+        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrilu0_buffer_size
+
+!       rocsparse_bsrilu0_analysis
+        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0_analysis
+
+        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0_analysis
+
+        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0_analysis
+
+        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0_analysis
+
+!       rocsparse_bsrilu0_clear
+        function rocsparse_bsrilu0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsrilu0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrilu0_clear
+
+!       rocsparse_bsrilu0
+        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0
+
+        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: mb
@@ -4164,1048 +5579,1484 @@ module rocsparse
             type(c_ptr), value :: csc_row_ind
         end function rocsparse_cdense2csc
 
-        function rocsparse_zdense2csc(handle, m, n, descr, A, ld, nnz_per_columns, &
-                csc_val, csc_col_ptr, csc_row_ind) &
-                bind(c, name = 'rocsparse_zdense2csc')
+        function rocsparse_zdense2csc(handle, m, n, descr, A, ld, nnz_per_columns, &
+                csc_val, csc_col_ptr, csc_row_ind) &
+                bind(c, name = 'rocsparse_zdense2csc')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zdense2csc
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: ld
+            type(c_ptr), intent(in), value :: nnz_per_columns
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_col_ptr
+            type(c_ptr), value :: csc_row_ind
+        end function rocsparse_zdense2csc
+
+!       rocsparse_csr2dense
+        function rocsparse_scsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, A, ld) &
+                bind(c, name = 'rocsparse_scsr2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_scsr2dense
+
+        function rocsparse_dcsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, A, ld) &
+                bind(c, name = 'rocsparse_dcsr2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_dcsr2dense
+
+        function rocsparse_ccsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, A, ld) &
+                bind(c, name = 'rocsparse_ccsr2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_ccsr2dense
+
+        function rocsparse_zcsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, A, ld) &
+                bind(c, name = 'rocsparse_zcsr2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_zcsr2dense
+
+!       rocsparse_csc2dense
+        function rocsparse_scsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
+                csc_row_ind, A, ld) &
+                bind(c, name = 'rocsparse_scsc2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsc2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csc_val
+            type(c_ptr), intent(in), value :: csc_col_ptr
+            type(c_ptr), intent(in), value :: csc_row_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_scsc2dense
+
+        function rocsparse_dcsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
+                csc_row_ind, A, ld) &
+                bind(c, name = 'rocsparse_dcsc2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsc2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csc_val
+            type(c_ptr), intent(in), value :: csc_col_ptr
+            type(c_ptr), intent(in), value :: csc_row_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_dcsc2dense
+
+        function rocsparse_ccsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
+                csc_row_ind, A, ld) &
+                bind(c, name = 'rocsparse_ccsc2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsc2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csc_val
+            type(c_ptr), intent(in), value :: csc_col_ptr
+            type(c_ptr), intent(in), value :: csc_row_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_ccsc2dense
+
+        function rocsparse_zcsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
+                csc_row_ind, A, ld) &
+                bind(c, name = 'rocsparse_zcsc2dense')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsc2dense
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csc_val
+            type(c_ptr), intent(in), value :: csc_col_ptr
+            type(c_ptr), intent(in), value :: csc_row_ind
+            type(c_ptr), value :: A
+            integer(c_int), value :: ld
+        end function rocsparse_zcsc2dense
+
+!       rocsparse_nnz_compress
+        function rocsparse_snnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
+                nnz_per_row, nnz_C, tol) &
+                bind(c, name = 'rocsparse_snnz_compress')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_snnz_compress
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), value :: nnz_per_row
+            type(c_ptr), value :: nnz_C
+            real(c_float), value :: tol
+        end function rocsparse_snnz_compress
+
+        function rocsparse_dnnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
+                nnz_per_row, nnz_C, tol) &
+                bind(c, name = 'rocsparse_dnnz_compress')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dnnz_compress
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), value :: nnz_per_row
+            type(c_ptr), value :: nnz_C
+            real(c_double), value :: tol
+        end function rocsparse_dnnz_compress
+
+        function rocsparse_cnnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
+                nnz_per_row, nnz_C, tol) &
+                bind(c, name = 'rocsparse_cnnz_compress')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cnnz_compress
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), value :: nnz_per_row
+            type(c_ptr), value :: nnz_C
+            complex(c_float_complex), value :: tol
+        end function rocsparse_cnnz_compress
+
+        function rocsparse_znnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
+                nnz_per_row, nnz_C, tol) &
+                bind(c, name = 'rocsparse_znnz_compress')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_znnz_compress
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), value :: nnz_per_row
+            type(c_ptr), value :: nnz_C
+            complex(c_double_complex), value :: tol
+        end function rocsparse_znnz_compress
+
+!       rocsparse_csr2coo
+        function rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, coo_row_ind, idx_base) &
+                bind(c, name = 'rocsparse_csr2coo')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2coo
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            integer(c_int), value :: nnz
+            integer(c_int), value :: m
+            type(c_ptr), value :: coo_row_ind
+            integer(c_int), value :: idx_base
+        end function rocsparse_csr2coo
+
+!       rocsparse_gebsr2csr
+        function rocsparse_sgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind) &
+                bind(c, name = 'rocsparse_sgebsr2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_sgebsr2csr
+
+        function rocsparse_dgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind) &
+                bind(c, name = 'rocsparse_dgebsr2csr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zdense2csc
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2csr
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: ld
-            type(c_ptr), intent(in), value :: nnz_per_columns
-            type(c_ptr), value :: csc_val
-            type(c_ptr), value :: csc_col_ptr
-            type(c_ptr), value :: csc_row_ind
-        end function rocsparse_zdense2csc
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_dgebsr2csr
 
-!       rocsparse_csr2dense
-        function rocsparse_scsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, A, ld) &
-                bind(c, name = 'rocsparse_scsr2dense')
+        function rocsparse_cgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind) &
+                bind(c, name = 'rocsparse_cgebsr2csr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2csr
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_scsr2dense
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_cgebsr2csr
 
-        function rocsparse_dcsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, A, ld) &
-                bind(c, name = 'rocsparse_dcsr2dense')
+        function rocsparse_zgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind) &
+                bind(c, name = 'rocsparse_zgebsr2csr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2csr
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_dcsr2dense
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_zgebsr2csr
 
-        function rocsparse_ccsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, A, ld) &
-                bind(c, name = 'rocsparse_ccsr2dense')
+!       rocsparse_gebsr2gebsc_buffer_size
+        function rocsparse_sgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_sgebsr2gebsc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsc_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_ccsr2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgebsr2gebsc_buffer_size
 
-        function rocsparse_zcsr2dense(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, A, ld) &
-                bind(c, name = 'rocsparse_zcsr2dense')
+      function rocsparse_dgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_dgebsr2gebsc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsc_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_zcsr2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: buffer_size
+      end function rocsparse_dgebsr2gebsc_buffer_size
 
-!       rocsparse_csc2dense
-        function rocsparse_scsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
-                csc_row_ind, A, ld) &
-                bind(c, name = 'rocsparse_scsc2dense')
+      function rocsparse_cgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_cgebsr2gebsc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsc2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsc_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csc_val
-            type(c_ptr), intent(in), value :: csc_col_ptr
-            type(c_ptr), intent(in), value :: csc_row_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_scsc2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: buffer_size
+      end function rocsparse_cgebsr2gebsc_buffer_size
 
-        function rocsparse_dcsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
-                csc_row_ind, A, ld) &
-                bind(c, name = 'rocsparse_dcsc2dense')
+      function rocsparse_zgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_zgebsr2gebsc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsc2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsc_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csc_val
-            type(c_ptr), intent(in), value :: csc_col_ptr
-            type(c_ptr), intent(in), value :: csc_row_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_dcsc2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgebsr2gebsc_buffer_size
 
-        function rocsparse_ccsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
-                csc_row_ind, A, ld) &
-                bind(c, name = 'rocsparse_ccsc2dense')
+      
+!       rocsparse_gebsr2gebsc
+        function rocsparse_sgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_sgebsr2gebsc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsc2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsc
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csc_val
-            type(c_ptr), intent(in), value :: csc_col_ptr
-            type(c_ptr), intent(in), value :: csc_row_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_ccsc2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: bsc_val
+            type(c_ptr), value :: bsc_row_ind
+            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgebsr2gebsc
 
-        function rocsparse_zcsc2dense(handle, m, n, descr, csc_val, csc_col_ptr, &
-                csc_row_ind, A, ld) &
-                bind(c, name = 'rocsparse_zcsc2dense')
+       
+       function rocsparse_dgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_dgebsr2gebsc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsc2dense
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsc
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csc_val
-            type(c_ptr), intent(in), value :: csc_col_ptr
-            type(c_ptr), intent(in), value :: csc_row_ind
-            type(c_ptr), value :: A
-            integer(c_int), value :: ld
-        end function rocsparse_zcsc2dense
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: bsc_val
+            type(c_ptr), value :: bsc_row_ind
+            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dgebsr2gebsc
 
-!       rocsparse_nnz_compress
-        function rocsparse_snnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
-                nnz_per_row, nnz_C, tol) &
-                bind(c, name = 'rocsparse_snnz_compress')
+      function rocsparse_cgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_cgebsr2gebsc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_snnz_compress
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsc
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), value :: nnz_per_row
-            type(c_ptr), value :: nnz_C
-            real(c_float), value :: tol
-        end function rocsparse_snnz_compress
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: bsc_val
+            type(c_ptr), value :: bsc_row_ind
+            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cgebsr2gebsc
 
-        function rocsparse_dnnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
-                nnz_per_row, nnz_C, tol) &
-                bind(c, name = 'rocsparse_dnnz_compress')
+      function rocsparse_zgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_zgebsr2gebsc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dnnz_compress
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsc
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), value :: nnz_per_row
-            type(c_ptr), value :: nnz_C
-            real(c_double), value :: tol
-        end function rocsparse_dnnz_compress
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: bsc_val
+            type(c_ptr), value :: bsc_row_ind
+            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgebsr2gebsc
 
-        function rocsparse_cnnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
-                nnz_per_row, nnz_C, tol) &
-                bind(c, name = 'rocsparse_cnnz_compress')
+
+!       rocsparse_gebsr2gebsr_buffer_size
+        function rocsparse_sgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
+                bind(c, name = 'rocsparse_sgebsr2gebsr_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cnnz_compress
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsr_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), value :: nnz_per_row
-            type(c_ptr), value :: nnz_C
-            complex(c_float_complex), value :: tol
-        end function rocsparse_cnnz_compress
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgebsr2gebsr_buffer_size
 
-        function rocsparse_znnz_compress(handle, m, descr_A, csr_val_A, csr_row_ptr_A, &
-                nnz_per_row, nnz_C, tol) &
-                bind(c, name = 'rocsparse_znnz_compress')
+        function rocsparse_dgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
+                bind(c, name = 'rocsparse_dgebsr2gebsr_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_znnz_compress
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsr_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), value :: nnz_per_row
-            type(c_ptr), value :: nnz_C
-            complex(c_double_complex), value :: tol
-        end function rocsparse_znnz_compress
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgebsr2gebsr_buffer_size
 
-!       rocsparse_csr2coo
-        function rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, coo_row_ind, idx_base) &
-                bind(c, name = 'rocsparse_csr2coo')
+      function rocsparse_cgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
+                bind(c, name = 'rocsparse_cgebsr2gebsr_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csr2coo
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsr_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            integer(c_int), value :: nnz
-            integer(c_int), value :: m
-            type(c_ptr), value :: coo_row_ind
-            integer(c_int), value :: idx_base
-        end function rocsparse_csr2coo
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgebsr2gebsr_buffer_size
 
-!       rocsparse_gebsr2csr
-        function rocsparse_sgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind) &
-                bind(c, name = 'rocsparse_sgebsr2csr')
+      function rocsparse_zgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
+                bind(c, name = 'rocsparse_zgebsr2gebsr_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2csr
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsr_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
-            type(c_ptr), intent(in), value :: bsr_descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), intent(in), value :: csr_descr
-            type(c_ptr), value :: csr_val
-            type(c_ptr), value :: csr_row_ptr
-            type(c_ptr), value :: csr_col_ind
-        end function rocsparse_sgebsr2csr
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgebsr2gebsr_buffer_size
 
-        function rocsparse_dgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind) &
-                bind(c, name = 'rocsparse_dgebsr2csr')
+!       rocsparse_gebsr2gebsr_nnz
+        function rocsparse_gebsr2gebsr_nnz(handle, dir, mb, nb, nnzb, descr_A, bsr_row_ptr_A, bsr_col_ind_A, &
+                  row_block_dim_A, col_block_dim_A, descr_C, bsr_row_ptr_C, row_block_dim_C, col_block_dim_C, &
+                  nnz_total_dev_host_ptr, temp_buffer) &
+                bind(c, name = 'rocsparse_gebsr2gebsr_nnz')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2csr
+            integer(kind(rocsparse_status_success)) :: rocsparse_gebsr2gebsr_nnz
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
-            type(c_ptr), intent(in), value :: bsr_descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), intent(in), value :: csr_descr
-            type(c_ptr), value :: csr_val
-            type(c_ptr), value :: csr_row_ptr
-            type(c_ptr), value :: csr_col_ind
-        end function rocsparse_dgebsr2csr
-
-        function rocsparse_cgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind) &
-                bind(c, name = 'rocsparse_cgebsr2csr')
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: nnz_total_dev_host_ptr
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_gebsr2gebsr_nnz
+      
+!       rocsparse_gebsr2gebsr
+        function rocsparse_sgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
+                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
+                bind(c, name = 'rocsparse_sgebsr2gebsr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2csr
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsr
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
-            type(c_ptr), intent(in), value :: bsr_descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), intent(in), value :: csr_descr
-            type(c_ptr), value :: csr_val
-            type(c_ptr), value :: csr_row_ptr
-            type(c_ptr), value :: csr_col_ind
-        end function rocsparse_cgebsr2csr
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgebsr2gebsr
 
-        function rocsparse_zgebsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind) &
-                bind(c, name = 'rocsparse_zgebsr2csr')
+       
+       function rocsparse_dgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
+                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
+                bind(c, name = 'rocsparse_dgebsr2gebsr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2csr
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsr
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
-            type(c_ptr), intent(in), value :: bsr_descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), intent(in), value :: csr_descr
-            type(c_ptr), value :: csr_val
-            type(c_ptr), value :: csr_row_ptr
-            type(c_ptr), value :: csr_col_ind
-        end function rocsparse_zgebsr2csr
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dgebsr2gebsr
 
-!       rocsparse_gebsr2gebsc_buffer_size
-        function rocsparse_sgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
-                bind(c, name = 'rocsparse_sgebsr2gebsc_buffer_size')
+      function rocsparse_cgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
+                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
+                bind(c, name = 'rocsparse_cgebsr2gebsr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsc_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsr
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
             integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sgebsr2gebsc_buffer_size
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cgebsr2gebsr
 
-      function rocsparse_dgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
-                bind(c, name = 'rocsparse_dgebsr2gebsc_buffer_size')
+      function rocsparse_zgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
+                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
+                bind(c, name = 'rocsparse_zgebsr2gebsr')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsc_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsr
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: mb
             integer(c_int), value :: nb
             integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: buffer_size
-      end function rocsparse_dgebsr2gebsc_buffer_size
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            integer(c_int), value :: row_block_dim_A
+            integer(c_int), value :: col_block_dim_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            integer(c_int), value :: row_block_dim_C
+            integer(c_int), value :: col_block_dim_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgebsr2gebsr
 
-      function rocsparse_cgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
-                bind(c, name = 'rocsparse_cgebsr2gebsc_buffer_size')
+
+!       rocsparse_csr2csc_buffer_size
+        function rocsparse_csr2csc_buffer_size(handle, m, n, nnz, csr_row_ptr, &
+                csr_col_ind, copy_values, buffer_size) &
+                bind(c, name = 'rocsparse_csr2csc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsc_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csc_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: copy_values
             type(c_ptr), value :: buffer_size
-      end function rocsparse_cgebsr2gebsc_buffer_size
+        end function rocsparse_csr2csc_buffer_size
 
-      function rocsparse_zgebsr2gebsc_buffer_size(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, buffer_size) &
-                bind(c, name = 'rocsparse_zgebsr2gebsc_buffer_size')
+!       rocsparse_csr2csc
+        function rocsparse_scsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
+                idx_base, temp_buffer) &
+                bind(c, name = 'rocsparse_scsr2csc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsc_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2csc
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zgebsr2gebsc_buffer_size
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsr2csc
 
-      
-!       rocsparse_gebsr2gebsc
-        function rocsparse_sgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+        function rocsparse_dcsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
                 idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_sgebsr2gebsc')
+                bind(c, name = 'rocsparse_dcsr2csc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsc
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2csc
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: bsc_val
-            type(c_ptr), value :: bsc_row_ind
-            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
             integer(c_int), value :: copy_values
             integer(c_int), value :: idx_base
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sgebsr2gebsc
+        end function rocsparse_dcsr2csc
 
-       
-       function rocsparse_dgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+        function rocsparse_ccsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
                 idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_dgebsr2gebsc')
+                bind(c, name = 'rocsparse_ccsr2csc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsc
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2csc
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: bsc_val
-            type(c_ptr), value :: bsc_row_ind
-            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
             integer(c_int), value :: copy_values
             integer(c_int), value :: idx_base
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dgebsr2gebsc
+        end function rocsparse_ccsr2csc
 
-      function rocsparse_cgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
+        function rocsparse_zcsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
                 idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_cgebsr2gebsc')
+                bind(c, name = 'rocsparse_zcsr2csc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsc
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2csc
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: bsc_val
-            type(c_ptr), value :: bsc_row_ind
-            type(c_ptr), value :: bsc_col_ptr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
             integer(c_int), value :: copy_values
             integer(c_int), value :: idx_base
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cgebsr2gebsc
+        end function rocsparse_zcsr2csc
 
-      function rocsparse_zgebsr2gebsc(handle, mb, nb, nnzb, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, row_block_dim, col_block_dim, bsc_val, bsc_row_ind, bsc_col_ptr, copy_values, &
-                idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_zgebsr2gebsc')
+!       rocsparse_csr2csc_map
+        function rocsparse_csr2csc_map(handle, m, n, nnz, csr_col_ind, csc_map, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_csr2csc_map')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsc
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csc_map
             type(c_ptr), value :: handle
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: row_block_dim
-            integer(c_int), value :: col_block_dim
-            type(c_ptr), value :: bsc_val
-            type(c_ptr), value :: bsc_row_ind
-            type(c_ptr), value :: bsc_col_ptr
-            integer(c_int), value :: copy_values
-            integer(c_int), value :: idx_base
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_map
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zgebsr2gebsc
+        end function rocsparse_csr2csc_map
 
+!       rocsparse_csr2ell_width
+        function rocsparse_csr2ell_width(handle, m, csr_descr, csr_row_ptr, &
+                ell_descr, ell_width) &
+                bind(c, name = 'rocsparse_csr2ell_width')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2ell_width
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: ell_descr
+            type(c_ptr), value :: ell_width
+        end function rocsparse_csr2ell_width
 
-!       rocsparse_gebsr2gebsr_buffer_size
-        function rocsparse_sgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
-                bind(c, name = 'rocsparse_sgebsr2gebsr_buffer_size')
+!       rocsparse_csr2ell
+        function rocsparse_scsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                bind(c, name = 'rocsparse_scsr2ell')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsr_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2ell
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sgebsr2gebsr_buffer_size
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_scsr2ell
 
-        function rocsparse_dgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
-                bind(c, name = 'rocsparse_dgebsr2gebsr_buffer_size')
+        function rocsparse_dcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                bind(c, name = 'rocsparse_dcsr2ell')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsr_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2ell
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dgebsr2gebsr_buffer_size
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_dcsr2ell
 
-      function rocsparse_cgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
-                bind(c, name = 'rocsparse_cgebsr2gebsr_buffer_size')
+        function rocsparse_ccsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                bind(c, name = 'rocsparse_ccsr2ell')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsr_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2ell
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cgebsr2gebsr_buffer_size
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_ccsr2ell
 
-      function rocsparse_zgebsr2gebsr_buffer_size(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, row_block_dim_C, col_block_dim_C, buffer_size) &
-                bind(c, name = 'rocsparse_zgebsr2gebsr_buffer_size')
+        function rocsparse_zcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                bind(c, name = 'rocsparse_zcsr2ell')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsr_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2ell
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zgebsr2gebsr_buffer_size
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_zcsr2ell
 
-!       rocsparse_gebsr2gebsr_nnz
-        function rocsparse_gebsr2gebsr_nnz(handle, dir, mb, nb, nnzb, descr_A, bsr_row_ptr_A, bsr_col_ind_A, &
-                  row_block_dim_A, col_block_dim_A, descr_C, bsr_row_ptr_C, row_block_dim_C, col_block_dim_C, &
-                  nnz_total_dev_host_ptr, temp_buffer) &
-                bind(c, name = 'rocsparse_gebsr2gebsr_nnz')
+!       rocsparse_csr2ell_map
+        function rocsparse_csr2ell_map(handle, m, csr_descr, csr_row_ptr, &
+                ell_width, ell_map) &
+                bind(c, name = 'rocsparse_csr2ell_map')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_gebsr2gebsr_nnz
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2ell_map
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: bsr_row_ptr_C
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: nnz_total_dev_host_ptr
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_gebsr2gebsr_nnz
-      
-!       rocsparse_gebsr2gebsr
-        function rocsparse_sgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
-                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
-                bind(c, name = 'rocsparse_sgebsr2gebsr')
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_map
+        end function rocsparse_csr2ell_map
+
+!       rocsparse_csr2hyb
+        function rocsparse_scsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, user_ell_width, partition_type) &
+                bind(c, name = 'rocsparse_scsr2hyb')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2hyb
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+        end function rocsparse_scsr2hyb
+
+        function rocsparse_dcsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, user_ell_width, partition_type) &
+                bind(c, name = 'rocsparse_dcsr2hyb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sgebsr2gebsr
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2hyb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: bsr_val_C
-            type(c_ptr), value :: bsr_row_ptr_C
-            type(c_ptr), value :: bsr_col_ind_C
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sgebsr2gebsr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+        end function rocsparse_dcsr2hyb
 
-       
-       function rocsparse_dgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
-                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
-                bind(c, name = 'rocsparse_dgebsr2gebsr')
+        function rocsparse_ccsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, user_ell_width, partition_type) &
+                bind(c, name = 'rocsparse_ccsr2hyb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dgebsr2gebsr
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2hyb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: bsr_val_C
-            type(c_ptr), value :: bsr_row_ptr_C
-            type(c_ptr), value :: bsr_col_ind_C
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dgebsr2gebsr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+        end function rocsparse_ccsr2hyb
 
-      function rocsparse_cgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
-                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
-                bind(c, name = 'rocsparse_cgebsr2gebsr')
+        function rocsparse_zcsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, user_ell_width, partition_type) &
+                bind(c, name = 'rocsparse_zcsr2hyb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cgebsr2gebsr
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2hyb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: bsr_val_C
-            type(c_ptr), value :: bsr_row_ptr_C
-            type(c_ptr), value :: bsr_col_ind_C
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cgebsr2gebsr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+        end function rocsparse_zcsr2hyb
 
-      function rocsparse_zgebsr2gebsr(handle, dir, mb, nb, nnzb, descr_A, bsr_val_A, bsr_row_ptr_A, &
-                bsr_col_ind_A, row_block_dim_A, col_block_dim_A, descr_C, bsr_val_C, bsr_row_ptr_C, &
-                bsr_col_ind_C, row_block_dim_C, col_block_dim_C, temp_buffer) &
-                bind(c, name = 'rocsparse_zgebsr2gebsr')
+!       rocsparse_csr2hyb_buffer_size
+        function rocsparse_csr2hyb_buffer_size(handle, m, n, csr_row_ptr, buffer_size) &
+                bind(c, name = 'rocsparse_csr2hyb_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zgebsr2gebsr
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2hyb_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr_A
-            type(c_ptr), intent(in), value :: bsr_val_A
-            type(c_ptr), intent(in), value :: bsr_row_ptr_A
-            type(c_ptr), intent(in), value :: bsr_col_ind_A
-            integer(c_int), value :: row_block_dim_A
-            integer(c_int), value :: col_block_dim_A
-            type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: bsr_val_C
-            type(c_ptr), value :: bsr_row_ptr_C
-            type(c_ptr), value :: bsr_col_ind_C
-            integer(c_int), value :: row_block_dim_C
-            integer(c_int), value :: col_block_dim_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zgebsr2gebsr
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csr2hyb_buffer_size
 
+!       rocsparse_csr2hyb_nnz
+        function rocsparse_csr2hyb_nnz(handle, m, n, descr, csr_row_ptr, &
+                user_ell_width, partition_type, ell_width, coo_nnz, temp_buffer) &
+                bind(c, name = 'rocsparse_csr2hyb_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2hyb_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            integer(c_int), value :: user_ell_width
+            integer(c_int), value :: partition_type
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: coo_nnz
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csr2hyb_nnz
 
-!       rocsparse_csr2csc_buffer_size
-        function rocsparse_csr2csc_buffer_size(handle, m, n, nnz, csr_row_ptr, &
-                csr_col_ind, copy_values, buffer_size) &
-                bind(c, name = 'rocsparse_csr2csc_buffer_size')
+!       rocsparse_csr2hyb_ex
+        function rocsparse_scsr2hyb_ex(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, partition_type, ell_width, coo_nnz, ell_col_ind, &
+                ell_val, coo_row_ind, coo_col_ind, coo_val, temp_buffer) &
+                bind(c, name = 'rocsparse_scsr2hyb_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csc_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2hyb_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            integer(c_int), value :: copy_values
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_csr2csc_buffer_size
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: partition_type
+            integer(c_int), value :: ell_width
+            integer(c_int), value :: coo_nnz
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: coo_val
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsr2hyb_ex
 
-!       rocsparse_csr2csc
-        function rocsparse_scsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
-                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
-                idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_scsr2csc')
+        function rocsparse_dcsr2hyb_ex(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, partition_type, ell_width, coo_nnz, ell_col_ind, &
+                ell_val, coo_row_ind, coo_col_ind, coo_val, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsr2hyb_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2csc
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2hyb_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: csc_val
-            type(c_ptr), value :: csc_row_ind
-            type(c_ptr), value :: csc_col_ptr
-            integer(c_int), value :: copy_values
-            integer(c_int), value :: idx_base
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: partition_type
+            integer(c_int), value :: ell_width
+            integer(c_int), value :: coo_nnz
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: coo_val
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsr2csc
+        end function rocsparse_dcsr2hyb_ex
 
-        function rocsparse_dcsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
-                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
-                idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsr2csc')
+        function rocsparse_ccsr2hyb_ex(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, partition_type, ell_width, coo_nnz, ell_col_ind, &
+                ell_val, coo_row_ind, coo_col_ind, coo_val, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsr2hyb_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2csc
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2hyb_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: csc_val
-            type(c_ptr), value :: csc_row_ind
-            type(c_ptr), value :: csc_col_ptr
-            integer(c_int), value :: copy_values
-            integer(c_int), value :: idx_base
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: partition_type
+            integer(c_int), value :: ell_width
+            integer(c_int), value :: coo_nnz
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: coo_val
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsr2csc
+        end function rocsparse_ccsr2hyb_ex
 
-        function rocsparse_ccsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
-                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
-                idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsr2csc')
+        function rocsparse_zcsr2hyb_ex(handle, m, n, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, hyb, partition_type, ell_width, coo_nnz, ell_col_ind, &
+                ell_val, coo_row_ind, coo_col_ind, coo_val, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsr2hyb_ex')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2csc
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2hyb_ex
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: csc_val
-            type(c_ptr), value :: csc_row_ind
-            type(c_ptr), value :: csc_col_ptr
-            integer(c_int), value :: copy_values
-            integer(c_int), value :: idx_base
+            type(c_ptr), value :: hyb
+            integer(c_int), value :: partition_type
+            integer(c_int), value :: ell_width
+            integer(c_int), value :: coo_nnz
+            type(c_ptr), value :: ell_col_ind
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: coo_row_ind
+            type(c_ptr), value :: coo_col_ind
+            type(c_ptr), value :: coo_val
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsr2csc
+        end function rocsparse_zcsr2hyb_ex
+
+!       rocsparse_csr2hyb_map
+        function rocsparse_csr2hyb_map(handle, descr, csr_row_ptr, hyb, hyb_map) &
+                bind(c, name = 'rocsparse_csr2hyb_map')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2hyb_map
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), value :: hyb_map
+        end function rocsparse_csr2hyb_map
+
+!       rocsparse_csr2hyb_values
+        function rocsparse_scsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb) &
+                bind(c, name = 'rocsparse_scsr2hyb_values')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2hyb_values
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: hyb_map
+            type(c_ptr), value :: hyb
+        end function rocsparse_scsr2hyb_values
+
+        function rocsparse_dcsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb) &
+                bind(c, name = 'rocsparse_dcsr2hyb_values')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2hyb_values
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: hyb_map
+            type(c_ptr), value :: hyb
+        end function rocsparse_dcsr2hyb_values
+
+        function rocsparse_ccsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb) &
+                bind(c, name = 'rocsparse_ccsr2hyb_values')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2hyb_values
+            type(c_ptr), value :: handle
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: hyb_map
+            type(c_ptr), value :: hyb
+        end function rocsparse_ccsr2hyb_values
 
-        function rocsparse_zcsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
-                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
-                idx_base, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsr2csc')
+        function rocsparse_zcsr2hyb_values(handle, nnz, csr_val, hyb_map, hyb) &
+                bind(c, name = 'rocsparse_zcsr2hyb_values')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2csc
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2hyb_values
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: csc_val
-            type(c_ptr), value :: csc_row_ind
-            type(c_ptr), value :: csc_col_ptr
-            integer(c_int), value :: copy_values
-            integer(c_int), value :: idx_base
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsr2csc
+            type(c_ptr), intent(in), value :: hyb_map
+            type(c_ptr), value :: hyb
+        end function rocsparse_zcsr2hyb_values
 
-!       rocsparse_csr2ell_width
-        function rocsparse_csr2ell_width(handle, m, csr_descr, csr_row_ptr, &
-                ell_descr, ell_width) &
-                bind(c, name = 'rocsparse_csr2ell_width')
+!       rocsparse_csr2sellc_buffer_size
+        function rocsparse_csr2sellc_buffer_size(handle, m, n, csr_row_ptr, &
+                sell_slice_size, sell_sigma, buffer_size) &
+                bind(c, name = 'rocsparse_csr2sellc_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csr2ell_width
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2sellc_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            type(c_ptr), intent(in), value :: csr_descr
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: ell_descr
-            type(c_ptr), value :: ell_width
-        end function rocsparse_csr2ell_width
+            integer(c_int), value :: sell_slice_size
+            integer(c_int), value :: sell_sigma
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csr2sellc_buffer_size
 
-!       rocsparse_csr2ell
-        function rocsparse_scsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
-                bind(c, name = 'rocsparse_scsr2ell')
+!       rocsparse_csr2sellc_nnz
+        function rocsparse_csr2sellc_nnz(handle, m, n, csr_descr, csr_row_ptr, &
+                sell_descr, sell_slice_size, sell_sigma, sell_slice_ptr, sell_perm, &
+                sell_nnz, temp_buffer) &
+                bind(c, name = 'rocsparse_csr2sellc_nnz')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2ell
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2sellc_nnz
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
-            type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_scsr2ell
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            integer(c_int), value :: sell_sigma
+            type(c_ptr), value :: sell_slice_ptr
+            type(c_ptr), value :: sell_perm
+            type(c_ptr), value :: sell_nnz
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csr2sellc_nnz
 
-        function rocsparse_dcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
-                bind(c, name = 'rocsparse_dcsr2ell')
+!       rocsparse_csr2sellc
+        function rocsparse_scsr2sellc(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, sell_descr, sell_slice_size, sell_slice_ptr, sell_perm, &
+                sell_val, sell_col_ind) &
+                bind(c, name = 'rocsparse_scsr2sellc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2ell
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2sellc
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_dcsr2ell
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), value :: sell_val
+            type(c_ptr), value :: sell_col_ind
+        end function rocsparse_scsr2sellc
 
-        function rocsparse_ccsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
-                bind(c, name = 'rocsparse_ccsr2ell')
+        function rocsparse_dcsr2sellc(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, sell_descr, sell_slice_size, sell_slice_ptr, sell_perm, &
+                sell_val, sell_col_ind) &
+                bind(c, name = 'rocsparse_dcsr2sellc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2ell
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2sellc
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_ccsr2ell
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), value :: sell_val
+            type(c_ptr), value :: sell_col_ind
+        end function rocsparse_dcsr2sellc
 
-        function rocsparse_zcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
-                bind(c, name = 'rocsparse_zcsr2ell')
+        function rocsparse_ccsr2sellc(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, sell_descr, sell_slice_size, sell_slice_ptr, sell_perm, &
+                sell_val, sell_col_ind) &
+                bind(c, name = 'rocsparse_ccsr2sellc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2ell
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2sellc
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_zcsr2ell
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), value :: sell_val
+            type(c_ptr), value :: sell_col_ind
+        end function rocsparse_ccsr2sellc
 
-!       rocsparse_csr2hyb
-        function rocsparse_scsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, hyb, user_ell_width, partition_type) &
-                bind(c, name = 'rocsparse_scsr2hyb')
+        function rocsparse_zcsr2sellc(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, sell_descr, sell_slice_size, sell_slice_ptr, sell_perm, &
+                sell_val, sell_col_ind) &
+                bind(c, name = 'rocsparse_zcsr2sellc')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsr2hyb
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2sellc
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: hyb
-            integer(c_int), value :: user_ell_width
-            integer(c_int), value :: partition_type
-        end function rocsparse_scsr2hyb
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), value :: sell_val
+            type(c_ptr), value :: sell_col_ind
+        end function rocsparse_zcsr2sellc
 
-        function rocsparse_dcsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, hyb, user_ell_width, partition_type) &
-                bind(c, name = 'rocsparse_dcsr2hyb')
+!       rocsparse_csr2csrdelta_buffer_size
+        function rocsparse_csr2csrdelta_buffer_size(handle, m, n, csr_row_ptr, &
+                block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_csr2csrdelta_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsr2hyb
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csrdelta_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: hyb
-            integer(c_int), value :: user_ell_width
-            integer(c_int), value :: partition_type
-        end function rocsparse_dcsr2hyb
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csr2csrdelta_buffer_size
 
-        function rocsparse_ccsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, hyb, user_ell_width, partition_type) &
-                bind(c, name = 'rocsparse_ccsr2hyb')
+!       rocsparse_csr2csrdelta_nnz
+        function rocsparse_csr2csrdelta_nnz(handle, m, n, descr, csr_row_ptr, &
+                csr_col_ind, block_dim, csrdelta_block_ptr, csrdelta_width, &
+                csrdelta_nnz, temp_buffer) &
+                bind(c, name = 'rocsparse_csr2csrdelta_nnz')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsr2hyb
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csrdelta_nnz
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: hyb
-            integer(c_int), value :: user_ell_width
-            integer(c_int), value :: partition_type
-        end function rocsparse_ccsr2hyb
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csrdelta_block_ptr
+            type(c_ptr), value :: csrdelta_width
+            type(c_ptr), value :: csrdelta_nnz
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csr2csrdelta_nnz
 
-        function rocsparse_zcsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, hyb, user_ell_width, partition_type) &
-                bind(c, name = 'rocsparse_zcsr2hyb')
+!       rocsparse_csr2csrdelta
+        function rocsparse_csr2csrdelta(handle, m, n, descr, csr_row_ptr, csr_col_ind, &
+                block_dim, csrdelta_block_ptr, csrdelta_width, csrdelta_row_col, &
+                csrdelta_col_ind) &
+                bind(c, name = 'rocsparse_csr2csrdelta')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsr2hyb
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2csrdelta
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: hyb
-            integer(c_int), value :: user_ell_width
-            integer(c_int), value :: partition_type
-        end function rocsparse_zcsr2hyb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), value :: csrdelta_row_col
+            type(c_ptr), value :: csrdelta_col_ind
+        end function rocsparse_csr2csrdelta
 
 !       rocsparse_csr2bsr_nnz
         function rocsparse_csr2bsr_nnz(handle, dir, m, n, csr_descr, csr_row_ptr, &
@@ -5317,6 +7168,29 @@ module rocsparse
             type(c_ptr), value :: bsr_col_ind
         end function rocsparse_zcsr2bsr
 
+!       rocsparse_csr2bsr_map
+        function rocsparse_csr2bsr_map(handle, dir, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, block_dim, bsr_descr, bsr_row_ptr, bsr_col_ind, &
+                bsr_map) &
+                bind(c, name = 'rocsparse_csr2bsr_map')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2bsr_map
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            type(c_ptr), value :: bsr_map
+        end function rocsparse_csr2bsr_map
+
 !       rocsparse_csr2gebsr_nnz
         function rocsparse_csr2gebsr_nnz(handle, dir, m, n, csr_descr, csr_row_ptr, &
                 csr_col_ind, bsr_descr, bsr_row_ptr, row_block_dim, &
@@ -5537,6 +7411,30 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsr2gebsr
 
+!       rocsparse_csr2gebsr_map
+        function rocsparse_csr2gebsr_map(handle, dir, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, bsr_descr, bsr_row_ptr, bsr_col_ind, row_block_dim, &
+                col_block_dim, bsr_map) &
+                bind(c, name = 'rocsparse_csr2gebsr_map')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr2gebsr_map
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_descr
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: row_block_dim
+            integer(c_int), value :: col_block_dim
+            type(c_ptr), value :: bsr_map
+        end function rocsparse_csr2gebsr_map
+
       
 !       rocsparse_csr2csr_compress
         function rocsparse_scsr2csr_compress(handle, m, n, descr_A, csr_val_A, &
@@ -5826,6 +7724,143 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zhyb2csr
 
+!       rocsparse_sellc2csr_nnz
+        function rocsparse_sellc2csr_nnz(handle, m, n, sell_descr, sell_slice_size, &
+                sell_slice_ptr, sell_col_ind, sell_perm, csr_descr, csr_row_ptr, &
+                csr_nnz) &
+                bind(c, name = 'rocsparse_sellc2csr_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sellc2csr_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_nnz
+        end function rocsparse_sellc2csr_nnz
+
+!       rocsparse_sellc2csr
+        function rocsparse_ssellc2csr(handle, m, n, sell_descr, sell_slice_size, &
+                sell_val, sell_slice_ptr, sell_col_ind, sell_perm, csr_descr, csr_val, &
+                csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_ssellc2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ssellc2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_ssellc2csr
+
+        function rocsparse_dsellc2csr(handle, m, n, sell_descr, sell_slice_size, &
+                sell_val, sell_slice_ptr, sell_col_ind, sell_perm, csr_descr, csr_val, &
+                csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_dsellc2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dsellc2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_dsellc2csr
+
+        function rocsparse_csellc2csr(handle, m, n, sell_descr, sell_slice_size, &
+                sell_val, sell_slice_ptr, sell_col_ind, sell_perm, csr_descr, csr_val, &
+                csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_csellc2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csellc2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_csellc2csr
+
+        function rocsparse_zsellc2csr(handle, m, n, sell_descr, sell_slice_size, &
+                sell_val, sell_slice_ptr, sell_col_ind, sell_perm, csr_descr, csr_val, &
+                csr_row_ptr, csr_col_ind) &
+                bind(c, name = 'rocsparse_zsellc2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zsellc2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: sell_descr
+            integer(c_int), value :: sell_slice_size
+            type(c_ptr), intent(in), value :: sell_val
+            type(c_ptr), intent(in), value :: sell_slice_ptr
+            type(c_ptr), intent(in), value :: sell_col_ind
+            type(c_ptr), intent(in), value :: sell_perm
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_zsellc2csr
+
+!       rocsparse_csrdelta2csr
+        function rocsparse_csrdelta2csr(handle, m, n, descr, csr_row_ptr, block_dim, &
+                csrdelta_block_ptr, csrdelta_width, csrdelta_row_col, &
+                csrdelta_col_ind, csr_col_ind) &
+                bind(c, name = 'rocsparse_csrdelta2csr')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrdelta2csr
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csrdelta_block_ptr
+            type(c_ptr), intent(in), value :: csrdelta_width
+            type(c_ptr), intent(in), value :: csrdelta_row_col
+            type(c_ptr), intent(in), value :: csrdelta_col_ind
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_csrdelta2csr
+
 !       rocsparse_create_identity_permutation
         function rocsparse_create_identity_permutation(handle, n, p) &
                 bind(c, name = 'rocsparse_create_identity_permutation')
@@ -5961,6 +7996,61 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_coosort_by_column
 
+!       rocsparse_csr_check
+        function rocsparse_csr_check(handle, m, n, nnz, descr, csr_row_ptr, &
+                csr_col_ind, data_status) &
+                bind(c, name = 'rocsparse_csr_check')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csr_check
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: data_status
+        end function rocsparse_csr_check
+
+!       rocsparse_coo_check
+        function rocsparse_coo_check(handle, m, n, nnz, descr, coo_row_ind, &
+                coo_col_ind, data_status) &
+                bind(c, name = 'rocsparse_coo_check')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_coo_check
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
+            type(c_ptr), value :: data_status
+        end function rocsparse_coo_check
+
+!       rocsparse_bsr_check
+        function rocsparse_bsr_check(handle, mb, nb, nnzb, descr, bsr_row_ptr, &
+                bsr_col_ind, block_dim, data_status) &
+                bind(c, name = 'rocsparse_bsr_check')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsr_check
+            type(c_ptr), value :: handle
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: data_status
+        end function rocsparse_bsr_check
+
 !       rocsparse_bsr2csr
         function rocsparse_sbsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
                 bsr_col_ind, block_dim, csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
@@ -407,28 +407,32 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     // Destruct
     try
     {
-        // Clean up ELL part
-        if(hyb->ell_col_ind != nullptr)
+        // ELL and COO arrays that are owned by the user are not released
+        if(!hyb->user_storage)
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-        }
-        if(hyb->ell_val != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-        }
-
-        // Clean up COO part
-        if(hyb->coo_row_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-        }
-        if(hyb->coo_col_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-        }
-        if(hyb->coo_val != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+            // Clean up ELL part
+            if(hyb->ell_col_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
+            }
+            if(hyb->ell_val != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
+            }
+
+            // Clean up COO part
+            if(hyb->coo_row_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
+            }
+            if(hyb->coo_col_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
+            }
+            if(hyb->coo_val != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+            }
         }
 
         delete hyb;
@@ -478,6 +482,30 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         return rocsparse_status_success;
     }
 
+    // Uncouple shared meta data
+    if(info->bsrsm_lower_info == info->bsrsv_lower_info)
+    {
+        info->bsrsm_lower_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrsm_upper_info == info->bsrsv_upper_info)
+    {
+        info->bsrsm_upper_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrsmt_lower_info == info->bsrsvt_lower_info)
+    {
+        info->bsrsmt_lower_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrsmt_upper_info == info->bsrsvt_upper_info)
+    {
+        info->bsrsmt_upper_info = nullptr;
+    }
+
     // Uncouple shared meta data
     if(info->csrsv_lower_info == info->csrilu0_info || info->csrsv_lower_info == info->csric0_info
        || info->csrsv_lower_info == info->csrsm_lower_info)
@@ -521,6 +549,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
     }
 
+    // Clear csrmspv info struct
+    if(info->csrmspv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmspv_info(info->csrmspv_info));
+    }
+
     // Clear bsrsvt upper info struct
     if(info->bsrsvt_upper_info != nullptr)
     {
@@ -533,6 +567,18 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsvt_lower_info));
     }
 
+    // Clear bsrsmt upper info struct
+    if(info->bsrsmt_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsmt_upper_info));
+    }
+
+    // Clear bsrsmt lower info struct
+    if(info->bsrsmt_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsmt_lower_info));
+    }
+
     // Clear csrsvt upper info struct
     if(info->csrsvt_upper_info != nullptr)
     {
@@ -581,6 +627,18 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsv_lower_info));
     }
 
+    // Clear bsrsm upper info struct
+    if(info->bsrsm_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_upper_info));
+    }
+
+    // Clear bsrsm lower info struct
+    if(info->bsrsm_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_lower_info));
+    }
+
     // Clear csrsv upper info struct
     if(info->csrsv_upper_info != nullptr)
     {
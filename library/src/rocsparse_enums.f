@@ -80,6 +80,13 @@ module rocsparse_enums
         enumerator :: rocsparse_hyb_partition_max = 2
     end enum
 
+!   rocsparse_csrmv_alg
+    enum, bind(c)
+        enumerator :: rocsparse_csrmv_alg_stream = 0
+        enumerator :: rocsparse_csrmv_alg_adaptive = 1
+        enumerator :: rocsparse_csrmv_alg_merge_path = 2
+    end enum
+
 !   rocsparse_analysis_policy
     enum, bind(c)
         enumerator :: rocsparse_analysis_policy_reuse = 0
@@ -104,6 +111,16 @@ module rocsparse_enums
         enumerator :: rocsparse_layer_mode_log_bench = 2
     end enum
 
+!   rocsparse_data_status
+    enum, bind(c)
+        enumerator :: rocsparse_data_status_success = 0
+        enumerator :: rocsparse_data_status_invalid_offset_ptr = 1
+        enumerator :: rocsparse_data_status_invalid_index = 2
+        enumerator :: rocsparse_data_status_invalid_sorting = 3
+        enumerator :: rocsparse_data_status_duplicate_entry = 4
+        enumerator :: rocsparse_data_status_missing_diagonal = 5
+    end enum
+
 !   rocsparse_status
     enum, bind(c)
         enumerator :: rocsparse_status_success = 0